@@ -0,0 +1,410 @@
+/*
+ ## Cypress USB 3.0 Platform source file (cyfxuvccontrols.c)
+ ## ===========================
+ ##
+ ##  Copyright Cypress Semiconductor Corporation, 2010-2023,
+ ##  All Rights Reserved
+ ##  UNPUBLISHED, LICENSED SOFTWARE.
+ ##
+ ##  CONFIDENTIAL AND PROPRIETARY INFORMATION
+ ##  WHICH IS THE PROPERTY OF CYPRESS.
+ ##
+ ##  Use of this file is governed
+ ##  by the license agreement included in the file
+ ##
+ ##     <install>/license/license.txt
+ ##
+ ##  where <install> is the Cypress software
+ ##  installation root directory path.
+ ##
+ ## ===========================
+*/
+
+/* This file contains the table of the unit controls handled by the control dispatcher (cyfxuvcctrl.c).
+ * It is generated by tools/fx3_uvc_dscr_gen.py from cyfxuvcstreams.json together with the bmControls bitmaps
+ * of the unit descriptors in cyfxuvcdscr.c, so that the device answers for exactly the controls it
+ * reports: edit the stream table and run the generator again instead of editing this file.
+ */
+
+#include "cyfxuvcinmem.h"
+
+/* Unit 1 (input terminal), CY_FX_UVC_CT_AE_MODE_CONTROL: INFO, LEN, MIN, MAX, RES and DEF responses. */
+static const uint8_t glUnit1Ctrl02Attr[] = {
+    0x03,                                   /* GET_INFO: GET, SET */
+    0x01, 0x00,                             /* GET_LEN: 1 byte */
+    0x01,                                   /* GET_MIN: 1 */
+    0x01,                                   /* GET_MAX: 1 */
+    0x01,                                   /* GET_RES: 1 */
+    0x01                                    /* GET_DEF: 1 */
+};
+
+/* Unit 1 (input terminal), CY_FX_UVC_CT_EXPOSURE_TIME_ABSOLUTE_CONTROL: INFO, LEN, MIN, MAX, RES and DEF responses. */
+static const uint8_t glUnit1Ctrl04Attr[] = {
+    0x13,                                   /* GET_INFO: GET, SET, ASYNC */
+    0x04, 0x00,                             /* GET_LEN: 4 bytes */
+    0x01, 0x00, 0x00, 0x00,                 /* GET_MIN: 1 */
+    0x90, 0x01, 0x00, 0x00,                 /* GET_MAX: 400 */
+    0x01, 0x00, 0x00, 0x00,                 /* GET_RES: 1 */
+    0x64, 0x00, 0x00, 0x00                  /* GET_DEF: 100 */
+};
+
+/* Unit 2 (proc unit), CY_FX_UVC_PU_BRIGHTNESS_CONTROL: INFO, LEN, MIN, MAX, RES and DEF responses. */
+static const uint8_t glUnit2Ctrl02Attr[] = {
+    0x13,                                   /* GET_INFO: GET, SET, ASYNC */
+    0x02, 0x00,                             /* GET_LEN: 2 bytes */
+    0x00, 0x00,                             /* GET_MIN: 0 */
+    0xFF, 0x00,                             /* GET_MAX: 255 */
+    0x01, 0x00,                             /* GET_RES: 1 */
+    0x80, 0x00                              /* GET_DEF: 128 */
+};
+
+/* Unit 2 (proc unit), CY_FX_UVC_PU_CONTRAST_CONTROL: INFO, LEN, MIN, MAX, RES and DEF responses. */
+static const uint8_t glUnit2Ctrl03Attr[] = {
+    0x13,                                   /* GET_INFO: GET, SET, ASYNC */
+    0x02, 0x00,                             /* GET_LEN: 2 bytes */
+    0x00, 0x00,                             /* GET_MIN: 0 */
+    0xC8, 0x00,                             /* GET_MAX: 200 */
+    0x01, 0x00,                             /* GET_RES: 1 */
+    0x64, 0x00                              /* GET_DEF: 100 */
+};
+
+/* Unit 2 (proc unit), CY_FX_UVC_PU_GAIN_CONTROL: INFO, LEN, MIN, MAX, RES and DEF responses. */
+static const uint8_t glUnit2Ctrl04Attr[] = {
+    0x13,                                   /* GET_INFO: GET, SET, ASYNC */
+    0x02, 0x00,                             /* GET_LEN: 2 bytes */
+    0x64, 0x00,                             /* GET_MIN: 100 */
+    0x20, 0x03,                             /* GET_MAX: 800 */
+    0x01, 0x00,                             /* GET_RES: 1 */
+    0x64, 0x00                              /* GET_DEF: 100 */
+};
+
+/* Unit 2 (proc unit), CY_FX_UVC_PU_POWER_LINE_FREQUENCY_CONTROL: INFO, LEN, MIN, MAX, RES and DEF responses. */
+static const uint8_t glUnit2Ctrl05Attr[] = {
+    0x03,                                   /* GET_INFO: GET, SET */
+    0x01, 0x00,                             /* GET_LEN: 1 byte */
+    0x00,                                   /* GET_MIN: 0 */
+    0x02,                                   /* GET_MAX: 2 */
+    0x01,                                   /* GET_RES: 1 */
+    0x02                                    /* GET_DEF: 2 */
+};
+
+/* Unit 2 (proc unit), CY_FX_UVC_PU_SATURATION_CONTROL: INFO, LEN, MIN, MAX, RES and DEF responses. */
+static const uint8_t glUnit2Ctrl07Attr[] = {
+    0x13,                                   /* GET_INFO: GET, SET, ASYNC */
+    0x02, 0x00,                             /* GET_LEN: 2 bytes */
+    0x00, 0x00,                             /* GET_MIN: 0 */
+    0xC8, 0x00,                             /* GET_MAX: 200 */
+    0x01, 0x00,                             /* GET_RES: 1 */
+    0x64, 0x00                              /* GET_DEF: 100 */
+};
+
+/* Unit 5 (encoding unit), CY_FX_UVC_EU_RATE_CONTROL_MODE_CONTROL: INFO, LEN, MIN, MAX, RES and DEF responses. */
+static const uint8_t glUnit5Ctrl06Attr[] = {
+    0x03,                                   /* GET_INFO: GET, SET */
+    0x01, 0x00,                             /* GET_LEN: 1 byte */
+    0x01,                                   /* GET_MIN: 1 */
+    0x03,                                   /* GET_MAX: 3 */
+    0x01,                                   /* GET_RES: 1 */
+    0x02                                    /* GET_DEF: 2 */
+};
+
+/* Unit 5 (encoding unit), CY_FX_UVC_EU_AVERAGE_BITRATE_CONTROL: INFO, LEN, MIN, MAX, RES and DEF responses. */
+static const uint8_t glUnit5Ctrl07Attr[] = {
+    0x03,                                   /* GET_INFO: GET, SET */
+    0x04, 0x00,                             /* GET_LEN: 4 bytes */
+    0x40, 0x1F, 0x00, 0x00,                 /* GET_MIN: 8000 */
+    0x00, 0x00, 0xB8, 0x0B,                 /* GET_MAX: 196608000 */
+    0xE8, 0x03, 0x00, 0x00,                 /* GET_RES: 1000 */
+    0x00, 0x00, 0xB8, 0x0B                  /* GET_DEF: 196608000 */
+};
+
+/* Unit 5 (encoding unit), CY_FX_UVC_EU_CPB_SIZE_CONTROL: INFO, LEN, MIN, MAX, RES and DEF responses. */
+static const uint8_t glUnit5Ctrl08Attr[] = {
+    0x03,                                   /* GET_INFO: GET, SET */
+    0x04, 0x00,                             /* GET_LEN: 4 bytes */
+    0x00, 0x04, 0x00, 0x00,                 /* GET_MIN: 1024 */
+    0x00, 0x80, 0xBB, 0x00,                 /* GET_MAX: 12288000 */
+    0x01, 0x00, 0x00, 0x00,                 /* GET_RES: 1 */
+    0x00, 0x80, 0xBB, 0x00                  /* GET_DEF: 12288000 */
+};
+
+/* Unit 5 (encoding unit), CY_FX_UVC_EU_PEAK_BIT_RATE_CONTROL: INFO, LEN, MIN, MAX, RES and DEF responses. */
+static const uint8_t glUnit5Ctrl09Attr[] = {
+    0x03,                                   /* GET_INFO: GET, SET */
+    0x04, 0x00,                             /* GET_LEN: 4 bytes */
+    0x40, 0x1F, 0x00, 0x00,                 /* GET_MIN: 8000 */
+    0x00, 0x00, 0xB8, 0x0B,                 /* GET_MAX: 196608000 */
+    0xE8, 0x03, 0x00, 0x00,                 /* GET_RES: 1000 */
+    0x00, 0x00, 0xB8, 0x0B                  /* GET_DEF: 196608000 */
+};
+
+/* Unit 5 (encoding unit), CY_FX_UVC_EU_QUANTIZATION_PARAMS_CONTROL: INFO, LEN, MIN, MAX, RES and DEF responses. */
+static const uint8_t glUnit5Ctrl0AAttr[] = {
+    0x03,                                   /* GET_INFO: GET, SET */
+    0x06, 0x00,                             /* GET_LEN: 6 bytes */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,     /* GET_MIN: 0, 0, 0 */
+    0x33, 0x00, 0x33, 0x00, 0x33, 0x00,     /* GET_MAX: 51, 51, 51 */
+    0x01, 0x00, 0x01, 0x00, 0x01, 0x00,     /* GET_RES: 1, 1, 1 */
+    0x19, 0x00, 0x1C, 0x00, 0x1C, 0x00      /* GET_DEF: 25, 28, 28 */
+};
+
+/* Unit 5 (encoding unit), CY_FX_UVC_EU_SYNC_REF_FRAME_CONTROL: INFO, LEN, MIN, MAX, RES and DEF responses. */
+static const uint8_t glUnit5Ctrl0BAttr[] = {
+    0x03,                                   /* GET_INFO: GET, SET */
+    0x04, 0x00,                             /* GET_LEN: 4 bytes */
+    0x01, 0x00, 0x00, 0x00,                 /* GET_MIN: 1, 0, 0 */
+    0x03, 0xFF, 0xFF, 0x00,                 /* GET_MAX: 3, 65535, 0 */
+    0x02, 0x01, 0x00, 0x01,                 /* GET_RES: 2, 1, 1 */
+    0x01, 0x00, 0x00, 0x00                  /* GET_DEF: 1, 0, 0 */
+};
+
+/* Unit 5 (encoding unit), CY_FX_UVC_EU_SELECT_LAYER_CONTROL: INFO, LEN, MIN, MAX, RES and DEF responses. */
+static const uint8_t glUnit5Ctrl01Attr[] = {
+    0x03,                                   /* GET_INFO: GET, SET */
+    0x02, 0x00,                             /* GET_LEN: 2 bytes */
+    0x00, 0x00,                             /* GET_MIN: 0 */
+    0x00, 0x04,                             /* GET_MAX: 1024 */
+    0x00, 0x04,                             /* GET_RES: 1024 */
+    0x00, 0x00                              /* GET_DEF: 0 */
+};
+
+/* Unit 5 (encoding unit), CY_FX_UVC_EU_START_OR_STOP_LAYER_CONTROL: INFO, LEN, MIN, MAX, RES and DEF responses. */
+static const uint8_t glUnit5Ctrl13Attr[] = {
+    0x0B,                                   /* GET_INFO: GET, SET, AUTOUPDATE */
+    0x01, 0x00,                             /* GET_LEN: 1 byte */
+    0x00,                                   /* GET_MIN: 0 */
+    0x01,                                   /* GET_MAX: 1 */
+    0x01,                                   /* GET_RES: 1 */
+    0x01                                    /* GET_DEF: 1 */
+};
+
+/* Unit 5 (encoding unit), CY_FX_UVC_EU_SLICE_MODE_CONTROL: INFO, LEN, MIN, MAX, RES and DEF responses. */
+static const uint8_t glUnit5Ctrl05Attr[] = {
+    0x03,                                   /* GET_INFO: GET, SET */
+    0x04, 0x00,                             /* GET_LEN: 4 bytes */
+    0x01, 0x00, 0x01, 0x00,                 /* GET_MIN: 1, 1 */
+    0x02, 0x00, 0xFF, 0xFF,                 /* GET_MAX: 2, 65535 */
+    0x01, 0x00, 0x01, 0x00,                 /* GET_RES: 1, 1 */
+    0x02, 0x00, 0x01, 0x00                  /* GET_DEF: 2, 1 */
+};
+
+/* Unit 5 (encoding unit), CY_FX_UVC_EU_ERROR_RESILIENCY_CONTROL: INFO, LEN, MIN, MAX, RES and DEF responses. */
+static const uint8_t glUnit5Ctrl14Attr[] = {
+    0x03,                                   /* GET_INFO: GET, SET */
+    0x02, 0x00,                             /* GET_LEN: 2 bytes */
+    0x00, 0x00,                             /* GET_MIN: 0 */
+    0x03, 0xFF,                             /* GET_MAX: 65283 */
+    0x01, 0x00,                             /* GET_RES: 1 */
+    0x00, 0x00                              /* GET_DEF: 0 */
+};
+
+/* Current values of the controls, back to back. The buffer is sent to the host as it is, so it is
+   cache line aligned and a whole number of cache lines long. */
+static uint8_t glUvcCtrlCur[64] __attribute__ ((aligned (32)));
+
+/* Controls implemented by the device. */
+const CyFxUvcCtrlInfo_t glUvcCtrls[] = {
+    {
+        1,                                      /* Unit ID */
+        CY_FX_UVC_CT_AE_MODE_CONTROL,
+        1,                                      /* Length in bytes */
+        { 1, 0, 0, 0 },                         /* Field sizes */
+        CY_FX_UVC_CTRL_APPLY_NONE,
+        CyTrue,                                 /* Settable while streaming */
+        glUnit1Ctrl02Attr,
+        glUvcCtrlCur + 0
+    },
+    {
+        1,                                      /* Unit ID */
+        CY_FX_UVC_CT_EXPOSURE_TIME_ABSOLUTE_CONTROL,
+        4,                                      /* Length in bytes */
+        { 4, 0, 0, 0 },                         /* Field sizes */
+        CY_FX_UVC_CTRL_APPLY_PICTURE,
+        CyTrue,                                 /* Settable while streaming */
+        glUnit1Ctrl04Attr,
+        glUvcCtrlCur + 1
+    },
+    {
+        2,                                      /* Unit ID */
+        CY_FX_UVC_PU_BRIGHTNESS_CONTROL,
+        2,                                      /* Length in bytes */
+        { 2, 0, 0, 0 },                         /* Field sizes */
+        CY_FX_UVC_CTRL_APPLY_PICTURE,
+        CyTrue,                                 /* Settable while streaming */
+        glUnit2Ctrl02Attr,
+        glUvcCtrlCur + 5
+    },
+    {
+        2,                                      /* Unit ID */
+        CY_FX_UVC_PU_CONTRAST_CONTROL,
+        2,                                      /* Length in bytes */
+        { 2, 0, 0, 0 },                         /* Field sizes */
+        CY_FX_UVC_CTRL_APPLY_PICTURE,
+        CyTrue,                                 /* Settable while streaming */
+        glUnit2Ctrl03Attr,
+        glUvcCtrlCur + 7
+    },
+    {
+        2,                                      /* Unit ID */
+        CY_FX_UVC_PU_GAIN_CONTROL,
+        2,                                      /* Length in bytes */
+        { 2, 0, 0, 0 },                         /* Field sizes */
+        CY_FX_UVC_CTRL_APPLY_PICTURE,
+        CyTrue,                                 /* Settable while streaming */
+        glUnit2Ctrl04Attr,
+        glUvcCtrlCur + 9
+    },
+    {
+        2,                                      /* Unit ID */
+        CY_FX_UVC_PU_POWER_LINE_FREQUENCY_CONTROL,
+        1,                                      /* Length in bytes */
+        { 1, 0, 0, 0 },                         /* Field sizes */
+        CY_FX_UVC_CTRL_APPLY_NONE,
+        CyTrue,                                 /* Settable while streaming */
+        glUnit2Ctrl05Attr,
+        glUvcCtrlCur + 11
+    },
+    {
+        2,                                      /* Unit ID */
+        CY_FX_UVC_PU_SATURATION_CONTROL,
+        2,                                      /* Length in bytes */
+        { 2, 0, 0, 0 },                         /* Field sizes */
+        CY_FX_UVC_CTRL_APPLY_PICTURE,
+        CyTrue,                                 /* Settable while streaming */
+        glUnit2Ctrl07Attr,
+        glUvcCtrlCur + 12
+    },
+    {
+        5,                                      /* Unit ID */
+        CY_FX_UVC_EU_RATE_CONTROL_MODE_CONTROL,
+        1,                                      /* Length in bytes */
+        { 1, 0, 0, 0 },                         /* Field sizes */
+        CY_FX_UVC_CTRL_APPLY_NONE,
+        CyTrue,                                 /* Settable while streaming */
+        glUnit5Ctrl06Attr,
+        glUvcCtrlCur + 14
+    },
+    {
+        5,                                      /* Unit ID */
+        CY_FX_UVC_EU_AVERAGE_BITRATE_CONTROL,
+        4,                                      /* Length in bytes */
+        { 4, 0, 0, 0 },                         /* Field sizes */
+        CY_FX_UVC_CTRL_APPLY_NONE,
+        CyTrue,                                 /* Settable while streaming */
+        glUnit5Ctrl07Attr,
+        glUvcCtrlCur + 15
+    },
+    {
+        5,                                      /* Unit ID */
+        CY_FX_UVC_EU_CPB_SIZE_CONTROL,
+        4,                                      /* Length in bytes */
+        { 4, 0, 0, 0 },                         /* Field sizes */
+        CY_FX_UVC_CTRL_APPLY_NONE,
+        CyTrue,                                 /* Settable while streaming */
+        glUnit5Ctrl08Attr,
+        glUvcCtrlCur + 19
+    },
+    {
+        5,                                      /* Unit ID */
+        CY_FX_UVC_EU_PEAK_BIT_RATE_CONTROL,
+        4,                                      /* Length in bytes */
+        { 4, 0, 0, 0 },                         /* Field sizes */
+        CY_FX_UVC_CTRL_APPLY_NONE,
+        CyTrue,                                 /* Settable while streaming */
+        glUnit5Ctrl09Attr,
+        glUvcCtrlCur + 23
+    },
+    {
+        5,                                      /* Unit ID */
+        CY_FX_UVC_EU_QUANTIZATION_PARAMS_CONTROL,
+        6,                                      /* Length in bytes */
+        { 2, 2, 2, 0 },                         /* Field sizes */
+        CY_FX_UVC_CTRL_APPLY_NONE,
+        CyTrue,                                 /* Settable while streaming */
+        glUnit5Ctrl0AAttr,
+        glUvcCtrlCur + 27
+    },
+    {
+        5,                                      /* Unit ID */
+        CY_FX_UVC_EU_SYNC_REF_FRAME_CONTROL,
+        4,                                      /* Length in bytes */
+        { 1, 2, 1, 0 },                         /* Field sizes */
+        CY_FX_UVC_CTRL_APPLY_SYNC,
+        CyTrue,                                 /* Settable while streaming */
+        glUnit5Ctrl0BAttr,
+        glUvcCtrlCur + 33
+    },
+    {
+        5,                                      /* Unit ID */
+        CY_FX_UVC_EU_SELECT_LAYER_CONTROL,
+        2,                                      /* Length in bytes */
+        { 2, 0, 0, 0 },                         /* Field sizes */
+        CY_FX_UVC_CTRL_APPLY_LAYER,
+        CyTrue,                                 /* Settable while streaming */
+        glUnit5Ctrl01Attr,
+        glUvcCtrlCur + 37
+    },
+    {
+        5,                                      /* Unit ID */
+        CY_FX_UVC_EU_START_OR_STOP_LAYER_CONTROL,
+        1,                                      /* Length in bytes */
+        { 1, 0, 0, 0 },                         /* Field sizes */
+        CY_FX_UVC_CTRL_APPLY_LAYER,
+        CyTrue,                                 /* Settable while streaming */
+        glUnit5Ctrl13Attr,
+        glUvcCtrlCur + 39
+    },
+    {
+        5,                                      /* Unit ID */
+        CY_FX_UVC_EU_SLICE_MODE_CONTROL,
+        4,                                      /* Length in bytes */
+        { 2, 2, 0, 0 },                         /* Field sizes */
+        CY_FX_UVC_CTRL_APPLY_SLICE,
+        CyTrue,                                 /* Settable while streaming */
+        glUnit5Ctrl05Attr,
+        glUvcCtrlCur + 40
+    },
+    {
+        5,                                      /* Unit ID */
+        CY_FX_UVC_EU_ERROR_RESILIENCY_CONTROL,
+        2,                                      /* Length in bytes */
+        { 2, 0, 0, 0 },                         /* Field sizes */
+        CY_FX_UVC_CTRL_APPLY_RESIL,
+        CyTrue,                                 /* Settable while streaming */
+        glUnit5Ctrl14Attr,
+        glUvcCtrlCur + 44
+    }
+};
+
+const uint8_t glUvcCtrlCount = sizeof (glUvcCtrls) / sizeof (CyFxUvcCtrlInfo_t);
+
+/* Controls of unit 1, by selector: index in glUvcCtrls plus one, 0 if not implemented. */
+static const uint8_t glUnit1CtrlIndex[] = {
+    0, 0, 1, 0, 2
+};
+
+/* Controls of unit 2, by selector: index in glUvcCtrls plus one, 0 if not implemented. */
+static const uint8_t glUnit2CtrlIndex[] = {
+    0, 0, 3, 4, 5, 6, 0, 7
+};
+
+/* Controls of unit 5, by selector: index in glUvcCtrls plus one, 0 if not implemented. */
+static const uint8_t glUnit5CtrlIndex[] = {
+    0, 14, 0, 0, 0, 16, 8, 9, 10, 11, 12, 13, 0, 0, 0, 0,
+    0, 0, 0, 15, 17
+};
+
+/* Controls of each unit, by unit ID: descriptor subtype (0 for an ID that no unit or terminal has),
+   number of selectors and their index. */
+const CyFxUvcCtrlUnit_t glUvcCtrlUnits[] = {
+    { 0x00, 0, NULL },                      /* Unit 0 */
+    { 0x02, 5, glUnit1CtrlIndex },          /* Unit 1, input terminal */
+    { 0x05, 8, glUnit2CtrlIndex },          /* Unit 2, proc unit */
+    { 0x06, 0, NULL },                      /* Unit 3, extn unit */
+    { 0x03, 0, NULL },                      /* Unit 4, output terminal */
+    { 0x07, 21, glUnit5CtrlIndex }          /* Unit 5, encoding unit */
+};
+
+const uint8_t glUvcCtrlUnitCount = sizeof (glUvcCtrlUnits) / sizeof (CyFxUvcCtrlUnit_t);
+
+/* [ ] */
@@ -0,0 +1,261 @@
+/*
+ ## Cypress USB 3.0 Platform source file (cyfxuvcctrl.c)
+ ## ===========================
+ ##
+ ##  Copyright Cypress Semiconductor Corporation, 2010-2023,
+ ##  All Rights Reserved
+ ##  UNPUBLISHED, LICENSED SOFTWARE.
+ ##
+ ##  CONFIDENTIAL AND PROPRIETARY INFORMATION
+ ##  WHICH IS THE PROPERTY OF CYPRESS.
+ ##
+ ##  Use of this file is governed
+ ##  by the license agreement included in the file
+ ##
+ ##     <install>/license/license.txt
+ ##
+ ##  where <install> is the Cypress software
+ ##  installation root directory path.
+ ##
+ ## ===========================
+*/
+
+/* This file implements the requests on the controls of the video control interface units, against
+   the control table in glUvcCtrls.
+
+   Control requests are handled in the USB setup callback while video is streaming. A control is found
+   with two table lookups, unit ID and then selector, and every GET request is answered from the
+   attribute block or the current value of the control without any computation, so that control
+   traffic costs the same whatever the number of controls. Only SET_CUR checks the new value.
+
+   Every request that goes through the dispatcher leaves its outcome in the request error code, which
+   the host reads with VC_REQUEST_ERROR_CODE_CONTROL after a request has been stalled. Requests that the
+   firmware turns down before they get here record their code with CyFxUvcCtrlRequestDone.
+ */
+
+#include <cyu3error.h>
+#include "cyfxuvcinmem.h"
+#include "cyfxuvcctrl.h"
+
+/* Responses of the error code controls: the request error code, the stream error code and the GET_INFO
+   value of both, in a buffer of its own that can be sent from without touching other data. */
+#define CY_FX_UVC_CTRL_ERROR_INFO       (2)
+static uint8_t glUvcCtrlErrorBuf[32] __attribute__ ((aligned (32)));
+
+/* Read a little endian field of size bytes. */
+static uint32_t
+CyFxUvcCtrlReadField (
+        const uint8_t *buf_p,
+        uint8_t        size)
+{
+    uint32_t value = 0;
+
+    while (size--)
+        value = (value << 8) | buf_p[size];
+    return value;
+}
+
+void
+CyFxUvcCtrlInit (
+        void)
+{
+    const CyFxUvcCtrlInfo_t *ctrl_p;
+    uint8_t i, j;
+
+    for (i = 0; i < glUvcCtrlCount; i++)
+    {
+        ctrl_p = &glUvcCtrls[i];
+        for (j = 0; j < ctrl_p->length; j++)
+            ctrl_p->cur_p[j] = ctrl_p->attr_p[CY_FX_UVC_CTRL_ATTR_DEF (ctrl_p->length) + j];
+    }
+
+    glUvcCtrlErrorBuf[CY_FX_UVC_CTRL_ERROR_REQUEST] = CY_FX_UVC_CTRL_ERR_NONE;
+    glUvcCtrlErrorBuf[CY_FX_UVC_CTRL_ERROR_STREAM]  = CY_FX_UVC_STREAM_ERR_NONE;
+    glUvcCtrlErrorBuf[CY_FX_UVC_CTRL_ERROR_INFO]    = CY_FX_UVC_CTRL_INFO_GET;
+}
+
+const CyFxUvcCtrlInfo_t *
+CyFxUvcCtrlFind (
+        uint8_t unitId,
+        uint8_t selector)
+{
+    const CyFxUvcCtrlUnit_t *unit_p;
+    uint8_t index;
+
+    if (unitId >= glUvcCtrlUnitCount)
+        return NULL;
+    unit_p = &glUvcCtrlUnits[unitId];
+    if (selector >= unit_p->selectorCount)
+        return NULL;
+    index = unit_p->index_p[selector];
+    return (index != 0) ? &glUvcCtrls[index - 1] : NULL;
+}
+
+const CyFxUvcCtrlInfo_t *
+CyFxUvcCtrlLookup (
+        uint8_t unitId,
+        uint8_t selector)
+{
+    const CyFxUvcCtrlInfo_t *ctrl_p = CyFxUvcCtrlFind (unitId, selector);
+
+    if (ctrl_p == NULL)
+    {
+        glUvcCtrlErrorBuf[CY_FX_UVC_CTRL_ERROR_REQUEST] =
+            ((unitId < glUvcCtrlUnitCount) && (glUvcCtrlUnits[unitId].subtype != 0)) ?
+            CY_FX_UVC_CTRL_ERR_INVALID_CONTROL : CY_FX_UVC_CTRL_ERR_INVALID_UNIT;
+    }
+    return ctrl_p;
+}
+
+CyU3PReturnStatus_t
+CyFxUvcCtrlGet (
+        const CyFxUvcCtrlInfo_t *ctrl_p,
+        uint8_t                  bRequest,
+        const uint8_t          **buf_pp,
+        uint16_t                *len_p)
+{
+    uint8_t len = ctrl_p->length;
+
+    *len_p = len;
+    switch (bRequest)
+    {
+        case CY_FX_USB_UVC_GET_CUR_REQ:
+            *buf_pp = ctrl_p->cur_p;
+            break;
+
+        case CY_FX_USB_UVC_GET_INFO_REQ:
+            *buf_pp = ctrl_p->attr_p + CY_FX_UVC_CTRL_ATTR_INFO;
+            *len_p  = 1;
+            break;
+
+        case CY_FX_USB_UVC_GET_LEN_REQ:
+            *buf_pp = ctrl_p->attr_p + CY_FX_UVC_CTRL_ATTR_LEN;
+            *len_p  = 2;
+            break;
+
+        case CY_FX_USB_UVC_GET_MIN_REQ:
+            *buf_pp = ctrl_p->attr_p + CY_FX_UVC_CTRL_ATTR_MIN (len);
+            break;
+
+        case CY_FX_USB_UVC_GET_MAX_REQ:
+            *buf_pp = ctrl_p->attr_p + CY_FX_UVC_CTRL_ATTR_MAX (len);
+            break;
+
+        case CY_FX_USB_UVC_GET_RES_REQ:
+            *buf_pp = ctrl_p->attr_p + CY_FX_UVC_CTRL_ATTR_RES (len);
+            break;
+
+        case CY_FX_USB_UVC_GET_DEF_REQ:
+            *buf_pp = ctrl_p->attr_p + CY_FX_UVC_CTRL_ATTR_DEF (len);
+            break;
+
+        default:
+            glUvcCtrlErrorBuf[CY_FX_UVC_CTRL_ERROR_REQUEST] = CY_FX_UVC_CTRL_ERR_INVALID_REQUEST;
+            return CY_U3P_ERROR_NOT_SUPPORTED;
+    }
+
+    glUvcCtrlErrorBuf[CY_FX_UVC_CTRL_ERROR_REQUEST] = CY_FX_UVC_CTRL_ERR_NONE;
+    return CY_U3P_SUCCESS;
+}
+
+CyU3PReturnStatus_t
+CyFxUvcCtrlSet (
+        const CyFxUvcCtrlInfo_t *ctrl_p,
+        const uint8_t           *buf_p,
+        uint16_t                 len)
+{
+    const uint8_t *attr_p = ctrl_p->attr_p;
+    uint32_t value, min, max, res;
+    uint8_t  i, size, offset = 0;
+
+    if ((attr_p[CY_FX_UVC_CTRL_ATTR_INFO] & CY_FX_UVC_CTRL_INFO_SET) == 0)
+    {
+        glUvcCtrlErrorBuf[CY_FX_UVC_CTRL_ERROR_REQUEST] = CY_FX_UVC_CTRL_ERR_INVALID_REQUEST;
+        return CY_U3P_ERROR_NOT_SUPPORTED;
+    }
+    if (len != ctrl_p->length)
+    {
+        glUvcCtrlErrorBuf[CY_FX_UVC_CTRL_ERROR_REQUEST] = CY_FX_UVC_CTRL_ERR_INVALID_REQUEST;
+        return CY_U3P_ERROR_BAD_ARGUMENT;
+    }
+
+    /* Check every field before any of them is stored. A resolution of 0 or 1 allows any value. */
+    for (i = 0; (i < CY_FX_UVC_CTRL_MAX_FIELDS) && (ctrl_p->fieldSize[i] != 0); i++)
+    {
+        size  = ctrl_p->fieldSize[i];
+        value = CyFxUvcCtrlReadField (buf_p + offset, size);
+        min   = CyFxUvcCtrlReadField (attr_p + CY_FX_UVC_CTRL_ATTR_MIN (len) + offset, size);
+        max   = CyFxUvcCtrlReadField (attr_p + CY_FX_UVC_CTRL_ATTR_MAX (len) + offset, size);
+        res   = CyFxUvcCtrlReadField (attr_p + CY_FX_UVC_CTRL_ATTR_RES (len) + offset, size);
+        if ((value < min) || (value > max))
+        {
+            glUvcCtrlErrorBuf[CY_FX_UVC_CTRL_ERROR_REQUEST] = CY_FX_UVC_CTRL_ERR_OUT_OF_RANGE;
+            return CY_U3P_ERROR_BAD_ARGUMENT;
+        }
+        if ((res > 1) && (((value - min) % res) != 0))
+        {
+            glUvcCtrlErrorBuf[CY_FX_UVC_CTRL_ERROR_REQUEST] = CY_FX_UVC_CTRL_ERR_INVALID_VALUE;
+            return CY_U3P_ERROR_BAD_ARGUMENT;
+        }
+        offset += size;
+    }
+
+    for (i = 0; i < len; i++)
+        ctrl_p->cur_p[i] = buf_p[i];
+    glUvcCtrlErrorBuf[CY_FX_UVC_CTRL_ERROR_REQUEST] = CY_FX_UVC_CTRL_ERR_NONE;
+    return CY_U3P_SUCCESS;
+}
+
+uint32_t
+CyFxUvcCtrlField (
+        const CyFxUvcCtrlInfo_t *ctrl_p,
+        uint8_t                  field)
+{
+    uint8_t i, offset = 0;
+
+    for (i = 0; i < field; i++)
+        offset += ctrl_p->fieldSize[i];
+    return CyFxUvcCtrlReadField (ctrl_p->cur_p + offset, ctrl_p->fieldSize[field]);
+}
+
+void
+CyFxUvcCtrlRequestDone (
+        uint8_t code)
+{
+    glUvcCtrlErrorBuf[CY_FX_UVC_CTRL_ERROR_REQUEST] = code;
+}
+
+void
+CyFxUvcCtrlStreamError (
+        uint8_t code)
+{
+    glUvcCtrlErrorBuf[CY_FX_UVC_CTRL_ERROR_STREAM] = code;
+}
+
+CyU3PReturnStatus_t
+CyFxUvcCtrlErrorGet (
+        uint8_t                  control,
+        uint8_t                  bRequest,
+        const uint8_t          **buf_pp,
+        uint16_t                *len_p)
+{
+    switch (bRequest)
+    {
+        case CY_FX_USB_UVC_GET_CUR_REQ:
+            *buf_pp = &glUvcCtrlErrorBuf[control];
+            break;
+
+        case CY_FX_USB_UVC_GET_INFO_REQ:
+            *buf_pp = &glUvcCtrlErrorBuf[CY_FX_UVC_CTRL_ERROR_INFO];
+            break;
+
+        default:
+            return CY_U3P_ERROR_NOT_SUPPORTED;
+    }
+
+    *len_p = 1;
+    return CY_U3P_SUCCESS;
+}
+
+/*[]*/
+
@@ -30,10 +30,10 @@
    On successful enumeration the device shows up in the Windows Explorer. When the device is opened
    the host initiates a set of UVC specific class requests. The main class requests that need to be
    handled by the device are the GET/SET probe control request and SET commit control request. These
-   request deal with the ISO bandwidth stream negotiation between the host and the device. In this
-   example these requests are spoofed such that the host has only one alternate setting as the option.
-   A predefined probe setting is returned as part of the Get Probe request. The Set probe / commit
-   request is not interpreted and is only acknowledged.
+   request deal with the ISO bandwidth stream negotiation between the host and the device. The values
+   proposed by the host are adjusted to a format, frame and frame interval that the device supports
+   and that fit the bandwidth of the current connection (see cyfxuvcprobe.c). The committed values
+   select the video frames that are streamed.
 
    With successful stream negotiation the host issues request to switch to alternate setting 1 which
    starts the video streaming.
@@ -44,8 +44,15 @@
    indexed video frame is chosen for transfer. When all the frames are transferred, the index is reset
    to start transfer from the first video frame.
 
+   H.264 and H.265 streams are stored and sent the same way, one Annex B access unit per video frame:
+   an access unit goes out in payloads of its own, the last one with the end of frame bit set, and the
+   frame ID toggles from one access unit to the next, as the UVC 1.5 H.264 and frame based payload
+   formats require. The first access unit is an IDR picture with the parameter sets in front, so a
+   stream that starts over from the first video frame can always be decoded from there.
+
    CY_FX_UVC_STREAM_BUF_SIZE and CY_FX_UVC_STREAM_BUF_COUNT in the header file define the DMA buffer
-   size and the number of DMA buffers respectively.
+   size and the number of DMA buffers respectively. The buffer count scales with the memory map profile
+   selected in cyfxtx.h.
 
    This example is not supported on full speed interface.
 
@@ -66,6 +73,7 @@
 #include "cyu3usb.h"
 #include "cyu3uart.h"
 #include "cyu3utils.h"
+#include "cyu3vic.h"
 
 /* Setup data field : Request */
 #define CY_U3P_USB_REQUEST_MASK                       (0x0000FF00)
@@ -82,7 +90,17 @@
 #define FX3_USB2_INEP_EPM_DSIZE_MASK    (0x07FFF800)
 #define FX3_USB2_INEP_EPM_DSIZE_POS     (11)
 
+/* The stream needs at least two buffers so that one can be filled while the other is in flight. */
+CY_U3P_STATIC_ASSERT ((CY_FX_UVC_STREAM_BUF_COUNT >= 2), uvc_stream_buf_count);
+
+/* The DMA driver cleans the stream buffers from the data cache in whole cache lines. A size that is a
+   multiple of the cache line size guarantees that no other buffer shares a cache line with them. */
+CY_U3P_STATIC_ASSERT (((CY_FX_UVC_STREAM_BUF_SIZE % FX3_CACHE_LINE_SZ) == 0), uvc_stream_buf_line_size);
+
 CyU3PEpConfig_t uvcVideoEpCfg;
+#ifdef CY_FX_UVC_MEM_CHECK_ENABLE
+CyU3PThread uvcMemCheckThread;      /* Background memory check thread structure */
+#endif
 CyU3PThread uvcAppThread;                                       /* Thread structure */
 static volatile uint8_t CurrentMultVal = 1;                     /* MULT value programmed into the EPM. */
 
@@ -95,12 +113,81 @@ uint8_t glUVCHeader[CY_FX_UVC_MAX_HEADER] =
     0x00,0x00,0x00,0x00,0x00,0x00   /* Source clock reference field */
 };
 
-/* Video Probe Commit Control */
-uint8_t glCommitCtrl[CY_FX_UVC_MAX_PROBE_SETTING_ALIGNED] __attribute__ ((aligned (32)));
+/* Receive buffer for SET_CUR on the video probe and commit controls. */
+uint8_t glProbeCtrlBuf[CY_FX_UVC_MAX_PROBE_SETTING_ALIGNED] __attribute__ ((aligned (32)));
+
+/* Receive buffer for SET_CUR on the unit controls. */
+uint8_t glUvcCtrlBuf[CY_FX_UVC_CTRL_MAX_LEN] __attribute__ ((aligned (32)));
+
+/* Probe and commit negotiation state of the current configuration. GET requests on the two controls are
+   answered from the responses prepared in here. */
+static CyFxUvcProbeState_t glProbeState;
+
+/* Video frame, payload size and frame interval used by the streamer. Taken from the commit control on
+   stream start. */
+static const CyFxUvcFrameInfo_t *glStreamFrame_p = NULL;
+static uint32_t glStreamPayload = CY_FX_UVC_STREAM_BUF_SIZE;
+static uint32_t glStreamInterval = 0;                  /* Committed frame interval in 100 ns units. */
+
+/* Pattern generator state for frames of the uncompressed formats, which are generated as they are sent. */
+static CyFxUvcPattern_t glStreamPattern;
+
+/* Set by a SET_CUR on a picture control of the camera terminal or processing unit; the streamer takes the
+   new colours of the generated frames at the next frame start, so that no frame is drawn with two. */
+static volatile CyBool_t glPictureChange = CyFalse;
+
+/* Status packets of the status interrupt endpoint: the queue of events to report, the packet being built
+   and the channel it is sent on, one packet at a time. */
+static CyFxUvcStatus_t   glStatus;
+static uint8_t           glStatusPkt[CY_FX_UVC_STATUS_MAX_LEN];
+static CyU3PDmaChannel   glChHandleStatus;
+static volatile CyBool_t glStatusBusy = CyFalse;        /* A status packet is on its way to the host. */
+
+/* Bit rate shaper of the stream, and the snapshot of its statistics returned through the shaper
+   statistics vendor request. */
+static CyFxUvcShaper_t glShaper;
+static CyFxUvcShaperStats_t glShaperStats __attribute__ ((aligned (32)));
+
+/* Quality tier being streamed, for frames stored in several tiers. */
+static uint8_t glStreamTier = 0;
+
+/* Layers of a simulcast stream. */
+static CyFxUvcSimulcast_t glSimulcast;
+
+/* Bytes sent in front of the access unit being sent: the parameter sets repeated for the error resiliency
+   control, then the prefix NAL unit of a simulcast layer. */
+static uint8_t glFramePrefix[CY_FX_UVC_RESIL_PARAM_MAX + CY_FX_UVC_LAYER_PREFIX_LEN];
+
+/* Error resiliency state of the stream, and the snapshot of its statistics returned through the error
+   resiliency statistics vendor request. */
+static CyFxUvcResil_t glResil;
+static CyFxUvcResilStats_t glResilStats __attribute__ ((aligned (32)));
+
+/* Whether the stored frames of the stream are Annex B streams, whose payloads can be aligned to the NAL
+   units with the slice mode control. */
+static CyBool_t glStreamAnnexB = CyFalse;
+
+/* Sync frames: a SET_CUR on the sync and reference frame control asks for one, and the time the last IDR
+   picture was started is kept for the periodic sync frames. */
+static volatile CyBool_t glSyncRequest = CyFalse;
+static uint32_t glSyncTime = 0;
+
+/* Heap statistics snapshot returned through the heap statistics vendor request. */
+static CyU3PHeapStats_t glHeapStats __attribute__ ((aligned (32)));
+
+/* Stack areas of the application threads, used for the stack usage queries. */
+static uint32_t *glAppThreadStack_p = 0;
+#ifdef CY_FX_UVC_MEM_CHECK_ENABLE
+static uint32_t *glMemCheckStack_p  = 0;
+#endif
+
+/* Stack usage snapshot returned through the stack usage vendor request. */
+static uint32_t glStackUsage[CY_FX_UVC_STACK_USAGE_LEN / 4] __attribute__ ((aligned (32)));
 
 CyU3PDmaChannel          glChHandleUVCStream;           /* DMA Channel Handle  */
 static volatile CyBool_t glIsApplnActive = CyFalse;     /* Whether the UVC application is active or not. */
 static volatile CyBool_t glIsDevConfigured = CyFalse;   /* Whether the device has been configured. */
+static volatile CyBool_t glIsFuncSuspended = CyFalse;   /* Whether the host has suspended the function. */
 
 /* Application error handler */
 void
@@ -210,6 +297,696 @@ void CyFxUVCAppDmaCallback (
     }
 }
 
+/* Target compressed size per slice that the negotiated payloads are sized for: wSliceConfigSetting in
+   the target compressed size per slice mode of the slice mode control, else 0. */
+static uint32_t
+CyFxUVCAppSliceSize (
+        void)
+{
+    const CyFxUvcCtrlInfo_t *ctrl_p = CyFxUvcCtrlFind (CY_FX_UVC_EU_ID, CY_FX_UVC_EU_SLICE_MODE_CONTROL);
+
+    if ((ctrl_p == NULL) || (CyFxUvcCtrlField (ctrl_p, 0) != CY_FX_UVC_SLICE_MODE_SIZE))
+        return 0;
+
+    return CyFxUvcCtrlField (ctrl_p, 1);
+}
+
+/* Start a new probe and commit negotiation at the current connection speed. The probe control can be
+   accessed before the device is configured; the high speed values are used until the connection speed
+   is known. MIN, MAX and DEF are computed here once for the configuration. */
+static void
+CyFxUVCAppProbeReset (
+        void)
+{
+    CyFxUvcProbeInit (&glProbeState, CyU3PUsbGetSpeed ());
+    CyFxUvcProbeSetSliceSize (&glProbeState, CyFxUVCAppSliceSize ());
+}
+
+/* Send the oldest status packet that is ready, unless the last one is still on its way. Called whenever
+   an event is queued and when a packet has gone out. The queue is shared by the setup callback, the DMA
+   callback and the streaming thread, and is only touched with the interrupts off. */
+static void
+CyFxUVCAppStatusSend (
+        void)
+{
+    CyU3PDmaBuffer_t    dmaBuffer;
+    CyU3PReturnStatus_t status;
+    uint32_t intMask;
+    uint16_t len = 0;
+
+    intMask = CyU3PVicDisableAllInterrupts ();
+    if ((!glStatusBusy) && (glIsDevConfigured))
+    {
+        len = CyFxUvcStatusNext (&glStatus, glStatusPkt);
+        glStatusBusy = (CyBool_t)(len != 0);
+    }
+    CyU3PVicEnableInterrupts (intMask);
+    if (len == 0)
+        return;
+
+    status = CyU3PDmaChannelGetBuffer (&glChHandleStatus, &dmaBuffer, CYU3P_NO_WAIT);
+    if (status == CY_U3P_SUCCESS)
+    {
+        CyU3PMemCopy (dmaBuffer.buffer, glStatusPkt, len);
+        status = CyU3PDmaChannelCommitBuffer (&glChHandleStatus, len, 0);
+    }
+    if (status != CY_U3P_SUCCESS)
+    {
+        CyU3PDebugPrint (4, "Status packet lost, error code = %d\r\n", status);
+        glStatusBusy = CyFalse;
+    }
+}
+
+/* The last status packet has been sent: send the next one. */
+static void
+CyFxUVCAppStatusDmaCallback (
+        CyU3PDmaChannel   *handle,
+        CyU3PDmaCbType_t   type,
+        CyU3PDmaCBInput_t *input)
+{
+    if (type == CY_U3P_DMA_CB_CONS_EVENT)
+    {
+        glStatusBusy = CyFalse;
+        CyFxUVCAppStatusSend ();
+    }
+}
+
+/* Drop the queued status packets and the one on its way, for a new configuration or a bus reset. */
+static void
+CyFxUVCAppStatusReset (
+        void)
+{
+    uint32_t intMask;
+
+    CyU3PDmaChannelReset (&glChHandleStatus);
+    CyU3PUsbFlushEp (CY_FX_EP_CONTROL_STATUS);
+    CyU3PDmaChannelSetXfer (&glChHandleStatus, 0);
+
+    intMask = CyU3PVicDisableAllInterrupts ();
+    CyFxUvcStatusInit (&glStatus);
+    glStatusBusy = CyFalse;
+    CyU3PVicEnableInterrupts (intMask);
+}
+
+/* Report a new value of a control: one the device has changed on its own, or the completion of a SET_CUR
+   on an asynchronous control, which is held back while isHeld until the streamer has taken the value up.
+   Returns CyFalse if the queue is full and the event is lost. */
+static CyBool_t
+CyFxUVCAppStatusControl (
+        const CyFxUvcCtrlInfo_t *ctrl_p,
+        CyBool_t                 isHeld)
+{
+    CyBool_t isQueued;
+    uint32_t intMask;
+
+    intMask  = CyU3PVicDisableAllInterrupts ();
+    isQueued = CyFxUvcStatusControl (&glStatus, ctrl_p, isHeld);
+    CyU3PVicEnableInterrupts (intMask);
+
+    if (!isQueued)
+        CyU3PDebugPrint (4, "Status queue full: unit %d control %d not reported\r\n", ctrl_p->unitId, ctrl_p->selector);
+    CyFxUVCAppStatusSend ();
+    return isQueued;
+}
+
+/* Send the held completions of the controls with a SET_CUR action, once the streamer has taken up their
+   values or the stream has stopped. */
+static void
+CyFxUVCAppStatusRelease (
+        uint8_t apply)
+{
+    uint32_t intMask;
+
+    intMask = CyU3PVicDisableAllInterrupts ();
+    CyFxUvcStatusRelease (&glStatus, apply);
+    CyU3PVicEnableInterrupts (intMask);
+    CyFxUVCAppStatusSend ();
+}
+
+/* Record an error of the video stream for VS_STREAM_ERROR_CODE_CONTROL, and report it on the status
+   endpoint. */
+static void
+CyFxUVCAppStreamError (
+        uint8_t code)
+{
+    uint32_t intMask;
+
+    CyFxUvcCtrlStreamError (code);
+    intMask = CyU3PVicDisableAllInterrupts ();
+    CyFxUvcStatusStream (&glStatus, CY_FX_UVC_INTERFACE_VS);
+    CyU3PVicEnableInterrupts (intMask);
+    CyFxUVCAppStatusSend ();
+}
+
+/* Act on a SET_CUR of the layer controls of a simulcast stream. The select layer control picks, by the
+   stream_id of wLayerOrViewID, the layer that the start or stop layer control acts on: selecting a layer
+   loads its state into the start or stop control, and setting that control starts or stops the layer.
+   Outside a simulcast stream, and for a stream_id that the stream does not have, the control reads as
+   started and setting it has no effect. */
+static void
+CyFxUVCAppLayerControl (
+        uint8_t selector)
+{
+    const CyFxUvcCtrlInfo_t *sel_p   = CyFxUvcCtrlFind (CY_FX_UVC_EU_ID, CY_FX_UVC_EU_SELECT_LAYER_CONTROL);
+    const CyFxUvcCtrlInfo_t *start_p = CyFxUvcCtrlFind (CY_FX_UVC_EU_ID, CY_FX_UVC_EU_START_OR_STOP_LAYER_CONTROL);
+    uint8_t streamId, started;
+
+    if ((sel_p == NULL) || (start_p == NULL))
+        return;
+
+    streamId = (uint8_t)((CyFxUvcCtrlField (sel_p, 0) & CY_FX_UVC_LAYER_STREAM_ID_MASK) >> CY_FX_UVC_LAYER_STREAM_ID_POS);
+    if ((selector == CY_FX_UVC_EU_START_OR_STOP_LAYER_CONTROL) &&
+            (CyFxUvcLayerSetStarted (&glSimulcast, streamId, (start_p->cur_p[0] != 0)) == CY_U3P_SUCCESS))
+    {
+        CyU3PDebugPrint (4, "Layer %d %s\r\n", streamId, (start_p->cur_p[0] != 0) ? "started" : "stopped");
+        return;
+    }
+
+    /* The start or stop control now reads for another layer: tell the host if its value has changed. */
+    started = ((streamId < glSimulcast.count) && (!glSimulcast.layer[streamId].isStarted)) ? 0 : 1;
+    if (start_p->cur_p[0] != started)
+    {
+        start_p->cur_p[0] = started;
+        CyFxUVCAppStatusControl (start_p, CyFalse);
+    }
+}
+
+/* Act on a SET_CUR of the slice mode control. The stored streams have one slice per picture, which is
+   what the number of slices per frame mode reads back whatever number was asked for. The target size
+   of the target compressed size per slice mode is kept, as the payloads are then cut at the NAL units
+   and a slice is only split over payloads when it is larger than one; the probe control offers payloads
+   of that size from the next negotiation on. */
+static void
+CyFxUVCAppSliceControl (
+        void)
+{
+    const CyFxUvcCtrlInfo_t *ctrl_p = CyFxUvcCtrlFind (CY_FX_UVC_EU_ID, CY_FX_UVC_EU_SLICE_MODE_CONTROL);
+
+    if (ctrl_p == NULL)
+        return;
+
+    if (CyFxUvcCtrlField (ctrl_p, 0) == CY_FX_UVC_SLICE_MODE_SLICES)
+    {
+        ctrl_p->cur_p[2] = 1;
+        ctrl_p->cur_p[3] = 0;
+    }
+
+    CyFxUvcProbeSetSliceSize (&glProbeState, CyFxUVCAppSliceSize ());
+}
+
+/* Check whether the payloads of the stream are to be aligned to its NAL units: for the Annex B streams,
+   in the target compressed size per slice mode of the slice mode control. */
+static CyBool_t
+CyFxUVCAppSliceAligned (
+        void)
+{
+    const CyFxUvcCtrlInfo_t *ctrl_p = CyFxUvcCtrlFind (CY_FX_UVC_EU_ID, CY_FX_UVC_EU_SLICE_MODE_CONTROL);
+
+    return (CyBool_t)((glStreamAnnexB) && (ctrl_p != NULL) &&
+            (CyFxUvcCtrlField (ctrl_p, 0) == CY_FX_UVC_SLICE_MODE_SIZE));
+}
+
+/* Act on a SET_CUR of the error resiliency control: the feature bits that the device does not have read
+   back as 0. */
+static void
+CyFxUVCAppResilControl (
+        void)
+{
+    const CyFxUvcCtrlInfo_t *ctrl_p = CyFxUvcCtrlFind (CY_FX_UVC_EU_ID, CY_FX_UVC_EU_ERROR_RESILIENCY_CONTROL);
+
+    if (ctrl_p == NULL)
+        return;
+
+    ctrl_p->cur_p[0] &= (uint8_t)CY_FX_UVC_RESIL_FEATURES;
+}
+
+/* Error resiliency features in force: those of the error resiliency control for the Annex B streams, none
+   for the others, whose stored frames are all sent from the first one on again for a sync frame. */
+static uint16_t
+CyFxUVCAppResilFeatures (
+        void)
+{
+    const CyFxUvcCtrlInfo_t *ctrl_p = CyFxUvcCtrlFind (CY_FX_UVC_EU_ID, CY_FX_UVC_EU_ERROR_RESILIENCY_CONTROL);
+
+    return ((glStreamAnnexB) && (ctrl_p != NULL)) ? (uint16_t)CyFxUvcCtrlField (ctrl_p, 0) : 0;
+}
+
+/* Value of the first field of a control, or value if the device does not implement the control. */
+static uint32_t
+CyFxUVCAppCtrlValue (
+        uint8_t  unitId,
+        uint8_t  selector,
+        uint32_t value)
+{
+    const CyFxUvcCtrlInfo_t *ctrl_p = CyFxUvcCtrlFind (unitId, selector);
+
+    return (ctrl_p != NULL) ? CyFxUvcCtrlField (ctrl_p, 0) : value;
+}
+
+/* Adjust the colours of the generated frames to the picture controls. There is no sensor behind the
+   pattern: the exposure time and the gain scale the luma above black, as the light that reaches a sensor
+   would, and the contrast, brightness and saturation act on the result the way an image processor's do.
+   Called by the streamer between frames. */
+static void
+CyFxUVCAppPicture (
+        void)
+{
+    CyFxUvcPatternPicture_t pic;
+    uint32_t gain;
+
+    gain = (CyFxUVCAppCtrlValue (CY_FX_UVC_CT_ID, CY_FX_UVC_CT_EXPOSURE_TIME_ABSOLUTE_CONTROL, CY_FX_UVC_PICTURE_EXPOSURE) *
+            CyFxUVCAppCtrlValue (CY_FX_UVC_PU_ID, CY_FX_UVC_PU_GAIN_CONTROL, CY_FX_UVC_PICTURE_PERCENT) * 256) /
+        (CY_FX_UVC_PICTURE_EXPOSURE * CY_FX_UVC_PICTURE_PERCENT);
+    pic.gain       = (uint16_t)CY_U3P_MIN (gain, 0xFFFF);
+    pic.contrast   = (uint16_t)((CyFxUVCAppCtrlValue (CY_FX_UVC_PU_ID, CY_FX_UVC_PU_CONTRAST_CONTROL,
+                    CY_FX_UVC_PICTURE_PERCENT) * 256) / CY_FX_UVC_PICTURE_PERCENT);
+    pic.brightness = (int16_t)(CyFxUVCAppCtrlValue (CY_FX_UVC_PU_ID, CY_FX_UVC_PU_BRIGHTNESS_CONTROL,
+                CY_FX_UVC_PICTURE_BRIGHTNESS) - CY_FX_UVC_PICTURE_BRIGHTNESS);
+    pic.saturation = (uint16_t)((CyFxUVCAppCtrlValue (CY_FX_UVC_PU_ID, CY_FX_UVC_PU_SATURATION_CONTROL,
+                    CY_FX_UVC_PICTURE_PERCENT) * 256) / CY_FX_UVC_PICTURE_PERCENT);
+
+    glPictureChange = CyFalse;
+    CyFxUvcPatternPicture (&glStreamPattern, &pic);
+    CyFxUVCAppStatusRelease (CY_FX_UVC_CTRL_APPLY_PICTURE);
+}
+
+/* Whether a new value of a picture control waits for the streamer: only frames that are generated as
+   they are sent take it up, between frames. */
+static CyBool_t
+CyFxUVCAppPictureDeferred (
+        void)
+{
+    const CyFxUvcFrameInfo_t *frame_p = glStreamFrame_p;
+
+    return (CyBool_t)((glIsApplnActive) && (frame_p != NULL) && (frame_p->vidFrameCount == 0) &&
+            (frame_p->layerCount == 0));
+}
+
+/* Take the action that a SET_CUR on a control calls for, by the apply field of its table entry. The
+   actions only mark or adjust control state; anything that changes the video stream is picked up by the
+   streamer at the next frame. */
+static void
+CyFxUVCAppCtrlApply (
+        const CyFxUvcCtrlInfo_t *ctrl_p)
+{
+    switch (ctrl_p->apply)
+    {
+        case CY_FX_UVC_CTRL_APPLY_SYNC:
+            /* Every SET_CUR on the sync control asks for a sync frame, even with the value already set. */
+            glSyncRequest = CyTrue;
+            break;
+        case CY_FX_UVC_CTRL_APPLY_LAYER:
+            CyFxUVCAppLayerControl (ctrl_p->selector);
+            break;
+        case CY_FX_UVC_CTRL_APPLY_SLICE:
+            CyFxUVCAppSliceControl ();
+            break;
+        case CY_FX_UVC_CTRL_APPLY_RESIL:
+            CyFxUVCAppResilControl ();
+            break;
+        case CY_FX_UVC_CTRL_APPLY_PICTURE:
+            glPictureChange = CyTrue;
+            break;
+        default:
+            break;
+    }
+}
+
+/* Stall a class request that the device turns down, and leave the reason for the host to read with
+   VC_REQUEST_ERROR_CODE_CONTROL. */
+static void
+CyFxUVCAppRequestFail (
+        uint8_t code)
+{
+    CyFxUvcCtrlRequestDone (code);
+    CyU3PUsbStall (0, CyTrue, CyFalse);
+}
+
+/* Handle a request on a control of a unit of the video control interface. The control is looked up in
+   the control table by unit ID and selector, and a GET request is answered straight from the table, so
+   that control requests take the same short time whatever the state of the video stream. SET_CUR data
+   is checked against the limits of the control before it is stored. Requests on controls that the
+   device does not implement are stalled. Every request leaves its outcome in the request error code. */
+static void
+CyFxUVCAppUnitRequest (
+        uint8_t  bRequest,
+        uint8_t  unitId,
+        uint8_t  selector,
+        uint16_t wLength)
+{
+    const CyFxUvcCtrlInfo_t *ctrl_p = CyFxUvcCtrlLookup (unitId, selector);
+    const uint8_t *resp_p;
+    uint16_t readCount = 0;
+    CyBool_t isAsync;
+    CyU3PReturnStatus_t status;
+
+    if (ctrl_p == NULL)
+    {
+        CyU3PUsbStall (0, CyTrue, CyFalse);
+        return;
+    }
+
+    if (bRequest == CY_FX_USB_UVC_SET_CUR_REQ)
+    {
+        /* Nothing is changed while the function is suspended, and a control that is not marked as
+           settable while streaming is left alone until the stream stops. */
+        if (glIsFuncSuspended)
+        {
+            CyFxUVCAppRequestFail (CY_FX_UVC_CTRL_ERR_POWER);
+            return;
+        }
+        if ((!ctrl_p->isRuntime) && (glIsApplnActive))
+        {
+            CyFxUVCAppRequestFail (CY_FX_UVC_CTRL_ERR_WRONG_STATE);
+            return;
+        }
+
+        /* The data stage is only accepted for a settable control, and must hold exactly one value. */
+        if ((wLength != ctrl_p->length) ||
+                ((ctrl_p->attr_p[CY_FX_UVC_CTRL_ATTR_INFO] & CY_FX_UVC_CTRL_INFO_SET) == 0))
+        {
+            CyFxUVCAppRequestFail (CY_FX_UVC_CTRL_ERR_INVALID_REQUEST);
+            return;
+        }
+
+        /* An asynchronous control takes no new value until the last one has been taken up and reported. */
+        isAsync = (CyBool_t)((ctrl_p->attr_p[CY_FX_UVC_CTRL_ATTR_INFO] & CY_FX_UVC_CTRL_INFO_ASYNC) != 0);
+        if ((isAsync) && (CyFxUvcStatusIsHeld (&glStatus, ctrl_p)))
+        {
+            CyFxUVCAppRequestFail (CY_FX_UVC_CTRL_ERR_NOT_READY);
+            return;
+        }
+
+        status = CyU3PUsbGetEP0Data (CY_FX_UVC_CTRL_MAX_LEN, glUvcCtrlBuf, &readCount);
+        if (status != CY_U3P_SUCCESS)
+        {
+            CyU3PDebugPrint (4, "CyU3PUsbGetEP0Data failed, error code = %d\n", status);
+            CyFxUvcCtrlRequestDone (CY_FX_UVC_CTRL_ERR_UNKNOWN);
+        }
+        else if (CyFxUvcCtrlSet (ctrl_p, glUvcCtrlBuf, readCount) != CY_U3P_SUCCESS)
+        {
+            /* Out of range or off a step: the current value is kept. */
+            CyU3PDebugPrint (4, "Unit %d control %d: value out of range\r\n", unitId, selector);
+        }
+        else
+        {
+            /* The completion of an asynchronous SET_CUR is reported once the new value is in use: a
+               picture control of a generated frame is taken up by the streamer at the end of the frame. */
+            if (isAsync)
+                CyFxUVCAppStatusControl (ctrl_p, (CyBool_t)((ctrl_p->apply == CY_FX_UVC_CTRL_APPLY_PICTURE) &&
+                            (CyFxUVCAppPictureDeferred ())));
+            CyFxUVCAppCtrlApply (ctrl_p);
+        }
+    }
+    else if (CyFxUvcCtrlGet (ctrl_p, bRequest, &resp_p, &readCount) == CY_U3P_SUCCESS)
+    {
+        status = CyU3PUsbSendEP0Data ((uint16_t)CY_U3P_MIN (wLength, readCount), (uint8_t *)resp_p);
+        if (status != CY_U3P_SUCCESS)
+        {
+            CyU3PDebugPrint (4, "CyU3PUsbSendEP0Data, error code = %d\n", status);
+        }
+    }
+    else
+    {
+        CyU3PUsbStall (0, CyTrue, CyFalse);
+    }
+}
+
+/* Select the video frame and payload size to be streamed from the commit control. */
+static void
+CyFxUVCAppApplyCommit (
+        void)
+{
+    const CyFxUvcFormatInfo_t *fmt_p = CyFxUvcProbeFindFormat (glProbeState.commit.bFormatIndex);
+
+    glStreamFrame_p = CyFxUvcProbeFindFrame (glProbeState.commit.bFormatIndex, glProbeState.commit.bFrameIndex);
+    if (glStreamFrame_p == NULL)
+    {
+        fmt_p           = &glUvcFormats[0];
+        glStreamFrame_p = &glUvcFormats[0].frame_p[0];
+    }
+    glStreamAnnexB = fmt_p->isAnnexB;
+
+    glStreamPayload  = CY_U3P_MIN (glProbeState.commit.dwMaxPayloadTransferSize, CY_FX_UVC_STREAM_BUF_SIZE);
+    glStreamInterval = glProbeState.commit.dwFrameInterval;
+
+    CyU3PDebugPrint (4, "Commit: format %d frame %d interval %d payload %d\r\n", glProbeState.commit.bFormatIndex,
+            glProbeState.commit.bFrameIndex, glProbeState.commit.dwFrameInterval, glStreamPayload);
+}
+
+/* Length of a video frame of the streamed frame, from the quality tier tier_p for frames stored in
+   several tiers. Generated frames all have the full frame size. */
+static uint32_t
+CyFxUVCAppFrameLength (
+        const CyFxUvcFrameInfo_t *frame_p,
+        const CyFxUvcTierInfo_t  *tier_p,
+        uint32_t                  frameIndex)
+{
+    if (tier_p != NULL)
+        return tier_p->vidFrameLen_p[frameIndex];
+    return (frame_p->vidFrameCount != 0) ? frame_p->vidFrameLen_p[frameIndex] : frame_p->maxFrameBufSize;
+}
+
+/* Stored video frame that starts at frameStart in the frame store, of the quality tier tier_p if there are
+   several. */
+static const uint8_t *
+CyFxUVCAppFrameData (
+        const CyFxUvcFrameInfo_t *frame_p,
+        const CyFxUvcTierInfo_t  *tier_p,
+        uint32_t                  frameStart)
+{
+    return (tier_p != NULL) ? &tier_p->vidFrames_p[frameStart] : &frame_p->vidFrames_p[frameStart];
+}
+
+/* Build the bytes sent in front of access unit frameIndex of the stored frame src_p in glFramePrefix, and
+   return their length. The parameter sets of the IDR access unit go first when the error resiliency
+   control asks for them, as long as the frame stays within the frame buffer size of the streamed frame;
+   then, for layer layer of a simulcast stream, the prefix NAL unit of the layer. Every access unit is
+   counted in the error resiliency statistics. */
+static uint32_t
+CyFxUVCAppFramePrefix (
+        const CyFxUvcFrameInfo_t *frame_p,
+        const CyFxUvcFrameInfo_t *src_p,
+        const CyFxUvcTierInfo_t  *tier_p,
+        uint8_t                   layer,
+        uint32_t                  frameIndex)
+{
+    const uint8_t *idr_p = NULL;
+    uint16_t features = CyFxUVCAppResilFeatures ();
+    uint32_t auLen, paramLen = 0, room, len;
+
+    auLen = CyFxUVCAppFrameLength (src_p, tier_p, frameIndex);
+    room  = frame_p->maxFrameBufSize - CY_U3P_MIN (auLen, frame_p->maxFrameBufSize);
+    if (layer != CY_FX_UVC_LAYER_NONE)
+        room -= CY_U3P_MIN (room, CY_FX_UVC_LAYER_PREFIX_LEN);
+    if ((features & CY_FX_UVC_RESIL_PARAM_SETS) != 0)
+    {
+        idr_p    = CyFxUVCAppFrameData (src_p, tier_p, 0);
+        paramLen = CyFxUvcResilParamSets (idr_p, CyFxUVCAppFrameLength (src_p, tier_p, 0));
+    }
+
+    len = CyFxUvcResilFrame (&glResil, features, (layer != CY_FX_UVC_LAYER_NONE) ? layer : 0, (frameIndex == 0),
+            paramLen, auLen, room);
+    if (len != 0)
+        CyU3PMemCopy (glFramePrefix, (uint8_t *)idr_p, len);
+    if (layer != CY_FX_UVC_LAYER_NONE)
+        len += CyFxUvcLayerPrefix (layer, (frameIndex == 0), &glFramePrefix[len]);
+    return len;
+}
+
+/* Length of the video data of the next payload of a frame, from offset on, with room bytes of space in the
+   payload. With the payloads aligned to the slices the payload ends at the start of the last NAL unit that
+   starts in it, and the NAL units sent in front of the access unit end a payload of their own when the
+   access unit behind them does not fit. A NAL unit larger than the payload is split at room bytes. */
+static uint32_t
+CyFxUVCAppPayloadLength (
+        const CyFxUvcFrameInfo_t *frame_p,
+        const CyFxUvcTierInfo_t  *tier_p,
+        uint32_t                  prefixLen,
+        uint32_t                  frameStart,
+        uint32_t                  frameLength,
+        uint32_t                  offset,
+        uint32_t                  room,
+        CyBool_t                  isAligned)
+{
+    const uint8_t *au_p;
+    uint32_t len;
+
+    if ((!isAligned) || (frameLength - offset <= room))
+        return CY_U3P_MIN (frameLength - offset, room);
+
+    au_p = CyFxUVCAppFrameData (frame_p, tier_p, frameStart);
+    if (offset < prefixLen)
+    {
+        if (room <= prefixLen - offset)
+        {
+            len = CyFxUvcSliceCut (glFramePrefix, prefixLen, offset, room);
+            return (len != 0) ? len : room;
+        }
+        len = CyFxUvcSliceCut (au_p, frameLength - prefixLen, 0, room - (prefixLen - offset));
+        return (prefixLen - offset) + len;
+    }
+
+    len = CyFxUvcSliceCut (au_p, frameLength - prefixLen, offset - prefixLen, room);
+    return (len != 0) ? len : room;
+}
+
+/* Load len bytes of a video frame, from offset on, into a payload buffer. Stored frames are copied
+   from frameStart in the frame store (of the quality tier tier_p if there are several); generated frames
+   are written straight into the buffer. The access unit goes behind the prefixLen bytes of glFramePrefix. */
+static void
+CyFxUVCAppLoadPayload (
+        const CyFxUvcFrameInfo_t *frame_p,
+        const CyFxUvcTierInfo_t  *tier_p,
+        uint32_t                  prefixLen,
+        uint32_t                  frameStart,
+        uint32_t                  offset,
+        uint8_t                  *buf_p,
+        uint32_t                  len)
+{
+    uint32_t count;
+
+    if (offset < prefixLen)
+    {
+        count = CY_U3P_MIN (len, prefixLen - offset);
+        CyU3PMemCopy (buf_p, &glFramePrefix[offset], count);
+        buf_p  += count;
+        offset += count;
+        len    -= count;
+        if (len == 0)
+            return;
+    }
+    offset -= prefixLen;
+
+    if ((tier_p != NULL) || (frame_p->vidFrameCount != 0))
+        CyU3PMemCopy (buf_p, (uint8_t *)&CyFxUVCAppFrameData (frame_p, tier_p, frameStart)[offset], len);
+    else
+        CyFxUvcPatternFill (&glStreamPattern, offset, buf_p, len);
+}
+
+/* Hold the next video frame back until it is due at the committed frame interval. Without this the
+   stored frames would go out as fast as the host reads them, whatever frame rate was negotiated.
+
+   Frame n of the stream is due n intervals after the stream start, so that rounding the interval to the
+   1 ms tick does not add up over the frames. A stream that has fallen more than one interval behind (the
+   link cannot keep up) is rescheduled from now instead of sending a burst of frames to catch up. The wait
+   is done in 1 ms steps so that a stop is not held up. */
+static void
+CyFxUVCAppFramePace (
+        uint32_t *start_p,
+        uint32_t *count_p)
+{
+    uint32_t interval = glStreamInterval;
+    uint32_t due      = *start_p + (uint32_t)(((uint64_t)*count_p * interval) / CY_FX_UVC_INTERVAL_PER_MS);
+
+    if ((int32_t)(CyU3PGetTime () - due) > (int32_t)(interval / CY_FX_UVC_INTERVAL_PER_MS))
+    {
+        *start_p = CyU3PGetTime ();
+        *count_p = 0;
+        return;
+    }
+
+    while ((glIsApplnActive) && ((int32_t)(due - CyU3PGetTime ()) > 0))
+        CyU3PThreadSleep (1);
+}
+
+/* Current value of an encoding unit control, 0 if the control is not implemented. */
+static uint32_t
+CyFxUVCAppEuValue (
+        uint8_t selector)
+{
+    const CyFxUvcCtrlInfo_t *ctrl_p = CyFxUvcCtrlFind (CY_FX_UVC_EU_ID, selector);
+
+    return (ctrl_p != NULL) ? CyFxUvcCtrlField (ctrl_p, 0) : 0;
+}
+
+/* Load the bit rate shaper limits from the average bit rate, peak bit rate and CPB size controls, and
+   with start set, start shaping a new stream of payloads of up to payload bytes. The controls can be set
+   while streaming: the streamer takes them up at the start of every frame. */
+static void
+CyFxUVCAppShaperLimits (
+        CyBool_t start,
+        uint32_t payload)
+{
+    uint32_t avg  = CyFxUVCAppEuValue (CY_FX_UVC_EU_AVERAGE_BITRATE_CONTROL);
+    uint32_t peak = CyFxUVCAppEuValue (CY_FX_UVC_EU_PEAK_BIT_RATE_CONTROL);
+    uint32_t cpb  = CyFxUVCAppEuValue (CY_FX_UVC_EU_CPB_SIZE_CONTROL);
+
+    if (start)
+        CyFxUvcShaperStart (&glShaper, avg, peak, cpb, payload, CyU3PGetTime ());
+    else
+        CyFxUvcShaperSetLimits (&glShaper, avg, peak, cpb, CyU3PGetTime ());
+}
+
+/* Hold a payload of len bytes, header included, back until the bit rate shaper allows it to be
+   committed, and account for it. The wait is done in 1 ms steps so that a stop is not held up. */
+static void
+CyFxUVCAppShapePayload (
+        uint32_t len)
+{
+    while ((glIsApplnActive) && (CyFxUvcShaperDelay (&glShaper, len, CyU3PGetTime ()) != 0))
+        CyU3PThreadSleep (1);
+    CyFxUvcShaperCommit (&glShaper, len, CyU3PGetTime ());
+}
+
+/* Quality tier for the next group of pictures of a frame stored in several tiers, from the rate control
+   mode, bit rate, CPB size and QP controls; NULL for other frames. The controls can be set while
+   streaming: the streamer asks again at the start of every group of pictures. A simulcast layer sent in
+   share out of every total frame slots gets that share of the bit rates, at its own frame interval;
+   *cur_p holds the tier last picked for the frame. */
+static const CyFxUvcTierInfo_t *
+CyFxUVCAppRateTier (
+        const CyFxUvcFrameInfo_t *frame_p,
+        uint8_t                   share,
+        uint16_t                  total,
+        uint8_t                  *cur_p)
+{
+    const CyFxUvcCtrlInfo_t *qp_p = CyFxUvcCtrlFind (CY_FX_UVC_EU_ID, CY_FX_UVC_EU_QUANTIZATION_PARAMS_CONTROL);
+    CyFxUvcRateTarget_t target;
+    uint8_t tier;
+
+    if (frame_p->tierCount == 0)
+        return NULL;
+
+    target.mode        = (uint8_t)CyFxUVCAppEuValue (CY_FX_UVC_EU_RATE_CONTROL_MODE_CONTROL);
+    target.qp          = (qp_p != NULL) ? (uint8_t)CyFxUvcCtrlField (qp_p, 1) : 0;
+    target.avgBitRate  = (uint32_t)((uint64_t)CyFxUVCAppEuValue (CY_FX_UVC_EU_AVERAGE_BITRATE_CONTROL) * share / total);
+    target.peakBitRate = (uint32_t)((uint64_t)CyFxUVCAppEuValue (CY_FX_UVC_EU_PEAK_BIT_RATE_CONTROL) * share / total);
+    target.cpbSize     = CyFxUVCAppEuValue (CY_FX_UVC_EU_CPB_SIZE_CONTROL);
+
+    tier = CyFxUvcRateSelectTier (frame_p, (uint32_t)((uint64_t)glStreamInterval * total / share), glStreamPayload,
+            &target);
+    if (tier != *cur_p)
+    {
+        CyU3PDebugPrint (4, "Rate control: tier %d (QP %d)\r\n", tier, frame_p->tier_p[tier].qp);
+        *cur_p = tier;
+    }
+    return &frame_p->tier_p[tier];
+}
+
+/* Whether the stream should go back to the IDR picture at the next video frame: the host has asked for a
+   sync frame, or the sync frame interval (ms) of the sync and reference frame control, or the longest
+   interval allowed by the error resiliency control, has passed since the last IDR picture. The stored
+   streams hold no other random access point, so requests for a non-IDR random access picture are
+   answered with the IDR picture as well. */
+static CyBool_t
+CyFxUVCAppSyncDue (
+        void)
+{
+    const CyFxUvcCtrlInfo_t *ctrl_p = CyFxUvcCtrlFind (CY_FX_UVC_EU_ID, CY_FX_UVC_EU_SYNC_REF_FRAME_CONTROL);
+    uint32_t period;
+
+    if (glSyncRequest)
+    {
+        glSyncRequest = CyFalse;
+        CyU3PDebugPrint (4, "Sync frame requested\r\n");
+        return CyTrue;
+    }
+
+    period = (ctrl_p != NULL) ? CyFxUvcCtrlField (ctrl_p, 1) : 0;
+    return CyFxUvcResilSyncDue (&glResil, CyFxUVCAppResilFeatures (), period, CyU3PGetTime () - glSyncTime);
+}
+
 /* This function starts the video streaming application. It is called
  * when there is a SET_INTERFACE event for alternate interface 1. */
 CyU3PReturnStatus_t
@@ -218,6 +995,10 @@ CyFxUVCApplnStart (void)
     CyU3PDmaChannelConfig_t dmaCfg;
     CyU3PReturnStatus_t apiRetStatus = CY_U3P_SUCCESS;
 
+    /* Stream with the parameters selected by the host, and clear the error of the last stream. */
+    CyFxUVCAppApplyCommit ();
+    CyFxUvcCtrlStreamError (CY_FX_UVC_STREAM_ERR_NONE);
+
     if (CyU3PUsbGetSpeed () == CY_U3P_SUPER_SPEED)
     {
         uvcVideoEpCfg.isoPkts  = CY_FX_EP_ISO_VIDEO_SS_MULT;
@@ -279,6 +1060,79 @@ CyFxUVCApplnStart (void)
     return CY_U3P_SUCCESS;
 }
 
+/* Print the usage statistics of the driver heap and the buffer heap. The peak usage values
+   can be used to tune the heap sizes in cyfxtx.h and the number of streaming buffers. */
+void
+CyFxUVCAppPrintHeapStats (void)
+{
+    CyU3PMemGetStats (&glHeapStats);
+    CyU3PDebugPrint (4, "Mem heap: size=%d used=%d peak=%d allocs=%d frees=%d fails=%d (last %d)\r\n",
+            glHeapStats.heapSize, glHeapStats.curUsed, glHeapStats.peakUsed, glHeapStats.allocCount,
+            glHeapStats.freeCount, glHeapStats.failCount, glHeapStats.lastFailSize);
+
+    CyU3PBufGetStats (&glHeapStats);
+    CyU3PDebugPrint (4, "Buf heap: size=%d used=%d peak=%d allocs=%d frees=%d fails=%d (last %d)\r\n",
+            glHeapStats.heapSize, glHeapStats.curUsed, glHeapStats.peakUsed, glHeapStats.allocCount,
+            glHeapStats.freeCount, glHeapStats.failCount, glHeapStats.lastFailSize);
+}
+
+/* Fill a thread stack with the stack fill pattern before the thread is created. */
+static void
+CyFxUVCAppStackPaint (
+        uint32_t *stack_p,
+        uint32_t  size)
+{
+    uint32_t i;
+
+    for (i = 0; i < (size / 4); i++)
+        stack_p[i] = UVC_STACK_FILL_PATTERN;
+}
+
+/* Get the largest amount of stack (in bytes) used so far by a thread whose stack was painted with
+   CyFxUVCAppStackPaint. The stack grows downwards, so the untouched words are at the bottom. */
+uint32_t
+CyFxUVCAppStackUsage (
+        uint32_t *stack_p,
+        uint32_t  size)
+{
+    uint32_t i = 0;
+
+    if (stack_p == 0)
+        return 0;
+
+    while ((i < (size / 4)) && (stack_p[i] == UVC_STACK_FILL_PATTERN))
+        i++;
+
+    return (size - (i * 4));
+}
+
+/* Update the stack usage snapshot for the application threads. */
+static void
+CyFxUVCAppGetStackUsage (
+        void)
+{
+    glStackUsage[0] = UVC_APP_THREAD_STACK;
+    glStackUsage[1] = CyFxUVCAppStackUsage (glAppThreadStack_p, UVC_APP_THREAD_STACK);
+#ifdef CY_FX_UVC_MEM_CHECK_ENABLE
+    glStackUsage[2] = (glMemCheckStack_p != 0) ? UVC_MEM_CHECK_THREAD_STACK : 0;
+    glStackUsage[3] = CyFxUVCAppStackUsage (glMemCheckStack_p, UVC_MEM_CHECK_THREAD_STACK);
+#else
+    glStackUsage[2] = 0;
+    glStackUsage[3] = 0;
+#endif
+}
+
+/* Print the stack usage of the application threads. */
+void
+CyFxUVCAppPrintStackUsage (void)
+{
+    CyFxUVCAppGetStackUsage ();
+    CyU3PDebugPrint (4, "UVC app thread stack: used %d of %d bytes\r\n", glStackUsage[1], glStackUsage[0]);
+#ifdef CY_FX_UVC_MEM_CHECK_ENABLE
+    CyU3PDebugPrint (4, "Mem check thread stack: used %d of %d bytes\r\n", glStackUsage[3], glStackUsage[2]);
+#endif
+}
+
 /* This function stops the video streaming. It is called from the USB event
  * handler, when there is a reset / disconnect or SET_INTERFACE for alternate
  * interface 0. */
@@ -298,7 +1152,12 @@ CyFxUVCApplnStop (void)
     uvcVideoEpCfg.enable = CyFalse;
     CyU3PSetEpConfig(CY_FX_EP_ISO_VIDEO, &uvcVideoEpCfg);
 
+    /* The picture controls set during the last frame take effect with the next stream: report them now. */
+    CyFxUVCAppStatusRelease (CY_FX_UVC_CTRL_APPLY_PICTURE);
+
     CyU3PDebugPrint(3, "App Stopped\r\n");
+    CyFxUVCAppPrintHeapStats ();
+    CyFxUVCAppPrintStackUsage ();
 }
 
 /* This is the Callback function to handle the USB Events */
@@ -315,6 +1174,9 @@ CyFxUVCApplnUSBEventCB (
         case CY_U3P_USB_EVENT_SETCONF:
             if (glIsApplnActive)
                 CyFxUVCApplnStop ();
+            CyFxUVCAppProbeReset ();
+            CyFxUVCAppStatusReset ();
+            glIsFuncSuspended = CyFalse;
             if (evdata != 0)
                 glIsDevConfigured = CyTrue;
             break;
@@ -345,6 +1207,9 @@ CyFxUVCApplnUSBEventCB (
                 CyFxUVCApplnStop ();
             }
             glIsDevConfigured = CyFalse;
+            glIsFuncSuspended = CyFalse;
+            CyFxUVCAppProbeReset ();
+            CyFxUVCAppStatusReset ();
             break;
 
         default:
@@ -362,10 +1227,10 @@ CyFxUVCApplnUSBSetupCB (
     uint16_t readCount = 0;
     uint8_t  bRequest, bReqType;
     uint8_t  bType, bTarget;
-    uint16_t wValue, wIndex;
+    uint16_t wValue, wIndex, wLength;
     CyBool_t isHandled = CyFalse;
     CyU3PReturnStatus_t status = CY_U3P_SUCCESS;
-    uint8_t  temp = 0;
+    const uint8_t *resp_p;
 
     /* Fast enumeration is used. Only requests addressed to the interface, class,
      * vendor and unknown control requests are received by this function. */
@@ -377,6 +1242,7 @@ CyFxUVCApplnUSBSetupCB (
     bRequest = ((setupdat0 & CY_U3P_USB_REQUEST_MASK) >> CY_U3P_USB_REQUEST_POS);
     wValue   = ((setupdat0 & CY_U3P_USB_VALUE_MASK)   >> CY_U3P_USB_VALUE_POS);
     wIndex   = ((setupdat1 & CY_U3P_USB_INDEX_MASK)   >> CY_U3P_USB_INDEX_POS);
+    wLength  = ((setupdat1 & CY_U3P_USB_LENGTH_MASK)  >> CY_U3P_USB_LENGTH_POS);
 
     if (bType == CY_U3P_USB_STANDARD_RQT)
     {
@@ -387,7 +1253,11 @@ CyFxUVCApplnUSBSetupCB (
                     || (bRequest == CY_U3P_USB_SC_CLEAR_FEATURE)) && (wValue == 0))
         {
             if (glIsDevConfigured)
+            {
+                /* Bit 0 of the suspend options selects the suspend state of the function. */
+                glIsFuncSuspended = ((bRequest == CY_U3P_USB_SC_SET_FEATURE) && ((CY_U3P_GET_MSB (wIndex) & 0x01) != 0));
                 CyU3PUsbAckSetup ();
+            }
             else
                 CyU3PUsbStall (0, CyTrue, CyFalse);
 
@@ -398,19 +1268,32 @@ CyFxUVCApplnUSBSetupCB (
     /* Check for UVC Class Requests */
     if (bType == CY_U3P_USB_CLASS_RQT)
     {
-        CyU3PDebugPrint (4, "UVC RQT: %x %x %x %x %x\r\n", bTarget, bRequest, CY_U3P_GET_MSB(wIndex),
-                CY_U3P_GET_LSB(wIndex), wValue);
-
         /* Handle requests addressed to the Video Control interface. */
         if ((bTarget == CY_U3P_USB_TARGET_INTF) && (CY_U3P_GET_LSB (wIndex) == CY_FX_UVC_INTERFACE_VC))
         {
-            /* Respond to VC_REQUEST_ERROR_CODE_CONTROL and stall every other request as this example does not support
-               any of the Video Control features */
-            if ((CY_U3P_GET_MSB(wIndex) == 0x00) && (wValue == CY_FX_USB_UVC_VC_RQT_ERROR_CODE_CONTROL))
+            /* Respond to VC_REQUEST_ERROR_CODE_CONTROL with the outcome of the last request, which reading it
+               leaves in place, and stall every other request on the interface itself. */
+            if (CY_U3P_GET_MSB(wIndex) == 0x00)
             {
-                temp      = CY_FX_USB_UVC_RQT_STAT_INVALID_CTRL;
                 isHandled = CyTrue;
-                CyU3PUsbSendEP0Data (0x01, &temp);
+                if ((wValue == CY_FX_USB_UVC_VC_RQT_ERROR_CODE_CONTROL) &&
+                        (CyFxUvcCtrlErrorGet (CY_FX_UVC_CTRL_ERROR_REQUEST, bRequest, &resp_p, &readCount) == CY_U3P_SUCCESS))
+                {
+                    CyU3PUsbSendEP0Data ((uint16_t)CY_U3P_MIN (wLength, readCount), (uint8_t *)resp_p);
+                }
+                else
+                {
+                    CyFxUVCAppRequestFail ((wValue == CY_FX_USB_UVC_VC_RQT_ERROR_CODE_CONTROL) ?
+                            CY_FX_UVC_CTRL_ERR_INVALID_REQUEST : CY_FX_UVC_CTRL_ERR_INVALID_CONTROL);
+                }
+            }
+
+            /* Requests on the controls of a unit: the unit ID is in the high byte of wIndex and the control
+               selector in the high byte of wValue. */
+            if (CY_U3P_GET_MSB (wIndex) != 0x00)
+            {
+                isHandled = CyTrue;
+                CyFxUVCAppUnitRequest (bRequest, CY_U3P_GET_MSB (wIndex), CY_U3P_GET_MSB (wValue), wLength);
             }
         }
 
@@ -421,66 +1304,164 @@ CyFxUVCApplnUSBSetupCB (
 
             switch (wValue)
             {
-                /* As we have a single setting, we treat both PROBE and COMMIT control requests in the same way.
-                 * The commit controls sent down by the host are ignored, as we can only stream with a single
-                 * setting.
-                 */
+                /* PROBE is used to negotiate the streaming parameters and COMMIT to select them. Values sent
+                 * with SET_CUR are adjusted to the closest setting that the device supports at the current
+                 * connection speed, and read back with GET_CUR. */
                 case CY_FX_USB_UVC_VS_PROBE_CONTROL:
                 case CY_FX_USB_UVC_VS_COMMIT_CONTROL:
+                    if (bRequest == CY_FX_USB_UVC_SET_CUR_REQ)
                     {
-                        switch (bRequest)
+                        /* A new commit only takes effect at the next stream start, so it is refused while the
+                           stream runs. */
+                        if (glIsFuncSuspended)
+                        {
+                            CyFxUVCAppRequestFail (CY_FX_UVC_CTRL_ERR_POWER);
+                            break;
+                        }
+                        if ((wValue == CY_FX_USB_UVC_VS_COMMIT_CONTROL) && (glIsApplnActive))
                         {
-                            /* We only have one functional setting. Keep returning the same as current, default
-                             * minimum and maximum. */
-                            case CY_FX_USB_UVC_GET_CUR_REQ:
-                            case CY_FX_USB_UVC_GET_DEF_REQ:
-                            case CY_FX_USB_UVC_GET_MIN_REQ:
-                            case CY_FX_USB_UVC_GET_MAX_REQ:
-                                status = CyU3PUsbSendEP0Data (CY_FX_UVC_MAX_PROBE_SETTING,
-                                        (uint8_t *)glProbeCtrl);
-                                if (status != CY_U3P_SUCCESS)
-                                {
-                                    CyU3PDebugPrint (4, "CyU3PUsbSendEP0Data, error code = %d\n", status);
-                                }
-                                break;
-
-                            case CY_FX_USB_UVC_SET_CUR_REQ:
-                                /* Disable the low power entry to optimize USB throughput */
-                                CyU3PUsbLPMDisable();
-
-                                /* Read the data out into a local buffer. We do not use this data in any way. */
-                                status = CyU3PUsbGetEP0Data (CY_FX_UVC_MAX_PROBE_SETTING_ALIGNED,
-                                        glCommitCtrl, &readCount);
-                                if (status != CY_U3P_SUCCESS)
-                                {
-                                    CyU3PDebugPrint (4, "CyU3PUsbGetEP0Data failed, error code = %d\n", status);
-                                }
-                                else
-                                {
-                                    /* Check the read count. Expecting a count of CY_FX_UVC_MAX_PROBE_SETTING bytes. */
-                                    if (readCount != (uint16_t)CY_FX_UVC_MAX_PROBE_SETTING)
-                                    {
-                                        CyU3PDebugPrint (4, "Invalid number of bytes received in SET_CUR Request");
-                                    }
-                                }
-                                break;
-
-                            default:
-                                CyU3PUsbStall (0, CyTrue, CyFalse);
-                                break;
+                            CyFxUVCAppRequestFail (CY_FX_UVC_CTRL_ERR_WRONG_STATE);
+                            break;
                         }
+
+                        /* Disable the low power entry to optimize USB throughput */
+                        CyU3PUsbLPMDisable();
+
+                        status = CyU3PUsbGetEP0Data (CY_FX_UVC_MAX_PROBE_SETTING_ALIGNED, glProbeCtrlBuf, &readCount);
+                        if (status != CY_U3P_SUCCESS)
+                        {
+                            CyU3PDebugPrint (4, "CyU3PUsbGetEP0Data failed, error code = %d\n", status);
+                            CyFxUvcCtrlRequestDone (CY_FX_UVC_CTRL_ERR_UNKNOWN);
+                        }
+                        else if (CyFxUvcProbeSet (&glProbeState, wValue, glProbeCtrlBuf, readCount) != CY_U3P_SUCCESS)
+                        {
+                            /* Shorter than the UVC 1.0 structure: the current values are kept. */
+                            CyU3PDebugPrint (4, "Invalid number of bytes received in SET_CUR Request");
+                            CyFxUvcCtrlRequestDone (CY_FX_UVC_CTRL_ERR_INVALID_REQUEST);
+                        }
+                        else
+                        {
+                            CyFxUvcCtrlRequestDone (CY_FX_UVC_CTRL_ERR_NONE);
+                        }
+                    }
+                    else if (CyFxUvcProbeGet (&glProbeState, wValue, bRequest, &resp_p, &readCount) == CY_U3P_SUCCESS)
+                    {
+                        /* The response is sent straight from the prepared buffer. */
+                        CyFxUvcCtrlRequestDone (CY_FX_UVC_CTRL_ERR_NONE);
+                        status = CyU3PUsbSendEP0Data ((uint16_t)CY_U3P_MIN (wLength, readCount), (uint8_t *)resp_p);
+                        if (status != CY_U3P_SUCCESS)
+                        {
+                            CyU3PDebugPrint (4, "CyU3PUsbSendEP0Data, error code = %d\n", status);
+                        }
+                    }
+                    else
+                    {
+                        /* MIN, MAX and DEF are not defined for the commit control. */
+                        CyFxUVCAppRequestFail (CY_FX_UVC_CTRL_ERR_INVALID_REQUEST);
+                    }
+                    break;
+
+                /* The last error of the video stream, kept until the next one or the next stream start. */
+                case CY_FX_USB_UVC_VS_STREAM_ERROR_CODE_CONTROL:
+                    if (CyFxUvcCtrlErrorGet (CY_FX_UVC_CTRL_ERROR_STREAM, bRequest, &resp_p, &readCount) == CY_U3P_SUCCESS)
+                    {
+                        CyFxUvcCtrlRequestDone (CY_FX_UVC_CTRL_ERR_NONE);
+                        CyU3PUsbSendEP0Data ((uint16_t)CY_U3P_MIN (wLength, readCount), (uint8_t *)resp_p);
+                    }
+                    else
+                    {
+                        CyFxUVCAppRequestFail (CY_FX_UVC_CTRL_ERR_INVALID_REQUEST);
                     }
                     break;
 
                 default:
-                    CyU3PUsbStall (0, CyTrue, CyFalse);
+                    CyFxUVCAppRequestFail (CY_FX_UVC_CTRL_ERR_INVALID_CONTROL);
                     break;
             }
         }
 
+        /* Requests that are answered are not logged, so that repeated probing during stream setup is not
+           slowed down by the debug output. */
+        if (!isHandled)
+        {
+            CyU3PDebugPrint (4, "UVC RQT: %x %x %x %x %x\r\n", bTarget, bRequest, CY_U3P_GET_MSB(wIndex),
+                    CY_U3P_GET_LSB(wIndex), wValue);
+        }
+
         /* Don't try to stall the endpoint if we have already attempted data transfer. */
     }
 
+    /* Vendor request to read the heap usage statistics. wIndex selects the driver heap or the buffer heap. */
+    if ((bType == CY_U3P_USB_VENDOR_RQT) && (bRequest == CY_FX_UVC_VENDOR_RQT_HEAP_STATS) &&
+            ((bReqType & 0x80) != 0))
+    {
+        isHandled = CyTrue;
+        switch (wIndex)
+        {
+            case CY_FX_UVC_HEAP_STATS_MEM:
+                CyU3PMemGetStats (&glHeapStats);
+                break;
+            case CY_FX_UVC_HEAP_STATS_BUF:
+                CyU3PBufGetStats (&glHeapStats);
+                break;
+            default:
+                CyU3PUsbStall (0, CyTrue, CyFalse);
+                return isHandled;
+        }
+
+        status = CyU3PUsbSendEP0Data ((uint16_t)CY_U3P_MIN (wLength, sizeof (CyU3PHeapStats_t)),
+                (uint8_t *)&glHeapStats);
+        if (status != CY_U3P_SUCCESS)
+        {
+            CyU3PDebugPrint (4, "CyU3PUsbSendEP0Data, error code = %d\n", status);
+        }
+    }
+
+    /* Vendor request to read the bit rate shaper statistics. */
+    if ((bType == CY_U3P_USB_VENDOR_RQT) && (bRequest == CY_FX_UVC_VENDOR_RQT_SHAPER_STATS) &&
+            ((bReqType & 0x80) != 0))
+    {
+        isHandled = CyTrue;
+        CyFxUvcShaperGetStats (&glShaper, CyU3PGetTime (), &glShaperStats);
+
+        status = CyU3PUsbSendEP0Data ((uint16_t)CY_U3P_MIN (wLength, sizeof (CyFxUvcShaperStats_t)),
+                (uint8_t *)&glShaperStats);
+        if (status != CY_U3P_SUCCESS)
+        {
+            CyU3PDebugPrint (4, "CyU3PUsbSendEP0Data, error code = %d\n", status);
+        }
+    }
+
+    /* Vendor request to read the error resiliency statistics. */
+    if ((bType == CY_U3P_USB_VENDOR_RQT) && (bRequest == CY_FX_UVC_VENDOR_RQT_RESIL_STATS) &&
+            ((bReqType & 0x80) != 0))
+    {
+        isHandled = CyTrue;
+        CyU3PMemCopy ((uint8_t *)&glResilStats, (uint8_t *)&glResil.stats, sizeof (CyFxUvcResilStats_t));
+
+        status = CyU3PUsbSendEP0Data ((uint16_t)CY_U3P_MIN (wLength, sizeof (CyFxUvcResilStats_t)),
+                (uint8_t *)&glResilStats);
+        if (status != CY_U3P_SUCCESS)
+        {
+            CyU3PDebugPrint (4, "CyU3PUsbSendEP0Data, error code = %d\n", status);
+        }
+    }
+
+    /* Vendor request to read the stack usage of the application threads. */
+    if ((bType == CY_U3P_USB_VENDOR_RQT) && (bRequest == CY_FX_UVC_VENDOR_RQT_STACK_USAGE) &&
+            ((bReqType & 0x80) != 0))
+    {
+        isHandled = CyTrue;
+        CyFxUVCAppGetStackUsage ();
+
+        status = CyU3PUsbSendEP0Data ((uint16_t)CY_U3P_MIN (wLength, CY_FX_UVC_STACK_USAGE_LEN),
+                (uint8_t *)glStackUsage);
+        if (status != CY_U3P_SUCCESS)
+        {
+            CyU3PDebugPrint (4, "CyU3PUsbSendEP0Data, error code = %d\n", status);
+        }
+    }
+
     return isHandled;
 }
 
@@ -506,6 +1487,7 @@ void
 CyFxUVCApplnInit (void)
 {
     CyU3PEpConfig_t endPointConfig;
+    CyU3PDmaChannelConfig_t dmaCfg;
     CyU3PReturnStatus_t apiRetStatus = CY_U3P_SUCCESS;
 
     /* Start the USB functionality */
@@ -516,6 +1498,10 @@ CyFxUVCApplnInit (void)
         CyFxAppErrorHandler(apiRetStatus);
     }
 
+    /* Start with the default streaming parameters and control values. */
+    CyFxUVCAppProbeReset ();
+    CyFxUvcCtrlInit ();
+
     /* The fast enumeration is the easiest way to setup a USB connection,
      * where all enumeration phase is handled by the library. Only the
      * class / vendor requests need to be handled by the application. */
@@ -609,9 +1595,8 @@ CyFxUVCApplnInit (void)
         CyFxAppErrorHandler(apiRetStatus);
     }
 
-    /* Since the status interrupt endpoint is not used in this application,
-     * just enable the EP in the beginning. */
-    /* Control status interrupt endpoint configuration */
+    /* Control status interrupt endpoint configuration. The endpoint is enabled for good: it carries the
+     * status packets of control changes and stream errors whenever the device is configured. */
     endPointConfig.enable = 1;
     endPointConfig.epType = CY_U3P_USB_EP_INTR;
     endPointConfig.pcktSize = 64;
@@ -625,6 +1610,33 @@ CyFxUVCApplnInit (void)
         CyFxAppErrorHandler(apiRetStatus);
     }
 
+    /* Create a DMA Manual OUT channel for the status packets, one packet in flight at a time. */
+    CyFxUvcStatusInit (&glStatus);
+    dmaCfg.size = CY_FX_UVC_STATUS_BUF_SIZE;
+    dmaCfg.count = 1;
+    dmaCfg.prodSckId = CY_U3P_CPU_SOCKET_PROD;
+    dmaCfg.consSckId = CY_FX_EP_STATUS_CONS_SOCKET;
+    dmaCfg.dmaMode = CY_U3P_DMA_MODE_BYTE;
+    dmaCfg.notification = CY_U3P_DMA_CB_CONS_EVENT;
+    dmaCfg.cb = CyFxUVCAppStatusDmaCallback;
+    dmaCfg.prodHeader = 0;
+    dmaCfg.prodFooter = 0;
+    dmaCfg.consHeader = 0;
+    dmaCfg.prodAvailCount = 0;
+    apiRetStatus = CyU3PDmaChannelCreate (&glChHandleStatus, CY_U3P_DMA_TYPE_MANUAL_OUT, &dmaCfg);
+    if (apiRetStatus != CY_U3P_SUCCESS)
+    {
+        CyU3PDebugPrint (4, "CyU3PDmaChannelCreate failed, error code = %d\r\n",apiRetStatus);
+        CyFxAppErrorHandler(apiRetStatus);
+    }
+
+    apiRetStatus = CyU3PDmaChannelSetXfer (&glChHandleStatus, 0);
+    if (apiRetStatus != CY_U3P_SUCCESS)
+    {
+        CyU3PDebugPrint (4, "CyU3PDmaChannelSetXfer failed, error code = %d\r\n", apiRetStatus);
+        CyFxAppErrorHandler(apiRetStatus);
+    }
+
     /* Connect the USB pins and enable super speed operation */
     apiRetStatus = CyU3PConnectState(CyTrue, CyTrue);
     if (apiRetStatus != CY_U3P_SUCCESS)
@@ -655,6 +1667,116 @@ CyFxUVCAddHeader (
     }
 }
 
+#ifdef CY_FX_UVC_MEM_CHECK_ENABLE
+
+/* Callback from the allocators when a corrupted memory block is detected. */
+static void
+CyFxUVCAppMemCorruptCB (
+        void *mem_p)
+{
+    CyU3PDebugPrint (2, "Memory corruption detected in block at %x\r\n", (uint32_t)mem_p);
+}
+
+/* Entry function for the memory check thread. This runs below all other threads, and checks a few
+   blocks of each heap for corruption every time it gets to run. The full in-use lists are covered
+   over a number of steps so that the video stream is not held up. */
+void
+UVCMemCheckThread_Entry (
+        uint32_t input)
+{
+    CyBool_t isReported = CyFalse;
+
+    for (;;)
+    {
+        if (((CyU3PMemCorruptionCheckStep (UVC_MEM_CHECK_BLOCKS) != CY_U3P_SUCCESS) ||
+                    (CyU3PBufCorruptionCheckStep (UVC_MEM_CHECK_BLOCKS) != CY_U3P_SUCCESS)) && (!isReported))
+        {
+            CyU3PDebugPrint (2, "Heap corruption found. Background checks stopped.\r\n");
+            isReported = CyTrue;
+        }
+
+        CyU3PThreadSleep (UVC_MEM_CHECK_INTERVAL);
+    }
+}
+
+#endif
+
+#ifdef CY_FX_UVC_COPY_BENCHMARK
+
+/* Measure the throughput of the payload copy done by the streaming loop. A stream sized buffer is
+   filled CY_FX_UVC_BENCH_BUF_COUNT times from the video frame data. The cache clean before each
+   commit is left to the DMA driver and is not timed. Build with and without CYFXDCACHE=1 to
+   compare the copy with the data cache on and off. The buffer is then filled as often by the pattern
+   generator used for the uncompressed formats, with a 640 x 480 YUY2 frame. */
+static void
+CyFxUVCAppCopyBenchmark (
+        void)
+{
+    uint8_t  *buf_p;
+    uint32_t  dataLen = 0, offset, startTime, elapsed, patElapsed, i;
+    const uint32_t payload = CY_FX_UVC_STREAM_BUF_SIZE - CY_FX_UVC_MAX_HEADER;
+
+    for (i = 0; i < CY_FX_UVC_MAX_VID_FRAMES; i++)
+        dataLen += glVidFrameLen[i];
+
+    buf_p = (uint8_t *)CyU3PDmaBufferAlloc (CY_FX_UVC_STREAM_BUF_SIZE);
+    if ((buf_p == 0) || (dataLen <= payload))
+    {
+        CyU3PDebugPrint (4, "Copy benchmark could not be run\r\n");
+        if (buf_p != 0)
+            CyU3PDmaBufferFree (buf_p);
+        return;
+    }
+
+    offset    = 0;
+    startTime = CyU3PGetTime ();
+    for (i = 0; i < CY_FX_UVC_BENCH_BUF_COUNT; i++)
+    {
+        CyU3PMemCopy (buf_p + CY_FX_UVC_MAX_HEADER, (uint8_t *)&glUVCVidFrames[offset], payload);
+
+        offset += payload;
+        if (offset > (dataLen - payload))
+            offset = 0;
+    }
+    elapsed = CyU3PGetTime () - startTime;
+
+    CyFxUvcPatternStart (&glStreamPattern, CY_FX_UVC_PATTERN_YUY2, 640, 480);
+    offset    = 0;
+    startTime = CyU3PGetTime ();
+    for (i = 0; i < CY_FX_UVC_BENCH_BUF_COUNT; i++)
+    {
+        CyFxUvcPatternFill (&glStreamPattern, offset, buf_p + CY_FX_UVC_MAX_HEADER, payload);
+
+        offset += payload;
+        if (offset >= glStreamPattern.frameSize)
+        {
+            offset = 0;
+            CyFxUvcPatternNextFrame (&glStreamPattern);
+        }
+    }
+    patElapsed = CyU3PGetTime () - startTime;
+
+    CyU3PDmaBufferFree (buf_p);
+
+#ifdef CY_FX_UVC_DCACHE_ENABLE
+    CyU3PDebugPrint (4, "Copy benchmark (D-cache on): %d bytes in %d ms", CY_FX_UVC_BENCH_BUF_COUNT * payload, elapsed);
+#else
+    CyU3PDebugPrint (4, "Copy benchmark (D-cache off): %d bytes in %d ms", CY_FX_UVC_BENCH_BUF_COUNT * payload, elapsed);
+#endif
+    if (elapsed != 0)
+        CyU3PDebugPrint (4, ", %d KB/s\r\n", (CY_FX_UVC_BENCH_BUF_COUNT * payload) / elapsed);
+    else
+        CyU3PDebugPrint (4, "\r\n");
+
+    CyU3PDebugPrint (4, "Pattern benchmark: %d bytes in %d ms", CY_FX_UVC_BENCH_BUF_COUNT * payload, patElapsed);
+    if (patElapsed != 0)
+        CyU3PDebugPrint (4, ", %d KB/s\r\n", (CY_FX_UVC_BENCH_BUF_COUNT * payload) / patElapsed);
+    else
+        CyU3PDebugPrint (4, "\r\n");
+}
+
+#endif
+
 /* Entry function for the UVC application thread. */
 void
 UVCAppThread_Entry (
@@ -662,12 +1784,26 @@ UVCAppThread_Entry (
 {
     CyU3PDmaBuffer_t dmaBuffer;
     uint16_t commitLength = 0;
-    uint32_t frameStart = 0, frameIndex = 0, frameOffset = 0;
+    uint32_t frameStart = 0, frameIndex = 0, frameOffset = 0, frameLength = 0;
+    uint32_t paceStart = 0, paceCount = 0;
+    uint32_t payload = CY_FX_UVC_STREAM_BUF_SIZE;
+    const CyFxUvcFrameInfo_t *frame_p = NULL;
+    const CyFxUvcFrameInfo_t *src_p = NULL;
+    const CyFxUvcTierInfo_t *tier_p = NULL;
+    CyFxUvcLayer_t *layer_p = NULL;
+    uint32_t prefixLen = 0;
+    uint32_t dataLength = 0;
+    CyBool_t isAligned = CyFalse;
+    uint8_t layer = CY_FX_UVC_LAYER_NONE;
     CyU3PReturnStatus_t status = CY_U3P_SUCCESS;
 
     /* Initialize the Debug Module */
     CyFxUVCApplnDebugInit();
 
+#ifdef CY_FX_UVC_COPY_BENCHMARK
+    CyFxUVCAppCopyBenchmark ();
+#endif
+
     /* Initialize the UVC Application */
     CyFxUVCApplnInit();
 
@@ -677,12 +1813,65 @@ UVCAppThread_Entry (
         frameIndex = 0;
         frameOffset = 0;
 
+        /* Video frame and payload size selected by the last commit. The stored frames of a simulcast
+           stream are those of its layers, all of which start from their IDR pictures. */
+        frame_p   = glStreamFrame_p;
+        src_p     = frame_p;
+        payload   = glStreamPayload;
+        layer_p   = NULL;
+        layer     = CY_FX_UVC_LAYER_NONE;
+        prefixLen = 0;
+        if (frame_p != NULL)
+        {
+            CyFxUvcLayerStart (&glSimulcast, frame_p);
+            CyFxUVCAppLayerControl (CY_FX_UVC_EU_SELECT_LAYER_CONTROL);
+        }
+
+        /* Frames of the uncompressed formats are generated from the first frame number on. */
+        if ((frame_p != NULL) && (frame_p->vidFrameCount == 0) && (frame_p->layerCount == 0))
+        {
+            CyFxUvcPatternStart (&glStreamPattern, frame_p->pattern, frame_p->width, frame_p->height);
+            CyFxUVCAppPicture ();
+        }
+
+        /* Frames are paced, and the bit rate shaped, from the stream start. */
+        paceStart = CyU3PGetTime ();
+        paceCount = 0;
+        CyFxUVCAppShaperLimits (CyTrue, payload);
+        glStreamTier  = 0;
+        glSyncRequest = CyFalse;
+        CyFxUvcResilStart (&glResil);
+
         /* Reset Frame Id in UVC Header */
         glUVCHeader[1] = CY_FX_UVC_HEADER_DEFAULT_BFH;
 
         /* Video streamer application. */
         while (glIsApplnActive)
         {
+            /* The stream has been restarted with a different frame. Start over from the first video frame. */
+            if (frame_p != glStreamFrame_p)
+            {
+                break;
+            }
+
+            /* Simulcast stream: pick the layer of the next frame slot, whose next access unit is sent in it.
+               The slot of a stopped layer is left empty. */
+            if ((frameOffset == 0) && (frame_p->layerCount != 0) && (layer_p == NULL))
+            {
+                layer = CyFxUvcLayerNext (&glSimulcast);
+                if (layer == CY_FX_UVC_LAYER_NONE)
+                {
+                    paceCount++;
+                    CyFxUVCAppFramePace (&paceStart, &paceCount);
+                    continue;
+                }
+
+                layer_p    = &glSimulcast.layer[layer];
+                src_p      = layer_p->frame_p;
+                frameIndex = layer_p->frameIndex;
+                frameStart = layer_p->frameStart;
+            }
+
             /* Wait for a free buffer. */
             status = CyU3PDmaChannelGetBuffer (&glChHandleUVCStream,
                     &dmaBuffer, CYU3P_WAIT_FOREVER);
@@ -691,27 +1880,59 @@ UVCAppThread_Entry (
                 break;
             }
 
+            /* Stored frames can differ widely in length: look the length up once, at the first payload
+               of each frame. Bit rate control, slice mode and error resiliency changes are also taken up
+               between frames, and the quality tier can change at the start of each group of pictures,
+               including one started for a sync frame. */
+            if (frameOffset == 0)
+            {
+                if ((frameIndex == 0) && (layer_p != NULL))
+                {
+                    layer_p->tier_p = CyFxUVCAppRateTier (src_p, layer_p->weight, glSimulcast.totalWeight,
+                            &layer_p->tier);
+                    glSyncTime      = CyU3PGetTime ();
+                }
+                else if (frameIndex == 0)
+                {
+                    tier_p     = CyFxUVCAppRateTier (frame_p, 1, 1, &glStreamTier);
+                    glSyncTime = CyU3PGetTime ();
+                }
+                if (layer_p != NULL)
+                    tier_p = layer_p->tier_p;
+                prefixLen   = CyFxUVCAppFramePrefix (frame_p, src_p, tier_p, layer, frameIndex);
+                frameLength = prefixLen + CyFxUVCAppFrameLength (src_p, tier_p, frameIndex);
+                CyFxUVCAppShaperLimits (CyFalse, payload);
+                isAligned   = CyFxUVCAppSliceAligned ();
+            }
+
+            /* The payload is filled up, or with the payloads aligned to the slices, ends where a NAL unit
+               starts. */
+            dataLength = CyFxUVCAppPayloadLength (src_p, tier_p, prefixLen, frameStart, frameLength, frameOffset,
+                    (payload - CY_FX_UVC_MAX_HEADER), isAligned);
+
             /* Check if packet is last packet or first/intermediate packet */
-            if (frameOffset + (CY_FX_UVC_STREAM_BUF_SIZE - CY_FX_UVC_MAX_HEADER) <
-                    glVidFrameLen[frameIndex])
+            if (frameOffset + dataLength < frameLength)
             {
                 /* Load the video data to the OUT buffer */
-                CyU3PMemCopy ((dmaBuffer.buffer + CY_FX_UVC_MAX_HEADER),
-                        (uint8_t *)&glUVCVidFrames[frameStart + frameOffset],
-                        (CY_FX_UVC_STREAM_BUF_SIZE - CY_FX_UVC_MAX_HEADER));
+                CyFxUVCAppLoadPayload (src_p, tier_p, prefixLen, frameStart, frameOffset,
+                        (dmaBuffer.buffer + CY_FX_UVC_MAX_HEADER), dataLength);
 
                 /* Add header with normal frame indication */
                 CyFxUVCAddHeader (dmaBuffer.buffer, CY_FX_UVC_HEADER_FRAME);
 
-                /* Commit buffer length */
-                CyU3PThreadSleep (3);
-                commitLength = CY_FX_UVC_STREAM_BUF_SIZE;
+                /* Commit buffer length. The endpoint sends one buffer per service interval and the payload
+                   size has been negotiated to spread a frame over the frame interval, so no delay is
+                   needed between buffers. Payloads aligned to the slices can be shorter. */
+                commitLength = dataLength + CY_FX_UVC_MAX_HEADER;
+
+                /* Keep to the bit rate limits. */
+                CyFxUVCAppShapePayload (commitLength);
 
                 if (CyU3PUsbGetSpeed () == CY_U3P_HIGH_SPEED)
                 {
                     /* If the current mult setting does not match the expected data size, update this in a safe
                        manner. */
-                    if (CurrentMultVal != CY_FX_EP_ISO_VIDEO_PKTS_COUNT)
+                    if (CurrentMultVal != ((commitLength + CY_FX_EP_ISO_VIDEO_PKT_SIZE - 1) / CY_FX_EP_ISO_VIDEO_PKT_SIZE))
                     {
                         CyU3PUsbSetEpNak (CY_FX_EP_ISO_VIDEO, CyTrue);
                         CyU3PBusyWait (10);
@@ -738,25 +1959,25 @@ UVCAppThread_Entry (
                 }
 
                 /* Update the index for video data */
-                frameOffset += (CY_FX_UVC_STREAM_BUF_SIZE - CY_FX_UVC_MAX_HEADER);
+                frameOffset += dataLength;
             }
             else
             {
                 /* Last packet of the video frame. Send this data and then reset all counters. */
 
                 /* Load the video data to the OUT buffer */
-                CyU3PMemCopy (dmaBuffer.buffer + CY_FX_UVC_MAX_HEADER,
-                        (uint8_t *)&glUVCVidFrames[frameStart + frameOffset],
-                        (glVidFrameLen[frameIndex] - frameOffset));
+                CyFxUVCAppLoadPayload (src_p, tier_p, prefixLen, frameStart, frameOffset,
+                        dmaBuffer.buffer + CY_FX_UVC_MAX_HEADER, (frameLength - frameOffset));
 
                 /* Commit buffer length */
-                CyU3PThreadSleep (3);
-                commitLength = (glVidFrameLen[frameIndex] - frameOffset)
-                    + CY_FX_UVC_MAX_HEADER;
+                commitLength = (frameLength - frameOffset) + CY_FX_UVC_MAX_HEADER;
 
                 /* Add the header with End of Frame Indication */
                 CyFxUVCAddHeader (dmaBuffer.buffer, CY_FX_UVC_HEADER_EOF);
 
+                /* Keep to the bit rate limits. */
+                CyFxUVCAppShapePayload (commitLength);
+
                 if (CyU3PUsbGetSpeed () == CY_U3P_HIGH_SPEED)
                 {
                     /* If the current mult setting does not match the expected data size, update this in a safe
@@ -789,15 +2010,38 @@ UVCAppThread_Entry (
 
                 /* Reset the Index for the next frame */
                 frameOffset = 0;
-                frameStart += glVidFrameLen[frameIndex];
-                frameIndex++;
 
-                /* If all frames are transferred then start from 0 */
-                if (frameIndex >= CY_FX_UVC_MAX_VID_FRAMES)
+                /* A simulcast layer moves on by itself, and a sync frame starts every layer over. */
+                if (layer_p != NULL)
                 {
-                    frameIndex = 0;
-                    frameStart = 0;
+                    CyFxUvcLayerAdvance (layer_p, frameLength - prefixLen);
+                    if (CyFxUVCAppSyncDue ())
+                        CyFxUvcLayerSync (&glSimulcast);
+                    layer_p = NULL;
+                    layer   = CY_FX_UVC_LAYER_NONE;
                 }
+                else
+                {
+                    frameStart += frameLength - prefixLen;
+                    frameIndex++;
+
+                    /* If all frames are transferred, or a sync frame is due, then start from 0 */
+                    if ((frameIndex >= frame_p->vidFrameCount) || (CyFxUVCAppSyncDue ()))
+                    {
+                        frameIndex = 0;
+                        frameStart = 0;
+                    }
+                    if (frame_p->vidFrameCount == 0)
+                    {
+                        CyFxUvcPatternNextFrame (&glStreamPattern);
+                        if (glPictureChange)
+                            CyFxUVCAppPicture ();
+                    }
+                }
+
+                /* Wait until the next frame is due at the committed frame rate. */
+                paceCount++;
+                CyFxUVCAppFramePace (&paceStart, &paceCount);
             }
         }
 
@@ -805,6 +2049,7 @@ UVCAppThread_Entry (
         if ((status != CY_U3P_SUCCESS) && (glIsApplnActive))
         {
             CyU3PDebugPrint (4, "UVC video streamer error. Code %d.\r\n", status);
+            CyFxUVCAppStreamError (CY_FX_UVC_STREAM_ERR_UNDERRUN);
             CyFxAppErrorHandler (status);
         }
 
@@ -824,6 +2069,12 @@ CyFxApplicationDefine (
 
     /* Allocate the memory for the thread and create the thread */
     ptr = CyU3PMemAlloc (UVC_APP_THREAD_STACK);
+    if (ptr != NULL)
+    {
+        /* Paint the stack so that its usage can be measured. */
+        CyFxUVCAppStackPaint ((uint32_t *)ptr, UVC_APP_THREAD_STACK);
+        glAppThreadStack_p = (uint32_t *)ptr;
+    }
     retThrdCreate = CyU3PThreadCreate (&uvcAppThread,   /* UVC Thread structure */
                            "30:UVC_app_thread",         /* Thread Id and name */
                            UVCAppThread_Entry,          /* UVC Application Thread Entry function */
@@ -847,6 +2098,23 @@ CyFxApplicationDefine (
         /* Loop indefinitely */
         while(1);
     }
+
+#ifdef CY_FX_UVC_MEM_CHECK_ENABLE
+    /* Create the background memory check thread. */
+    ptr = CyU3PMemAlloc (UVC_MEM_CHECK_THREAD_STACK);
+    if (ptr != NULL)
+    {
+        CyFxUVCAppStackPaint ((uint32_t *)ptr, UVC_MEM_CHECK_THREAD_STACK);
+        glMemCheckStack_p = (uint32_t *)ptr;
+    }
+    retThrdCreate = CyU3PThreadCreate (&uvcMemCheckThread, "31:UVC_mem_check", UVCMemCheckThread_Entry, 0,
+            ptr, UVC_MEM_CHECK_THREAD_STACK, UVC_MEM_CHECK_THREAD_PRIORITY, UVC_MEM_CHECK_THREAD_PRIORITY,
+            CYU3P_NO_TIME_SLICE, CYU3P_AUTO_START);
+    if (retThrdCreate != 0)
+    {
+        CyU3PDebugPrint (2, "Memory check thread creation failed, error code = %d\r\n", retThrdCreate);
+    }
+#endif
 }
 
 /*
@@ -858,6 +2126,12 @@ main (void)
     CyU3PIoMatrixConfig_t io_cfg;
     CyU3PReturnStatus_t status = CY_U3P_SUCCESS;
 
+#ifdef CY_FX_UVC_MEM_CHECK_ENABLE
+    /* The leak and corruption checks have to be enabled before the heaps are initialized. */
+    CyU3PMemEnableChecks (CyTrue, CyFxUVCAppMemCorruptCB);
+    CyU3PBufEnableChecks (CyTrue, CyFxUVCAppMemCorruptCB);
+#endif
+
     /* Initialize the device */
     status = CyU3PDeviceInit (NULL);
     if (status != CY_U3P_SUCCESS)
@@ -865,8 +2139,14 @@ main (void)
         goto handle_fatal_error;
     }
 
+#ifdef CY_FX_UVC_DCACHE_ENABLE
+    /* Initialize the caches. Enable both caches, and let the DMA driver keep every buffer that goes through
+       it coherent: the application does no cache maintenance of its own. */
+    status = CyU3PDeviceCacheControl (CyTrue, CyTrue, CyTrue);
+#else
     /* Initialize the caches. Enable only the Instruction Cache. */
     status = CyU3PDeviceCacheControl (CyTrue, CyFalse, CyFalse);
+#endif
     if (status != CY_U3P_SUCCESS)
     {
         goto handle_fatal_error;
@@ -0,0 +1,126 @@
+/*
+ ## Cypress USB 3.0 Platform header file (cyfxuvclayer.h)
+ ## ===========================
+ ##
+ ##  Copyright Cypress Semiconductor Corporation, 2010-2023,
+ ##  All Rights Reserved
+ ##  UNPUBLISHED, LICENSED SOFTWARE.
+ ##
+ ##  CONFIDENTIAL AND PROPRIETARY INFORMATION
+ ##  WHICH IS THE PROPERTY OF CYPRESS.
+ ##
+ ##  Use of this file is governed
+ ##  by the license agreement included in the file
+ ##
+ ##     <install>/license/license.txt
+ ##
+ ##  where <install> is the Cypress software
+ ##  installation root directory path.
+ ##
+ ## ===========================
+*/
+
+/* File: cyfxuvclayer.h
+ *
+ * Scheduler for the layers of an H.264 simulcast stream. Each layer is one of the stored H.264 streams,
+ * and the layers share the frame slots of the committed frame interval by weight: in every slot the
+ * scheduler picks one layer, whose next access unit is sent whole in that slot. The slots of a stopped
+ * layer are left empty, so that the other layers keep their frame rates. Every access unit is sent with
+ * a prefix NAL unit in front that carries the stream_id of its layer, as the payload headers do not say
+ * which layer a frame belongs to.
+ */
+
+#ifndef _INCLUDED_CYFXUVCLAYER_H_
+#define _INCLUDED_CYFXUVCLAYER_H_
+
+#include <cyu3types.h>
+#include "cyfxuvcprobe.h"
+#include <cyu3externcstart.h>
+
+/* Largest number of layers of a simulcast stream: the streams that bmLayoutPerStream can describe. */
+#define CY_FX_UVC_LAYER_MAX             (4)
+
+/* Returned by CyFxUvcLayerNext for a slot that is left empty. */
+#define CY_FX_UVC_LAYER_NONE            (0xFF)
+
+/* Length of the prefix NAL unit sent in front of each access unit, start code included. */
+#define CY_FX_UVC_LAYER_PREFIX_LEN      (9)
+
+/* stream_id field of wLayerOrViewID, as used by the select layer control. */
+#define CY_FX_UVC_LAYER_STREAM_ID_POS   (10)
+#define CY_FX_UVC_LAYER_STREAM_ID_MASK  (0x1C00)
+
+/* State of one layer. isStarted and isRestart are set from the control requests while the stream runs;
+   the other fields only by the streamer. */
+typedef struct CyFxUvcLayer_t
+{
+    const CyFxUvcFrameInfo_t *frame_p;  /* Stored H.264 stream of the layer. */
+    const CyFxUvcTierInfo_t  *tier_p;   /* Quality tier of the current group of pictures, NULL without tiers. */
+    uint8_t                   tier;     /* Index of that tier. */
+    uint8_t                   weight;   /* Slots of the layer in every totalWeight slots. */
+    int32_t                   credit;   /* Weighted round robin credit. */
+    volatile CyBool_t         isStarted;/* Whether the layer is being sent. */
+    volatile CyBool_t         isRestart;/* The layer has been started again and goes back to its IDR picture. */
+    uint16_t                  frameIndex;   /* Next access unit of the stored stream. */
+    uint32_t                  frameStart;   /* Offset of that access unit in the stored frames. */
+    uint32_t                  frames;   /* Access units sent since the stream start. */
+} CyFxUvcLayer_t;
+
+/* Scheduler state of a simulcast stream. */
+typedef struct CyFxUvcSimulcast_t
+{
+    uint8_t        count;               /* Number of layers, 0 when the stream is not a simulcast stream. */
+    uint16_t       totalWeight;         /* Sum of the weights of all layers. */
+    CyFxUvcLayer_t layer[CY_FX_UVC_LAYER_MAX];  /* Layers, by stream_id. */
+} CyFxUvcSimulcast_t;
+
+/* Start the layers of a frame from their IDR pictures, all of them started. A frame without layers
+   leaves the scheduler with no layers. */
+extern void
+CyFxUvcLayerStart (
+        CyFxUvcSimulcast_t       *sc_p,
+        const CyFxUvcFrameInfo_t *frame_p);
+
+/* Pick the layer of the next frame slot. Every layer gets weight slots in each totalWeight slots,
+   spread as evenly as the weights allow. Returns CY_FX_UVC_LAYER_NONE if the slot belongs to a stopped
+   layer, and is left empty. */
+extern uint8_t
+CyFxUvcLayerNext (
+        CyFxUvcSimulcast_t *sc_p);
+
+/* Move a layer on past the access unit of len bytes that has been sent, back to the IDR picture after
+   the last one. */
+extern void
+CyFxUvcLayerAdvance (
+        CyFxUvcLayer_t *layer_p,
+        uint32_t        len);
+
+/* Send every layer from its IDR picture on, for a sync frame. */
+extern void
+CyFxUvcLayerSync (
+        CyFxUvcSimulcast_t *sc_p);
+
+/* Start or stop a layer. A layer that is started again goes back to its IDR picture, as the host
+   decoder has missed the pictures in between. Fails with CY_U3P_ERROR_BAD_ARGUMENT for a stream_id
+   that the stream does not have. */
+extern CyU3PReturnStatus_t
+CyFxUvcLayerSetStarted (
+        CyFxUvcSimulcast_t *sc_p,
+        uint8_t             streamId,
+        CyBool_t            start);
+
+/* Write the prefix NAL unit (nal_unit_type 14) sent in front of an access unit of a layer to buf_p:
+   priority_id holds the stream_id, and idr_flag is set for an IDR picture. Decoders of a single stream
+   discard it. Returns CY_FX_UVC_LAYER_PREFIX_LEN. */
+extern uint8_t
+CyFxUvcLayerPrefix (
+        uint8_t   streamId,
+        CyBool_t  isIdr,
+        uint8_t  *buf_p);
+
+#include <cyu3externcend.h>
+
+#endif /* _INCLUDED_CYFXUVCLAYER_H_ */
+
+/*[]*/
+
@@ -0,0 +1,357 @@
+/*
+ ## Cypress USB 3.0 Platform source file (cyfxuvcpattern.c)
+ ## ===========================
+ ##
+ ##  Copyright Cypress Semiconductor Corporation, 2010-2023,
+ ##  All Rights Reserved
+ ##  UNPUBLISHED, LICENSED SOFTWARE.
+ ##
+ ##  CONFIDENTIAL AND PROPRIETARY INFORMATION
+ ##  WHICH IS THE PROPERTY OF CYPRESS.
+ ##
+ ##  Use of this file is governed
+ ##  by the license agreement included in the file
+ ##
+ ##     <install>/license/license.txt
+ ##
+ ##  where <install> is the Cypress software
+ ##  installation root directory path.
+ ##
+ ## ===========================
+*/
+
+/* This file implements the test pattern generator used for the uncompressed formats.
+
+   The pattern is made of runs in which the bytes repeat every four bytes (a colour bar, a counter
+   cell), and of the gradient. Runs are written a word at a time once the destination is word aligned,
+   with the pattern word rotated to the position in the line, so that the cost per byte is close to
+   that of a memory fill whatever the payload size and header length. The gradient is computed a word
+   at a time when the destination and the position in the line are aligned alike.
+
+   Frame widths must be multiples of 4 so that every run starts on a word boundary of the line.
+ */
+
+#include <stddef.h>
+#include "cyfxuvcpattern.h"
+
+/* 75% colour bars, ITU-R BT.601 studio range: white, yellow, cyan, green, magenta, red, blue. */
+static const uint8_t glPatternBarYuv[CY_FX_UVC_PATTERN_BARS][3] = {
+    { 180, 128, 128 },
+    { 162,  44, 142 },
+    { 131, 156,  44 },
+    { 112,  72,  58 },
+    {  84, 184, 198 },
+    {  65, 100, 212 },
+    {  35, 212, 114 }
+};
+
+/* Luma of the frame counter cells, and the neutral chroma value. */
+#define CY_FX_UVC_PATTERN_WHITE         (235)
+#define CY_FX_UVC_PATTERN_BLACK         (16)
+#define CY_FX_UVC_PATTERN_GREY          (128)
+
+/* Largest chroma value of the studio range, and the scale of the picture adjustment that keeps a value. */
+#define CY_FX_UVC_PATTERN_CHROMA_MAX    (240)
+#define CY_FX_UVC_PATTERN_UNITY         (256)
+
+/* Repeat a byte or a pair of bytes over a word. */
+#define CY_FX_UVC_PATTERN_WORD1(a)      ((uint32_t)(a) * 0x01010101)
+#define CY_FX_UVC_PATTERN_WORD2(a, b)   (((uint32_t)(a) | ((uint32_t)(b) << 8)) * 0x00010001)
+
+uint32_t
+CyFxUvcPatternFrameSize (
+        uint8_t  type,
+        uint16_t width,
+        uint16_t height)
+{
+    switch (type)
+    {
+        case CY_FX_UVC_PATTERN_YUY2:
+            return (uint32_t)width * height * 2;
+        case CY_FX_UVC_PATTERN_NV12:
+            return ((uint32_t)width * height * 3) / 2;
+        default:
+            return 0;
+    }
+}
+
+void
+CyFxUvcPatternStart (
+        CyFxUvcPattern_t *pat_p,
+        uint8_t           type,
+        uint16_t          width,
+        uint16_t          height)
+{
+    uint8_t i;
+
+    pat_p->type       = type;
+    pat_p->pixelShift = (type == CY_FX_UVC_PATTERN_YUY2) ? 1 : 0;
+    pat_p->width      = width;
+    pat_p->height     = height;
+    pat_p->barsEnd    = (height * 3) / 4;
+    pat_p->counterEnd = pat_p->barsEnd + (height / 8);
+    pat_p->cellWidth  = (width / CY_FX_UVC_PATTERN_CELLS) & ~3;
+    if (pat_p->cellWidth == 0)
+        pat_p->cellWidth = 4;
+    pat_p->rowBytes   = (uint32_t)width << pat_p->pixelShift;
+    pat_p->lumaSize   = pat_p->rowBytes * height;
+    pat_p->frameSize  = CyFxUvcPatternFrameSize (type, width, height);
+    pat_p->frameCount = 0;
+
+    for (i = 0; i < CY_FX_UVC_PATTERN_BARS; i++)
+        pat_p->barEdge[i] = (((uint32_t)i * width) / CY_FX_UVC_PATTERN_BARS) & ~3;
+    pat_p->barEdge[CY_FX_UVC_PATTERN_BARS] = width;
+
+    for (i = 0; i < CY_FX_UVC_PATTERN_BARS; i++)
+    {
+        pat_p->barYuv[i][0] = glPatternBarYuv[i][0];
+        pat_p->barYuv[i][1] = glPatternBarYuv[i][1];
+        pat_p->barYuv[i][2] = glPatternBarYuv[i][2];
+    }
+}
+
+/* Bring a value into the studio range, from black up to max. */
+static uint8_t
+CyFxUvcPatternClamp (
+        int32_t value,
+        int32_t max)
+{
+    if (value < CY_FX_UVC_PATTERN_BLACK)
+        return CY_FX_UVC_PATTERN_BLACK;
+    return (uint8_t)((value > max) ? max : value);
+}
+
+void
+CyFxUvcPatternPicture (
+        CyFxUvcPattern_t              *pat_p,
+        const CyFxUvcPatternPicture_t *pic_p)
+{
+    int32_t y;
+    uint8_t i, c;
+
+    for (i = 0; i < CY_FX_UVC_PATTERN_BARS; i++)
+    {
+        y = CY_FX_UVC_PATTERN_BLACK + ((glPatternBarYuv[i][0] - CY_FX_UVC_PATTERN_BLACK) * (int32_t)pic_p->gain) /
+            CY_FX_UVC_PATTERN_UNITY;
+        y = CY_FX_UVC_PATTERN_GREY + ((y - CY_FX_UVC_PATTERN_GREY) * (int32_t)pic_p->contrast) / CY_FX_UVC_PATTERN_UNITY;
+        pat_p->barYuv[i][0] = CyFxUvcPatternClamp (y + pic_p->brightness, CY_FX_UVC_PATTERN_WHITE);
+
+        for (c = 1; c < 3; c++)
+        {
+            pat_p->barYuv[i][c] = CyFxUvcPatternClamp (CY_FX_UVC_PATTERN_GREY + ((glPatternBarYuv[i][c] -
+                            CY_FX_UVC_PATTERN_GREY) * (int32_t)pic_p->saturation) / CY_FX_UVC_PATTERN_UNITY,
+                    CY_FX_UVC_PATTERN_CHROMA_MAX);
+        }
+    }
+}
+
+void
+CyFxUvcPatternNextFrame (
+        CyFxUvcPattern_t *pat_p)
+{
+    pat_p->frameCount++;
+}
+
+/* Write len bytes of a run in which byte p of the line is byte (p & 3) of word. */
+static void
+CyFxUvcPatternRun (
+        uint8_t  *dst_p,
+        uint32_t  pos,
+        uint32_t  len,
+        uint32_t  word)
+{
+    uint32_t *dst32_p;
+    uint32_t  rot;
+
+    while ((len != 0) && (((size_t)dst_p & 3) != 0))
+    {
+        *dst_p++ = (uint8_t)(word >> ((pos & 3) << 3));
+        pos++;
+        len--;
+    }
+
+    /* Rotate the word so that its first byte is the one for the position of the first aligned word. */
+    rot = (pos & 3) << 3;
+    if (rot != 0)
+        word = (word >> rot) | (word << (32 - rot));
+
+    dst32_p = (uint32_t *)dst_p;
+    for (; len >= 16; len -= 16)
+    {
+        dst32_p[0] = word;
+        dst32_p[1] = word;
+        dst32_p[2] = word;
+        dst32_p[3] = word;
+        dst32_p   += 4;
+    }
+    for (; len >= 4; len -= 4)
+        *dst32_p++ = word;
+
+    dst_p = (uint8_t *)dst32_p;
+    for (rot = 0; len != 0; len--, rot += 8)
+        *dst_p++ = (uint8_t)(word >> rot);
+}
+
+/* Byte at position pos of a gradient line. The gradient starts at start and goes up by one per pixel. */
+static uint8_t
+CyFxUvcPatternGradientByte (
+        uint8_t  type,
+        uint32_t start,
+        uint32_t pos)
+{
+    if (type == CY_FX_UVC_PATTERN_YUY2)
+        return (pos & 1) ? CY_FX_UVC_PATTERN_GREY : (uint8_t)(start + (pos >> 1));
+    return (uint8_t)(start + pos);
+}
+
+/* Write len bytes of the luma (or YUY2) gradient from position pos of the line. */
+static void
+CyFxUvcPatternGradient (
+        const CyFxUvcPattern_t *pat_p,
+        uint32_t                pos,
+        uint8_t                *dst_p,
+        uint32_t                len)
+{
+    uint32_t  start = pat_p->frameCount << 2;
+    uint32_t *dst32_p;
+    uint32_t  word, b;
+
+    while ((len != 0) && (((size_t)dst_p & 3) != 0))
+    {
+        *dst_p++ = CyFxUvcPatternGradientByte (pat_p->type, start, pos++);
+        len--;
+    }
+
+    if (((pos & 3) == 0) && (len >= 4))
+    {
+        dst32_p = (uint32_t *)dst_p;
+        if (pat_p->type == CY_FX_UVC_PATTERN_YUY2)
+        {
+            /* Two pixels per word: the luma bytes go up by two from word to word. */
+            b    = start + (pos >> 1);
+            word = (b & 0xFF) | (((b + 1) & 0xFF) << 16) | 0x80008000;
+            for (; len >= 4; len -= 4, pos += 4)
+            {
+                *dst32_p++ = word;
+                word = ((word + 0x00020002) & 0x00FF00FF) | 0x80008000;
+            }
+        }
+        else
+        {
+            /* Four pixels per word: add four to each byte without carrying into the next one. */
+            b    = start + pos;
+            word = (b & 0xFF) | (((b + 1) & 0xFF) << 8) | (((b + 2) & 0xFF) << 16) | (((b + 3) & 0xFF) << 24);
+            for (; len >= 4; len -= 4, pos += 4)
+            {
+                *dst32_p++ = word;
+                word = ((word & 0x7F7F7F7F) + 0x04040404) ^ (word & 0x80808080);
+            }
+        }
+        dst_p = (uint8_t *)dst32_p;
+    }
+
+    for (; len != 0; len--)
+        *dst_p++ = CyFxUvcPatternGradientByte (pat_p->type, start, pos++);
+}
+
+/* Write len bytes of one line of a plane, starting at byte pos of the line. */
+static void
+CyFxUvcPatternLine (
+        const CyFxUvcPattern_t *pat_p,
+        uint32_t                line,
+        CyBool_t                chroma,
+        uint32_t                pos,
+        uint8_t                *dst_p,
+        uint32_t                len)
+{
+    const uint8_t *yuv_p;
+    uint8_t  shift = chroma ? 0 : pat_p->pixelShift;
+    uint32_t end, n, i, cellBytes, word;
+
+    if (line < pat_p->barsEnd)
+    {
+        for (i = 0; (len != 0) && (i < CY_FX_UVC_PATTERN_BARS); i++)
+        {
+            end = (uint32_t)pat_p->barEdge[i + 1] << shift;
+            if (pos >= end)
+                continue;
+
+            yuv_p = pat_p->barYuv[i];
+            if (pat_p->type == CY_FX_UVC_PATTERN_YUY2)
+                word = CY_U3P_MAKEDWORD (yuv_p[2], yuv_p[0], yuv_p[1], yuv_p[0]);
+            else if (chroma)
+                word = CY_FX_UVC_PATTERN_WORD2 (yuv_p[1], yuv_p[2]);
+            else
+                word = CY_FX_UVC_PATTERN_WORD1 (yuv_p[0]);
+
+            n = CY_U3P_MIN (end - pos, len);
+            CyFxUvcPatternRun (dst_p, pos, n, word);
+            dst_p += n;
+            pos   += n;
+            len   -= n;
+        }
+        return;
+    }
+
+    if (line < pat_p->counterEnd)
+    {
+        cellBytes = (uint32_t)pat_p->cellWidth << shift;
+        for (i = pos / cellBytes; len != 0; i++)
+        {
+            end  = CY_U3P_MIN ((i + 1) * cellBytes, pat_p->rowBytes);
+            word = CY_FX_UVC_PATTERN_BLACK;
+            if ((i < CY_FX_UVC_PATTERN_CELLS) && ((pat_p->frameCount >> (CY_FX_UVC_PATTERN_CELLS - 1 - i)) & 1))
+                word = CY_FX_UVC_PATTERN_WHITE;
+
+            if (chroma)
+                word = CY_FX_UVC_PATTERN_WORD1 (CY_FX_UVC_PATTERN_GREY);
+            else if (pat_p->type == CY_FX_UVC_PATTERN_YUY2)
+                word = CY_FX_UVC_PATTERN_WORD2 (word, CY_FX_UVC_PATTERN_GREY);
+            else
+                word = CY_FX_UVC_PATTERN_WORD1 (word);
+
+            n = CY_U3P_MIN (end - pos, len);
+            CyFxUvcPatternRun (dst_p, pos, n, word);
+            dst_p += n;
+            pos   += n;
+            len   -= n;
+        }
+        return;
+    }
+
+    if (chroma)
+        CyFxUvcPatternRun (dst_p, pos, len, CY_FX_UVC_PATTERN_WORD1 (CY_FX_UVC_PATTERN_GREY));
+    else
+        CyFxUvcPatternGradient (pat_p, pos, dst_p, len);
+}
+
+void
+CyFxUvcPatternFill (
+        CyFxUvcPattern_t *pat_p,
+        uint32_t          offset,
+        uint8_t          *dst_p,
+        uint32_t          len)
+{
+    uint32_t planeOffset, line, pos, n;
+    CyBool_t chroma;
+
+    while ((len != 0) && (offset < pat_p->frameSize))
+    {
+        chroma      = (offset >= pat_p->lumaSize);
+        planeOffset = chroma ? (offset - pat_p->lumaSize) : offset;
+        line        = planeOffset / pat_p->rowBytes;
+        pos         = planeOffset - (line * pat_p->rowBytes);
+
+        /* A line of the NV12 chroma plane covers two lines of the frame. */
+        if (chroma)
+            line <<= 1;
+
+        n = CY_U3P_MIN (pat_p->rowBytes - pos, len);
+        CyFxUvcPatternLine (pat_p, line, chroma, pos, dst_p, n);
+        offset += n;
+        dst_p  += n;
+        len    -= n;
+    }
+}
+
+/*[]*/
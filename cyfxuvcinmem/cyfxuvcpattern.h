@@ -0,0 +1,117 @@
+/*
+ ## Cypress USB 3.0 Platform header file (cyfxuvcpattern.h)
+ ## ===========================
+ ##
+ ##  Copyright Cypress Semiconductor Corporation, 2010-2023,
+ ##  All Rights Reserved
+ ##  UNPUBLISHED, LICENSED SOFTWARE.
+ ##
+ ##  CONFIDENTIAL AND PROPRIETARY INFORMATION
+ ##  WHICH IS THE PROPERTY OF CYPRESS.
+ ##
+ ##  Use of this file is governed
+ ##  by the license agreement included in the file
+ ##
+ ##     <install>/license/license.txt
+ ##
+ ##  where <install> is the Cypress software
+ ##  installation root directory path.
+ ##
+ ## ===========================
+*/
+
+/* File: cyfxuvcpattern.h
+ *
+ * Test pattern generator for the uncompressed formats. Frames are not stored: the streamer asks for
+ * the bytes of each payload as it fills the DMA buffer, and the generator writes them straight into
+ * the buffer. The pattern has colour bars over the top three quarters of the frame, then a band that
+ * shows the frame number as 32 black or white cells (most significant bit first), and a grey scale
+ * gradient that moves by four pixels from one frame to the next. The colours of the bars follow the
+ * picture controls of the processing unit and camera terminal.
+ */
+
+#ifndef _INCLUDED_CYFXUVCPATTERN_H_
+#define _INCLUDED_CYFXUVCPATTERN_H_
+
+#include <cyu3types.h>
+#include <cyu3externcstart.h>
+
+/* Pixel formats of the generated frames. CY_FX_UVC_PATTERN_NONE marks frames that are stored. */
+#define CY_FX_UVC_PATTERN_NONE          (0)
+#define CY_FX_UVC_PATTERN_YUY2          (1)     /* Packed 4:2:2, Y0 U Y1 V. */
+#define CY_FX_UVC_PATTERN_NV12          (2)     /* Y plane followed by an interleaved U V plane, 4:2:0. */
+
+/* Number of colour bars and of frame counter cells. */
+#define CY_FX_UVC_PATTERN_BARS          (7)
+#define CY_FX_UVC_PATTERN_CELLS         (32)
+
+/* State of the pattern generator for one stream. */
+typedef struct CyFxUvcPattern_t
+{
+    uint8_t  type;                      /* Pixel format: CY_FX_UVC_PATTERN_YUY2 or CY_FX_UVC_PATTERN_NV12. */
+    uint8_t  pixelShift;                /* log2 of the bytes per pixel in a row of the (first) plane. */
+    uint16_t width;                     /* Frame width in pixels, multiple of 4. */
+    uint16_t height;                    /* Frame height in lines, multiple of 2. */
+    uint16_t barsEnd;                   /* First line after the colour bars. */
+    uint16_t counterEnd;                /* First line after the frame counter band. */
+    uint16_t cellWidth;                 /* Width of a frame counter cell in pixels, multiple of 4. */
+    uint32_t rowBytes;                  /* Bytes per line, the same in both NV12 planes. */
+    uint32_t lumaSize;                  /* Size of the Y plane (NV12) or of the whole frame (YUY2). */
+    uint32_t frameSize;                 /* Size of a frame in bytes. */
+    uint32_t frameCount;                /* Number of the frame being generated. */
+    uint16_t barEdge[CY_FX_UVC_PATTERN_BARS + 1];   /* First pixel of each bar, multiple of 4. */
+    uint8_t  barYuv[CY_FX_UVC_PATTERN_BARS][3];     /* Y, U and V of each bar, as adjusted. */
+} CyFxUvcPattern_t;
+
+/* Adjustment of the colours of the bars. The scales are in 1/256 steps: 256 leaves a value as it is. */
+typedef struct CyFxUvcPatternPicture_t
+{
+    uint16_t gain;                      /* Scale of the luma above black. */
+    uint16_t contrast;                  /* Scale of the luma around mid grey, after the gain. */
+    int16_t  brightness;                /* Offset added to the luma last. */
+    uint16_t saturation;                /* Scale of the chroma around neutral grey. */
+} CyFxUvcPatternPicture_t;
+
+/* Size of a frame of the given pixel format, or 0 if the format is not generated. */
+extern uint32_t
+CyFxUvcPatternFrameSize (
+        uint8_t  type,
+        uint16_t width,
+        uint16_t height);
+
+/* Start generating frames of the given format and size, from frame number 0. */
+extern void
+CyFxUvcPatternStart (
+        CyFxUvcPattern_t *pat_p,
+        uint8_t           type,
+        uint16_t          width,
+        uint16_t          height);
+
+/* Write len bytes of the current frame, starting at byte offset of the frame, to dst_p. There is no
+   alignment requirement on offset, dst_p or len; whole words are written where the destination
+   allows it. */
+extern void
+CyFxUvcPatternFill (
+        CyFxUvcPattern_t *pat_p,
+        uint32_t          offset,
+        uint8_t          *dst_p,
+        uint32_t          len);
+
+/* Adjust the colours of the bars, from the 75% bars drawn after CyFxUvcPatternStart, for the bytes
+   written from now on. Luma is kept within 16 to 235 and chroma within 16 to 240. The frame counter
+   band and the gradient are left as they are, so that the frame numbers can still be read back. */
+extern void
+CyFxUvcPatternPicture (
+        CyFxUvcPattern_t              *pat_p,
+        const CyFxUvcPatternPicture_t *pic_p);
+
+/* Move on to the next frame. */
+extern void
+CyFxUvcPatternNextFrame (
+        CyFxUvcPattern_t *pat_p);
+
+#include <cyu3externcend.h>
+
+#endif /* _INCLUDED_CYFXUVCPATTERN_H_ */
+
+/*[]*/
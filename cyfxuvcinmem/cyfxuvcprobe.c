@@ -0,0 +1,631 @@
+/*
+ ## Cypress USB 3.0 Platform source file (cyfxuvcprobe.c)
+ ## ===========================
+ ##
+ ##  Copyright Cypress Semiconductor Corporation, 2010-2023,
+ ##  All Rights Reserved
+ ##  UNPUBLISHED, LICENSED SOFTWARE.
+ ##
+ ##  CONFIDENTIAL AND PROPRIETARY INFORMATION
+ ##  WHICH IS THE PROPERTY OF CYPRESS.
+ ##
+ ##  Use of this file is governed
+ ##  by the license agreement included in the file
+ ##
+ ##     <install>/license/license.txt
+ ##
+ ##  where <install> is the Cypress software
+ ##  installation root directory path.
+ ##
+ ## ===========================
+*/
+
+/* This file implements the negotiation of the video probe and commit controls against the formats
+   and frames in glUvcFormats and the bandwidth of the video streaming endpoint.
+
+   Hosts repeat the probe requests several times while opening a stream. CyFxUvcProbeState_t keeps the
+   response to every GET request ready, so that only a SET_CUR with new values causes any computation;
+   GET_DEF is computed once per configuration and GET_MIN / GET_MAX once per selected frame.
+ */
+
+#include <cyu3error.h>
+#include "cyfxuvcinmem.h"
+#include "cyfxuvcprobe.h"
+
+/* Service intervals per second of the isochronous endpoint (bInterval = 1 at high and super speed). */
+#define CY_FX_UVC_ISO_SERVICE_PER_SEC   (8000)
+
+/* Frame intervals are given in 100 ns units. */
+#define CY_FX_UVC_INTERVAL_PER_SEC      (10000000)
+
+CyU3PReturnStatus_t
+CyFxUvcProbeGetEpGeometry (
+        CyU3PUSBSpeed_t      speed,
+        CyFxUvcEpGeometry_t *ep_p)
+{
+    if ((speed != CY_U3P_HIGH_SPEED) && (speed != CY_U3P_SUPER_SPEED))
+        return CY_U3P_ERROR_NOT_SUPPORTED;
+
+#ifdef CY_FX_EP_ISO_VIDEO
+    ep_p->isIso      = CyTrue;
+    ep_p->maxPktSize = CY_FX_EP_ISO_VIDEO_PKT_SIZE;
+    if (speed == CY_U3P_SUPER_SPEED)
+    {
+        ep_p->burstLen = CY_FX_EP_ISO_VIDEO_SS_BURST;
+        ep_p->mult     = CY_FX_EP_ISO_VIDEO_SS_MULT;
+    }
+    else
+    {
+        ep_p->burstLen = 1;
+        ep_p->mult     = CY_FX_EP_ISO_VIDEO_PKTS_COUNT;
+    }
+
+    /* One DMA buffer is sent in each service interval. */
+    ep_p->maxPayload  = CY_U3P_MIN ((uint32_t)ep_p->maxPktSize * ep_p->burstLen * ep_p->mult,
+            CY_FX_UVC_STREAM_BUF_SIZE);
+    ep_p->bytesPerSec = ep_p->maxPayload * CY_FX_UVC_ISO_SERVICE_PER_SEC;
+#else
+    ep_p->isIso      = CyFalse;
+    ep_p->mult       = 1;
+    if (speed == CY_U3P_SUPER_SPEED)
+    {
+        ep_p->maxPktSize  = CY_FX_EP_BULK_VIDEO_PKT_SIZE;
+        ep_p->burstLen    = CY_FX_BULK_BURST;
+        ep_p->bytesPerSec = CY_FX_UVC_BULK_SS_BYTES_PER_SEC;
+    }
+    else
+    {
+        ep_p->maxPktSize  = 512;
+        ep_p->burstLen    = 1;
+        ep_p->bytesPerSec = CY_FX_UVC_BULK_HS_BYTES_PER_SEC;
+    }
+
+    /* Each DMA buffer is one payload transfer. */
+    ep_p->maxPayload = CY_FX_UVC_STREAM_BUF_SIZE;
+#endif
+
+    return CY_U3P_SUCCESS;
+}
+
+const CyFxUvcFormatInfo_t *
+CyFxUvcProbeFindFormat (
+        uint8_t formatIndex)
+{
+    uint8_t i;
+
+    for (i = 0; i < glUvcFormatCount; i++)
+    {
+        if (glUvcFormats[i].formatIndex == formatIndex)
+            return &glUvcFormats[i];
+    }
+
+    return NULL;
+}
+
+/* Find a frame of a format by its index. Returns NULL if there is no such frame. */
+static const CyFxUvcFrameInfo_t *
+CyFxUvcProbeFindFrameInFormat (
+        const CyFxUvcFormatInfo_t *fmt_p,
+        uint8_t                    frameIndex)
+{
+    uint8_t i;
+
+    for (i = 0; i < fmt_p->frameCount; i++)
+    {
+        if (fmt_p->frame_p[i].frameIndex == frameIndex)
+            return &fmt_p->frame_p[i];
+    }
+
+    return NULL;
+}
+
+const CyFxUvcFrameInfo_t *
+CyFxUvcProbeFindFrame (
+        uint8_t formatIndex,
+        uint8_t frameIndex)
+{
+    const CyFxUvcFormatInfo_t *fmt_p = CyFxUvcProbeFindFormat (formatIndex);
+
+    if (fmt_p == NULL)
+        return NULL;
+
+    return CyFxUvcProbeFindFrameInFormat (fmt_p, frameIndex);
+}
+
+/* Size of the payload transfers (header included) needed to send frames of up to frameSize bytes at the
+   given frame interval.
+
+   An isochronous endpoint sends one payload in each service interval, so a frame has to be spread over
+   the service intervals in one frame interval, each payload carrying its own header. The result may
+   exceed the capacity of the endpoint, in which case the interval cannot be used.
+
+   A bulk payload can carry a whole frame and is only limited by the size of the DMA buffers. */
+static uint32_t
+CyFxUvcProbePayloadSize (
+        uint32_t                   frameSize,
+        uint32_t                   interval,
+        const CyFxUvcEpGeometry_t *ep_p)
+{
+    uint32_t services;
+
+    if (!ep_p->isIso)
+        return CY_U3P_MIN (frameSize + CY_FX_UVC_MAX_HEADER, ep_p->maxPayload);
+
+    services = (uint32_t)(((uint64_t)interval * CY_FX_UVC_ISO_SERVICE_PER_SEC) / CY_FX_UVC_INTERVAL_PER_SEC);
+    if (services == 0)
+        return 0xFFFFFFFF;
+
+    return ((frameSize + services - 1) / services) + CY_FX_UVC_MAX_HEADER;
+}
+
+/* Check whether a frame can be streamed at the given interval over the endpoint. */
+static CyBool_t
+CyFxUvcProbeIntervalFits (
+        const CyFxUvcFrameInfo_t  *frame_p,
+        uint32_t                   interval,
+        const CyFxUvcEpGeometry_t *ep_p)
+{
+    uint32_t frameSize = frame_p->maxFrameBufSize;
+    uint32_t payload   = CyFxUvcProbePayloadSize (frameSize, interval, ep_p);
+    uint32_t payloads;
+    uint64_t frameBytes;
+
+    if (payload > ep_p->maxPayload)
+        return CyFalse;
+    if (ep_p->isIso)
+        return CyTrue;
+
+    /* Bulk: every payload carries a header in addition to the frame data. */
+    payloads   = (frameSize + (payload - CY_FX_UVC_MAX_HEADER) - 1) / (payload - CY_FX_UVC_MAX_HEADER);
+    frameBytes = (uint64_t)frameSize + ((uint64_t)payloads * CY_FX_UVC_MAX_HEADER);
+
+    return ((frameBytes * CY_FX_UVC_INTERVAL_PER_SEC) <= ((uint64_t)ep_p->bytesPerSec * interval));
+}
+
+/* Select the supported frame interval closest to the one requested. If the frame rate cannot be
+   sustained on the link, the next longer interval is tried; the longest interval is used if none fits. */
+static uint32_t
+CyFxUvcProbeMatchInterval (
+        const CyFxUvcFrameInfo_t  *frame_p,
+        uint32_t                   interval,
+        const CyFxUvcEpGeometry_t *ep_p)
+{
+    uint32_t diff, bestDiff = 0xFFFFFFFF;
+    uint8_t  i, best = 0;
+
+    if (interval == 0)
+        interval = frame_p->defInterval;
+
+    for (i = 0; i < frame_p->intervalCount; i++)
+    {
+        diff = (frame_p->interval_p[i] > interval) ? (frame_p->interval_p[i] - interval) :
+            (interval - frame_p->interval_p[i]);
+        if (diff < bestDiff)
+        {
+            bestDiff = diff;
+            best     = i;
+        }
+    }
+
+    while (((best + 1) < frame_p->intervalCount) &&
+            (!CyFxUvcProbeIntervalFits (frame_p, frame_p->interval_p[best], ep_p)))
+        best++;
+
+    return frame_p->interval_p[best];
+}
+
+/* Fill in the values that the device determines for a format, frame and interval. bmHint is left as
+   proposed by the host. */
+static void
+CyFxUvcProbeFill (
+        CyFxUvcProbeCtrl_t        *ctrl_p,
+        const CyFxUvcFormatInfo_t *fmt_p,
+        const CyFxUvcFrameInfo_t  *frame_p,
+        uint32_t                   interval,
+        const CyFxUvcEpGeometry_t *ep_p,
+        uint32_t                   sliceSize)
+{
+    uint8_t i;
+
+    ctrl_p->bFormatIndex             = fmt_p->formatIndex;
+    ctrl_p->bFrameIndex              = frame_p->frameIndex;
+    ctrl_p->dwFrameInterval          = interval;
+
+    /* The stored MJPEG frames and H.264 / H.265 streams do not support any of the compression parameters. */
+    ctrl_p->wKeyFrameRate            = 0;
+    ctrl_p->wPFrameRate              = 0;
+    ctrl_p->wCompQuality             = 0;
+    ctrl_p->wCompWindowSize          = 0;
+    ctrl_p->wDelay                   = 0;
+
+    /* Sized for the largest stored frame, which the generated format table gives as the frame buffer size,
+       so that the host reserves no more bandwidth than needed. */
+    ctrl_p->dwMaxVideoFrameSize      = frame_p->maxFrameBufSize;
+    ctrl_p->dwMaxPayloadTransferSize = CY_U3P_MIN (CyFxUvcProbePayloadSize (ctrl_p->dwMaxVideoFrameSize,
+                interval, ep_p), ep_p->maxPayload);
+
+    /* Payloads aligned to the NAL units end before a NAL unit that does not fit, so they must have room
+       for a whole slice: the isochronous payloads sized for the bandwidth alone are only a few bytes
+       long for the small frames, and would split every slice. */
+    if ((fmt_p->isAnnexB) && (sliceSize != 0))
+        ctrl_p->dwMaxPayloadTransferSize = CY_U3P_MIN (CY_U3P_MAX (ctrl_p->dwMaxPayloadTransferSize,
+                    sliceSize + CY_FX_UVC_MAX_HEADER), ep_p->maxPayload);
+    ctrl_p->dwClockFrequency         = CY_FX_UVC_DEVICE_CLOCK_FREQ;
+    ctrl_p->bmFramingInfo            = 0;
+    ctrl_p->bPreferedVersion         = 0;
+    ctrl_p->bMinVersion              = 0;
+    ctrl_p->bMaxVersion              = 0;
+
+    ctrl_p->bUsage                     = 0;
+    ctrl_p->bBitDepthLuma              = 0;
+    ctrl_p->bmSettings                 = 0;
+    ctrl_p->bMaxNumberOfRefFramesPlus1 = 0;
+    ctrl_p->bmRateControlModes         = 0;
+    for (i = 0; i < 4; i++)
+        ctrl_p->bmLayoutPerStream[i] = 0;
+
+    /* The stored H.264 and H.265 streams are sent one access unit per video frame, with the frame
+       boundaries marked in the payload headers. Simulcast layers take turns by whole access units. */
+    if ((fmt_p->subtype == CY_FX_UVC_VS_FORMAT_H264) || (fmt_p->subtype == CY_FX_UVC_VS_FORMAT_H264_SIMULCAST) ||
+            (fmt_p->subtype == CY_FX_UVC_VS_FORMAT_FRAME_BASED))
+        ctrl_p->bmFramingInfo = CY_FX_UVC_PROBE_FRAMING_FID | CY_FX_UVC_PROBE_FRAMING_EOF;
+
+    /* The H.264 streams are 8 bit, real time streams with one reference frame, in a single layer or as
+       simulcast layers of one stream each (bmLayoutPerStream 0: no temporal, spatial or quality
+       layers). The UVC 1.5 fields do not apply to the frame based format. */
+    if ((fmt_p->subtype == CY_FX_UVC_VS_FORMAT_H264) || (fmt_p->subtype == CY_FX_UVC_VS_FORMAT_H264_SIMULCAST))
+    {
+        ctrl_p->bUsage                     = CY_FX_UVC_PROBE_USAGE_REALTIME;
+        ctrl_p->bMaxNumberOfRefFramesPlus1 = 2;
+        ctrl_p->bmRateControlModes         = CY_FX_UVC_PROBE_RATE_CONTROL_CBR;
+        for (i = 1; i < CY_U3P_MIN (frame_p->layerCount, 4); i++)
+            ctrl_p->bmRateControlModes |= CY_FX_UVC_PROBE_RATE_CONTROL_CBR << (i * CY_FX_UVC_PROBE_RATE_CONTROL_BITS);
+    }
+}
+
+void
+CyFxUvcProbeNegotiate (
+        CyFxUvcProbeCtrl_t        *ctrl_p,
+        const CyFxUvcEpGeometry_t *ep_p,
+        uint32_t                   sliceSize)
+{
+    const CyFxUvcFormatInfo_t *fmt_p;
+    const CyFxUvcFrameInfo_t  *frame_p;
+
+    /* Unsupported format or frame indices are replaced by the defaults. */
+    fmt_p = CyFxUvcProbeFindFormat (ctrl_p->bFormatIndex);
+    if (fmt_p == NULL)
+        fmt_p = &glUvcFormats[0];
+
+    frame_p = CyFxUvcProbeFindFrameInFormat (fmt_p, ctrl_p->bFrameIndex);
+    if (frame_p == NULL)
+        frame_p = CyFxUvcProbeFindFrameInFormat (fmt_p, fmt_p->defFrameIndex);
+
+    /* The frame interval is adjusted even if the host asked for it to be kept fixed: the stored frames
+       cannot be made smaller to fit the link, so a longer interval is the only option. */
+    CyFxUvcProbeFill (ctrl_p, fmt_p, frame_p,
+            CyFxUvcProbeMatchInterval (frame_p, ctrl_p->dwFrameInterval, ep_p), ep_p, sliceSize);
+}
+
+void
+CyFxUvcProbeGetLimit (
+        uint8_t                    bRequest,
+        const CyFxUvcProbeCtrl_t  *cur_p,
+        CyFxUvcProbeCtrl_t        *ctrl_p,
+        const CyFxUvcEpGeometry_t *ep_p,
+        uint32_t                   sliceSize)
+{
+    const CyFxUvcFormatInfo_t *fmt_p   = &glUvcFormats[0];
+    const CyFxUvcFrameInfo_t  *frame_p = CyFxUvcProbeFindFrameInFormat (fmt_p, fmt_p->defFrameIndex);
+    uint32_t interval = frame_p->defInterval;
+
+    if (bRequest != CY_FX_USB_UVC_GET_DEF_REQ)
+    {
+        fmt_p   = CyFxUvcProbeFindFormat (cur_p->bFormatIndex);
+        frame_p = CyFxUvcProbeFindFrame (cur_p->bFormatIndex, cur_p->bFrameIndex);
+        if (frame_p == NULL)
+        {
+            fmt_p   = &glUvcFormats[0];
+            frame_p = CyFxUvcProbeFindFrameInFormat (fmt_p, fmt_p->defFrameIndex);
+        }
+
+        if (bRequest == CY_FX_USB_UVC_GET_MIN_REQ)
+            interval = frame_p->interval_p[0];
+        else
+            interval = frame_p->interval_p[frame_p->intervalCount - 1];
+    }
+
+    ctrl_p->bmHint = 0;
+    CyFxUvcProbeFill (ctrl_p, fmt_p, frame_p, interval, ep_p, sliceSize);
+}
+
+/* Little endian field access in the packed probe structure. */
+#define CY_FX_UVC_GET_LE16(p)           ((uint16_t)((p)[0] | ((p)[1] << 8)))
+#define CY_FX_UVC_GET_LE32(p)           ((uint32_t)((p)[0] | ((p)[1] << 8) | ((p)[2] << 16) | ((uint32_t)(p)[3] << 24)))
+#define CY_FX_UVC_SET_LE16(p,v)         do { (p)[0] = (uint8_t)(v); (p)[1] = (uint8_t)((v) >> 8); } while (0)
+#define CY_FX_UVC_SET_LE32(p,v)         do { (p)[0] = (uint8_t)(v); (p)[1] = (uint8_t)((v) >> 8);       \
+                                             (p)[2] = (uint8_t)((v) >> 16); (p)[3] = (uint8_t)((v) >> 24); } while (0)
+
+/* Convert the native structure to the full UVC 1.5 layout. */
+static void
+CyFxUvcProbeToBytes (
+        const CyFxUvcProbeCtrl_t *ctrl_p,
+        uint8_t                  *buf_p)
+{
+    uint8_t i;
+
+    CY_FX_UVC_SET_LE16 (buf_p + 0, ctrl_p->bmHint);
+    buf_p[2] = ctrl_p->bFormatIndex;
+    buf_p[3] = ctrl_p->bFrameIndex;
+    CY_FX_UVC_SET_LE32 (buf_p + 4, ctrl_p->dwFrameInterval);
+    CY_FX_UVC_SET_LE16 (buf_p + 8, ctrl_p->wKeyFrameRate);
+    CY_FX_UVC_SET_LE16 (buf_p + 10, ctrl_p->wPFrameRate);
+    CY_FX_UVC_SET_LE16 (buf_p + 12, ctrl_p->wCompQuality);
+    CY_FX_UVC_SET_LE16 (buf_p + 14, ctrl_p->wCompWindowSize);
+    CY_FX_UVC_SET_LE16 (buf_p + 16, ctrl_p->wDelay);
+    CY_FX_UVC_SET_LE32 (buf_p + 18, ctrl_p->dwMaxVideoFrameSize);
+    CY_FX_UVC_SET_LE32 (buf_p + 22, ctrl_p->dwMaxPayloadTransferSize);
+    CY_FX_UVC_SET_LE32 (buf_p + 26, ctrl_p->dwClockFrequency);
+    buf_p[30] = ctrl_p->bmFramingInfo;
+    buf_p[31] = ctrl_p->bPreferedVersion;
+    buf_p[32] = ctrl_p->bMinVersion;
+    buf_p[33] = ctrl_p->bMaxVersion;
+    buf_p[34] = ctrl_p->bUsage;
+    buf_p[35] = ctrl_p->bBitDepthLuma;
+    buf_p[36] = ctrl_p->bmSettings;
+    buf_p[37] = ctrl_p->bMaxNumberOfRefFramesPlus1;
+    CY_FX_UVC_SET_LE16 (buf_p + 38, ctrl_p->bmRateControlModes);
+    for (i = 0; i < 4; i++)
+        CY_FX_UVC_SET_LE16 (buf_p + 40 + (2 * i), ctrl_p->bmLayoutPerStream[i]);
+}
+
+void
+CyFxUvcProbeUnpack (
+        CyFxUvcProbeCtrl_t *ctrl_p,
+        const uint8_t      *buf_p,
+        uint16_t            len)
+{
+    uint8_t tmp[CY_FX_UVC_PROBE_LEN_UVC15];
+    uint8_t i;
+
+    /* Overlay the received bytes on the current values, so that missing fields keep their value. */
+    CyFxUvcProbeToBytes (ctrl_p, tmp);
+    for (i = 0; (i < len) && (i < CY_FX_UVC_PROBE_LEN_UVC15); i++)
+        tmp[i] = buf_p[i];
+
+    ctrl_p->bmHint                     = CY_FX_UVC_GET_LE16 (tmp + 0);
+    ctrl_p->bFormatIndex               = tmp[2];
+    ctrl_p->bFrameIndex                = tmp[3];
+    ctrl_p->dwFrameInterval            = CY_FX_UVC_GET_LE32 (tmp + 4);
+    ctrl_p->wKeyFrameRate              = CY_FX_UVC_GET_LE16 (tmp + 8);
+    ctrl_p->wPFrameRate                = CY_FX_UVC_GET_LE16 (tmp + 10);
+    ctrl_p->wCompQuality               = CY_FX_UVC_GET_LE16 (tmp + 12);
+    ctrl_p->wCompWindowSize            = CY_FX_UVC_GET_LE16 (tmp + 14);
+    ctrl_p->wDelay                     = CY_FX_UVC_GET_LE16 (tmp + 16);
+    ctrl_p->dwMaxVideoFrameSize        = CY_FX_UVC_GET_LE32 (tmp + 18);
+    ctrl_p->dwMaxPayloadTransferSize   = CY_FX_UVC_GET_LE32 (tmp + 22);
+    ctrl_p->dwClockFrequency           = CY_FX_UVC_GET_LE32 (tmp + 26);
+    ctrl_p->bmFramingInfo              = tmp[30];
+    ctrl_p->bPreferedVersion           = tmp[31];
+    ctrl_p->bMinVersion                = tmp[32];
+    ctrl_p->bMaxVersion                = tmp[33];
+    ctrl_p->bUsage                     = tmp[34];
+    ctrl_p->bBitDepthLuma              = tmp[35];
+    ctrl_p->bmSettings                 = tmp[36];
+    ctrl_p->bMaxNumberOfRefFramesPlus1 = tmp[37];
+    ctrl_p->bmRateControlModes         = CY_FX_UVC_GET_LE16 (tmp + 38);
+    for (i = 0; i < 4; i++)
+        ctrl_p->bmLayoutPerStream[i] = CY_FX_UVC_GET_LE16 (tmp + 40 + (2 * i));
+}
+
+uint16_t
+CyFxUvcProbePack (
+        const CyFxUvcProbeCtrl_t *ctrl_p,
+        uint8_t                  *buf_p,
+        uint16_t                  len)
+{
+    uint8_t tmp[CY_FX_UVC_PROBE_LEN_UVC15];
+    uint16_t i;
+
+    if (len > CY_FX_UVC_PROBE_LEN_UVC15)
+        len = CY_FX_UVC_PROBE_LEN_UVC15;
+
+    CyFxUvcProbeToBytes (ctrl_p, tmp);
+    for (i = 0; i < len; i++)
+        buf_p[i] = tmp[i];
+
+    return len;
+}
+
+/* Recompute the GET_MIN and GET_MAX responses if the probe now selects another format or frame than
+   the one they were computed for. */
+static void
+CyFxUvcProbeUpdateLimits (
+        CyFxUvcProbeState_t *st_p)
+{
+    CyFxUvcProbeCtrl_t limit;
+
+    if ((st_p->probe.bFormatIndex == st_p->limitFormat) && (st_p->probe.bFrameIndex == st_p->limitFrame))
+        return;
+
+    CyFxUvcProbeGetLimit (CY_FX_USB_UVC_GET_MIN_REQ, &st_p->probe, &limit, &st_p->ep, st_p->sliceSize);
+    CyFxUvcProbeToBytes (&limit, st_p->minBuf);
+    CyFxUvcProbeGetLimit (CY_FX_USB_UVC_GET_MAX_REQ, &st_p->probe, &limit, &st_p->ep, st_p->sliceSize);
+    CyFxUvcProbeToBytes (&limit, st_p->maxBuf);
+
+    st_p->limitFormat   = st_p->probe.bFormatIndex;
+    st_p->limitFrame    = st_p->probe.bFrameIndex;
+    st_p->computeCount += 2;
+}
+
+void
+CyFxUvcProbeInit (
+        CyFxUvcProbeState_t *st_p,
+        CyU3PUSBSpeed_t      speed)
+{
+    CyFxUvcProbeCtrl_t def;
+    uint16_t i;
+
+    if (CyFxUvcProbeGetEpGeometry (speed, &st_p->ep) != CY_U3P_SUCCESS)
+        CyFxUvcProbeGetEpGeometry (CY_U3P_HIGH_SPEED, &st_p->ep);
+
+    for (i = 0; i < CY_FX_UVC_PROBE_BUF_SIZE; i++)
+    {
+        st_p->curBuf[i]    = 0;
+        st_p->commitBuf[i] = 0;
+        st_p->defBuf[i]    = 0;
+        st_p->minBuf[i]    = 0;
+        st_p->maxBuf[i]    = 0;
+        st_p->infoBuf[i]   = 0;
+    }
+    st_p->sliceSize = 0;
+
+    /* GET_DEF does not depend on the probe values: it is computed once for the configuration, and again
+       only when the slice size changes. */
+    for (i = 0; i < sizeof (def); i++)
+        ((uint8_t *)&def)[i] = 0;
+    CyFxUvcProbeGetLimit (CY_FX_USB_UVC_GET_DEF_REQ, &def, &def, &st_p->ep, st_p->sliceSize);
+    CyFxUvcProbeToBytes (&def, st_p->defBuf);
+
+    st_p->probe        = def;
+    st_p->commit       = def;
+    CyFxUvcProbeToBytes (&def, st_p->curBuf);
+    CyFxUvcProbeToBytes (&def, st_p->commitBuf);
+    st_p->computeCount = 1;
+
+    st_p->limitFormat  = 0;
+    st_p->limitFrame   = 0;
+    CyFxUvcProbeUpdateLimits (st_p);
+
+    /* GET_INFO: GET and SET supported. GET_LEN: size of the UVC 1.5 structure. */
+    st_p->infoBuf[0]   = 0x03;
+    CY_FX_UVC_SET_LE16 (st_p->infoBuf + 2, CY_FX_UVC_PROBE_LEN_UVC15);
+
+    st_p->state        = CY_FX_UVC_PROBE_IDLE;
+}
+
+CyU3PReturnStatus_t
+CyFxUvcProbeGet (
+        CyFxUvcProbeState_t *st_p,
+        uint16_t             control,
+        uint8_t              bRequest,
+        const uint8_t      **buf_pp,
+        uint16_t            *len_p)
+{
+    CyBool_t isCommit = (control == CY_FX_USB_UVC_VS_COMMIT_CONTROL);
+
+    if ((!isCommit) && (control != CY_FX_USB_UVC_VS_PROBE_CONTROL))
+        return CY_U3P_ERROR_NOT_SUPPORTED;
+
+    *len_p = CY_FX_UVC_PROBE_LEN_UVC15;
+    switch (bRequest)
+    {
+        case CY_FX_USB_UVC_GET_CUR_REQ:
+            *buf_pp = (isCommit) ? st_p->commitBuf : st_p->curBuf;
+            break;
+
+        case CY_FX_USB_UVC_GET_INFO_REQ:
+            *buf_pp = st_p->infoBuf;
+            *len_p  = 1;
+            break;
+
+        case CY_FX_USB_UVC_GET_LEN_REQ:
+            *buf_pp = st_p->infoBuf + 2;
+            *len_p  = 2;
+            break;
+
+        /* The commit control only supports GET_CUR, GET_INFO and GET_LEN. */
+        case CY_FX_USB_UVC_GET_DEF_REQ:
+            if (isCommit)
+                return CY_U3P_ERROR_NOT_SUPPORTED;
+            *buf_pp = st_p->defBuf;
+            break;
+
+        case CY_FX_USB_UVC_GET_MIN_REQ:
+            if (isCommit)
+                return CY_U3P_ERROR_NOT_SUPPORTED;
+            *buf_pp = st_p->minBuf;
+            break;
+
+        case CY_FX_USB_UVC_GET_MAX_REQ:
+            if (isCommit)
+                return CY_U3P_ERROR_NOT_SUPPORTED;
+            *buf_pp = st_p->maxBuf;
+            break;
+
+        default:
+            return CY_U3P_ERROR_NOT_SUPPORTED;
+    }
+
+    return CY_U3P_SUCCESS;
+}
+
+CyU3PReturnStatus_t
+CyFxUvcProbeSet (
+        CyFxUvcProbeState_t *st_p,
+        uint16_t             control,
+        const uint8_t       *buf_p,
+        uint16_t             len)
+{
+    CyBool_t            isCommit = (control == CY_FX_USB_UVC_VS_COMMIT_CONTROL);
+    CyFxUvcProbeCtrl_t *ctrl_p;
+    uint8_t            *resp_p;
+    uint16_t            i;
+
+    if ((!isCommit) && (control != CY_FX_USB_UVC_VS_PROBE_CONTROL))
+        return CY_U3P_ERROR_NOT_SUPPORTED;
+    if (len < CY_FX_UVC_PROBE_LEN_UVC10)
+        return CY_U3P_ERROR_BAD_ARGUMENT;
+
+    ctrl_p = (isCommit) ? &st_p->commit : &st_p->probe;
+    resp_p = (isCommit) ? st_p->commitBuf : st_p->curBuf;
+    st_p->state = (isCommit) ? CY_FX_UVC_PROBE_COMMITTED : CY_FX_UVC_PROBE_PROBING;
+
+    /* Hosts usually send back the values they just read. Negotiated values negotiate to themselves, so
+       nothing needs to be computed in that case. */
+    if (len > CY_FX_UVC_PROBE_LEN_UVC15)
+        len = CY_FX_UVC_PROBE_LEN_UVC15;
+    for (i = 0; (i < len) && (buf_p[i] == resp_p[i]); i++)
+        ;
+    if (i == len)
+        return CY_U3P_SUCCESS;
+
+    CyFxUvcProbeUnpack (ctrl_p, buf_p, len);
+    CyFxUvcProbeNegotiate (ctrl_p, &st_p->ep, st_p->sliceSize);
+    CyFxUvcProbeToBytes (ctrl_p, resp_p);
+    st_p->computeCount++;
+
+    if (!isCommit)
+        CyFxUvcProbeUpdateLimits (st_p);
+
+    return CY_U3P_SUCCESS;
+}
+
+void
+CyFxUvcProbeSetSliceSize (
+        CyFxUvcProbeState_t *st_p,
+        uint32_t             sliceSize)
+{
+    CyFxUvcProbeCtrl_t def;
+    uint16_t i;
+
+    if (sliceSize == st_p->sliceSize)
+        return;
+
+    st_p->sliceSize = sliceSize;
+    for (i = 0; i < sizeof (def); i++)
+        ((uint8_t *)&def)[i] = 0;
+    CyFxUvcProbeGetLimit (CY_FX_USB_UVC_GET_DEF_REQ, &def, &def, &st_p->ep, sliceSize);
+    CyFxUvcProbeToBytes (&def, st_p->defBuf);
+
+    CyFxUvcProbeNegotiate (&st_p->probe, &st_p->ep, sliceSize);
+    CyFxUvcProbeToBytes (&st_p->probe, st_p->curBuf);
+    st_p->computeCount += 2;
+
+    st_p->limitFormat = 0;
+    st_p->limitFrame  = 0;
+    CyFxUvcProbeUpdateLimits (st_p);
+}
+
+/*[]*/
+
@@ -0,0 +1,127 @@
+/*
+ ## Cypress USB 3.0 Platform source file (cyfxuvcrate.c)
+ ## ===========================
+ ##
+ ##  Copyright Cypress Semiconductor Corporation, 2010-2023,
+ ##  All Rights Reserved
+ ##  UNPUBLISHED, LICENSED SOFTWARE.
+ ##
+ ##  CONFIDENTIAL AND PROPRIETARY INFORMATION
+ ##  WHICH IS THE PROPERTY OF CYPRESS.
+ ##
+ ##  Use of this file is governed
+ ##  by the license agreement included in the file
+ ##
+ ##     <install>/license/license.txt
+ ##
+ ##  where <install> is the Cypress software
+ ##  installation root directory path.
+ ##
+ ## ===========================
+*/
+
+/* This file implements the choice of the quality tier of a stored compressed stream from the rate
+   control targets of the encoding unit.
+
+   The P pictures of a tier refer to the pictures before them in the same tier, so the streamer only
+   changes tier at the start of a group of pictures, where the IDR picture needs no earlier one. The
+   choice is made from the average and largest frame lengths kept in the format table for each tier, so
+   it costs a few multiplications whatever the length of the stream. The lengths are counted with the
+   payload headers they are sent with, as the bit rate shaper that holds the stream to the same targets
+   counts them: with the small isochronous payloads the headers can outweigh the video data.
+ */
+
+#include "cyfxuvcinmem.h"
+#include "cyfxuvcrate.h"
+
+/* Frame intervals are given in 100 ns units. */
+#define CY_FX_UVC_RATE_INTERVALS_PER_SEC        (10000000u)
+
+uint32_t
+CyFxUvcRateBitRate (
+        uint32_t len,
+        uint32_t interval)
+{
+    uint64_t rate;
+
+    if (interval == 0)
+        return 0xFFFFFFFFu;
+    rate = (uint64_t)len * 8 * CY_FX_UVC_RATE_INTERVALS_PER_SEC / interval;
+    return (rate > 0xFFFFFFFFu) ? 0xFFFFFFFFu : (uint32_t)rate;
+}
+
+uint32_t
+CyFxUvcRateWireLength (
+        uint32_t len,
+        uint32_t payload)
+{
+    uint32_t data;
+
+    if (payload <= CY_FX_UVC_MAX_HEADER)
+        return len;
+    data = payload - CY_FX_UVC_MAX_HEADER;
+    return len + ((len + data - 1) / data) * CY_FX_UVC_MAX_HEADER;
+}
+
+CyBool_t
+CyFxUvcRateTierFits (
+        const CyFxUvcTierInfo_t   *tier_p,
+        uint32_t                   interval,
+        uint32_t                   payload,
+        const CyFxUvcRateTarget_t *target_p)
+{
+    uint32_t avgLen = CyFxUvcRateWireLength (tier_p->avgFrameLen, payload);
+    uint32_t maxLen = CyFxUvcRateWireLength (tier_p->maxFrameLen, payload);
+
+    switch (target_p->mode)
+    {
+        case CY_FX_UVC_RATE_CONTROL_CQP:
+            return CyTrue;
+
+        case CY_FX_UVC_RATE_CONTROL_CBR:
+            return (CyBool_t)((CyFxUvcRateBitRate (avgLen, interval) <= target_p->avgBitRate) &&
+                    ((uint64_t)maxLen <= (uint64_t)target_p->cpbSize * CY_FX_UVC_SHAPER_CPB_UNIT));
+
+        default:
+            return (CyBool_t)((CyFxUvcRateBitRate (avgLen, interval) <= target_p->avgBitRate) &&
+                    (CyFxUvcRateBitRate (maxLen, interval) <= target_p->peakBitRate));
+    }
+}
+
+uint8_t
+CyFxUvcRateSelectTier (
+        const CyFxUvcFrameInfo_t  *frame_p,
+        uint32_t                   interval,
+        uint32_t                   payload,
+        const CyFxUvcRateTarget_t *target_p)
+{
+    const CyFxUvcTierInfo_t *tier_p;
+    uint8_t  i, best = 0;
+    uint8_t  diff, bestDiff = 0xFF;
+
+    if (frame_p->tierCount == 0)
+        return 0;
+
+    for (i = 0; i < frame_p->tierCount; i++)
+    {
+        tier_p = &frame_p->tier_p[i];
+        if (target_p->mode == CY_FX_UVC_RATE_CONTROL_CQP)
+        {
+            diff = (tier_p->qp > target_p->qp) ? (tier_p->qp - target_p->qp) : (target_p->qp - tier_p->qp);
+            if (diff < bestDiff)
+            {
+                bestDiff = diff;
+                best     = i;
+            }
+        }
+        else if (CyFxUvcRateTierFits (tier_p, interval, payload, target_p))
+        {
+            return i;
+        }
+    }
+
+    return (target_p->mode == CY_FX_UVC_RATE_CONTROL_CQP) ? best : (frame_p->tierCount - 1);
+}
+
+/*[]*/
+
@@ -0,0 +1,96 @@
+/*
+ ## Cypress USB 3.0 Platform header file (cyfxuvcrate.h)
+ ## ===========================
+ ##
+ ##  Copyright Cypress Semiconductor Corporation, 2010-2023,
+ ##  All Rights Reserved
+ ##  UNPUBLISHED, LICENSED SOFTWARE.
+ ##
+ ##  CONFIDENTIAL AND PROPRIETARY INFORMATION
+ ##  WHICH IS THE PROPERTY OF CYPRESS.
+ ##
+ ##  Use of this file is governed
+ ##  by the license agreement included in the file
+ ##
+ ##     <install>/license/license.txt
+ ##
+ ##  where <install> is the Cypress software
+ ##  installation root directory path.
+ ##
+ ## ===========================
+*/
+
+/* File: cyfxuvcrate.h
+ *
+ * Rate control for the stored compressed streams. A frame can store its video frames in several quality
+ * tiers, the same sequence encoded at falling quality and size. The streamer picks the tier for each
+ * group of pictures from the rate control mode, bit rate and quantization parameter controls of the
+ * encoding unit, so that the stream behaves towards the host as an encoder set to those targets would.
+ */
+
+#ifndef _INCLUDED_CYFXUVCRATE_H_
+#define _INCLUDED_CYFXUVCRATE_H_
+
+#include <cyu3types.h>
+#include "cyfxuvcprobe.h"
+#include <cyu3externcstart.h>
+
+/* Values of the rate control mode control, as defined by UVC 1.5. */
+#define CY_FX_UVC_RATE_CONTROL_VBR      (1)     /* Variable bit rate, underflow allowed. */
+#define CY_FX_UVC_RATE_CONTROL_CBR      (2)     /* Constant bit rate. */
+#define CY_FX_UVC_RATE_CONTROL_CQP      (3)     /* Constant QP. */
+
+/* Targets set through the encoding unit controls. */
+typedef struct CyFxUvcRateTarget_t
+{
+    uint8_t  mode;                      /* Rate control mode, CY_FX_UVC_RATE_CONTROL_*. */
+    uint8_t  qp;                        /* QP of the P pictures, for constant QP. */
+    uint32_t avgBitRate;                /* Average bit rate in bit/s. */
+    uint32_t peakBitRate;               /* Peak bit rate in bit/s. */
+    uint32_t cpbSize;                   /* CPB size in units of 16 bits. */
+} CyFxUvcRateTarget_t;
+
+/* Pick the quality tier of a frame for the targets at the given frame interval (100 ns units), sent in
+   payloads of up to payload bytes:
+     - CBR: the best tier whose average bit rate is within the average bit rate and whose largest video
+       frame fits in the CPB.
+     - VBR: the best tier whose average bit rate is within the average bit rate and whose largest video
+       frame, sent in one frame interval, is within the peak bit rate.
+     - Constant QP: the tier with the QP closest to the one set, the better one on a tie.
+   The bit rates and frame sizes include the payload headers, as the bit rate shaper counts them
+   (cyfxuvcshaper.h). The last (smallest) tier is used when none meets the targets. Returns 0 for frames
+   without tiers. */
+extern uint8_t
+CyFxUvcRateSelectTier (
+        const CyFxUvcFrameInfo_t  *frame_p,
+        uint32_t                   interval,
+        uint32_t                   payload,
+        const CyFxUvcRateTarget_t *target_p);
+
+/* Whether a tier meets the CBR or VBR targets as CyFxUvcRateSelectTier checks them. Any tier meets the
+   constant QP target. */
+extern CyBool_t
+CyFxUvcRateTierFits (
+        const CyFxUvcTierInfo_t   *tier_p,
+        uint32_t                   interval,
+        uint32_t                   payload,
+        const CyFxUvcRateTarget_t *target_p);
+
+/* Bytes sent for a video frame of len bytes in payloads of up to payload bytes, each with its header. */
+extern uint32_t
+CyFxUvcRateWireLength (
+        uint32_t len,
+        uint32_t payload);
+
+/* Bit rate in bit/s of video frames of len bytes sent at the given frame interval. */
+extern uint32_t
+CyFxUvcRateBitRate (
+        uint32_t len,
+        uint32_t interval);
+
+#include <cyu3externcend.h>
+
+#endif /* _INCLUDED_CYFXUVCRATE_H_ */
+
+/*[]*/
+
@@ -0,0 +1,135 @@
+/*
+ ## Cypress USB 3.0 Platform source file (cyfxuvcresil.c)
+ ## ===========================
+ ##
+ ##  Copyright Cypress Semiconductor Corporation, 2010-2023,
+ ##  All Rights Reserved
+ ##  UNPUBLISHED, LICENSED SOFTWARE.
+ ##
+ ##  CONFIDENTIAL AND PROPRIETARY INFORMATION
+ ##  WHICH IS THE PROPERTY OF CYPRESS.
+ ##
+ ##  Use of this file is governed
+ ##  by the license agreement included in the file
+ ##
+ ##     <install>/license/license.txt
+ ##
+ ##  where <install> is the Cypress software
+ ##  installation root directory path.
+ ##
+ ## ===========================
+*/
+
+/* This file implements the redundancy added to the stored H.264 and H.265 streams by the error
+   resiliency control, and the accounting of its cost.
+
+   The parameter sets (SPS and PPS, and the VPS of H.265) are only stored in front of the IDR picture
+   that starts each stream. They are found there by position rather than by NAL unit type, so that the
+   same code serves both codecs: the IDR access unit is the parameter sets followed by one slice. Sent
+   again in front of a later access unit, they are identical to the active ones, which a decoder that
+   has them already takes without effect.
+ */
+
+#include "cyfxuvcresil.h"
+#include "cyfxuvcslice.h"
+
+void
+CyFxUvcResilStart (
+        CyFxUvcResil_t *rs_p)
+{
+    uint8_t i;
+
+    for (i = 0; i < CY_FX_UVC_LAYER_MAX; i++)
+        rs_p->count[i] = 0;
+    rs_p->isSync = CyFalse;
+
+    rs_p->stats.accessUnits   = 0;
+    rs_p->stats.bytes         = 0;
+    rs_p->stats.paramSets     = 0;
+    rs_p->stats.paramSetBytes = 0;
+    rs_p->stats.syncFrames    = 0;
+    rs_p->stats.syncBytes     = 0;
+    rs_p->stats.reserved[0]   = 0;
+    rs_p->stats.reserved[1]   = 0;
+}
+
+uint32_t
+CyFxUvcResilParamSets (
+        const uint8_t *idr_p,
+        uint32_t       idrLen)
+{
+    /* With room for all but the last byte, the cut falls at the start of the last NAL unit. */
+    if (idrLen == 0)
+        return 0;
+    return CyFxUvcSliceCut (idr_p, idrLen, 0, idrLen - 1);
+}
+
+uint32_t
+CyFxUvcResilFrame (
+        CyFxUvcResil_t *rs_p,
+        uint16_t        features,
+        uint8_t         stream,
+        CyBool_t        isIdr,
+        uint32_t        paramLen,
+        uint32_t        auLen,
+        uint32_t        room)
+{
+    uint8_t  period = (uint8_t)((features & CY_FX_UVC_RESIL_PERIOD_MASK) >> CY_FX_UVC_RESIL_PERIOD_POS);
+    uint32_t len    = 0;
+
+    if (stream >= CY_FX_UVC_LAYER_MAX)
+        stream = 0;
+
+    if (isIdr)
+    {
+        rs_p->count[stream] = 0;
+        if (rs_p->isSync)
+        {
+            rs_p->isSync = CyFalse;
+            rs_p->stats.syncFrames++;
+            rs_p->stats.syncBytes += auLen;
+        }
+    }
+    else if ((features & CY_FX_UVC_RESIL_PARAM_SETS) == 0)
+    {
+        rs_p->count[stream] = 0;
+    }
+    else if (++rs_p->count[stream] >= period)
+    {
+        /* An access unit that the parameter sets do not fit in front of is skipped, and the next one
+           tried. */
+        rs_p->count[stream] = period;
+        if ((paramLen != 0) && (paramLen <= CY_FX_UVC_RESIL_PARAM_MAX) && (paramLen <= room))
+        {
+            rs_p->count[stream] = 0;
+            len = paramLen;
+            rs_p->stats.paramSets++;
+            rs_p->stats.paramSetBytes += len;
+        }
+    }
+
+    rs_p->stats.accessUnits++;
+    rs_p->stats.bytes += len + auLen;
+    return len;
+}
+
+CyBool_t
+CyFxUvcResilSyncDue (
+        CyFxUvcResil_t *rs_p,
+        uint16_t        features,
+        uint32_t        period,
+        uint32_t        elapsed)
+{
+    if ((period != 0) && (elapsed >= period))
+        return CyTrue;
+
+    if (((features & CY_FX_UVC_RESIL_SYNC) != 0) && (elapsed >= CY_FX_UVC_RESIL_SYNC_MS))
+    {
+        rs_p->isSync = CyTrue;
+        return CyTrue;
+    }
+    return CyFalse;
+}
+
+/*[]*/
+
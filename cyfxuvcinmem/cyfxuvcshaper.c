@@ -0,0 +1,218 @@
+/*
+ ## Cypress USB 3.0 Platform source file (cyfxuvcshaper.c)
+ ## ===========================
+ ##
+ ##  Copyright Cypress Semiconductor Corporation, 2010-2023,
+ ##  All Rights Reserved
+ ##  UNPUBLISHED, LICENSED SOFTWARE.
+ ##
+ ##  CONFIDENTIAL AND PROPRIETARY INFORMATION
+ ##  WHICH IS THE PROPERTY OF CYPRESS.
+ ##
+ ##  Use of this file is governed
+ ##  by the license agreement included in the file
+ ##
+ ##     <install>/license/license.txt
+ ##
+ ##  where <install> is the Cypress software
+ ##  installation root directory path.
+ ##
+ ## ===========================
+*/
+
+/* This file implements the token bucket shaper that holds back payload commits to keep the video stream
+   within the limits set through the encoding unit bit rate controls.
+
+   The buckets are filled from the time elapsed since they were last looked at, with the part of a byte
+   earned in each step carried over, so that the long term rate is exact whatever the tick length.
+   A bucket is never shallower than one payload, so that every payload can eventually be sent, nor than
+   the bytes earned in one tick, as the streamer only looks at the buckets once a tick while it waits.
+ */
+
+#include "cyfxuvcshaper.h"
+
+/* Add the bytes earned in ms milliseconds to a bucket. */
+static void
+CyFxUvcBucketFill (
+        CyFxUvcBucket_t *bucket_p,
+        uint32_t         ms)
+{
+    uint64_t credit;
+
+    if (bucket_p->rate == 0)
+    {
+        bucket_p->tokens = bucket_p->depth;
+        return;
+    }
+
+    credit = (uint64_t)bucket_p->rate * ms + bucket_p->residue;
+    bucket_p->residue = (uint32_t)(credit % 1000);
+    credit = credit / 1000 + bucket_p->tokens;
+    if (credit >= bucket_p->depth)
+    {
+        bucket_p->tokens  = bucket_p->depth;
+        bucket_p->residue = 0;
+    }
+    else
+        bucket_p->tokens = (uint32_t)credit;
+}
+
+/* Time in ms until a bucket holds len bytes. */
+static uint32_t
+CyFxUvcBucketWait (
+        const CyFxUvcBucket_t *bucket_p,
+        uint32_t               len)
+{
+    uint64_t need;
+
+    if ((bucket_p->rate == 0) || (bucket_p->tokens >= len))
+        return 0;
+
+    need = (uint64_t)(len - bucket_p->tokens) * 1000 - bucket_p->residue;
+    return (uint32_t)((need + bucket_p->rate - 1) / bucket_p->rate);
+}
+
+/* Bring both buckets up to date. */
+static void
+CyFxUvcShaperFill (
+        CyFxUvcShaper_t *sh_p,
+        uint32_t         now)
+{
+    uint32_t ms = now - sh_p->lastTime;
+
+    if (ms == 0)
+        return;
+    sh_p->lastTime = now;
+    CyFxUvcBucketFill (&sh_p->avg, ms);
+    CyFxUvcBucketFill (&sh_p->peak, ms);
+}
+
+void
+CyFxUvcShaperStart (
+        CyFxUvcShaper_t *sh_p,
+        uint32_t         avgBitRate,
+        uint32_t         peakBitRate,
+        uint32_t         cpbSize,
+        uint32_t         maxPayload,
+        uint32_t         now)
+{
+    sh_p->maxPayload     = maxPayload;
+    sh_p->lastTime       = now;
+    sh_p->isHolding      = CyFalse;
+    sh_p->holdStart      = now;
+    sh_p->startTime      = now;
+    sh_p->bytes          = 0;
+    sh_p->payloads       = 0;
+    sh_p->heldPayloads   = 0;
+    sh_p->heldMs         = 0;
+    sh_p->windowStart    = now;
+    sh_p->windowBytes    = 0;
+    sh_p->maxWindowBytes = 0;
+
+    CyFxUvcShaperSetLimits (sh_p, avgBitRate, peakBitRate, cpbSize, now);
+    sh_p->avg.tokens   = sh_p->avg.depth;
+    sh_p->avg.residue  = 0;
+    sh_p->peak.tokens  = sh_p->peak.depth;
+    sh_p->peak.residue = 0;
+}
+
+void
+CyFxUvcShaperSetLimits (
+        CyFxUvcShaper_t *sh_p,
+        uint32_t         avgBitRate,
+        uint32_t         peakBitRate,
+        uint32_t         cpbSize,
+        uint32_t         now)
+{
+    uint32_t cpbBytes = (uint32_t)CY_U3P_MIN ((uint64_t)cpbSize * CY_FX_UVC_SHAPER_CPB_UNIT, 0xFFFFFFFFu);
+
+    /* Earn the tokens due at the old rates first. */
+    CyFxUvcShaperFill (sh_p, now);
+
+    sh_p->avg.rate   = avgBitRate / 8;
+    sh_p->avg.depth  = CY_U3P_MAX (CY_U3P_MAX (cpbBytes, sh_p->maxPayload), sh_p->avg.rate / 1000);
+    sh_p->avg.tokens = CY_U3P_MIN (sh_p->avg.tokens, sh_p->avg.depth);
+
+    sh_p->peak.rate   = peakBitRate / 8;
+    sh_p->peak.depth  = CY_U3P_MAX (sh_p->maxPayload, sh_p->peak.rate / 1000);
+    sh_p->peak.tokens = CY_U3P_MIN (sh_p->peak.tokens, sh_p->peak.depth);
+}
+
+uint32_t
+CyFxUvcShaperDelay (
+        CyFxUvcShaper_t *sh_p,
+        uint32_t         len,
+        uint32_t         now)
+{
+    uint32_t wait;
+
+    CyFxUvcShaperFill (sh_p, now);
+
+    len  = CY_U3P_MIN (len, sh_p->maxPayload);
+    wait = CY_U3P_MAX (CyFxUvcBucketWait (&sh_p->avg, len), CyFxUvcBucketWait (&sh_p->peak, len));
+    if ((wait != 0) && (!sh_p->isHolding))
+    {
+        sh_p->isHolding = CyTrue;
+        sh_p->holdStart = now;
+    }
+
+    return wait;
+}
+
+void
+CyFxUvcShaperCommit (
+        CyFxUvcShaper_t *sh_p,
+        uint32_t         len,
+        uint32_t         now)
+{
+    CyFxUvcShaperFill (sh_p, now);
+
+    sh_p->avg.tokens  = (sh_p->avg.tokens > len) ? (sh_p->avg.tokens - len) : 0;
+    sh_p->peak.tokens = (sh_p->peak.tokens > len) ? (sh_p->peak.tokens - len) : 0;
+
+    if (sh_p->isHolding)
+    {
+        sh_p->isHolding = CyFalse;
+        sh_p->heldPayloads++;
+        sh_p->heldMs += now - sh_p->holdStart;
+    }
+
+    /* Close the peak measurement windows that have ended. */
+    if ((now - sh_p->windowStart) >= CY_FX_UVC_SHAPER_WINDOW_MS)
+    {
+        sh_p->maxWindowBytes = CY_U3P_MAX (sh_p->maxWindowBytes, sh_p->windowBytes);
+        sh_p->windowStart   += ((now - sh_p->windowStart) / CY_FX_UVC_SHAPER_WINDOW_MS) * CY_FX_UVC_SHAPER_WINDOW_MS;
+        sh_p->windowBytes    = 0;
+    }
+
+    sh_p->windowBytes += len;
+    sh_p->bytes       += len;
+    sh_p->payloads++;
+}
+
+void
+CyFxUvcShaperGetStats (
+        const CyFxUvcShaper_t *sh_p,
+        uint32_t               now,
+        CyFxUvcShaperStats_t  *stats_p)
+{
+    uint32_t i;
+
+    stats_p->elapsedMs    = now - sh_p->startTime;
+    stats_p->avgBitRate   = (stats_p->elapsedMs != 0) ?
+        (uint32_t)CY_U3P_MIN (sh_p->bytes * 8000 / stats_p->elapsedMs, 0xFFFFFFFFu) : 0;
+    stats_p->peakBitRate  = (uint32_t)CY_U3P_MIN ((uint64_t)sh_p->maxWindowBytes * 8000 / CY_FX_UVC_SHAPER_WINDOW_MS,
+            0xFFFFFFFFu);
+    stats_p->avgLimit     = sh_p->avg.rate * 8;
+    stats_p->peakLimit    = sh_p->peak.rate * 8;
+    stats_p->cpbBytes     = sh_p->avg.depth;
+    stats_p->peakBytes    = sh_p->peak.depth;
+    stats_p->payloads     = sh_p->payloads;
+    stats_p->heldPayloads = sh_p->heldPayloads;
+    stats_p->heldMs       = sh_p->heldMs;
+    for (i = 0; i < sizeof (stats_p->reserved) / sizeof (uint32_t); i++)
+        stats_p->reserved[i] = 0;
+}
+
+/*[]*/
+
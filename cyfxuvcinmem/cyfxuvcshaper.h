@@ -0,0 +1,144 @@
+/*
+ ## Cypress USB 3.0 Platform header file (cyfxuvcshaper.h)
+ ## ===========================
+ ##
+ ##  Copyright Cypress Semiconductor Corporation, 2010-2023,
+ ##  All Rights Reserved
+ ##  UNPUBLISHED, LICENSED SOFTWARE.
+ ##
+ ##  CONFIDENTIAL AND PROPRIETARY INFORMATION
+ ##  WHICH IS THE PROPERTY OF CYPRESS.
+ ##
+ ##  Use of this file is governed
+ ##  by the license agreement included in the file
+ ##
+ ##     <install>/license/license.txt
+ ##
+ ##  where <install> is the Cypress software
+ ##  installation root directory path.
+ ##
+ ## ===========================
+*/
+
+/* File: cyfxuvcshaper.h
+ *
+ * Bit rate shaper for the video stream. The streamer asks the shaper before each payload commit how
+ * long the payload has to be held back so that the stream keeps to the average bit rate, peak bit rate
+ * and CPB size set through the encoding unit controls. Two token buckets are used: one filled at the
+ * average bit rate and as deep as the coded picture buffer, so that a frame larger than the average
+ * can go out in one burst as long as the stream makes up for it later; and one filled at the peak bit
+ * rate and one payload (or one ms worth of the peak rate) deep, which spaces out the payloads of such a
+ * burst.
+ *
+ * The limits apply to the bytes on the wire: each payload counts with its UVC payload header, so the host
+ * never receives more than the limits allow. With small payloads the headers take a large share of the
+ * stream. The rate control of the stored streams (cyfxuvcrate.h) therefore counts the headers in the same
+ * way when it picks a quality tier.
+ */
+
+#ifndef _INCLUDED_CYFXUVCSHAPER_H_
+#define _INCLUDED_CYFXUVCSHAPER_H_
+
+#include <cyu3types.h>
+#include <cyu3externcstart.h>
+
+/* Length of the windows over which the achieved peak bit rate is measured, in ms. */
+#define CY_FX_UVC_SHAPER_WINDOW_MS      (100)
+
+/* The CPB size control is given in units of 16 bits. */
+#define CY_FX_UVC_SHAPER_CPB_UNIT       (2)
+
+/* Token bucket: bytes that may be sent now, earned at rate bytes per second up to depth bytes. */
+typedef struct CyFxUvcBucket_t
+{
+    uint32_t rate;                      /* Fill rate in bytes per second, 0 for no limit. */
+    uint32_t depth;                     /* Largest number of tokens in bytes. */
+    uint32_t tokens;                    /* Bytes that may be sent now. */
+    uint32_t residue;                   /* Part of a byte earned, in 1/1000 bytes. */
+} CyFxUvcBucket_t;
+
+/* Bit rate shaper state for one stream. Times are given in ms of the RTOS tick. */
+typedef struct CyFxUvcShaper_t
+{
+    CyFxUvcBucket_t avg;                /* Average bit rate and CPB size. */
+    CyFxUvcBucket_t peak;               /* Peak bit rate, one payload or one ms deep. */
+    uint32_t        maxPayload;         /* Largest payload of the stream in bytes. */
+    uint32_t        lastTime;           /* Time the buckets were last filled. */
+    CyBool_t        isHolding;          /* Whether the next payload is being held back. */
+    uint32_t        holdStart;          /* Time the next payload was first held back. */
+
+    uint32_t        startTime;          /* Time the stream was started. */
+    uint64_t        bytes;              /* Bytes committed since the stream start. */
+    uint32_t        payloads;           /* Payloads committed since the stream start. */
+    uint32_t        heldPayloads;       /* Payloads that had to be held back. */
+    uint32_t        heldMs;             /* Time payloads were held back, in all. */
+    uint32_t        windowStart;        /* Start of the current peak measurement window. */
+    uint32_t        windowBytes;        /* Bytes committed in the current window. */
+    uint32_t        maxWindowBytes;     /* Bytes committed in the busiest complete window. */
+} CyFxUvcShaper_t;
+
+/* Statistics of the shaped stream, as returned by the shaper statistics vendor request. */
+typedef struct CyFxUvcShaperStats_t
+{
+    uint32_t elapsedMs;                 /* Time since the stream start. */
+    uint32_t avgBitRate;                /* Achieved average bit rate since the stream start (bit/s). */
+    uint32_t peakBitRate;               /* Achieved bit rate of the busiest window (bit/s). */
+    uint32_t avgLimit;                  /* Average bit rate limit (bit/s), 0 for none. */
+    uint32_t peakLimit;                 /* Peak bit rate limit (bit/s), 0 for none. */
+    uint32_t cpbBytes;                  /* Depth of the average bit rate bucket in bytes. */
+    uint32_t payloads;                  /* Payloads committed. */
+    uint32_t heldPayloads;              /* Payloads that had to be held back. */
+    uint32_t heldMs;                    /* Time payloads were held back, in all. */
+    uint32_t peakBytes;                 /* Depth of the peak bit rate bucket in bytes. */
+    uint32_t reserved[6];
+} CyFxUvcShaperStats_t;
+
+/* Start shaping a stream of payloads of up to maxPayload bytes with the given limits. Both buckets
+   start full, so the first frame is not held back. */
+extern void
+CyFxUvcShaperStart (
+        CyFxUvcShaper_t *sh_p,
+        uint32_t         avgBitRate,
+        uint32_t         peakBitRate,
+        uint32_t         cpbSize,
+        uint32_t         maxPayload,
+        uint32_t         now);
+
+/* Change the limits of a running stream: average and peak bit rates in bit/s (0 for no limit) and the
+   CPB size in units of 16 bits. The tokens earned so far are kept, up to the new bucket depths. */
+extern void
+CyFxUvcShaperSetLimits (
+        CyFxUvcShaper_t *sh_p,
+        uint32_t         avgBitRate,
+        uint32_t         peakBitRate,
+        uint32_t         cpbSize,
+        uint32_t         now);
+
+/* Get the time in ms for which a payload of len bytes, header included, has to be held back, 0 if it
+   can be committed now. */
+extern uint32_t
+CyFxUvcShaperDelay (
+        CyFxUvcShaper_t *sh_p,
+        uint32_t         len,
+        uint32_t         now);
+
+/* Account for a payload of len bytes, header included, that is being committed. */
+extern void
+CyFxUvcShaperCommit (
+        CyFxUvcShaper_t *sh_p,
+        uint32_t         len,
+        uint32_t         now);
+
+/* Get the statistics of the stream since it was started. */
+extern void
+CyFxUvcShaperGetStats (
+        const CyFxUvcShaper_t *sh_p,
+        uint32_t               now,
+        CyFxUvcShaperStats_t  *stats_p);
+
+#include <cyu3externcend.h>
+
+#endif /* _INCLUDED_CYFXUVCSHAPER_H_ */
+
+/*[]*/
+
@@ -0,0 +1,72 @@
+/*
+ ## Cypress USB 3.0 Platform source file (cyfxuvcslice.c)
+ ## ===========================
+ ##
+ ##  Copyright Cypress Semiconductor Corporation, 2010-2023,
+ ##  All Rights Reserved
+ ##  UNPUBLISHED, LICENSED SOFTWARE.
+ ##
+ ##  CONFIDENTIAL AND PROPRIETARY INFORMATION
+ ##  WHICH IS THE PROPERTY OF CYPRESS.
+ ##
+ ##  Use of this file is governed
+ ##  by the license agreement included in the file
+ ##
+ ##     <install>/license/license.txt
+ ##
+ ##  where <install> is the Cypress software
+ ##  installation root directory path.
+ ##
+ ## ===========================
+*/
+
+/* This file implements the search for NAL unit boundaries used to align the payloads of the stored
+   H.264 and H.265 streams to their slices.
+
+   A NAL unit starts at its start code, 00 00 01, or at the zero_byte in front of it (00 00 00 01).
+   Emulation prevention keeps the pattern out of the NAL units themselves, so the start codes are all
+   that has to be looked for. The search goes backwards from the end of the payload, as the last NAL
+   unit that starts in the payload is the one wanted, and looks at every third byte only: a byte other
+   than 00 or 01 cannot be part of a start code that begins at it or at one of the two bytes before it.
+ */
+
+#include "cyfxuvcslice.h"
+
+uint32_t
+CyFxUvcSliceCut (
+        const uint8_t *au_p,
+        uint32_t       auLen,
+        uint32_t       offset,
+        uint32_t       room)
+{
+    uint32_t end, i, start;
+
+    if (auLen - offset <= room)
+        return auLen - offset;
+
+    /* Look from one byte past the end of the payload down: the zero_byte of a four byte start code found
+       there is the first byte after the payload, which then ends just where that NAL unit starts. */
+    end = offset + room + 1;
+    i   = (auLen > 3) ? CY_U3P_MIN (end, auLen - 3) : 0;
+    while (i > offset)
+    {
+        if (au_p[i] > 1)
+        {
+            i = (i > 3) ? (i - 3) : 0;
+            continue;
+        }
+
+        if ((au_p[i] == 0) && (au_p[i + 1] == 0) && (au_p[i + 2] == 1))
+        {
+            start = (au_p[i - 1] == 0) ? (i - 1) : i;
+            if ((start > offset) && (start < end))
+                return start - offset;
+        }
+        i--;
+    }
+
+    return 0;
+}
+
+/*[]*/
+
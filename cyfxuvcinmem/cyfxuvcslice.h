@@ -0,0 +1,65 @@
+/*
+ ## Cypress USB 3.0 Platform header file (cyfxuvcslice.h)
+ ## ===========================
+ ##
+ ##  Copyright Cypress Semiconductor Corporation, 2010-2023,
+ ##  All Rights Reserved
+ ##  UNPUBLISHED, LICENSED SOFTWARE.
+ ##
+ ##  CONFIDENTIAL AND PROPRIETARY INFORMATION
+ ##  WHICH IS THE PROPERTY OF CYPRESS.
+ ##
+ ##  Use of this file is governed
+ ##  by the license agreement included in the file
+ ##
+ ##     <install>/license/license.txt
+ ##
+ ##  where <install> is the Cypress software
+ ##  installation root directory path.
+ ##
+ ## ===========================
+*/
+
+/* File: cyfxuvcslice.h
+ *
+ * Payload alignment for stored H.264 and H.265 streams. With the payloads aligned, the streamer ends each
+ * payload where a NAL unit starts instead of where the payload buffer is full, so that every NAL unit
+ * (each slice in particular) is either sent whole in one payload or starts a payload of its own. A
+ * payload lost on an isochronous link then costs the host the slices in it rather than the rest of the
+ * frame, as the decoder can find the start of the next slice again.
+ */
+
+#ifndef _INCLUDED_CYFXUVCSLICE_H_
+#define _INCLUDED_CYFXUVCSLICE_H_
+
+#include <cyu3types.h>
+#include <cyu3externcstart.h>
+
+/* wSliceMode values of the slice mode control (UVC 1.5 H.264 payload specification); mode m is reported
+   in bit m of bmSupportedSliceModes. The stored streams have one slice per picture: in the number of
+   slices per frame mode they are sent as they are, and in the target compressed size per slice mode
+   the payloads are aligned to the NAL units. */
+#define CY_FX_UVC_SLICE_MODE_MAX_MBS        (0)     /* Maximum number of macroblocks per slice. */
+#define CY_FX_UVC_SLICE_MODE_SIZE           (1)     /* Target compressed size per slice. */
+#define CY_FX_UVC_SLICE_MODE_SLICES         (2)     /* Number of slices per frame. */
+#define CY_FX_UVC_SLICE_MODE_MB_ROWS        (3)     /* Number of macroblock rows per slice. */
+
+/* Find where the next payload ends in an Annex B access unit of auLen bytes, for a payload that starts
+   at offset and has room bytes of space. Returns the length of the data to send: all the rest of the
+   access unit if it fits, else up to the start code of the last NAL unit that starts in the payload, so
+   that a NAL unit that does not fit behind the ones before it goes to the next payload. Returns 0 if
+   the NAL unit at offset does not end within room bytes and no other one starts there: it is larger
+   than a payload and the caller splits it at room bytes. */
+extern uint32_t
+CyFxUvcSliceCut (
+        const uint8_t *au_p,
+        uint32_t       auLen,
+        uint32_t       offset,
+        uint32_t       room);
+
+#include <cyu3externcend.h>
+
+#endif /* _INCLUDED_CYFXUVCSLICE_H_ */
+
+/*[]*/
+
@@ -0,0 +1,189 @@
+/*
+ ## Cypress USB 3.0 Platform source file (cyfxuvcstatus.c)
+ ## ===========================
+ ##
+ ##  Copyright Cypress Semiconductor Corporation, 2010-2023,
+ ##  All Rights Reserved
+ ##  UNPUBLISHED, LICENSED SOFTWARE.
+ ##
+ ##  CONFIDENTIAL AND PROPRIETARY INFORMATION
+ ##  WHICH IS THE PROPERTY OF CYPRESS.
+ ##
+ ##  Use of this file is governed
+ ##  by the license agreement included in the file
+ ##
+ ##     <install>/license/license.txt
+ ##
+ ##  where <install> is the Cypress software
+ ##  installation root directory path.
+ ##
+ ## ===========================
+*/
+
+/* This file implements the queue of the status packets of the status interrupt endpoint.
+
+   The queue is short and holds at most one event per control and one per interface, so it is kept as
+   a plain array in the order the events came in, searched and closed up by copying. Packets are built
+   only when the endpoint can take one, from the current value of the control, so that the host always
+   gets the latest value and never a stale one queued behind it.
+
+   The caller keeps the firmware threads from using a queue at the same time.
+ */
+
+#include <cyu3error.h>
+#include "cyfxuvcinmem.h"
+#include "cyfxuvcstatus.h"
+
+/* Find the queued event of a control, or of the stream errors of an interface for ctrl_p NULL.
+   Returns CY_FX_UVC_STATUS_QUEUE_LEN if there is none. */
+static uint8_t
+CyFxUvcStatusFind (
+        CyFxUvcStatus_t         *st_p,
+        const CyFxUvcCtrlInfo_t *ctrl_p,
+        uint8_t                  interface)
+{
+    uint8_t i;
+
+    for (i = 0; i < st_p->count; i++)
+    {
+        if ((st_p->event[i].ctrl_p == ctrl_p) && ((ctrl_p != NULL) || (st_p->event[i].interface == interface)))
+            return i;
+    }
+    return CY_FX_UVC_STATUS_QUEUE_LEN;
+}
+
+/* Queue an event, or merge it into the one already queued for the same control or interface. */
+static CyBool_t
+CyFxUvcStatusQueue (
+        CyFxUvcStatus_t         *st_p,
+        const CyFxUvcCtrlInfo_t *ctrl_p,
+        uint8_t                  interface,
+        CyBool_t                 isHeld)
+{
+    CyFxUvcStatusEvent_t *event_p;
+    uint8_t i = CyFxUvcStatusFind (st_p, ctrl_p, interface);
+
+    if (i < CY_FX_UVC_STATUS_QUEUE_LEN)
+    {
+        st_p->merged++;
+        if (isHeld)
+            st_p->event[i].isHeld = CyTrue;
+        return CyTrue;
+    }
+
+    if (st_p->count == CY_FX_UVC_STATUS_QUEUE_LEN)
+    {
+        st_p->dropped++;
+        return CyFalse;
+    }
+
+    event_p = &st_p->event[st_p->count++];
+    event_p->ctrl_p    = ctrl_p;
+    event_p->interface = interface;
+    event_p->isHeld    = isHeld;
+    return CyTrue;
+}
+
+void
+CyFxUvcStatusInit (
+        CyFxUvcStatus_t *st_p)
+{
+    st_p->count   = 0;
+    st_p->sent    = 0;
+    st_p->merged  = 0;
+    st_p->dropped = 0;
+}
+
+CyBool_t
+CyFxUvcStatusControl (
+        CyFxUvcStatus_t         *st_p,
+        const CyFxUvcCtrlInfo_t *ctrl_p,
+        CyBool_t                 isHeld)
+{
+    return CyFxUvcStatusQueue (st_p, ctrl_p, 0, isHeld);
+}
+
+CyBool_t
+CyFxUvcStatusStream (
+        CyFxUvcStatus_t *st_p,
+        uint8_t          interface)
+{
+    return CyFxUvcStatusQueue (st_p, NULL, interface, CyFalse);
+}
+
+CyBool_t
+CyFxUvcStatusIsHeld (
+        CyFxUvcStatus_t         *st_p,
+        const CyFxUvcCtrlInfo_t *ctrl_p)
+{
+    uint8_t i = CyFxUvcStatusFind (st_p, ctrl_p, 0);
+
+    return (CyBool_t)((i < CY_FX_UVC_STATUS_QUEUE_LEN) && (st_p->event[i].isHeld));
+}
+
+void
+CyFxUvcStatusRelease (
+        CyFxUvcStatus_t *st_p,
+        uint8_t          apply)
+{
+    uint8_t i;
+
+    for (i = 0; i < st_p->count; i++)
+    {
+        if ((st_p->event[i].ctrl_p != NULL) && (st_p->event[i].ctrl_p->apply == apply))
+            st_p->event[i].isHeld = CyFalse;
+    }
+}
+
+uint16_t
+CyFxUvcStatusNext (
+        CyFxUvcStatus_t *st_p,
+        uint8_t         *buf_p)
+{
+    CyFxUvcStatusEvent_t event;
+    const uint8_t *code_p;
+    uint16_t len = 0;
+    uint8_t  i, j;
+
+    i = 0;
+    while ((len == 0) && (i < st_p->count))
+    {
+        if (st_p->event[i].isHeld)
+        {
+            i++;
+            continue;
+        }
+
+        event = st_p->event[i];
+        for (j = i + 1; j < st_p->count; j++)
+            st_p->event[j - 1] = st_p->event[j];
+        st_p->count--;
+
+        if (event.ctrl_p != NULL)
+        {
+            buf_p[0] = CY_FX_UVC_STATUS_TYPE_VC;
+            buf_p[1] = event.ctrl_p->unitId;
+            buf_p[2] = CY_FX_UVC_STATUS_EVENT_CONTROL;
+            buf_p[3] = event.ctrl_p->selector;
+            buf_p[4] = CY_FX_UVC_STATUS_ATTR_VALUE;
+            for (j = 0; j < event.ctrl_p->length; j++)
+                buf_p[5 + j] = event.ctrl_p->cur_p[j];
+            len = 5 + event.ctrl_p->length;
+        }
+        else
+        {
+            CyFxUvcCtrlErrorGet (CY_FX_UVC_CTRL_ERROR_STREAM, CY_FX_USB_UVC_GET_CUR_REQ, &code_p, &len);
+            buf_p[0] = CY_FX_UVC_STATUS_TYPE_VS;
+            buf_p[1] = event.interface;
+            buf_p[2] = *code_p;
+            len = (*code_p != CY_FX_UVC_STREAM_ERR_NONE) ? 3 : 0;
+        }
+    }
+
+    if (len != 0)
+        st_p->sent++;
+    return len;
+}
+
+/*[]*/
+
@@ -31,12 +31,23 @@
  *
  * This file has been updated with some new features related to memory leak and corruption
  * detection. These changes are only enabled when compiling with SDK versions 1.3.3 and later.
+ *
+ * The memory map (driver heap and buffer area bounds) is selected through the memory map profiles
+ * defined in cyfxtx.h.
+ *
+ * The CyU3PMemCorruptionCheckStep and CyU3PBufCorruptionCheckStep functions provide an incremental
+ * version of the corruption checks that can be run from a low priority thread while streaming.
+ *
+ * Both allocators keep usage statistics (current and peak usage, allocation counts and failed
+ * allocations) that can be read at runtime using the CyU3PMemGetStats and CyU3PBufGetStats functions.
  */
 
 #include <cyu3os.h>
+#include <cyu3vic.h>
 #include <cyu3utils.h>
 #include <cyu3error.h>
 #include <cyfxversion.h>
+#include "cyfxtx.h"
 
 /* Memory error detection is supported in SDK 1.3.3 and later. */
 #if ((CYFX_VERSION_MINOR > 3) || ((CYFX_VERSION_MINOR == 3) && (CYFX_VERSION_PATCH >= 3)))
@@ -45,79 +56,6 @@
 #undef CYFXTX_ERRORDETECTION
 #endif
 
-#ifdef CYMEM_256K
-
-/*
-   A reduced memory map is used with the CYUSB3011/CYUSB3012 devices:
-
-   Descriptor area    Base: 0x40000000 Size: 12  KB
-   Code area          Base: 0x40003000 Size: 128 KB
-   Data area          Base: 0x40023000 Size: 24  KB
-   Driver heap        Base: 0x40029000 Size: 28  KB
-   Buffer area        Base: 0x40030000 Size: 32  KB
-   2-stage boot area  Base: 0x40038000 Size: 32  KB
-
-   Note: The 2-stage boot area is optional (only required if the application makes use of a persistent
-   in-memory boot-loader). If this is not being used, the 32 KB reserved for this segment can be merged
-   into the buffer area by changing CY_U3P_SYS_MEM_TOP to 0x40040000.
- */
-
-/*
-   The following definitions specify the start address and length of the Driver heap
-   area which is used by the application code as well as the drivers to allocate thread
-   stacks and other internal data structures.
- */
-#define CY_U3P_MEM_HEAP_BASE         (0x40029000)
-#define CY_U3P_MEM_HEAP_SIZE         (0x7000)
-
-/*
-   The last 32 KB of RAM is reserved for 2-stage boot operation. This value can be
-   changed to 0x40040000 if 2-stage boot is not used by the application.
- */
-#define CY_U3P_SYS_MEM_TOP           (0x40038000)
-
-#else /* 512 KB RAM is available. */
-
-/*
-   The default application memory map for FX3 firmware is as follows:
-
-   Descriptor area    Base: 0x40000000 Size: 12  KB
-   Code area          Base: 0x40003000 Size: 180 KB
-   Data area          Base: 0x40030000 Size: 32  KB
-   Driver heap        Base: 0x40038000 Size: 32  KB
-   Buffer area        Base: 0x40040000 Size: 224 KB
-   2-stage boot area  Base: 0x40078000 Size: 32  KB
-
-   Note: The 2-stage boot area is optional (only required if the application makes use of a persistent
-   in-memory boot-loader). If this is not being used, the 32 KB reserved for this segment can be merged
-   into the buffer area by changing CY_U3P_SYS_MEM_TOP to 0x40080000.
- */
-
-/*
-   The following definitions specify the start address and length of the Driver heap
-   area which is used by the application code as well as the drivers to allocate thread
-   stacks and other internal data structures.
- */
-#define CY_U3P_MEM_HEAP_BASE         (0x40038000)
-#define CY_U3P_MEM_HEAP_SIZE         (0x8000)
-
-/*
-   The last 32 KB of RAM is reserved for 2-stage boot operation. This value can be
-   changed to 0x40080000 if 2-stage boot is not used by the application.
- */
-#define CY_U3P_SYS_MEM_TOP           (0x40078000)
-
-#endif
-
-/*
-   The buffer heap is used to obtain data buffers for DMA transfers in or out of
-   the FX3 device. The reference implementation of the buffer allocator makes use
-   of a reserved area in the SYSTEM RAM and ensures that all allocated DMA buffers
-   are aligned to cache lines.
- */
-#define CY_U3P_BUFFER_HEAP_BASE         (CY_U3P_MEM_HEAP_BASE + CY_U3P_MEM_HEAP_SIZE)
-#define CY_U3P_BUFFER_HEAP_SIZE         ((CY_U3P_SYS_MEM_TOP) - (CY_U3P_BUFFER_HEAP_BASE))
-
 #define CY_U3P_BUFFER_ALLOC_TIMEOUT     (10)
 #define CY_U3P_MEM_ALLOC_TIMEOUT        (10)
 
@@ -128,12 +66,12 @@
 #define ROUND_UP(s, n)                  (((s) + (n) - 1) & (~(n - 1)))
 /* Convert size from BYTE to DWORD. */
 #define BYTE_TO_DWORD(s)                ((s) >> 2)
-/* Cache line size for FX3. */
-#define FX3_CACHE_LINE_SZ               (32)
 
 static CyBool_t         glMemPoolInit   = CyFalse;              /* Whether the memory allocator has been initialized. */
 static CyU3PBytePool    glMemBytePool;                          /* ThreadX Byte pool used in the CyU3PMem* functions. */
 static CyU3PDmaBufMgr_t glBufferManager = {{0}, 0, 0, 0, 0, 0}; /* Buffer manager used in the buffer alloc functions. */
+static CyU3PHeapStats_t glMemStats;                             /* Usage statistics for the driver heap. */
+static CyU3PHeapStats_t glBufStats;                             /* Usage statistics for the buffer heap. */
 
 #ifdef CYFXTX_ERRORDETECTION
 
@@ -146,6 +84,8 @@ static uint32_t         glMemAllocCnt     = 0;                  /* Number of all
 static uint32_t         glMemFreeCnt      = 0;                  /* Number of free operations performed. */
 static MemBlockInfo    *glMemInUseList    = 0;                  /* List of all memory blocks in use. */
 static CyU3PMemCorruptCallback glMemBadCb = 0;                  /* Callback for notification of corrupted memory. */
+static MemBlockInfo    *glMemScanPos      = 0;                  /* Next block to be checked by the incremental scan. */
+static CyBool_t         glMemScanFailed   = CyFalse;            /* Whether the incremental scan has found corruption. */
 
 /*
    Debug variables used for doing memory leak and corruption checks around buffers allocated through
@@ -156,6 +96,8 @@ static uint32_t         glBufAllocCnt        = 0;               /* Number of all
 static uint32_t         glBufFreeCnt         = 0;               /* Number of free operations performed. */
 static MemBlockInfo    *glBufInUseList       = 0;               /* List of all memory blocks in use. */
 static CyU3PMemCorruptCallback glBufBadCb    = 0;               /* Callback for notification of corrupted memory. */
+static MemBlockInfo    *glBufScanPos         = 0;               /* Next block to be checked by the incremental scan. */
+static CyBool_t         glBufScanFailed      = CyFalse;         /* Whether the incremental scan has found corruption. */
 
 #endif
 
@@ -268,6 +210,61 @@ CyU3PMemEnableChecks (
 
 #endif
 
+/* Function    : CyU3PHeapStatsUpdate
+ * Description : Helper function used by the alloc functions to update the heap statistics
+ *               at the end of each allocation call. The allocators are called from several
+ *               threads and from interrupt context, so the statistics are only updated with
+ *               the interrupts disabled.
+ * Parameters  :
+ *               stats_p   : Statistics structure to be updated.
+ *               size      : Size of memory requested in bytes.
+ *               success   : Whether the allocation succeeded.
+ *               used      : Memory in use after a successful allocation.
+ */
+static void
+CyU3PHeapStatsUpdate (
+        CyU3PHeapStats_t *stats_p,
+        uint32_t          size,
+        CyBool_t          success,
+        uint32_t          used)
+{
+    uint32_t intMask;
+
+    intMask = CyU3PVicDisableAllInterrupts ();
+    if (success)
+    {
+        stats_p->allocCount++;
+        stats_p->curUsed = used;
+        if (used > stats_p->peakUsed)
+            stats_p->peakUsed = used;
+    }
+    else
+    {
+        stats_p->failCount++;
+        stats_p->lastFailSize = size;
+    }
+    CyU3PVicEnableInterrupts (intMask);
+}
+
+/* Function    : CyU3PHeapStatsFree
+ * Description : Helper function used by the free functions to update the heap statistics.
+ * Parameters  :
+ *               stats_p   : Statistics structure to be updated.
+ *               used      : Memory in use after the free call.
+ */
+static void
+CyU3PHeapStatsFree (
+        CyU3PHeapStats_t *stats_p,
+        uint32_t          used)
+{
+    uint32_t intMask;
+
+    intMask = CyU3PVicDisableAllInterrupts ();
+    stats_p->freeCount++;
+    stats_p->curUsed = used;
+    CyU3PVicEnableInterrupts (intMask);
+}
+
 /* Function    : CyU3PMemInit
  * Description : This function initializes the custom heap for OS specific dynamic
  *               memory allocation.
@@ -286,6 +283,9 @@ CyU3PMemInit (
     {
 	glMemPoolInit = CyTrue;
 	CyU3PBytePoolCreate (&glMemBytePool, (void *)CY_U3P_MEM_HEAP_BASE, CY_U3P_MEM_HEAP_SIZE);
+
+	CyU3PMemSet ((uint8_t *)&glMemStats, 0, sizeof (glMemStats));
+	glMemStats.heapSize = CY_U3P_MEM_HEAP_SIZE;
     }
 }
 
@@ -306,6 +306,7 @@ CyU3PMemAlloc (
 {
     void         *ret_p;
     uint32_t      status;
+    uint32_t      reqSize = size;
 
 #ifdef CYFXTX_ERRORDETECTION
     MemBlockInfo *block_p;
@@ -330,6 +331,10 @@ CyU3PMemAlloc (
         status = CyU3PByteAlloc (&glMemBytePool, (void **)&ret_p, size, CYU3P_NO_WAIT);
     }
 
+    /* The byte pool keeps track of the free space including its own block overheads. */
+    CyU3PHeapStatsUpdate (&glMemStats, reqSize, (status == CY_U3P_SUCCESS),
+            CY_U3P_MEM_HEAP_SIZE - glMemBytePool.tx_byte_pool_available);
+
     if (status == CY_U3P_SUCCESS)
     {
 #ifdef CYFXTX_ERRORDETECTION
@@ -395,6 +400,10 @@ CyU3PMemFree (
 
         glMemFreeCnt++;
 
+        /* Move the incremental scan past the block being freed. */
+        if (glMemScanPos == block_p)
+            glMemScanPos = block_p->prev_blk;
+
         /* Update the in-use linked list to drop the freed-up block. */
         if (block_p->next_blk != 0)
             block_p->next_blk->prev_blk = block_p->prev_blk;
@@ -410,6 +419,7 @@ CyU3PMemFree (
 #endif
 
     CyU3PByteFree (mem_p);
+    CyU3PHeapStatsFree (&glMemStats, CY_U3P_MEM_HEAP_SIZE - glMemBytePool.tx_byte_pool_available);
 }
 
 #ifdef CYFXTX_ERRORDETECTION
@@ -493,6 +503,98 @@ CyU3PMemCorruptionCheck (
     return CY_U3P_SUCCESS;
 }
 
+/* Function     : CyU3PMemBlockCheck
+ * Description  : Helper function for the incremental corruption checks. Verifies the start
+ *                and end signatures of a block, and that the link to the next block to be
+ *                checked points into the same heap.
+ * Parameters   :
+ *                block_p : Block to be checked.
+ *                base    : Start address of the heap.
+ *                top     : End address of the heap.
+ * Return Value : CyTrue if the block is valid, CyFalse otherwise.
+ */
+static CyBool_t
+CyU3PMemBlockCheck (
+        MemBlockInfo *block_p,
+        uint32_t      base,
+        uint32_t      top)
+{
+    uint32_t *mem_p;
+
+    if (((uint32_t)block_p < base) || ((uint32_t)block_p >= top) || (block_p->alloc_size > (top - (uint32_t)block_p)))
+        return CyFalse;
+
+    mem_p = (uint32_t *)((uint8_t *)block_p + block_p->alloc_size - sizeof (uint32_t));
+    if ((block_p->start_sig != CY_U3P_MEM_START_SIG) || (*mem_p != CY_U3P_MEM_END_SIG))
+        return CyFalse;
+
+    if ((block_p->prev_blk != 0) && (((uint32_t)block_p->prev_blk < base) || ((uint32_t)block_p->prev_blk >= top)))
+        return CyFalse;
+
+    return CyTrue;
+}
+
+/* Function     : CyU3PMemCorruptionCheckStep
+ * Description  : Incremental version of CyU3PMemCorruptionCheck. Checks at most maxBlocks
+ *                in-use memory blocks per call, and remembers its position in the in-use
+ *                list across calls. Each call stops at the end of the list, and the next
+ *                call starts a new pass from the head of the list.
+ *                Interrupts are disabled only while a single block is being checked, so
+ *                that this can be called periodically from a low priority thread while
+ *                the application is running.
+ *                The registered bad memory callback is called for the first corrupted block
+ *                found. Once corruption has been found, the list is not accessed any more
+ *                and all further calls return an error.
+ * Parameters   :
+ *                maxBlocks : Maximum number of blocks to be checked in this call.
+ * Return Value : CY_U3P_SUCCESS if no corruption has been found so far.
+ *                CY_U3P_ERROR_FAILURE if corruption has been detected.
+ */
+CyU3PReturnStatus_t
+CyU3PMemCorruptionCheckStep (
+        uint32_t maxBlocks)
+{
+    MemBlockInfo *block_p;
+    CyBool_t      isValid;
+    uint32_t      intMask;
+
+    while ((maxBlocks != 0) && (!glMemScanFailed))
+    {
+        intMask = CyU3PVicDisableAllInterrupts ();
+
+        /* Start a new pass from the head of the list if the previous one has completed. */
+        block_p = (glMemScanPos != 0) ? glMemScanPos : glMemInUseList;
+        if (block_p == 0)
+        {
+            CyU3PVicEnableInterrupts (intMask);
+            break;
+        }
+
+        isValid = CyU3PMemBlockCheck (block_p, CY_U3P_MEM_HEAP_BASE, CY_U3P_BUFFER_HEAP_BASE);
+        if (isValid)
+            glMemScanPos = block_p->prev_blk;
+        else
+            glMemScanFailed = CyTrue;
+
+        CyU3PVicEnableInterrupts (intMask);
+
+        if (!isValid)
+        {
+            if (glMemBadCb != 0)
+                glMemBadCb ((void *)((uint8_t *)block_p + sizeof (MemBlockInfo)));
+            break;
+        }
+
+        /* Stop at the end of the current pass. */
+        if (glMemScanPos == 0)
+            break;
+
+        maxBlocks--;
+    }
+
+    return (glMemScanFailed) ? CY_U3P_ERROR_FAILURE : CY_U3P_SUCCESS;
+}
+
 #endif
 
 /* Function     : CyU3PMemSet
@@ -742,6 +844,9 @@ CyU3PDmaBufferInit (
     glBufferManager.regionSize = CY_U3P_BUFFER_HEAP_SIZE;
     glBufferManager.statusSize = size;
     glBufferManager.searchPos  = 0;
+
+    CyU3PMemSet ((uint8_t *)&glBufStats, 0, sizeof (glBufStats));
+    glBufStats.heapSize = CY_U3P_BUFFER_HEAP_SIZE;
 }
 
 /* Function    : CyU3PDmaBufferDeInit
@@ -780,9 +885,11 @@ CyU3PDmaBufferDeInit (
 
 #ifdef CYFXTX_ERRORDETECTION
     /* Clear status tracking variables. */
-    glBufAllocCnt  = 0;
-    glBufFreeCnt   = 0;
-    glBufInUseList = 0;
+    glBufAllocCnt   = 0;
+    glBufFreeCnt    = 0;
+    glBufInUseList  = 0;
+    glBufScanPos    = 0;
+    glBufScanFailed = CyFalse;
 #endif
 
     /* Free up and destroy the mutex variable. */
@@ -875,6 +982,7 @@ CyU3PDmaBufferAlloc (
 
     if (tmp != CY_U3P_SUCCESS)
     {
+        CyU3PHeapStatsUpdate (&glBufStats, blk_size, CyFalse, 0);
         return ptr;
     }
 
@@ -972,6 +1080,10 @@ CyU3PDmaBufferAlloc (
 #endif
     }
 
+    /* The block occupies size cache lines, including the last line that is left unmarked. The usage
+       only changes with the buffer manager lock held, so it can be read here. */
+    CyU3PHeapStatsUpdate (&glBufStats, blk_size, (ptr != 0), glBufStats.curUsed + (size * FX3_CACHE_LINE_SZ));
+
     CyU3PMutexPut (&glBufferManager.lock);
     return (ptr);
 }
@@ -1029,6 +1141,10 @@ CyU3PDmaBufferFree (
 
         glBufFreeCnt++;
 
+        /* Move the incremental scan past the block being freed. */
+        if (glBufScanPos == block_p)
+            glBufScanPos = block_p->prev_blk;
+
         /* Update the in-use linked list to drop the freed-up block. */
         if (block_p->next_blk != 0)
             block_p->next_blk->prev_blk = block_p->prev_blk;
@@ -1067,6 +1183,10 @@ CyU3PDmaBufferFree (
 
         CyU3PDmaBufMgrSetStatus (start, count, CyFalse);
 
+        /* count excludes the unmarked last line of the block. */
+        if (count != 0)
+            CyU3PHeapStatsFree (&glBufStats, glBufStats.curUsed - ((count + 1) * FX3_CACHE_LINE_SZ));
+
         /* Start the next buffer search at the top of the heap. This can help reduce fragmentation in cases where
            most of the heap is allocated and then freed as a whole. */
         glBufferManager.searchPos = 0;
@@ -1093,12 +1213,16 @@ CyU3PFreeHeaps (
 
     CyU3PBytePoolDestroy (&glMemBytePool);
     glMemPoolInit = CyFalse;
+    CyU3PMemSet ((uint8_t *)&glMemStats, 0, sizeof (glMemStats));
+    CyU3PMemSet ((uint8_t *)&glBufStats, 0, sizeof (glBufStats));
 
 #ifdef CYFXTX_ERRORDETECTION
     /* Clear status tracking variables. */
-    glMemAllocCnt  = 0;
-    glMemFreeCnt   = 0;
-    glMemInUseList = 0;
+    glMemAllocCnt   = 0;
+    glMemFreeCnt    = 0;
+    glMemInUseList  = 0;
+    glMemScanPos    = 0;
+    glMemScanFailed = CyFalse;
 #endif
 }
 
@@ -1181,7 +1305,111 @@ CyU3PBufCorruptionCheck (
     return CY_U3P_SUCCESS;
 }
 
+/* Function     : CyU3PBufCorruptionCheckStep
+ * Description  : Incremental version of CyU3PBufCorruptionCheck. Checks at most maxBlocks
+ *                in-use buffers per call, and remembers its position in the in-use list
+ *                across calls. Each call stops at the end of the list, and the next call
+ *                starts a new pass from the head of the list.
+ *                The buffer manager lock is held while the blocks are checked. If the lock
+ *                cannot be obtained, no blocks are checked in this call.
+ *                The registered bad memory callback is called for the first corrupted block
+ *                found. Once corruption has been found, the list is not accessed any more
+ *                and all further calls return an error.
+ * Parameters   :
+ *                maxBlocks : Maximum number of blocks to be checked in this call.
+ * Return Value : CY_U3P_SUCCESS if no corruption has been found so far.
+ *                CY_U3P_ERROR_FAILURE if corruption has been detected.
+ */
+CyU3PReturnStatus_t
+CyU3PBufCorruptionCheckStep (
+        uint32_t maxBlocks)
+{
+    MemBlockInfo *block_p = 0;
+
+    if ((glBufScanFailed) || (CyU3PThreadIdentify () == 0) ||
+            (CyU3PMutexGet (&glBufferManager.lock, CY_U3P_BUFFER_ALLOC_TIMEOUT) != CY_U3P_SUCCESS))
+    {
+        return (glBufScanFailed) ? CY_U3P_ERROR_FAILURE : CY_U3P_SUCCESS;
+    }
+
+    while (maxBlocks != 0)
+    {
+        /* Start a new pass from the head of the list if the previous one has completed. */
+        block_p = (glBufScanPos != 0) ? glBufScanPos : glBufInUseList;
+        if (block_p == 0)
+            break;
+
+        if (!CyU3PMemBlockCheck (block_p, CY_U3P_BUFFER_HEAP_BASE, CY_U3P_SYS_MEM_TOP))
+        {
+            glBufScanFailed = CyTrue;
+            break;
+        }
+
+        /* Stop at the end of the current pass. */
+        glBufScanPos = block_p->prev_blk;
+        if (glBufScanPos == 0)
+            break;
+
+        maxBlocks--;
+    }
+
+    CyU3PMutexPut (&glBufferManager.lock);
+
+    if (glBufScanFailed)
+    {
+        if (glBufBadCb != 0)
+            glBufBadCb ((void *)((uint8_t *)block_p + sizeof (MemBlockInfo)));
+        return CY_U3P_ERROR_FAILURE;
+    }
+
+    return CY_U3P_SUCCESS;
+}
+
 #endif
 
+/* Function     : CyU3PMemGetStats
+ * Description  : Get a snapshot of the driver heap usage statistics. The current usage is
+ *                read from the byte pool, and includes the byte pool block overheads.
+ * Parameters   :
+ *                stats_p : Structure to be filled with the statistics.
+ * Return Value : None
+ */
+void
+CyU3PMemGetStats (
+        CyU3PHeapStats_t *stats_p)
+{
+    uint32_t intMask;
+
+    if (stats_p == 0)
+        return;
+
+    intMask = CyU3PVicDisableAllInterrupts ();
+    if (glMemPoolInit)
+        glMemStats.curUsed = CY_U3P_MEM_HEAP_SIZE - glMemBytePool.tx_byte_pool_available;
+    CyU3PMemCopy ((uint8_t *)stats_p, (uint8_t *)&glMemStats, sizeof (CyU3PHeapStats_t));
+    CyU3PVicEnableInterrupts (intMask);
+}
+
+/* Function     : CyU3PBufGetStats
+ * Description  : Get a snapshot of the buffer heap usage statistics. The current usage counts
+ *                whole cache lines, including the guard line left after each buffer.
+ * Parameters   :
+ *                stats_p : Structure to be filled with the statistics.
+ * Return Value : None
+ */
+void
+CyU3PBufGetStats (
+        CyU3PHeapStats_t *stats_p)
+{
+    uint32_t intMask;
+
+    if (stats_p == 0)
+        return;
+
+    intMask = CyU3PVicDisableAllInterrupts ();
+    CyU3PMemCopy ((uint8_t *)stats_p, (uint8_t *)&glBufStats, sizeof (CyU3PHeapStats_t));
+    CyU3PVicEnableInterrupts (intMask);
+}
+
 /*[]*/
 
@@ -0,0 +1,211 @@
+/*
+ ## Cypress FX3 Firmware Header File (cyfxtx.h)
+ ## ===========================
+ ##
+ ##  Copyright Cypress Semiconductor Corporation, 2010-2023,
+ ##  All Rights Reserved
+ ##  UNPUBLISHED, LICENSED SOFTWARE.
+ ##
+ ##  CONFIDENTIAL AND PROPRIETARY INFORMATION
+ ##  WHICH IS THE PROPERTY OF CYPRESS.
+ ##
+ ##  Use of this file is governed
+ ##  by the license agreement included in the file
+ ##
+ ##     <install>/license/license.txt
+ ##
+ ##  where <install> is the Cypress software
+ ##  installation root directory path.
+ ##
+ ## ===========================
+*/
+
+/* File: cyfxtx.h
+ *
+ * Memory map definitions used by the allocators in cyfxtx.c. These are placed in a header so that
+ * the application can size its DMA buffers against the buffer area that is actually available.
+ */
+
+#ifndef _INCLUDED_CYFXTX_H_
+#define _INCLUDED_CYFXTX_H_
+
+#include <cyu3types.h>
+#include <cyu3externcstart.h>
+
+/*
+   Memory map profiles. The profile is selected at build time by defining CYFX_MEMMAP_PROFILE
+   (see the CYFXMEMMAP option in the makefile). If no profile is specified, the 256 KB profile is
+   used when CYMEM_256K is defined and the standard profile otherwise.
+
+   CYFX_MEMMAP_STANDARD      : 512 KB device. The top 32 KB of RAM is reserved for 2-stage boot.
+   CYFX_MEMMAP_NO_BOOTLOADER : 512 KB device. The 2-stage boot area is merged into the buffer area.
+   CYFX_MEMMAP_256K          : CYUSB3011/CYUSB3012 devices. The top 32 KB of RAM is reserved for
+                               2-stage boot.
+ */
+#define CYFX_MEMMAP_STANDARD            (0)
+#define CYFX_MEMMAP_NO_BOOTLOADER       (1)
+#define CYFX_MEMMAP_256K                (2)
+
+#ifndef CYFX_MEMMAP_PROFILE
+#ifdef CYMEM_256K
+#define CYFX_MEMMAP_PROFILE             CYFX_MEMMAP_256K
+#else
+#define CYFX_MEMMAP_PROFILE             CYFX_MEMMAP_STANDARD
+#endif
+#endif
+
+#if (CYFX_MEMMAP_PROFILE == CYFX_MEMMAP_256K)
+
+#ifndef CYMEM_256K
+#error "CYFX_MEMMAP_256K requires the 256 KB device build (CYMEM_256K)."
+#endif
+
+/*
+   A reduced memory map is used with the CYUSB3011/CYUSB3012 devices:
+
+   Descriptor area    Base: 0x40000000 Size: 12  KB
+   Code area          Base: 0x40003000 Size: 128 KB
+   Data area          Base: 0x40023000 Size: 24  KB
+   Driver heap        Base: 0x40029000 Size: 28  KB
+   Buffer area        Base: 0x40030000 Size: 32  KB
+   2-stage boot area  Base: 0x40038000 Size: 32  KB
+ */
+#define CY_U3P_MEM_HEAP_BASE            (0x40029000)
+#define CY_U3P_MEM_HEAP_SIZE            (0x7000)
+#define CY_U3P_SYS_MEM_TOP              (0x40038000)
+#define CY_U3P_SYS_MEM_END              (0x40040000)
+
+#elif (CYFX_MEMMAP_PROFILE == CYFX_MEMMAP_NO_BOOTLOADER)
+
+#ifdef CYMEM_256K
+#error "CYFX_MEMMAP_NO_BOOTLOADER is only valid for 512 KB devices."
+#endif
+
+/*
+   Memory map for applications that do not use a persistent 2-stage boot-loader. The 32 KB that is
+   normally reserved for it at the top of RAM becomes part of the buffer area:
+
+   Descriptor area    Base: 0x40000000 Size: 12  KB
+   Code area          Base: 0x40003000 Size: 180 KB
+   Data area          Base: 0x40030000 Size: 32  KB
+   Driver heap        Base: 0x40038000 Size: 32  KB
+   Buffer area        Base: 0x40040000 Size: 256 KB
+ */
+#define CY_U3P_MEM_HEAP_BASE            (0x40038000)
+#define CY_U3P_MEM_HEAP_SIZE            (0x8000)
+#define CY_U3P_SYS_MEM_TOP              (0x40080000)
+#define CY_U3P_SYS_MEM_END              (0x40080000)
+
+#elif (CYFX_MEMMAP_PROFILE == CYFX_MEMMAP_STANDARD)
+
+#ifdef CYMEM_256K
+#error "CYFX_MEMMAP_STANDARD is only valid for 512 KB devices. Use CYFX_MEMMAP_256K."
+#endif
+
+/*
+   The default application memory map for FX3 firmware is as follows:
+
+   Descriptor area    Base: 0x40000000 Size: 12  KB
+   Code area          Base: 0x40003000 Size: 180 KB
+   Data area          Base: 0x40030000 Size: 32  KB
+   Driver heap        Base: 0x40038000 Size: 32  KB
+   Buffer area        Base: 0x40040000 Size: 224 KB
+   2-stage boot area  Base: 0x40078000 Size: 32  KB
+ */
+#define CY_U3P_MEM_HEAP_BASE            (0x40038000)
+#define CY_U3P_MEM_HEAP_SIZE            (0x8000)
+#define CY_U3P_SYS_MEM_TOP              (0x40078000)
+#define CY_U3P_SYS_MEM_END              (0x40080000)
+
+#else
+#error "Unknown CYFX_MEMMAP_PROFILE selected."
+#endif
+
+/*
+   The buffer heap is used to obtain data buffers for DMA transfers in or out of
+   the FX3 device. It occupies all memory between the end of the driver heap and
+   CY_U3P_SYS_MEM_TOP.
+ */
+#define CY_U3P_BUFFER_HEAP_BASE         (CY_U3P_MEM_HEAP_BASE + CY_U3P_MEM_HEAP_SIZE)
+#define CY_U3P_BUFFER_HEAP_SIZE         ((CY_U3P_SYS_MEM_TOP) - (CY_U3P_BUFFER_HEAP_BASE))
+
+/* Size of the 2-stage boot area that is still reserved at the top of RAM. */
+#define CY_U3P_BOOT_AREA_SIZE           ((CY_U3P_SYS_MEM_END) - (CY_U3P_SYS_MEM_TOP))
+
+/* Amount of buffer area gained over the standard memory map of the same device. */
+#define CY_U3P_BUFFER_HEAP_RECLAIMED    (0x8000 - CY_U3P_BOOT_AREA_SIZE)
+
+/* Cache line size for FX3. */
+#define FX3_CACHE_LINE_SZ               (32)
+
+/*
+   Amount of buffer area consumed by one CyU3PDmaBufferAlloc call of the given size. The allocator
+   rounds every request up to whole cache lines and leaves one free line after each buffer.
+ */
+#define CY_U3P_BUFFER_FOOTPRINT(s)      (((((s) + FX3_CACHE_LINE_SZ - 1) / FX3_CACHE_LINE_SZ) + 1) * FX3_CACHE_LINE_SZ)
+
+/*
+   Part of the buffer area that is kept free for buffers allocated by the SDK drivers themselves
+   (debug logging, USB control endpoint and serial peripheral channels).
+ */
+#define CY_U3P_BUFFER_HEAP_SDK_RESERVE  (0x3000)
+
+/* Compile time check. Fails the build with a negative array size if cond is false. */
+#define CY_U3P_STATIC_ASSERT(cond,tag)  typedef char cyu3p_static_assert_##tag[(cond) ? 1 : -1]
+
+/* Checks that the selected memory map is self consistent. */
+CY_U3P_STATIC_ASSERT ((CY_U3P_MEM_HEAP_SIZE >= 0x5000), mem_heap_min_size);
+CY_U3P_STATIC_ASSERT (((CY_U3P_MEM_HEAP_BASE & (FX3_CACHE_LINE_SZ - 1)) == 0), mem_heap_aligned);
+CY_U3P_STATIC_ASSERT (((CY_U3P_BUFFER_HEAP_BASE & (FX3_CACHE_LINE_SZ - 1)) == 0), buf_heap_aligned);
+CY_U3P_STATIC_ASSERT ((CY_U3P_SYS_MEM_TOP <= CY_U3P_SYS_MEM_END), sys_mem_top_in_ram);
+CY_U3P_STATIC_ASSERT ((CY_U3P_BUFFER_HEAP_SIZE > CY_U3P_BUFFER_HEAP_SDK_RESERVE), buf_heap_min_size);
+
+/*
+   Usage statistics maintained by the driver heap (CyU3PMemAlloc) and buffer heap (CyU3PDmaBufferAlloc)
+   allocators. These are always collected, independent of whether the leak and corruption checks are
+   enabled. All sizes are in bytes and include the allocator overheads (block headers, cache line
+   rounding and guard lines), so that they can be compared directly against the heap size.
+
+   The structure only contains 32-bit fields so that it can be returned to the host as is.
+ */
+typedef struct CyU3PHeapStats_t
+{
+    uint32_t heapSize;          /* Total size of the heap. */
+    uint32_t curUsed;           /* Memory currently allocated. */
+    uint32_t peakUsed;          /* High-water mark of curUsed since the heap was initialized. */
+    uint32_t allocCount;        /* Number of successful allocation calls. */
+    uint32_t freeCount;         /* Number of free calls. */
+    uint32_t failCount;         /* Number of allocation calls that failed. */
+    uint32_t lastFailSize;      /* Size requested by the last failed allocation call. */
+} CyU3PHeapStats_t;
+
+/* Get a snapshot of the driver heap usage statistics. */
+extern void
+CyU3PMemGetStats (
+        CyU3PHeapStats_t *stats_p);
+
+/* Get a snapshot of the buffer heap usage statistics. */
+extern void
+CyU3PBufGetStats (
+        CyU3PHeapStats_t *stats_p);
+
+/* Check up to maxBlocks in-use driver heap blocks for corruption, continuing from where the previous
+   call stopped. Only available when the memory leak and corruption checks are supported (SDK 1.3.3
+   and later) and have been enabled using CyU3PMemEnableChecks. */
+extern CyU3PReturnStatus_t
+CyU3PMemCorruptionCheckStep (
+        uint32_t maxBlocks);
+
+/* Check up to maxBlocks in-use buffer heap blocks for corruption, continuing from where the previous
+   call stopped. Only available when the memory leak and corruption checks are supported (SDK 1.3.3
+   and later) and have been enabled using CyU3PBufEnableChecks. */
+extern CyU3PReturnStatus_t
+CyU3PBufCorruptionCheckStep (
+        uint32_t maxBlocks);
+
+#include <cyu3externcend.h>
+
+#endif /* _INCLUDED_CYFXTX_H_ */
+
+/*[]*/
+
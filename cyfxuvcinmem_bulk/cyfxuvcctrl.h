@@ -0,0 +1,196 @@
+/*
+ ## Cypress USB 3.0 Platform header file (cyfxuvcctrl.h)
+ ## ===========================
+ ##
+ ##  Copyright Cypress Semiconductor Corporation, 2010-2023,
+ ##  All Rights Reserved
+ ##  UNPUBLISHED, LICENSED SOFTWARE.
+ ##
+ ##  CONFIDENTIAL AND PROPRIETARY INFORMATION
+ ##  WHICH IS THE PROPERTY OF CYPRESS.
+ ##
+ ##  Use of this file is governed
+ ##  by the license agreement included in the file
+ ##
+ ##     <install>/license/license.txt
+ ##
+ ##  where <install> is the Cypress software
+ ##  installation root directory path.
+ ##
+ ## ===========================
+*/
+
+/* File: cyfxuvcctrl.h
+ *
+ * Dispatcher for the controls of the units of the video control interface. The controls are listed in
+ * a table generated from cyfxuvcstreams.json together with the bmControls bitmaps of the unit
+ * descriptors, and are looked up by unit ID and control selector in constant time. The dispatcher also
+ * keeps the error codes of the last request and of the video stream, which the host reads through the
+ * request error code control of the video control interface and the stream error code control of the
+ * video streaming interface.
+ */
+
+#ifndef _INCLUDED_CYFXUVCCTRL_H_
+#define _INCLUDED_CYFXUVCCTRL_H_
+
+#include <cyu3types.h>
+#include <cyu3externcstart.h>
+
+/* GET_INFO capability bits of a control. */
+#define CY_FX_UVC_CTRL_INFO_GET         (0x01)          /* Supports GET requests. */
+#define CY_FX_UVC_CTRL_INFO_SET         (0x02)          /* Supports SET_CUR. */
+#define CY_FX_UVC_CTRL_INFO_DISABLED    (0x04)          /* Disabled by an automatic mode. */
+#define CY_FX_UVC_CTRL_INFO_AUTOUPDATE  (0x08)          /* Value may change without a SET_CUR. */
+#define CY_FX_UVC_CTRL_INFO_ASYNC       (0x10)          /* SET_CUR completes asynchronously. */
+
+/* Largest number of fields in one control, and the largest control in bytes. */
+#define CY_FX_UVC_CTRL_MAX_FIELDS       (4)
+#define CY_FX_UVC_CTRL_MAX_LEN          (32)
+
+/* Action taken by the firmware after a SET_CUR has changed the value of a control. GET requests never
+   need one, as they are answered from the table. */
+#define CY_FX_UVC_CTRL_APPLY_NONE       (0)             /* The value is only stored. */
+#define CY_FX_UVC_CTRL_APPLY_SYNC       (1)             /* A sync frame is sent. */
+#define CY_FX_UVC_CTRL_APPLY_LAYER      (2)             /* A simulcast layer is selected, started or stopped. */
+#define CY_FX_UVC_CTRL_APPLY_SLICE      (3)             /* The payloads are cut by the new slice mode. */
+#define CY_FX_UVC_CTRL_APPLY_RESIL      (4)             /* The error resiliency features change. */
+#define CY_FX_UVC_CTRL_APPLY_PICTURE    (5)             /* The colours of the generated frames change. */
+
+/* bRequestErrorCode values of VC_REQUEST_ERROR_CODE_CONTROL: the outcome of the last request on a control
+   of the video control or video streaming interface. */
+#define CY_FX_UVC_CTRL_ERR_NONE             (0x00)  /* The request succeeded. */
+#define CY_FX_UVC_CTRL_ERR_NOT_READY        (0x01)  /* A previous operation has not completed yet. */
+#define CY_FX_UVC_CTRL_ERR_WRONG_STATE      (0x02)  /* The request is not accepted in the current state. */
+#define CY_FX_UVC_CTRL_ERR_POWER            (0x03)  /* The power mode does not allow the request. */
+#define CY_FX_UVC_CTRL_ERR_OUT_OF_RANGE     (0x04)  /* A value is outside the limits of the control. */
+#define CY_FX_UVC_CTRL_ERR_INVALID_UNIT     (0x05)  /* No unit or terminal has the ID. */
+#define CY_FX_UVC_CTRL_ERR_INVALID_CONTROL  (0x06)  /* The unit or interface does not have the control. */
+#define CY_FX_UVC_CTRL_ERR_INVALID_REQUEST  (0x07)  /* The control does not support the request. */
+#define CY_FX_UVC_CTRL_ERR_INVALID_VALUE    (0x08)  /* A value is within the limits but not on a step. */
+#define CY_FX_UVC_CTRL_ERR_UNKNOWN          (0xFF)  /* Any other failure. */
+
+/* bStreamErrorCode values of VS_STREAM_ERROR_CODE_CONTROL that a video source can report. */
+#define CY_FX_UVC_STREAM_ERR_NONE           (0x00)  /* No error since the stream start. */
+#define CY_FX_UVC_STREAM_ERR_DISCONTINUITY  (0x03)  /* Video data was lost: a frame was cut short. */
+#define CY_FX_UVC_STREAM_ERR_UNDERRUN       (0x04)  /* The device could not supply the video data. */
+#define CY_FX_UVC_STREAM_ERR_OVERRUN        (0x05)  /* The host did not take the video data in time. */
+
+/* Error code controls, as given to CyFxUvcCtrlErrorGet. */
+#define CY_FX_UVC_CTRL_ERROR_REQUEST        (0)     /* VC_REQUEST_ERROR_CODE_CONTROL */
+#define CY_FX_UVC_CTRL_ERROR_STREAM         (1)     /* VS_STREAM_ERROR_CODE_CONTROL */
+
+/* Offsets of the responses in the attribute block of a control: GET_INFO (1 byte), GET_LEN (2 bytes),
+   then GET_MIN, GET_MAX, GET_RES and GET_DEF of the control length each. */
+#define CY_FX_UVC_CTRL_ATTR_INFO        (0)
+#define CY_FX_UVC_CTRL_ATTR_LEN         (1)
+#define CY_FX_UVC_CTRL_ATTR_MIN(len)    (3)
+#define CY_FX_UVC_CTRL_ATTR_MAX(len)    (3 + (len))
+#define CY_FX_UVC_CTRL_ATTR_RES(len)    (3 + 2 * (len))
+#define CY_FX_UVC_CTRL_ATTR_DEF(len)    (3 + 3 * (len))
+
+/* Control implemented by the device. The values are kept in USB (little endian) layout, so that all
+   GET requests are answered by sending part of the attribute block or the current value as is. The
+   control is made of up to four unsigned fields, which are checked against the limits on their own. */
+typedef struct CyFxUvcCtrlInfo_t
+{
+    uint8_t        unitId;                              /* Unit or terminal ID. */
+    uint8_t        selector;                            /* Control selector. */
+    uint8_t        length;                              /* Length of the control in bytes. */
+    uint8_t        fieldSize[CY_FX_UVC_CTRL_MAX_FIELDS];/* Size of each field in bytes, 0 after the last. */
+    uint8_t        apply;                               /* Action after a SET_CUR: CY_FX_UVC_CTRL_APPLY_*. */
+    uint8_t        isRuntime;                           /* Whether SET_CUR is accepted while video streams. */
+    const uint8_t *attr_p;                              /* INFO, LEN, MIN, MAX, RES and DEF responses. */
+    uint8_t       *cur_p;                               /* Current value (GET_CUR response). */
+} CyFxUvcCtrlInfo_t;
+
+/* Controls of one unit, indexed by control selector: the index of the control in glUvcCtrls plus one,
+   or 0 where the unit does not implement the selector. */
+typedef struct CyFxUvcCtrlUnit_t
+{
+    uint8_t        subtype;             /* Descriptor subtype of the unit or terminal, 0 if no unit has the ID. */
+    uint8_t        selectorCount;       /* Number of entries in index_p: the highest selector plus one. */
+    const uint8_t *index_p;             /* Control index plus one, by selector. */
+} CyFxUvcCtrlUnit_t;
+
+/* Controls implemented by the device, and the controls of each unit indexed by unit ID. Generated into
+   cyfxuvccontrols.c from cyfxuvcstreams.json, together with the unit descriptors in cyfxuvcdscr.c. */
+extern const CyFxUvcCtrlInfo_t glUvcCtrls[];
+extern const uint8_t           glUvcCtrlCount;
+extern const CyFxUvcCtrlUnit_t glUvcCtrlUnits[];
+extern const uint8_t           glUvcCtrlUnitCount;
+
+/* Load the default value of every control, and clear the error codes. */
+extern void
+CyFxUvcCtrlInit (
+        void);
+
+/* Find the control with the given selector in a unit. Returns NULL if the unit does not implement it. */
+extern const CyFxUvcCtrlInfo_t *
+CyFxUvcCtrlFind (
+        uint8_t unitId,
+        uint8_t selector);
+
+/* Find the control addressed by a request, as CyFxUvcCtrlFind. If there is none, the request error
+   code is set to CY_FX_UVC_CTRL_ERR_INVALID_UNIT or CY_FX_UVC_CTRL_ERR_INVALID_CONTROL, depending on
+   whether a unit or terminal has the ID. */
+extern const CyFxUvcCtrlInfo_t *
+CyFxUvcCtrlLookup (
+        uint8_t unitId,
+        uint8_t selector);
+
+/* Get the response to a GET request (GET_CUR, GET_MIN, GET_MAX, GET_RES, GET_DEF, GET_LEN or GET_INFO)
+   on a control. *len_p is set to the full response length; the caller sends no more than wLength bytes.
+   Fails with CY_U3P_ERROR_NOT_SUPPORTED for requests that should be stalled. Sets the request error
+   code. */
+extern CyU3PReturnStatus_t
+CyFxUvcCtrlGet (
+        const CyFxUvcCtrlInfo_t *ctrl_p,
+        uint8_t                  bRequest,
+        const uint8_t          **buf_pp,
+        uint16_t                *len_p);
+
+/* Handle the data of a SET_CUR request on a control. Fails with CY_U3P_ERROR_NOT_SUPPORTED if the
+   control cannot be set, and with CY_U3P_ERROR_BAD_ARGUMENT if len is not the control length or a field
+   is out of range or not a whole number of steps from the minimum; the current value is kept then. Sets
+   the request error code: CY_FX_UVC_CTRL_ERR_OUT_OF_RANGE and CY_FX_UVC_CTRL_ERR_INVALID_VALUE tell the
+   two range failures apart. */
+extern CyU3PReturnStatus_t
+CyFxUvcCtrlSet (
+        const CyFxUvcCtrlInfo_t *ctrl_p,
+        const uint8_t           *buf_p,
+        uint16_t                 len);
+
+/* Get one field of the current value of a control. */
+extern uint32_t
+CyFxUvcCtrlField (
+        const CyFxUvcCtrlInfo_t *ctrl_p,
+        uint8_t                  field);
+
+/* Record the outcome of a request checked outside the dispatcher, as the request error code. */
+extern void
+CyFxUvcCtrlRequestDone (
+        uint8_t code);
+
+/* Record an error of the video stream, or CY_FX_UVC_STREAM_ERR_NONE at the stream start. The code is
+   kept until the next error or stream start. */
+extern void
+CyFxUvcCtrlStreamError (
+        uint8_t code);
+
+/* Get the response to a GET request on an error code control (CY_FX_UVC_CTRL_ERROR_REQUEST or
+   CY_FX_UVC_CTRL_ERROR_STREAM): GET_CUR or GET_INFO, both one byte. Fails with
+   CY_U3P_ERROR_NOT_SUPPORTED for the other requests. Leaves the request error code alone, so that the
+   host can read it after the request that failed. */
+extern CyU3PReturnStatus_t
+CyFxUvcCtrlErrorGet (
+        uint8_t                  control,
+        uint8_t                  bRequest,
+        const uint8_t          **buf_pp,
+        uint16_t                *len_p);
+
+#include <cyu3externcend.h>
+
+#endif /* _INCLUDED_CYFXUVCCTRL_H_ */
+
+/*[]*/
+
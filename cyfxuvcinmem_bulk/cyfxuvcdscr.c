@@ -20,10 +20,13 @@
  ## ===========================
 */
 
-/* This file contains the USB enumeration descriptors for the UVC (in memory) application example.
+/* This file contains the USB enumeration descriptors for the UVC (in memory) bulk streaming application example.
+ * It is generated by tools/fx3_uvc_dscr_gen.py from cyfxuvcstreams.json: edit the stream table
+ * and run the generator again instead of editing this file.
+ *
  * The descriptor arrays must be 32 byte aligned and multiple of 32 bytes if the D-cache is
  * turned on. If the linker used is not capable of supporting the aligned feature for this,
- * either the descriptors must be placed in a different section and the section should be 
+ * either the descriptors must be placed in a different section and the section should be
  * 32 byte aligned and 32 byte multiple; or dynamically allocated buffer allocated using
  * CyU3PDmaBufferAlloc must be used, and the descriptor must be loaded into it. The example
  * assumes that the aligned attribute for 32 bytes is supported by the linker. Do not add
@@ -34,7 +37,7 @@
 
 #include "cyfxuvcinmem.h"
 
-/* Standard device descriptor for USB 3.0 */
+/* Standard device descriptor for USB 3.0 (18 bytes) */
 const uint8_t CyFxUSB30DeviceDscr[] __attribute__ ((aligned (32))) =
 {
     0x12,                           /* Descriptor size */
@@ -53,7 +56,7 @@ const uint8_t CyFxUSB30DeviceDscr[] __attribute__ ((aligned (32))) =
     0x01                            /* Number of configurations */
 };
 
-/* Standard device descriptor */
+/* Standard device descriptor (18 bytes) */
 const uint8_t CyFxUSB20DeviceDscr[] __attribute__ ((aligned (32))) =
 {
     0x12,                           /* Descriptor size */
@@ -72,7 +75,7 @@ const uint8_t CyFxUSB20DeviceDscr[] __attribute__ ((aligned (32))) =
     0x01                            /* Number of configurations */
 };
 
-/* Binary device object store descriptor */
+/* Binary device object store descriptor (22 bytes) */
 const uint8_t CyFxUSBBOSDscr[] __attribute__ ((aligned (32))) =
 {
     0x05,                           /* Descriptor size */
@@ -98,10 +101,10 @@ const uint8_t CyFxUSBBOSDscr[] __attribute__ ((aligned (32))) =
     0x00,0x00                       /* U2 device exit latency */
 };
 
-/* Standard device qualifier descriptor */
+/* Standard device qualifier descriptor (10 bytes) */
 const uint8_t CyFxUSBDeviceQualDscr[] __attribute__ ((aligned (32))) =
 {
-    0x0A,                           /* descriptor size */
+    0x0A,                           /* Descriptor size */
     CY_U3P_USB_DEVQUAL_DESCR,       /* Device qualifier descriptor type */
     0x00,0x02,                      /* USB 2.0 */
     0xEF,                           /* Device class */
@@ -112,23 +115,23 @@ const uint8_t CyFxUSBDeviceQualDscr[] __attribute__ ((aligned (32))) =
     0x00                            /* Reserved */
 };
 
-/* Standard super speed configuration descriptor */
+/* Standard super speed configuration descriptor (962 bytes) */
 const uint8_t CyFxUSBSSConfigDscr[] __attribute__ ((aligned (32))) =
 {
     /* Configuration descriptor */
     0x09,                           /* Descriptor size */
     CY_U3P_USB_CONFIG_DESCR,        /* Configuration descriptor type */
-    0xD7,0x00,                      /* Length of this descriptor and all sub descriptors */
+    0xC2,0x03,                      /* Length of this descriptor and all sub descriptors */
     0x02,                           /* Number of interfaces */
     0x01,                           /* Configuration number */
-    0x00,                           /* COnfiguration string index */
+    0x00,                           /* Configuration string index */
     0x80,                           /* Config characteristics - Bus powered */
     0x32,                           /* Max power consumption of device (in 8mA unit) : 400mA */
 
     /* Interface association descriptor */
     0x08,                           /* Descriptor size */
     CY_FX_INTF_ASSN_DSCR_TYPE,      /* Interface association descr type */
-    0x00,                           /* I/f number of first VideoControl i/f */
+    0x00,                           /* I/f number of first video control i/f */
     0x02,                           /* Number of video i/f */
     0x0E,                           /* CC_VIDEO : Video i/f class code */
     0x03,                           /* SC_VIDEO_INTERFACE_COLLECTION : Subclass code */
@@ -147,7 +150,7 @@ const uint8_t CyFxUSBSSConfigDscr[] __attribute__ ((aligned (32))) =
     0x00,                           /* Interface descriptor string index */
 
     /* Class specific VC interface header descriptor */
-    0x0D,                           /* Descriptor size */
+    0x0D,                           /* Descriptor size: 13 bytes */
     0x24,                           /* Class specific i/f header descriptor type */
     0x01,                           /* Descriptor sub type : VC_HEADER */
     0x50,0x01,                      /* Revision of class spec : 1.5 */
@@ -157,7 +160,7 @@ const uint8_t CyFxUSBSSConfigDscr[] __attribute__ ((aligned (32))) =
     0x01,                           /* Video streaming i/f 1 belongs to VC i/f */
 
     /* Input (camera) terminal descriptor */
-    0x12,                           /* Descriptor size */
+    0x12,                           /* Descriptor size: 18 bytes */
     0x24,                           /* Class specific interface desc type */
     0x02,                           /* Input Terminal Descriptor type */
     0x01,                           /* ID of this terminal */
@@ -168,34 +171,34 @@ const uint8_t CyFxUSBSSConfigDscr[] __attribute__ ((aligned (32))) =
     0x00,0x00,                      /* No optical zoom supported */
     0x00,0x00,                      /* No optical zoom supported */
     0x03,                           /* Size of controls field for this terminal : 3 bytes */
-    0x00,0x00,0x00,                 /* No controls supported */
+    0x0A,0x00,0x00,                 /* Controls supported */
 
     /* Processing unit descriptor */
-    0x0D,                           /* Descriptor size */
+    0x0D,                           /* Descriptor size: 13 bytes */
     0x24,                           /* Class specific interface desc type */
     0x05,                           /* Processing unit descriptor type */
-    0x02,                           /* ID of this terminal */
-    0x01,                           /* Source ID : 1 : connected to input terminal */
+    0x02,                           /* ID of this unit */
+    0x01,                           /* Source ID : 1 : Connected to input terminal */
     0x00,0x40,                      /* Digital multiplier */
-    0x03,                           /* Size of controls field for this terminal : 3 bytes */
-    0x00,0x00,0x00,                 /* No controls supported */
+    0x03,                           /* Size of controls field for this unit : 3 bytes */
+    0x0B,0x06,0x00,                 /* Controls supported */
     0x00,                           /* String desc index : Not used */
-    0x00,                           /* No analog mode support. */
+    0x00,                           /* No analog modes supported. */
 
     /* Extension unit descriptor */
-    0x1C,                           /* Descriptor size */
+    0x1C,                           /* Descriptor size: 28 bytes */
     0x24,                           /* Class specific interface desc type */
     0x06,                           /* Extension unit descriptor type */
-    0x03,                           /* ID of this terminal */
+    0x03,                           /* ID of this unit */
     0xFF,0xFF,0xFF,0xFF,            /* 16 byte GUID */
     0xFF,0xFF,0xFF,0xFF,
     0xFF,0xFF,0xFF,0xFF,
     0xFF,0xFF,0xFF,0xFF,
-    0x00,                           /* Number of controls in this terminal */
-    0x01,                           /* Number of input pins in this terminal */
-    0x02,                           /* Source ID : 2 : connected to proc unit */
-    0x03,                           /* Size of controls field for this terminal : 3 bytes */
-    0x00,0x00,0x00,                 /* No controls supported */
+    0x00,                           /* Number of controls in this unit */
+    0x01,                           /* Number of input pins in this unit */
+    0x02,                           /* Source ID : 2 : Connected to proc unit */
+    0x03,                           /* Size of controls field for this unit : 3 bytes */
+    0x00,0x00,0x00,                 /* Controls supported */
     0x00,                           /* String desc index : Not used */
 
     /* Encoding unit descriptor (UVC 1.5) */
@@ -205,12 +208,12 @@ const uint8_t CyFxUSBSSConfigDscr[] __attribute__ ((aligned (32))) =
     0x05,                           /* ID of this unit */
     0x03,                           /* Source ID : 3 : Connected to extn unit */
     0x00,                           /* iEncoding: String descriptor index */
-    0x00,                           /* bControlSize: Size of controls field */
-    0x01,                           /* bControlsType: Bitmap indicating supported controls */
-    0x00,0x00,0x00,                 /* bmControls: Controls supported (placeholder) */
+    0x03,                           /* bControlSize: Size of controls field : 3 bytes */
+    0xF1,0x07,0x0C,                 /* bmControls: Controls supported */
+    0xF1,0x07,0x0C,                 /* bmControlsRuntime: Controls settable while streaming */
 
     /* Output terminal descriptor */
-    0x09,                           /* Descriptor size */
+    0x09,                           /* Descriptor size: 9 bytes */
     0x24,                           /* Class specific interface desc type */
     0x03,                           /* Output terminal descriptor type */
     0x04,                           /* ID of this terminal */
@@ -232,7 +235,7 @@ const uint8_t CyFxUSBSSConfigDscr[] __attribute__ ((aligned (32))) =
     CY_U3P_SS_EP_COMPN_DESCR,       /* SS endpoint companion descriptor type */
     0x00,                           /* Max no. of packets in a Burst : 1 */
     0x00,                           /* Mult.: Max number of packets : 1 */
-    0x40, 0x00,                     /* Bytes per interval : 64 */
+    0x40,0x00,                      /* Bytes per interval : 64 */
 
     /* Class specific interrupt endpoint descriptor */
     0x05,                           /* Descriptor size */
@@ -252,86 +255,454 @@ const uint8_t CyFxUSBSSConfigDscr[] __attribute__ ((aligned (32))) =
     0x00,                           /* Interface descriptor string index */
 
     /* Class-specific video streaming input header descriptor */
-    0x0E,                           /* Descriptor size */
-    0x24,                           /* Class-specific VS i/f Type */
+    0x13,                           /* Descriptor size: 19 bytes */
+    0x24,                           /* Class-specific VS i/f type */
     0x01,                           /* Descriptor subtype : input header */
-    0x01,                           /* 1 format desciptor follows */
-    0x37,0x00,                      /* Total size of class specific VS descr = 55 bytes */
+    0x06,                           /* 6 format desciptor(s) follow */
+    0x22,0x03,                      /* Total size of class specific VS descr: 802 bytes */
     CY_FX_EP_BULK_VIDEO,            /* EP address for BULK video data */
     0x00,                           /* No dynamic format change supported */
     0x04,                           /* Output terminal ID : 4 */
-    0x00,                           /* No still image capture support. */
+    0x00,                           /* No still image capture supported. */
     0x00,                           /* No hardware trigger support. */
     0x00,                           /* Hardware to initiate still image capture */
     0x01,                           /* Size of controls field : 1 byte */
-    0x00,                           /* D2 : Compression quality supported */
+    0x00,                           /* bmaControls for format 1 */
+    0x00,                           /* bmaControls for format 2 */
+    0x00,                           /* bmaControls for format 3 */
+    0x00,                           /* bmaControls for format 4 */
+    0x00,                           /* bmaControls for format 5 */
+    0x00,                           /* bmaControls for format 6 */
 
-    /* Class specific VS format descriptor */
-    0x0B,                           /* Descriptor size */
+    /* Class specific VS format descriptor : MJPEG */
+    0x0B,                           /* Descriptor size: 11 bytes */
     0x24,                           /* Class-specific VS i/f type */
     0x06,                           /* Descriptor subtype : VS_FORMAT_MJPEG */
     0x01,                           /* Format desciptor index */
-    0x01,                           /* 1 Frame desciptor follows */
-    0x01,                           /* Uses fixed size samples */
+    0x03,                           /* 3 Frame desciptor(s) follow */
+    0x00,                           /* Variable size samples */
+    0x01,                           /* Default frame index is 1 */
+    0x00,                           /* Aspect ratio X : Not used */
+    0x00,                           /* Aspect ratio Y : Not used */
+    0x00,                           /* Non interlaced stream */
+    0x00,                           /* CopyProtect: duplication unrestricted */
+
+    /* Class specific VS frame descriptor : 640 x 480 */
+    0x26,                           /* Descriptor size: 38 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    0x07,                           /* Descriptor subtype : VS_FRAME_MJPEG */
+    0x01,                           /* Frame desciptor index */
+    0x00,                           /* Still image capture method not supported */
+    0x80,0x02,                      /* Width of the frame : 640 */
+    0xE0,0x01,                      /* Height of the frame : 480 */
+    0x10,0x6B,0x0C,0x00,            /* Min bit rate bits/s */
+    0x43,0xAC,0x31,0x00,            /* Max bit rate bits/s */
+    0x8F,0x35,0x00,0x00,            /* Maximum video or still frame size in bytes */
+    0x2A,0x2C,0x0A,0x00,            /* Default frame interval : 15 fps */
+    0x03,                           /* Frame interval type : 3 discrete setting(s) */
+    0x15,0x16,0x05,0x00,            /* Frame interval : 30 fps */
+    0x2A,0x2C,0x0A,0x00,            /* Frame interval : 15 fps */
+    0x55,0x58,0x14,0x00,            /* Frame interval : 7.5 fps */
+
+    /* Class specific VS frame descriptor : 320 x 240 */
+    0x26,                           /* Descriptor size: 38 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    0x07,                           /* Descriptor subtype : VS_FRAME_MJPEG */
+    0x02,                           /* Frame desciptor index */
+    0x00,                           /* Still image capture method not supported */
+    0x40,0x01,                      /* Width of the frame : 320 */
+    0xF0,0x00,                      /* Height of the frame : 240 */
+    0x4C,0xDE,0x02,0x00,            /* Min bit rate bits/s */
+    0x30,0x79,0x0B,0x00,            /* Max bit rate bits/s */
+    0x43,0x0C,0x00,0x00,            /* Maximum video or still frame size in bytes */
+    0x2A,0x2C,0x0A,0x00,            /* Default frame interval : 15 fps */
+    0x03,                           /* Frame interval type : 3 discrete setting(s) */
+    0x15,0x16,0x05,0x00,            /* Frame interval : 30 fps */
+    0x2A,0x2C,0x0A,0x00,            /* Frame interval : 15 fps */
+    0x55,0x58,0x14,0x00,            /* Frame interval : 7.5 fps */
+
+    /* Class specific VS frame descriptor : 1280 x 720 */
+    0x26,                           /* Descriptor size: 38 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    0x07,                           /* Descriptor subtype : VS_FRAME_MJPEG */
+    0x03,                           /* Frame desciptor index */
+    0x00,                           /* Still image capture method not supported */
+    0x00,0x05,                      /* Width of the frame : 1280 */
+    0xD0,0x02,                      /* Height of the frame : 720 */
+    0x70,0xA4,0x09,0x00,            /* Min bit rate bits/s */
+    0xC2,0x91,0x26,0x00,            /* Max bit rate bits/s */
+    0x2B,0x29,0x00,0x00,            /* Maximum video or still frame size in bytes */
+    0x2A,0x2C,0x0A,0x00,            /* Default frame interval : 15 fps */
+    0x03,                           /* Frame interval type : 3 discrete setting(s) */
+    0x15,0x16,0x05,0x00,            /* Frame interval : 30 fps */
+    0x2A,0x2C,0x0A,0x00,            /* Frame interval : 15 fps */
+    0x55,0x58,0x14,0x00,            /* Frame interval : 7.5 fps */
+
+    /* Class specific VS format descriptor : YUY2 */
+    0x1B,                           /* Descriptor size: 27 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    0x04,                           /* Descriptor subtype : VS_FORMAT_UNCOMPRESSED */
+    0x02,                           /* Format desciptor index */
+    0x03,                           /* 3 Frame desciptor(s) follow */
+    0x59,0x55,0x59,0x32,            /* GUID : YUY2 */
+    0x00,0x00,0x10,0x00,
+    0x80,0x00,0x00,0xAA,
+    0x00,0x38,0x9B,0x71,
+    0x10,                           /* Bits per pixel : 16 */
+    0x01,                           /* Default frame index is 1 */
+    0x00,                           /* Aspect ratio X : Not used */
+    0x00,                           /* Aspect ratio Y : Not used */
+    0x00,                           /* Non interlaced stream */
+    0x00,                           /* CopyProtect: duplication unrestricted */
+
+    /* Class specific VS frame descriptor : 640 x 480 */
+    0x26,                           /* Descriptor size: 38 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    0x05,                           /* Descriptor subtype : VS_FRAME_UNCOMPRESSED */
+    0x01,                           /* Frame desciptor index */
+    0x00,                           /* Still image capture method not supported */
+    0x80,0x02,                      /* Width of the frame : 640 */
+    0xE0,0x01,                      /* Height of the frame : 480 */
+    0x09,0x80,0x32,0x02,            /* Min bit rate bits/s */
+    0x93,0x00,0xCA,0x08,            /* Max bit rate bits/s */
+    0x00,0x60,0x09,0x00,            /* Maximum video or still frame size in bytes */
+    0x2A,0x2C,0x0A,0x00,            /* Default frame interval : 15 fps */
+    0x03,                           /* Frame interval type : 3 discrete setting(s) */
+    0x15,0x16,0x05,0x00,            /* Frame interval : 30 fps */
+    0x2A,0x2C,0x0A,0x00,            /* Frame interval : 15 fps */
+    0x55,0x58,0x14,0x00,            /* Frame interval : 7.5 fps */
+
+    /* Class specific VS frame descriptor : 1280 x 720 */
+    0x26,                           /* Descriptor size: 38 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    0x05,                           /* Descriptor subtype : VS_FRAME_UNCOMPRESSED */
+    0x02,                           /* Frame desciptor index */
+    0x00,                           /* Still image capture method not supported */
+    0x00,0x05,                      /* Width of the frame : 1280 */
+    0xD0,0x02,                      /* Height of the frame : 720 */
+    0x1B,0x80,0x97,0x06,            /* Min bit rate bits/s */
+    0xBA,0x01,0x5E,0x1A,            /* Max bit rate bits/s */
+    0x00,0x20,0x1C,0x00,            /* Maximum video or still frame size in bytes */
+    0x2A,0x2C,0x0A,0x00,            /* Default frame interval : 15 fps */
+    0x03,                           /* Frame interval type : 3 discrete setting(s) */
+    0x15,0x16,0x05,0x00,            /* Frame interval : 30 fps */
+    0x2A,0x2C,0x0A,0x00,            /* Frame interval : 15 fps */
+    0x55,0x58,0x14,0x00,            /* Frame interval : 7.5 fps */
+
+    /* Class specific VS frame descriptor : 1920 x 1080 */
+    0x26,                           /* Descriptor size: 38 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    0x05,                           /* Descriptor subtype : VS_FRAME_UNCOMPRESSED */
+    0x03,                           /* Frame desciptor index */
+    0x00,                           /* Still image capture method not supported */
+    0x80,0x07,                      /* Width of the frame : 1920 */
+    0x38,0x04,                      /* Height of the frame : 1080 */
+    0x3E,0xE0,0xD4,0x0E,            /* Min bit rate bits/s */
+    0xE3,0x83,0x53,0x3B,            /* Max bit rate bits/s */
+    0x00,0x48,0x3F,0x00,            /* Maximum video or still frame size in bytes */
+    0x2A,0x2C,0x0A,0x00,            /* Default frame interval : 15 fps */
+    0x03,                           /* Frame interval type : 3 discrete setting(s) */
+    0x15,0x16,0x05,0x00,            /* Frame interval : 30 fps */
+    0x2A,0x2C,0x0A,0x00,            /* Frame interval : 15 fps */
+    0x55,0x58,0x14,0x00,            /* Frame interval : 7.5 fps */
+
+    /* Class specific VS format descriptor : NV12 */
+    0x1B,                           /* Descriptor size: 27 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    0x04,                           /* Descriptor subtype : VS_FORMAT_UNCOMPRESSED */
+    0x03,                           /* Format desciptor index */
+    0x03,                           /* 3 Frame desciptor(s) follow */
+    0x4E,0x56,0x31,0x32,            /* GUID : NV12 */
+    0x00,0x00,0x10,0x00,
+    0x80,0x00,0x00,0xAA,
+    0x00,0x38,0x9B,0x71,
+    0x0C,                           /* Bits per pixel : 12 */
     0x01,                           /* Default frame index is 1 */
-    0x00,                           /* Non interlaced stream not reqd. */
-    0x00,                           /* Non interlaced stream not reqd. */
+    0x00,                           /* Aspect ratio X : Not used */
+    0x00,                           /* Aspect ratio Y : Not used */
     0x00,                           /* Non interlaced stream */
     0x00,                           /* CopyProtect: duplication unrestricted */
 
-    /* Class specific VS frame descriptor */
-    0x1E,                           /* Descriptor size */
+    /* Class specific VS frame descriptor : 640 x 480 */
+    0x26,                           /* Descriptor size: 38 bytes */
     0x24,                           /* Class-specific VS i/f type */
-    0x07,                           /* Descriptor Subtype : VS_FRAME_MJPEG */
+    0x05,                           /* Descriptor subtype : VS_FRAME_UNCOMPRESSED */
     0x01,                           /* Frame desciptor index */
     0x00,                           /* Still image capture method not supported */
-    0x80,0x02,                      /* Width of the frame  : 640 */
+    0x80,0x02,                      /* Width of the frame : 640 */
     0xE0,0x01,                      /* Height of the frame : 480 */
-    0x00,0xC0,0x5D,0x00,            /* Min bit rate bits/s */
-    0x00,0xC0,0x5D,0x00,            /* Min bit rate bits/s */
-    0x00,0x58,0x02,0x00,            /* Maximum video or still frame size in bytes */
-    0x2A,0x2C,0x0A,0x00,            /* Default frame interval = 15 fps */
-    0x01,                           /* Frame interval type : No of discrete intervals */
-    0x2A,0x2C,0x0A,0x00,            /* Frame interval = 15fps */
-
-    /* Endpoint descriptor for streaming video data */
+    0x06,0xE0,0xA5,0x01,            /* Min bit rate bits/s */
+    0x6E,0x80,0x97,0x06,            /* Max bit rate bits/s */
+    0x00,0x08,0x07,0x00,            /* Maximum video or still frame size in bytes */
+    0x2A,0x2C,0x0A,0x00,            /* Default frame interval : 15 fps */
+    0x03,                           /* Frame interval type : 3 discrete setting(s) */
+    0x15,0x16,0x05,0x00,            /* Frame interval : 30 fps */
+    0x2A,0x2C,0x0A,0x00,            /* Frame interval : 15 fps */
+    0x55,0x58,0x14,0x00,            /* Frame interval : 7.5 fps */
+
+    /* Class specific VS frame descriptor : 1280 x 720 */
+    0x26,                           /* Descriptor size: 38 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    0x05,                           /* Descriptor subtype : VS_FRAME_UNCOMPRESSED */
+    0x02,                           /* Frame desciptor index */
+    0x00,                           /* Still image capture method not supported */
+    0x00,0x05,                      /* Width of the frame : 1280 */
+    0xD0,0x02,                      /* Height of the frame : 720 */
+    0x14,0xA0,0xF1,0x04,            /* Min bit rate bits/s */
+    0x4B,0x81,0xC6,0x13,            /* Max bit rate bits/s */
+    0x00,0x18,0x15,0x00,            /* Maximum video or still frame size in bytes */
+    0x2A,0x2C,0x0A,0x00,            /* Default frame interval : 15 fps */
+    0x03,                           /* Frame interval type : 3 discrete setting(s) */
+    0x15,0x16,0x05,0x00,            /* Frame interval : 30 fps */
+    0x2A,0x2C,0x0A,0x00,            /* Frame interval : 15 fps */
+    0x55,0x58,0x14,0x00,            /* Frame interval : 7.5 fps */
+
+    /* Class specific VS frame descriptor : 1920 x 1080 */
+    0x26,                           /* Descriptor size: 38 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    0x05,                           /* Descriptor subtype : VS_FRAME_UNCOMPRESSED */
+    0x03,                           /* Frame desciptor index */
+    0x00,                           /* Still image capture method not supported */
+    0x80,0x07,                      /* Width of the frame : 1920 */
+    0x38,0x04,                      /* Height of the frame : 1080 */
+    0x2E,0xA8,0x1F,0x0B,            /* Min bit rate bits/s */
+    0xEA,0xA2,0x7E,0x2C,            /* Max bit rate bits/s */
+    0x00,0x76,0x2F,0x00,            /* Maximum video or still frame size in bytes */
+    0x2A,0x2C,0x0A,0x00,            /* Default frame interval : 15 fps */
+    0x03,                           /* Frame interval type : 3 discrete setting(s) */
+    0x15,0x16,0x05,0x00,            /* Frame interval : 30 fps */
+    0x2A,0x2C,0x0A,0x00,            /* Frame interval : 15 fps */
+    0x55,0x58,0x14,0x00,            /* Frame interval : 7.5 fps */
+
+    /* Class specific VS format descriptor : H.264 (UVC 1.5) */
+    0x34,                           /* Descriptor size: 52 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    CY_FX_UVC_VS_FORMAT_H264,       /* Descriptor subtype : VS_FORMAT_H264 */
+    0x04,                           /* Format desciptor index */
+    0x02,                           /* 2 Frame desciptor(s) follow */
+    0x01,                           /* Default frame index is 1 */
+    0x01,                           /* bMaxCodecConfigDelay : 1 frame */
+    0x06,                           /* bmSupportedSliceModes : target compressed size per slice, number of slices per frame */
+    0x0A,                           /* bmSupportedSyncFrameTypes : IDR, random access */
+    0x00,                           /* bResolutionScaling : not supported */
+    0x00,                           /* Reserved */
+    0x07,                           /* bmSupportedRateControlModes : VBR, CBR, constant QP */
+    0x6C,0x00,                      /* wMaxMBperSec, one resolution, no scalability : 108 x 1000 MB/s */
+    0x00,0x00,                      /* wMaxMBperSec for more resolutions and scalable streams : not supported */
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+
+    /* Class specific VS frame descriptor : H.264 640 x 480 */
+    0x38,                           /* Descriptor size: 56 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    CY_FX_UVC_VS_FRAME_H264,        /* Descriptor subtype : VS_FRAME_H264 */
+    0x01,                           /* Frame desciptor index */
+    0x80,0x02,                      /* Width of the frame : 640 */
+    0xE0,0x01,                      /* Height of the frame : 480 */
+    0x01,0x00,                      /* wSARwidth : square pixels */
+    0x01,0x00,                      /* wSARheight : square pixels */
+    0xC0,0x42,                      /* wProfile : profile_idc 66, constraint flags 0xC0 */
+    0x1F,                           /* bLevelIDC : level 3.1 */
+    0x00,0x00,                      /* wConstrainedToolset : reserved */
+    0x01,0x00,0x00,0x00,            /* bmSupportedUsages : real time */
+    0x25,0x00,                      /* bmCapabilities : CAVLC, constant frame rate, no reordering */
+    0x00,0x00,0x00,0x00,            /* bmSVCCapabilities : no SVC */
+    0x00,0x00,0x00,0x00,            /* bmMVCCapabilities : no MVC */
+    0x28,0x23,0x00,0x00,            /* Min bit rate bits/s */
+    0x28,0xB8,0x01,0x00,            /* Max bit rate bits/s */
+    0x2A,0x2C,0x0A,0x00,            /* Default frame interval : 15 fps */
+    0x03,                           /* Frame interval type : 3 discrete setting(s) */
+    0x15,0x16,0x05,0x00,            /* Frame interval : 30 fps */
+    0x2A,0x2C,0x0A,0x00,            /* Frame interval : 15 fps */
+    0x55,0x58,0x14,0x00,            /* Frame interval : 7.5 fps */
+
+    /* Class specific VS frame descriptor : H.264 1280 x 720 */
+    0x38,                           /* Descriptor size: 56 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    CY_FX_UVC_VS_FRAME_H264,        /* Descriptor subtype : VS_FRAME_H264 */
+    0x02,                           /* Frame desciptor index */
+    0x00,0x05,                      /* Width of the frame : 1280 */
+    0xD0,0x02,                      /* Height of the frame : 720 */
+    0x01,0x00,                      /* wSARwidth : square pixels */
+    0x01,0x00,                      /* wSARheight : square pixels */
+    0xC0,0x42,                      /* wProfile : profile_idc 66, constraint flags 0xC0 */
+    0x1F,                           /* bLevelIDC : level 3.1 */
+    0x00,0x00,                      /* wConstrainedToolset : reserved */
+    0x01,0x00,0x00,0x00,            /* bmSupportedUsages : real time */
+    0x25,0x00,                      /* bmCapabilities : CAVLC, constant frame rate, no reordering */
+    0x00,0x00,0x00,0x00,            /* bmSVCCapabilities : no SVC */
+    0x00,0x00,0x00,0x00,            /* bmMVCCapabilities : no MVC */
+    0x5E,0x43,0x00,0x00,            /* Min bit rate bits/s */
+    0x4B,0x76,0x02,0x00,            /* Max bit rate bits/s */
+    0x2A,0x2C,0x0A,0x00,            /* Default frame interval : 15 fps */
+    0x03,                           /* Frame interval type : 3 discrete setting(s) */
+    0x15,0x16,0x05,0x00,            /* Frame interval : 30 fps */
+    0x2A,0x2C,0x0A,0x00,            /* Frame interval : 15 fps */
+    0x55,0x58,0x14,0x00,            /* Frame interval : 7.5 fps */
+
+    /* Class specific VS format descriptor : H.265 (frame based) */
+    0x1C,                           /* Descriptor size: 28 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    CY_FX_UVC_VS_FORMAT_FRAME_BASED, /* Descriptor subtype : VS_FORMAT_FRAME_BASED */
+    0x05,                           /* Format desciptor index */
+    0x02,                           /* 2 Frame desciptor(s) follow */
+    0x48,0x32,0x36,0x35,            /* GUID : H265 */
+    0x00,0x00,0x10,0x00,
+    0x80,0x00,0x00,0xAA,
+    0x00,0x38,0x9B,0x71,
+    0x00,                           /* Bits per pixel : not applicable */
+    0x01,                           /* Default frame index is 1 */
+    0x00,                           /* Aspect ratio X : Not used */
+    0x00,                           /* Aspect ratio Y : Not used */
+    0x00,                           /* Non interlaced stream */
+    0x00,                           /* CopyProtect: duplication unrestricted */
+    0x01,                           /* Variable size frames */
+
+    /* Class specific VS frame descriptor : H.265 640 x 480 */
+    0x26,                           /* Descriptor size: 38 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    CY_FX_UVC_VS_FRAME_FRAME_BASED, /* Descriptor subtype : VS_FRAME_FRAME_BASED */
+    0x01,                           /* Frame desciptor index */
+    0x00,                           /* Still image capture method not supported */
+    0x80,0x02,                      /* Width of the frame : 640 */
+    0xE0,0x01,                      /* Height of the frame : 480 */
+    0xBE,0x5B,0x00,0x00,            /* Min bit rate bits/s */
+    0xF9,0x6E,0x01,0x00,            /* Max bit rate bits/s */
+    0x2A,0x2C,0x0A,0x00,            /* Default frame interval : 15 fps */
+    0x03,                           /* Frame interval type : 3 discrete setting(s) */
+    0x00,0x00,0x00,0x00,            /* Bytes per line : not applicable to compressed frames */
+    0x15,0x16,0x05,0x00,            /* Frame interval : 30 fps */
+    0x2A,0x2C,0x0A,0x00,            /* Frame interval : 15 fps */
+    0x55,0x58,0x14,0x00,            /* Frame interval : 7.5 fps */
+
+    /* Class specific VS frame descriptor : H.265 1280 x 720 */
+    0x26,                           /* Descriptor size: 38 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    CY_FX_UVC_VS_FRAME_FRAME_BASED, /* Descriptor subtype : VS_FRAME_FRAME_BASED */
+    0x02,                           /* Frame desciptor index */
+    0x00,                           /* Still image capture method not supported */
+    0x00,0x05,                      /* Width of the frame : 1280 */
+    0xD0,0x02,                      /* Height of the frame : 720 */
+    0x2B,0x89,0x00,0x00,            /* Min bit rate bits/s */
+    0xAC,0x24,0x02,0x00,            /* Max bit rate bits/s */
+    0x2A,0x2C,0x0A,0x00,            /* Default frame interval : 15 fps */
+    0x03,                           /* Frame interval type : 3 discrete setting(s) */
+    0x00,0x00,0x00,0x00,            /* Bytes per line : not applicable to compressed frames */
+    0x15,0x16,0x05,0x00,            /* Frame interval : 30 fps */
+    0x2A,0x2C,0x0A,0x00,            /* Frame interval : 15 fps */
+    0x55,0x58,0x14,0x00,            /* Frame interval : 7.5 fps */
+
+    /* Class specific VS format descriptor : H.264 simulcast (UVC 1.5) */
+    0x34,                           /* Descriptor size: 52 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    CY_FX_UVC_VS_FORMAT_H264_SIMULCAST, /* Descriptor subtype : VS_FORMAT_H264_SIMULCAST */
+    0x06,                           /* Format desciptor index */
+    0x01,                           /* 1 Frame desciptor(s) follow */
+    0x01,                           /* Default frame index is 1 */
+    0x01,                           /* bMaxCodecConfigDelay : 1 frame */
+    0x06,                           /* bmSupportedSliceModes : target compressed size per slice, number of slices per frame */
+    0x0A,                           /* bmSupportedSyncFrameTypes : IDR, random access */
+    0x00,                           /* bResolutionScaling : not supported */
+    0x00,                           /* Reserved */
+    0x07,                           /* bmSupportedRateControlModes : VBR, CBR, constant QP */
+    0x00,0x00,                      /* wMaxMBperSec for fewer resolutions : not supported */
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x3C,0x00,                      /* wMaxMBperSec, two resolutions, no scalability : 60 x 1000 MB/s */
+    0x00,0x00,                      /* wMaxMBperSec for more resolutions and scalable streams : not supported */
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+
+    /* Class specific VS frame descriptor : H.264 simulcast 1280 x 720 */
+    0x38,                           /* Descriptor size: 56 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    CY_FX_UVC_VS_FRAME_H264,        /* Descriptor subtype : VS_FRAME_H264 */
+    0x01,                           /* Frame desciptor index */
+    0x00,0x05,                      /* Width of the frame : 1280 */
+    0xD0,0x02,                      /* Height of the frame : 720 */
+    0x01,0x00,                      /* wSARwidth : square pixels */
+    0x01,0x00,                      /* wSARheight : square pixels */
+    0xC0,0x42,                      /* wProfile : profile_idc 66, constraint flags 0xC0 */
+    0x1F,                           /* bLevelIDC : level 3.1 */
+    0x00,0x00,                      /* wConstrainedToolset : reserved */
+    0x01,0x00,0x00,0x00,            /* bmSupportedUsages : real time */
+    0x25,0x00,                      /* bmCapabilities : CAVLC, constant frame rate, no reordering */
+    0x00,0x00,0x00,0x00,            /* bmSVCCapabilities : no SVC */
+    0x00,0x00,0x00,0x00,            /* bmMVCCapabilities : no MVC */
+    0x00,0x30,0x00,0x00,            /* Min bit rate bits/s */
+    0xF9,0xFF,0x01,0x00,            /* Max bit rate bits/s */
+    0x15,0x16,0x05,0x00,            /* Default frame interval : 30 fps */
+    0x03,                           /* Frame interval type : 3 discrete setting(s) */
+    0x15,0x16,0x05,0x00,            /* Frame interval : 30 fps */
+    0x2A,0x2C,0x0A,0x00,            /* Frame interval : 15 fps */
+    0x55,0x58,0x14,0x00,            /* Frame interval : 7.5 fps */
+
+    /* Endpoint descriptor for BULK streaming video data */
     0x07,                           /* Descriptor size */
     CY_U3P_USB_ENDPNT_DESCR,        /* Endpoint descriptor type */
     CY_FX_EP_BULK_VIDEO,            /* Endpoint address and description */
     CY_U3P_USB_EP_BULK,             /* Bulk End Point */
-    0x00, 0x04,                     /* Maximum packet size. */
+    0x00,0x04,                      /* Maximum packet size : 1024 bytes */
     0x00,                           /* Servicing interval for data transfers */
 
     /* Super speed endpoint companion descriptor */
     0x06,                           /* Descriptor size */
     CY_U3P_SS_EP_COMPN_DESCR,       /* SS endpoint companion descriptor type */
-    0x07,                           /* Max no. of packets in a Burst : 8 */
+    CY_FX_BULK_BURST - 1,           /* Max no. of packets in a Burst */
     0x00,                           /* Mult.: Max number of packets : 1 */
-    0x00,0x00                  	    /* Field Valid only for Periodic Endpoints */
-
+    0x00,0x00                       /* Field Valid only for Periodic Endpoints */
 };
 
-/* Standard High Speed Configuration Descriptor */
+/* Standard high speed configuration descriptor (950 bytes) */
 const uint8_t CyFxUSBHSConfigDscr[] __attribute__ ((aligned (32))) =
 {
     /* Configuration descriptor */
     0x09,                           /* Descriptor size */
     CY_U3P_USB_CONFIG_DESCR,        /* Configuration descriptor type */
-    0xCB,0x00,                      /* Length of this descriptor and all sub descriptors */
+    0xB6,0x03,                      /* Length of this descriptor and all sub descriptors */
     0x02,                           /* Number of interfaces */
     0x01,                           /* Configuration number */
-    0x00,                           /* COnfiguration string index */
-    0x80,                           /* Config characteristics - bus powered */
+    0x00,                           /* Configuration string index */
+    0x80,                           /* Config characteristics - Bus powered */
     0xC8,                           /* Max power consumption of device (in 2mA unit) : 400mA */
 
     /* Interface association descriptor */
     0x08,                           /* Descriptor size */
     CY_FX_INTF_ASSN_DSCR_TYPE,      /* Interface association descr type */
     0x00,                           /* I/f number of first video control i/f */
-    0x02,                           /* Number of video streaming i/f */
+    0x02,                           /* Number of video i/f */
     0x0E,                           /* CC_VIDEO : Video i/f class code */
-    0x03,                           /* SC_VIDEO_INTERFACE_COLLECTION : subclass code */
-    0x00,                           /* Protocol : not used */
+    0x03,                           /* SC_VIDEO_INTERFACE_COLLECTION : Subclass code */
+    0x00,                           /* Protocol : Not used */
     0x00,                           /* String desc index for interface */
 
     /* Standard video control interface descriptor */
@@ -346,56 +717,56 @@ const uint8_t CyFxUSBHSConfigDscr[] __attribute__ ((aligned (32))) =
     0x00,                           /* Interface descriptor string index */
 
     /* Class specific VC interface header descriptor */
-    0x0D,                           /* Descriptor size */
-    0x24,                           /* Class Specific I/f header descriptor type */
+    0x0D,                           /* Descriptor size: 13 bytes */
+    0x24,                           /* Class specific i/f header descriptor type */
     0x01,                           /* Descriptor sub type : VC_HEADER */
     0x50,0x01,                      /* Revision of class spec : 1.5 */
     0x5E,0x00,                      /* Total size of class specific descriptors (till output terminal) */
     0x00,0x6C,0xDC,0x02,            /* Clock frequency : 48MHz */
     0x01,                           /* Number of streaming interfaces */
-    0x01,                           /* Video streaming I/f 1 belongs to VC i/f */
+    0x01,                           /* Video streaming i/f 1 belongs to VC i/f */
 
     /* Input (camera) terminal descriptor */
-    0x12,                           /* Descriptor size */
+    0x12,                           /* Descriptor size: 18 bytes */
     0x24,                           /* Class specific interface desc type */
     0x02,                           /* Input Terminal Descriptor type */
     0x01,                           /* ID of this terminal */
     0x01,0x02,                      /* Camera terminal type */
     0x00,                           /* No association terminal */
-    0x00,                           /* String desc index : not used */
+    0x00,                           /* String desc index : Not used */
     0x00,0x00,                      /* No optical zoom supported */
     0x00,0x00,                      /* No optical zoom supported */
     0x00,0x00,                      /* No optical zoom supported */
     0x03,                           /* Size of controls field for this terminal : 3 bytes */
-    0x00,0x00,0x00,                 /* No controls supported */
+    0x0A,0x00,0x00,                 /* Controls supported */
 
     /* Processing unit descriptor */
-    0x0D,                           /* Descriptor size */
+    0x0D,                           /* Descriptor size: 13 bytes */
     0x24,                           /* Class specific interface desc type */
     0x05,                           /* Processing unit descriptor type */
-    0x02,                           /* ID of this terminal */
-    0x01,                           /* Source ID : 1 : connected to input terminal */
+    0x02,                           /* ID of this unit */
+    0x01,                           /* Source ID : 1 : Connected to input terminal */
     0x00,0x40,                      /* Digital multiplier */
-    0x03,                           /* Size of controls field for this terminal : 3 bytes */
-    0x00,0x00,0x00,                 /* No controls supported */
-    0x00,                           /* String desc index : not used */
-    0x00,                           /* No analog mode support. */
+    0x03,                           /* Size of controls field for this unit : 3 bytes */
+    0x0B,0x06,0x00,                 /* Controls supported */
+    0x00,                           /* String desc index : Not used */
+    0x00,                           /* No analog modes supported. */
 
     /* Extension unit descriptor */
-    0x1C,                           /* Descriptor size */
+    0x1C,                           /* Descriptor size: 28 bytes */
     0x24,                           /* Class specific interface desc type */
     0x06,                           /* Extension unit descriptor type */
-    0x03,                           /* ID of this terminal */
+    0x03,                           /* ID of this unit */
     0xFF,0xFF,0xFF,0xFF,            /* 16 byte GUID */
     0xFF,0xFF,0xFF,0xFF,
     0xFF,0xFF,0xFF,0xFF,
     0xFF,0xFF,0xFF,0xFF,
-    0x00,                           /* Number of controls in this terminal */
-    0x01,                           /* Number of input pins in this terminal */
-    0x02,                           /* Source ID : 2 : connected to proc unit */
-    0x03,                           /* Size of controls field for this terminal : 3 bytes */
-    0x00,0x00,0x00,                 /* No controls supported */
-    0x00,                           /* String desc index : not used */
+    0x00,                           /* Number of controls in this unit */
+    0x01,                           /* Number of input pins in this unit */
+    0x02,                           /* Source ID : 2 : Connected to proc unit */
+    0x03,                           /* Size of controls field for this unit : 3 bytes */
+    0x00,0x00,0x00,                 /* Controls supported */
+    0x00,                           /* String desc index : Not used */
 
     /* Encoding unit descriptor (UVC 1.5) */
     0x0D,                           /* Descriptor size: 13 bytes */
@@ -404,19 +775,19 @@ const uint8_t CyFxUSBHSConfigDscr[] __attribute__ ((aligned (32))) =
     0x05,                           /* ID of this unit */
     0x03,                           /* Source ID : 3 : Connected to extn unit */
     0x00,                           /* iEncoding: String descriptor index */
-    0x00,                           /* bControlSize: Size of controls field */
-    0x01,                           /* bControlsType: Bitmap indicating supported controls */
-    0x00,0x00,0x00,                 /* bmControls: Controls supported (placeholder) */
+    0x03,                           /* bControlSize: Size of controls field : 3 bytes */
+    0xF1,0x07,0x0C,                 /* bmControls: Controls supported */
+    0xF1,0x07,0x0C,                 /* bmControlsRuntime: Controls settable while streaming */
 
     /* Output terminal descriptor */
-    0x09,                           /* Descriptor size */
+    0x09,                           /* Descriptor size: 9 bytes */
     0x24,                           /* Class specific interface desc type */
     0x03,                           /* Output terminal descriptor type */
     0x04,                           /* ID of this terminal */
-    0x01,0x01,                      /* USB Streaming terminal type */
+    0x01,0x01,                      /* USB streaming terminal type */
     0x00,                           /* No association terminal */
     0x05,                           /* Source ID : 5 : Connected to encoding unit */
-    0x00,                           /* String desc index : not used */
+    0x00,                           /* String desc index : Not used */
 
     /* Video control status interrupt endpoint descriptor */
     0x07,                           /* Descriptor size */
@@ -424,92 +795,461 @@ const uint8_t CyFxUSBHSConfigDscr[] __attribute__ ((aligned (32))) =
     CY_FX_EP_CONTROL_STATUS,        /* Endpoint address and description */
     CY_U3P_USB_EP_INTR,             /* Interrupt end point type */
     0x40,0x00,                      /* Max packet size = 64 bytes */
-    0x08,                           /* Servicing interval : 8ms */
+    0x08,                           /* Servicing interval */
 
     /* Class specific interrupt endpoint descriptor */
     0x05,                           /* Descriptor size */
     0x25,                           /* Class specific endpoint descriptor type */
     CY_U3P_USB_EP_INTR,             /* End point sub type */
-    0x40,0x00,                      /* Max packet size = 64 bytes */
+    0x40,0x00,                      /* Max packet size = 64 */
 
-    /* Standard video streaming interface descriptor (alternate setting 0) */
+    /* Standard video streaming interface descriptor (Alternate setting 0) */
     0x09,                           /* Descriptor size */
     CY_U3P_USB_INTRFC_DESCR,        /* Interface descriptor type */
     0x01,                           /* Interface number */
     0x00,                           /* Alternate setting number */
-    0x01,                           /* Number of end points : zero bandwidth */
+    0x01,                           /* Number of end points : One bulk */
     0x0E,                           /* Interface class : CC_VIDEO */
     0x02,                           /* Interface sub class : CC_VIDEOSTREAMING */
-    0x00,                           /* Interface protocol code : undefined */
+    0x00,                           /* Interface protocol code : Undefined */
     0x00,                           /* Interface descriptor string index */
 
     /* Class-specific video streaming input header descriptor */
-    0x0E,                           /* Descriptor size */
+    0x13,                           /* Descriptor size: 19 bytes */
     0x24,                           /* Class-specific VS i/f type */
     0x01,                           /* Descriptor subtype : input header */
-    0x01,                           /* 1 format desciptor follows */
-    0x37,0x00,                      /* Total size of class specific VS descr = 55 bytes */
+    0x06,                           /* 6 format desciptor(s) follow */
+    0x22,0x03,                      /* Total size of class specific VS descr: 802 bytes */
     CY_FX_EP_BULK_VIDEO,            /* EP address for BULK video data */
     0x00,                           /* No dynamic format change supported */
     0x04,                           /* Output terminal ID : 4 */
-    0x00,                           /* No still image capture support. */
+    0x00,                           /* No still image capture supported. */
     0x00,                           /* No hardware trigger support. */
     0x00,                           /* Hardware to initiate still image capture */
     0x01,                           /* Size of controls field : 1 byte */
-    0x00,                           /* D2 : Compression quality supported */
+    0x00,                           /* bmaControls for format 1 */
+    0x00,                           /* bmaControls for format 2 */
+    0x00,                           /* bmaControls for format 3 */
+    0x00,                           /* bmaControls for format 4 */
+    0x00,                           /* bmaControls for format 5 */
+    0x00,                           /* bmaControls for format 6 */
 
-    /* Class specific VS format descriptor */
-    0x0B,                           /* Descriptor size */
+    /* Class specific VS format descriptor : MJPEG */
+    0x0B,                           /* Descriptor size: 11 bytes */
     0x24,                           /* Class-specific VS i/f type */
     0x06,                           /* Descriptor subtype : VS_FORMAT_MJPEG */
     0x01,                           /* Format desciptor index */
-    0x01,                           /* 1 Frame desciptor follows */
-    0x01,                           /* Uses fixed size samples */
+    0x03,                           /* 3 Frame desciptor(s) follow */
+    0x00,                           /* Variable size samples */
     0x01,                           /* Default frame index is 1 */
-    0x00,                           /* Non interlaced stream not reqd. */
-    0x00,                           /* Non interlaced stream not reqd. */
+    0x00,                           /* Aspect ratio X : Not used */
+    0x00,                           /* Aspect ratio Y : Not used */
     0x00,                           /* Non interlaced stream */
     0x00,                           /* CopyProtect: duplication unrestricted */
 
-    /* Class specific VS frame descriptor */
-    0x1E,                           /* Descriptor size */
-    0x24,                           /* Class-specific VS I/f Type */
+    /* Class specific VS frame descriptor : 640 x 480 */
+    0x26,                           /* Descriptor size: 38 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    0x07,                           /* Descriptor subtype : VS_FRAME_MJPEG */
+    0x01,                           /* Frame desciptor index */
+    0x00,                           /* Still image capture method not supported */
+    0x80,0x02,                      /* Width of the frame : 640 */
+    0xE0,0x01,                      /* Height of the frame : 480 */
+    0x10,0x6B,0x0C,0x00,            /* Min bit rate bits/s */
+    0x43,0xAC,0x31,0x00,            /* Max bit rate bits/s */
+    0x8F,0x35,0x00,0x00,            /* Maximum video or still frame size in bytes */
+    0x2A,0x2C,0x0A,0x00,            /* Default frame interval : 15 fps */
+    0x03,                           /* Frame interval type : 3 discrete setting(s) */
+    0x15,0x16,0x05,0x00,            /* Frame interval : 30 fps */
+    0x2A,0x2C,0x0A,0x00,            /* Frame interval : 15 fps */
+    0x55,0x58,0x14,0x00,            /* Frame interval : 7.5 fps */
+
+    /* Class specific VS frame descriptor : 320 x 240 */
+    0x26,                           /* Descriptor size: 38 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    0x07,                           /* Descriptor subtype : VS_FRAME_MJPEG */
+    0x02,                           /* Frame desciptor index */
+    0x00,                           /* Still image capture method not supported */
+    0x40,0x01,                      /* Width of the frame : 320 */
+    0xF0,0x00,                      /* Height of the frame : 240 */
+    0x4C,0xDE,0x02,0x00,            /* Min bit rate bits/s */
+    0x30,0x79,0x0B,0x00,            /* Max bit rate bits/s */
+    0x43,0x0C,0x00,0x00,            /* Maximum video or still frame size in bytes */
+    0x2A,0x2C,0x0A,0x00,            /* Default frame interval : 15 fps */
+    0x03,                           /* Frame interval type : 3 discrete setting(s) */
+    0x15,0x16,0x05,0x00,            /* Frame interval : 30 fps */
+    0x2A,0x2C,0x0A,0x00,            /* Frame interval : 15 fps */
+    0x55,0x58,0x14,0x00,            /* Frame interval : 7.5 fps */
+
+    /* Class specific VS frame descriptor : 1280 x 720 */
+    0x26,                           /* Descriptor size: 38 bytes */
+    0x24,                           /* Class-specific VS i/f type */
     0x07,                           /* Descriptor subtype : VS_FRAME_MJPEG */
+    0x03,                           /* Frame desciptor index */
+    0x00,                           /* Still image capture method not supported */
+    0x00,0x05,                      /* Width of the frame : 1280 */
+    0xD0,0x02,                      /* Height of the frame : 720 */
+    0x70,0xA4,0x09,0x00,            /* Min bit rate bits/s */
+    0xC2,0x91,0x26,0x00,            /* Max bit rate bits/s */
+    0x2B,0x29,0x00,0x00,            /* Maximum video or still frame size in bytes */
+    0x2A,0x2C,0x0A,0x00,            /* Default frame interval : 15 fps */
+    0x03,                           /* Frame interval type : 3 discrete setting(s) */
+    0x15,0x16,0x05,0x00,            /* Frame interval : 30 fps */
+    0x2A,0x2C,0x0A,0x00,            /* Frame interval : 15 fps */
+    0x55,0x58,0x14,0x00,            /* Frame interval : 7.5 fps */
+
+    /* Class specific VS format descriptor : YUY2 */
+    0x1B,                           /* Descriptor size: 27 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    0x04,                           /* Descriptor subtype : VS_FORMAT_UNCOMPRESSED */
+    0x02,                           /* Format desciptor index */
+    0x03,                           /* 3 Frame desciptor(s) follow */
+    0x59,0x55,0x59,0x32,            /* GUID : YUY2 */
+    0x00,0x00,0x10,0x00,
+    0x80,0x00,0x00,0xAA,
+    0x00,0x38,0x9B,0x71,
+    0x10,                           /* Bits per pixel : 16 */
+    0x01,                           /* Default frame index is 1 */
+    0x00,                           /* Aspect ratio X : Not used */
+    0x00,                           /* Aspect ratio Y : Not used */
+    0x00,                           /* Non interlaced stream */
+    0x00,                           /* CopyProtect: duplication unrestricted */
+
+    /* Class specific VS frame descriptor : 640 x 480 */
+    0x26,                           /* Descriptor size: 38 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    0x05,                           /* Descriptor subtype : VS_FRAME_UNCOMPRESSED */
+    0x01,                           /* Frame desciptor index */
+    0x00,                           /* Still image capture method not supported */
+    0x80,0x02,                      /* Width of the frame : 640 */
+    0xE0,0x01,                      /* Height of the frame : 480 */
+    0x09,0x80,0x32,0x02,            /* Min bit rate bits/s */
+    0x93,0x00,0xCA,0x08,            /* Max bit rate bits/s */
+    0x00,0x60,0x09,0x00,            /* Maximum video or still frame size in bytes */
+    0x2A,0x2C,0x0A,0x00,            /* Default frame interval : 15 fps */
+    0x03,                           /* Frame interval type : 3 discrete setting(s) */
+    0x15,0x16,0x05,0x00,            /* Frame interval : 30 fps */
+    0x2A,0x2C,0x0A,0x00,            /* Frame interval : 15 fps */
+    0x55,0x58,0x14,0x00,            /* Frame interval : 7.5 fps */
+
+    /* Class specific VS frame descriptor : 1280 x 720 */
+    0x26,                           /* Descriptor size: 38 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    0x05,                           /* Descriptor subtype : VS_FRAME_UNCOMPRESSED */
+    0x02,                           /* Frame desciptor index */
+    0x00,                           /* Still image capture method not supported */
+    0x00,0x05,                      /* Width of the frame : 1280 */
+    0xD0,0x02,                      /* Height of the frame : 720 */
+    0x1B,0x80,0x97,0x06,            /* Min bit rate bits/s */
+    0xBA,0x01,0x5E,0x1A,            /* Max bit rate bits/s */
+    0x00,0x20,0x1C,0x00,            /* Maximum video or still frame size in bytes */
+    0x2A,0x2C,0x0A,0x00,            /* Default frame interval : 15 fps */
+    0x03,                           /* Frame interval type : 3 discrete setting(s) */
+    0x15,0x16,0x05,0x00,            /* Frame interval : 30 fps */
+    0x2A,0x2C,0x0A,0x00,            /* Frame interval : 15 fps */
+    0x55,0x58,0x14,0x00,            /* Frame interval : 7.5 fps */
+
+    /* Class specific VS frame descriptor : 1920 x 1080 */
+    0x26,                           /* Descriptor size: 38 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    0x05,                           /* Descriptor subtype : VS_FRAME_UNCOMPRESSED */
+    0x03,                           /* Frame desciptor index */
+    0x00,                           /* Still image capture method not supported */
+    0x80,0x07,                      /* Width of the frame : 1920 */
+    0x38,0x04,                      /* Height of the frame : 1080 */
+    0x3E,0xE0,0xD4,0x0E,            /* Min bit rate bits/s */
+    0xE3,0x83,0x53,0x3B,            /* Max bit rate bits/s */
+    0x00,0x48,0x3F,0x00,            /* Maximum video or still frame size in bytes */
+    0x2A,0x2C,0x0A,0x00,            /* Default frame interval : 15 fps */
+    0x03,                           /* Frame interval type : 3 discrete setting(s) */
+    0x15,0x16,0x05,0x00,            /* Frame interval : 30 fps */
+    0x2A,0x2C,0x0A,0x00,            /* Frame interval : 15 fps */
+    0x55,0x58,0x14,0x00,            /* Frame interval : 7.5 fps */
+
+    /* Class specific VS format descriptor : NV12 */
+    0x1B,                           /* Descriptor size: 27 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    0x04,                           /* Descriptor subtype : VS_FORMAT_UNCOMPRESSED */
+    0x03,                           /* Format desciptor index */
+    0x03,                           /* 3 Frame desciptor(s) follow */
+    0x4E,0x56,0x31,0x32,            /* GUID : NV12 */
+    0x00,0x00,0x10,0x00,
+    0x80,0x00,0x00,0xAA,
+    0x00,0x38,0x9B,0x71,
+    0x0C,                           /* Bits per pixel : 12 */
+    0x01,                           /* Default frame index is 1 */
+    0x00,                           /* Aspect ratio X : Not used */
+    0x00,                           /* Aspect ratio Y : Not used */
+    0x00,                           /* Non interlaced stream */
+    0x00,                           /* CopyProtect: duplication unrestricted */
+
+    /* Class specific VS frame descriptor : 640 x 480 */
+    0x26,                           /* Descriptor size: 38 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    0x05,                           /* Descriptor subtype : VS_FRAME_UNCOMPRESSED */
+    0x01,                           /* Frame desciptor index */
+    0x00,                           /* Still image capture method not supported */
+    0x80,0x02,                      /* Width of the frame : 640 */
+    0xE0,0x01,                      /* Height of the frame : 480 */
+    0x06,0xE0,0xA5,0x01,            /* Min bit rate bits/s */
+    0x6E,0x80,0x97,0x06,            /* Max bit rate bits/s */
+    0x00,0x08,0x07,0x00,            /* Maximum video or still frame size in bytes */
+    0x2A,0x2C,0x0A,0x00,            /* Default frame interval : 15 fps */
+    0x03,                           /* Frame interval type : 3 discrete setting(s) */
+    0x15,0x16,0x05,0x00,            /* Frame interval : 30 fps */
+    0x2A,0x2C,0x0A,0x00,            /* Frame interval : 15 fps */
+    0x55,0x58,0x14,0x00,            /* Frame interval : 7.5 fps */
+
+    /* Class specific VS frame descriptor : 1280 x 720 */
+    0x26,                           /* Descriptor size: 38 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    0x05,                           /* Descriptor subtype : VS_FRAME_UNCOMPRESSED */
+    0x02,                           /* Frame desciptor index */
+    0x00,                           /* Still image capture method not supported */
+    0x00,0x05,                      /* Width of the frame : 1280 */
+    0xD0,0x02,                      /* Height of the frame : 720 */
+    0x14,0xA0,0xF1,0x04,            /* Min bit rate bits/s */
+    0x4B,0x81,0xC6,0x13,            /* Max bit rate bits/s */
+    0x00,0x18,0x15,0x00,            /* Maximum video or still frame size in bytes */
+    0x2A,0x2C,0x0A,0x00,            /* Default frame interval : 15 fps */
+    0x03,                           /* Frame interval type : 3 discrete setting(s) */
+    0x15,0x16,0x05,0x00,            /* Frame interval : 30 fps */
+    0x2A,0x2C,0x0A,0x00,            /* Frame interval : 15 fps */
+    0x55,0x58,0x14,0x00,            /* Frame interval : 7.5 fps */
+
+    /* Class specific VS frame descriptor : 1920 x 1080 */
+    0x26,                           /* Descriptor size: 38 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    0x05,                           /* Descriptor subtype : VS_FRAME_UNCOMPRESSED */
+    0x03,                           /* Frame desciptor index */
+    0x00,                           /* Still image capture method not supported */
+    0x80,0x07,                      /* Width of the frame : 1920 */
+    0x38,0x04,                      /* Height of the frame : 1080 */
+    0x2E,0xA8,0x1F,0x0B,            /* Min bit rate bits/s */
+    0xEA,0xA2,0x7E,0x2C,            /* Max bit rate bits/s */
+    0x00,0x76,0x2F,0x00,            /* Maximum video or still frame size in bytes */
+    0x2A,0x2C,0x0A,0x00,            /* Default frame interval : 15 fps */
+    0x03,                           /* Frame interval type : 3 discrete setting(s) */
+    0x15,0x16,0x05,0x00,            /* Frame interval : 30 fps */
+    0x2A,0x2C,0x0A,0x00,            /* Frame interval : 15 fps */
+    0x55,0x58,0x14,0x00,            /* Frame interval : 7.5 fps */
+
+    /* Class specific VS format descriptor : H.264 (UVC 1.5) */
+    0x34,                           /* Descriptor size: 52 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    CY_FX_UVC_VS_FORMAT_H264,       /* Descriptor subtype : VS_FORMAT_H264 */
+    0x04,                           /* Format desciptor index */
+    0x02,                           /* 2 Frame desciptor(s) follow */
+    0x01,                           /* Default frame index is 1 */
+    0x01,                           /* bMaxCodecConfigDelay : 1 frame */
+    0x06,                           /* bmSupportedSliceModes : target compressed size per slice, number of slices per frame */
+    0x0A,                           /* bmSupportedSyncFrameTypes : IDR, random access */
+    0x00,                           /* bResolutionScaling : not supported */
+    0x00,                           /* Reserved */
+    0x07,                           /* bmSupportedRateControlModes : VBR, CBR, constant QP */
+    0x6C,0x00,                      /* wMaxMBperSec, one resolution, no scalability : 108 x 1000 MB/s */
+    0x00,0x00,                      /* wMaxMBperSec for more resolutions and scalable streams : not supported */
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+
+    /* Class specific VS frame descriptor : H.264 640 x 480 */
+    0x38,                           /* Descriptor size: 56 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    CY_FX_UVC_VS_FRAME_H264,        /* Descriptor subtype : VS_FRAME_H264 */
+    0x01,                           /* Frame desciptor index */
+    0x80,0x02,                      /* Width of the frame : 640 */
+    0xE0,0x01,                      /* Height of the frame : 480 */
+    0x01,0x00,                      /* wSARwidth : square pixels */
+    0x01,0x00,                      /* wSARheight : square pixels */
+    0xC0,0x42,                      /* wProfile : profile_idc 66, constraint flags 0xC0 */
+    0x1F,                           /* bLevelIDC : level 3.1 */
+    0x00,0x00,                      /* wConstrainedToolset : reserved */
+    0x01,0x00,0x00,0x00,            /* bmSupportedUsages : real time */
+    0x25,0x00,                      /* bmCapabilities : CAVLC, constant frame rate, no reordering */
+    0x00,0x00,0x00,0x00,            /* bmSVCCapabilities : no SVC */
+    0x00,0x00,0x00,0x00,            /* bmMVCCapabilities : no MVC */
+    0x28,0x23,0x00,0x00,            /* Min bit rate bits/s */
+    0x28,0xB8,0x01,0x00,            /* Max bit rate bits/s */
+    0x2A,0x2C,0x0A,0x00,            /* Default frame interval : 15 fps */
+    0x03,                           /* Frame interval type : 3 discrete setting(s) */
+    0x15,0x16,0x05,0x00,            /* Frame interval : 30 fps */
+    0x2A,0x2C,0x0A,0x00,            /* Frame interval : 15 fps */
+    0x55,0x58,0x14,0x00,            /* Frame interval : 7.5 fps */
+
+    /* Class specific VS frame descriptor : H.264 1280 x 720 */
+    0x38,                           /* Descriptor size: 56 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    CY_FX_UVC_VS_FRAME_H264,        /* Descriptor subtype : VS_FRAME_H264 */
+    0x02,                           /* Frame desciptor index */
+    0x00,0x05,                      /* Width of the frame : 1280 */
+    0xD0,0x02,                      /* Height of the frame : 720 */
+    0x01,0x00,                      /* wSARwidth : square pixels */
+    0x01,0x00,                      /* wSARheight : square pixels */
+    0xC0,0x42,                      /* wProfile : profile_idc 66, constraint flags 0xC0 */
+    0x1F,                           /* bLevelIDC : level 3.1 */
+    0x00,0x00,                      /* wConstrainedToolset : reserved */
+    0x01,0x00,0x00,0x00,            /* bmSupportedUsages : real time */
+    0x25,0x00,                      /* bmCapabilities : CAVLC, constant frame rate, no reordering */
+    0x00,0x00,0x00,0x00,            /* bmSVCCapabilities : no SVC */
+    0x00,0x00,0x00,0x00,            /* bmMVCCapabilities : no MVC */
+    0x5E,0x43,0x00,0x00,            /* Min bit rate bits/s */
+    0x4B,0x76,0x02,0x00,            /* Max bit rate bits/s */
+    0x2A,0x2C,0x0A,0x00,            /* Default frame interval : 15 fps */
+    0x03,                           /* Frame interval type : 3 discrete setting(s) */
+    0x15,0x16,0x05,0x00,            /* Frame interval : 30 fps */
+    0x2A,0x2C,0x0A,0x00,            /* Frame interval : 15 fps */
+    0x55,0x58,0x14,0x00,            /* Frame interval : 7.5 fps */
+
+    /* Class specific VS format descriptor : H.265 (frame based) */
+    0x1C,                           /* Descriptor size: 28 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    CY_FX_UVC_VS_FORMAT_FRAME_BASED, /* Descriptor subtype : VS_FORMAT_FRAME_BASED */
+    0x05,                           /* Format desciptor index */
+    0x02,                           /* 2 Frame desciptor(s) follow */
+    0x48,0x32,0x36,0x35,            /* GUID : H265 */
+    0x00,0x00,0x10,0x00,
+    0x80,0x00,0x00,0xAA,
+    0x00,0x38,0x9B,0x71,
+    0x00,                           /* Bits per pixel : not applicable */
+    0x01,                           /* Default frame index is 1 */
+    0x00,                           /* Aspect ratio X : Not used */
+    0x00,                           /* Aspect ratio Y : Not used */
+    0x00,                           /* Non interlaced stream */
+    0x00,                           /* CopyProtect: duplication unrestricted */
+    0x01,                           /* Variable size frames */
+
+    /* Class specific VS frame descriptor : H.265 640 x 480 */
+    0x26,                           /* Descriptor size: 38 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    CY_FX_UVC_VS_FRAME_FRAME_BASED, /* Descriptor subtype : VS_FRAME_FRAME_BASED */
     0x01,                           /* Frame desciptor index */
     0x00,                           /* Still image capture method not supported */
-    0x80,0x02,                      /* Width of the frame  : 640 */
+    0x80,0x02,                      /* Width of the frame : 640 */
     0xE0,0x01,                      /* Height of the frame : 480 */
-    0x00,0xC0,0x5D,0x00,            /* Min bit rate bits/s */
-    0x00,0xC0,0x5D,0x00,            /* Max bit rate bits/s */
-    0x00,0x58,0x02,0x00,            /* Maximum video or still frame size in bytes */
-    0x2A,0x2C,0x0A,0x00,            /* Default frame interval */
-    0x01,                           /* 1 Frame interval type : No of discrete intervals */
-    0x2A,0x2C,0x0A,0x00,            /* Frame interval=15 fps */
-
-    /* Endpoint descriptor for streaming video data */
+    0xBE,0x5B,0x00,0x00,            /* Min bit rate bits/s */
+    0xF9,0x6E,0x01,0x00,            /* Max bit rate bits/s */
+    0x2A,0x2C,0x0A,0x00,            /* Default frame interval : 15 fps */
+    0x03,                           /* Frame interval type : 3 discrete setting(s) */
+    0x00,0x00,0x00,0x00,            /* Bytes per line : not applicable to compressed frames */
+    0x15,0x16,0x05,0x00,            /* Frame interval : 30 fps */
+    0x2A,0x2C,0x0A,0x00,            /* Frame interval : 15 fps */
+    0x55,0x58,0x14,0x00,            /* Frame interval : 7.5 fps */
+
+    /* Class specific VS frame descriptor : H.265 1280 x 720 */
+    0x26,                           /* Descriptor size: 38 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    CY_FX_UVC_VS_FRAME_FRAME_BASED, /* Descriptor subtype : VS_FRAME_FRAME_BASED */
+    0x02,                           /* Frame desciptor index */
+    0x00,                           /* Still image capture method not supported */
+    0x00,0x05,                      /* Width of the frame : 1280 */
+    0xD0,0x02,                      /* Height of the frame : 720 */
+    0x2B,0x89,0x00,0x00,            /* Min bit rate bits/s */
+    0xAC,0x24,0x02,0x00,            /* Max bit rate bits/s */
+    0x2A,0x2C,0x0A,0x00,            /* Default frame interval : 15 fps */
+    0x03,                           /* Frame interval type : 3 discrete setting(s) */
+    0x00,0x00,0x00,0x00,            /* Bytes per line : not applicable to compressed frames */
+    0x15,0x16,0x05,0x00,            /* Frame interval : 30 fps */
+    0x2A,0x2C,0x0A,0x00,            /* Frame interval : 15 fps */
+    0x55,0x58,0x14,0x00,            /* Frame interval : 7.5 fps */
+
+    /* Class specific VS format descriptor : H.264 simulcast (UVC 1.5) */
+    0x34,                           /* Descriptor size: 52 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    CY_FX_UVC_VS_FORMAT_H264_SIMULCAST, /* Descriptor subtype : VS_FORMAT_H264_SIMULCAST */
+    0x06,                           /* Format desciptor index */
+    0x01,                           /* 1 Frame desciptor(s) follow */
+    0x01,                           /* Default frame index is 1 */
+    0x01,                           /* bMaxCodecConfigDelay : 1 frame */
+    0x06,                           /* bmSupportedSliceModes : target compressed size per slice, number of slices per frame */
+    0x0A,                           /* bmSupportedSyncFrameTypes : IDR, random access */
+    0x00,                           /* bResolutionScaling : not supported */
+    0x00,                           /* Reserved */
+    0x07,                           /* bmSupportedRateControlModes : VBR, CBR, constant QP */
+    0x00,0x00,                      /* wMaxMBperSec for fewer resolutions : not supported */
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x3C,0x00,                      /* wMaxMBperSec, two resolutions, no scalability : 60 x 1000 MB/s */
+    0x00,0x00,                      /* wMaxMBperSec for more resolutions and scalable streams : not supported */
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+    0x00,0x00,
+
+    /* Class specific VS frame descriptor : H.264 simulcast 1280 x 720 */
+    0x38,                           /* Descriptor size: 56 bytes */
+    0x24,                           /* Class-specific VS i/f type */
+    CY_FX_UVC_VS_FRAME_H264,        /* Descriptor subtype : VS_FRAME_H264 */
+    0x01,                           /* Frame desciptor index */
+    0x00,0x05,                      /* Width of the frame : 1280 */
+    0xD0,0x02,                      /* Height of the frame : 720 */
+    0x01,0x00,                      /* wSARwidth : square pixels */
+    0x01,0x00,                      /* wSARheight : square pixels */
+    0xC0,0x42,                      /* wProfile : profile_idc 66, constraint flags 0xC0 */
+    0x1F,                           /* bLevelIDC : level 3.1 */
+    0x00,0x00,                      /* wConstrainedToolset : reserved */
+    0x01,0x00,0x00,0x00,            /* bmSupportedUsages : real time */
+    0x25,0x00,                      /* bmCapabilities : CAVLC, constant frame rate, no reordering */
+    0x00,0x00,0x00,0x00,            /* bmSVCCapabilities : no SVC */
+    0x00,0x00,0x00,0x00,            /* bmMVCCapabilities : no MVC */
+    0x00,0x30,0x00,0x00,            /* Min bit rate bits/s */
+    0xF9,0xFF,0x01,0x00,            /* Max bit rate bits/s */
+    0x15,0x16,0x05,0x00,            /* Default frame interval : 30 fps */
+    0x03,                           /* Frame interval type : 3 discrete setting(s) */
+    0x15,0x16,0x05,0x00,            /* Frame interval : 30 fps */
+    0x2A,0x2C,0x0A,0x00,            /* Frame interval : 15 fps */
+    0x55,0x58,0x14,0x00,            /* Frame interval : 7.5 fps */
+
+    /* Endpoint descriptor for BULK streaming video data */
     0x07,                           /* Descriptor size */
     CY_U3P_USB_ENDPNT_DESCR,        /* Endpoint descriptor type */
     CY_FX_EP_BULK_VIDEO,            /* Endpoint address and description */
-    CY_U3P_USB_EP_BULK,             /* Bulk Endpoint */
-    0x00, 0x02,                     /* 512 Bytes Maximum Packet Size. */
+    CY_U3P_USB_EP_BULK,             /* Bulk End Point */
+    0x00,0x02,                      /* Maximum packet size : 512 bytes */
     0x00                            /* Servicing interval for data transfers */
 };
 
-/* Standard full speed configuration descriptor : full speed is not supported. */
+/* Standard full speed configuration descriptor : full speed is not supported (9 bytes) */
 const uint8_t CyFxUSBFSConfigDscr[] __attribute__ ((aligned (32))) =
 {
     /* Configuration descriptor */
     0x09,                           /* Descriptor size */
     CY_U3P_USB_CONFIG_DESCR,        /* Configuration descriptor type */
     0x09,0x00,                      /* Length of this descriptor and all sub descriptors */
-    0x00,                           /* Number of interfaces */
+    0x00,                           /* Number of interfaces : full speed is not supported */
     0x01,                           /* Configuration number */
-    0x00,                           /* COnfiguration string index */
+    0x00,                           /* Configuration string index */
     0x80,                           /* Config characteristics - bus powered */
     0x32                            /* Max power consumption of device (in 2mA unit) : 100mA */
 };
 
-/* Standard language ID string descriptor */
+/* Standard language ID string descriptor (4 bytes) */
 const uint8_t CyFxUSBStringLangIDDscr[] __attribute__ ((aligned (32))) =
 {
     0x04,                           /* Descriptor size */
@@ -517,7 +1257,7 @@ const uint8_t CyFxUSBStringLangIDDscr[] __attribute__ ((aligned (32))) =
     0x09,0x04                       /* Language ID supported */
 };
 
-/* Standard manufacturer string descriptor */
+/* Standard manufacturer string descriptor (16 bytes) */
 const uint8_t CyFxUSBManufactureDscr[] __attribute__ ((aligned (32))) =
 {
     0x10,                           /* Descriptor size */
@@ -531,10 +1271,10 @@ const uint8_t CyFxUSBManufactureDscr[] __attribute__ ((aligned (32))) =
     's',0x00
 };
 
-/* Standard product string descriptor */
+/* Standard product string descriptor (8 bytes) */
 const uint8_t CyFxUSBProductDscr[] __attribute__ ((aligned (32))) =
 {
-    0x08,                           /* Descriptor Size */
+    0x08,                           /* Descriptor size */
     CY_U3P_USB_STRING_DESCR,        /* Device descriptor type */
     'F',0x00,
     'X',0x00,
@@ -547,4 +1287,3 @@ const uint8_t CyFxUSBProductDscr[] __attribute__ ((aligned (32))) =
 const uint8_t CyFxUsbDscrAlignBuffer[32] __attribute__ ((aligned (32)));
 
 /* [ ] */
-
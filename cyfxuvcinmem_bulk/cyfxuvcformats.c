@@ -0,0 +1,515 @@
+/*
+ ## Cypress USB 3.0 Platform source file (cyfxuvcformats.c)
+ ## ===========================
+ ##
+ ##  Copyright Cypress Semiconductor Corporation, 2010-2023,
+ ##  All Rights Reserved
+ ##  UNPUBLISHED, LICENSED SOFTWARE.
+ ##
+ ##  CONFIDENTIAL AND PROPRIETARY INFORMATION
+ ##  WHICH IS THE PROPERTY OF CYPRESS.
+ ##
+ ##  Use of this file is governed
+ ##  by the license agreement included in the file
+ ##
+ ##     <install>/license/license.txt
+ ##
+ ##  where <install> is the Cypress software
+ ##  installation root directory path.
+ ##
+ ## ===========================
+*/
+
+/* This file contains the table of formats, frames and frame intervals used by the probe and commit
+ * negotiation (cyfxuvcprobe.c). It is generated by tools/fx3_uvc_dscr_gen.py from cyfxuvcstreams.json
+ * together with the descriptors in cyfxuvcdscr.c, so that both always describe the same streams:
+ * edit the stream table and run the generator again instead of editing this file.
+ */
+
+#include "cyfxuvcinmem.h"
+
+/* Video frames stored in cyfxuvcvidframes.c. */
+extern const uint32_t glVidFrameLen320x240[];
+extern const uint8_t glUVCVidFrames320x240[];
+extern const uint32_t glVidFrameLen1280x720[];
+extern const uint8_t glUVCVidFrames1280x720[];
+extern const uint32_t glVidFrameLenH264_640x480[];
+extern const uint8_t glUVCVidFramesH264_640x480[];
+extern const uint32_t glVidFrameLenH264_640x480_QP28[];
+extern const uint8_t glUVCVidFramesH264_640x480_QP28[];
+extern const uint32_t glVidFrameLenH264_640x480_QP40[];
+extern const uint8_t glUVCVidFramesH264_640x480_QP40[];
+extern const uint32_t glVidFrameLenH264_1280x720[];
+extern const uint8_t glUVCVidFramesH264_1280x720[];
+extern const uint32_t glVidFrameLenH264_1280x720_QP28[];
+extern const uint8_t glUVCVidFramesH264_1280x720_QP28[];
+extern const uint32_t glVidFrameLenH264_1280x720_QP40[];
+extern const uint8_t glUVCVidFramesH264_1280x720_QP40[];
+extern const uint32_t glVidFrameLenH265_640x480[];
+extern const uint8_t glUVCVidFramesH265_640x480[];
+extern const uint32_t glVidFrameLenH265_1280x720[];
+extern const uint8_t glUVCVidFramesH265_1280x720[];
+
+/* Format 1 (MJPEG), frame 1 (640 x 480): frame intervals in 100 ns units, shortest first. */
+static const uint32_t glFmt1Frame1Intervals[] = {
+    333333,                             /* 30 fps */
+    666666,                             /* 15 fps */
+    1333333                             /* 7.5 fps */
+};
+
+/* Format 1 (MJPEG), frame 2 (320 x 240): frame intervals in 100 ns units, shortest first. */
+static const uint32_t glFmt1Frame2Intervals[] = {
+    333333,                             /* 30 fps */
+    666666,                             /* 15 fps */
+    1333333                             /* 7.5 fps */
+};
+
+/* Format 1 (MJPEG), frame 3 (1280 x 720): frame intervals in 100 ns units, shortest first. */
+static const uint32_t glFmt1Frame3Intervals[] = {
+    333333,                             /* 30 fps */
+    666666,                             /* 15 fps */
+    1333333                             /* 7.5 fps */
+};
+
+/* Frames of format 1 (MJPEG), in the order of the frame descriptors. */
+static const CyFxUvcFrameInfo_t glFmt1Frames[] = {
+    {
+        1,                                  /* Frame index */
+        640, 480,                           /* Width x height */
+        0x358F,                             /* Maximum video frame buffer size */
+        666666,                             /* Default frame interval: 15 fps */
+        sizeof (glFmt1Frame1Intervals) / sizeof (uint32_t),
+        glFmt1Frame1Intervals,
+        CY_FX_UVC_MAX_VID_FRAMES,           /* Stored video frames */
+        glVidFrameLen,
+        glUVCVidFrames,
+        CY_FX_UVC_PATTERN_NONE,
+        0,                                  /* No quality tiers */
+        NULL,
+        0,                                  /* Not simulcast */
+        NULL
+    },
+    {
+        2,                                  /* Frame index */
+        320, 240,                           /* Width x height */
+        0xC43,                              /* Maximum video frame buffer size */
+        666666,                             /* Default frame interval: 15 fps */
+        sizeof (glFmt1Frame2Intervals) / sizeof (uint32_t),
+        glFmt1Frame2Intervals,
+        2,                                  /* Stored video frames */
+        glVidFrameLen320x240,
+        glUVCVidFrames320x240,
+        CY_FX_UVC_PATTERN_NONE,
+        0,                                  /* No quality tiers */
+        NULL,
+        0,                                  /* Not simulcast */
+        NULL
+    },
+    {
+        3,                                  /* Frame index */
+        1280, 720,                          /* Width x height */
+        0x292B,                             /* Maximum video frame buffer size */
+        666666,                             /* Default frame interval: 15 fps */
+        sizeof (glFmt1Frame3Intervals) / sizeof (uint32_t),
+        glFmt1Frame3Intervals,
+        2,                                  /* Stored video frames */
+        glVidFrameLen1280x720,
+        glUVCVidFrames1280x720,
+        CY_FX_UVC_PATTERN_NONE,
+        0,                                  /* No quality tiers */
+        NULL,
+        0,                                  /* Not simulcast */
+        NULL
+    }
+};
+
+/* Format 2 (YUY2), frame 1 (640 x 480): frame intervals in 100 ns units, shortest first. */
+static const uint32_t glFmt2Frame1Intervals[] = {
+    333333,                             /* 30 fps */
+    666666,                             /* 15 fps */
+    1333333                             /* 7.5 fps */
+};
+
+/* Format 2 (YUY2), frame 2 (1280 x 720): frame intervals in 100 ns units, shortest first. */
+static const uint32_t glFmt2Frame2Intervals[] = {
+    333333,                             /* 30 fps */
+    666666,                             /* 15 fps */
+    1333333                             /* 7.5 fps */
+};
+
+/* Format 2 (YUY2), frame 3 (1920 x 1080): frame intervals in 100 ns units, shortest first. */
+static const uint32_t glFmt2Frame3Intervals[] = {
+    333333,                             /* 30 fps */
+    666666,                             /* 15 fps */
+    1333333                             /* 7.5 fps */
+};
+
+/* Frames of format 2 (YUY2), in the order of the frame descriptors. */
+static const CyFxUvcFrameInfo_t glFmt2Frames[] = {
+    {
+        1,                                  /* Frame index */
+        640, 480,                           /* Width x height */
+        0x96000,                            /* Maximum video frame buffer size */
+        666666,                             /* Default frame interval: 15 fps */
+        sizeof (glFmt2Frame1Intervals) / sizeof (uint32_t),
+        glFmt2Frame1Intervals,
+        0,                                  /* Generated, not stored */
+        NULL,
+        NULL,
+        CY_FX_UVC_PATTERN_YUY2,
+        0,                                  /* No quality tiers */
+        NULL,
+        0,                                  /* Not simulcast */
+        NULL
+    },
+    {
+        2,                                  /* Frame index */
+        1280, 720,                          /* Width x height */
+        0x1C2000,                           /* Maximum video frame buffer size */
+        666666,                             /* Default frame interval: 15 fps */
+        sizeof (glFmt2Frame2Intervals) / sizeof (uint32_t),
+        glFmt2Frame2Intervals,
+        0,                                  /* Generated, not stored */
+        NULL,
+        NULL,
+        CY_FX_UVC_PATTERN_YUY2,
+        0,                                  /* No quality tiers */
+        NULL,
+        0,                                  /* Not simulcast */
+        NULL
+    },
+    {
+        3,                                  /* Frame index */
+        1920, 1080,                         /* Width x height */
+        0x3F4800,                           /* Maximum video frame buffer size */
+        666666,                             /* Default frame interval: 15 fps */
+        sizeof (glFmt2Frame3Intervals) / sizeof (uint32_t),
+        glFmt2Frame3Intervals,
+        0,                                  /* Generated, not stored */
+        NULL,
+        NULL,
+        CY_FX_UVC_PATTERN_YUY2,
+        0,                                  /* No quality tiers */
+        NULL,
+        0,                                  /* Not simulcast */
+        NULL
+    }
+};
+
+/* Format 3 (NV12), frame 1 (640 x 480): frame intervals in 100 ns units, shortest first. */
+static const uint32_t glFmt3Frame1Intervals[] = {
+    333333,                             /* 30 fps */
+    666666,                             /* 15 fps */
+    1333333                             /* 7.5 fps */
+};
+
+/* Format 3 (NV12), frame 2 (1280 x 720): frame intervals in 100 ns units, shortest first. */
+static const uint32_t glFmt3Frame2Intervals[] = {
+    333333,                             /* 30 fps */
+    666666,                             /* 15 fps */
+    1333333                             /* 7.5 fps */
+};
+
+/* Format 3 (NV12), frame 3 (1920 x 1080): frame intervals in 100 ns units, shortest first. */
+static const uint32_t glFmt3Frame3Intervals[] = {
+    333333,                             /* 30 fps */
+    666666,                             /* 15 fps */
+    1333333                             /* 7.5 fps */
+};
+
+/* Frames of format 3 (NV12), in the order of the frame descriptors. */
+static const CyFxUvcFrameInfo_t glFmt3Frames[] = {
+    {
+        1,                                  /* Frame index */
+        640, 480,                           /* Width x height */
+        0x70800,                            /* Maximum video frame buffer size */
+        666666,                             /* Default frame interval: 15 fps */
+        sizeof (glFmt3Frame1Intervals) / sizeof (uint32_t),
+        glFmt3Frame1Intervals,
+        0,                                  /* Generated, not stored */
+        NULL,
+        NULL,
+        CY_FX_UVC_PATTERN_NV12,
+        0,                                  /* No quality tiers */
+        NULL,
+        0,                                  /* Not simulcast */
+        NULL
+    },
+    {
+        2,                                  /* Frame index */
+        1280, 720,                          /* Width x height */
+        0x151800,                           /* Maximum video frame buffer size */
+        666666,                             /* Default frame interval: 15 fps */
+        sizeof (glFmt3Frame2Intervals) / sizeof (uint32_t),
+        glFmt3Frame2Intervals,
+        0,                                  /* Generated, not stored */
+        NULL,
+        NULL,
+        CY_FX_UVC_PATTERN_NV12,
+        0,                                  /* No quality tiers */
+        NULL,
+        0,                                  /* Not simulcast */
+        NULL
+    },
+    {
+        3,                                  /* Frame index */
+        1920, 1080,                         /* Width x height */
+        0x2F7600,                           /* Maximum video frame buffer size */
+        666666,                             /* Default frame interval: 15 fps */
+        sizeof (glFmt3Frame3Intervals) / sizeof (uint32_t),
+        glFmt3Frame3Intervals,
+        0,                                  /* Generated, not stored */
+        NULL,
+        NULL,
+        CY_FX_UVC_PATTERN_NV12,
+        0,                                  /* No quality tiers */
+        NULL,
+        0,                                  /* Not simulcast */
+        NULL
+    }
+};
+
+/* Format 4 (H.264), frame 1 (640 x 480): frame intervals in 100 ns units, shortest first. */
+static const uint32_t glFmt4Frame1Intervals[] = {
+    333333,                             /* 30 fps */
+    666666,                             /* 15 fps */
+    1333333                             /* 7.5 fps */
+};
+
+/* Format 4 (H.264), frame 1 (640 x 480): quality tiers, best first. */
+static const CyFxUvcTierInfo_t glFmt4Frame1Tiers[] = {
+    {
+        1,                                  /* QP */
+        469,                                /* Average video frame length */
+        1757,                               /* Largest video frame length */
+        glVidFrameLenH264_640x480,
+        glUVCVidFramesH264_640x480
+    },
+    {
+        28,                                 /* QP */
+        203,                                /* Average video frame length */
+        1822,                               /* Largest video frame length */
+        glVidFrameLenH264_640x480_QP28,
+        glUVCVidFramesH264_640x480_QP28
+    },
+    {
+        40,                                 /* QP */
+        150,                                /* Average video frame length */
+        1468,                               /* Largest video frame length */
+        glVidFrameLenH264_640x480_QP40,
+        glUVCVidFramesH264_640x480_QP40
+    }
+};
+
+/* Format 4 (H.264), frame 2 (1280 x 720): frame intervals in 100 ns units, shortest first. */
+static const uint32_t glFmt4Frame2Intervals[] = {
+    333333,                             /* 30 fps */
+    666666,                             /* 15 fps */
+    1333333                             /* 7.5 fps */
+};
+
+/* Format 4 (H.264), frame 2 (1280 x 720): quality tiers, best first. */
+static const CyFxUvcTierInfo_t glFmt4Frame2Tiers[] = {
+    {
+        1,                                  /* QP */
+        672,                                /* Average video frame length */
+        3529,                               /* Largest video frame length */
+        glVidFrameLenH264_1280x720,
+        glUVCVidFramesH264_1280x720
+    },
+    {
+        28,                                 /* QP */
+        324,                                /* Average video frame length */
+        3692,                               /* Largest video frame length */
+        glVidFrameLenH264_1280x720_QP28,
+        glUVCVidFramesH264_1280x720_QP28
+    },
+    {
+        40,                                 /* QP */
+        287,                                /* Average video frame length */
+        3377,                               /* Largest video frame length */
+        glVidFrameLenH264_1280x720_QP40,
+        glUVCVidFramesH264_1280x720_QP40
+    }
+};
+
+/* Frames of format 4 (H.264), in the order of the frame descriptors. */
+static const CyFxUvcFrameInfo_t glFmt4Frames[] = {
+    {
+        1,                                  /* Frame index */
+        640, 480,                           /* Width x height */
+        0x71E,                              /* Maximum video frame buffer size */
+        666666,                             /* Default frame interval: 15 fps */
+        sizeof (glFmt4Frame1Intervals) / sizeof (uint32_t),
+        glFmt4Frame1Intervals,
+        16,                                 /* Stored video frames */
+        glVidFrameLenH264_640x480,
+        glUVCVidFramesH264_640x480,
+        CY_FX_UVC_PATTERN_NONE,
+        sizeof (glFmt4Frame1Tiers) / sizeof (CyFxUvcTierInfo_t),
+        glFmt4Frame1Tiers,
+        0,                                  /* Not simulcast */
+        NULL
+    },
+    {
+        2,                                  /* Frame index */
+        1280, 720,                          /* Width x height */
+        0xE6C,                              /* Maximum video frame buffer size */
+        666666,                             /* Default frame interval: 15 fps */
+        sizeof (glFmt4Frame2Intervals) / sizeof (uint32_t),
+        glFmt4Frame2Intervals,
+        16,                                 /* Stored video frames */
+        glVidFrameLenH264_1280x720,
+        glUVCVidFramesH264_1280x720,
+        CY_FX_UVC_PATTERN_NONE,
+        sizeof (glFmt4Frame2Tiers) / sizeof (CyFxUvcTierInfo_t),
+        glFmt4Frame2Tiers,
+        0,                                  /* Not simulcast */
+        NULL
+    }
+};
+
+/* Format 5 (H.265), frame 1 (640 x 480): frame intervals in 100 ns units, shortest first. */
+static const uint32_t glFmt5Frame1Intervals[] = {
+    333333,                             /* 30 fps */
+    666666,                             /* 15 fps */
+    1333333                             /* 7.5 fps */
+};
+
+/* Format 5 (H.265), frame 2 (1280 x 720): frame intervals in 100 ns units, shortest first. */
+static const uint32_t glFmt5Frame2Intervals[] = {
+    333333,                             /* 30 fps */
+    666666,                             /* 15 fps */
+    1333333                             /* 7.5 fps */
+};
+
+/* Frames of format 5 (H.265), in the order of the frame descriptors. */
+static const CyFxUvcFrameInfo_t glFmt5Frames[] = {
+    {
+        1,                                  /* Frame index */
+        640, 480,                           /* Width x height */
+        0x377,                              /* Maximum video frame buffer size */
+        666666,                             /* Default frame interval: 15 fps */
+        sizeof (glFmt5Frame1Intervals) / sizeof (uint32_t),
+        glFmt5Frame1Intervals,
+        16,                                 /* Stored video frames */
+        glVidFrameLenH265_640x480,
+        glUVCVidFramesH265_640x480,
+        CY_FX_UVC_PATTERN_NONE,
+        0,                                  /* No quality tiers */
+        NULL,
+        0,                                  /* Not simulcast */
+        NULL
+    },
+    {
+        2,                                  /* Frame index */
+        1280, 720,                          /* Width x height */
+        0x441,                              /* Maximum video frame buffer size */
+        666666,                             /* Default frame interval: 15 fps */
+        sizeof (glFmt5Frame2Intervals) / sizeof (uint32_t),
+        glFmt5Frame2Intervals,
+        16,                                 /* Stored video frames */
+        glVidFrameLenH265_1280x720,
+        glUVCVidFramesH265_1280x720,
+        CY_FX_UVC_PATTERN_NONE,
+        0,                                  /* No quality tiers */
+        NULL,
+        0,                                  /* Not simulcast */
+        NULL
+    }
+};
+
+/* Format 6 (H.264 simulcast), frame 1 (1280 x 720): frame intervals in 100 ns units, shortest first. */
+static const uint32_t glFmt6Frame1Intervals[] = {
+    333333,                             /* 30 fps */
+    666666,                             /* 15 fps */
+    1333333                             /* 7.5 fps */
+};
+
+/* Format 6 (H.264 simulcast), frame 1 (1280 x 720): simulcast layers, by stream_id. */
+static const CyFxUvcLayerInfo_t glFmt6Frame1Layers[] = {
+    {
+        &glFmt4Frames[0],                   /* Layer 0: format 4 (H.264), frame 1 (640 x 480) */
+        2                                   /* Weight */
+    },
+    {
+        &glFmt4Frames[1],                   /* Layer 1: format 4 (H.264), frame 2 (1280 x 720) */
+        1                                   /* Weight */
+    }
+};
+
+/* Frames of format 6 (H.264 simulcast), in the order of the frame descriptors. */
+static const CyFxUvcFrameInfo_t glFmt6Frames[] = {
+    {
+        1,                                  /* Frame index */
+        1280, 720,                          /* Width x height */
+        0xE75,                              /* Maximum video frame buffer size */
+        333333,                             /* Default frame interval: 30 fps */
+        sizeof (glFmt6Frame1Intervals) / sizeof (uint32_t),
+        glFmt6Frame1Intervals,
+        0,                                  /* Sent in simulcast layers */
+        NULL,
+        NULL,
+        CY_FX_UVC_PATTERN_NONE,
+        0,                                  /* No quality tiers */
+        NULL,
+        sizeof (glFmt6Frame1Layers) / sizeof (CyFxUvcLayerInfo_t),
+        glFmt6Frame1Layers
+    }
+};
+
+/* Formats supported by the device, in the order of the format descriptors. */
+const CyFxUvcFormatInfo_t glUvcFormats[] = {
+    {
+        1,                                  /* Format index: MJPEG */
+        CY_FX_UVC_VS_FORMAT_MJPEG,
+        CyFalse,                            /* Not NAL units */
+        1,                                  /* Default frame index */
+        sizeof (glFmt1Frames) / sizeof (CyFxUvcFrameInfo_t),
+        glFmt1Frames
+    },
+    {
+        2,                                  /* Format index: YUY2 */
+        CY_FX_UVC_VS_FORMAT_UNCOMPRESSED,
+        CyFalse,                            /* Not NAL units */
+        1,                                  /* Default frame index */
+        sizeof (glFmt2Frames) / sizeof (CyFxUvcFrameInfo_t),
+        glFmt2Frames
+    },
+    {
+        3,                                  /* Format index: NV12 */
+        CY_FX_UVC_VS_FORMAT_UNCOMPRESSED,
+        CyFalse,                            /* Not NAL units */
+        1,                                  /* Default frame index */
+        sizeof (glFmt3Frames) / sizeof (CyFxUvcFrameInfo_t),
+        glFmt3Frames
+    },
+    {
+        4,                                  /* Format index: H.264 */
+        CY_FX_UVC_VS_FORMAT_H264,
+        CyTrue,                             /* Annex B NAL units */
+        1,                                  /* Default frame index */
+        sizeof (glFmt4Frames) / sizeof (CyFxUvcFrameInfo_t),
+        glFmt4Frames
+    },
+    {
+        5,                                  /* Format index: H.265 */
+        CY_FX_UVC_VS_FORMAT_FRAME_BASED,
+        CyTrue,                             /* Annex B NAL units */
+        1,                                  /* Default frame index */
+        sizeof (glFmt5Frames) / sizeof (CyFxUvcFrameInfo_t),
+        glFmt5Frames
+    },
+    {
+        6,                                  /* Format index: H.264 simulcast */
+        CY_FX_UVC_VS_FORMAT_H264_SIMULCAST,
+        CyTrue,                             /* Annex B NAL units */
+        1,                                  /* Default frame index */
+        sizeof (glFmt6Frames) / sizeof (CyFxUvcFrameInfo_t),
+        glFmt6Frames
+    }
+};
+
+const uint8_t glUvcFormatCount = sizeof (glUvcFormats) / sizeof (CyFxUvcFormatInfo_t);
+
+/* [ ] */
@@ -26,17 +26,42 @@
 #include <cyu3externcstart.h>
 #include <cyu3types.h>
 #include <cyu3usbconst.h>
+#include "cyfxtx.h"
+#include "cyfxuvcprobe.h"
+#include "cyfxuvcpattern.h"
+#include "cyfxuvcctrl.h"
+#include "cyfxuvcshaper.h"
+#include "cyfxuvcrate.h"
+#include "cyfxuvclayer.h"
+#include "cyfxuvcslice.h"
+#include "cyfxuvcresil.h"
+#include "cyfxuvcstatus.h"
 
 /* This header file comprises of the UVC application constants and
  * the video frame configurations */
 
+#ifndef UVC_APP_THREAD_STACK
 #define UVC_APP_THREAD_STACK           (0x1000)        /* Thread stack size */
+#endif
 #define UVC_APP_THREAD_PRIORITY        (8)             /* Thread priority */
 
+/* Background heap corruption checks. These are only used when the firmware is built with
+   CY_FX_UVC_MEM_CHECK_ENABLE defined (CYFXMEMCHECK=1 in the makefile). */
+#define UVC_MEM_CHECK_THREAD_STACK     (0x400)         /* Memory check thread stack size */
+#define UVC_MEM_CHECK_THREAD_PRIORITY  (15)            /* Memory check thread priority: below all other threads */
+#define UVC_MEM_CHECK_BLOCKS           (8)             /* Number of blocks checked per heap in each step */
+#define UVC_MEM_CHECK_INTERVAL         (10)            /* Delay between check steps in ms */
+
+/* Thread stacks created by the application are filled with this pattern, so that the amount of stack
+   used so far can be found by looking for the deepest overwritten word. */
+#define UVC_STACK_FILL_PATTERN         (0xEFEFEFEF)
+
 /* Endpoint definition for UVC application */
 #define CY_FX_EP_BULK_VIDEO            (0x81)          /* EP 1 IN configured as Bulk EP */
 #define CY_FX_EP_VIDEO_CONS_SOCKET     (CY_U3P_UIB_SOCKET_CONS_1) /* Consumer socket 1 */
 #define CY_FX_EP_CONTROL_STATUS        (0x82)          /* EP 2 IN */
+#define CY_FX_EP_STATUS_CONS_SOCKET    (CY_U3P_UIB_SOCKET_CONS_2) /* Consumer socket 2 */
+#define CY_FX_UVC_STATUS_BUF_SIZE      (64)            /* Status packet buffer: one packet of the status endpoint */
 
 /* UVC descriptor types */
 #define CY_FX_INTF_ASSN_DSCR_TYPE      (11)            /* Interface association descriptor type. */
@@ -49,17 +74,25 @@
 
 #define CY_FX_UVC_MAX_VID_FRAMES       (2)              /* Maximum number of video frames (4) */
 
-/* UVC 1.5 specific format descriptors */
-#define CY_FX_UVC_VS_FORMAT_H264        (0x10)                  /* H.264 format descriptor subtype */
-#define CY_FX_UVC_VS_FORMAT_H264_SIMULCAST (0x11)              /* H.264 simulcast format descriptor subtype */
-#define CY_FX_UVC_VS_FORMAT_H265        (0x12)                  /* H.265 format descriptor subtype */
+/* Video streaming format descriptor subtypes of the UVC 1.1 payload formats in use */
+#define CY_FX_UVC_VS_FORMAT_UNCOMPRESSED (0x04)                 /* VS_FORMAT_UNCOMPRESSED descriptor subtype */
+#define CY_FX_UVC_VS_FORMAT_MJPEG       (0x06)                  /* VS_FORMAT_MJPEG descriptor subtype */
+#define CY_FX_UVC_VS_FORMAT_FRAME_BASED (0x10)                  /* VS_FORMAT_FRAME_BASED descriptor subtype */
+#define CY_FX_UVC_VS_FRAME_FRAME_BASED  (0x11)                  /* VS_FRAME_FRAME_BASED descriptor subtype */
+
+/* UVC 1.5 specific format descriptors. UVC 1.5 defines no H.265 payload format: H.265 streams are
+   described by the frame based format descriptors, with the H265 FourCC as the format GUID. */
+#define CY_FX_UVC_VS_FORMAT_H264        (0x13)                  /* VS_FORMAT_H264 descriptor subtype */
+#define CY_FX_UVC_VS_FORMAT_H264_SIMULCAST (0x15)              /* VS_FORMAT_H264_SIMULCAST descriptor subtype */
+#define CY_FX_UVC_VS_FORMAT_H265        (0x10)                  /* H.265: VS_FORMAT_FRAME_BASED, H265 GUID */
 
 /* UVC 1.5 frame descriptors */
-#define CY_FX_UVC_VS_FRAME_H264         (0x11)                  /* H.264 frame descriptor subtype */
-#define CY_FX_UVC_VS_FRAME_H265         (0x13)                  /* H.265 frame descriptor subtype */
+#define CY_FX_UVC_VS_FRAME_H264         (0x14)                  /* VS_FRAME_H264 descriptor subtype */
+#define CY_FX_UVC_VS_FRAME_H265         (0x11)                  /* H.265: VS_FRAME_FRAME_BASED */
 
 /* UVC 1.5 encoding unit descriptor */
 #define CY_FX_UVC_VC_ENCODING_UNIT      (0x07)                  /* Encoding unit descriptor subtype */
+#define CY_FX_UVC_EU_ID                 (5)                     /* Unit ID of the encoding unit in cyfxuvcstreams.json */
 
 /* UVC 1.5 control selectors */
 #define CY_FX_UVC_EU_SELECT_LAYER_CONTROL           (0x01)      /* Select Layer Control */
@@ -83,18 +116,69 @@
 #define CY_FX_UVC_EU_START_OR_STOP_LAYER_CONTROL    (0x13)      /* Start or Stop Layer Control */
 #define CY_FX_UVC_EU_ERROR_RESILIENCY_CONTROL       (0x14)      /* Error Resiliency Control */
 
+/* Camera terminal and processing unit */
+#define CY_FX_UVC_CT_ID                 (1)                     /* Terminal ID of the camera terminal in cyfxuvcstreams.json */
+#define CY_FX_UVC_PU_ID                 (2)                     /* Unit ID of the processing unit in cyfxuvcstreams.json */
+
+/* Camera terminal control selectors */
+#define CY_FX_UVC_CT_SCANNING_MODE_CONTROL          (0x01)      /* Scanning Mode Control */
+#define CY_FX_UVC_CT_AE_MODE_CONTROL                (0x02)      /* Auto-Exposure Mode Control */
+#define CY_FX_UVC_CT_AE_PRIORITY_CONTROL            (0x03)      /* Auto-Exposure Priority Control */
+#define CY_FX_UVC_CT_EXPOSURE_TIME_ABSOLUTE_CONTROL (0x04)      /* Exposure Time (Absolute) Control */
+
+/* Processing unit control selectors */
+#define CY_FX_UVC_PU_BACKLIGHT_COMPENSATION_CONTROL (0x01)      /* Backlight Compensation Control */
+#define CY_FX_UVC_PU_BRIGHTNESS_CONTROL             (0x02)      /* Brightness Control */
+#define CY_FX_UVC_PU_CONTRAST_CONTROL               (0x03)      /* Contrast Control */
+#define CY_FX_UVC_PU_GAIN_CONTROL                   (0x04)      /* Gain Control */
+#define CY_FX_UVC_PU_POWER_LINE_FREQUENCY_CONTROL   (0x05)      /* Power Line Frequency Control */
+#define CY_FX_UVC_PU_HUE_CONTROL                    (0x06)      /* Hue Control */
+#define CY_FX_UVC_PU_SATURATION_CONTROL             (0x07)      /* Saturation Control */
+#define CY_FX_UVC_PU_SHARPNESS_CONTROL              (0x08)      /* Sharpness Control */
+#define CY_FX_UVC_PU_GAMMA_CONTROL                  (0x09)      /* Gamma Control */
+
+/* Picture controls at which the generated frames are drawn as they are: 10 ms exposure (in 100 us
+   units), 100% contrast, gain and saturation, and the brightness that adds nothing to the luma. */
+#define CY_FX_UVC_PICTURE_EXPOSURE      (100)
+#define CY_FX_UVC_PICTURE_PERCENT       (100)
+#define CY_FX_UVC_PICTURE_BRIGHTNESS    (128)
+
 #define CY_FX_BULK_BURST               (8)              /* Burst size for SS operation only. */
 
+/* Video data bandwidth assumed for the bulk endpoint during probe negotiation, in bytes per second. */
+#define CY_FX_UVC_BULK_SS_BYTES_PER_SEC (320000000)     /* SuperSpeed */
+#define CY_FX_UVC_BULK_HS_BYTES_PER_SEC (40000000)      /* High speed */
+
 /* UVC Buffer size */
 #define CY_FX_UVC_STREAM_BUF_SIZE      (4096)
 
-/* UVC Buffer count */
-#define CY_FX_UVC_STREAM_BUF_COUNT     (10)
+/* UVC Buffer count with the standard memory map. */
+#define CY_FX_UVC_STREAM_BUF_COUNT_STD (10)
+
+/* Buffer area consumed by each UVC buffer. */
+#define CY_FX_UVC_STREAM_BUF_FOOTPRINT (CY_U3P_BUFFER_FOOTPRINT (CY_FX_UVC_STREAM_BUF_SIZE))
+
+/* UVC Buffer count. Memory map profiles that reclaim the 2-stage boot area add as many buffers as fit
+   in the reclaimed space. The count is limited to what fits in the buffer area next to the buffers
+   used by the SDK drivers. */
+#define CY_FX_UVC_STREAM_BUF_COUNT     (CY_U3P_MIN ((CY_FX_UVC_STREAM_BUF_COUNT_STD +                         \
+                                            (CY_U3P_BUFFER_HEAP_RECLAIMED / CY_FX_UVC_STREAM_BUF_FOOTPRINT)), \
+                                            ((CY_U3P_BUFFER_HEAP_SIZE - CY_U3P_BUFFER_HEAP_SDK_RESERVE) /     \
+                                             CY_FX_UVC_STREAM_BUF_FOOTPRINT)))
+
+/* Stream switch on SET_CUR(COMMIT). The streaming thread waits no longer than GET_BUF_TIMEOUT for a
+   free buffer so that it notices the request, and waits at most SWITCH_DRAIN_TIME for the host to read
+   the payloads already committed before they are discarded. Both are in ms. */
+#define CY_FX_UVC_GET_BUF_TIMEOUT      (10)
+#define CY_FX_UVC_SWITCH_DRAIN_TIME    (20)
+
+/* Frame intervals are in 100 ns units. The streamer paces the frames against the 1 ms RTOS tick. */
+#define CY_FX_UVC_INTERVAL_PER_MS      (10000)
 
 #define CY_FX_UVC_MAX_HEADER           (12)         /* Maximum number of header bytes in UVC */
 #define CY_FX_UVC_HEADER_DEFAULT_BFH   (0x8C)       /* Default BFH(Bit Field Header) for the UVC Header */
 
-#define CY_FX_UVC_MAX_PROBE_SETTING    (34)         /* Maximum number of bytes in Probe Control */
+#define CY_FX_UVC_MAX_PROBE_SETTING    (48)         /* Maximum number of bytes in Probe Control (UVC 1.5) */
 #define CY_FX_UVC_MAX_PROBE_SETTING_ALIGNED    (64) /* Maximum number of bytes in Probe Control aligned to 32 byte */
 
 #define CY_FX_UVC_HEADER_FRAME          (0)                     /* Normal frame indication */
@@ -111,12 +195,46 @@
 #define CY_FX_USB_UVC_GET_DEF_REQ       (uint8_t)(0x87)         /* UVC GET_DEF request */
 #define CY_FX_USB_UVC_GET_MIN_REQ       (uint8_t)(0x82)         /* UVC GET_MIN request */
 #define CY_FX_USB_UVC_GET_MAX_REQ       (uint8_t)(0x83)         /* UVC GET_MAX request */
+#define CY_FX_USB_UVC_GET_RES_REQ       (uint8_t)(0x84)         /* UVC GET_RES request */
+#define CY_FX_USB_UVC_GET_LEN_REQ       (uint8_t)(0x85)         /* UVC GET_LEN request */
+#define CY_FX_USB_UVC_GET_INFO_REQ      (uint8_t)(0x86)         /* UVC GET_INFO request */
 
 #define CY_FX_USB_UVC_VS_PROBE_CONTROL  (0x0100)                /* Control selector for VS_PROBE_CONTROL. */
 #define CY_FX_USB_UVC_VS_COMMIT_CONTROL (0x0200)                /* Control selector for VS_COMMIT_CONTROL. */
+#define CY_FX_USB_UVC_VS_STREAM_ERROR_CODE_CONTROL (0x0600)     /* Control selector for VS_STREAM_ERROR_CODE_CONTROL. */
 
 #define CY_FX_USB_UVC_VC_RQT_ERROR_CODE_CONTROL (0x0200)
-#define CY_FX_USB_UVC_RQT_STAT_INVALID_CTRL     (0x06)
+
+/*
+   Data cache mode. When CY_FX_UVC_DCACHE_ENABLE is defined (CYFXDCACHE=1 in the makefile) the firmware
+   runs with the data cache enabled, and the DMA driver cleans and flushes every buffer that goes through
+   a DMA channel, the EP0 transfers included. The application does no cache maintenance of its own.
+ */
+
+/* Number of stream buffers filled by the copy benchmark (CY_FX_UVC_COPY_BENCHMARK, CYFXBENCH=1). */
+#define CY_FX_UVC_BENCH_BUF_COUNT      (1024)
+
+/* Vendor request (bmRequestType 0xC0) that returns the heap usage statistics as a CyU3PHeapStats_t
+   structure. wIndex selects the heap to be queried. */
+#define CY_FX_UVC_VENDOR_RQT_HEAP_STATS (0xB0)
+#define CY_FX_UVC_HEAP_STATS_MEM        (0)                     /* Driver heap (CyU3PMemAlloc). */
+#define CY_FX_UVC_HEAP_STATS_BUF        (1)                     /* Buffer heap (CyU3PDmaBufferAlloc). */
+
+/* Vendor request (bmRequestType 0xC0) that returns the stack size and the number of bytes used so far
+   for each application thread, as pairs of 32-bit values: UVC application thread followed by the
+   memory check thread (zero if not created). */
+#define CY_FX_UVC_VENDOR_RQT_STACK_USAGE (0xB1)
+#define CY_FX_UVC_STACK_USAGE_LEN       (16)                    /* Size of the stack usage response. */
+
+/* Vendor request (bmRequestType 0xC0) that returns the bit rate shaper statistics of the current (or
+   last) stream as a CyFxUvcShaperStats_t structure: achieved average and peak bit rates, the limits in
+   force and how often and how long payloads were held back. */
+#define CY_FX_UVC_VENDOR_RQT_SHAPER_STATS (0xB2)
+
+/* Vendor request (bmRequestType 0xC0) that returns the error resiliency statistics of the current (or
+   last) stream as a CyFxUvcResilStats_t structure: the access units and bytes sent, and how many of
+   them were repeated parameter sets and IDR pictures sent for the error resiliency control. */
+#define CY_FX_UVC_VENDOR_RQT_RESIL_STATS (0xB3)
 
 /* Extern definitions of the USB Enumeration constant arrays used for the Application */
 extern const uint8_t CyFxUSB20DeviceDscr[];
@@ -132,9 +250,6 @@ extern const uint8_t CyFxUSBProductDscr[];
 
 /* Extern definitions of the Video frame data */
 
-/* UVC Probe Control Setting */
-extern const uint8_t glProbeCtrl[CY_FX_UVC_MAX_PROBE_SETTING];
- 
 /* Video frame lengths */
 extern const uint32_t glVidFrameLen[CY_FX_UVC_MAX_VID_FRAMES];
 
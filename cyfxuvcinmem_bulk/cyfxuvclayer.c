@@ -0,0 +1,177 @@
+/*
+ ## Cypress USB 3.0 Platform source file (cyfxuvclayer.c)
+ ## ===========================
+ ##
+ ##  Copyright Cypress Semiconductor Corporation, 2010-2023,
+ ##  All Rights Reserved
+ ##  UNPUBLISHED, LICENSED SOFTWARE.
+ ##
+ ##  CONFIDENTIAL AND PROPRIETARY INFORMATION
+ ##  WHICH IS THE PROPERTY OF CYPRESS.
+ ##
+ ##  Use of this file is governed
+ ##  by the license agreement included in the file
+ ##
+ ##     <install>/license/license.txt
+ ##
+ ##  where <install> is the Cypress software
+ ##  installation root directory path.
+ ##
+ ## ===========================
+*/
+
+/* This file implements the scheduling of the layers of an H.264 simulcast stream over the frame slots.
+
+   The UVC payload header has no field for the layer, so the layers cannot be interleaved payload by
+   payload: each frame slot carries one whole access unit of one layer, ended with the end of frame bit,
+   and the host tells the layers apart by the prefix NAL unit in front of it. The slots are shared with
+   a smooth weighted round robin, which gives every layer its weight in slots out of each totalWeight
+   slots and spreads them out, so that a layer with a third of the slots is sent every third slot rather
+   than three slots in a row. Stopped layers keep their turn in the rotation and their slots stay empty.
+ */
+
+#include <cyu3error.h>
+#include "cyfxuvcinmem.h"
+#include "cyfxuvclayer.h"
+
+/* nal_unit_type of the prefix NAL unit, sent with nal_ref_idc 3 as all pictures of the stored streams
+   are reference pictures. */
+#define CY_FX_UVC_LAYER_NAL_PREFIX      (0x6E)
+
+/* Bits of the SVC extension of the NAL unit header: svc_extension_flag and idr_flag in the first byte
+   with the 6 bit priority_id; no_inter_layer_pred_flag in the second; output_flag and
+   reserved_three_2bits in the third. */
+#define CY_FX_UVC_LAYER_SVC_EXT         (0x80)
+#define CY_FX_UVC_LAYER_SVC_IDR         (0x40)
+#define CY_FX_UVC_LAYER_SVC_NO_PRED     (0x80)
+#define CY_FX_UVC_LAYER_SVC_OUTPUT      (0x07)
+
+/* store_ref_base_pic_flag and additional_prefix_nal_unit_extension_flag clear, then the RBSP stop bit. */
+#define CY_FX_UVC_LAYER_PREFIX_RBSP     (0x20)
+
+/* Go back to the IDR picture of a layer. */
+static void
+CyFxUvcLayerRewind (
+        CyFxUvcLayer_t *layer_p)
+{
+    layer_p->frameIndex = 0;
+    layer_p->frameStart = 0;
+}
+
+void
+CyFxUvcLayerStart (
+        CyFxUvcSimulcast_t       *sc_p,
+        const CyFxUvcFrameInfo_t *frame_p)
+{
+    CyFxUvcLayer_t *layer_p;
+    uint8_t i;
+
+    sc_p->count       = (uint8_t)CY_U3P_MIN (frame_p->layerCount, CY_FX_UVC_LAYER_MAX);
+    sc_p->totalWeight = 0;
+    for (i = 0; i < sc_p->count; i++)
+    {
+        layer_p = &sc_p->layer[i];
+        layer_p->frame_p   = frame_p->layer_p[i].frame_p;
+        layer_p->tier_p    = NULL;
+        layer_p->tier      = 0;
+        layer_p->weight    = frame_p->layer_p[i].weight;
+        layer_p->credit    = 0;
+        layer_p->isStarted = CyTrue;
+        layer_p->isRestart = CyFalse;
+        layer_p->frames    = 0;
+        CyFxUvcLayerRewind (layer_p);
+        sc_p->totalWeight += layer_p->weight;
+    }
+}
+
+uint8_t
+CyFxUvcLayerNext (
+        CyFxUvcSimulcast_t *sc_p)
+{
+    CyFxUvcLayer_t *layer_p;
+    uint8_t i, best = 0;
+
+    if (sc_p->count == 0)
+        return CY_FX_UVC_LAYER_NONE;
+
+    /* Every layer earns its weight; the one with the most credit takes the slot and pays for all. */
+    for (i = 0; i < sc_p->count; i++)
+    {
+        sc_p->layer[i].credit += sc_p->layer[i].weight;
+        if (sc_p->layer[i].credit > sc_p->layer[best].credit)
+            best = i;
+    }
+
+    layer_p = &sc_p->layer[best];
+    layer_p->credit -= sc_p->totalWeight;
+    if (!layer_p->isStarted)
+        return CY_FX_UVC_LAYER_NONE;
+
+    if (layer_p->isRestart)
+    {
+        layer_p->isRestart = CyFalse;
+        CyFxUvcLayerRewind (layer_p);
+    }
+    return best;
+}
+
+void
+CyFxUvcLayerAdvance (
+        CyFxUvcLayer_t *layer_p,
+        uint32_t        len)
+{
+    layer_p->frames++;
+    layer_p->frameStart += len;
+    if (++layer_p->frameIndex >= layer_p->frame_p->vidFrameCount)
+        CyFxUvcLayerRewind (layer_p);
+}
+
+void
+CyFxUvcLayerSync (
+        CyFxUvcSimulcast_t *sc_p)
+{
+    uint8_t i;
+
+    for (i = 0; i < sc_p->count; i++)
+        CyFxUvcLayerRewind (&sc_p->layer[i]);
+}
+
+CyU3PReturnStatus_t
+CyFxUvcLayerSetStarted (
+        CyFxUvcSimulcast_t *sc_p,
+        uint8_t             streamId,
+        CyBool_t            start)
+{
+    CyFxUvcLayer_t *layer_p;
+
+    if (streamId >= sc_p->count)
+        return CY_U3P_ERROR_BAD_ARGUMENT;
+
+    /* The streamer goes back to the IDR picture the next time it picks the layer. */
+    layer_p = &sc_p->layer[streamId];
+    if ((start) && (!layer_p->isStarted))
+        layer_p->isRestart = CyTrue;
+    layer_p->isStarted = start;
+    return CY_U3P_SUCCESS;
+}
+
+uint8_t
+CyFxUvcLayerPrefix (
+        uint8_t   streamId,
+        CyBool_t  isIdr,
+        uint8_t  *buf_p)
+{
+    buf_p[0] = 0x00;
+    buf_p[1] = 0x00;
+    buf_p[2] = 0x00;
+    buf_p[3] = 0x01;
+    buf_p[4] = CY_FX_UVC_LAYER_NAL_PREFIX;
+    buf_p[5] = CY_FX_UVC_LAYER_SVC_EXT | ((isIdr) ? CY_FX_UVC_LAYER_SVC_IDR : 0) | (streamId & 0x3F);
+    buf_p[6] = CY_FX_UVC_LAYER_SVC_NO_PRED;
+    buf_p[7] = CY_FX_UVC_LAYER_SVC_OUTPUT;
+    buf_p[8] = CY_FX_UVC_LAYER_PREFIX_RBSP;
+    return CY_FX_UVC_LAYER_PREFIX_LEN;
+}
+
+/*[]*/
+
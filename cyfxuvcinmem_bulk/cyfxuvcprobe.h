@@ -0,0 +1,292 @@
+/*
+ ## Cypress USB 3.0 Platform header file (cyfxuvcprobe.h)
+ ## ===========================
+ ##
+ ##  Copyright Cypress Semiconductor Corporation, 2010-2023,
+ ##  All Rights Reserved
+ ##  UNPUBLISHED, LICENSED SOFTWARE.
+ ##
+ ##  CONFIDENTIAL AND PROPRIETARY INFORMATION
+ ##  WHICH IS THE PROPERTY OF CYPRESS.
+ ##
+ ##  Use of this file is governed
+ ##  by the license agreement included in the file
+ ##
+ ##     <install>/license/license.txt
+ ##
+ ##  where <install> is the Cypress software
+ ##  installation root directory path.
+ ##
+ ## ===========================
+*/
+
+/* File: cyfxuvcprobe.h
+ *
+ * Video probe and commit control negotiation. The host proposes streaming parameters through
+ * VS_PROBE_CONTROL; the device adjusts them to a setting that it supports and that fits the bandwidth
+ * of the current link, and the host then selects the negotiated setting through VS_COMMIT_CONTROL.
+ */
+
+#ifndef _INCLUDED_CYFXUVCPROBE_H_
+#define _INCLUDED_CYFXUVCPROBE_H_
+
+#include <cyu3types.h>
+#include <cyu3usbconst.h>
+#include <cyu3externcstart.h>
+
+/* Size of the probe/commit structure defined by each version of the UVC specification. */
+#define CY_FX_UVC_PROBE_LEN_UVC10       (26)
+#define CY_FX_UVC_PROBE_LEN_UVC11       (34)
+#define CY_FX_UVC_PROBE_LEN_UVC15       (48)
+
+/* Size of each response buffer of the negotiation state: the UVC 1.5 structure rounded up to whole
+   cache lines. */
+#define CY_FX_UVC_PROBE_BUF_SIZE        (64)
+
+/* bmHint bits of the probe/commit structure. */
+#define CY_FX_UVC_PROBE_HINT_INTERVAL   (0x0001)        /* dwFrameInterval should be kept fixed. */
+
+/* bmFramingInfo bits: the payload headers carry a frame ID, and the end of a frame is marked. */
+#define CY_FX_UVC_PROBE_FRAMING_FID     (0x01)
+#define CY_FX_UVC_PROBE_FRAMING_EOF     (0x02)
+
+/* bUsage and bmRateControlModes values of the H.264 streams (UVC 1.5). */
+#define CY_FX_UVC_PROBE_USAGE_REALTIME          (1)         /* Real time, UCConfig mode 0. */
+#define CY_FX_UVC_PROBE_RATE_CONTROL_CBR        (0x0002)    /* Constant bit rate, in the nibble of layer 0. */
+#define CY_FX_UVC_PROBE_RATE_CONTROL_BITS       (4)         /* Bits of bmRateControlModes per layer. */
+
+/* Device clock frequency reported in dwClockFrequency (Hz). */
+#define CY_FX_UVC_DEVICE_CLOCK_FREQ     (384000000)
+
+/* Probe/commit structure in native form. The fields are stored in the USB (little endian, packed)
+   layout by CyFxUvcProbePack, at the offsets given in the comments. */
+typedef struct CyFxUvcProbeCtrl_t
+{
+    uint16_t bmHint;                    /*  0: Fields to be kept fixed during negotiation. */
+    uint8_t  bFormatIndex;              /*  2: Video format index. */
+    uint8_t  bFrameIndex;               /*  3: Video frame index. */
+    uint32_t dwFrameInterval;           /*  4: Frame interval in 100 ns units. */
+    uint16_t wKeyFrameRate;             /*  8: Key frame rate in key frame / video frame units. */
+    uint16_t wPFrameRate;               /* 10: P frame rate in P frame / key frame units. */
+    uint16_t wCompQuality;              /* 12: Compression quality control. */
+    uint16_t wCompWindowSize;           /* 14: Window size for average bit rate control. */
+    uint16_t wDelay;                    /* 16: Internal video streaming interface latency in ms. */
+    uint32_t dwMaxVideoFrameSize;       /* 18: Maximum video frame size in bytes. */
+    uint32_t dwMaxPayloadTransferSize;  /* 22: Maximum number of bytes in a single payload transfer. */
+    uint32_t dwClockFrequency;          /* 26: Device clock frequency in Hz (UVC 1.1). */
+    uint8_t  bmFramingInfo;             /* 30: Framing information (UVC 1.1). */
+    uint8_t  bPreferedVersion;          /* 31: Preferred payload format version (UVC 1.1). */
+    uint8_t  bMinVersion;               /* 32: Minimum payload format version (UVC 1.1). */
+    uint8_t  bMaxVersion;               /* 33: Maximum payload format version (UVC 1.1). */
+    uint8_t  bUsage;                    /* 34: Usage of the stream (UVC 1.5). */
+    uint8_t  bBitDepthLuma;             /* 35: Luma bit depth minus 8 (UVC 1.5). */
+    uint8_t  bmSettings;                /* 36: Flags for the encoder (UVC 1.5). */
+    uint8_t  bMaxNumberOfRefFramesPlus1;/* 37: Maximum number of reference frames plus one (UVC 1.5). */
+    uint16_t bmRateControlModes;        /* 38: Rate control mode of each simulcast layer (UVC 1.5). */
+    uint16_t bmLayoutPerStream[4];      /* 40: Layer structure of each simulcast stream (UVC 1.5). */
+} CyFxUvcProbeCtrl_t;
+
+/* One encoding of the stored video frames of a frame, for the rate control (cyfxuvcrate.c). All tiers
+   of a frame hold the same number of video frames. */
+typedef struct CyFxUvcTierInfo_t
+{
+    uint8_t         qp;                 /* QP of the P pictures (average slice QP for rate controlled ones). */
+    uint32_t        avgFrameLen;        /* Average length of its video frames. */
+    uint32_t        maxFrameLen;        /* Length of its largest video frame. */
+    const uint32_t *vidFrameLen_p;      /* Length of each stored video frame. */
+    const uint8_t  *vidFrames_p;        /* Stored video frames, back to back. */
+} CyFxUvcTierInfo_t;
+
+struct CyFxUvcFrameInfo_t;
+
+/* Layer of an H.264 simulcast frame: one of the stored H.264 streams, and its share of the frame slots
+   (cyfxuvclayer.c). */
+typedef struct CyFxUvcLayerInfo_t
+{
+    const struct CyFxUvcFrameInfo_t *frame_p;   /* Frame of the H.264 format sent in the layer. */
+    uint8_t                          weight;    /* Frame slots of the layer in each round of slots. */
+} CyFxUvcLayerInfo_t;
+
+/* Video frame supported by the device, with the frames stored in memory for it. Frames of the
+   uncompressed formats are not stored (vidFrameCount is 0) but generated by the pattern generator
+   in the pixel format given by pattern. Stored frames can come in several quality tiers, the first of
+   which are the frames of vidFrames_p. Frames of the H.264 simulcast format store nothing themselves
+   either: they are made of layers, each sending the frames stored for another frame. */
+typedef struct CyFxUvcFrameInfo_t
+{
+    uint8_t         frameIndex;         /* bFrameIndex of the frame descriptor. */
+    uint16_t        width;              /* Frame width in pixels. */
+    uint16_t        height;             /* Frame height in pixels. */
+    uint32_t        maxFrameBufSize;    /* dwMaxVideoFrameBufferSize: largest stored (or generated) frame. */
+    uint32_t        defInterval;        /* Default frame interval in 100 ns units. */
+    uint8_t         intervalCount;      /* Number of discrete frame intervals supported. */
+    const uint32_t *interval_p;         /* Supported frame intervals, shortest first. */
+    uint16_t        vidFrameCount;      /* Number of video frames stored for this frame. */
+    const uint32_t *vidFrameLen_p;      /* Length of each stored video frame. */
+    const uint8_t  *vidFrames_p;        /* Stored video frames, back to back. */
+    uint8_t         pattern;            /* CY_FX_UVC_PATTERN_* for generated frames, else NONE. */
+    uint8_t         tierCount;          /* Number of quality tiers, 0 for a single encoding. */
+    const CyFxUvcTierInfo_t *tier_p;    /* Quality tiers, best first. */
+    uint8_t         layerCount;         /* Number of simulcast layers, 0 for a single stream. */
+    const CyFxUvcLayerInfo_t *layer_p;  /* Simulcast layers, by stream_id. */
+} CyFxUvcFrameInfo_t;
+
+/* Video format supported by the device. */
+typedef struct CyFxUvcFormatInfo_t
+{
+    uint8_t                   formatIndex;      /* bFormatIndex of the format descriptor. */
+    uint8_t                   subtype;          /* Format descriptor subtype, CY_FX_UVC_VS_FORMAT_*. */
+    CyBool_t                  isAnnexB;         /* Stored frames are Annex B streams of NAL units. */
+    uint8_t                   defFrameIndex;    /* bDefaultFrameIndex of the format descriptor. */
+    uint8_t                   frameCount;       /* Number of frames supported in this format. */
+    const CyFxUvcFrameInfo_t *frame_p;          /* Frames supported in this format. */
+} CyFxUvcFormatInfo_t;
+
+/* Transfer capability of the video streaming endpoint at the current connection speed. */
+typedef struct CyFxUvcEpGeometry_t
+{
+    CyBool_t isIso;                     /* Whether the endpoint is isochronous. */
+    uint16_t maxPktSize;                /* Maximum packet size of the endpoint. */
+    uint8_t  burstLen;                  /* Packets per burst (SuperSpeed) or 1. */
+    uint8_t  mult;                      /* Bursts (SuperSpeed) or transactions (high speed) per interval. */
+    uint32_t maxPayload;                /* Largest payload transfer (header included) the device sends. */
+    uint32_t bytesPerSec;               /* Bandwidth available to the stream, in bytes per second. */
+} CyFxUvcEpGeometry_t;
+
+/* States of the probe/commit negotiation. */
+typedef enum CyFxUvcProbeStateId_t
+{
+    CY_FX_UVC_PROBE_IDLE = 0,           /* Default values loaded, nothing set by the host yet. */
+    CY_FX_UVC_PROBE_PROBING,            /* The host has set the probe control. */
+    CY_FX_UVC_PROBE_COMMITTED           /* The host has set the commit control. */
+} CyFxUvcProbeStateId_t;
+
+/* Probe/commit negotiation state for one configuration. The responses to all GET requests are kept
+   ready in USB layout, so that a request can be answered by sending one of the buffers as is. The
+   buffers come first and are cache line aligned, so that no other data shares a cache line with them
+   when the DMA driver cleans them for an EP0 transfer. */
+typedef struct CyFxUvcProbeState_t
+{
+    uint8_t curBuf[CY_FX_UVC_PROBE_BUF_SIZE];       /* GET_CUR on the probe control. */
+    uint8_t commitBuf[CY_FX_UVC_PROBE_BUF_SIZE];    /* GET_CUR on the commit control. */
+    uint8_t defBuf[CY_FX_UVC_PROBE_BUF_SIZE];       /* GET_DEF on the probe control. */
+    uint8_t minBuf[CY_FX_UVC_PROBE_BUF_SIZE];       /* GET_MIN on the probe control. */
+    uint8_t maxBuf[CY_FX_UVC_PROBE_BUF_SIZE];       /* GET_MAX on the probe control. */
+    uint8_t infoBuf[CY_FX_UVC_PROBE_BUF_SIZE];      /* GET_INFO (byte 0) and GET_LEN (bytes 2-3). */
+
+    CyFxUvcProbeStateId_t state;                    /* Negotiation state. */
+    CyFxUvcEpGeometry_t   ep;                       /* Endpoint geometry of the configuration. */
+    CyFxUvcProbeCtrl_t    probe;                    /* Current probe values. */
+    CyFxUvcProbeCtrl_t    commit;                   /* Current commit values. */
+    uint8_t               limitFormat;              /* Format for which minBuf and maxBuf are valid. */
+    uint8_t               limitFrame;               /* Frame for which minBuf and maxBuf are valid. */
+    uint32_t              sliceSize;                /* Slice size the payloads are sized for, or 0. */
+    uint32_t              computeCount;             /* Number of structures computed since Init. */
+} __attribute__ ((aligned (32))) CyFxUvcProbeState_t;
+
+/* Size of the response buffers of CyFxUvcProbeState_t that precede the other fields. */
+#define CY_FX_UVC_PROBE_STATE_BUF_AREA  (6 * CY_FX_UVC_PROBE_BUF_SIZE)
+
+/* Formats supported by the device. Generated into cyfxuvcformats.c from cyfxuvcstreams.json, together
+   with the video streaming descriptors in cyfxuvcdscr.c. */
+extern const CyFxUvcFormatInfo_t glUvcFormats[];
+extern const uint8_t glUvcFormatCount;
+
+/* Get the transfer capability of the video streaming endpoint for a connection speed. Fails with
+   CY_U3P_ERROR_NOT_SUPPORTED for speeds at which the device does not stream video. */
+extern CyU3PReturnStatus_t
+CyFxUvcProbeGetEpGeometry (
+        CyU3PUSBSpeed_t      speed,
+        CyFxUvcEpGeometry_t *ep_p);
+
+/* Find a format by its index. Returns NULL if there is no such format. */
+extern const CyFxUvcFormatInfo_t *
+CyFxUvcProbeFindFormat (
+        uint8_t formatIndex);
+
+/* Find the frame with the given format and frame index. Returns NULL if there is no such frame. */
+extern const CyFxUvcFrameInfo_t *
+CyFxUvcProbeFindFrame (
+        uint8_t formatIndex,
+        uint8_t frameIndex);
+
+/* Adjust the values proposed by the host in ctrl_p to the closest setting supported by the device
+   that fits the bandwidth described by ep_p. A sliceSize other than 0 is the target compressed size per
+   slice of the slice mode control: the payloads of the Annex B formats, which are then aligned to their
+   NAL units (cyfxuvcslice.h), are made large enough to hold a slice of that size whole where the
+   endpoint allows it. */
+extern void
+CyFxUvcProbeNegotiate (
+        CyFxUvcProbeCtrl_t        *ctrl_p,
+        const CyFxUvcEpGeometry_t *ep_p,
+        uint32_t                   sliceSize);
+
+/* Get the values returned for GET_DEF, GET_MIN or GET_MAX on the probe control. The minimum and maximum
+   are given for the format and frame selected in cur_p. sliceSize is as for CyFxUvcProbeNegotiate. */
+extern void
+CyFxUvcProbeGetLimit (
+        uint8_t                    bRequest,
+        const CyFxUvcProbeCtrl_t  *cur_p,
+        CyFxUvcProbeCtrl_t        *ctrl_p,
+        const CyFxUvcEpGeometry_t *ep_p,
+        uint32_t                   sliceSize);
+
+/* Start a new negotiation for a configuration at the given connection speed: the endpoint geometry
+   and the default values are determined and all responses are prepared. The high speed geometry is
+   used if the device does not stream at this speed. */
+extern void
+CyFxUvcProbeInit (
+        CyFxUvcProbeState_t *st_p,
+        CyU3PUSBSpeed_t      speed);
+
+/* Set the target compressed size per slice that the payloads are sized for, or 0 when the payloads are
+   not aligned to NAL units. The current probe values and the GET_DEF, GET_MIN and GET_MAX responses
+   are negotiated again; the committed values are kept until the host commits again. */
+extern void
+CyFxUvcProbeSetSliceSize (
+        CyFxUvcProbeState_t *st_p,
+        uint32_t             sliceSize);
+
+/* Get the prepared response to a GET request (GET_CUR, GET_MIN, GET_MAX, GET_DEF, GET_LEN or GET_INFO)
+   on the probe (0x0100) or commit (0x0200) control. *len_p is set to the full response length; the
+   caller sends no more than wLength bytes. Fails with CY_U3P_ERROR_NOT_SUPPORTED for requests that
+   should be stalled. */
+extern CyU3PReturnStatus_t
+CyFxUvcProbeGet (
+        CyFxUvcProbeState_t *st_p,
+        uint16_t             control,
+        uint8_t              bRequest,
+        const uint8_t      **buf_pp,
+        uint16_t            *len_p);
+
+/* Handle the data of a SET_CUR request on the probe or commit control. The values are negotiated and
+   the responses are updated. Fails with CY_U3P_ERROR_BAD_ARGUMENT if fewer than 26 bytes were
+   received, in which case the current values are kept. */
+extern CyU3PReturnStatus_t
+CyFxUvcProbeSet (
+        CyFxUvcProbeState_t *st_p,
+        uint16_t             control,
+        const uint8_t       *buf_p,
+        uint16_t             len);
+
+/* Update ctrl_p from the len bytes of probe data received from the host. Fields beyond len are left
+   unchanged, so that UVC 1.0 (26 byte), UVC 1.1 (34 byte) and UVC 1.5 (48 byte) structures can be used. */
+extern void
+CyFxUvcProbeUnpack (
+        CyFxUvcProbeCtrl_t *ctrl_p,
+        const uint8_t      *buf_p,
+        uint16_t            len);
+
+/* Store up to len bytes of the probe data in ctrl_p into buf_p. Returns the number of bytes stored. */
+extern uint16_t
+CyFxUvcProbePack (
+        const CyFxUvcProbeCtrl_t *ctrl_p,
+        uint8_t                  *buf_p,
+        uint16_t                  len);
+
+#include <cyu3externcend.h>
+
+#endif /* _INCLUDED_CYFXUVCPROBE_H_ */
+
+/*[]*/
+
@@ -0,0 +1,122 @@
+/*
+ ## Cypress USB 3.0 Platform header file (cyfxuvcresil.h)
+ ## ===========================
+ ##
+ ##  Copyright Cypress Semiconductor Corporation, 2010-2023,
+ ##  All Rights Reserved
+ ##  UNPUBLISHED, LICENSED SOFTWARE.
+ ##
+ ##  CONFIDENTIAL AND PROPRIETARY INFORMATION
+ ##  WHICH IS THE PROPERTY OF CYPRESS.
+ ##
+ ##  Use of this file is governed
+ ##  by the license agreement included in the file
+ ##
+ ##     <install>/license/license.txt
+ ##
+ ##  where <install> is the Cypress software
+ ##  installation root directory path.
+ ##
+ ## ===========================
+*/
+
+/* File: cyfxuvcresil.h
+ *
+ * Error resiliency of the stored H.264 and H.265 streams. A decoder that has lost the IDR picture of a
+ * stream, or joined it late, has to wait for the next IDR picture and the parameter sets in front of
+ * it. With the error resiliency control the streamer sends the parameter sets again in front of the
+ * other access units every few frames, and sends IDR pictures at least every CY_FX_UVC_RESIL_SYNC_MS,
+ * so that the wait is bounded. The extra bytes are counted, and returned through the error resiliency
+ * statistics vendor request.
+ */
+
+#ifndef _INCLUDED_CYFXUVCRESIL_H_
+#define _INCLUDED_CYFXUVCRESIL_H_
+
+#include <cyu3types.h>
+#include "cyfxuvclayer.h"
+#include <cyu3externcstart.h>
+
+/* bmErrorResiliencyFeatures of the error resiliency control. UVC 1.5 leaves the features to the
+   encoder; the stored streams cannot be re-encoded, so the device offers the redundancy it can add to
+   them. Bits 15:8 give the period of the repeated parameter sets in access units: they go in front of
+   every period-th access unit after the IDR picture, or in front of every one for a period of 0 or 1.
+   The other bits are not used and read back as 0. */
+#define CY_FX_UVC_RESIL_PARAM_SETS      (0x0001)    /* Repeat the parameter sets in front of access units. */
+#define CY_FX_UVC_RESIL_SYNC            (0x0002)    /* Send an IDR picture at least every CY_FX_UVC_RESIL_SYNC_MS. */
+#define CY_FX_UVC_RESIL_FEATURES        (0x0003)
+#define CY_FX_UVC_RESIL_PERIOD_POS      (8)
+#define CY_FX_UVC_RESIL_PERIOD_MASK     (0xFF00)
+
+/* Longest time between IDR pictures with CY_FX_UVC_RESIL_SYNC set, in ms. A shorter sync frame interval
+   set with the sync and reference frame control is kept. */
+#define CY_FX_UVC_RESIL_SYNC_MS         (1000)
+
+/* Longest parameter sets that are repeated, start codes included. */
+#define CY_FX_UVC_RESIL_PARAM_MAX       (128)
+
+/* Statistics of the error resiliency overhead since the stream start, as returned by the error
+   resiliency statistics vendor request. */
+typedef struct CyFxUvcResilStats_t
+{
+    uint32_t accessUnits;               /* Access units sent. */
+    uint32_t bytes;                     /* Bytes of the access units sent, repeated parameter sets included. */
+    uint32_t paramSets;                 /* Access units sent with the parameter sets repeated in front. */
+    uint32_t paramSetBytes;             /* Bytes of the repeated parameter sets. */
+    uint32_t syncFrames;                /* IDR pictures sent for CY_FX_UVC_RESIL_SYNC. */
+    uint32_t syncBytes;                 /* Bytes of those IDR pictures. */
+    uint32_t reserved[2];
+} CyFxUvcResilStats_t;
+
+/* Error resiliency state of a stream. */
+typedef struct CyFxUvcResil_t
+{
+    uint8_t             count[CY_FX_UVC_LAYER_MAX]; /* Access units of each layer since its parameter sets. */
+    CyBool_t            isSync;         /* The next IDR picture is sent for CY_FX_UVC_RESIL_SYNC. */
+    CyFxUvcResilStats_t stats;          /* Overhead since the stream start. */
+} CyFxUvcResil_t;
+
+/* Start the error resiliency state and statistics of a stream. */
+extern void
+CyFxUvcResilStart (
+        CyFxUvcResil_t *rs_p);
+
+/* Length of the parameter sets at the start of the IDR access unit of auLen bytes of a stored stream:
+   all the NAL units in front of its last one, which is the IDR picture as the stored streams have one
+   slice per picture. Returns 0 for an access unit of one NAL unit. */
+extern uint32_t
+CyFxUvcResilParamSets (
+        const uint8_t *idr_p,
+        uint32_t       idrLen);
+
+/* Count the next access unit of auLen bytes of stream (the layer of a simulcast stream, else 0), and
+   decide whether the paramLen bytes of parameter sets of the stream go in front of it. They do when
+   the features ask for them and the period has come round, and only if they fit in the room left in the
+   frame buffer. The IDR picture carries them already and starts the period over. Returns the number
+   of bytes to send in front: paramLen or 0. */
+extern uint32_t
+CyFxUvcResilFrame (
+        CyFxUvcResil_t *rs_p,
+        uint16_t        features,
+        uint8_t         stream,
+        CyBool_t        isIdr,
+        uint32_t        paramLen,
+        uint32_t        auLen,
+        uint32_t        room);
+
+/* Whether a sync frame is due, elapsed ms after the last IDR picture, for the sync frame interval
+   period (ms, 0 for none) of the sync and reference frame control, which CY_FX_UVC_RESIL_SYNC limits to
+   CY_FX_UVC_RESIL_SYNC_MS. A sync frame due only to the limit is counted with the next IDR picture. */
+extern CyBool_t
+CyFxUvcResilSyncDue (
+        CyFxUvcResil_t *rs_p,
+        uint16_t        features,
+        uint32_t        period,
+        uint32_t        elapsed);
+
+#include <cyu3externcend.h>
+
+#endif /* _INCLUDED_CYFXUVCRESIL_H_ */
+
+/*[]*/
+
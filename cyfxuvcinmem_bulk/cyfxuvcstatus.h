@@ -0,0 +1,121 @@
+/*
+ ## Cypress USB 3.0 Platform header file (cyfxuvcstatus.h)
+ ## ===========================
+ ##
+ ##  Copyright Cypress Semiconductor Corporation, 2010-2023,
+ ##  All Rights Reserved
+ ##  UNPUBLISHED, LICENSED SOFTWARE.
+ ##
+ ##  CONFIDENTIAL AND PROPRIETARY INFORMATION
+ ##  WHICH IS THE PROPERTY OF CYPRESS.
+ ##
+ ##  Use of this file is governed
+ ##  by the license agreement included in the file
+ ##
+ ##     <install>/license/license.txt
+ ##
+ ##  where <install> is the Cypress software
+ ##  installation root directory path.
+ ##
+ ## ===========================
+*/
+
+/* File: cyfxuvcstatus.h
+ *
+ * Queue of the status packets sent on the status interrupt endpoint of the video control interface. The
+ * device reports a control whose value it changes on its own, the completion of a SET_CUR on an
+ * asynchronous control, and errors of the video stream, so that the host does not have to poll the
+ * controls over the control endpoint. An event only names the control or interface; the packet is built
+ * when the endpoint is free, with the value at that time, so that an event queued again before it has
+ * been sent is merged into the queued one and a burst of changes costs one packet per control.
+ */
+
+#ifndef _INCLUDED_CYFXUVCSTATUS_H_
+#define _INCLUDED_CYFXUVCSTATUS_H_
+
+#include <cyu3types.h>
+#include "cyfxuvcctrl.h"
+#include <cyu3externcstart.h>
+
+/* Number of events that can wait for the endpoint. Merging keeps it to one per control. */
+#define CY_FX_UVC_STATUS_QUEUE_LEN      (8)
+
+/* bStatusType of a status packet: the interface that reports the event. */
+#define CY_FX_UVC_STATUS_TYPE_VC        (0x01)
+#define CY_FX_UVC_STATUS_TYPE_VS        (0x02)
+
+/* bEvent and bAttribute of a video control interface packet: a change of the control value. */
+#define CY_FX_UVC_STATUS_EVENT_CONTROL  (0x00)
+#define CY_FX_UVC_STATUS_ATTR_VALUE     (0x00)
+
+/* Longest status packet: a control change with the longest control value. */
+#define CY_FX_UVC_STATUS_MAX_LEN        (5 + CY_FX_UVC_CTRL_MAX_LEN)
+
+/* An event waiting for the endpoint. */
+typedef struct CyFxUvcStatusEvent_t
+{
+    const CyFxUvcCtrlInfo_t *ctrl_p;    /* Control whose value changed, NULL for a stream error. */
+    uint8_t                  interface; /* Video streaming interface, for a stream error. */
+    CyBool_t                 isHeld;    /* The asynchronous SET_CUR has not been taken up yet. */
+} CyFxUvcStatusEvent_t;
+
+/* Status packet queue, oldest event first. */
+typedef struct CyFxUvcStatus_t
+{
+    CyFxUvcStatusEvent_t event[CY_FX_UVC_STATUS_QUEUE_LEN];
+    uint8_t              count;         /* Events in the queue. */
+    uint32_t             sent;          /* Packets built since the queue was started. */
+    uint32_t             merged;        /* Events merged into one that was already queued. */
+    uint32_t             dropped;       /* Events lost to a full queue. */
+} CyFxUvcStatus_t;
+
+/* Empty the queue and clear its counters. */
+extern void
+CyFxUvcStatusInit (
+        CyFxUvcStatus_t *st_p);
+
+/* Queue a change of the value of a control. A held event is not sent until CyFxUvcStatusRelease is
+   called for the action of the control: it reports the completion of an asynchronous SET_CUR that the
+   streamer takes up later. An event for a control that is already queued is merged into it, and held
+   if either is. Returns CyFalse if the queue is full and the event is lost. */
+extern CyBool_t
+CyFxUvcStatusControl (
+        CyFxUvcStatus_t         *st_p,
+        const CyFxUvcCtrlInfo_t *ctrl_p,
+        CyBool_t                 isHeld);
+
+/* Queue a stream error of a video streaming interface, sent with the stream error code at the time the
+   packet is built. Returns CyFalse if the queue is full and the event is lost. */
+extern CyBool_t
+CyFxUvcStatusStream (
+        CyFxUvcStatus_t *st_p,
+        uint8_t          interface);
+
+/* Whether an asynchronous SET_CUR on a control is still waiting to be taken up. */
+extern CyBool_t
+CyFxUvcStatusIsHeld (
+        CyFxUvcStatus_t         *st_p,
+        const CyFxUvcCtrlInfo_t *ctrl_p);
+
+/* Let the held events of the controls with a SET_CUR action (CY_FX_UVC_CTRL_APPLY_*) go, once the
+   streamer has taken up their values. */
+extern void
+CyFxUvcStatusRelease (
+        CyFxUvcStatus_t *st_p,
+        uint8_t          apply);
+
+/* Take the oldest event that is not held off the queue, and write its status packet to buf_p, which
+   has room for CY_FX_UVC_STATUS_MAX_LEN bytes. A control change carries the current value of the
+   control; a stream error carries the stream error code as bEvent, and is dropped if the code has been
+   cleared by a stream start since. Returns the length of the packet, 0 if there is nothing to send. */
+extern uint16_t
+CyFxUvcStatusNext (
+        CyFxUvcStatus_t *st_p,
+        uint8_t         *buf_p);
+
+#include <cyu3externcend.h>
+
+#endif /* _INCLUDED_CYFXUVCSTATUS_H_ */
+
+/*[]*/
+
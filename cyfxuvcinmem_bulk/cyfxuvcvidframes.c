@@ -22,32 +22,16 @@
 
 #include "cyfxuvcinmem.h"
 
-/* This file contains the MJPEG-1 video frames and Video frame related data. */
-
-/* UVC Probe Control Setting */
-const uint8_t glProbeCtrl[CY_FX_UVC_MAX_PROBE_SETTING] __attribute__ ((aligned (32))) = {
-    0x00,0x00,                       /* bmHint : No fixed parameters */
-    0x01,                            /* Use 1st Video format index */
-    0x01,                            /* Use 1st Video frame index */
-    0x2A,0x2C,0x0A,0x00,             /* Desired frame interval in 100ns */
-    0x00,0x00,                       /* Key frame rate in key frame/video frame units */
-    0x00,0x00,                       /* PFrame rate in PFrame / key frame units */
-    0x00,0x00,                       /* Compression quality control */
-    0x00,0x00,                       /* Window size for average bit rate */
-    0x00,0x00,                       /* Internal video streaming i/f latency in ms */
-    0x00,0x90,0x01,0x00,             /* Max video frame size in bytes (100KB) */
-    0x00,0x10,0x00,0x00,             /* No. of bytes device can transmit in single payload */
-    0x00,0x60,0xE3,0x16,             /* Device clock. */
-    0x00,0x00,0x00,0x00              /* Framing and format information. */
-};
+/* This file contains the MJPEG-1 video frames and Video frame related data. The format table that
+ * refers to them (glUvcFormats) is generated into cyfxuvcformats.c. */
 
 /* Video frame lengths */
 const uint32_t glVidFrameLen[CY_FX_UVC_MAX_VID_FRAMES] = {
     13711, 13417
 };
 
-/* MJPEG Video Frames */
-const uint8_t glUVCVidFrames[] =
+/* MJPEG Video Frames. Aligned to a cache line so that the payload copies read whole lines. */
+const uint8_t glUVCVidFrames[] __attribute__ ((aligned (32))) =
 {
     /* Video frame 1 */
     0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46,
@@ -3446,3 +3430,10020 @@ const uint8_t glUVCVidFrames[] =
     0xd9
 };
 
+/* 320 x 240 test frames: colour bars with the frame number burned in (tools/fx3_uvc_mjpeg_frames.py). */
+const uint32_t glVidFrameLen320x240[2] = {
+    3127, 3139
+};
+
+const uint8_t glUVCVidFrames320x240[] __attribute__ ((aligned (32))) =
+{
+    /* Video frame 1 */
+    0xFF,0xD8,0xFF,0xE0,0x00,0x10,0x4A,0x46,
+    0x49,0x46,0x00,0x01,0x01,0x00,0x00,0x01,
+    0x00,0x01,0x00,0x00,0xFF,0xDB,0x00,0x43,
+    0x00,0x10,0x0B,0x0C,0x0E,0x0C,0x0A,0x10,
+    0x0E,0x0D,0x0E,0x12,0x11,0x10,0x13,0x18,
+    0x28,0x1A,0x18,0x16,0x16,0x18,0x31,0x23,
+    0x25,0x1D,0x28,0x3A,0x33,0x3D,0x3C,0x39,
+    0x33,0x38,0x37,0x40,0x48,0x5C,0x4E,0x40,
+    0x44,0x57,0x45,0x37,0x38,0x50,0x6D,0x51,
+    0x57,0x5F,0x62,0x67,0x68,0x67,0x3E,0x4D,
+    0x71,0x79,0x70,0x64,0x78,0x5C,0x65,0x67,
+    0x63,0xFF,0xDB,0x00,0x43,0x01,0x11,0x12,
+    0x12,0x18,0x15,0x18,0x2F,0x1A,0x1A,0x2F,
+    0x63,0x42,0x38,0x42,0x63,0x63,0x63,0x63,
+    0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,
+    0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,
+    0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,
+    0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,
+    0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,
+    0x63,0x63,0x63,0x63,0x63,0x63,0xFF,0xC0,
+    0x00,0x11,0x08,0x00,0xF0,0x01,0x40,0x03,
+    0x01,0x22,0x00,0x02,0x11,0x01,0x03,0x11,
+    0x01,0xFF,0xC4,0x00,0x1B,0x00,0x01,0x01,
+    0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,
+    0x04,0x05,0x02,0x07,0x06,0x01,0xFF,0xC4,
+    0x00,0x3D,0x10,0x01,0x00,0x01,0x01,0x04,
+    0x05,0x07,0x09,0x07,0x04,0x03,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x02,0x01,0x03,0x04,
+    0x33,0x71,0x11,0x12,0x32,0x81,0xB1,0x05,
+    0x16,0x21,0x42,0x64,0xA3,0xE1,0x06,0x13,
+    0x14,0x15,0x31,0x61,0x63,0xA2,0xE2,0x22,
+    0x36,0x41,0x51,0x65,0xA1,0xB2,0x54,0x62,
+    0x82,0xD2,0x23,0x83,0xC1,0xFF,0xC4,0x00,
+    0x1A,0x01,0x01,0x00,0x03,0x01,0x01,0x01,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x03,0x05,0x06,0x04,0x02,
+    0x01,0xFF,0xC4,0x00,0x2D,0x11,0x01,0x00,
+    0x01,0x01,0x06,0x04,0x06,0x02,0x03,0x01,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+    0x02,0x03,0x04,0x05,0x33,0x71,0xB1,0x14,
+    0x31,0x34,0x81,0x12,0x32,0x52,0x72,0xA1,
+    0xC1,0x21,0x51,0x11,0x13,0x42,0x22,0xF0,
+    0xFF,0xDA,0x00,0x0C,0x03,0x01,0x00,0x02,
+    0x11,0x03,0x11,0x00,0x3F,0x00,0xFD,0x00,
+    0x00,0x00,0x02,0x76,0xFB,0x14,0xCD,0x44,
+    0xED,0xF6,0x29,0x9B,0x9E,0xF7,0x93,0x53,
+    0xED,0x3C,0xD0,0x01,0x9A,0x4E,0x00,0x03,
+    0x25,0xEF,0x16,0x99,0x35,0xB2,0x5E,0xF1,
+    0x69,0x92,0xCF,0x0A,0xEA,0x23,0x49,0x57,
+    0x62,0x59,0x1D,0xE1,0x10,0x1A,0x96,0x6C,
+    0x00,0x06,0x59,0xED,0xCB,0x36,0xA6,0x59,
+    0xED,0xCB,0x35,0x5E,0x27,0xE4,0xA5,0xEE,
+    0x87,0x90,0x14,0xC9,0x00,0x01,0x3B,0xC6,
+    0x0C,0xB7,0x71,0x62,0x6D,0xBC,0x60,0xCB,
+    0x77,0x16,0x26,0x9B,0x07,0xC8,0x9D,0x7E,
+    0xA1,0xAF,0xC0,0x7A,0x6A,0xBD,0xD3,0xB4,
+    0x00,0x2D,0x97,0xA0,0x00,0x95,0xBF,0x55,
+    0x15,0xAD,0xFA,0xA8,0xB3,0xB7,0xEC,0xFA,
+    0xBB,0x6C,0x96,0x9E,0x40,0x0E,0x47,0xA0,
+    0x00,0x62,0xBC,0x63,0x4B,0x77,0x04,0xD4,
+    0xBC,0x63,0x4B,0x77,0x04,0xDB,0x5B,0xAE,
+    0x45,0x1A,0x46,0xCC,0x8D,0xE7,0x3A,0xBD,
+    0x67,0x70,0x04,0xE8,0x00,0x01,0xF5,0x50,
+    0x19,0x27,0x40,0x00,0x09,0xDB,0xEC,0x53,
+    0x35,0x13,0xB7,0xD8,0xA6,0x6E,0x7B,0xDE,
+    0x4D,0x4F,0xB4,0xF3,0x40,0x06,0x69,0x38,
+    0x00,0x0C,0x97,0xBC,0x5A,0x64,0xD6,0xC9,
+    0x7B,0xC5,0xA6,0x4B,0x3C,0x2B,0xA8,0x8D,
+    0x25,0x5D,0x89,0x64,0x77,0x84,0x40,0x6A,
+    0x59,0xB0,0x00,0x19,0x67,0xB7,0x2C,0xDA,
+    0x99,0x67,0xB7,0x2C,0xD5,0x78,0x9F,0x92,
+    0x97,0xBA,0x1E,0x40,0x53,0x24,0x00,0x04,
+    0xEF,0x18,0x32,0xDD,0xC5,0x89,0xB6,0xF1,
+    0x83,0x2D,0xDC,0x58,0x9A,0x6C,0x1F,0x22,
+    0x75,0xFA,0x86,0xBF,0x01,0xE9,0xAA,0xF7,
+    0x4E,0xD0,0x00,0xB6,0x5E,0x80,0x02,0x56,
+    0xFD,0x54,0x56,0xB7,0xEA,0xA2,0xCE,0xDF,
+    0xB3,0xEA,0xED,0xB2,0x5A,0x79,0x00,0x39,
+    0x1E,0x80,0x01,0x8A,0xF1,0x8D,0x2D,0xDC,
+    0x13,0x52,0xF1,0x8D,0x2D,0xDC,0x13,0x6D,
+    0x6E,0xB9,0x14,0x69,0x1B,0x32,0x37,0x9C,
+    0xEA,0xF5,0x9D,0xC0,0x13,0xA0,0x00,0x07,
+    0xD5,0x40,0x64,0x9D,0x00,0x00,0x27,0x6F,
+    0xB1,0x4C,0xD4,0x4E,0xDF,0x62,0x99,0xB9,
+    0xEF,0x79,0x35,0x3E,0xD3,0xCD,0x00,0x19,
+    0xA4,0xE0,0x00,0x32,0x5E,0xF1,0x69,0x93,
+    0x5B,0x25,0xEF,0x16,0x99,0x2C,0xF0,0xAE,
+    0xA2,0x34,0x95,0x76,0x25,0x91,0xDE,0x11,
+    0x01,0xA9,0x66,0xC0,0x00,0x65,0x9E,0xDC,
+    0xB3,0x6A,0x65,0x9E,0xDC,0xB3,0x55,0xE2,
+    0x7E,0x4A,0x5E,0xE8,0x79,0x01,0x4C,0x90,
+    0x00,0x13,0xBC,0x60,0xCB,0x77,0x16,0x26,
+    0xDB,0xC6,0x0C,0xB7,0x71,0x62,0x69,0xB0,
+    0x7C,0x89,0xD7,0xEA,0x1A,0xFC,0x07,0xA6,
+    0xAB,0xDD,0x3B,0x40,0x02,0xD9,0x7A,0x00,
+    0x09,0x5B,0xF5,0x51,0x5A,0xDF,0xAA,0x8B,
+    0x3B,0x7E,0xCF,0xAB,0xB6,0xC9,0x69,0xE4,
+    0x00,0xE4,0x7A,0x00,0x06,0x2B,0xC6,0x34,
+    0xB7,0x70,0x4D,0x4B,0xC6,0x34,0xB7,0x70,
+    0x4D,0xB5,0xBA,0xE4,0x51,0xA4,0x6C,0xC8,
+    0xDE,0x73,0xAB,0xD6,0x77,0x00,0x4E,0x80,
+    0x00,0x1F,0x55,0x01,0x92,0x74,0x00,0x00,
+    0x9D,0xBE,0xC5,0x33,0x51,0x3B,0x7D,0x8A,
+    0x66,0xE7,0xBD,0xE4,0xD4,0xFB,0x4F,0x34,
+    0x00,0x66,0x93,0x80,0x00,0xC9,0x7B,0xC5,
+    0xA6,0x4D,0x6C,0x97,0xBC,0x5A,0x64,0xB3,
+    0xC2,0xBA,0x88,0xD2,0x55,0xD8,0x96,0x47,
+    0x78,0x44,0x06,0xA5,0x9B,0x00,0x01,0x96,
+    0x7B,0x72,0xCD,0xA9,0x96,0x7B,0x72,0xCD,
+    0x57,0x89,0xF9,0x29,0x7B,0xA1,0xE4,0x05,
+    0x32,0x40,0x00,0x4E,0xF1,0x83,0x2D,0xDC,
+    0x58,0x9B,0x6F,0x18,0x32,0xDD,0xC5,0x89,
+    0xA6,0xC1,0xF2,0x27,0x5F,0xA8,0x6B,0xF0,
+    0x1E,0x9A,0xAF,0x74,0xED,0x00,0x0B,0x65,
+    0xE8,0x00,0x25,0x6F,0xD5,0x45,0x6B,0x7E,
+    0xAA,0x2C,0xED,0xFB,0x3E,0xAE,0xDB,0x25,
+    0xA7,0x90,0x03,0x91,0xE8,0x00,0x18,0xAF,
+    0x18,0xD2,0xDD,0xC1,0x35,0x2F,0x18,0xD2,
+    0xDD,0xC1,0x36,0xD6,0xEB,0x91,0x46,0x91,
+    0xB3,0x23,0x79,0xCE,0xAF,0x59,0xDC,0x01,
+    0x3A,0x00,0x00,0x7D,0x54,0x06,0x49,0xD0,
+    0x00,0x02,0x76,0xFB,0x14,0xCD,0x44,0xED,
+    0xF6,0x29,0x9B,0x9E,0xF7,0x93,0x53,0xED,
+    0x3C,0xD0,0x01,0x9A,0x4E,0x00,0x03,0x25,
+    0xEF,0x16,0x99,0x35,0xB2,0x5E,0xF1,0x69,
+    0x92,0xCF,0x0A,0xEA,0x23,0x49,0x57,0x62,
+    0x59,0x1D,0xE1,0x10,0x1A,0x96,0x6C,0x00,
+    0x06,0x59,0xED,0xCB,0x36,0xA6,0x59,0xED,
+    0xCB,0x35,0x5E,0x27,0xE4,0xA5,0xEE,0x87,
+    0x90,0x14,0xC9,0x00,0x01,0x3B,0xC6,0x0C,
+    0xB7,0x71,0x62,0x6D,0xBC,0x60,0xCB,0x77,
+    0x16,0x26,0x9B,0x07,0xC8,0x9D,0x7E,0xA1,
+    0xAF,0xC0,0x7A,0x6A,0xBD,0xD3,0xB4,0x00,
+    0x2D,0x97,0xA0,0x00,0x95,0xBF,0x55,0x15,
+    0xAD,0xFA,0xA8,0xB3,0xB7,0xEC,0xFA,0xBB,
+    0x6C,0x96,0x9E,0x40,0x0E,0x47,0xA0,0x00,
+    0x62,0xBC,0x63,0x4B,0x77,0x04,0xD4,0xBC,
+    0x63,0x4B,0x77,0x04,0xDB,0x5B,0xAE,0x45,
+    0x1A,0x46,0xCC,0x8D,0xE7,0x3A,0xBD,0x67,
+    0x70,0x04,0xE8,0x00,0x01,0xF5,0x50,0x19,
+    0x27,0x40,0x00,0x09,0xDB,0xEC,0x53,0x35,
+    0x13,0xB7,0xD8,0xA6,0x6E,0x7B,0xDE,0x4D,
+    0x4F,0xB4,0xF3,0x40,0x06,0x69,0x38,0x00,
+    0x0C,0x97,0xBC,0x5A,0x64,0xD6,0xC9,0x7B,
+    0xC5,0xA6,0x4B,0x3C,0x2B,0xA8,0x8D,0x25,
+    0x5D,0x89,0x64,0x77,0x84,0x40,0x6A,0x59,
+    0xB0,0x00,0x19,0x67,0xB7,0x2C,0xDA,0x99,
+    0x67,0xB7,0x2C,0xD5,0x78,0x9F,0x92,0x97,
+    0xBA,0x1E,0x40,0x53,0x24,0x00,0x04,0xEF,
+    0x18,0x32,0xDD,0xC5,0x89,0xB6,0xF1,0x83,
+    0x2D,0xDC,0x58,0x9A,0x6C,0x1F,0x22,0x75,
+    0xFA,0x86,0xBF,0x01,0xE9,0xAA,0xF7,0x4E,
+    0xD0,0x00,0xB6,0x5E,0x80,0x02,0x56,0xFD,
+    0x54,0x56,0xB7,0xEA,0xA2,0xCE,0xDF,0xB3,
+    0xEA,0xED,0xB2,0x5A,0x79,0x00,0x39,0x1E,
+    0x80,0x01,0x8A,0xF1,0x8D,0x2D,0xDC,0x13,
+    0x52,0xF1,0x8D,0x2D,0xDC,0x13,0x6D,0x6E,
+    0xB9,0x14,0x69,0x1B,0x32,0x37,0x9C,0xEA,
+    0xF5,0x9D,0xC0,0x13,0xA0,0x00,0x07,0xD5,
+    0x40,0x64,0x9D,0x00,0x00,0x27,0x6F,0xB1,
+    0x4C,0xD4,0x4E,0xDF,0x62,0x99,0xB9,0xEF,
+    0x79,0x35,0x3E,0xD3,0xCD,0x00,0x19,0xA4,
+    0xE0,0x00,0x32,0x5E,0xF1,0x69,0x93,0x5B,
+    0x25,0xEF,0x16,0x99,0x2C,0xF0,0xAE,0xA2,
+    0x34,0x95,0x76,0x25,0x91,0xDE,0x11,0x01,
+    0xA9,0x66,0xC0,0x00,0x65,0x9E,0xDC,0xB3,
+    0x6A,0x65,0x9E,0xDC,0xB3,0x55,0xE2,0x7E,
+    0x4A,0x5E,0xE8,0x79,0x01,0x4C,0x90,0x00,
+    0x13,0xBC,0x60,0xCB,0x77,0x16,0x26,0xDB,
+    0xC6,0x0C,0xB7,0x71,0x62,0x69,0xB0,0x7C,
+    0x89,0xD7,0xEA,0x1A,0xFC,0x07,0xA6,0xAB,
+    0xDD,0x3B,0x40,0x02,0xD9,0x7A,0x00,0x09,
+    0x5B,0xF5,0x51,0x5A,0xDF,0xAA,0x8B,0x3B,
+    0x7E,0xCF,0xAB,0xB6,0xC9,0x69,0xE4,0x00,
+    0xE4,0x7A,0x00,0x06,0x2B,0xC6,0x34,0xB7,
+    0x70,0x4D,0x4B,0xC6,0x34,0xB7,0x70,0x4D,
+    0xB5,0xBA,0xE4,0x51,0xA4,0x6C,0xC8,0xDE,
+    0x73,0xAB,0xD6,0x77,0x00,0x4E,0x80,0x00,
+    0x1F,0x55,0x01,0x92,0x74,0x00,0x00,0x9D,
+    0xBE,0xC5,0x33,0x51,0x3B,0x7D,0x8A,0x66,
+    0xE7,0xBD,0xE4,0xD4,0xFB,0x4F,0x34,0x00,
+    0x66,0x93,0x80,0x00,0xC9,0x7B,0xC5,0xA6,
+    0x4D,0x6C,0x97,0xBC,0x5A,0x64,0xB3,0xC2,
+    0xBA,0x88,0xD2,0x55,0xD8,0x96,0x47,0x78,
+    0x44,0x06,0xA5,0x9B,0x00,0x01,0x96,0x7B,
+    0x72,0xCD,0xA9,0x96,0x7B,0x72,0xCD,0x57,
+    0x89,0xF9,0x29,0x7B,0xA1,0xE4,0x05,0x32,
+    0x40,0x00,0x4E,0xF1,0x83,0x2D,0xDC,0x58,
+    0x9B,0x6F,0x18,0x32,0xDD,0xC5,0x89,0xA6,
+    0xC1,0xF2,0x27,0x5F,0xA8,0x6B,0xF0,0x1E,
+    0x9A,0xAF,0x74,0xED,0x00,0x0B,0x65,0xE8,
+    0x00,0x25,0x6F,0xD5,0x45,0x6B,0x7E,0xAA,
+    0x2C,0xED,0xFB,0x3E,0xAE,0xDB,0x25,0xA7,
+    0x90,0x03,0x91,0xE8,0x00,0x18,0xAF,0x18,
+    0xD2,0xDD,0xC1,0x35,0x2F,0x18,0xD2,0xDD,
+    0xC1,0x36,0xD6,0xEB,0x91,0x46,0x91,0xB3,
+    0x23,0x79,0xCE,0xAF,0x59,0xDC,0x01,0x3A,
+    0x00,0x00,0x7D,0x54,0x06,0x49,0xD0,0x00,
+    0x02,0x76,0xFB,0x14,0xCD,0x44,0xED,0xF6,
+    0x29,0x9B,0x9E,0xF7,0x93,0x53,0xED,0x3C,
+    0xD0,0x01,0x9A,0x4E,0x00,0x03,0x25,0xEF,
+    0x16,0x99,0x35,0xB2,0x5E,0xF1,0x69,0x92,
+    0xCF,0x0A,0xEA,0x23,0x49,0x57,0x62,0x59,
+    0x1D,0xE1,0x10,0x1A,0x96,0x6C,0x00,0x06,
+    0x59,0xED,0xCB,0x36,0xA6,0x59,0xED,0xCB,
+    0x35,0x5E,0x27,0xE4,0xA5,0xEE,0x87,0x90,
+    0x14,0xC9,0x00,0x01,0x3B,0xC6,0x0C,0xB7,
+    0x71,0x62,0x6D,0xBC,0x60,0xCB,0x77,0x16,
+    0x26,0x9B,0x07,0xC8,0x9D,0x7E,0xA1,0xAF,
+    0xC0,0x7A,0x6A,0xBD,0xD3,0xB4,0x00,0x2D,
+    0x97,0xA0,0x00,0x95,0xBF,0x55,0x15,0xAD,
+    0xFA,0xA8,0xB3,0xB7,0xEC,0xFA,0xBB,0x6C,
+    0x96,0x9E,0x40,0x0E,0x47,0xA0,0x00,0x62,
+    0xBC,0x63,0x4B,0x77,0x04,0xD4,0xBC,0x63,
+    0x4B,0x77,0x04,0xDB,0x5B,0xAE,0x45,0x1A,
+    0x46,0xCC,0x8D,0xE7,0x3A,0xBD,0x67,0x70,
+    0x04,0xE8,0x00,0x01,0xF5,0x50,0x19,0x27,
+    0x40,0x00,0x09,0xDB,0xEC,0x53,0x35,0x13,
+    0xB7,0xD8,0xA6,0x6E,0x7B,0xDE,0x4D,0x4F,
+    0xB4,0xF3,0x40,0x06,0x69,0x38,0x00,0x0C,
+    0x97,0xBC,0x5A,0x64,0xD6,0xC9,0x7B,0xC5,
+    0xA6,0x4B,0x3C,0x2B,0xA8,0x8D,0x25,0x5D,
+    0x89,0x64,0x77,0x84,0x40,0x6A,0x59,0xB0,
+    0x00,0x19,0x67,0xB7,0x2C,0xDA,0x99,0x67,
+    0xB7,0x2C,0xD5,0x78,0x9F,0x92,0x97,0xBA,
+    0x1E,0x40,0x53,0x24,0x00,0x04,0xEF,0x18,
+    0x32,0xDD,0xC5,0x89,0xB6,0xF1,0x83,0x2D,
+    0xDC,0x58,0x9A,0x6C,0x1F,0x22,0x75,0xFA,
+    0x86,0xBF,0x01,0xE9,0xAA,0xF7,0x4E,0xD0,
+    0x00,0xB6,0x5E,0x80,0x02,0x56,0xFD,0x54,
+    0x56,0xB7,0xEA,0xA2,0xCE,0xDF,0xB3,0xEA,
+    0xED,0xB2,0x5A,0x79,0x00,0x39,0x1E,0x80,
+    0x01,0x8A,0xF1,0x8D,0x2D,0xDC,0x13,0x52,
+    0xF1,0x8D,0x2D,0xDC,0x13,0x6D,0x6E,0xB9,
+    0x14,0x69,0x1B,0x32,0x37,0x9C,0xEA,0xF5,
+    0x9D,0xC0,0x13,0xA0,0x00,0x07,0xD5,0x40,
+    0x64,0x9D,0x00,0x00,0x27,0x6F,0xB1,0x4C,
+    0xD4,0x4E,0xDF,0x62,0x99,0xB9,0xEF,0x79,
+    0x35,0x3E,0xD3,0xCD,0x00,0x19,0xA4,0xE0,
+    0x00,0x32,0x5E,0xF1,0x69,0x93,0x5B,0x25,
+    0xEF,0x16,0x99,0x2C,0xF0,0xAE,0xA2,0x34,
+    0x95,0x76,0x25,0x91,0xDE,0x11,0x01,0xA9,
+    0x66,0xC0,0x00,0x65,0x9E,0xDC,0xB3,0x6A,
+    0x65,0x9E,0xDC,0xB3,0x55,0xE2,0x7E,0x4A,
+    0x5E,0xE8,0x79,0x01,0x4C,0x90,0x00,0x13,
+    0xBC,0x60,0xCB,0x77,0x16,0x26,0xDB,0xC6,
+    0x0C,0xB7,0x71,0x62,0x69,0xB0,0x7C,0x89,
+    0xD7,0xEA,0x1A,0xFC,0x07,0xA6,0xAB,0xDD,
+    0x3B,0x40,0x02,0xD9,0x7A,0x00,0x09,0x5B,
+    0xF5,0x51,0x5A,0xDF,0xAA,0x8B,0x3B,0x7E,
+    0xCF,0xAB,0xB6,0xC9,0x69,0xE4,0x00,0xE4,
+    0x7A,0x00,0x06,0x2B,0xC6,0x34,0xB7,0x70,
+    0x4D,0x4B,0xC6,0x34,0xB7,0x70,0x4D,0xB5,
+    0xBA,0xE4,0x51,0xA4,0x6C,0xC8,0xDE,0x73,
+    0xAB,0xD6,0x77,0x00,0x4E,0x80,0x00,0x1F,
+    0xA9,0xE7,0xAF,0xE9,0xFD,0xF7,0xD2,0x73,
+    0xD7,0xF4,0xFE,0xFB,0xE9,0x7E,0x4C,0x64,
+    0x9D,0x0F,0xD6,0x73,0xD7,0xF4,0xFE,0xFB,
+    0xE9,0x39,0xEB,0xFA,0x7F,0x7D,0xF4,0xB8,
+    0x1E,0xAD,0xB4,0xAC,0x21,0x28,0x5B,0x58,
+    0xDA,0x6B,0x5A,0x46,0xCE,0x5A,0xB2,0xAF,
+    0xD8,0x94,0xA9,0x5A,0xD2,0x95,0xAD,0x69,
+    0xA3,0xF0,0xAF,0xB2,0xB5,0xF6,0x3D,0x7A,
+    0xAE,0x7D,0x12,0xAD,0xE2,0xC2,0x96,0x32,
+    0x8D,0x25,0x1B,0x6A,0xD6,0x5A,0xB5,0xD3,
+    0x5A,0xD2,0x94,0xF6,0x69,0xD3,0xA6,0x32,
+    0xFC,0x3F,0x0A,0x83,0xBB,0xCF,0x5F,0xD3,
+    0xFB,0xEF,0xA5,0xE6,0x7E,0x59,0xEB,0xD3,
+    0x47,0xA0,0x68,0xFF,0x00,0xBB,0xE9,0x7E,
+    0x6E,0x77,0x4B,0xC5,0x9C,0xE5,0x09,0x58,
+    0xCE,0x92,0x8E,0x9D,0x3F,0x67,0xF2,0xAE,
+    0x8A,0xFE,0xFD,0x0A,0x5E,0x6E,0x16,0x96,
+    0x1E,0x6F,0x44,0xE1,0x6D,0xAF,0x39,0x59,
+    0xD3,0xCD,0xE9,0xAF,0xDA,0xA6,0x8D,0x31,
+    0xF6,0x7B,0xE9,0xEC,0xE8,0xE9,0x79,0xAE,
+    0x88,0xAE,0x99,0xA6,0xAE,0x43,0xB9,0xCE,
+    0xFE,0xC3,0xDE,0xFD,0x27,0x3B,0xFB,0x0F,
+    0x7B,0xF4,0xB9,0x73,0xE4,0x5B,0xC5,0x9D,
+    0xB5,0x6C,0xA7,0x69,0x63,0x49,0xD6,0xB1,
+    0x8C,0x29,0xAD,0x5A,0xF9,0xC9,0x56,0x34,
+    0x96,0xAC,0x7A,0x3D,0xBA,0x25,0x4F,0x77,
+    0x4B,0x1D,0xDA,0xED,0x3B,0xCC,0xE5,0x18,
+    0x56,0x34,0xD5,0xA5,0x2B,0x5A,0xCB,0xF2,
+    0xD3,0x4A,0x7F,0xEB,0x9B,0x81,0xB0,0xF4,
+    0xFC,0xCB,0xD7,0x8A,0x5F,0xA0,0xE7,0x7F,
+    0x61,0xEF,0x7E,0x93,0x9D,0xFD,0x87,0xBD,
+    0xFA,0x5C,0x1A,0xDC,0xE7,0x4B,0x87,0xA6,
+    0x6B,0xD9,0xEA,0x6B,0xD2,0x1A,0xB4,0x96,
+    0x99,0x53,0x4E,0xB6,0x8A,0xD6,0x9F,0x85,
+    0x3E,0xCD,0x59,0xCE,0x06,0xC3,0xD3,0xF3,
+    0x27,0x8A,0x5F,0xA6,0xE7,0x7F,0x61,0xEF,
+    0x7E,0x94,0xAD,0x7C,0xA8,0xF3,0x92,0xA5,
+    0x7D,0x0F,0x47,0x46,0x8C,0x5F,0x07,0xE7,
+    0x84,0x96,0x57,0x7B,0x3B,0x1A,0xBC,0x54,
+    0x47,0xF1,0x28,0xED,0x68,0x8B,0x5A,0x7C,
+    0x35,0xFE,0x61,0xDE,0xE7,0x27,0x64,0xEF,
+    0x3C,0x0E,0x72,0x76,0x4E,0xF3,0xC1,0xC1,
+    0x1D,0x7F,0xDB,0x57,0xED,0xCD,0xC0,0xD8,
+    0x7A,0x7E,0x65,0xDE,0xE7,0x27,0x64,0xEF,
+    0x3C,0x0E,0x72,0x76,0x4E,0xF3,0xC1,0xC1,
+    0x0F,0xED,0xAB,0xF6,0x70,0x36,0x1E,0x9F,
+    0x99,0x77,0xB9,0xC9,0xD9,0x3B,0xCF,0x04,
+    0xAB,0xCB,0xDA,0x6B,0x5A,0xFA,0x37,0xB7,
+    0xE2,0x78,0x38,0xC2,0x2B,0x58,0x8B,0x58,
+    0xFE,0x2B,0xFC,0xBE,0xC5,0xCA,0xC2,0x3F,
+    0xCF,0xCC,0xBB,0x1E,0xBD,0xEC,0xDF,0x3F,
+    0x81,0xEB,0xDE,0xCD,0xF3,0xF8,0x38,0xE2,
+    0x0E,0x1A,0xCB,0xF4,0xFB,0xC2,0x58,0xFA,
+    0x77,0x76,0x3D,0x7B,0xD9,0xBE,0x7F,0x03,
+    0xD7,0xBD,0x9B,0xE7,0xF0,0x71,0xC3,0x86,
+    0xB2,0xFD,0x1C,0x25,0x8F,0xA7,0x77,0x5A,
+    0xD3,0x96,0xF5,0xE1,0x58,0xFA,0x3E,0x8D,
+    0x3F,0xDF,0xE0,0x8F,0xAC,0xFE,0x0F,0xCD,
+    0xE0,0xE7,0x8E,0xAB,0x1A,0xA6,0xC2,0x9F,
+    0x0D,0x9F,0xE2,0x1D,0x76,0x15,0xD5,0x77,
+    0xA7,0xC1,0x65,0xF8,0x8E,0x7F,0xFB,0xF9,
+    0x74,0x3D,0x67,0xF0,0x7E,0x6F,0x03,0xD6,
+    0x7F,0x07,0xE6,0xF0,0x73,0xC4,0xDC,0x4D,
+    0xAF,0xED,0x3F,0x17,0x6D,0xEA,0xD9,0xD0,
+    0xF5,0x9F,0xC1,0xF9,0xBC,0x0F,0x59,0xFC,
+    0x1F,0x9B,0xC1,0xCF,0x0E,0x26,0xD7,0xF6,
+    0x71,0x76,0xDE,0xAD,0x9B,0x6D,0x39,0x43,
+    0x5F,0x47,0xFC,0x5A,0x34,0x7F,0x77,0x83,
+    0xC7,0xA6,0x7C,0x3F,0xDD,0x94,0x73,0x57,
+    0x11,0x69,0x57,0x8A,0xAE,0x6F,0x51,0x7D,
+    0xB7,0x8F,0xF5,0xF1,0x0D,0x5E,0x99,0xF0,
+    0xFF,0x00,0x73,0xD3,0x3E,0x1F,0xEE,0xCA,
+    0x3C,0x7F,0x55,0x3F,0xA3,0x8E,0xB7,0xF5,
+    0x7C,0x43,0x57,0xA6,0x7C,0x3F,0xDC,0xF4,
+    0xCF,0x87,0xFB,0xB2,0x87,0xF5,0x53,0xFA,
+    0x38,0xEB,0x7F,0x57,0xC4,0x29,0x69,0x69,
+    0xAF,0x3A,0xCB,0x46,0x8D,0x3E,0xF7,0x8D,
+    0x6F,0x73,0xF8,0x3B,0x69,0xBD,0xDB,0x51,
+    0x4C,0x53,0x4D,0x5F,0x88,0xD1,0xC9,0x57,
+    0xFD,0x55,0x35,0x4F,0x39,0x7F,0x75,0xBD,
+    0xC6,0xB7,0xB9,0xFC,0x1E,0xB8,0xEB,0x7F,
+    0x57,0xC4,0x3C,0xF8,0x61,0xFD,0xD6,0xF7,
+    0x1A,0xDE,0xE7,0xF0,0x38,0xEB,0x7F,0x57,
+    0xC4,0x1E,0x18,0x00,0x72,0x3D,0x3A,0x73,
+    0xBD,0xDC,0xA7,0x61,0x67,0x76,0xAD,0x6F,
+    0x3E,0x63,0xCF,0x52,0xD2,0xB1,0xAD,0x29,
+    0x5A,0xD8,0xC7,0x45,0x75,0xA3,0x0E,0x9E,
+    0x9D,0x3A,0x7D,0xB5,0xD1,0xEC,0xA3,0xD5,
+    0xAD,0xF6,0xE9,0x6D,0x5B,0x5B,0x19,0xCA,
+    0xDB,0xD1,0xE7,0x5B,0x39,0x47,0x56,0xCE,
+    0x94,0xAC,0x35,0x35,0xA9,0x48,0xD2,0x9A,
+    0xDE,0xCD,0x12,0xAF,0x4E,0x9D,0x3A,0x5C,
+    0xA0,0x1D,0x5B,0x6E,0x53,0xB2,0xBC,0x5D,
+    0xAF,0x16,0x56,0x94,0xB4,0x8C,0xAF,0x16,
+    0xB2,0xB6,0x94,0xA3,0x4A,0x57,0x56,0xB5,
+    0x95,0x2B,0xAB,0x4E,0x9E,0x9A,0x68,0xE9,
+    0xAF,0xBE,0x94,0xFC,0x9E,0x6D,0xAF,0xF6,
+    0x16,0x37,0x8B,0x19,0xDC,0xA3,0x29,0xD9,
+    0x58,0xC6,0xB1,0x85,0x9D,0xB4,0x35,0x75,
+    0x74,0xF5,0xB4,0xC6,0x5D,0x32,0xAF,0xB7,
+    0x4F,0x46,0x8E,0x8D,0x1E,0xCA,0x68,0xE6,
+    0x00,0xED,0xCF,0x96,0x2E,0xB6,0x96,0xB7,
+    0x6B,0x4F,0x33,0x3B,0x3A,0xDD,0x2B,0x0B,
+    0x4B,0x38,0xC2,0x9A,0x69,0x29,0x52,0x10,
+    0x8D,0x69,0x5D,0x32,0xE8,0xA6,0x98,0x53,
+    0x45,0x7A,0x7A,0x3D,0xEC,0xBC,0x97,0xCA,
+    0x54,0xE4,0xFB,0x2B,0xC5,0x29,0x0A,0xD6,
+    0x76,0xB1,0xD5,0xA5,0x69,0x29,0x53,0xA3,
+    0x45,0x7F,0x2A,0xD3,0xF1,0xAD,0x3F,0x77,
+    0x38,0x06,0x88,0x5B,0xC6,0x3C,0x9D,0x6D,
+    0x77,0xAD,0x25,0xAF,0x69,0x6B,0x67,0x3A,
+    0x57,0xF0,0xD1,0x1A,0x4E,0x95,0xFE,0x54,
+    0x67,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x07,0xD4,0xB9,0xA1,0xC8,0x5F,0xD0,0xF7,
+    0xB3,0xFF,0x00,0x63,0x9A,0x1C,0x85,0xFD,
+    0x0F,0x7B,0x3F,0xF6,0x77,0x00,0x70,0xF9,
+    0xA1,0xC8,0x5F,0xD0,0xF7,0xB3,0xFF,0x00,
+    0x67,0x2F,0xCA,0x6F,0x27,0x39,0x26,0xE1,
+    0xC8,0x37,0x9B,0xCD,0xD6,0xE9,0xE6,0xED,
+    0xA1,0xAB,0xAB,0x2F,0x39,0x3A,0xE8,0xD3,
+    0x2A,0x52,0xBD,0x15,0xAF,0xE5,0x57,0xEC,
+    0x1C,0x3F,0x2C,0xFE,0xEB,0xDF,0x3F,0xC3,
+    0xF9,0xC4,0x1F,0x2D,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xF6,
+    0xE0,0x00,0x70,0xFC,0xB3,0xFB,0xAF,0x7C,
+    0xFF,0x00,0x0F,0xE7,0x17,0x71,0xC3,0xF2,
+    0xCF,0xEE,0xBD,0xF3,0xFC,0x3F,0x9C,0x41,
+    0xF2,0xD0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x1F,0xFF,0xD9,
+
+    /* Video frame 2 */
+    0xFF,0xD8,0xFF,0xE0,0x00,0x10,0x4A,0x46,
+    0x49,0x46,0x00,0x01,0x01,0x00,0x00,0x01,
+    0x00,0x01,0x00,0x00,0xFF,0xDB,0x00,0x43,
+    0x00,0x10,0x0B,0x0C,0x0E,0x0C,0x0A,0x10,
+    0x0E,0x0D,0x0E,0x12,0x11,0x10,0x13,0x18,
+    0x28,0x1A,0x18,0x16,0x16,0x18,0x31,0x23,
+    0x25,0x1D,0x28,0x3A,0x33,0x3D,0x3C,0x39,
+    0x33,0x38,0x37,0x40,0x48,0x5C,0x4E,0x40,
+    0x44,0x57,0x45,0x37,0x38,0x50,0x6D,0x51,
+    0x57,0x5F,0x62,0x67,0x68,0x67,0x3E,0x4D,
+    0x71,0x79,0x70,0x64,0x78,0x5C,0x65,0x67,
+    0x63,0xFF,0xDB,0x00,0x43,0x01,0x11,0x12,
+    0x12,0x18,0x15,0x18,0x2F,0x1A,0x1A,0x2F,
+    0x63,0x42,0x38,0x42,0x63,0x63,0x63,0x63,
+    0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,
+    0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,
+    0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,
+    0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,
+    0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,
+    0x63,0x63,0x63,0x63,0x63,0x63,0xFF,0xC0,
+    0x00,0x11,0x08,0x00,0xF0,0x01,0x40,0x03,
+    0x01,0x22,0x00,0x02,0x11,0x01,0x03,0x11,
+    0x01,0xFF,0xC4,0x00,0x1B,0x00,0x01,0x01,
+    0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,
+    0x04,0x05,0x02,0x07,0x06,0x01,0xFF,0xC4,
+    0x00,0x3D,0x10,0x01,0x00,0x00,0x03,0x04,
+    0x05,0x07,0x09,0x08,0x02,0x03,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x02,0x03,0x04,
+    0x11,0x33,0x71,0x12,0x21,0x32,0x81,0xB1,
+    0x05,0x16,0x31,0x42,0x64,0xA3,0xE1,0x06,
+    0x13,0x14,0x15,0x61,0x63,0xA1,0xA2,0xE2,
+    0x22,0x36,0x41,0x51,0x54,0x65,0x82,0xB2,
+    0x62,0xD2,0x23,0x83,0xC1,0xFF,0xC4,0x00,
+    0x1A,0x01,0x01,0x00,0x03,0x01,0x01,0x01,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x03,0x05,0x06,0x04,0x02,
+    0x01,0xFF,0xC4,0x00,0x2D,0x11,0x01,0x00,
+    0x01,0x01,0x06,0x04,0x06,0x02,0x03,0x01,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+    0x02,0x03,0x04,0x05,0x33,0x71,0xB1,0x14,
+    0x31,0x34,0x81,0x12,0x32,0x52,0x72,0xA1,
+    0xC1,0x21,0x51,0x11,0x13,0x42,0x22,0xF0,
+    0xFF,0xDA,0x00,0x0C,0x03,0x01,0x00,0x02,
+    0x11,0x03,0x11,0x00,0x3F,0x00,0xFD,0x00,
+    0x00,0x00,0x02,0x75,0xF6,0x21,0x9A,0x89,
+    0xD7,0xD8,0x86,0x6E,0x7B,0xDE,0x4D,0x4F,
+    0xB4,0xF3,0x40,0x06,0x69,0x38,0x00,0x0C,
+    0x96,0xBC,0x58,0x64,0xD6,0xC9,0x6B,0xC5,
+    0x86,0x4B,0x3C,0x2B,0xA8,0x8D,0x25,0x5D,
+    0x89,0x64,0x77,0x84,0x40,0x6A,0x59,0xB0,
+    0x00,0x19,0x67,0xDB,0x9B,0x36,0xA6,0x59,
+    0xF6,0xE6,0xCD,0x57,0x89,0xF9,0x29,0x7B,
+    0xA1,0xE4,0x05,0x32,0x40,0x00,0x4E,0xD1,
+    0x83,0x36,0xEE,0x2C,0x4D,0xB6,0x8C,0x19,
+    0xB7,0x71,0x62,0x69,0xB0,0x7C,0x89,0xD7,
+    0xEA,0x1A,0xFC,0x07,0xA6,0xAB,0xDD,0x3B,
+    0x40,0x02,0xD9,0x7A,0x00,0x09,0x57,0xEA,
+    0xA2,0xB5,0x7E,0xAA,0x2C,0xED,0xFB,0x3E,
+    0xAE,0xDB,0x25,0xA7,0x90,0x03,0x91,0xE8,
+    0x00,0x18,0xAD,0x18,0xD3,0x6E,0xE0,0x9A,
+    0x96,0x8C,0x69,0xB7,0x70,0x4D,0xB5,0xBA,
+    0xE4,0x51,0xA4,0x6C,0xC8,0xDE,0x73,0xAB,
+    0xD6,0x77,0x00,0x4E,0x80,0x00,0x1F,0x55,
+    0x01,0x92,0x74,0x00,0x00,0x9D,0x7D,0x88,
+    0x66,0xA2,0x75,0xF6,0x21,0x9B,0x9E,0xF7,
+    0x93,0x53,0xED,0x3C,0xD0,0x01,0x9A,0x4E,
+    0x00,0x03,0x25,0xAF,0x16,0x19,0x35,0xB2,
+    0x5A,0xF1,0x61,0x92,0xCF,0x0A,0xEA,0x23,
+    0x49,0x57,0x62,0x59,0x1D,0xE1,0x10,0x1A,
+    0x96,0x6C,0x00,0x06,0x59,0xF6,0xE6,0xCD,
+    0xA9,0x96,0x7D,0xB9,0xB3,0x55,0xE2,0x7E,
+    0x4A,0x5E,0xE8,0x79,0x01,0x4C,0x90,0x00,
+    0x13,0xB4,0x60,0xCD,0xBB,0x8B,0x13,0x6D,
+    0xA3,0x06,0x6D,0xDC,0x58,0x9A,0x6C,0x1F,
+    0x22,0x75,0xFA,0x86,0xBF,0x01,0xE9,0xAA,
+    0xF7,0x4E,0xD0,0x00,0xB6,0x5E,0x80,0x02,
+    0x55,0xFA,0xA8,0xAD,0x5F,0xAA,0x8B,0x3B,
+    0x7E,0xCF,0xAB,0xB6,0xC9,0x69,0xE4,0x00,
+    0xE4,0x7A,0x00,0x06,0x2B,0x46,0x34,0xDB,
+    0xB8,0x26,0xA5,0xA3,0x1A,0x6D,0xDC,0x13,
+    0x6D,0x6E,0xB9,0x14,0x69,0x1B,0x32,0x37,
+    0x9C,0xEA,0xF5,0x9D,0xC0,0x13,0xA0,0x00,
+    0x07,0xD5,0x40,0x64,0x9D,0x00,0x00,0x27,
+    0x5F,0x62,0x19,0xA8,0x9D,0x7D,0x88,0x66,
+    0xE7,0xBD,0xE4,0xD4,0xFB,0x4F,0x34,0x00,
+    0x66,0x93,0x80,0x00,0xC9,0x6B,0xC5,0x86,
+    0x4D,0x6C,0x96,0xBC,0x58,0x64,0xB3,0xC2,
+    0xBA,0x88,0xD2,0x55,0xD8,0x96,0x47,0x78,
+    0x44,0x06,0xA5,0x9B,0x00,0x01,0x96,0x7D,
+    0xB9,0xB3,0x6A,0x65,0x9F,0x6E,0x6C,0xD5,
+    0x78,0x9F,0x92,0x97,0xBA,0x1E,0x40,0x53,
+    0x24,0x00,0x04,0xED,0x18,0x33,0x6E,0xE2,
+    0xC4,0xDB,0x68,0xC1,0x9B,0x77,0x16,0x26,
+    0x9B,0x07,0xC8,0x9D,0x7E,0xA1,0xAF,0xC0,
+    0x7A,0x6A,0xBD,0xD3,0xB4,0x00,0x2D,0x97,
+    0xA0,0x00,0x95,0x7E,0xAA,0x2B,0x57,0xEA,
+    0xA2,0xCE,0xDF,0xB3,0xEA,0xED,0xB2,0x5A,
+    0x79,0x00,0x39,0x1E,0x80,0x01,0x8A,0xD1,
+    0x8D,0x36,0xEE,0x09,0xA9,0x68,0xC6,0x9B,
+    0x77,0x04,0xDB,0x5B,0xAE,0x45,0x1A,0x46,
+    0xCC,0x8D,0xE7,0x3A,0xBD,0x67,0x70,0x04,
+    0xE8,0x00,0x01,0xF5,0x50,0x19,0x27,0x40,
+    0x00,0x09,0xD7,0xD8,0x86,0x6A,0x27,0x5F,
+    0x62,0x19,0xB9,0xEF,0x79,0x35,0x3E,0xD3,
+    0xCD,0x00,0x19,0xA4,0xE0,0x00,0x32,0x5A,
+    0xF1,0x61,0x93,0x5B,0x25,0xAF,0x16,0x19,
+    0x2C,0xF0,0xAE,0xA2,0x34,0x95,0x76,0x25,
+    0x91,0xDE,0x11,0x01,0xA9,0x66,0xC0,0x00,
+    0x65,0x9F,0x6E,0x6C,0xDA,0x99,0x67,0xDB,
+    0x9B,0x35,0x5E,0x27,0xE4,0xA5,0xEE,0x87,
+    0x90,0x14,0xC9,0x00,0x01,0x3B,0x46,0x0C,
+    0xDB,0xB8,0xB1,0x36,0xDA,0x30,0x66,0xDD,
+    0xC5,0x89,0xA6,0xC1,0xF2,0x27,0x5F,0xA8,
+    0x6B,0xF0,0x1E,0x9A,0xAF,0x74,0xED,0x00,
+    0x0B,0x65,0xE8,0x00,0x25,0x5F,0xAA,0x8A,
+    0xD5,0xFA,0xA8,0xB3,0xB7,0xEC,0xFA,0xBB,
+    0x6C,0x96,0x9E,0x40,0x0E,0x47,0xA0,0x00,
+    0x62,0xB4,0x63,0x4D,0xBB,0x82,0x6A,0x5A,
+    0x31,0xA6,0xDD,0xC1,0x36,0xD6,0xEB,0x91,
+    0x46,0x91,0xB3,0x23,0x79,0xCE,0xAF,0x59,
+    0xDC,0x01,0x3A,0x00,0x00,0x7D,0x54,0x06,
+    0x49,0xD0,0x00,0x02,0x75,0xF6,0x21,0x9A,
+    0x89,0xD7,0xD8,0x86,0x6E,0x7B,0xDE,0x4D,
+    0x4F,0xB4,0xF3,0x40,0x06,0x69,0x38,0x00,
+    0x0C,0x96,0xBC,0x58,0x64,0xD6,0xC9,0x6B,
+    0xC5,0x86,0x4B,0x3C,0x2B,0xA8,0x8D,0x25,
+    0x5D,0x89,0x64,0x77,0x84,0x40,0x6A,0x59,
+    0xB0,0x00,0x19,0x67,0xDB,0x9B,0x36,0xA6,
+    0x59,0xF6,0xE6,0xCD,0x57,0x89,0xF9,0x29,
+    0x7B,0xA1,0xE4,0x05,0x32,0x40,0x00,0x4E,
+    0xD1,0x83,0x36,0xEE,0x2C,0x4D,0xB6,0x8C,
+    0x19,0xB7,0x71,0x62,0x69,0xB0,0x7C,0x89,
+    0xD7,0xEA,0x1A,0xFC,0x07,0xA6,0xAB,0xDD,
+    0x3B,0x40,0x02,0xD9,0x7A,0x00,0x09,0x57,
+    0xEA,0xA2,0xB5,0x7E,0xAA,0x2C,0xED,0xFB,
+    0x3E,0xAE,0xDB,0x25,0xA7,0x90,0x03,0x91,
+    0xE8,0x00,0x18,0xAD,0x18,0xD3,0x6E,0xE0,
+    0x9A,0x96,0x8C,0x69,0xB7,0x70,0x4D,0xB5,
+    0xBA,0xE4,0x51,0xA4,0x6C,0xC8,0xDE,0x73,
+    0xAB,0xD6,0x77,0x00,0x4E,0x80,0x00,0x1F,
+    0x55,0x01,0x92,0x74,0x00,0x00,0x9D,0x7D,
+    0x88,0x66,0xA2,0x75,0xF6,0x21,0x9B,0x9E,
+    0xF7,0x93,0x53,0xED,0x3C,0xD0,0x01,0x9A,
+    0x4E,0x00,0x03,0x25,0xAF,0x16,0x19,0x35,
+    0xB2,0x5A,0xF1,0x61,0x92,0xCF,0x0A,0xEA,
+    0x23,0x49,0x57,0x62,0x59,0x1D,0xE1,0x10,
+    0x1A,0x96,0x6C,0x00,0x06,0x59,0xF6,0xE6,
+    0xCD,0xA9,0x96,0x7D,0xB9,0xB3,0x55,0xE2,
+    0x7E,0x4A,0x5E,0xE8,0x79,0x01,0x4C,0x90,
+    0x00,0x13,0xB4,0x60,0xCD,0xBB,0x8B,0x13,
+    0x6D,0xA3,0x06,0x6D,0xDC,0x58,0x9A,0x6C,
+    0x1F,0x22,0x75,0xFA,0x86,0xBF,0x01,0xE9,
+    0xAA,0xF7,0x4E,0xD0,0x00,0xB6,0x5E,0x80,
+    0x02,0x55,0xFA,0xA8,0xAD,0x5F,0xAA,0x8B,
+    0x3B,0x7E,0xCF,0xAB,0xB6,0xC9,0x69,0xE4,
+    0x00,0xE4,0x7A,0x00,0x06,0x2B,0x46,0x34,
+    0xDB,0xB8,0x26,0xA5,0xA3,0x1A,0x6D,0xDC,
+    0x13,0x6D,0x6E,0xB9,0x14,0x69,0x1B,0x32,
+    0x37,0x9C,0xEA,0xF5,0x9D,0xC0,0x13,0xA0,
+    0x00,0x07,0xD5,0x40,0x64,0x9D,0x00,0x00,
+    0x27,0x5F,0x62,0x19,0xA8,0x9D,0x7D,0x88,
+    0x66,0xE7,0xBD,0xE4,0xD4,0xFB,0x4F,0x34,
+    0x00,0x66,0x93,0x80,0x00,0xC9,0x6B,0xC5,
+    0x86,0x4D,0x6C,0x96,0xBC,0x58,0x64,0xB3,
+    0xC2,0xBA,0x88,0xD2,0x55,0xD8,0x96,0x47,
+    0x78,0x44,0x06,0xA5,0x9B,0x00,0x01,0x96,
+    0x7D,0xB9,0xB3,0x6A,0x65,0x9F,0x6E,0x6C,
+    0xD5,0x78,0x9F,0x92,0x97,0xBA,0x1E,0x40,
+    0x53,0x24,0x00,0x04,0xED,0x18,0x33,0x6E,
+    0xE2,0xC4,0xDB,0x68,0xC1,0x9B,0x77,0x16,
+    0x26,0x9B,0x07,0xC8,0x9D,0x7E,0xA1,0xAF,
+    0xC0,0x7A,0x6A,0xBD,0xD3,0xB4,0x00,0x2D,
+    0x97,0xA0,0x00,0x95,0x7E,0xAA,0x2B,0x57,
+    0xEA,0xA2,0xCE,0xDF,0xB3,0xEA,0xED,0xB2,
+    0x5A,0x79,0x00,0x39,0x1E,0x80,0x01,0x8A,
+    0xD1,0x8D,0x36,0xEE,0x09,0xA9,0x68,0xC6,
+    0x9B,0x77,0x04,0xDB,0x5B,0xAE,0x45,0x1A,
+    0x46,0xCC,0x8D,0xE7,0x3A,0xBD,0x67,0x70,
+    0x04,0xE8,0x00,0x01,0xF5,0x50,0x19,0x27,
+    0x40,0x00,0x09,0xD7,0xD8,0x86,0x6A,0x27,
+    0x5F,0x62,0x19,0xB9,0xEF,0x79,0x35,0x3E,
+    0xD3,0xCD,0x00,0x19,0xA4,0xE0,0x00,0x32,
+    0x5A,0xF1,0x61,0x93,0x5B,0x25,0xAF,0x16,
+    0x19,0x2C,0xF0,0xAE,0xA2,0x34,0x95,0x76,
+    0x25,0x91,0xDE,0x11,0x01,0xA9,0x66,0xC0,
+    0x00,0x65,0x9F,0x6E,0x6C,0xDA,0x99,0x67,
+    0xDB,0x9B,0x35,0x5E,0x27,0xE4,0xA5,0xEE,
+    0x87,0x90,0x14,0xC9,0x00,0x01,0x3B,0x46,
+    0x0C,0xDB,0xB8,0xB1,0x36,0xDA,0x30,0x66,
+    0xDD,0xC5,0x89,0xA6,0xC1,0xF2,0x27,0x5F,
+    0xA8,0x6B,0xF0,0x1E,0x9A,0xAF,0x74,0xED,
+    0x00,0x0B,0x65,0xE8,0x00,0x25,0x5F,0xAA,
+    0x8A,0xD5,0xFA,0xA8,0xB3,0xB7,0xEC,0xFA,
+    0xBB,0x6C,0x96,0x9E,0x40,0x0E,0x47,0xA0,
+    0x00,0x62,0xB4,0x63,0x4D,0xBB,0x82,0x6A,
+    0x5A,0x31,0xA6,0xDD,0xC1,0x36,0xD6,0xEB,
+    0x91,0x46,0x91,0xB3,0x23,0x79,0xCE,0xAF,
+    0x59,0xDC,0x01,0x3A,0x00,0x00,0x7D,0x54,
+    0x06,0x49,0xD0,0x00,0x02,0x75,0xF6,0x21,
+    0x9A,0x89,0xD7,0xD8,0x86,0x6E,0x7B,0xDE,
+    0x4D,0x4F,0xB4,0xF3,0x40,0x06,0x69,0x38,
+    0x00,0x0C,0x96,0xBC,0x58,0x64,0xD6,0xC9,
+    0x6B,0xC5,0x86,0x4B,0x3C,0x2B,0xA8,0x8D,
+    0x25,0x5D,0x89,0x64,0x77,0x84,0x40,0x6A,
+    0x59,0xB0,0x00,0x19,0x67,0xDB,0x9B,0x36,
+    0xA6,0x59,0xF6,0xE6,0xCD,0x57,0x89,0xF9,
+    0x29,0x7B,0xA1,0xE4,0x05,0x32,0x40,0x00,
+    0x4E,0xD1,0x83,0x36,0xEE,0x2C,0x4D,0xB6,
+    0x8C,0x19,0xB7,0x71,0x62,0x69,0xB0,0x7C,
+    0x89,0xD7,0xEA,0x1A,0xFC,0x07,0xA6,0xAB,
+    0xDD,0x3B,0x40,0x02,0xD9,0x7A,0x00,0x09,
+    0x57,0xEA,0xA2,0xB5,0x7E,0xAA,0x2C,0xED,
+    0xFB,0x3E,0xAE,0xDB,0x25,0xA7,0x90,0x03,
+    0x91,0xE8,0x00,0x18,0xAD,0x18,0xD3,0x6E,
+    0xE0,0x9A,0x96,0x8C,0x69,0xB7,0x70,0x4D,
+    0xB5,0xBA,0xE4,0x51,0xA4,0x6C,0xC8,0xDE,
+    0x73,0xAB,0xD6,0x77,0x00,0x4E,0x80,0x00,
+    0x1F,0x55,0x01,0x92,0x74,0x00,0x00,0x9D,
+    0x7D,0x88,0x66,0xA2,0x75,0xF6,0x21,0x9B,
+    0x9E,0xF7,0x93,0x53,0xED,0x3C,0xD0,0x01,
+    0x9A,0x4E,0x00,0x03,0x25,0xAF,0x16,0x19,
+    0x35,0xB2,0x5A,0xF1,0x61,0x92,0xCF,0x0A,
+    0xEA,0x23,0x49,0x57,0x62,0x59,0x1D,0xE1,
+    0x10,0x1A,0x96,0x6C,0x00,0x06,0x59,0xF6,
+    0xE6,0xCD,0xA9,0x96,0x7D,0xB9,0xB3,0x55,
+    0xE2,0x7E,0x4A,0x5E,0xE8,0x79,0x01,0x4C,
+    0x90,0x00,0x13,0xB4,0x60,0xCD,0xBB,0x8B,
+    0x13,0x6D,0xA3,0x06,0x6D,0xDC,0x58,0x9A,
+    0x6C,0x1F,0x22,0x75,0xFA,0x86,0xBF,0x01,
+    0xE9,0xAA,0xF7,0x4E,0xD0,0x00,0xB6,0x5E,
+    0x80,0x02,0x55,0xFA,0xA8,0xAD,0x5F,0xAA,
+    0x8B,0x3B,0x7E,0xCF,0xAB,0xB6,0xC9,0x69,
+    0xE4,0x00,0xE4,0x7A,0x00,0x06,0x2B,0x46,
+    0x34,0xDB,0xB8,0x26,0xA5,0xA3,0x1A,0x6D,
+    0xDC,0x13,0x6D,0x6E,0xB9,0x14,0x69,0x1B,
+    0x32,0x37,0x9C,0xEA,0xF5,0x9D,0xC0,0x13,
+    0xA0,0x00,0x07,0xD5,0x40,0x64,0x9D,0x00,
+    0x00,0x27,0x5F,0x62,0x19,0xA8,0x9D,0x7D,
+    0x88,0x66,0xE7,0xBD,0xE4,0xD4,0xFB,0x4F,
+    0x34,0x00,0x66,0x93,0x80,0x00,0xC9,0x6B,
+    0xC5,0x86,0x4D,0x6C,0x96,0xBC,0x58,0x64,
+    0xB3,0xC2,0xBA,0x88,0xD2,0x55,0xD8,0x96,
+    0x47,0x78,0x44,0x06,0xA5,0x9B,0x00,0x01,
+    0x96,0x7D,0xB9,0xB3,0x6A,0x65,0x9F,0x6E,
+    0x6C,0xD5,0x78,0x9F,0x92,0x97,0xBA,0x1E,
+    0x40,0x53,0x24,0x00,0x04,0xED,0x18,0x33,
+    0x6E,0xE2,0xC4,0xDB,0x68,0xC1,0x9B,0x77,
+    0x16,0x26,0x9B,0x07,0xC8,0x9D,0x7E,0xA1,
+    0xAF,0xC0,0x7A,0x6A,0xBD,0xD3,0xB4,0x00,
+    0x2D,0x97,0xA0,0x00,0x95,0x7E,0xAA,0x2B,
+    0x57,0xEA,0xA2,0xCE,0xDF,0xB3,0xEA,0xED,
+    0xB2,0x5A,0x79,0x00,0x39,0x1E,0x80,0x01,
+    0x8A,0xD1,0x8D,0x36,0xEE,0x09,0xA9,0x68,
+    0xC6,0x9B,0x77,0x04,0xDB,0x5B,0xAE,0x45,
+    0x1A,0x46,0xCC,0x8D,0xE7,0x3A,0xBD,0x67,
+    0x70,0x04,0xE8,0x00,0x01,0xFA,0x9E,0x7A,
+    0xFE,0xDF,0xDF,0x7D,0x27,0x3D,0x7F,0x6F,
+    0xEF,0xBE,0x97,0xE4,0xC6,0x49,0xD0,0xFD,
+    0x67,0x3D,0x7F,0x6F,0xEF,0xBE,0x93,0x9E,
+    0xBF,0xB7,0xF7,0xDF,0x4B,0x81,0xEA,0xDA,
+    0x91,0x92,0x49,0xA4,0xAD,0x46,0xA6,0x95,
+    0x49,0x69,0xCD,0xA3,0x34,0x7E,0xC4,0xD3,
+    0x42,0x31,0x84,0x23,0x18,0xC2,0xEF,0xC2,
+    0x3D,0x11,0x8F,0x43,0xD7,0xAA,0xE7,0xD5,
+    0x34,0x6D,0x14,0x21,0x46,0x69,0x61,0x34,
+    0xB5,0xA3,0x19,0xB4,0x63,0x7C,0x63,0x08,
+    0x43,0xA2,0xFB,0xEF,0x96,0x6F,0xC3,0xF0,
+    0x88,0x3B,0xBC,0xF5,0xFD,0xBF,0xBE,0xFA,
+    0x5E,0x67,0xF2,0xCF,0x4E,0x17,0x7A,0x05,
+    0xDF,0xF7,0x7D,0x2F,0xCD,0xCF,0x64,0xB4,
+    0x53,0x9E,0x69,0x26,0xA3,0x3C,0x26,0x96,
+    0xFB,0xFE,0xCF,0xE5,0x1B,0xA3,0xF1,0xD4,
+    0xA5,0xA6,0xC1,0x52,0x87,0x9B,0xBA,0x79,
+    0x2B,0x69,0xCF,0x35,0x38,0x79,0xBB,0xE3,
+    0xF6,0xA1,0x75,0xF2,0xF4,0x7B,0x61,0xD1,
+    0xAB,0x5B,0xCD,0x74,0x45,0x74,0xCD,0x35,
+    0x72,0x1D,0xCE,0x77,0xF6,0x1E,0xF7,0xE9,
+    0x39,0xDF,0xD8,0x7B,0xDF,0xA5,0xCB,0x9F,
+    0x91,0x6D,0x14,0xEB,0x46,0x94,0xF5,0x28,
+    0xC2,0x78,0xC6,0x59,0x64,0x86,0x94,0x63,
+    0xE7,0x26,0x8C,0xB0,0x9B,0x46,0x5D,0x5D,
+    0x37,0x4D,0x0F,0x66,0xB6,0x3B,0x35,0x9A,
+    0x7B,0x4C,0xF3,0x4B,0x24,0x65,0x86,0x8C,
+    0x21,0x18,0xC6,0x6F,0xCA,0xF8,0x43,0xFF,
+    0x00,0x5C,0xDC,0x0D,0x87,0xA7,0xE6,0x5E,
+    0xBC,0x52,0xFD,0x07,0x3B,0xFB,0x0F,0x7B,
+    0xF4,0x9C,0xEF,0xEC,0x3D,0xEF,0xD2,0xE1,
+    0x42,0xC3,0x3C,0x6C,0x93,0x5A,0x21,0x52,
+    0x9C,0x74,0x65,0x84,0xF1,0xA7,0x7C,0x74,
+    0xA1,0x2E,0x96,0x8D,0xFD,0x17,0x74,0xDD,
+    0xF8,0xDF,0xAD,0x98,0xE0,0x6C,0x3D,0x3F,
+    0x32,0x78,0xA5,0xFA,0x6E,0x77,0xF6,0x1E,
+    0xF7,0xE9,0x4A,0xAF,0x95,0x1E,0x72,0x68,
+    0x47,0xD0,0xEE,0xD5,0x76,0x2F,0x83,0xF3,
+    0xC2,0x4B,0x2B,0xBD,0x9D,0x8D,0x5E,0x2A,
+    0x23,0xF8,0x94,0x76,0xB4,0x45,0xAD,0x3E,
+    0x1A,0xFF,0x00,0x30,0xEF,0x73,0x93,0xB2,
+    0x77,0x9E,0x07,0x39,0x3B,0x27,0x79,0xE0,
+    0xE0,0x8E,0xBF,0xED,0xAB,0xF6,0xE6,0xE0,
+    0x6C,0x3D,0x3F,0x32,0xEF,0x73,0x93,0xB2,
+    0x77,0x9E,0x07,0x39,0x3B,0x27,0x79,0xE0,
+    0xE0,0x87,0xF6,0xD5,0xFB,0x38,0x1B,0x0F,
+    0x4F,0xCC,0xBB,0xDC,0xE4,0xEC,0x9D,0xE7,
+    0x82,0x51,0xE5,0xEB,0xE3,0x18,0xFA,0x37,
+    0x4F,0xBC,0xF0,0x71,0x84,0x56,0xB1,0x16,
+    0xB1,0xFC,0x57,0xF9,0x7D,0x8B,0x95,0x84,
+    0x7F,0x9F,0x99,0x76,0x3D,0x7B,0xD9,0xBE,
+    0x7F,0x03,0xD7,0xBD,0x9B,0xE7,0xF0,0x71,
+    0xC4,0x1C,0x35,0x97,0xE9,0xF7,0x84,0xB1,
+    0xF4,0xEE,0xEC,0x7A,0xF7,0xB3,0x7C,0xFE,
+    0x07,0xAF,0x7B,0x37,0xCF,0xE0,0xE3,0x87,
+    0x0D,0x65,0xFA,0x38,0x4B,0x1F,0x4E,0xEE,
+    0xB5,0x4E,0x5B,0xD3,0x92,0x32,0xFA,0x3D,
+    0xD7,0xFF,0x00,0x9F,0x82,0x3E,0xB3,0xF7,
+    0x3F,0x37,0x83,0x9E,0x3A,0xAC,0x6A,0x9B,
+    0x0A,0x7C,0x36,0x7F,0x88,0x75,0xD8,0x57,
+    0x55,0xDE,0x9F,0x05,0x97,0xE2,0x39,0xFF,
+    0x00,0xEF,0xE5,0xD0,0xF5,0x9F,0xB9,0xF9,
+    0xBC,0x0F,0x59,0xFB,0x9F,0x9B,0xC1,0xCF,
+    0x13,0x71,0x36,0xBF,0xB4,0xFC,0x5D,0xB7,
+    0xAB,0x67,0x43,0xD6,0x7E,0xE7,0xE6,0xF0,
+    0x3D,0x67,0xEE,0x7E,0x6F,0x07,0x3C,0x38,
+    0x9B,0x5F,0xD9,0xC5,0xDB,0x7A,0xB6,0x6D,
+    0xA9,0xCA,0x1A,0x77,0x7F,0xC5,0x75,0xDF,
+    0xE5,0xE0,0xF1,0xE9,0x9E,0xEF,0xE2,0xCA,
+    0x39,0xAB,0x88,0xB4,0xAB,0xC5,0x57,0x37,
+    0xA8,0xBE,0xDB,0xC7,0xFA,0xF8,0x86,0xAF,
+    0x4C,0xF7,0x7F,0x13,0xD3,0x3D,0xDF,0xC5,
+    0x94,0x78,0xFE,0xAA,0x7F,0x47,0x1D,0x6F,
+    0xEA,0xF8,0x86,0xAF,0x4C,0xF7,0x7F,0x13,
+    0xD3,0x3D,0xDF,0xC5,0x94,0x3F,0xAA,0x9F,
+    0xD1,0xC7,0x5B,0xFA,0xBE,0x21,0x4A,0x95,
+    0x34,0xE7,0x8C,0xD7,0x5D,0x7F,0xB5,0xE3,
+    0x4B,0xD8,0xFE,0x0E,0xDA,0x6F,0x76,0xD4,
+    0x53,0x14,0xD3,0x57,0xE2,0x34,0x72,0x55,
+    0xFF,0x00,0x55,0x4D,0x53,0xCE,0x5F,0xDD,
+    0x2F,0x61,0xA5,0xEC,0x7F,0x07,0xAE,0x3A,
+    0xDF,0xD5,0xF1,0x0F,0x3E,0x18,0x7F,0x74,
+    0xBD,0x86,0x97,0xB1,0xFC,0x0E,0x3A,0xDF,
+    0xD5,0xF1,0x07,0x86,0x00,0x1C,0x8F,0x4E,
+    0x9C,0xF6,0xBB,0x14,0xF4,0x29,0xD9,0xA3,
+    0x1B,0x4F,0x98,0xF3,0xD0,0xA9,0x19,0x63,
+    0x08,0x46,0x34,0x65,0xBA,0x3A,0x52,0xC9,
+    0xAF,0x5D,0xF7,0xF4,0xC6,0xEE,0x88,0x3D,
+    0x55,0xB6,0xD9,0x2B,0x46,0xAD,0x19,0xE6,
+    0xAD,0xE8,0xF3,0xC6,0x9C,0xD2,0xE8,0xD3,
+    0x84,0x23,0x26,0x86,0x94,0x21,0x2C,0x21,
+    0xA5,0xD1,0x74,0xD1,0xD7,0x7D,0xF7,0xB9,
+    0x40,0x3A,0xB5,0xB9,0x4E,0x95,0xA2,0xCD,
+    0x68,0xA5,0x52,0x15,0x25,0x9A,0xD1,0x56,
+    0x6A,0xD3,0x4D,0x2C,0x21,0x1D,0x18,0xC6,
+    0x68,0x47,0x46,0x1A,0xF5,0xC2,0xED,0x71,
+    0xF6,0xC2,0x1F,0x93,0xCD,0x6B,0x7D,0x0A,
+    0x36,0x8A,0x33,0xD8,0xA5,0x9A,0x7A,0x54,
+    0x65,0x8C,0xB2,0x53,0xAD,0x26,0x8E,0x8D,
+    0xFD,0x6B,0xE5,0x9B,0x5C,0xD1,0xE9,0xBF,
+    0x55,0xDA,0xAE,0xE8,0x85,0xDC,0xC0,0x1D,
+    0xB9,0xF9,0x62,0xCB,0x52,0xAD,0x9A,0xA7,
+    0x99,0x9E,0x9C,0x6C,0x91,0x92,0xA5,0x39,
+    0x64,0x85,0xF0,0x9A,0x68,0x49,0x24,0xB1,
+    0x84,0x6F,0x9B,0x54,0x2F,0x92,0x17,0x47,
+    0x5E,0xAF,0x6B,0x2F,0x25,0xF2,0x94,0x39,
+    0x3E,0x95,0xA2,0x10,0x92,0x31,0x9E,0xAC,
+    0xBA,0x30,0x8C,0x26,0x9A,0x1A,0xAE,0x8F,
+    0xE5,0x18,0x7E,0x31,0x87,0xC5,0xCE,0x01,
+    0xB6,0x6A,0xD6,0x69,0x79,0x32,0x14,0x69,
+    0x4F,0x56,0x15,0xA7,0x8E,0x95,0x5B,0xE9,
+    0xC2,0xE9,0xA3,0x7E,0xA8,0x69,0x69,0x5F,
+    0x74,0x3A,0x7A,0x35,0xC7,0x75,0xD8,0x80,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x01,0xFB,0xEF,0x26,0x7C,0x9C,0xE4,
+    0x9B,0x7F,0x20,0xD9,0xAD,0x36,0xAB,0x27,
+    0x9C,0xAD,0x3E,0x96,0x94,0xDE,0x72,0x78,
+    0x5F,0x74,0xD1,0x84,0x35,0x42,0x3F,0x94,
+    0x1D,0x4E,0x68,0x72,0x17,0xE8,0x7B,0xD9,
+    0xFF,0x00,0xD8,0xF2,0x33,0xEE,0xBD,0x8F,
+    0xF9,0xFF,0x00,0x79,0x9D,0xC0,0x70,0xF9,
+    0xA1,0xC8,0x5F,0xA1,0xEF,0x67,0xFF,0x00,
+    0x63,0x9A,0x1C,0x85,0xFA,0x1E,0xF6,0x7F,
+    0xF6,0x77,0x00,0x7C,0x44,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,
+    0xD4,0xBC,0x8C,0xFB,0xAF,0x63,0xFE,0x7F,
+    0xDE,0x67,0x71,0xC3,0xF2,0x33,0xEE,0xBD,
+    0x8F,0xF9,0xFF,0x00,0x79,0x9D,0xC0,0x00,
+    0x07,0xFF,0xD9
+};
+
+/* 1280 x 720 test frames: colour bars with the frame number burned in (tools/fx3_uvc_mjpeg_frames.py). */
+const uint32_t glVidFrameLen1280x720[2] = {
+    10539, 10525
+};
+
+const uint8_t glUVCVidFrames1280x720[] __attribute__ ((aligned (32))) =
+{
+    /* Video frame 1 */
+    0xFF,0xD8,0xFF,0xE0,0x00,0x10,0x4A,0x46,
+    0x49,0x46,0x00,0x01,0x01,0x00,0x00,0x01,
+    0x00,0x01,0x00,0x00,0xFF,0xDB,0x00,0x43,
+    0x00,0x1B,0x12,0x14,0x17,0x14,0x11,0x1B,
+    0x17,0x16,0x17,0x1E,0x1C,0x1B,0x20,0x28,
+    0x42,0x2B,0x28,0x25,0x25,0x28,0x51,0x3A,
+    0x3D,0x30,0x42,0x60,0x55,0x65,0x64,0x5F,
+    0x55,0x5D,0x5B,0x6A,0x78,0x99,0x81,0x6A,
+    0x71,0x90,0x73,0x5B,0x5D,0x85,0xB5,0x86,
+    0x90,0x9E,0xA3,0xAB,0xAD,0xAB,0x67,0x80,
+    0xBC,0xC9,0xBA,0xA6,0xC7,0x99,0xA8,0xAB,
+    0xA4,0xFF,0xDB,0x00,0x43,0x01,0x1C,0x1E,
+    0x1E,0x28,0x23,0x28,0x4E,0x2B,0x2B,0x4E,
+    0xA4,0x6E,0x5D,0x6E,0xA4,0xA4,0xA4,0xA4,
+    0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,
+    0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,
+    0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,
+    0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,
+    0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,
+    0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xFF,0xC0,
+    0x00,0x11,0x08,0x02,0xD0,0x05,0x00,0x03,
+    0x01,0x22,0x00,0x02,0x11,0x01,0x03,0x11,
+    0x01,0xFF,0xC4,0x00,0x1B,0x00,0x01,0x01,
+    0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+    0x03,0x04,0x05,0x01,0x06,0x07,0xFF,0xC4,
+    0x00,0x37,0x10,0x01,0x00,0x01,0x03,0x01,
+    0x05,0x04,0x08,0x06,0x02,0x03,0x01,0x01,
+    0x00,0x00,0x00,0x00,0x01,0x02,0x03,0x32,
+    0x71,0x11,0x15,0x41,0xA2,0xE1,0x62,0x63,
+    0x64,0xA1,0x04,0x05,0x12,0x13,0x14,0x16,
+    0x21,0xA3,0x31,0x35,0x54,0x82,0xB2,0xD1,
+    0x61,0x81,0x22,0x51,0x91,0xC1,0x23,0xFF,
+    0xC4,0x00,0x1A,0x01,0x01,0x01,0x00,0x03,
+    0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x05,0x02,0x03,
+    0x04,0x01,0x06,0xFF,0xC4,0x00,0x24,0x11,
+    0x01,0x00,0x01,0x03,0x04,0x02,0x03,0x01,
+    0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x01,0x03,0x04,0x33,0x02,0x31,0x32,
+    0x51,0x13,0x71,0x05,0x11,0x14,0x12,0x21,
+    0x22,0xFF,0xDA,0x00,0x0C,0x03,0x01,0x00,
+    0x02,0x11,0x03,0x11,0x00,0x3F,0x00,0xF4,
+    0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x04,0xD7,0x8C,0xB2,0x6B,0x5E,0x32,0xC9,
+    0x3A,0xEF,0x9C,0x7A,0x67,0xA7,0x60,0x07,
+    0x2B,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,
+    0x7F,0x08,0xD5,0x68,0xBF,0x84,0x6A,0xDD,
+    0x6F,0x97,0x4B,0x4D,0x7C,0x72,0xC0,0x05,
+    0xE4,0x50,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x04,0x5C,0xE0,0x85,0xDC,0xE0,0x84,0xBB,
+    0x8C,0x92,0xCE,0x36,0x00,0x68,0x7A,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x03,0x0B,0xD9,0xC6,
+    0x8D,0xD8,0x5E,0xCE,0x34,0x75,0xD9,0x65,
+    0x77,0x7C,0x7E,0x66,0x60,0x2C,0xBE,0x80,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x9D,
+    0x79,0x4A,0x55,0x5E,0x52,0x94,0x7A,0x9C,
+    0xE7,0xDB,0x64,0x6C,0x00,0xC0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x01,0xCD,0x5E,0x75,0x6A,
+    0xE9,0x73,0x57,0x9D,0x5A,0xA8,0x58,0x72,
+    0x97,0x0D,0xEF,0x18,0x7C,0x01,0x51,0x34,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFB,
+    0x20,0x11,0x1B,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x13,0x5E,0x32,0xC9,0xAD,0x78,
+    0xCB,0x24,0xEB,0xBE,0x71,0xE9,0x9E,0x9D,
+    0x80,0x1C,0xAC,0x80,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x45,0xFC,0x23,0x55,0xA2,0xFE,0x11,
+    0xAB,0x75,0xBE,0x5D,0x2D,0x35,0xF1,0xCB,
+    0x00,0x17,0x91,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x11,0x73,0x82,0x17,0x73,0x82,
+    0x12,0xEE,0x32,0x4B,0x38,0xD8,0x01,0xA1,
+    0xE8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x2F,
+    0x67,0x1A,0x37,0x61,0x7B,0x38,0xD1,0xD7,
+    0x65,0x95,0xDD,0xF1,0xF9,0x99,0x80,0xB2,
+    0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x06,0x75,0xE5,0x29,0x55,0x79,0x4A,0x51,
+    0xEA,0x73,0x9F,0x6D,0x91,0xB0,0x03,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x07,0x35,0x79,
+    0xD5,0xAB,0xA5,0xCD,0x5E,0x75,0x6A,0xA1,
+    0x61,0xCA,0x5C,0x37,0xBC,0x61,0xF0,0x05,
+    0x44,0xD0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x07,0xEC,0x80,0x44,0x6D,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x4D,0x78,0xCB,0x26,
+    0xB5,0xE3,0x2C,0x93,0xAE,0xF9,0xC7,0xA6,
+    0x7A,0x76,0x00,0x72,0xB2,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x01,0x17,0xF0,0x8D,0x56,0x8B,
+    0xF8,0x46,0xAD,0xD6,0xF9,0x74,0xB4,0xD7,
+    0xC7,0x2C,0x00,0x5E,0x45,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x45,0xCE,0x08,0x5D,
+    0xCE,0x08,0x4B,0xB8,0xC9,0x2C,0xE3,0x60,
+    0x06,0x87,0xA0,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0xBD,0x9C,0x68,0xDD,0x85,0xEC,0xE3,
+    0x47,0x5D,0x96,0x57,0x77,0xC7,0xE6,0x66,
+    0x02,0xCB,0xE8,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x19,0xD7,0x94,0xA5,0x55,0xE5,
+    0x29,0x47,0xA9,0xCE,0x7D,0xB6,0x46,0xC0,
+    0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,
+    0xD5,0xE7,0x56,0xAE,0x97,0x35,0x79,0xD5,
+    0xAA,0x85,0x87,0x29,0x70,0xDE,0xF1,0x87,
+    0xC0,0x15,0x13,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x1F,0xB2,0x01,0x11,0xB4,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x01,0x35,0xE3,
+    0x2C,0x9A,0xD7,0x8C,0xB2,0x4E,0xBB,0xE7,
+    0x1E,0x99,0xE9,0xD8,0x01,0xCA,0xC8,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x04,0x5F,0xC2,0x35,
+    0x5A,0x2F,0xE1,0x1A,0xB7,0x5B,0xE5,0xD2,
+    0xD3,0x5F,0x1C,0xB0,0x01,0x79,0x14,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x01,0x17,0x38,
+    0x21,0x77,0x38,0x21,0x2E,0xE3,0x24,0xB3,
+    0x8D,0x80,0x1A,0x1E,0x80,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0xC2,0xF6,0x71,0xA3,0x76,0x17,
+    0xB3,0x8D,0x1D,0x76,0x59,0x5D,0xDF,0x1F,
+    0x99,0x98,0x0B,0x2F,0xA0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x67,0x5E,0x52,0x95,
+    0x57,0x94,0xA5,0x1E,0xA7,0x39,0xF6,0xD9,
+    0x1B,0x00,0x30,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x73,0x57,0x9D,0x5A,0xBA,0x5C,0xD5,
+    0xE7,0x56,0xAA,0x16,0x1C,0xA5,0xC3,0x7B,
+    0xC6,0x1F,0x00,0x54,0x4D,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x7E,0xC8,0x04,0x46,
+    0xD0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+    0xD7,0x8C,0xB2,0x6B,0x5E,0x32,0xC9,0x3A,
+    0xEF,0x9C,0x7A,0x67,0xA7,0x60,0x07,0x2B,
+    0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x7F,
+    0x08,0xD5,0x68,0xBF,0x84,0x6A,0xDD,0x6F,
+    0x97,0x4B,0x4D,0x7C,0x72,0xC0,0x05,0xE4,
+    0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+    0x5C,0xE0,0x85,0xDC,0xE0,0x84,0xBB,0x8C,
+    0x92,0xCE,0x36,0x00,0x68,0x7A,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x03,0x0B,0xD9,0xC6,0x8D,
+    0xD8,0x5E,0xCE,0x34,0x75,0xD9,0x65,0x77,
+    0x7C,0x7E,0x66,0x60,0x2C,0xBE,0x80,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x01,0x9D,0x79,
+    0x4A,0x55,0x5E,0x52,0x94,0x7A,0x9C,0xE7,
+    0xDB,0x64,0x6C,0x00,0xC0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x01,0xCD,0x5E,0x75,0x6A,0xE9,
+    0x73,0x57,0x9D,0x5A,0xA8,0x58,0x72,0x97,
+    0x0D,0xEF,0x18,0x7C,0x01,0x51,0x34,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x01,0xFB,0x20,
+    0x11,0x1B,0x40,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x13,0x5E,0x32,0xC9,0xAD,0x78,0xCB,
+    0x24,0xEB,0xBE,0x71,0xE9,0x9E,0x9D,0x80,
+    0x1C,0xAC,0x80,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x45,0xFC,0x23,0x55,0xA2,0xFE,0x11,0xAB,
+    0x75,0xBE,0x5D,0x2D,0x35,0xF1,0xCB,0x00,
+    0x17,0x91,0x40,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x11,0x73,0x82,0x17,0x73,0x82,0x12,
+    0xEE,0x32,0x4B,0x38,0xD8,0x01,0xA1,0xE8,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x0C,0x2F,0x67,
+    0x1A,0x37,0x61,0x7B,0x38,0xD1,0xD7,0x65,
+    0x95,0xDD,0xF1,0xF9,0x99,0x80,0xB2,0xFA,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,
+    0x75,0xE5,0x29,0x55,0x79,0x4A,0x51,0xEA,
+    0x73,0x9F,0x6D,0x91,0xB0,0x03,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x07,0x35,0x79,0xD5,
+    0xAB,0xA5,0xCD,0x5E,0x75,0x6A,0xA1,0x61,
+    0xCA,0x5C,0x37,0xBC,0x61,0xF0,0x05,0x44,
+    0xD0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,
+    0xEC,0x80,0x44,0x6D,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x4D,0x78,0xCB,0x26,0xB5,
+    0xE3,0x2C,0x93,0xAE,0xF9,0xC7,0xA6,0x7A,
+    0x76,0x00,0x72,0xB2,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x01,0x17,0xF0,0x8D,0x56,0x8B,0xF8,
+    0x46,0xAD,0xD6,0xF9,0x74,0xB4,0xD7,0xC7,
+    0x2C,0x00,0x5E,0x45,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x45,0xCE,0x08,0x5D,0xCE,
+    0x08,0x4B,0xB8,0xC9,0x2C,0xE3,0x60,0x06,
+    0x87,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,
+    0xBD,0x9C,0x68,0xDD,0x85,0xEC,0xE3,0x47,
+    0x5D,0x96,0x57,0x77,0xC7,0xE6,0x66,0x02,
+    0xCB,0xE8,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x19,0xD7,0x94,0xA5,0x55,0xE5,0x29,
+    0x47,0xA9,0xCE,0x7D,0xB6,0x46,0xC0,0x0C,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xD5,
+    0xE7,0x56,0xAE,0x97,0x35,0x79,0xD5,0xAA,
+    0x85,0x87,0x29,0x70,0xDE,0xF1,0x87,0xC0,
+    0x15,0x13,0x40,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x1F,0xB2,0x01,0x11,0xB4,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x35,0xE3,0x2C,
+    0x9A,0xD7,0x8C,0xB2,0x4E,0xBB,0xE7,0x1E,
+    0x99,0xE9,0xD8,0x01,0xCA,0xC8,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x04,0x5F,0xC2,0x35,0x5A,
+    0x2F,0xE1,0x1A,0xB7,0x5B,0xE5,0xD2,0xD3,
+    0x5F,0x1C,0xB0,0x01,0x79,0x14,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x17,0x38,0x21,
+    0x77,0x38,0x21,0x2E,0xE3,0x24,0xB3,0x8D,
+    0x80,0x1A,0x1E,0x80,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0xC2,0xF6,0x71,0xA3,0x76,0x17,0xB3,
+    0x8D,0x1D,0x76,0x59,0x5D,0xDF,0x1F,0x99,
+    0x98,0x0B,0x2F,0xA0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x67,0x5E,0x52,0x95,0x57,
+    0x94,0xA5,0x1E,0xA7,0x39,0xF6,0xD9,0x1B,
+    0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x73,0x57,0x9D,0x5A,0xBA,0x5C,0xD5,0xE7,
+    0x56,0xAA,0x16,0x1C,0xA5,0xC3,0x7B,0xC6,
+    0x1F,0x00,0x54,0x4D,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x7E,0xC8,0x04,0x46,0xD0,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xD7,
+    0x8C,0xB2,0x6B,0x5E,0x32,0xC9,0x3A,0xEF,
+    0x9C,0x7A,0x67,0xA7,0x60,0x07,0x2B,0x20,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x11,0x7F,0x08,
+    0xD5,0x68,0xBF,0x84,0x6A,0xDD,0x6F,0x97,
+    0x4B,0x4D,0x7C,0x72,0xC0,0x05,0xE4,0x50,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x5C,
+    0xE0,0x85,0xDC,0xE0,0x84,0xBB,0x8C,0x92,
+    0xCE,0x36,0x00,0x68,0x7A,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x03,0x0B,0xD9,0xC6,0x8D,0xD8,
+    0x5E,0xCE,0x34,0x75,0xD9,0x65,0x77,0x7C,
+    0x7E,0x66,0x60,0x2C,0xBE,0x80,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x9D,0x79,0x4A,
+    0x55,0x5E,0x52,0x94,0x7A,0x9C,0xE7,0xDB,
+    0x64,0x6C,0x00,0xC0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x01,0xCD,0x5E,0x75,0x6A,0xE9,0x73,
+    0x57,0x9D,0x5A,0xA8,0x58,0x72,0x97,0x0D,
+    0xEF,0x18,0x7C,0x01,0x51,0x34,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0xFB,0x20,0x11,
+    0x1B,0x40,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x13,0x5E,0x32,0xC9,0xAD,0x78,0xCB,0x24,
+    0xEB,0xBE,0x71,0xE9,0x9E,0x9D,0x80,0x1C,
+    0xAC,0x80,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,
+    0xFC,0x23,0x55,0xA2,0xFE,0x11,0xAB,0x75,
+    0xBE,0x5D,0x2D,0x35,0xF1,0xCB,0x00,0x17,
+    0x91,0x40,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x11,0x73,0x82,0x17,0x73,0x82,0x12,0xEE,
+    0x32,0x4B,0x38,0xD8,0x01,0xA1,0xE8,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x0C,0x2F,0x67,0x1A,
+    0x37,0x61,0x7B,0x38,0xD1,0xD7,0x65,0x95,
+    0xDD,0xF1,0xF9,0x99,0x80,0xB2,0xFA,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x75,
+    0xE5,0x29,0x55,0x79,0x4A,0x51,0xEA,0x73,
+    0x9F,0x6D,0x91,0xB0,0x03,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x07,0x35,0x79,0xD5,0xAB,
+    0xA5,0xCD,0x5E,0x75,0x6A,0xA1,0x61,0xCA,
+    0x5C,0x37,0xBC,0x61,0xF0,0x05,0x44,0xD0,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xEC,
+    0x80,0x44,0x6D,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x4D,0x78,0xCB,0x26,0xB5,0xE3,
+    0x2C,0x93,0xAE,0xF9,0xC7,0xA6,0x7A,0x76,
+    0x00,0x72,0xB2,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x17,0xF0,0x8D,0x56,0x8B,0xF8,0x46,
+    0xAD,0xD6,0xF9,0x74,0xB4,0xD7,0xC7,0x2C,
+    0x00,0x5E,0x45,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x45,0xCE,0x08,0x5D,0xCE,0x08,
+    0x4B,0xB8,0xC9,0x2C,0xE3,0x60,0x06,0x87,
+    0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x30,0xBD,
+    0x9C,0x68,0xDD,0x85,0xEC,0xE3,0x47,0x5D,
+    0x96,0x57,0x77,0xC7,0xE6,0x66,0x02,0xCB,
+    0xE8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x19,0xD7,0x94,0xA5,0x55,0xE5,0x29,0x47,
+    0xA9,0xCE,0x7D,0xB6,0x46,0xC0,0x0C,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x1C,0xD5,0xE7,
+    0x56,0xAE,0x97,0x35,0x79,0xD5,0xAA,0x85,
+    0x87,0x29,0x70,0xDE,0xF1,0x87,0xC0,0x15,
+    0x13,0x40,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x1F,0xB2,0x01,0x11,0xB4,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x01,0x35,0xE3,0x2C,0x9A,
+    0xD7,0x8C,0xB2,0x4E,0xBB,0xE7,0x1E,0x99,
+    0xE9,0xD8,0x01,0xCA,0xC8,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x04,0x5F,0xC2,0x35,0x5A,0x2F,
+    0xE1,0x1A,0xB7,0x5B,0xE5,0xD2,0xD3,0x5F,
+    0x1C,0xB0,0x01,0x79,0x14,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x01,0x17,0x38,0x21,0x77,
+    0x38,0x21,0x2E,0xE3,0x24,0xB3,0x8D,0x80,
+    0x1A,0x1E,0x80,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xC2,0xF6,0x71,0xA3,0x76,0x17,0xB3,0x8D,
+    0x1D,0x76,0x59,0x5D,0xDF,0x1F,0x99,0x98,
+    0x0B,0x2F,0xA0,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x67,0x5E,0x52,0x95,0x57,0x94,
+    0xA5,0x1E,0xA7,0x39,0xF6,0xD9,0x1B,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,
+    0x57,0x9D,0x5A,0xBA,0x5C,0xD5,0xE7,0x56,
+    0xAA,0x16,0x1C,0xA5,0xC3,0x7B,0xC6,0x1F,
+    0x00,0x54,0x4D,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x7E,0xC8,0x04,0x46,0xD0,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x04,0xD7,0x8C,
+    0xB2,0x6B,0x5E,0x32,0xC9,0x3A,0xEF,0x9C,
+    0x7A,0x67,0xA7,0x60,0x07,0x2B,0x20,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x11,0x7F,0x08,0xD5,
+    0x68,0xBF,0x84,0x6A,0xDD,0x6F,0x97,0x4B,
+    0x4D,0x7C,0x72,0xC0,0x05,0xE4,0x50,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x04,0x5C,0xE0,
+    0x85,0xDC,0xE0,0x84,0xBB,0x8C,0x92,0xCE,
+    0x36,0x00,0x68,0x7A,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x03,0x0B,0xD9,0xC6,0x8D,0xD8,0x5E,
+    0xCE,0x34,0x75,0xD9,0x65,0x77,0x7C,0x7E,
+    0x66,0x60,0x2C,0xBE,0x80,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x01,0x9D,0x79,0x4A,0x55,
+    0x5E,0x52,0x94,0x7A,0x9C,0xE7,0xDB,0x64,
+    0x6C,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0xCD,0x5E,0x75,0x6A,0xE9,0x73,0x57,
+    0x9D,0x5A,0xA8,0x58,0x72,0x97,0x0D,0xEF,
+    0x18,0x7C,0x01,0x51,0x34,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x01,0xFB,0x20,0x11,0x1B,
+    0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,
+    0x5E,0x32,0xC9,0xAD,0x78,0xCB,0x24,0xEB,
+    0xBE,0x71,0xE9,0x9E,0x9D,0x80,0x1C,0xAC,
+    0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x45,0xFC,
+    0x23,0x55,0xA2,0xFE,0x11,0xAB,0x75,0xBE,
+    0x5D,0x2D,0x35,0xF1,0xCB,0x00,0x17,0x91,
+    0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,
+    0x73,0x82,0x17,0x73,0x82,0x12,0xEE,0x32,
+    0x4B,0x38,0xD8,0x01,0xA1,0xE8,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0C,0x2F,0x67,0x1A,0x37,
+    0x61,0x7B,0x38,0xD1,0xD7,0x65,0x95,0xDD,
+    0xF1,0xF9,0x99,0x80,0xB2,0xFA,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x06,0x75,0xE5,
+    0x29,0x55,0x79,0x4A,0x51,0xEA,0x73,0x9F,
+    0x6D,0x91,0xB0,0x03,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x07,0x35,0x79,0xD5,0xAB,0xA5,
+    0xCD,0x5E,0x75,0x6A,0xA1,0x61,0xCA,0x5C,
+    0x37,0xBC,0x61,0xF0,0x05,0x44,0xD0,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x07,0xEC,0x80,
+    0x44,0x6D,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x4D,0x78,0xCB,0x26,0xB5,0xE3,0x2C,
+    0x93,0xAE,0xF9,0xC7,0xA6,0x7A,0x76,0x00,
+    0x72,0xB2,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+    0x17,0xF0,0x8D,0x56,0x8B,0xF8,0x46,0xAD,
+    0xD6,0xF9,0x74,0xB4,0xD7,0xC7,0x2C,0x00,
+    0x5E,0x45,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x45,0xCE,0x08,0x5D,0xCE,0x08,0x4B,
+    0xB8,0xC9,0x2C,0xE3,0x60,0x06,0x87,0xA0,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x30,0xBD,0x9C,
+    0x68,0xDD,0x85,0xEC,0xE3,0x47,0x5D,0x96,
+    0x57,0x77,0xC7,0xE6,0x66,0x02,0xCB,0xE8,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,
+    0xD7,0x94,0xA5,0x55,0xE5,0x29,0x47,0xA9,
+    0xCE,0x7D,0xB6,0x46,0xC0,0x0C,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x1C,0xD5,0xE7,0x56,
+    0xAE,0x97,0x35,0x79,0xD5,0xAA,0x85,0x87,
+    0x29,0x70,0xDE,0xF1,0x87,0xC0,0x15,0x13,
+    0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,
+    0xB2,0x01,0x11,0xB4,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x01,0x35,0xE3,0x2C,0x9A,0xD7,
+    0x8C,0xB2,0x4E,0xBB,0xE7,0x1E,0x99,0xE9,
+    0xD8,0x01,0xCA,0xC8,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x04,0x5F,0xC2,0x35,0x5A,0x2F,0xE1,
+    0x1A,0xB7,0x5B,0xE5,0xD2,0xD3,0x5F,0x1C,
+    0xB0,0x01,0x79,0x14,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x01,0x17,0x38,0x21,0x77,0x38,
+    0x21,0x2E,0xE3,0x24,0xB3,0x8D,0x80,0x1A,
+    0x1E,0x80,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,
+    0xF6,0x71,0xA3,0x76,0x17,0xB3,0x8D,0x1D,
+    0x76,0x59,0x5D,0xDF,0x1F,0x99,0x98,0x0B,
+    0x2F,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x67,0x5E,0x52,0x95,0x57,0x94,0xA5,
+    0x1E,0xA7,0x39,0xF6,0xD9,0x1B,0x00,0x30,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x73,0x57,
+    0x9D,0x5A,0xBA,0x5C,0xD5,0xE7,0x56,0xAA,
+    0x16,0x1C,0xA5,0xC3,0x7B,0xC6,0x1F,0x00,
+    0x54,0x4D,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x7E,0xC8,0x04,0x46,0xD0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x04,0xD7,0x8C,0xB2,
+    0x6B,0x5E,0x32,0xC9,0x3A,0xEF,0x9C,0x7A,
+    0x67,0xA7,0x60,0x07,0x2B,0x20,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x11,0x7F,0x08,0xD5,0x68,
+    0xBF,0x84,0x6A,0xDD,0x6F,0x97,0x4B,0x4D,
+    0x7C,0x72,0xC0,0x05,0xE4,0x50,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x04,0x5C,0xE0,0x85,
+    0xDC,0xE0,0x84,0xBB,0x8C,0x92,0xCE,0x36,
+    0x00,0x68,0x7A,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x03,0x0B,0xD9,0xC6,0x8D,0xD8,0x5E,0xCE,
+    0x34,0x75,0xD9,0x65,0x77,0x7C,0x7E,0x66,
+    0x60,0x2C,0xBE,0x80,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x01,0x9D,0x79,0x4A,0x55,0x5E,
+    0x52,0x94,0x7A,0x9C,0xE7,0xDB,0x64,0x6C,
+    0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+    0xCD,0x5E,0x75,0x6A,0xE9,0x73,0x57,0x9D,
+    0x5A,0xA8,0x58,0x72,0x97,0x0D,0xEF,0x18,
+    0x7C,0x01,0x51,0x34,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x01,0xFB,0x20,0x11,0x1B,0x40,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x5E,
+    0x32,0xC9,0xAD,0x78,0xCB,0x24,0xEB,0xBE,
+    0x71,0xE9,0x9E,0x9D,0x80,0x1C,0xAC,0x80,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x45,0xFC,0x23,
+    0x55,0xA2,0xFE,0x11,0xAB,0x75,0xBE,0x5D,
+    0x2D,0x35,0xF1,0xCB,0x00,0x17,0x91,0x40,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x73,
+    0x82,0x17,0x73,0x82,0x12,0xEE,0x32,0x4B,
+    0x38,0xD8,0x01,0xA1,0xE8,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x0C,0x2F,0x67,0x1A,0x37,0x61,
+    0x7B,0x38,0xD1,0xD7,0x65,0x95,0xDD,0xF1,
+    0xF9,0x99,0x80,0xB2,0xFA,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x06,0x75,0xE5,0x29,
+    0x55,0x79,0x4A,0x51,0xEA,0x73,0x9F,0x6D,
+    0x91,0xB0,0x03,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x07,0x35,0x79,0xD5,0xAB,0xA5,0xCD,
+    0x5E,0x75,0x6A,0xA1,0x61,0xCA,0x5C,0x37,
+    0xBC,0x61,0xF0,0x05,0x44,0xD0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x07,0xEC,0x80,0x44,
+    0x6D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x4D,0x78,0xCB,0x26,0xB5,0xE3,0x2C,0x93,
+    0xAE,0xF9,0xC7,0xA6,0x7A,0x76,0x00,0x72,
+    0xB2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x17,
+    0xF0,0x8D,0x56,0x8B,0xF8,0x46,0xAD,0xD6,
+    0xF9,0x74,0xB4,0xD7,0xC7,0x2C,0x00,0x5E,
+    0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x45,0xCE,0x08,0x5D,0xCE,0x08,0x4B,0xB8,
+    0xC9,0x2C,0xE3,0x60,0x06,0x87,0xA0,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x30,0xBD,0x9C,0x68,
+    0xDD,0x85,0xEC,0xE3,0x47,0x5D,0x96,0x57,
+    0x77,0xC7,0xE6,0x66,0x02,0xCB,0xE8,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x19,0xD7,
+    0x94,0xA5,0x55,0xE5,0x29,0x47,0xA9,0xCE,
+    0x7D,0xB6,0x46,0xC0,0x0C,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x1C,0xD5,0xE7,0x56,0xAE,
+    0x97,0x35,0x79,0xD5,0xAA,0x85,0x87,0x29,
+    0x70,0xDE,0xF1,0x87,0xC0,0x15,0x13,0x40,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xB2,
+    0x01,0x11,0xB4,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x01,0x35,0xE3,0x2C,0x9A,0xD7,0x8C,
+    0xB2,0x4E,0xBB,0xE7,0x1E,0x99,0xE9,0xD8,
+    0x01,0xCA,0xC8,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x04,0x5F,0xC2,0x35,0x5A,0x2F,0xE1,0x1A,
+    0xB7,0x5B,0xE5,0xD2,0xD3,0x5F,0x1C,0xB0,
+    0x01,0x79,0x14,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x01,0x17,0x38,0x21,0x77,0x38,0x21,
+    0x2E,0xE3,0x24,0xB3,0x8D,0x80,0x1A,0x1E,
+    0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0xF6,
+    0x71,0xA3,0x76,0x17,0xB3,0x8D,0x1D,0x76,
+    0x59,0x5D,0xDF,0x1F,0x99,0x98,0x0B,0x2F,
+    0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x67,0x5E,0x52,0x95,0x57,0x94,0xA5,0x1E,
+    0xA7,0x39,0xF6,0xD9,0x1B,0x00,0x30,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x73,0x57,0x9D,
+    0x5A,0xBA,0x5C,0xD5,0xE7,0x56,0xAA,0x16,
+    0x1C,0xA5,0xC3,0x7B,0xC6,0x1F,0x00,0x54,
+    0x4D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x7E,0xC8,0x04,0x46,0xD0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x04,0xD7,0x8C,0xB2,0x6B,
+    0x5E,0x32,0xC9,0x3A,0xEF,0x9C,0x7A,0x67,
+    0xA7,0x60,0x07,0x2B,0x20,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x11,0x7F,0x08,0xD5,0x68,0xBF,
+    0x84,0x6A,0xDD,0x6F,0x97,0x4B,0x4D,0x7C,
+    0x72,0xC0,0x05,0xE4,0x50,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x04,0x5C,0xE0,0x85,0xDC,
+    0xE0,0x84,0xBB,0x8C,0x92,0xCE,0x36,0x00,
+    0x68,0x7A,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,
+    0x0B,0xD9,0xC6,0x8D,0xD8,0x5E,0xCE,0x34,
+    0x75,0xD9,0x65,0x77,0x7C,0x7E,0x66,0x60,
+    0x2C,0xBE,0x80,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x01,0x9D,0x79,0x4A,0x55,0x5E,0x52,
+    0x94,0x7A,0x9C,0xE7,0xDB,0x64,0x6C,0x00,
+    0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xCD,
+    0x5E,0x75,0x6A,0xE9,0x73,0x57,0x9D,0x5A,
+    0xA8,0x58,0x72,0x97,0x0D,0xEF,0x18,0x7C,
+    0x01,0x51,0x34,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x01,0xFB,0x20,0x11,0x1B,0x40,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x13,0x5E,0x32,
+    0xC9,0xAD,0x78,0xCB,0x24,0xEB,0xBE,0x71,
+    0xE9,0x9E,0x9D,0x80,0x1C,0xAC,0x80,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x45,0xFC,0x23,0x55,
+    0xA2,0xFE,0x11,0xAB,0x75,0xBE,0x5D,0x2D,
+    0x35,0xF1,0xCB,0x00,0x17,0x91,0x40,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x11,0x73,0x82,
+    0x17,0x73,0x82,0x12,0xEE,0x32,0x4B,0x38,
+    0xD8,0x01,0xA1,0xE8,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x0C,0x2F,0x67,0x1A,0x37,0x61,0x7B,
+    0x38,0xD1,0xD7,0x65,0x95,0xDD,0xF1,0xF9,
+    0x99,0x80,0xB2,0xFA,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x06,0x75,0xE5,0x29,0x55,
+    0x79,0x4A,0x51,0xEA,0x73,0x9F,0x6D,0x91,
+    0xB0,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x07,0x35,0x79,0xD5,0xAB,0xA5,0xCD,0x5E,
+    0x75,0x6A,0xA1,0x61,0xCA,0x5C,0x37,0xBC,
+    0x61,0xF0,0x05,0x44,0xD0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x07,0xEC,0x80,0x44,0x6D,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,
+    0x78,0xCB,0x26,0xB5,0xE3,0x2C,0x93,0xAE,
+    0xF9,0xC7,0xA6,0x7A,0x76,0x00,0x72,0xB2,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x01,0x17,0xF0,
+    0x8D,0x56,0x8B,0xF8,0x46,0xAD,0xD6,0xF9,
+    0x74,0xB4,0xD7,0xC7,0x2C,0x00,0x5E,0x45,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,
+    0xCE,0x08,0x5D,0xCE,0x08,0x4B,0xB8,0xC9,
+    0x2C,0xE3,0x60,0x06,0x87,0xA0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x30,0xBD,0x9C,0x68,0xDD,
+    0x85,0xEC,0xE3,0x47,0x5D,0x96,0x57,0x77,
+    0xC7,0xE6,0x66,0x02,0xCB,0xE8,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x19,0xD7,0x94,
+    0xA5,0x55,0xE5,0x29,0x47,0xA9,0xCE,0x7D,
+    0xB6,0x46,0xC0,0x0C,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x1C,0xD5,0xE7,0x56,0xAE,0x97,
+    0x35,0x79,0xD5,0xAA,0x85,0x87,0x29,0x70,
+    0xDE,0xF1,0x87,0xC0,0x15,0x13,0x40,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x1F,0xB2,0x01,
+    0x11,0xB4,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x35,0xE3,0x2C,0x9A,0xD7,0x8C,0xB2,
+    0x4E,0xBB,0xE7,0x1E,0x99,0xE9,0xD8,0x01,
+    0xCA,0xC8,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+    0x5F,0xC2,0x35,0x5A,0x2F,0xE1,0x1A,0xB7,
+    0x5B,0xE5,0xD2,0xD3,0x5F,0x1C,0xB0,0x01,
+    0x79,0x14,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x17,0x38,0x21,0x77,0x38,0x21,0x2E,
+    0xE3,0x24,0xB3,0x8D,0x80,0x1A,0x1E,0x80,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xC2,0xF6,0x71,
+    0xA3,0x76,0x17,0xB3,0x8D,0x1D,0x76,0x59,
+    0x5D,0xDF,0x1F,0x99,0x98,0x0B,0x2F,0xA0,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,
+    0x5E,0x52,0x95,0x57,0x94,0xA5,0x1E,0xA7,
+    0x39,0xF6,0xD9,0x1B,0x00,0x30,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x73,0x57,0x9D,0x5A,
+    0xBA,0x5C,0xD5,0xE7,0x56,0xAA,0x16,0x1C,
+    0xA5,0xC3,0x7B,0xC6,0x1F,0x00,0x54,0x4D,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,
+    0xC8,0x04,0x46,0xD0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x04,0xD7,0x8C,0xB2,0x6B,0x5E,
+    0x32,0xC9,0x3A,0xEF,0x9C,0x7A,0x67,0xA7,
+    0x60,0x07,0x2B,0x20,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x11,0x7F,0x08,0xD5,0x68,0xBF,0x84,
+    0x6A,0xDD,0x6F,0x97,0x4B,0x4D,0x7C,0x72,
+    0xC0,0x05,0xE4,0x50,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x04,0x5C,0xE0,0x85,0xDC,0xE0,
+    0x84,0xBB,0x8C,0x92,0xCE,0x36,0x00,0x68,
+    0x7A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0B,
+    0xD9,0xC6,0x8D,0xD8,0x5E,0xCE,0x34,0x75,
+    0xD9,0x65,0x77,0x7C,0x7E,0x66,0x60,0x2C,
+    0xBE,0x80,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x9D,0x79,0x4A,0x55,0x5E,0x52,0x94,
+    0x7A,0x9C,0xE7,0xDB,0x64,0x6C,0x00,0xC0,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x01,0xCD,0x5E,
+    0x75,0x6A,0xE9,0x73,0x57,0x9D,0x5A,0xA8,
+    0x58,0x72,0x97,0x0D,0xEF,0x18,0x7C,0x01,
+    0x51,0x34,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0xFB,0x20,0x11,0x1B,0x40,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x13,0x5E,0x32,0xC9,
+    0xAD,0x78,0xCB,0x24,0xEB,0xBE,0x71,0xE9,
+    0x9E,0x9D,0x80,0x1C,0xAC,0x80,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x45,0xFC,0x23,0x55,0xA2,
+    0xFE,0x11,0xAB,0x75,0xBE,0x5D,0x2D,0x35,
+    0xF1,0xCB,0x00,0x17,0x91,0x40,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x11,0x73,0x82,0x17,
+    0x73,0x82,0x12,0xEE,0x32,0x4B,0x38,0xD8,
+    0x01,0xA1,0xE8,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x0C,0x2F,0x67,0x1A,0x37,0x61,0x7B,0x38,
+    0xD1,0xD7,0x65,0x95,0xDD,0xF1,0xF9,0x99,
+    0x80,0xB2,0xFA,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x06,0x75,0xE5,0x29,0x55,0x79,
+    0x4A,0x51,0xEA,0x73,0x9F,0x6D,0x91,0xB0,
+    0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,
+    0x35,0x79,0xD5,0xAB,0xA5,0xCD,0x5E,0x75,
+    0x6A,0xA1,0x61,0xCA,0x5C,0x37,0xBC,0x61,
+    0xF0,0x05,0x44,0xD0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x07,0xEC,0x80,0x44,0x6D,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x78,
+    0xCB,0x26,0xB5,0xE3,0x2C,0x93,0xAE,0xF9,
+    0xC7,0xA6,0x7A,0x76,0x00,0x72,0xB2,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x17,0xF0,0x8D,
+    0x56,0x8B,0xF8,0x46,0xAD,0xD6,0xF9,0x74,
+    0xB4,0xD7,0xC7,0x2C,0x00,0x5E,0x45,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x45,0xCE,
+    0x08,0x5D,0xCE,0x08,0x4B,0xB8,0xC9,0x2C,
+    0xE3,0x60,0x06,0x87,0xA0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x30,0xBD,0x9C,0x68,0xDD,0x85,
+    0xEC,0xE3,0x47,0x5D,0x96,0x57,0x77,0xC7,
+    0xE6,0x66,0x02,0xCB,0xE8,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x19,0xD7,0x94,0xA5,
+    0x55,0xE5,0x29,0x47,0xA9,0xCE,0x7D,0xB6,
+    0x46,0xC0,0x0C,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x1C,0xD5,0xE7,0x56,0xAE,0x97,0x35,
+    0x79,0xD5,0xAA,0x85,0x87,0x29,0x70,0xDE,
+    0xF1,0x87,0xC0,0x15,0x13,0x40,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x1F,0xB2,0x01,0x11,
+    0xB4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+    0x35,0xE3,0x2C,0x9A,0xD7,0x8C,0xB2,0x4E,
+    0xBB,0xE7,0x1E,0x99,0xE9,0xD8,0x01,0xCA,
+    0xC8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x5F,
+    0xC2,0x35,0x5A,0x2F,0xE1,0x1A,0xB7,0x5B,
+    0xE5,0xD2,0xD3,0x5F,0x1C,0xB0,0x01,0x79,
+    0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+    0x17,0x38,0x21,0x77,0x38,0x21,0x2E,0xE3,
+    0x24,0xB3,0x8D,0x80,0x1A,0x1E,0x80,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xC2,0xF6,0x71,0xA3,
+    0x76,0x17,0xB3,0x8D,0x1D,0x76,0x59,0x5D,
+    0xDF,0x1F,0x99,0x98,0x0B,0x2F,0xA0,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x5E,
+    0x52,0x95,0x57,0x94,0xA5,0x1E,0xA7,0x39,
+    0xF6,0xD9,0x1B,0x00,0x30,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x73,0x57,0x9D,0x5A,0xBA,
+    0x5C,0xD5,0xE7,0x56,0xAA,0x16,0x1C,0xA5,
+    0xC3,0x7B,0xC6,0x1F,0x00,0x54,0x4D,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0xC8,
+    0x04,0x46,0xD0,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x04,0xD7,0x8C,0xB2,0x6B,0x5E,0x32,
+    0xC9,0x3A,0xEF,0x9C,0x7A,0x67,0xA7,0x60,
+    0x07,0x2B,0x20,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x11,0x7F,0x08,0xD5,0x68,0xBF,0x84,0x6A,
+    0xDD,0x6F,0x97,0x4B,0x4D,0x7C,0x72,0xC0,
+    0x05,0xE4,0x50,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x04,0x5C,0xE0,0x85,0xDC,0xE0,0x84,
+    0xBB,0x8C,0x92,0xCE,0x36,0x00,0x68,0x7A,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x03,0x0B,0xD9,
+    0xC6,0x8D,0xD8,0x5E,0xCE,0x34,0x75,0xD9,
+    0x65,0x77,0x7C,0x7E,0x66,0x60,0x2C,0xBE,
+    0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+    0x9D,0x79,0x4A,0x55,0x5E,0x52,0x94,0x7A,
+    0x9C,0xE7,0xDB,0x64,0x6C,0x00,0xC0,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0xCD,0x5E,0x75,
+    0x6A,0xE9,0x73,0x57,0x9D,0x5A,0xA8,0x58,
+    0x72,0x97,0x0D,0xEF,0x18,0x7C,0x01,0x51,
+    0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+    0xFB,0x20,0x11,0x1B,0x40,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x13,0x5E,0x32,0xC9,0xAD,
+    0x78,0xCB,0x24,0xEB,0xBE,0x71,0xE9,0x9E,
+    0x9D,0x80,0x1C,0xAC,0x80,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x45,0xFC,0x23,0x55,0xA2,0xFE,
+    0x11,0xAB,0x75,0xBE,0x5D,0x2D,0x35,0xF1,
+    0xCB,0x00,0x17,0x91,0x40,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x11,0x73,0x82,0x17,0x73,
+    0x82,0x12,0xEE,0x32,0x4B,0x38,0xD8,0x01,
+    0xA1,0xE8,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,
+    0x2F,0x67,0x1A,0x37,0x61,0x7B,0x38,0xD1,
+    0xD7,0x65,0x95,0xDD,0xF1,0xF9,0x99,0x80,
+    0xB2,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x06,0x75,0xE5,0x29,0x55,0x79,0x4A,
+    0x51,0xEA,0x73,0x9F,0x6D,0x91,0xB0,0x03,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x35,
+    0x79,0xD5,0xAB,0xA5,0xCD,0x5E,0x75,0x6A,
+    0xA1,0x61,0xCA,0x5C,0x37,0xBC,0x61,0xF0,
+    0x05,0x44,0xD0,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x07,0xEC,0x80,0x44,0x6D,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x4D,0x78,0xCB,
+    0x26,0xB5,0xE3,0x2C,0x93,0xAE,0xF9,0xC7,
+    0xA6,0x7A,0x76,0x00,0x72,0xB2,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x01,0x17,0xF0,0x8D,0x56,
+    0x8B,0xF8,0x46,0xAD,0xD6,0xF9,0x74,0xB4,
+    0xD7,0xC7,0x2C,0x00,0x5E,0x45,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x45,0xCE,0x08,
+    0x5D,0xCE,0x08,0x4B,0xB8,0xC9,0x2C,0xE3,
+    0x60,0x06,0x87,0xA0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x30,0xBD,0x9C,0x68,0xDD,0x85,0xEC,
+    0xE3,0x47,0x5D,0x96,0x57,0x77,0xC7,0xE6,
+    0x66,0x02,0xCB,0xE8,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x19,0xD7,0x94,0xA5,0x55,
+    0xE5,0x29,0x47,0xA9,0xCE,0x7D,0xB6,0x46,
+    0xC0,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x1C,0xD5,0xE7,0x56,0xAE,0x97,0x35,0x79,
+    0xD5,0xAA,0x85,0x87,0x29,0x70,0xDE,0xF1,
+    0x87,0xC0,0x15,0x13,0x40,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x1F,0xB2,0x01,0x11,0xB4,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x35,
+    0xE3,0x2C,0x9A,0xD7,0x8C,0xB2,0x4E,0xBB,
+    0xE7,0x1E,0x99,0xE9,0xD8,0x01,0xCA,0xC8,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x04,0x5F,0xC2,
+    0x35,0x5A,0x2F,0xE1,0x1A,0xB7,0x5B,0xE5,
+    0xD2,0xD3,0x5F,0x1C,0xB0,0x01,0x79,0x14,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x17,
+    0x38,0x21,0x77,0x38,0x21,0x2E,0xE3,0x24,
+    0xB3,0x8D,0x80,0x1A,0x1E,0x80,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xC2,0xF6,0x71,0xA3,0x76,
+    0x17,0xB3,0x8D,0x1D,0x76,0x59,0x5D,0xDF,
+    0x1F,0x99,0x98,0x0B,0x2F,0xA0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x67,0x5E,0x52,
+    0x95,0x57,0x94,0xA5,0x1E,0xA7,0x39,0xF6,
+    0xD9,0x1B,0x00,0x30,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x73,0x57,0x9D,0x5A,0xBA,0x5C,
+    0xD5,0xE7,0x56,0xAA,0x16,0x1C,0xA5,0xC3,
+    0x7B,0xC6,0x1F,0x00,0x54,0x4D,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x7E,0xC8,0x04,
+    0x46,0xD0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x04,0xD7,0x8C,0xB2,0x6B,0x5E,0x32,0xC9,
+    0x3A,0xEF,0x9C,0x7A,0x67,0xA7,0x60,0x07,
+    0x2B,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,
+    0x7F,0x08,0xD5,0x68,0xBF,0x84,0x6A,0xDD,
+    0x6F,0x97,0x4B,0x4D,0x7C,0x72,0xC0,0x05,
+    0xE4,0x50,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x04,0x5C,0xE0,0x85,0xDC,0xE0,0x84,0xBB,
+    0x8C,0x92,0xCE,0x36,0x00,0x68,0x7A,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x03,0x0B,0xD9,0xC6,
+    0x8D,0xD8,0x5E,0xCE,0x34,0x75,0xD9,0x65,
+    0x77,0x7C,0x7E,0x66,0x60,0x2C,0xBE,0x80,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x9D,
+    0x79,0x4A,0x55,0x5E,0x52,0x94,0x7A,0x9C,
+    0xE7,0xDB,0x64,0x6C,0x00,0xC0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x01,0xCD,0x5E,0x75,0x6A,
+    0xE9,0x73,0x57,0x9D,0x5A,0xA8,0x58,0x72,
+    0x97,0x0D,0xEF,0x18,0x7C,0x01,0x51,0x34,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFB,
+    0x21,0xE2,0xFC,0xC1,0xE1,0x7E,0xE7,0x43,
+    0xE6,0x0F,0x0B,0xF7,0x3A,0x22,0x36,0xBD,
+    0xA1,0xE2,0xFC,0xC1,0xE1,0x7E,0xE7,0x43,
+    0xE6,0x0F,0x0B,0xF7,0x3A,0x03,0xDA,0x1E,
+    0x2F,0xCC,0x1E,0x17,0xEE,0x74,0x3E,0x60,
+    0xF0,0xBF,0x73,0xA0,0x3D,0xA1,0xE2,0xFC,
+    0xC1,0xE1,0x7E,0xE7,0x43,0xE6,0x0F,0x0B,
+    0xF7,0x3A,0x03,0xDA,0x1E,0x2F,0xCC,0x1E,
+    0x17,0xEE,0x74,0x3E,0x60,0xF0,0xBF,0x73,
+    0xA0,0x3D,0xA1,0xE2,0xFC,0xC1,0xE1,0x7E,
+    0xE7,0x43,0xE6,0x0F,0x0B,0xF7,0x3A,0x03,
+    0xDA,0x1E,0x2F,0xCC,0x1E,0x17,0xEE,0x74,
+    0x3E,0x60,0xF0,0xBF,0x73,0xA0,0x3D,0xA1,
+    0xE2,0xFC,0xC1,0xE1,0x7E,0xE7,0x43,0xE6,
+    0x0F,0x0B,0xF7,0x3A,0x03,0xDA,0x1E,0x2F,
+    0xCC,0x1E,0x17,0xEE,0x74,0x3E,0x60,0xF0,
+    0xBF,0x73,0xA0,0x3D,0xA1,0xE2,0xFC,0xC1,
+    0xE1,0x7E,0xE7,0x43,0xE6,0x0F,0x0B,0xF7,
+    0x3A,0x03,0xDA,0x1E,0x2F,0xCC,0x1E,0x17,
+    0xEE,0x74,0x3E,0x60,0xF0,0xBF,0x73,0xA0,
+    0x3D,0x8A,0xF1,0x96,0x4F,0x2E,0xAF,0x5F,
+    0xED,0x8D,0x9F,0x0D,0xF7,0x3A,0x27,0x7E,
+    0x78,0x6E,0x7E,0x8E,0x2B,0x8A,0x5A,0xF5,
+    0xEA,0xFB,0xD3,0x0C,0xA2,0x5E,0xB0,0xF2,
+    0x77,0xE7,0x86,0xE7,0xE8,0x6F,0xCF,0x0D,
+    0xCF,0xD1,0xCF,0xF9,0xEA,0x74,0xF7,0xEE,
+    0x1E,0xB0,0xF2,0x77,0xE7,0x86,0xE7,0xE8,
+    0x6F,0xCF,0x0D,0xCF,0xD0,0xFC,0xF5,0x3A,
+    0x3E,0xE1,0xEB,0x0F,0x27,0x7E,0x78,0x6E,
+    0x7E,0x86,0xFC,0xF0,0xDC,0xFD,0x0F,0xCF,
+    0x53,0xA3,0xEE,0x1E,0xB0,0xF2,0x77,0xE7,
+    0x86,0xE7,0xE8,0x6F,0xCF,0x0D,0xCF,0xD0,
+    0xFC,0xF5,0x3A,0x3E,0xE1,0xEB,0x0F,0x27,
+    0x7E,0x78,0x6E,0x7E,0x86,0xFC,0xF0,0xDC,
+    0xFD,0x0F,0xCF,0x53,0xA3,0xEE,0x1E,0xB0,
+    0xF2,0x77,0xE7,0x86,0xE7,0xE8,0x6F,0xCF,
+    0x0D,0xCF,0xD0,0xFC,0xF5,0x3A,0x3E,0xE1,
+    0xEB,0x0F,0x27,0x7E,0x78,0x6E,0x7E,0x86,
+    0xFC,0xF0,0xDC,0xFD,0x0F,0xCF,0x53,0xA3,
+    0xEE,0x1E,0xB0,0xF2,0x77,0xE7,0x86,0xE7,
+    0xE8,0x6F,0xCF,0x0D,0xCF,0xD0,0xFC,0xF5,
+    0x3A,0x3E,0xE1,0xEB,0x0F,0x27,0x7E,0x78,
+    0x6E,0x7E,0x86,0xFC,0xF0,0xDC,0xFD,0x0F,
+    0xCF,0x53,0xA3,0xEE,0x1E,0xB0,0xF2,0x77,
+    0xE7,0x86,0xE7,0xE8,0x6F,0xCF,0x0D,0xCF,
+    0xD0,0xFC,0xF5,0x3A,0x3E,0xE1,0xEB,0x22,
+    0xFE,0x11,0xAB,0xCC,0xDF,0x9E,0x1B,0x9F,
+    0xA2,0x6B,0xF5,0xD7,0xB7,0x1B,0x3E,0x1F,
+    0x67,0xEF,0xE8,0xDD,0x46,0x8E,0xBD,0x35,
+    0x23,0x54,0xC7,0xF8,0xD7,0x5B,0xFE,0xB4,
+    0x4C,0x43,0xB8,0x79,0xBB,0xDB,0xB8,0xE7,
+    0xE8,0x6F,0x6E,0xE3,0x9F,0xA2,0xB7,0xF7,
+    0x09,0x7F,0x9E,0xA7,0x4F,0x48,0x79,0xBB,
+    0xDB,0xB8,0xE7,0xE8,0x6F,0x6E,0xE3,0x9F,
+    0xA1,0xFD,0xC1,0xF9,0xEA,0x74,0xF4,0x87,
+    0x9B,0xBD,0xBB,0x8E,0x7E,0x86,0xF6,0xEE,
+    0x39,0xFA,0x1F,0xDC,0x1F,0x9E,0xA7,0x4F,
+    0x48,0x79,0xBB,0xDB,0xB8,0xE7,0xE8,0x6F,
+    0x6E,0xE3,0x9F,0xA1,0xFD,0xC1,0xF9,0xEA,
+    0x74,0xF4,0x87,0x9B,0xBD,0xBB,0x8E,0x7E,
+    0x86,0xF6,0xEE,0x39,0xFA,0x1F,0xDC,0x1F,
+    0x9E,0xA7,0x4F,0x48,0x79,0xBB,0xDB,0xB8,
+    0xE7,0xE8,0x6F,0x6E,0xE3,0x9F,0xA1,0xFD,
+    0xC1,0xF9,0xEA,0x74,0xF4,0x87,0x9B,0xBD,
+    0xBB,0x8E,0x7E,0x86,0xF6,0xEE,0x39,0xFA,
+    0x1F,0xDC,0x1F,0x9E,0xA7,0x4F,0x48,0x79,
+    0xBB,0xDB,0xB8,0xE7,0xE8,0x6F,0x6E,0xE3,
+    0x9F,0xA1,0xFD,0xC1,0xF9,0xEA,0x74,0xF4,
+    0x87,0x9B,0xBD,0xBB,0x8E,0x7E,0x86,0xF6,
+    0xEE,0x39,0xFA,0x1F,0xDC,0x1F,0x9E,0xA7,
+    0x4F,0x48,0x79,0xBB,0xDB,0xB8,0xE7,0xE8,
+    0x6F,0x6E,0xE3,0x9F,0xA1,0xFD,0xC1,0xF9,
+    0xEA,0x74,0xF4,0x87,0x9B,0xBD,0xBB,0x8E,
+    0x7E,0x86,0xF6,0xEE,0x39,0xFA,0x1F,0xDC,
+    0x1F,0x9E,0xA7,0x4E,0xFB,0x9C,0x10,0xE2,
+    0xAB,0xD6,0x9E,0xD6,0xCF,0xFF,0x00,0x1E,
+    0x6E,0x89,0xDE,0x5D,0xD7,0x37,0x44,0xFA,
+    0xDA,0x35,0x6A,0xD7,0x33,0x0C,0xE2,0x85,
+    0x4F,0xAD,0x9D,0xE3,0x83,0x79,0x77,0x5C,
+    0xDD,0x0D,0xE5,0xDD,0x73,0x74,0x6A,0xF1,
+    0x6B,0xE9,0xEF,0x82,0xA7,0x4E,0xF1,0xC1,
+    0xBC,0xBB,0xAE,0x6E,0x86,0xF2,0xEE,0xB9,
+    0xBA,0x1E,0x2D,0x7D,0x1E,0x0A,0x9D,0x3B,
+    0xC7,0x06,0xF2,0xEE,0xB9,0xBA,0x1B,0xCB,
+    0xBA,0xE6,0xE8,0x78,0xB5,0xF4,0x78,0x2A,
+    0x74,0xEF,0x1C,0x1B,0xCB,0xBA,0xE6,0xE8,
+    0x6F,0x2E,0xEB,0x9B,0xA1,0xE2,0xD7,0xD1,
+    0xE0,0xA9,0xD3,0xBC,0x70,0x6F,0x2E,0xEB,
+    0x9B,0xA1,0xBC,0xBB,0xAE,0x6E,0x87,0x8B,
+    0x5F,0x47,0x82,0xA7,0x4E,0xF1,0xC1,0xBC,
+    0xBB,0xAE,0x6E,0x86,0xF2,0xEE,0xB9,0xBA,
+    0x1E,0x2D,0x7D,0x1E,0x0A,0x9D,0x3B,0xC7,
+    0x06,0xF2,0xEE,0xB9,0xBA,0x1B,0xCB,0xBA,
+    0xE6,0xE8,0x78,0xB5,0xF4,0x78,0x2A,0x74,
+    0xEF,0x1C,0x1B,0xCB,0xBA,0xE6,0xE8,0x6F,
+    0x2E,0xEB,0x9B,0xA1,0xE2,0xD7,0xD1,0xE0,
+    0xA9,0xD3,0xBC,0x70,0x6F,0x2E,0xEB,0x9B,
+    0xA1,0xBC,0xBB,0xAE,0x6E,0x87,0x8B,0x5F,
+    0x47,0x82,0xA7,0x4E,0xF1,0xC1,0xBC,0xBB,
+    0xAE,0x6E,0x86,0xF2,0xEE,0xB9,0xBA,0x1E,
+    0x2D,0x7D,0x1E,0x0A,0x9D,0x3B,0xD8,0x5E,
+    0xCE,0x34,0x73,0xEF,0x2E,0xEB,0x9B,0xA2,
+    0x2B,0xF4,0xEF,0x6E,0x76,0xFB,0xBD,0x9F,
+    0xB9,0xD3,0x6D,0xA6,0x74,0x54,0xFE,0xB5,
+    0x6C,0xEB,0xB3,0xD1,0x34,0xEA,0xFF,0x00,
+    0x5A,0xF6,0x6E,0x39,0xBE,0x2F,0xB1,0xE6,
+    0x7C,0x5F,0x63,0xCD,0x4F,0xCB,0xA3,0xB5,
+    0x7F,0x3D,0x3E,0xDD,0x23,0x9B,0xE2,0xFB,
+    0x1E,0x67,0xC5,0xF6,0x3C,0xCF,0x2E,0x8E,
+    0xCF,0x3D,0x3E,0xDD,0x23,0x9B,0xE2,0xFB,
+    0x1E,0x67,0xC5,0xF6,0x3C,0xCF,0x2E,0x8E,
+    0xCF,0x3D,0x3E,0xDD,0x23,0x9B,0xE2,0xFB,
+    0x1E,0x67,0xC5,0xF6,0x3C,0xCF,0x2E,0x8E,
+    0xCF,0x3D,0x3E,0xDD,0x23,0x9B,0xE2,0xFB,
+    0x1E,0x67,0xC5,0xF6,0x3C,0xCF,0x2E,0x8E,
+    0xCF,0x3D,0x3E,0xDD,0x23,0x9B,0xE2,0xFB,
+    0x1E,0x67,0xC5,0xF6,0x3C,0xCF,0x2E,0x8E,
+    0xCF,0x3D,0x3E,0xDD,0x23,0x9B,0xE2,0xFB,
+    0x1E,0x67,0xC5,0xF6,0x3C,0xCF,0x2E,0x8E,
+    0xCF,0x3D,0x3E,0xDD,0x23,0x9B,0xE2,0xFB,
+    0x1E,0x67,0xC5,0xF6,0x3C,0xCF,0x2E,0x8E,
+    0xCF,0x3D,0x3E,0xDD,0x23,0x9B,0xE2,0xFB,
+    0x1E,0x67,0xC5,0xF6,0x3C,0xCF,0x2E,0x8E,
+    0xCF,0x3D,0x3E,0xDD,0x23,0x9B,0xE2,0xFB,
+    0x1E,0x67,0xC5,0xF6,0x3C,0xCF,0x2E,0x8E,
+    0xCF,0x3D,0x3E,0xDD,0x23,0x9B,0xE2,0xFB,
+    0x1E,0x67,0xC5,0xF6,0x3C,0xCF,0x2E,0x8E,
+    0xCF,0x3D,0x3E,0xDA,0xD7,0x94,0xA5,0x95,
+    0x5E,0x91,0xB6,0x76,0xFB,0x1E,0x6F,0x9E,
+    0xFF,0x00,0xB3,0xE6,0x9B,0xAF,0x4C,0xCE,
+    0xA9,0x98,0x67,0x17,0x14,0xFB,0x6C,0x31,
+    0xF7,0xFD,0x9F,0x33,0xDF,0xF6,0x7C,0xD8,
+    0x7F,0x12,0xF7,0xF4,0x53,0xED,0xB0,0xC7,
+    0xDF,0xF6,0x7C,0xCF,0x7F,0xD9,0xF3,0x3F,
+    0x89,0x3F,0x45,0x3E,0xDB,0x0C,0x7D,0xFF,
+    0x00,0x67,0xCC,0xF7,0xFD,0x9F,0x33,0xF8,
+    0x93,0xF4,0x53,0xED,0xB0,0xC7,0xDF,0xF6,
+    0x7C,0xCF,0x7F,0xD9,0xF3,0x3F,0x89,0x3F,
+    0x45,0x3E,0xDB,0x0C,0x7D,0xFF,0x00,0x67,
+    0xCC,0xF7,0xFD,0x9F,0x33,0xF8,0x93,0xF4,
+    0x53,0xED,0xB0,0xC7,0xDF,0xF6,0x7C,0xCF,
+    0x7F,0xD9,0xF3,0x3F,0x89,0x3F,0x45,0x3E,
+    0xDB,0x0C,0x7D,0xFF,0x00,0x67,0xCC,0xF7,
+    0xFD,0x9F,0x33,0xF8,0x93,0xF4,0x53,0xED,
+    0xB0,0xC7,0xDF,0xF6,0x7C,0xCF,0x7F,0xD9,
+    0xF3,0x3F,0x89,0x3F,0x45,0x3E,0xDB,0x0C,
+    0x7D,0xFF,0x00,0x67,0xCC,0xF7,0xFD,0x9F,
+    0x33,0xF8,0x93,0xF4,0x53,0xED,0xB0,0xC7,
+    0xDF,0xF6,0x7C,0xCF,0x7F,0xD9,0xF3,0x3F,
+    0x89,0x3F,0x45,0x3E,0xDB,0x39,0xAB,0xCE,
+    0xAD,0x57,0xEF,0xFB,0x3E,0x6C,0xA6,0xAD,
+    0xB3,0x33,0xB3,0xF1,0x76,0x5A,0x6A,0x8A,
+    0x7A,0xA6,0x75,0x39,0x2E,0xAA,0x69,0xA9,
+    0x11,0x1A,0x65,0xF4,0x7C,0xDA,0x6D,0x50,
+    0xFD,0x14,0xFB,0x71,0x7D,0x4B,0xE8,0xF9,
+    0xB4,0xDA,0x7E,0x8A,0x7D,0x9F,0x52,0xFA,
+    0x3E,0x6D,0x36,0x9F,0xA2,0x9F,0x67,0xD4,
+    0xBE,0x8F,0x9B,0x4D,0xA7,0xE8,0xA7,0xD9,
+    0xF5,0x2F,0xA3,0xE6,0xD3,0x69,0xFA,0x29,
+    0xF6,0x7D,0x4B,0xE8,0xF9,0xB4,0xDA,0x7E,
+    0x8A,0x7D,0x9F,0x52,0xFA,0x3E,0x6D,0x36,
+    0x9F,0xA2,0x9F,0x67,0xD4,0xBE,0x8F,0x9B,
+    0x4D,0xA7,0xE8,0xA7,0xD9,0xF5,0x2F,0xA3,
+    0xE6,0xD3,0x69,0xFA,0x29,0xF6,0x7D,0x4B,
+    0xE8,0xF9,0xB4,0xDA,0x7E,0x8A,0x7D,0x9F,
+    0x52,0xFA,0x3E,0x6D,0x36,0x9F,0xA2,0x9F,
+    0x67,0xD4,0xBE,0x00,0x94,0xCC,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x1B,0xCF,0xA3,0xD1,0x16,0xAC,
+    0xD7,0xEF,0xA3,0x65,0xCA,0xA6,0x9A,0xBE,
+    0x9F,0x4A,0x36,0x6C,0x9F,0xF7,0xF8,0xB6,
+    0xA3,0xD0,0x22,0xE6,0xC9,0xA2,0xBB,0x95,
+    0xC4,0xD3,0x15,0x44,0x53,0x6F,0x6D,0x5F,
+    0x59,0x98,0xFC,0x36,0xFE,0x1F,0x4F,0xFB,
+    0xE3,0x0C,0x28,0xBD,0x4C,0x5B,0xB5,0x6E,
+    0xBB,0x73,0x55,0x34,0x57,0x55,0x73,0x11,
+    0x56,0xCF,0x6B,0x6C,0x47,0xD3,0xFC,0x7E,
+    0x1E,0x6D,0x6A,0xF4,0xBA,0x2A,0xAA,0xBF,
+    0x6A,0xDD,0x7E,0xCD,0x73,0x4C,0xEC,0xF7,
+    0x91,0x13,0x13,0x1B,0x76,0x6C,0x9D,0x9F,
+    0x87,0xD7,0xF0,0xD8,0x0F,0x95,0x7A,0x1C,
+    0x53,0x13,0x4C,0xDD,0x89,0xB9,0xB2,0xAA,
+    0xA9,0x88,0x8D,0xB1,0x54,0x53,0x33,0xB6,
+    0x76,0xFF,0x00,0xA9,0xFF,0x00,0xC6,0x7F,
+    0x0F,0x34,0x4C,0x7B,0xFF,0x00,0x6A,0x8A,
+    0x66,0x76,0x44,0xD3,0x11,0x54,0xCC,0xFD,
+    0x27,0xFE,0xFF,0x00,0xCF,0xE2,0xD2,0xBF,
+    0x4D,0xF6,0xFD,0xAA,0xAA,0xB7,0x1E,0xF2,
+    0x62,0xBA,0x62,0x62,0x76,0x44,0x45,0x53,
+    0x33,0x3F,0x4F,0xF7,0x3F,0xFA,0x4F,0xA6,
+    0x44,0xD5,0x6A,0xAF,0x75,0xF5,0xB5,0x1B,
+    0x2D,0xFF,0x00,0xCB,0xF0,0x8D,0x9F,0x4D,
+    0xBF,0xF7,0xB2,0x7E,0xA0,0xFB,0x1E,0x89,
+    0x6E,0x7D,0x26,0xAB,0x11,0x7F,0xEB,0x15,
+    0x45,0x14,0xFF,0x00,0xC7,0xF1,0x9E,0x3B,
+    0x7E,0xBF,0x48,0x8F,0xFB,0x45,0x7E,0x8B,
+    0x14,0xDA,0x9A,0xBD,0xBD,0xB5,0xD3,0x45,
+    0x35,0xD5,0x4E,0xCF,0xA4,0x44,0xEC,0xD9,
+    0xF5,0xFF,0x00,0x71,0xFF,0x00,0xAF,0x9E,
+    0x8F,0x7A,0xDD,0xAA,0x2E,0x45,0x56,0xEA,
+    0xAA,0xAA,0xE3,0x67,0xB5,0x4D,0x7B,0x26,
+    0x23,0x8F,0x09,0xFC,0x5F,0x6B,0xF4,0xA8,
+    0xAA,0xD4,0xD3,0xEC,0x6C,0xAE,0xAA,0x29,
+    0xA2,0xAA,0xB6,0xFD,0x26,0x23,0x66,0xCF,
+    0xA7,0xFA,0x8F,0xFC,0x04,0xC7,0xA3,0x57,
+    0x3E,0x8B,0x3E,0x91,0xB2,0xA8,0xA6,0x27,
+    0x66,0x3F,0x4E,0x1C,0x7F,0xDF,0x91,0xE9,
+    0x16,0x69,0xB3,0xEE,0xE6,0x9B,0x91,0x72,
+    0x2B,0xA3,0xDA,0xDB,0x11,0xB3,0x8C,0xC7,
+    0xFF,0x00,0x1F,0x6A,0xF4,0x99,0x9F,0x45,
+    0xA7,0xD1,0xE2,0x8A,0x62,0x22,0x76,0xCC,
+    0xEC,0x8D,0xB3,0xF8,0xFF,0x00,0x8F,0xF3,
+    0xE4,0x8B,0x97,0x7D,0xE5,0x16,0xA9,0xD9,
+    0xB3,0xDD,0xD1,0xEC,0xFE,0x3F,0x8F,0xFC,
+    0xA6,0x7F,0xFA,0x0C,0xC0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x7A,0x1B,0x8F,0xD6,0x5F,0xA6,0xE7,0xA7,
+    0xFB,0x37,0x1F,0xAC,0xBF,0x4D,0xCF,0x4F,
+    0xF6,0xFD,0x88,0x0F,0xC7,0x6E,0x3F,0x59,
+    0x7E,0x9B,0x9E,0x9F,0xEC,0xDC,0x7E,0xB2,
+    0xFD,0x37,0x3D,0x3F,0xDB,0xF6,0x20,0x3F,
+    0x1D,0xB8,0xFD,0x65,0xFA,0x6E,0x7A,0x7F,
+    0xB3,0x71,0xFA,0xCB,0xF4,0xDC,0xF4,0xFF,
+    0x00,0x6F,0xD8,0x80,0xFC,0x76,0xE3,0xF5,
+    0x97,0xE9,0xB9,0xE9,0xFE,0xCD,0xC7,0xEB,
+    0x2F,0xD3,0x73,0xD3,0xFD,0xBF,0x62,0x03,
+    0xF1,0xDB,0x8F,0xD6,0x5F,0xA6,0xE7,0xA7,
+    0xFB,0x37,0x1F,0xAC,0xBF,0x4D,0xCF,0x4F,
+    0xF6,0xFD,0x88,0x0F,0xC7,0x6E,0x3F,0x59,
+    0x7E,0x9B,0x9E,0x9F,0xED,0xC7,0xE9,0x16,
+    0x2E,0x7A,0x35,0xEA,0xAC,0xDE,0xA7,0xD9,
+    0xAE,0x9F,0xC6,0x36,0xC4,0xFF,0x00,0x9E,
+    0x0F,0xDE,0xBF,0x1D,0xEB,0xFF,0x00,0xCE,
+    0x2F,0xFE,0xDF,0xE3,0x00,0xF3,0xC0,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x7F,0x41,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xE3,
+    0xBD,0x7F,0xF9,0xC5,0xFF,0x00,0xDB,0xFC,
+    0x61,0xFB,0x17,0xE3,0xBD,0x7F,0xF9,0xC5,
+    0xFF,0x00,0xDB,0xFC,0x60,0x1E,0x78,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x0F,0xE8,0x20,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,
+    0x77,0xAF,0xFF,0x00,0x38,0xBF,0xFB,0x7F,
+    0x8C,0x3F,0x62,0xFC,0x77,0xAF,0xFF,0x00,
+    0x38,0xBF,0xFB,0x7F,0x8C,0x03,0xCF,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x01,0xFD,0x04,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,
+    0x8E,0xF5,0xFF,0x00,0xE7,0x17,0xFF,0x00,
+    0x6F,0xF1,0x87,0xEC,0x5F,0x8E,0xF5,0xFF,
+    0x00,0xE7,0x17,0xFF,0x00,0x6F,0xF1,0x80,
+    0x79,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x3F,0xA0,0x80,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x03,0xF1,0xDE,0xBF,0xFC,0xE2,0xFF,
+    0x00,0xED,0xFE,0x30,0xFD,0x8B,0xF1,0xDE,
+    0xBF,0xFC,0xE2,0xFF,0x00,0xED,0xFE,0x30,
+    0x0F,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x07,0xF4,0x10,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x7E,0x3B,0xD7,0xFF,0x00,0x9C,
+    0x5F,0xFD,0xBF,0xC6,0x1F,0xB1,0x7E,0x3B,
+    0xD7,0xFF,0x00,0x9C,0x5F,0xFD,0xBF,0xC6,
+    0x01,0xE7,0x80,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0xFF,0xD9,
+
+    /* Video frame 2 */
+    0xFF,0xD8,0xFF,0xE0,0x00,0x10,0x4A,0x46,
+    0x49,0x46,0x00,0x01,0x01,0x00,0x00,0x01,
+    0x00,0x01,0x00,0x00,0xFF,0xDB,0x00,0x43,
+    0x00,0x1B,0x12,0x14,0x17,0x14,0x11,0x1B,
+    0x17,0x16,0x17,0x1E,0x1C,0x1B,0x20,0x28,
+    0x42,0x2B,0x28,0x25,0x25,0x28,0x51,0x3A,
+    0x3D,0x30,0x42,0x60,0x55,0x65,0x64,0x5F,
+    0x55,0x5D,0x5B,0x6A,0x78,0x99,0x81,0x6A,
+    0x71,0x90,0x73,0x5B,0x5D,0x85,0xB5,0x86,
+    0x90,0x9E,0xA3,0xAB,0xAD,0xAB,0x67,0x80,
+    0xBC,0xC9,0xBA,0xA6,0xC7,0x99,0xA8,0xAB,
+    0xA4,0xFF,0xDB,0x00,0x43,0x01,0x1C,0x1E,
+    0x1E,0x28,0x23,0x28,0x4E,0x2B,0x2B,0x4E,
+    0xA4,0x6E,0x5D,0x6E,0xA4,0xA4,0xA4,0xA4,
+    0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,
+    0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,
+    0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,
+    0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,
+    0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,
+    0xA4,0xA4,0xA4,0xA4,0xA4,0xA4,0xFF,0xC0,
+    0x00,0x11,0x08,0x02,0xD0,0x05,0x00,0x03,
+    0x01,0x22,0x00,0x02,0x11,0x01,0x03,0x11,
+    0x01,0xFF,0xC4,0x00,0x1B,0x00,0x01,0x01,
+    0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+    0x03,0x04,0x05,0x01,0x06,0x07,0xFF,0xC4,
+    0x00,0x36,0x10,0x01,0x00,0x01,0x03,0x01,
+    0x05,0x04,0x08,0x06,0x03,0x01,0x01,0x01,
+    0x00,0x00,0x00,0x00,0x01,0x02,0x03,0x32,
+    0x71,0x11,0x15,0x41,0xA2,0xE1,0x62,0x63,
+    0x64,0xA1,0x04,0x05,0x12,0x13,0x14,0x16,
+    0x21,0xA3,0x31,0x35,0x54,0x82,0xB2,0xD1,
+    0x51,0x61,0x81,0x91,0x22,0x23,0xFF,0xC4,
+    0x00,0x1A,0x01,0x01,0x01,0x00,0x03,0x01,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x05,0x02,0x03,0x04,
+    0x01,0x06,0xFF,0xC4,0x00,0x24,0x11,0x01,
+    0x00,0x01,0x03,0x04,0x02,0x03,0x01,0x01,
+    0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x03,0x04,0x33,0x02,0x31,0x32,0x51,
+    0x13,0x71,0x05,0x11,0x14,0x12,0x21,0x22,
+    0xFF,0xDA,0x00,0x0C,0x03,0x01,0x00,0x02,
+    0x11,0x03,0x11,0x00,0x3F,0x00,0xF4,0xC0,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+    0xD7,0x8C,0xB2,0x6B,0x5E,0x32,0xC9,0x3A,
+    0xEF,0x9C,0x7A,0x67,0xA7,0x60,0x07,0x2B,
+    0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x7F,
+    0x08,0xD5,0x68,0xBF,0x84,0x6A,0xDD,0x6F,
+    0x97,0x4B,0x4D,0x7C,0x72,0xC0,0x05,0xE4,
+    0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+    0x5C,0xE0,0x85,0xDC,0xE0,0x84,0xBB,0x8C,
+    0x92,0xCE,0x36,0x00,0x68,0x7A,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x03,0x0B,0xD9,0xC6,0x8D,
+    0xD8,0x5E,0xCE,0x34,0x75,0xD9,0x65,0x77,
+    0x7C,0x7E,0x66,0x60,0x2C,0xBE,0x80,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x01,0x9D,0x79,
+    0x4A,0x55,0x5E,0x52,0x94,0x7A,0x9C,0xE7,
+    0xDB,0x64,0x6C,0x00,0xC0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x01,0xCD,0x5E,0x75,0x6A,0xE9,
+    0x73,0x57,0x9D,0x5A,0xA8,0x58,0x72,0x97,
+    0x0D,0xEF,0x18,0x7C,0x01,0x51,0x34,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x01,0xFB,0x20,
+    0x11,0x1B,0x40,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x13,0x5E,0x32,0xC9,0xAD,0x78,0xCB,
+    0x24,0xEB,0xBE,0x71,0xE9,0x9E,0x9D,0x80,
+    0x1C,0xAC,0x80,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x45,0xFC,0x23,0x55,0xA2,0xFE,0x11,0xAB,
+    0x75,0xBE,0x5D,0x2D,0x35,0xF1,0xCB,0x00,
+    0x17,0x91,0x40,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x11,0x73,0x82,0x17,0x73,0x82,0x12,
+    0xEE,0x32,0x4B,0x38,0xD8,0x01,0xA1,0xE8,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x0C,0x2F,0x67,
+    0x1A,0x37,0x61,0x7B,0x38,0xD1,0xD7,0x65,
+    0x95,0xDD,0xF1,0xF9,0x99,0x80,0xB2,0xFA,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,
+    0x75,0xE5,0x29,0x55,0x79,0x4A,0x51,0xEA,
+    0x73,0x9F,0x6D,0x91,0xB0,0x03,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x07,0x35,0x79,0xD5,
+    0xAB,0xA5,0xCD,0x5E,0x75,0x6A,0xA1,0x61,
+    0xCA,0x5C,0x37,0xBC,0x61,0xF0,0x05,0x44,
+    0xD0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,
+    0xEC,0x80,0x44,0x6D,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x4D,0x78,0xCB,0x26,0xB5,
+    0xE3,0x2C,0x93,0xAE,0xF9,0xC7,0xA6,0x7A,
+    0x76,0x00,0x72,0xB2,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x01,0x17,0xF0,0x8D,0x56,0x8B,0xF8,
+    0x46,0xAD,0xD6,0xF9,0x74,0xB4,0xD7,0xC7,
+    0x2C,0x00,0x5E,0x45,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x45,0xCE,0x08,0x5D,0xCE,
+    0x08,0x4B,0xB8,0xC9,0x2C,0xE3,0x60,0x06,
+    0x87,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,
+    0xBD,0x9C,0x68,0xDD,0x85,0xEC,0xE3,0x47,
+    0x5D,0x96,0x57,0x77,0xC7,0xE6,0x66,0x02,
+    0xCB,0xE8,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x19,0xD7,0x94,0xA5,0x55,0xE5,0x29,
+    0x47,0xA9,0xCE,0x7D,0xB6,0x46,0xC0,0x0C,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0xD5,
+    0xE7,0x56,0xAE,0x97,0x35,0x79,0xD5,0xAA,
+    0x85,0x87,0x29,0x70,0xDE,0xF1,0x87,0xC0,
+    0x15,0x13,0x40,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x1F,0xB2,0x01,0x11,0xB4,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x35,0xE3,0x2C,
+    0x9A,0xD7,0x8C,0xB2,0x4E,0xBB,0xE7,0x1E,
+    0x99,0xE9,0xD8,0x01,0xCA,0xC8,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x04,0x5F,0xC2,0x35,0x5A,
+    0x2F,0xE1,0x1A,0xB7,0x5B,0xE5,0xD2,0xD3,
+    0x5F,0x1C,0xB0,0x01,0x79,0x14,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x17,0x38,0x21,
+    0x77,0x38,0x21,0x2E,0xE3,0x24,0xB3,0x8D,
+    0x80,0x1A,0x1E,0x80,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0xC2,0xF6,0x71,0xA3,0x76,0x17,0xB3,
+    0x8D,0x1D,0x76,0x59,0x5D,0xDF,0x1F,0x99,
+    0x98,0x0B,0x2F,0xA0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x67,0x5E,0x52,0x95,0x57,
+    0x94,0xA5,0x1E,0xA7,0x39,0xF6,0xD9,0x1B,
+    0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x73,0x57,0x9D,0x5A,0xBA,0x5C,0xD5,0xE7,
+    0x56,0xAA,0x16,0x1C,0xA5,0xC3,0x7B,0xC6,
+    0x1F,0x00,0x54,0x4D,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x7E,0xC8,0x04,0x46,0xD0,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x04,0xD7,
+    0x8C,0xB2,0x6B,0x5E,0x32,0xC9,0x3A,0xEF,
+    0x9C,0x7A,0x67,0xA7,0x60,0x07,0x2B,0x20,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x11,0x7F,0x08,
+    0xD5,0x68,0xBF,0x84,0x6A,0xDD,0x6F,0x97,
+    0x4B,0x4D,0x7C,0x72,0xC0,0x05,0xE4,0x50,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x5C,
+    0xE0,0x85,0xDC,0xE0,0x84,0xBB,0x8C,0x92,
+    0xCE,0x36,0x00,0x68,0x7A,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x03,0x0B,0xD9,0xC6,0x8D,0xD8,
+    0x5E,0xCE,0x34,0x75,0xD9,0x65,0x77,0x7C,
+    0x7E,0x66,0x60,0x2C,0xBE,0x80,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x9D,0x79,0x4A,
+    0x55,0x5E,0x52,0x94,0x7A,0x9C,0xE7,0xDB,
+    0x64,0x6C,0x00,0xC0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x01,0xCD,0x5E,0x75,0x6A,0xE9,0x73,
+    0x57,0x9D,0x5A,0xA8,0x58,0x72,0x97,0x0D,
+    0xEF,0x18,0x7C,0x01,0x51,0x34,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0xFB,0x20,0x11,
+    0x1B,0x40,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x13,0x5E,0x32,0xC9,0xAD,0x78,0xCB,0x24,
+    0xEB,0xBE,0x71,0xE9,0x9E,0x9D,0x80,0x1C,
+    0xAC,0x80,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,
+    0xFC,0x23,0x55,0xA2,0xFE,0x11,0xAB,0x75,
+    0xBE,0x5D,0x2D,0x35,0xF1,0xCB,0x00,0x17,
+    0x91,0x40,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x11,0x73,0x82,0x17,0x73,0x82,0x12,0xEE,
+    0x32,0x4B,0x38,0xD8,0x01,0xA1,0xE8,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x0C,0x2F,0x67,0x1A,
+    0x37,0x61,0x7B,0x38,0xD1,0xD7,0x65,0x95,
+    0xDD,0xF1,0xF9,0x99,0x80,0xB2,0xFA,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x75,
+    0xE5,0x29,0x55,0x79,0x4A,0x51,0xEA,0x73,
+    0x9F,0x6D,0x91,0xB0,0x03,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x07,0x35,0x79,0xD5,0xAB,
+    0xA5,0xCD,0x5E,0x75,0x6A,0xA1,0x61,0xCA,
+    0x5C,0x37,0xBC,0x61,0xF0,0x05,0x44,0xD0,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xEC,
+    0x80,0x44,0x6D,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x4D,0x78,0xCB,0x26,0xB5,0xE3,
+    0x2C,0x93,0xAE,0xF9,0xC7,0xA6,0x7A,0x76,
+    0x00,0x72,0xB2,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x17,0xF0,0x8D,0x56,0x8B,0xF8,0x46,
+    0xAD,0xD6,0xF9,0x74,0xB4,0xD7,0xC7,0x2C,
+    0x00,0x5E,0x45,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x45,0xCE,0x08,0x5D,0xCE,0x08,
+    0x4B,0xB8,0xC9,0x2C,0xE3,0x60,0x06,0x87,
+    0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x30,0xBD,
+    0x9C,0x68,0xDD,0x85,0xEC,0xE3,0x47,0x5D,
+    0x96,0x57,0x77,0xC7,0xE6,0x66,0x02,0xCB,
+    0xE8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x19,0xD7,0x94,0xA5,0x55,0xE5,0x29,0x47,
+    0xA9,0xCE,0x7D,0xB6,0x46,0xC0,0x0C,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x1C,0xD5,0xE7,
+    0x56,0xAE,0x97,0x35,0x79,0xD5,0xAA,0x85,
+    0x87,0x29,0x70,0xDE,0xF1,0x87,0xC0,0x15,
+    0x13,0x40,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x1F,0xB2,0x01,0x11,0xB4,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x01,0x35,0xE3,0x2C,0x9A,
+    0xD7,0x8C,0xB2,0x4E,0xBB,0xE7,0x1E,0x99,
+    0xE9,0xD8,0x01,0xCA,0xC8,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x04,0x5F,0xC2,0x35,0x5A,0x2F,
+    0xE1,0x1A,0xB7,0x5B,0xE5,0xD2,0xD3,0x5F,
+    0x1C,0xB0,0x01,0x79,0x14,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x01,0x17,0x38,0x21,0x77,
+    0x38,0x21,0x2E,0xE3,0x24,0xB3,0x8D,0x80,
+    0x1A,0x1E,0x80,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xC2,0xF6,0x71,0xA3,0x76,0x17,0xB3,0x8D,
+    0x1D,0x76,0x59,0x5D,0xDF,0x1F,0x99,0x98,
+    0x0B,0x2F,0xA0,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x67,0x5E,0x52,0x95,0x57,0x94,
+    0xA5,0x1E,0xA7,0x39,0xF6,0xD9,0x1B,0x00,
+    0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,
+    0x57,0x9D,0x5A,0xBA,0x5C,0xD5,0xE7,0x56,
+    0xAA,0x16,0x1C,0xA5,0xC3,0x7B,0xC6,0x1F,
+    0x00,0x54,0x4D,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x7E,0xC8,0x04,0x46,0xD0,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x04,0xD7,0x8C,
+    0xB2,0x6B,0x5E,0x32,0xC9,0x3A,0xEF,0x9C,
+    0x7A,0x67,0xA7,0x60,0x07,0x2B,0x20,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x11,0x7F,0x08,0xD5,
+    0x68,0xBF,0x84,0x6A,0xDD,0x6F,0x97,0x4B,
+    0x4D,0x7C,0x72,0xC0,0x05,0xE4,0x50,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x04,0x5C,0xE0,
+    0x85,0xDC,0xE0,0x84,0xBB,0x8C,0x92,0xCE,
+    0x36,0x00,0x68,0x7A,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x03,0x0B,0xD9,0xC6,0x8D,0xD8,0x5E,
+    0xCE,0x34,0x75,0xD9,0x65,0x77,0x7C,0x7E,
+    0x66,0x60,0x2C,0xBE,0x80,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x01,0x9D,0x79,0x4A,0x55,
+    0x5E,0x52,0x94,0x7A,0x9C,0xE7,0xDB,0x64,
+    0x6C,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0xCD,0x5E,0x75,0x6A,0xE9,0x73,0x57,
+    0x9D,0x5A,0xA8,0x58,0x72,0x97,0x0D,0xEF,
+    0x18,0x7C,0x01,0x51,0x34,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x01,0xFB,0x20,0x11,0x1B,
+    0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,
+    0x5E,0x32,0xC9,0xAD,0x78,0xCB,0x24,0xEB,
+    0xBE,0x71,0xE9,0x9E,0x9D,0x80,0x1C,0xAC,
+    0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x45,0xFC,
+    0x23,0x55,0xA2,0xFE,0x11,0xAB,0x75,0xBE,
+    0x5D,0x2D,0x35,0xF1,0xCB,0x00,0x17,0x91,
+    0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,
+    0x73,0x82,0x17,0x73,0x82,0x12,0xEE,0x32,
+    0x4B,0x38,0xD8,0x01,0xA1,0xE8,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0C,0x2F,0x67,0x1A,0x37,
+    0x61,0x7B,0x38,0xD1,0xD7,0x65,0x95,0xDD,
+    0xF1,0xF9,0x99,0x80,0xB2,0xFA,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x06,0x75,0xE5,
+    0x29,0x55,0x79,0x4A,0x51,0xEA,0x73,0x9F,
+    0x6D,0x91,0xB0,0x03,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x07,0x35,0x79,0xD5,0xAB,0xA5,
+    0xCD,0x5E,0x75,0x6A,0xA1,0x61,0xCA,0x5C,
+    0x37,0xBC,0x61,0xF0,0x05,0x44,0xD0,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x07,0xEC,0x80,
+    0x44,0x6D,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x4D,0x78,0xCB,0x26,0xB5,0xE3,0x2C,
+    0x93,0xAE,0xF9,0xC7,0xA6,0x7A,0x76,0x00,
+    0x72,0xB2,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+    0x17,0xF0,0x8D,0x56,0x8B,0xF8,0x46,0xAD,
+    0xD6,0xF9,0x74,0xB4,0xD7,0xC7,0x2C,0x00,
+    0x5E,0x45,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x45,0xCE,0x08,0x5D,0xCE,0x08,0x4B,
+    0xB8,0xC9,0x2C,0xE3,0x60,0x06,0x87,0xA0,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x30,0xBD,0x9C,
+    0x68,0xDD,0x85,0xEC,0xE3,0x47,0x5D,0x96,
+    0x57,0x77,0xC7,0xE6,0x66,0x02,0xCB,0xE8,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x19,
+    0xD7,0x94,0xA5,0x55,0xE5,0x29,0x47,0xA9,
+    0xCE,0x7D,0xB6,0x46,0xC0,0x0C,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x1C,0xD5,0xE7,0x56,
+    0xAE,0x97,0x35,0x79,0xD5,0xAA,0x85,0x87,
+    0x29,0x70,0xDE,0xF1,0x87,0xC0,0x15,0x13,
+    0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,
+    0xB2,0x01,0x11,0xB4,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x01,0x35,0xE3,0x2C,0x9A,0xD7,
+    0x8C,0xB2,0x4E,0xBB,0xE7,0x1E,0x99,0xE9,
+    0xD8,0x01,0xCA,0xC8,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x04,0x5F,0xC2,0x35,0x5A,0x2F,0xE1,
+    0x1A,0xB7,0x5B,0xE5,0xD2,0xD3,0x5F,0x1C,
+    0xB0,0x01,0x79,0x14,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x01,0x17,0x38,0x21,0x77,0x38,
+    0x21,0x2E,0xE3,0x24,0xB3,0x8D,0x80,0x1A,
+    0x1E,0x80,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC2,
+    0xF6,0x71,0xA3,0x76,0x17,0xB3,0x8D,0x1D,
+    0x76,0x59,0x5D,0xDF,0x1F,0x99,0x98,0x0B,
+    0x2F,0xA0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x67,0x5E,0x52,0x95,0x57,0x94,0xA5,
+    0x1E,0xA7,0x39,0xF6,0xD9,0x1B,0x00,0x30,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x73,0x57,
+    0x9D,0x5A,0xBA,0x5C,0xD5,0xE7,0x56,0xAA,
+    0x16,0x1C,0xA5,0xC3,0x7B,0xC6,0x1F,0x00,
+    0x54,0x4D,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x7E,0xC8,0x04,0x46,0xD0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x04,0xD7,0x8C,0xB2,
+    0x6B,0x5E,0x32,0xC9,0x3A,0xEF,0x9C,0x7A,
+    0x67,0xA7,0x60,0x07,0x2B,0x20,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x11,0x7F,0x08,0xD5,0x68,
+    0xBF,0x84,0x6A,0xDD,0x6F,0x97,0x4B,0x4D,
+    0x7C,0x72,0xC0,0x05,0xE4,0x50,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x04,0x5C,0xE0,0x85,
+    0xDC,0xE0,0x84,0xBB,0x8C,0x92,0xCE,0x36,
+    0x00,0x68,0x7A,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x03,0x0B,0xD9,0xC6,0x8D,0xD8,0x5E,0xCE,
+    0x34,0x75,0xD9,0x65,0x77,0x7C,0x7E,0x66,
+    0x60,0x2C,0xBE,0x80,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x01,0x9D,0x79,0x4A,0x55,0x5E,
+    0x52,0x94,0x7A,0x9C,0xE7,0xDB,0x64,0x6C,
+    0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+    0xCD,0x5E,0x75,0x6A,0xE9,0x73,0x57,0x9D,
+    0x5A,0xA8,0x58,0x72,0x97,0x0D,0xEF,0x18,
+    0x7C,0x01,0x51,0x34,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x01,0xFB,0x20,0x11,0x1B,0x40,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x13,0x5E,
+    0x32,0xC9,0xAD,0x78,0xCB,0x24,0xEB,0xBE,
+    0x71,0xE9,0x9E,0x9D,0x80,0x1C,0xAC,0x80,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x45,0xFC,0x23,
+    0x55,0xA2,0xFE,0x11,0xAB,0x75,0xBE,0x5D,
+    0x2D,0x35,0xF1,0xCB,0x00,0x17,0x91,0x40,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x73,
+    0x82,0x17,0x73,0x82,0x12,0xEE,0x32,0x4B,
+    0x38,0xD8,0x01,0xA1,0xE8,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x0C,0x2F,0x67,0x1A,0x37,0x61,
+    0x7B,0x38,0xD1,0xD7,0x65,0x95,0xDD,0xF1,
+    0xF9,0x99,0x80,0xB2,0xFA,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x06,0x75,0xE5,0x29,
+    0x55,0x79,0x4A,0x51,0xEA,0x73,0x9F,0x6D,
+    0x91,0xB0,0x03,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x07,0x35,0x79,0xD5,0xAB,0xA5,0xCD,
+    0x5E,0x75,0x6A,0xA1,0x61,0xCA,0x5C,0x37,
+    0xBC,0x61,0xF0,0x05,0x44,0xD0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x07,0xEC,0x80,0x44,
+    0x6D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x4D,0x78,0xCB,0x26,0xB5,0xE3,0x2C,0x93,
+    0xAE,0xF9,0xC7,0xA6,0x7A,0x76,0x00,0x72,
+    0xB2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x17,
+    0xF0,0x8D,0x56,0x8B,0xF8,0x46,0xAD,0xD6,
+    0xF9,0x74,0xB4,0xD7,0xC7,0x2C,0x00,0x5E,
+    0x45,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x45,0xCE,0x08,0x5D,0xCE,0x08,0x4B,0xB8,
+    0xC9,0x2C,0xE3,0x60,0x06,0x87,0xA0,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x30,0xBD,0x9C,0x68,
+    0xDD,0x85,0xEC,0xE3,0x47,0x5D,0x96,0x57,
+    0x77,0xC7,0xE6,0x66,0x02,0xCB,0xE8,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x19,0xD7,
+    0x94,0xA5,0x55,0xE5,0x29,0x47,0xA9,0xCE,
+    0x7D,0xB6,0x46,0xC0,0x0C,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x1C,0xD5,0xE7,0x56,0xAE,
+    0x97,0x35,0x79,0xD5,0xAA,0x85,0x87,0x29,
+    0x70,0xDE,0xF1,0x87,0xC0,0x15,0x13,0x40,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xB2,
+    0x01,0x11,0xB4,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x01,0x35,0xE3,0x2C,0x9A,0xD7,0x8C,
+    0xB2,0x4E,0xBB,0xE7,0x1E,0x99,0xE9,0xD8,
+    0x01,0xCA,0xC8,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x04,0x5F,0xC2,0x35,0x5A,0x2F,0xE1,0x1A,
+    0xB7,0x5B,0xE5,0xD2,0xD3,0x5F,0x1C,0xB0,
+    0x01,0x79,0x14,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x01,0x17,0x38,0x21,0x77,0x38,0x21,
+    0x2E,0xE3,0x24,0xB3,0x8D,0x80,0x1A,0x1E,
+    0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xC2,0xF6,
+    0x71,0xA3,0x76,0x17,0xB3,0x8D,0x1D,0x76,
+    0x59,0x5D,0xDF,0x1F,0x99,0x98,0x0B,0x2F,
+    0xA0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x67,0x5E,0x52,0x95,0x57,0x94,0xA5,0x1E,
+    0xA7,0x39,0xF6,0xD9,0x1B,0x00,0x30,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x73,0x57,0x9D,
+    0x5A,0xBA,0x5C,0xD5,0xE7,0x56,0xAA,0x16,
+    0x1C,0xA5,0xC3,0x7B,0xC6,0x1F,0x00,0x54,
+    0x4D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x7E,0xC8,0x04,0x46,0xD0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x04,0xD7,0x8C,0xB2,0x6B,
+    0x5E,0x32,0xC9,0x3A,0xEF,0x9C,0x7A,0x67,
+    0xA7,0x60,0x07,0x2B,0x20,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x11,0x7F,0x08,0xD5,0x68,0xBF,
+    0x84,0x6A,0xDD,0x6F,0x97,0x4B,0x4D,0x7C,
+    0x72,0xC0,0x05,0xE4,0x50,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x04,0x5C,0xE0,0x85,0xDC,
+    0xE0,0x84,0xBB,0x8C,0x92,0xCE,0x36,0x00,
+    0x68,0x7A,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,
+    0x0B,0xD9,0xC6,0x8D,0xD8,0x5E,0xCE,0x34,
+    0x75,0xD9,0x65,0x77,0x7C,0x7E,0x66,0x60,
+    0x2C,0xBE,0x80,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x01,0x9D,0x79,0x4A,0x55,0x5E,0x52,
+    0x94,0x7A,0x9C,0xE7,0xDB,0x64,0x6C,0x00,
+    0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xCD,
+    0x5E,0x75,0x6A,0xE9,0x73,0x57,0x9D,0x5A,
+    0xA8,0x58,0x72,0x97,0x0D,0xEF,0x18,0x7C,
+    0x01,0x51,0x34,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x01,0xFB,0x20,0x11,0x1B,0x40,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x13,0x5E,0x32,
+    0xC9,0xAD,0x78,0xCB,0x24,0xEB,0xBE,0x71,
+    0xE9,0x9E,0x9D,0x80,0x1C,0xAC,0x80,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x45,0xFC,0x23,0x55,
+    0xA2,0xFE,0x11,0xAB,0x75,0xBE,0x5D,0x2D,
+    0x35,0xF1,0xCB,0x00,0x17,0x91,0x40,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x11,0x73,0x82,
+    0x17,0x73,0x82,0x12,0xEE,0x32,0x4B,0x38,
+    0xD8,0x01,0xA1,0xE8,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x0C,0x2F,0x67,0x1A,0x37,0x61,0x7B,
+    0x38,0xD1,0xD7,0x65,0x95,0xDD,0xF1,0xF9,
+    0x99,0x80,0xB2,0xFA,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x06,0x75,0xE5,0x29,0x55,
+    0x79,0x4A,0x51,0xEA,0x73,0x9F,0x6D,0x91,
+    0xB0,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x07,0x35,0x79,0xD5,0xAB,0xA5,0xCD,0x5E,
+    0x75,0x6A,0xA1,0x61,0xCA,0x5C,0x37,0xBC,
+    0x61,0xF0,0x05,0x44,0xD0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x07,0xEC,0x80,0x44,0x6D,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4D,
+    0x78,0xCB,0x26,0xB5,0xE3,0x2C,0x93,0xAE,
+    0xF9,0xC7,0xA6,0x7A,0x76,0x00,0x72,0xB2,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x01,0x17,0xF0,
+    0x8D,0x56,0x8B,0xF8,0x46,0xAD,0xD6,0xF9,
+    0x74,0xB4,0xD7,0xC7,0x2C,0x00,0x5E,0x45,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,
+    0xCE,0x08,0x5D,0xCE,0x08,0x4B,0xB8,0xC9,
+    0x2C,0xE3,0x60,0x06,0x87,0xA0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x30,0xBD,0x9C,0x68,0xDD,
+    0x85,0xEC,0xE3,0x47,0x5D,0x96,0x57,0x77,
+    0xC7,0xE6,0x66,0x02,0xCB,0xE8,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x19,0xD7,0x94,
+    0xA5,0x55,0xE5,0x29,0x47,0xA9,0xCE,0x7D,
+    0xB6,0x46,0xC0,0x0C,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x1C,0xD5,0xE7,0x56,0xAE,0x97,
+    0x35,0x79,0xD5,0xAA,0x85,0x87,0x29,0x70,
+    0xDE,0xF1,0x87,0xC0,0x15,0x13,0x40,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x1F,0xB2,0x01,
+    0x11,0xB4,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x35,0xE3,0x2C,0x9A,0xD7,0x8C,0xB2,
+    0x4E,0xBB,0xE7,0x1E,0x99,0xE9,0xD8,0x01,
+    0xCA,0xC8,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+    0x5F,0xC2,0x35,0x5A,0x2F,0xE1,0x1A,0xB7,
+    0x5B,0xE5,0xD2,0xD3,0x5F,0x1C,0xB0,0x01,
+    0x79,0x14,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x17,0x38,0x21,0x77,0x38,0x21,0x2E,
+    0xE3,0x24,0xB3,0x8D,0x80,0x1A,0x1E,0x80,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xC2,0xF6,0x71,
+    0xA3,0x76,0x17,0xB3,0x8D,0x1D,0x76,0x59,
+    0x5D,0xDF,0x1F,0x99,0x98,0x0B,0x2F,0xA0,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,
+    0x5E,0x52,0x95,0x57,0x94,0xA5,0x1E,0xA7,
+    0x39,0xF6,0xD9,0x1B,0x00,0x30,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x73,0x57,0x9D,0x5A,
+    0xBA,0x5C,0xD5,0xE7,0x56,0xAA,0x16,0x1C,
+    0xA5,0xC3,0x7B,0xC6,0x1F,0x00,0x54,0x4D,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,
+    0xC8,0x04,0x46,0xD0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x04,0xD7,0x8C,0xB2,0x6B,0x5E,
+    0x32,0xC9,0x3A,0xEF,0x9C,0x7A,0x67,0xA7,
+    0x60,0x07,0x2B,0x20,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x11,0x7F,0x08,0xD5,0x68,0xBF,0x84,
+    0x6A,0xDD,0x6F,0x97,0x4B,0x4D,0x7C,0x72,
+    0xC0,0x05,0xE4,0x50,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x04,0x5C,0xE0,0x85,0xDC,0xE0,
+    0x84,0xBB,0x8C,0x92,0xCE,0x36,0x00,0x68,
+    0x7A,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x0B,
+    0xD9,0xC6,0x8D,0xD8,0x5E,0xCE,0x34,0x75,
+    0xD9,0x65,0x77,0x7C,0x7E,0x66,0x60,0x2C,
+    0xBE,0x80,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0x9D,0x79,0x4A,0x55,0x5E,0x52,0x94,
+    0x7A,0x9C,0xE7,0xDB,0x64,0x6C,0x00,0xC0,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x01,0xCD,0x5E,
+    0x75,0x6A,0xE9,0x73,0x57,0x9D,0x5A,0xA8,
+    0x58,0x72,0x97,0x0D,0xEF,0x18,0x7C,0x01,
+    0x51,0x34,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x01,0xFB,0x20,0x11,0x1B,0x40,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x13,0x5E,0x32,0xC9,
+    0xAD,0x78,0xCB,0x24,0xEB,0xBE,0x71,0xE9,
+    0x9E,0x9D,0x80,0x1C,0xAC,0x80,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x45,0xFC,0x23,0x55,0xA2,
+    0xFE,0x11,0xAB,0x75,0xBE,0x5D,0x2D,0x35,
+    0xF1,0xCB,0x00,0x17,0x91,0x40,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x11,0x73,0x82,0x17,
+    0x73,0x82,0x12,0xEE,0x32,0x4B,0x38,0xD8,
+    0x01,0xA1,0xE8,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x0C,0x2F,0x67,0x1A,0x37,0x61,0x7B,0x38,
+    0xD1,0xD7,0x65,0x95,0xDD,0xF1,0xF9,0x99,
+    0x80,0xB2,0xFA,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x06,0x75,0xE5,0x29,0x55,0x79,
+    0x4A,0x51,0xEA,0x73,0x9F,0x6D,0x91,0xB0,
+    0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,
+    0x35,0x79,0xD5,0xAB,0xA5,0xCD,0x5E,0x75,
+    0x6A,0xA1,0x61,0xCA,0x5C,0x37,0xBC,0x61,
+    0xF0,0x05,0x44,0xD0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x07,0xEC,0x80,0x44,0x6D,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x4D,0x78,
+    0xCB,0x26,0xB5,0xE3,0x2C,0x93,0xAE,0xF9,
+    0xC7,0xA6,0x7A,0x76,0x00,0x72,0xB2,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0x17,0xF0,0x8D,
+    0x56,0x8B,0xF8,0x46,0xAD,0xD6,0xF9,0x74,
+    0xB4,0xD7,0xC7,0x2C,0x00,0x5E,0x45,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x45,0xCE,
+    0x08,0x5D,0xCE,0x08,0x4B,0xB8,0xC9,0x2C,
+    0xE3,0x60,0x06,0x87,0xA0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x30,0xBD,0x9C,0x68,0xDD,0x85,
+    0xEC,0xE3,0x47,0x5D,0x96,0x57,0x77,0xC7,
+    0xE6,0x66,0x02,0xCB,0xE8,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x19,0xD7,0x94,0xA5,
+    0x55,0xE5,0x29,0x47,0xA9,0xCE,0x7D,0xB6,
+    0x46,0xC0,0x0C,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x1C,0xD5,0xE7,0x56,0xAE,0x97,0x35,
+    0x79,0xD5,0xAA,0x85,0x87,0x29,0x70,0xDE,
+    0xF1,0x87,0xC0,0x15,0x13,0x40,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x1F,0xB2,0x01,0x11,
+    0xB4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+    0x35,0xE3,0x2C,0x9A,0xD7,0x8C,0xB2,0x4E,
+    0xBB,0xE7,0x1E,0x99,0xE9,0xD8,0x01,0xCA,
+    0xC8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x5F,
+    0xC2,0x35,0x5A,0x2F,0xE1,0x1A,0xB7,0x5B,
+    0xE5,0xD2,0xD3,0x5F,0x1C,0xB0,0x01,0x79,
+    0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+    0x17,0x38,0x21,0x77,0x38,0x21,0x2E,0xE3,
+    0x24,0xB3,0x8D,0x80,0x1A,0x1E,0x80,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xC2,0xF6,0x71,0xA3,
+    0x76,0x17,0xB3,0x8D,0x1D,0x76,0x59,0x5D,
+    0xDF,0x1F,0x99,0x98,0x0B,0x2F,0xA0,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x67,0x5E,
+    0x52,0x95,0x57,0x94,0xA5,0x1E,0xA7,0x39,
+    0xF6,0xD9,0x1B,0x00,0x30,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x73,0x57,0x9D,0x5A,0xBA,
+    0x5C,0xD5,0xE7,0x56,0xAA,0x16,0x1C,0xA5,
+    0xC3,0x7B,0xC6,0x1F,0x00,0x54,0x4D,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0xC8,
+    0x04,0x46,0xD0,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x04,0xD7,0x8C,0xB2,0x6B,0x5E,0x32,
+    0xC9,0x3A,0xEF,0x9C,0x7A,0x67,0xA7,0x60,
+    0x07,0x2B,0x20,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x11,0x7F,0x08,0xD5,0x68,0xBF,0x84,0x6A,
+    0xDD,0x6F,0x97,0x4B,0x4D,0x7C,0x72,0xC0,
+    0x05,0xE4,0x50,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x04,0x5C,0xE0,0x85,0xDC,0xE0,0x84,
+    0xBB,0x8C,0x92,0xCE,0x36,0x00,0x68,0x7A,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x03,0x0B,0xD9,
+    0xC6,0x8D,0xD8,0x5E,0xCE,0x34,0x75,0xD9,
+    0x65,0x77,0x7C,0x7E,0x66,0x60,0x2C,0xBE,
+    0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+    0x9D,0x79,0x4A,0x55,0x5E,0x52,0x94,0x7A,
+    0x9C,0xE7,0xDB,0x64,0x6C,0x00,0xC0,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x01,0xCD,0x5E,0x75,
+    0x6A,0xE9,0x73,0x57,0x9D,0x5A,0xA8,0x58,
+    0x72,0x97,0x0D,0xEF,0x18,0x7C,0x01,0x51,
+    0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+    0xFB,0x20,0x11,0x1B,0x40,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x13,0x5E,0x32,0xC9,0xAD,
+    0x78,0xCB,0x24,0xEB,0xBE,0x71,0xE9,0x9E,
+    0x9D,0x80,0x1C,0xAC,0x80,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x45,0xFC,0x23,0x55,0xA2,0xFE,
+    0x11,0xAB,0x75,0xBE,0x5D,0x2D,0x35,0xF1,
+    0xCB,0x00,0x17,0x91,0x40,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x11,0x73,0x82,0x17,0x73,
+    0x82,0x12,0xEE,0x32,0x4B,0x38,0xD8,0x01,
+    0xA1,0xE8,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,
+    0x2F,0x67,0x1A,0x37,0x61,0x7B,0x38,0xD1,
+    0xD7,0x65,0x95,0xDD,0xF1,0xF9,0x99,0x80,
+    0xB2,0xFA,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x06,0x75,0xE5,0x29,0x55,0x79,0x4A,
+    0x51,0xEA,0x73,0x9F,0x6D,0x91,0xB0,0x03,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x35,
+    0x79,0xD5,0xAB,0xA5,0xCD,0x5E,0x75,0x6A,
+    0xA1,0x61,0xCA,0x5C,0x37,0xBC,0x61,0xF0,
+    0x05,0x44,0xD0,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x07,0xEC,0x80,0x44,0x6D,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x4D,0x78,0xCB,
+    0x26,0xB5,0xE3,0x2C,0x93,0xAE,0xF9,0xC7,
+    0xA6,0x7A,0x76,0x00,0x72,0xB2,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x01,0x17,0xF0,0x8D,0x56,
+    0x8B,0xF8,0x46,0xAD,0xD6,0xF9,0x74,0xB4,
+    0xD7,0xC7,0x2C,0x00,0x5E,0x45,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x45,0xCE,0x08,
+    0x5D,0xCE,0x08,0x4B,0xB8,0xC9,0x2C,0xE3,
+    0x60,0x06,0x87,0xA0,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x30,0xBD,0x9C,0x68,0xDD,0x85,0xEC,
+    0xE3,0x47,0x5D,0x96,0x57,0x77,0xC7,0xE6,
+    0x66,0x02,0xCB,0xE8,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x19,0xD7,0x94,0xA5,0x55,
+    0xE5,0x29,0x47,0xA9,0xCE,0x7D,0xB6,0x46,
+    0xC0,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x1C,0xD5,0xE7,0x56,0xAE,0x97,0x35,0x79,
+    0xD5,0xAA,0x85,0x87,0x29,0x70,0xDE,0xF1,
+    0x87,0xC0,0x15,0x13,0x40,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x1F,0xB2,0x01,0x11,0xB4,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x35,
+    0xE3,0x2C,0x9A,0xD7,0x8C,0xB2,0x4E,0xBB,
+    0xE7,0x1E,0x99,0xE9,0xD8,0x01,0xCA,0xC8,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x04,0x5F,0xC2,
+    0x35,0x5A,0x2F,0xE1,0x1A,0xB7,0x5B,0xE5,
+    0xD2,0xD3,0x5F,0x1C,0xB0,0x01,0x79,0x14,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x17,
+    0x38,0x21,0x77,0x38,0x21,0x2E,0xE3,0x24,
+    0xB3,0x8D,0x80,0x1A,0x1E,0x80,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0xC2,0xF6,0x71,0xA3,0x76,
+    0x17,0xB3,0x8D,0x1D,0x76,0x59,0x5D,0xDF,
+    0x1F,0x99,0x98,0x0B,0x2F,0xA0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x67,0x5E,0x52,
+    0x95,0x57,0x94,0xA5,0x1E,0xA7,0x39,0xF6,
+    0xD9,0x1B,0x00,0x30,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x73,0x57,0x9D,0x5A,0xBA,0x5C,
+    0xD5,0xE7,0x56,0xAA,0x16,0x1C,0xA5,0xC3,
+    0x7B,0xC6,0x1F,0x00,0x54,0x4D,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x7E,0xC8,0x04,
+    0x46,0xD0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x04,0xD7,0x8C,0xB2,0x6B,0x5E,0x32,0xC9,
+    0x3A,0xEF,0x9C,0x7A,0x67,0xA7,0x60,0x07,
+    0x2B,0x20,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x11,
+    0x7F,0x08,0xD5,0x68,0xBF,0x84,0x6A,0xDD,
+    0x6F,0x97,0x4B,0x4D,0x7C,0x72,0xC0,0x05,
+    0xE4,0x50,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x04,0x5C,0xE0,0x85,0xDC,0xE0,0x84,0xBB,
+    0x8C,0x92,0xCE,0x36,0x00,0x68,0x7A,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x03,0x0B,0xD9,0xC6,
+    0x8D,0xD8,0x5E,0xCE,0x34,0x75,0xD9,0x65,
+    0x77,0x7C,0x7E,0x66,0x60,0x2C,0xBE,0x80,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x9D,
+    0x79,0x4A,0x55,0x5E,0x52,0x94,0x7A,0x9C,
+    0xE7,0xDB,0x64,0x6C,0x00,0xC0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x01,0xCD,0x5E,0x75,0x6A,
+    0xE9,0x73,0x57,0x9D,0x5A,0xA8,0x58,0x72,
+    0x97,0x0D,0xEF,0x18,0x7C,0x01,0x51,0x34,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFB,
+    0x20,0x11,0x1B,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x13,0x5E,0x32,0xC9,0xAD,0x78,
+    0xCB,0x24,0xEB,0xBE,0x71,0xE9,0x9E,0x9D,
+    0x80,0x1C,0xAC,0x80,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x45,0xFC,0x23,0x55,0xA2,0xFE,0x11,
+    0xAB,0x75,0xBE,0x5D,0x2D,0x35,0xF1,0xCB,
+    0x00,0x17,0x91,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x11,0x73,0x82,0x17,0x73,0x82,
+    0x12,0xEE,0x32,0x4B,0x38,0xD8,0x01,0xA1,
+    0xE8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x2F,
+    0x67,0x1A,0x37,0x61,0x7B,0x38,0xD1,0xD7,
+    0x65,0x95,0xDD,0xF1,0xF9,0x99,0x80,0xB2,
+    0xFA,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x06,0x75,0xE5,0x29,0x55,0x79,0x4A,0x51,
+    0xEA,0x73,0x9F,0x6D,0x91,0xB0,0x03,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x07,0x35,0x79,
+    0xD5,0xAB,0xA5,0xCD,0x5E,0x75,0x6A,0xA1,
+    0x61,0xCA,0x5C,0x37,0xBC,0x61,0xF0,0x05,
+    0x44,0xD0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x07,0xEC,0x80,0x44,0x6D,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x4D,0x78,0xCB,0x26,
+    0xB5,0xE3,0x2C,0x93,0xAE,0xF9,0xC7,0xA6,
+    0x7A,0x76,0x00,0x72,0xB2,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x01,0x17,0xF0,0x8D,0x56,0x8B,
+    0xF8,0x46,0xAD,0xD6,0xF9,0x74,0xB4,0xD7,
+    0xC7,0x2C,0x00,0x5E,0x45,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x45,0xCE,0x08,0x5D,
+    0xCE,0x08,0x4B,0xB8,0xC9,0x2C,0xE3,0x60,
+    0x06,0x87,0xA0,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x30,0xBD,0x9C,0x68,0xDD,0x85,0xEC,0xE3,
+    0x47,0x5D,0x96,0x57,0x77,0xC7,0xE6,0x66,
+    0x02,0xCB,0xE8,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x19,0xD7,0x94,0xA5,0x55,0xE5,
+    0x29,0x47,0xA9,0xCE,0x7D,0xB6,0x46,0xC0,
+    0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,
+    0xD5,0xE7,0x56,0xAE,0x97,0x35,0x79,0xD5,
+    0xAA,0x85,0x87,0x29,0x70,0xDE,0xF1,0x87,
+    0xC0,0x15,0x13,0x40,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x1F,0xB2,0x01,0x11,0xB4,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x01,0x35,0xE3,
+    0x2C,0x9A,0xD7,0x8C,0xB2,0x4E,0xBB,0xE7,
+    0x1E,0x99,0xE9,0xD8,0x01,0xCA,0xC8,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x04,0x5F,0xC2,0x35,
+    0x5A,0x2F,0xE1,0x1A,0xB7,0x5B,0xE5,0xD2,
+    0xD3,0x5F,0x1C,0xB0,0x01,0x79,0x14,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x01,0x17,0x38,
+    0x21,0x77,0x38,0x21,0x2E,0xE3,0x24,0xB3,
+    0x8D,0x80,0x1A,0x1E,0x80,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0xC2,0xF6,0x71,0xA3,0x76,0x17,
+    0xB3,0x8D,0x1D,0x76,0x59,0x5D,0xDF,0x1F,
+    0x99,0x98,0x0B,0x2F,0xA0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x67,0x5E,0x52,0x95,
+    0x57,0x94,0xA5,0x1E,0xA7,0x39,0xF6,0xD9,
+    0x1B,0x00,0x30,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x73,0x57,0x9D,0x5A,0xBA,0x5C,0xD5,
+    0xE7,0x56,0xAA,0x16,0x1C,0xA5,0xC3,0x7B,
+    0xC6,0x1F,0x00,0x54,0x4D,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x7E,0xC8,0x04,0x46,
+    0xD0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+    0xD7,0x8C,0xB2,0x6B,0x5E,0x32,0xC9,0x3A,
+    0xEF,0x9C,0x7A,0x67,0xA7,0x60,0x07,0x2B,
+    0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x7F,
+    0x08,0xD5,0x68,0xBF,0x84,0x6A,0xDD,0x6F,
+    0x97,0x4B,0x4D,0x7C,0x72,0xC0,0x05,0xE4,
+    0x50,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+    0x5C,0xE0,0x85,0xDC,0xE0,0x84,0xBB,0x8C,
+    0x92,0xCE,0x36,0x00,0x68,0x7A,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x03,0x0B,0xD9,0xC6,0x8D,
+    0xD8,0x5E,0xCE,0x34,0x75,0xD9,0x65,0x77,
+    0x7C,0x7E,0x66,0x60,0x2C,0xBE,0x80,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x01,0x9D,0x79,
+    0x4A,0x55,0x5E,0x52,0x94,0x7A,0x9C,0xE7,
+    0xDB,0x64,0x6C,0x00,0xC0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x01,0xCD,0x5E,0x75,0x6A,0xE9,
+    0x73,0x57,0x9D,0x5A,0xA8,0x58,0x72,0x97,
+    0x0D,0xEF,0x18,0x7C,0x01,0x51,0x34,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x01,0xFB,0x21,
+    0xE2,0xFC,0xC1,0xE1,0x7E,0xE7,0x43,0xE6,
+    0x0F,0x0B,0xF7,0x3A,0x22,0x36,0xBD,0xA1,
+    0xE2,0xFC,0xC1,0xE1,0x7E,0xE7,0x43,0xE6,
+    0x0F,0x0B,0xF7,0x3A,0x03,0xDA,0x1E,0x2F,
+    0xCC,0x1E,0x17,0xEE,0x74,0x3E,0x60,0xF0,
+    0xBF,0x73,0xA0,0x3D,0xA1,0xE2,0xFC,0xC1,
+    0xE1,0x7E,0xE7,0x43,0xE6,0x0F,0x0B,0xF7,
+    0x3A,0x03,0xDA,0x1E,0x2F,0xCC,0x1E,0x17,
+    0xEE,0x74,0x3E,0x60,0xF0,0xBF,0x73,0xA0,
+    0x3D,0xA1,0xE2,0xFC,0xC1,0xE1,0x7E,0xE7,
+    0x43,0xE6,0x0F,0x0B,0xF7,0x3A,0x03,0xDA,
+    0x1E,0x2F,0xCC,0x1E,0x17,0xEE,0x74,0x3E,
+    0x60,0xF0,0xBF,0x73,0xA0,0x3D,0xA1,0xE2,
+    0xFC,0xC1,0xE1,0x7E,0xE7,0x43,0xE6,0x0F,
+    0x0B,0xF7,0x3A,0x03,0xDA,0x1E,0x2F,0xCC,
+    0x1E,0x17,0xEE,0x74,0x3E,0x60,0xF0,0xBF,
+    0x73,0xA0,0x3D,0xA1,0xE2,0xFC,0xC1,0xE1,
+    0x7E,0xE7,0x43,0xE6,0x0F,0x0B,0xF7,0x3A,
+    0x03,0xDA,0x1E,0x2F,0xCC,0x1E,0x17,0xEE,
+    0x74,0x3E,0x60,0xF0,0xBF,0x73,0xA0,0x3D,
+    0x8A,0xF1,0x96,0x4F,0x2E,0xAF,0x5F,0xED,
+    0x8D,0x9F,0x0D,0xF7,0x3A,0x27,0x7E,0x78,
+    0x6E,0x7E,0x8E,0x2B,0x8A,0x5A,0xF5,0xEA,
+    0xFB,0xD3,0x0C,0xA2,0x5E,0xB0,0xF2,0x77,
+    0xE7,0x86,0xE7,0xE8,0x6F,0xCF,0x0D,0xCF,
+    0xD1,0xCF,0xF9,0xEA,0x74,0xF7,0xEE,0x1E,
+    0xB0,0xF2,0x77,0xE7,0x86,0xE7,0xE8,0x6F,
+    0xCF,0x0D,0xCF,0xD0,0xFC,0xF5,0x3A,0x3E,
+    0xE1,0xEB,0x0F,0x27,0x7E,0x78,0x6E,0x7E,
+    0x86,0xFC,0xF0,0xDC,0xFD,0x0F,0xCF,0x53,
+    0xA3,0xEE,0x1E,0xB0,0xF2,0x77,0xE7,0x86,
+    0xE7,0xE8,0x6F,0xCF,0x0D,0xCF,0xD0,0xFC,
+    0xF5,0x3A,0x3E,0xE1,0xEB,0x0F,0x27,0x7E,
+    0x78,0x6E,0x7E,0x86,0xFC,0xF0,0xDC,0xFD,
+    0x0F,0xCF,0x53,0xA3,0xEE,0x1E,0xB0,0xF2,
+    0x77,0xE7,0x86,0xE7,0xE8,0x6F,0xCF,0x0D,
+    0xCF,0xD0,0xFC,0xF5,0x3A,0x3E,0xE1,0xEB,
+    0x0F,0x27,0x7E,0x78,0x6E,0x7E,0x86,0xFC,
+    0xF0,0xDC,0xFD,0x0F,0xCF,0x53,0xA3,0xEE,
+    0x1E,0xB0,0xF2,0x77,0xE7,0x86,0xE7,0xE8,
+    0x6F,0xCF,0x0D,0xCF,0xD0,0xFC,0xF5,0x3A,
+    0x3E,0xE1,0xEB,0x0F,0x27,0x7E,0x78,0x6E,
+    0x7E,0x86,0xFC,0xF0,0xDC,0xFD,0x0F,0xCF,
+    0x53,0xA3,0xEE,0x1E,0xB0,0xF2,0x77,0xE7,
+    0x86,0xE7,0xE8,0x6F,0xCF,0x0D,0xCF,0xD0,
+    0xFC,0xF5,0x3A,0x3E,0xE1,0xEB,0x22,0xFE,
+    0x11,0xAB,0xCC,0xDF,0x9E,0x1B,0x9F,0xA2,
+    0x6B,0xF5,0xD7,0xB7,0x1B,0x3E,0x1F,0x67,
+    0xEF,0xE8,0xDD,0x46,0x8E,0xBD,0x35,0x23,
+    0x54,0xC7,0xF8,0xD7,0x5B,0xFE,0xB4,0x4C,
+    0x43,0xB8,0x79,0xBB,0xDB,0xB8,0xE7,0xE8,
+    0x6F,0x6E,0xE3,0x9F,0xA2,0xB7,0xF7,0x09,
+    0x7F,0x9E,0xA7,0x4F,0x48,0x79,0xBB,0xDB,
+    0xB8,0xE7,0xE8,0x6F,0x6E,0xE3,0x9F,0xA1,
+    0xFD,0xC1,0xF9,0xEA,0x74,0xF4,0x87,0x9B,
+    0xBD,0xBB,0x8E,0x7E,0x86,0xF6,0xEE,0x39,
+    0xFA,0x1F,0xDC,0x1F,0x9E,0xA7,0x4F,0x48,
+    0x79,0xBB,0xDB,0xB8,0xE7,0xE8,0x6F,0x6E,
+    0xE3,0x9F,0xA1,0xFD,0xC1,0xF9,0xEA,0x74,
+    0xF4,0x87,0x9B,0xBD,0xBB,0x8E,0x7E,0x86,
+    0xF6,0xEE,0x39,0xFA,0x1F,0xDC,0x1F,0x9E,
+    0xA7,0x4F,0x48,0x79,0xBB,0xDB,0xB8,0xE7,
+    0xE8,0x6F,0x6E,0xE3,0x9F,0xA1,0xFD,0xC1,
+    0xF9,0xEA,0x74,0xF4,0x87,0x9B,0xBD,0xBB,
+    0x8E,0x7E,0x86,0xF6,0xEE,0x39,0xFA,0x1F,
+    0xDC,0x1F,0x9E,0xA7,0x4F,0x48,0x79,0xBB,
+    0xDB,0xB8,0xE7,0xE8,0x6F,0x6E,0xE3,0x9F,
+    0xA1,0xFD,0xC1,0xF9,0xEA,0x74,0xF4,0x87,
+    0x9B,0xBD,0xBB,0x8E,0x7E,0x86,0xF6,0xEE,
+    0x39,0xFA,0x1F,0xDC,0x1F,0x9E,0xA7,0x4F,
+    0x48,0x79,0xBB,0xDB,0xB8,0xE7,0xE8,0x6F,
+    0x6E,0xE3,0x9F,0xA1,0xFD,0xC1,0xF9,0xEA,
+    0x74,0xF4,0x87,0x9B,0xBD,0xBB,0x8E,0x7E,
+    0x86,0xF6,0xEE,0x39,0xFA,0x1F,0xDC,0x1F,
+    0x9E,0xA7,0x4E,0xFB,0x9C,0x10,0xE2,0xAB,
+    0xD6,0x9E,0xD6,0xCF,0xFF,0x00,0x1E,0x6E,
+    0x89,0xDE,0x5D,0xD7,0x37,0x44,0xFA,0xDA,
+    0x35,0x6A,0xD7,0x33,0x0C,0xE2,0x85,0x4F,
+    0xAD,0x9D,0xE3,0x83,0x79,0x77,0x5C,0xDD,
+    0x0D,0xE5,0xDD,0x73,0x74,0x6A,0xF1,0x6B,
+    0xE9,0xEF,0x82,0xA7,0x4E,0xF1,0xC1,0xBC,
+    0xBB,0xAE,0x6E,0x86,0xF2,0xEE,0xB9,0xBA,
+    0x1E,0x2D,0x7D,0x1E,0x0A,0x9D,0x3B,0xC7,
+    0x06,0xF2,0xEE,0xB9,0xBA,0x1B,0xCB,0xBA,
+    0xE6,0xE8,0x78,0xB5,0xF4,0x78,0x2A,0x74,
+    0xEF,0x1C,0x1B,0xCB,0xBA,0xE6,0xE8,0x6F,
+    0x2E,0xEB,0x9B,0xA1,0xE2,0xD7,0xD1,0xE0,
+    0xA9,0xD3,0xBC,0x70,0x6F,0x2E,0xEB,0x9B,
+    0xA1,0xBC,0xBB,0xAE,0x6E,0x87,0x8B,0x5F,
+    0x47,0x82,0xA7,0x4E,0xF1,0xC1,0xBC,0xBB,
+    0xAE,0x6E,0x86,0xF2,0xEE,0xB9,0xBA,0x1E,
+    0x2D,0x7D,0x1E,0x0A,0x9D,0x3B,0xC7,0x06,
+    0xF2,0xEE,0xB9,0xBA,0x1B,0xCB,0xBA,0xE6,
+    0xE8,0x78,0xB5,0xF4,0x78,0x2A,0x74,0xEF,
+    0x1C,0x1B,0xCB,0xBA,0xE6,0xE8,0x6F,0x2E,
+    0xEB,0x9B,0xA1,0xE2,0xD7,0xD1,0xE0,0xA9,
+    0xD3,0xBC,0x70,0x6F,0x2E,0xEB,0x9B,0xA1,
+    0xBC,0xBB,0xAE,0x6E,0x87,0x8B,0x5F,0x47,
+    0x82,0xA7,0x4E,0xF1,0xC1,0xBC,0xBB,0xAE,
+    0x6E,0x86,0xF2,0xEE,0xB9,0xBA,0x1E,0x2D,
+    0x7D,0x1E,0x0A,0x9D,0x3B,0xD8,0x5E,0xCE,
+    0x34,0x73,0xEF,0x2E,0xEB,0x9B,0xA2,0x2B,
+    0xF4,0xEF,0x6E,0x76,0xFB,0xBD,0x9F,0xB9,
+    0xD3,0x6D,0xA6,0x74,0x54,0xFE,0xB5,0x6C,
+    0xEB,0xB3,0xD1,0x34,0xEA,0xFF,0x00,0x5A,
+    0xF6,0x6E,0x39,0xBE,0x2F,0xB1,0xE6,0x7C,
+    0x5F,0x63,0xCD,0x4F,0xCB,0xA3,0xB5,0x7F,
+    0x3D,0x3E,0xDD,0x23,0x9B,0xE2,0xFB,0x1E,
+    0x67,0xC5,0xF6,0x3C,0xCF,0x2E,0x8E,0xCF,
+    0x3D,0x3E,0xDD,0x23,0x9B,0xE2,0xFB,0x1E,
+    0x67,0xC5,0xF6,0x3C,0xCF,0x2E,0x8E,0xCF,
+    0x3D,0x3E,0xDD,0x23,0x9B,0xE2,0xFB,0x1E,
+    0x67,0xC5,0xF6,0x3C,0xCF,0x2E,0x8E,0xCF,
+    0x3D,0x3E,0xDD,0x23,0x9B,0xE2,0xFB,0x1E,
+    0x67,0xC5,0xF6,0x3C,0xCF,0x2E,0x8E,0xCF,
+    0x3D,0x3E,0xDD,0x23,0x9B,0xE2,0xFB,0x1E,
+    0x67,0xC5,0xF6,0x3C,0xCF,0x2E,0x8E,0xCF,
+    0x3D,0x3E,0xDD,0x23,0x9B,0xE2,0xFB,0x1E,
+    0x67,0xC5,0xF6,0x3C,0xCF,0x2E,0x8E,0xCF,
+    0x3D,0x3E,0xDD,0x23,0x9B,0xE2,0xFB,0x1E,
+    0x67,0xC5,0xF6,0x3C,0xCF,0x2E,0x8E,0xCF,
+    0x3D,0x3E,0xDD,0x23,0x9B,0xE2,0xFB,0x1E,
+    0x67,0xC5,0xF6,0x3C,0xCF,0x2E,0x8E,0xCF,
+    0x3D,0x3E,0xDD,0x23,0x9B,0xE2,0xFB,0x1E,
+    0x67,0xC5,0xF6,0x3C,0xCF,0x2E,0x8E,0xCF,
+    0x3D,0x3E,0xDD,0x23,0x9B,0xE2,0xFB,0x1E,
+    0x67,0xC5,0xF6,0x3C,0xCF,0x2E,0x8E,0xCF,
+    0x3D,0x3E,0xDA,0xD7,0x94,0xA5,0x95,0x5E,
+    0x91,0xB6,0x76,0xFB,0x1E,0x6F,0x9E,0xFF,
+    0x00,0xB3,0xE6,0x9B,0xAF,0x4C,0xCE,0xA9,
+    0x98,0x67,0x17,0x14,0xFB,0x6C,0x31,0xF7,
+    0xFD,0x9F,0x33,0xDF,0xF6,0x7C,0xD8,0x7F,
+    0x12,0xF7,0xF4,0x53,0xED,0xB0,0xC7,0xDF,
+    0xF6,0x7C,0xCF,0x7F,0xD9,0xF3,0x3F,0x89,
+    0x3F,0x45,0x3E,0xDB,0x0C,0x7D,0xFF,0x00,
+    0x67,0xCC,0xF7,0xFD,0x9F,0x33,0xF8,0x93,
+    0xF4,0x53,0xED,0xB0,0xC7,0xDF,0xF6,0x7C,
+    0xCF,0x7F,0xD9,0xF3,0x3F,0x89,0x3F,0x45,
+    0x3E,0xDB,0x0C,0x7D,0xFF,0x00,0x67,0xCC,
+    0xF7,0xFD,0x9F,0x33,0xF8,0x93,0xF4,0x53,
+    0xED,0xB0,0xC7,0xDF,0xF6,0x7C,0xCF,0x7F,
+    0xD9,0xF3,0x3F,0x89,0x3F,0x45,0x3E,0xDB,
+    0x0C,0x7D,0xFF,0x00,0x67,0xCC,0xF7,0xFD,
+    0x9F,0x33,0xF8,0x93,0xF4,0x53,0xED,0xB0,
+    0xC7,0xDF,0xF6,0x7C,0xCF,0x7F,0xD9,0xF3,
+    0x3F,0x89,0x3F,0x45,0x3E,0xDB,0x0C,0x7D,
+    0xFF,0x00,0x67,0xCC,0xF7,0xFD,0x9F,0x33,
+    0xF8,0x93,0xF4,0x53,0xED,0xB0,0xC7,0xDF,
+    0xF6,0x7C,0xCF,0x7F,0xD9,0xF3,0x3F,0x89,
+    0x3F,0x45,0x3E,0xDB,0x39,0xAB,0xCE,0xAD,
+    0x57,0xEF,0xFB,0x3E,0x6C,0xA6,0xAD,0xB3,
+    0x33,0xB3,0xF1,0x76,0x5A,0x6A,0x8A,0x7A,
+    0xA6,0x75,0x39,0x2E,0xAA,0x69,0xA9,0x11,
+    0x1A,0x65,0xF4,0x7C,0xDA,0x6D,0x50,0xFD,
+    0x14,0xFB,0x71,0x7D,0x4B,0xE8,0xF9,0xB4,
+    0xDA,0x7E,0x8A,0x7D,0x9F,0x52,0xFA,0x3E,
+    0x6D,0x36,0x9F,0xA2,0x9F,0x67,0xD4,0xBE,
+    0x8F,0x9B,0x4D,0xA7,0xE8,0xA7,0xD9,0xF5,
+    0x2F,0xA3,0xE6,0xD3,0x69,0xFA,0x29,0xF6,
+    0x7D,0x4B,0xE8,0xF9,0xB4,0xDA,0x7E,0x8A,
+    0x7D,0x9F,0x52,0xFA,0x3E,0x6D,0x36,0x9F,
+    0xA2,0x9F,0x67,0xD4,0xBE,0x8F,0x9B,0x4D,
+    0xA7,0xE8,0xA7,0xD9,0xF5,0x2F,0xA3,0xE6,
+    0xD3,0x69,0xFA,0x29,0xF6,0x7D,0x4B,0xE8,
+    0xF9,0xB4,0xDA,0x7E,0x8A,0x7D,0x9F,0x52,
+    0xFA,0x3E,0x6D,0x36,0x9F,0xA2,0x9F,0x67,
+    0xD4,0xBE,0x00,0x94,0xCC,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x1B,0xCF,0xA3,0xD1,0x16,0xAC,0xD7,
+    0xEF,0xA3,0x65,0xCA,0xA6,0x9A,0xBE,0x9F,
+    0x4A,0x36,0x6C,0x9F,0xFB,0xF8,0xB6,0xA3,
+    0xD0,0x22,0xE6,0xC9,0xA2,0xBB,0x95,0xC4,
+    0xD3,0x15,0x44,0x53,0x6F,0x6D,0x5F,0x59,
+    0x98,0xFC,0x36,0xFE,0x1F,0x4F,0xF3,0xC6,
+    0x18,0x51,0x7A,0x98,0xB7,0x6A,0xDD,0x76,
+    0xE6,0xAA,0x68,0xAE,0xAA,0xE6,0x22,0xAD,
+    0x9E,0xD6,0xD8,0x8F,0xA7,0xFA,0xFC,0x3C,
+    0xDA,0xD5,0xE9,0x74,0x55,0x55,0x7E,0xD5,
+    0xBA,0xFD,0x9A,0xE6,0x99,0xD9,0xEF,0x22,
+    0x26,0x26,0x36,0xEC,0xD9,0x3B,0x3F,0x0F,
+    0xAF,0xE1,0xB0,0x1F,0x2A,0xF4,0x38,0xA6,
+    0x26,0x99,0xBB,0x13,0x73,0x65,0x55,0x53,
+    0x11,0x1B,0x62,0xA8,0xA6,0x67,0x6C,0xED,
+    0xFF,0x00,0x93,0xFF,0x00,0x8C,0xFE,0x1E,
+    0x68,0x98,0xF7,0xFE,0xD5,0x14,0xCC,0xEC,
+    0x89,0xA6,0x22,0xA9,0x99,0xFA,0x4F,0xF9,
+    0xFF,0x00,0x7F,0x8B,0x4A,0xFD,0x37,0xDB,
+    0xF6,0xAA,0xAA,0xDC,0x7B,0xC9,0x8A,0xE9,
+    0x89,0x89,0xD9,0x11,0x15,0x4C,0xCC,0xFD,
+    0x3F,0xEC,0xFF,0x00,0xE9,0x3E,0x99,0x13,
+    0x55,0xAA,0xBD,0xD7,0xD6,0xD4,0x6C,0xB7,
+    0xFF,0x00,0xD7,0xE1,0x1B,0x3E,0x9B,0x7F,
+    0xCE,0xC9,0xFA,0x83,0xEC,0x7A,0x25,0xB9,
+    0xF4,0x9A,0xAC,0x45,0xFF,0x00,0xAC,0x55,
+    0x14,0x53,0xFF,0x00,0xCF,0xE3,0x3C,0x76,
+    0xFD,0x7E,0x91,0x1F,0xE5,0x15,0xFA,0x2C,
+    0x53,0x6A,0x6A,0xF6,0xF6,0xD7,0x4D,0x14,
+    0xD7,0x55,0x3B,0x3E,0x91,0x13,0xB3,0x67,
+    0xD7,0xFE,0xC7,0xFE,0xBE,0x7A,0x3D,0xEB,
+    0x76,0xA8,0xB9,0x15,0x5B,0xAA,0xAA,0xAB,
+    0x8D,0x9E,0xD5,0x35,0xEC,0x98,0x8E,0x3C,
+    0x27,0xF1,0x7D,0xAF,0xD2,0xA2,0xAB,0x53,
+    0x4F,0xB1,0xB2,0xBA,0xA8,0xA6,0x8A,0xAA,
+    0xDB,0xF4,0x98,0x8D,0x9B,0x3E,0x9F,0xF2,
+    0x3F,0xF0,0x1F,0x29,0xF4,0x5A,0xE7,0xD1,
+    0x67,0xD2,0x36,0x4C,0x53,0xB7,0x66,0x3F,
+    0x4E,0x1C,0x7F,0xEF,0x93,0xE5,0xFB,0x14,
+    0xDB,0xA2,0x8A,0xE8,0xB9,0xED,0xD3,0x54,
+    0xCD,0x3B,0x76,0x6C,0xFA,0xC6,0xCF,0xC3,
+    0xFD,0x7D,0x5F,0x67,0xD2,0x66,0x7D,0x16,
+    0x9F,0x47,0xF6,0x29,0xF6,0x62,0x76,0xCC,
+    0xC4,0x46,0xD9,0xFC,0x78,0xEC,0xFF,0x00,
+    0x6F,0x9E,0x95,0x7A,0x8B,0xD5,0x53,0x36,
+    0xED,0xD5,0x44,0x53,0x1B,0x22,0x99,0xAB,
+    0x6C,0x44,0x7F,0xAF,0xA4,0x03,0x10,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x1A,0x7A,0x3D,0x8B,0x9E,0x93,0x7A,
+    0x9B,0x36,0x69,0xF6,0xAB,0xAB,0x6E,0xC8,
+    0xDB,0x11,0xFE,0xF8,0xBB,0x37,0x1F,0xAC,
+    0xBF,0x4D,0xCF,0x4F,0xF6,0x7A,0x83,0xF3,
+    0x8B,0x1F,0xBB,0xF8,0xCB,0xF6,0x20,0xFC,
+    0x76,0xE3,0xF5,0x97,0xE9,0xB9,0xE9,0xFE,
+    0xCD,0xC7,0xEB,0x2F,0xD3,0x73,0xD3,0xFD,
+    0xBF,0x62,0x03,0xF1,0xDB,0x8F,0xD6,0x5F,
+    0xA6,0xE7,0xA7,0xFB,0x37,0x1F,0xAC,0xBF,
+    0x4D,0xCF,0x4F,0xF6,0xFD,0x88,0x0F,0xC7,
+    0x6E,0x3F,0x59,0x7E,0x9B,0x9E,0x9F,0xEC,
+    0xDC,0x7E,0xB2,0xFD,0x37,0x3D,0x3F,0xDB,
+    0xF6,0x20,0x3F,0x1D,0xB8,0xFD,0x65,0xFA,
+    0x6E,0x7A,0x7F,0xB3,0x71,0xFA,0xCB,0xF4,
+    0xDC,0xF4,0xFF,0x00,0x6F,0xD8,0x80,0xFC,
+    0x76,0xE3,0xF5,0x97,0xE9,0xB9,0xE9,0xFE,
+    0xCD,0xC7,0xEB,0x2F,0xD3,0x73,0xD3,0xFD,
+    0xBF,0x62,0x03,0xF9,0xF0,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x0F,0x43,0xD4,0x1F,0x9C,
+    0x58,0xFD,0xDF,0xC6,0x5F,0xB1,0x7E,0x3B,
+    0xD4,0x1F,0x9C,0x58,0xFD,0xDF,0xC6,0x5F,
+    0xB1,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x7F,0x3E,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x01,0xE8,0x7A,0x83,0xF3,0x8B,0x1F,
+    0xBB,0xF8,0xCB,0xF6,0x2F,0xC7,0x7A,0x83,
+    0xF3,0x8B,0x1F,0xBB,0xF8,0xCB,0xF6,0x20,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,
+    0xE7,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x3D,0x0F,0x50,0x7E,0x71,0x63,0xF7,0x7F,
+    0x19,0x7E,0xC5,0xF8,0xEF,0x50,0x7E,0x71,
+    0x63,0xF7,0x7F,0x19,0x7E,0xC4,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x01,0xFC,0xF8,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xA1,
+    0xEA,0x0F,0xCE,0x2C,0x7E,0xEF,0xE3,0x2F,
+    0xD8,0xBF,0x1D,0xEA,0x0F,0xCE,0x2C,0x7E,
+    0xEF,0xE3,0x2F,0xD8,0x80,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x3F,0x9F,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0xF4,0x3D,0x41,
+    0xF9,0xC5,0x8F,0xDD,0xFC,0x65,0xFB,0x17,
+    0xE3,0xBD,0x41,0xF9,0xC5,0x8F,0xDD,0xFC,
+    0x65,0xFB,0x10,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x07,0xFF,0xD9
+};
+
+/* 640 x 480 H.264 test stream: colour bars with the frame number burned in (tools/fx3_uvc_h26x_frames.py).
+ * One GOP of 16 Annex B access units, IDR first; profile_idc 66, constraint flags 0xC0, level_idc 31.
+ * Encoded at 300000 bits/s, average slice QP of the P pictures 1.
+ * Access units of 211 to 1757 bytes, 7512 bytes in all. */
+const uint32_t glVidFrameLenH264_640x480[16] = {
+    1757, 244, 474, 611, 399, 451, 308, 613,
+    332, 383, 237, 424, 244, 373, 451, 211
+};
+
+const uint8_t glUVCVidFramesH264_640x480[] __attribute__ ((aligned (32))) =
+{
+    /* Access unit 1 (IDR) */
+    0x00,0x00,0x00,0x01,0x67,0x42,0xC0,0x1F,
+    0xDA,0x02,0x80,0xF6,0x84,0x00,0x00,0x03,
+    0x00,0x04,0x00,0x00,0x03,0x00,0x7A,0x3C,
+    0x60,0xCA,0x80,0x00,0x00,0x00,0x01,0x68,
+    0xCE,0x32,0xC8,0x00,0x00,0x01,0x65,0x88,
+    0x84,0x04,0x7C,0x98,0xA0,0x00,0x27,0x51,
+    0x27,0x27,0x27,0x27,0xFE,0x1F,0xF8,0x2C,
+    0x04,0x80,0xAF,0x4C,0xFE,0x20,0x00,0x08,
+    0x02,0x00,0x2C,0x41,0x2C,0x1C,0x20,0xD0,
+    0x83,0x84,0x1A,0x11,0x5C,0x56,0x22,0x1F,
+    0x14,0x01,0x8E,0x31,0xC0,0x06,0x4E,0x4E,
+    0x4E,0x4F,0xE1,0xFF,0xF0,0x56,0x08,0xA0,
+    0xD2,0x68,0x38,0x80,0x00,0x20,0x1E,0x00,
+    0x02,0x02,0x51,0x00,0x00,0x40,0x20,0x00,
+    0x04,0x02,0x60,0x70,0x11,0x8B,0xB9,0x87,
+    0x01,0x18,0xBB,0x98,0x1C,0x22,0x91,0x73,
+    0x0E,0x11,0x48,0xB9,0x88,0x82,0x31,0x40,
+    0x00,0xCD,0x1F,0x27,0x27,0x27,0x27,0xE1,
+    0xFF,0xF8,0x2B,0x0E,0x03,0x49,0xA0,0xF8,
+    0x80,0x01,0x00,0x01,0x03,0x98,0xD0,0x00,
+    0x21,0x03,0x81,0x18,0xAB,0x98,0x70,0x23,
+    0x15,0x73,0x1F,0xB9,0xAF,0xB9,0x92,0x08,
+    0xC5,0x00,0x02,0x12,0x72,0x72,0x7F,0xF0,
+    0xFF,0x82,0xC0,0x4D,0x03,0x28,0x34,0xCE,
+    0x20,0x00,0x19,0x02,0x44,0x00,0x03,0xE0,
+    0x36,0x0E,0x10,0x3C,0x20,0xE1,0x03,0xC2,
+    0x0E,0x04,0x03,0xC2,0x0E,0x04,0x03,0xC0,
+    0x44,0x13,0x9E,0x00,0x02,0x07,0x71,0xCC,
+    0x70,0x00,0x21,0x27,0x27,0x27,0x27,0xFE,
+    0x1F,0xF8,0x2C,0x04,0x80,0xA4,0x69,0x9C,
+    0xF1,0x00,0x00,0x40,0x50,0x00,0x16,0x20,
+    0x2D,0x81,0xE2,0x25,0xC8,0x78,0x89,0x72,
+    0xF7,0x11,0x0F,0x8A,0x00,0xC7,0x18,0xE0,
+    0x03,0x27,0x27,0x27,0x27,0x19,0x04,0x00,
+    0x38,0x01,0x11,0x80,0xB4,0xC1,0x00,0x00,
+    0x40,0x04,0x00,0x04,0x0A,0xA2,0x00,0x01,
+    0xC0,0x00,0x10,0x1D,0x83,0x80,0x40,0x2B,
+    0x18,0x38,0x04,0x02,0xB1,0x07,0x01,0x01,
+    0x18,0xC1,0xC0,0x40,0x46,0x22,0x20,0x9C,
+    0x50,0x00,0x23,0x1C,0xC7,0x19,0x39,0x39,
+    0x39,0x3A,0xEB,0xAE,0xBA,0xE9,0x82,0x42,
+    0xF4,0xC1,0x2D,0x75,0xD7,0x5D,0x30,0x50,
+    0xE9,0x82,0x9A,0xEB,0xAE,0xB8,0xA6,0x08,
+    0x95,0x7F,0x77,0xA8,0x23,0xAE,0xBA,0xE9,
+    0xE9,0xEB,0xAE,0xBA,0xE9,0xE9,0xEB,0xAE,
+    0xBA,0xE9,0xE9,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xA7,0xA7,0xAE,0xBA,0xEB,0xA7,
+    0xA7,0xAE,0xBA,0xEB,0xA7,0xAE,0xBA,0xEB,
+    0xA7,0xA7,0xAE,0xBA,0xEB,0xA7,0xA7,0xAE,
+    0xBA,0xEB,0xA7,0xA7,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0x9E,0x9E,0xBA,0xEB,0xAE,
+    0x9E,0x9E,0xBA,0xEB,0xAE,0x9E,0xBA,0xEB,
+    0xAE,0x9E,0x9E,0xBA,0xEB,0xAE,0x9E,0x9E,
+    0xBA,0xEB,0xAE,0x9E,0x9E,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0x7A,0x7A,0xEB,0xAE,
+    0xBA,0x7A,0x7A,0xEB,0xAE,0xBA,0x7A,0xEB,
+    0xAE,0xBA,0x7A,0x7A,0xEB,0xAE,0xBA,0x7A,
+    0x7A,0xEB,0xAE,0xBA,0x7A,0x7A,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xE9,0xE9,0xEB,0xAE,
+    0xBA,0xE9,0xE9,0xEB,0xAE,0xBA,0xE9,0xEB,
+    0xAE,0xBA,0xE9,0xE9,0xEB,0xAE,0xBA,0xE9,
+    0xE9,0xEB,0xAE,0xBA,0xE9,0xE9,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xA7,0xA7,0xAE,
+    0xBA,0xEB,0xA7,0xA7,0xAE,0xBA,0xEB,0xA7,
+    0xAE,0xBA,0xEB,0xA7,0xA7,0xAE,0xBA,0xEB,
+    0xA7,0xA7,0xAE,0xBA,0xEB,0xA7,0xA7,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0x9E,0x9E,
+    0xBA,0xEB,0xAE,0x9E,0x9E,0xBA,0xEB,0xAE,
+    0x9E,0xBA,0xEB,0xAE,0x9E,0x9E,0xBA,0xEB,
+    0xAE,0x9E,0x9E,0xBA,0xEB,0xAE,0x9E,0x9E,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0x7A,
+    0x7A,0xEB,0xAE,0xBA,0x7A,0x7A,0xEB,0xAE,
+    0xBA,0x7A,0xEB,0xAE,0xBA,0x7A,0x7A,0xEB,
+    0xAE,0xBA,0x7A,0x7A,0xEB,0xAE,0xBA,0x7A,
+    0x7A,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xE9,
+    0xE9,0xEB,0xAE,0xBA,0xE9,0xE9,0xEB,0xAE,
+    0xBA,0xE9,0xEB,0xAE,0xBA,0xE9,0xE9,0xEB,
+    0xAE,0xBA,0xE9,0xE9,0xEB,0xAE,0xBA,0xE9,
+    0xE9,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xA7,0xA7,0xAE,0xBA,0xEB,0xA7,0xA7,0xAE,
+    0xBA,0xEB,0xA7,0xAE,0xBA,0xEB,0xA7,0xA7,
+    0xAE,0xBA,0xEB,0xA7,0xA7,0xAE,0xBA,0xEB,
+    0xA7,0xA7,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0x9E,0x9E,0xBA,0xEB,0xAE,0x9E,0x9E,
+    0xBA,0xEB,0xAE,0x9E,0xBA,0xEB,0xAE,0x9E,
+    0x9E,0xBA,0xEB,0xAE,0x9E,0x9E,0xBA,0xEB,
+    0xAE,0x9E,0x9E,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0x7A,0x7A,0xEB,0xAE,0xBA,0x7A,
+    0x7A,0xEB,0xAE,0xBA,0x7A,0xEB,0xAE,0xBA,
+    0x7A,0x7A,0xEB,0xAE,0xBA,0x7A,0x7A,0xEB,
+    0xAE,0xBA,0x7A,0x7A,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xE9,0xE9,0xEB,0xAE,0xBA,0xE9,
+    0xE9,0xEB,0xAE,0xBA,0xE9,0xEB,0xAE,0xBA,
+    0xE9,0xE9,0xEB,0xAE,0xBA,0xE9,0xE9,0xEB,
+    0xAE,0xBA,0xE9,0xE9,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xA7,0xA7,0xAE,0xBA,0xEB,
+    0xA7,0xA7,0xAE,0xBA,0xEB,0xA7,0xAE,0xBA,
+    0xEB,0xA7,0xA7,0xAE,0xBA,0xEB,0xA7,0xA7,
+    0xAE,0xBA,0xEB,0xA7,0xA7,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0x9E,0x9E,0xBA,0xEB,
+    0xAE,0x9E,0x9E,0xBA,0xEB,0xAE,0x9E,0xBA,
+    0xEB,0xAE,0x9E,0x9E,0xBA,0xEB,0xAE,0x9E,
+    0x9E,0xBA,0xEB,0xAE,0x9E,0x9E,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0x7A,0x7A,0xEB,
+    0xAE,0xBA,0x7A,0x7A,0xEB,0xAE,0xBA,0x7A,
+    0xEB,0xAE,0xBA,0x7A,0x7A,0xEB,0xAE,0xBA,
+    0x7A,0x7A,0xEB,0xAE,0xBA,0x7A,0x7A,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xE9,0xE9,0xEB,
+    0xAE,0xBA,0xE9,0xE9,0xEB,0xAE,0xBA,0xE9,
+    0xEB,0xAE,0xBA,0xE9,0xE9,0xEB,0xAE,0xBA,
+    0xE9,0xE9,0xEB,0xAE,0xBA,0xE9,0xE9,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xA7,0xA7,
+    0xAE,0xBA,0xEB,0xA7,0xA7,0xAE,0xBA,0xEB,
+    0xA7,0xAE,0xBA,0xEB,0xA7,0xA7,0xAE,0xBA,
+    0xEB,0xA7,0xA7,0xAE,0xBA,0xEB,0xA7,0xA7,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0x9E,
+    0x9E,0xBA,0xEB,0xAE,0x9E,0x9E,0xBA,0xEB,
+    0xAE,0x9E,0xBA,0xEB,0xAE,0x9E,0x9E,0xBA,
+    0xEB,0xAE,0x9E,0x9E,0xBA,0xEB,0xAE,0x9E,
+    0x9E,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0x7A,0x7A,0xEB,0xAE,0xBA,0x7A,0x7A,0xEB,
+    0xAE,0xBA,0x7A,0xEB,0xAE,0xBA,0x7A,0x7A,
+    0xEB,0xAE,0xBA,0x7A,0x7A,0xEB,0xAE,0xBA,
+    0x7A,0x7A,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xE9,0xE9,0xEB,0xAE,0xBA,0xE9,0xE9,0xEB,
+    0xAE,0xBA,0xE9,0xEB,0xAE,0xBA,0xE9,0xE9,
+    0xEB,0xAE,0xBA,0xE9,0xE9,0xEB,0xAE,0xBA,
+    0xE9,0xE9,0xEB,0xAE,0xBA,0xEA,0x0B,0x01,
+    0xC0,0x00,0x41,0x30,0x00,0x04,0x0C,0x71,
+    0xF7,0xDF,0x7F,0xE1,0xC7,0x80,0x70,0x55,
+    0x08,0x99,0x93,0x07,0x81,0x43,0xBE,0x75,
+    0xC7,0xB5,0xB5,0xB5,0xB5,0xE1,0xF8,0x86,
+    0x01,0xC1,0x54,0x42,0x4C,0x22,0x19,0xD0,
+    0x0E,0x09,0x87,0xB9,0xF0,0x39,0x0C,0x4B,
+    0x9F,0x6B,0x6B,0x6B,0x6B,0x6B,0x87,0xF0,
+    0x0C,0x03,0x82,0xA2,0x81,0xC0,0x04,0x79,
+    0x08,0x0B,0xB9,0x80,0xE1,0x30,0x97,0x3E,
+    0x1D,0x79,0xBA,0xFD,0x7E,0x9D,0x66,0x49,
+    0xD7,0xD3,0xAE,0xA7,0x5F,0x7F,0x0C,0x7C,
+    0x38,0x2A,0x80,0x70,0x0C,0xC1,0xC2,0x0F,
+    0x0C,0xBA,0x0E,0x04,0x05,0x81,0xF7,0x16,
+    0xA0,0xEB,0xC3,0x23,0x2F,0x36,0x9B,0x49,
+    0xAC,0xD6,0xB6,0xB6,0xB6,0xBF,0x87,0x1E,
+    0x01,0xC1,0x54,0x03,0x84,0x02,0x43,0x1E,
+    0x07,0x90,0xAE,0x73,0x69,0xB4,0x9A,0xCD,
+    0x3A,0xE3,0x16,0xB6,0xB6,0xB6,0xBC,0x3F,
+    0x10,0xC0,0x38,0x2A,0x84,0x80,0x41,0xA4,
+    0x24,0x6E,0xA0,0xE0,0x40,0x56,0x0D,0xB2,
+    0x68,0x38,0x20,0x46,0x39,0xD1,0x7E,0xB5,
+    0xB5,0xB5,0xB5,0xA8,0x25,0xAF,0xFF,0x98,
+    0x28,0xB8,0x61,0x50,0x54,0x00,0x13,0x48,
+    0x86,0xCB,0x61,0x4F,0x60,0x6E,0x91,0xA8,
+    0xD1,0x77,0xFF,0x6D,0x06,0x66,0xC8,0x12,
+    0x88,0x1B,0xB2,0xC6,0x1C,0xD7,0x06,0x5E,
+    0xED,0x48,0xC0,0x86,0xC2,0xB9,0x08,0x3D,
+    0xEA,0x4C,0x2D,0xFE,0x01,0x31,0x69,0x0D,
+    0x9E,0xE2,0x9D,0x60,0x36,0x9A,0x22,0x20,
+    0x29,0x26,0x7A,0x7B,0xED,0x4B,0x2F,0x9A,
+    0x9E,0xEF,0x77,0xFF,0xD0,0x49,0x9E,0x18,
+    0x57,0xBC,0x07,0x5B,0x2A,0x43,0x6F,0xF7,
+    0xC6,0x89,0x3C,0xEF,0x21,0xBC,0x30,0xE6,
+    0x02,0x45,0x44,0x56,0xEE,0xA1,0xC3,0xD9,
+    0xBE,0x97,0xA4,0xFE,0x00,0x1D,0x36,0x9D,
+    0x8A,0x7C,0xCA,0x50,0xA5,0x71,0xE2,0x84,
+    0x74,0x67,0x2B,0xBF,0xAF,0xB5,0x9B,0xFB,
+    0x0C,0xA8,0x35,0x25,0x55,0xFE,0xF6,0xA4,
+    0x84,0x87,0x8D,0x85,0x8A,0xDC,0xF3,0xFE,
+    0xBC,0x36,0x85,0x74,0x3C,0x0B,0xF3,0xE9,
+    0xE2,0x3E,0xB6,0x01,0x11,0xC9,0x8D,0x5E,
+    0x42,0x1F,0xD6,0x90,0x92,0x20,0x48,0xD3,
+    0x6B,0xDF,0x74,0xE3,0xE9,0x4E,0x6E,0xF7,
+    0xF0,0xC0,0x03,0x92,0xE7,0x20,0xFA,0xAF,
+    0x1A,0xFF,0xBC,0x19,0x05,0x00,0xAA,0x3F,
+    0xD0,0x67,0xFE,0x7B,0xFE,0x26,0x10,0xE8,
+    0x10,0x14,0x05,0x47,0xBF,0x41,0x69,0x0B,
+    0x4F,0xFF,0xF7,0xBF,0x3C,0xD9,0x8C,0x83,
+    0x4E,0xC2,0xB0,0x4A,0x64,0x34,0x81,0x3D,
+    0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,
+    0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,
+    0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,
+    0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,0x2D,
+    0x2D,0x75,0xEA,0xF9,0xAF,0xFF,0x09,0x02,
+    0x40,0x23,0xBF,0x17,0xF7,0xD2,0x1A,0xB4,
+    0xFF,0x1D,0xFB,0xF0,0x3F,0xD2,0xC8,0x25,
+    0xB0,0xEC,0x59,0xA4,0xFE,0xFF,0x8F,0xFC,
+    0xB7,0xB0,0x88,0x8D,0xFE,0xDF,0xF7,0x1D,
+    0x03,0xFF,0x84,0xBE,0x59,0x13,0x38,0x6A,
+    0x9C,0xBB,0x3E,0x81,0xF3,0xC7,0x56,0x3F,
+    0x8B,0xD0,0xFF,0xDD,0xE9,0xA3,0x5C,0xD5,
+    0xFD,0x84,0xC6,0xF6,0x52,0x9C,0x2F,0xB6,
+    0x0C,0x3B,0xAF,0x28,0x7F,0xC2,0x5E,0xC6,
+    0xA5,0x49,0x29,0x2D,0x76,0x17,0xDD,0x04,
+    0xC4,0x1E,0xE7,0xF0,0xFF,0xC0,0xC4,0xA4,
+    0x8A,0xE2,0xBE,0xFD,0xF8,0xB7,0xFF,0xF0,
+    0xF1,0x43,0x00,0x04,0x89,0x44,0x48,0x5A,
+    0x44,0x4D,0x24,0x35,0x04,0x35,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x77,0xDF,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xFC,0x7F,0xFE,0x1E,
+    0x05,0x98,0xA0,0x00,0x20,0x45,0xBE,0xFF,
+    0x1F,0x0F,0xF9,0x14,0x16,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0x8A,0x00,0x04,0x2F,0xBE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBC,
+
+    /* Access unit 2 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0x20,0x12,
+    0xF1,0xB0,0x87,0xFF,0xFE,0x11,0x9B,0x54,
+    0xD3,0xFC,0x12,0x78,0x28,0xF0,0x51,0xE0,
+    0xA3,0xC1,0x47,0x82,0x8F,0x05,0x1E,0x0A,
+    0x3C,0x14,0x78,0x28,0xF0,0x51,0xE0,0xA3,
+    0xC1,0x47,0x82,0x8F,0x05,0x1E,0x0A,0x3C,
+    0x14,0x78,0x28,0xF0,0x51,0xE0,0xA3,0xC1,
+    0x47,0x82,0x2E,0x70,0x48,0xC4,0xBA,0x5D,
+    0x6E,0xBF,0x84,0x17,0xDD,0xA6,0xBE,0x31,
+    0x71,0x63,0x17,0x96,0x31,0x71,0x57,0x3D,
+    0x7D,0xB6,0xCF,0xAF,0xD0,0x87,0x45,0x70,
+    0x10,0xE6,0xE0,0x8B,0xC6,0x7C,0xE6,0xFF,
+    0xAB,0x37,0xA0,0x41,0x00,0x0B,0x43,0xEA,
+    0x9C,0x84,0x65,0xA5,0xA7,0xF7,0xFE,0x06,
+    0xB7,0x81,0x75,0x52,0x0B,0xA9,0xA7,0x3F,
+    0xFF,0x76,0x02,0xE4,0x9B,0x72,0x16,0x48,
+    0xA5,0x5F,0xFD,0x83,0x37,0x37,0xEB,0x4B,
+    0x7F,0xFF,0xEB,0x3F,0x38,0x27,0x48,0xBC,
+    0x9A,0xCD,0xC1,0x09,0x8D,0xFF,0xFF,0x87,
+    0x81,0x27,0x54,0xCC,0x4E,0xF9,0xF9,0x8D,
+    0x48,0xEB,0xF4,0x8B,0x78,0x90,0x88,0x90,
+    0x61,0x9F,0xC1,0x47,0x87,0x0F,0x04,0xB9,
+    0xFC,0xDF,0x8E,0x1F,0xC3,0xC0,0xB3,0x81,
+    0xC0,0x20,0x14,0x31,0x06,0x08,0x78,0x8F,
+    0x11,0xE6,0xFF,0x0F,0xF0,0xF7,0x07,0x00,
+    0x40,0x22,0x99,0xBC,0x38,0x78,0x2D,0xCF,
+    0xE7,0x82,0xC3,0x78,0x98,0x2D,0xC4,0x78,
+    0x8F,0x3C,0x15,0x39,0xBC,0x38,0x78,0x2B,
+    0xCF,0xE7,0xF3,0xF9,0xFC,0xFE,0x7E,0x6F,
+    0x0E,0x1F,0xCF,0xE7,0xF3,0xF9,0xFC,0xFE,
+    0x7E,0x6F,0x0E,0x40,
+
+    /* Access unit 3 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0x40,0x16,
+    0xF3,0xF3,0x99,0x22,0xF2,0x6B,0x37,0x89,
+    0x5C,0x4A,0xE2,0x57,0x12,0xB5,0xCF,0x22,
+    0x49,0xAC,0xDF,0xE2,0x57,0x12,0xB8,0x95,
+    0x9F,0x82,0x70,0x41,0x7B,0xDE,0xED,0x3F,
+    0x38,0x21,0x22,0x49,0xAC,0xDF,0xE2,0x57,
+    0x12,0xB8,0x95,0xC4,0xAC,0x22,0x79,0xE3,
+    0x05,0xB0,0x4D,0x78,0xC1,0x6E,0x18,0x53,
+    0x37,0x87,0x05,0xBD,0xA3,0x05,0xBD,0xA1,
+    0xC1,0x6F,0x78,0xC1,0x6F,0x78,0x70,0x5B,
+    0xDA,0x30,0x5B,0xDA,0x1C,0x16,0xF7,0x8C,
+    0x16,0xF7,0x87,0x05,0xBD,0xA3,0x05,0xBD,
+    0xA1,0xC1,0x6F,0x78,0xC1,0x6F,0x78,0x70,
+    0x5B,0xDA,0x30,0x5B,0xDA,0x1C,0x16,0xF7,
+    0x8C,0x16,0xF7,0x87,0x05,0xBD,0xA3,0x05,
+    0xBD,0xA1,0xC1,0x6F,0x78,0xC1,0x6F,0x78,
+    0x70,0x5B,0xDA,0x30,0x5B,0xDA,0x1C,0x16,
+    0xF7,0x8C,0x16,0xF7,0x87,0x05,0xBD,0xA3,
+    0x05,0xBD,0xA1,0xC1,0x6F,0x78,0xC1,0x6F,
+    0x78,0x70,0x5B,0xDA,0x30,0x5B,0xDA,0x1C,
+    0x16,0xF7,0x8C,0x16,0xF7,0x87,0x05,0xBD,
+    0xA3,0x05,0xBD,0xA1,0xC1,0x6F,0x78,0xC1,
+    0x6F,0x78,0x70,0x5B,0xDA,0x30,0x5B,0xDA,
+    0x30,0xEC,0x13,0xE7,0xF3,0xF9,0xFC,0xFC,
+    0x41,0xFA,0x3F,0x42,0xD8,0x26,0xBE,0x76,
+    0x09,0xE2,0xC5,0xB0,0x4D,0x78,0xBE,0x8C,
+    0xC7,0xD7,0xBE,0xB1,0x50,0x85,0x55,0xCF,
+    0x63,0xF2,0xEC,0xFA,0x82,0x0A,0xED,0xF4,
+    0x92,0xE2,0x15,0x62,0x15,0xE2,0x15,0x7C,
+    0xE5,0x59,0x76,0x7D,0xF8,0x41,0x79,0x32,
+    0xFD,0x24,0xA2,0x17,0x10,0xB8,0x85,0xF8,
+    0x6B,0x7B,0xD4,0xBB,0x3E,0xFF,0xCF,0x69,
+    0xB4,0xDA,0x4D,0x66,0xFC,0x20,0xA7,0xCE,
+    0xFE,0xD3,0x51,0x0B,0x88,0x5C,0x42,0xFC,
+    0xFE,0x9B,0x64,0xDF,0xFA,0xB7,0xD5,0xBE,
+    0xAD,0xF5,0x6F,0xAB,0x7D,0x7E,0x61,0x04,
+    0x57,0xC9,0x12,0x09,0x04,0x82,0x41,0x7C,
+    0x42,0xBC,0x42,0xBC,0x42,0xBC,0x42,0xBB,
+    0xE2,0xCC,0x60,0x32,0x41,0xB8,0x3C,0x99,
+    0x80,0x6F,0x0C,0x25,0x93,0xE2,0xF0,0xFC,
+    0x45,0xBD,0x37,0x8F,0x6E,0x6B,0x68,0xF7,
+    0x8B,0x94,0xFD,0x13,0x10,0x9E,0x59,0x3A,
+    0x45,0xAF,0xF5,0x29,0x40,0x02,0xCE,0xB6,
+    0xD2,0x96,0xA2,0xE9,0x6F,0xF8,0x0C,0xB5,
+    0x23,0x32,0x63,0xD6,0xCF,0xEF,0x80,0x13,
+    0xAA,0x21,0x15,0x44,0xB9,0xAB,0x13,0xAB,
+    0x29,0x1F,0x11,0x00,0x20,0xC6,0x54,0x73,
+    0x04,0xA7,0x58,0x77,0xCB,0x79,0xC1,0x3A,
+    0x75,0xE7,0xD3,0xEF,0x3F,0x5C,0xF3,0xA4,
+    0xFA,0x7D,0xFC,0x82,0x17,0x3A,0xE2,0x17,
+    0x3A,0xCE,0x75,0xCE,0xB9,0xD7,0x3A,0xE7,
+    0x58,0xE3,0xF5,0xC4,0x02,0x47,0x64,0x5E,
+    0xE5,0xC0,0x27,0xBF,0x74,0x17,0x49,0xDD,
+    0x45,0xFA,0x4F,0xAA,0x44,0x5B,0x31,0x64,
+    0x3F,0x7F,0xFF,0xB7,0x11,0x2F,0xC8,0x96,
+    0x7F,0xFF,0xFE,0xFF,0x02,0x69,0xE0,0x97,
+    0x3F,0xC0,0x27,0x3A,0x11,0x05,0x8B,0x11,
+    0xF0,0x09,0xCE,0x08,0x8F,0x05,0xB2,0x1F,
+    0x82,0x43,0xF2,0x1F,0x82,0x43,0xF2,0x1F,
+    0x82,0x28,
+
+    /* Access unit 4 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0x60,0x19,
+    0xF1,0x8F,0x02,0x04,0x48,0x26,0xBD,0xEF,
+    0x7F,0xFF,0xF1,0x28,0x10,0xE2,0x57,0x78,
+    0x3C,0x82,0x60,0xE5,0x6B,0x5A,0xD7,0xFF,
+    0xFC,0x4C,0x11,0xCF,0xCE,0x09,0x1D,0xF9,
+    0xA1,0x1E,0xB8,0x67,0x06,0x00,0x48,0xFF,
+    0xFF,0xFF,0xE3,0x07,0xBD,0x7C,0xAC,0x4A,
+    0xC4,0xFE,0x4E,0x09,0xF4,0xE9,0xD3,0xA6,
+    0xD3,0x06,0xDC,0xBF,0xDE,0xFF,0x7B,0xD9,
+    0xA1,0xD0,0xFE,0x67,0xEA,0xD0,0x89,0xDE,
+    0x7F,0x20,0xF7,0xBF,0xE8,0xA8,0x8C,0x3D,
+    0xEE,0xDE,0xFE,0x67,0xF0,0x89,0xDE,0x7F,
+    0x21,0xDE,0x61,0x6F,0x64,0xCF,0xD5,0xA1,
+    0x13,0xBC,0xFE,0x43,0xBC,0xC2,0xDE,0xE9,
+    0x9F,0xC2,0x27,0x79,0xFC,0x87,0x79,0x85,
+    0xBD,0x93,0x3F,0x56,0x84,0x4E,0xF3,0xF9,
+    0x0E,0xF3,0x0B,0x7B,0xA6,0x7F,0x08,0x9D,
+    0xE7,0xF2,0x1D,0xE6,0x16,0xF6,0x4C,0xFD,
+    0x5A,0x11,0x3B,0xCF,0xE4,0x3B,0xCC,0x2D,
+    0xEE,0x99,0xFC,0x22,0x77,0x9F,0xC8,0x77,
+    0x98,0x5B,0xD9,0x33,0xF5,0x68,0x44,0xEF,
+    0x3F,0x90,0xEF,0x30,0xB7,0xBA,0x67,0xF0,
+    0x89,0xDE,0x7F,0x21,0xDE,0x61,0x6F,0x64,
+    0xCF,0xD5,0xA1,0x13,0xBC,0xFE,0x43,0xBC,
+    0xC2,0xDE,0xE9,0x9F,0xC2,0x27,0x79,0xFC,
+    0x87,0x79,0x85,0xBD,0x93,0x3F,0x56,0x84,
+    0x4E,0xF3,0xF9,0x0E,0xF3,0x0B,0x7B,0xA6,
+    0x7F,0x08,0x9D,0xE7,0xF2,0x1D,0xE6,0x16,
+    0xF6,0x4C,0xFD,0x5A,0x11,0x3B,0xCF,0xE4,
+    0x3B,0xCC,0x2D,0xEE,0x99,0xFC,0x22,0x77,
+    0x9F,0xC8,0x77,0x98,0x5B,0xD9,0x33,0xF5,
+    0x68,0x44,0xEF,0x3F,0x90,0xEF,0x30,0xB7,
+    0xBA,0x67,0xF0,0x89,0xDE,0x7F,0x21,0xDE,
+    0x61,0x6F,0x64,0xCF,0xD5,0xA1,0x13,0xBC,
+    0xFE,0x43,0xBC,0xC2,0xDE,0xE9,0x9F,0xC2,
+    0x27,0x79,0xFC,0x87,0x79,0x85,0xBD,0x93,
+    0x75,0x6C,0xEC,0x12,0xE7,0xF3,0xF9,0xFC,
+    0xFC,0xDC,0xE0,0xA8,0xC4,0xE1,0x2E,0xC3,
+    0x71,0xFC,0x20,0xA4,0xC3,0xA8,0x8E,0xCB,
+    0x5B,0x2F,0xA1,0x50,0xBC,0xBC,0xFF,0x4B,
+    0xB3,0xEC,0x6E,0x9F,0xF5,0x64,0xDE,0x4E,
+    0x1A,0xC8,0xBC,0x8B,0xFD,0xF9,0x51,0xCF,
+    0x4F,0x39,0x4A,0xBF,0x90,0xD1,0x0D,0x34,
+    0xD3,0x4D,0x17,0x9E,0xEF,0x86,0x74,0x34,
+    0xE3,0x4D,0x34,0xD1,0x97,0x09,0x1E,0x06,
+    0x7B,0x01,0xDC,0x08,0x81,0x1B,0x7E,0x0F,
+    0x2D,0x36,0xC2,0x0D,0xCC,0x47,0x17,0x04,
+    0x2D,0x9A,0xB8,0x27,0xFC,0x06,0xC1,0x96,
+    0xB5,0xF6,0x50,0x78,0x12,0x3E,0xD3,0xB8,
+    0x11,0x6B,0xF7,0xFF,0xCC,0x63,0x6A,0xB7,
+    0xC5,0xD2,0xDB,0xF6,0x5F,0x6B,0xC5,0x93,
+    0x50,0x88,0x40,0xC0,0x5B,0x76,0x0B,0x68,
+    0x05,0x56,0x12,0x54,0x84,0x74,0xB0,0xFE,
+    0xF5,0x0B,0xF8,0xB9,0x9B,0x83,0xF3,0x18,
+    0xE1,0xFF,0xAB,0x32,0xF5,0xDD,0xCC,0xB8,
+    0x61,0x16,0xA9,0xE9,0xA4,0x40,0x5B,0x37,
+    0xF8,0x3B,0x07,0xC1,0x01,0x40,0x06,0x6C,
+    0x4C,0x9C,0xA7,0x52,0x09,0xCB,0x5A,0x34,
+    0x04,0x32,0x88,0x90,0x99,0x15,0x4D,0x14,
+    0xD2,0x0B,0x67,0xE7,0x80,0xD8,0x16,0x0E,
+    0x24,0x65,0xA3,0xEA,0xE5,0x96,0xA5,0xFD,
+    0x00,0x0A,0x05,0x5A,0x04,0x5E,0x48,0xD5,
+    0x3E,0xFE,0x1E,0xE3,0xF9,0xBC,0x51,0xD0,
+    0x27,0x8E,0xE2,0x01,0x21,0xB6,0x9D,0x59,
+    0x44,0x56,0x78,0x9A,0xCF,0xEF,0xDB,0xE8,
+    0x74,0xFF,0xD6,0x02,0x16,0x22,0x81,0x2D,
+    0x5F,0xC8,0x7A,0x58,0xEE,0x67,0xCD,0x96,
+    0xFF,0x88,0xF4,0xD1,0x45,0xA1,0xF9,0xB7,
+    0x83,0xBF,0x34,0xA3,0xFF,0xF0,0xF1,0x41,
+    0x78,0x0C,0xA0,0xA1,0x29,0xD3,0x10,0x22,
+    0xDB,0xB7,0xC4,0x33,0xFF,0xFE,0x19,0xFC,
+    0xDE,0x08,0xBC,0xDE,0x1A,0x3C,0x10,0xE7,
+    0xF3,0xFC,0x02,0x73,0xE0,0x20,0x78,0x8F,
+    0x11,0xD7,0x9B,0xC3,0x47,0xF3,0xF2,0x1F,
+    0xCF,0xD7,0x9B,0xC3,0x47,0xE5,0x3F,0x9F,
+    0xAF,0x37,0x86,0x8F,0xCA,0x7F,0x3F,0x5E,
+    0x6F,0x0B,0x40,
+
+    /* Access unit 5 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0x80,0x1A,
+    0xF3,0x31,0xB1,0x8C,0x50,0x22,0x77,0x77,
+    0x77,0x77,0x19,0xCF,0x2D,0xF1,0x5D,0xE5,
+    0xE2,0xB3,0x33,0x33,0x33,0x33,0x33,0x23,
+    0x30,0x20,0x1E,0xA6,0x63,0x5F,0xFF,0xFF,
+    0xFF,0xCC,0x3D,0xEB,0xF6,0x56,0x41,0xD1,
+    0xEF,0x4B,0xF7,0xBC,0x59,0xDE,0x1D,0x3B,
+    0xC5,0x9D,0xE1,0xD3,0xBC,0x59,0xDE,0x1D,
+    0x3B,0xC5,0x9D,0xE1,0xD3,0xBC,0x59,0xDE,
+    0x1D,0x3B,0xC5,0x9D,0xE1,0xD3,0xBC,0x59,
+    0xDE,0x1D,0x3B,0xC5,0x9D,0xE1,0xD3,0xBC,
+    0x59,0xDE,0x1D,0x3B,0xC5,0x9D,0xE1,0xD3,
+    0xBC,0x59,0xDE,0x1D,0x3B,0xC5,0x9D,0xE1,
+    0xD3,0xBC,0x59,0xDE,0x1D,0x3B,0xC5,0x9D,
+    0xE1,0xD3,0xBC,0x59,0xDE,0x1D,0x3B,0xC5,
+    0x9D,0xE1,0xD3,0xBC,0x59,0xDE,0x1D,0x3B,
+    0xC5,0x9D,0xE1,0xD3,0xBC,0x59,0xDE,0x1D,
+    0x3B,0xC5,0x9D,0xE0,0xBB,0x9C,0xDB,0xCC,
+    0x39,0x2A,0xB2,0x6F,0x9B,0x9F,0x9D,0x09,
+    0x19,0x1A,0xBF,0xE3,0xF0,0xAF,0x34,0xE3,
+    0x4E,0x34,0x5E,0x08,0xB7,0xB9,0x13,0x80,
+    0x80,0x9C,0xB1,0xFE,0x33,0x2D,0x4C,0xB8,
+    0x14,0x0A,0x21,0x71,0x0B,0x88,0x5C,0x42,
+    0xFD,0xDD,0xDD,0xE1,0x05,0x3E,0x11,0x0F,
+    0x25,0xD2,0xE9,0xF5,0xFA,0x92,0x5C,0x20,
+    0xB5,0x61,0x30,0xBF,0xC4,0x2E,0x21,0x71,
+    0x0B,0xF1,0x1B,0xBB,0x4E,0xED,0x34,0x27,
+    0x8B,0x21,0xD0,0xDC,0xE5,0x4C,0x5C,0x84,
+    0xD6,0xBA,0x2F,0xC5,0xE5,0x2E,0x50,0x4B,
+    0x53,0x94,0xA9,0x80,0xCB,0x4B,0xA9,0xBF,
+    0xC5,0xC0,0xFD,0x05,0x4A,0x00,0x0F,0x86,
+    0xCC,0x02,0x68,0x85,0x20,0x4D,0x14,0xBC,
+    0xBB,0xF7,0x47,0x00,0x30,0x1C,0x9A,0xDA,
+    0x80,0xD5,0x6D,0xDB,0x90,0x00,0x8B,0xC5,
+    0xF7,0xD6,0xA8,0x49,0x02,0x1F,0x43,0xBC,
+    0x42,0x08,0x29,0x8A,0xC5,0x6C,0x1D,0x47,
+    0x32,0xE1,0xA6,0x83,0x82,0xC1,0x41,0x8C,
+    0xC7,0xFF,0xF0,0x91,0x78,0x94,0x40,0x81,
+    0xCE,0x0D,0x85,0xAF,0xF2,0x08,0x4B,0xFF,
+    0xF7,0x84,0x46,0x43,0x18,0x86,0x69,0x90,
+    0x9A,0x40,0xC3,0x07,0xE0,0x52,0x3C,0x10,
+    0xE7,0xF3,0x7F,0x1F,0x0F,0x0F,0x82,0xAC,
+    0x0E,0x00,0x07,0x80,0x00,0x40,0x9C,0x00,
+    0x14,0x83,0x42,0x3C,0x47,0x9B,0x11,0xF8,
+    0x7F,0x09,0xF8,0x38,0x00,0x1F,0x00,0x01,
+    0x02,0x65,0x37,0xB1,0x02,0x23,0xC1,0x5E,
+    0x7F,0x3C,0x15,0x17,0xA3,0xC1,0x5E,0x7F,
+    0x3C,0x15,0x17,0x82,0x23,0xC1,0x5E,0x7F,
+    0x3F,0x47,0xF3,0xF9,0xF8,0x22,0x3F,0x9F,
+    0xCF,0xD1,0xFC,0xFE,0x7E,0x1B,0x80,
+
+    /* Access unit 6 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0xA0,0x1A,
+    0xF3,0x73,0x87,0x97,0xE2,0xA5,0x15,0x23,
+    0x73,0x91,0x7C,0xAC,0x6F,0x37,0x39,0xD4,
+    0x90,0xC9,0x0F,0x8B,0xE1,0x7B,0x69,0xB6,
+    0x9B,0x69,0xB7,0xF3,0x03,0xFE,0xE4,0x3F,
+    0xEE,0x29,0xDE,0xB8,0x74,0x7B,0xAA,0x79,
+    0x18,0x91,0x8B,0x2B,0x28,0xB3,0x78,0x7F,
+    0xF6,0x0B,0x28,0x7D,0x7E,0x57,0xCA,0xF8,
+    0x74,0xEE,0xA2,0xCE,0xE5,0xE1,0xD3,0xBA,
+    0x8B,0x3B,0x97,0x87,0x4E,0xEA,0x2C,0xEE,
+    0x5E,0x1D,0x3B,0xA8,0xB3,0xB9,0x78,0x74,
+    0xEE,0xA2,0xCE,0xE5,0xE1,0xD3,0xBA,0x8B,
+    0x3B,0x97,0x87,0x4E,0xEA,0x2C,0xEE,0x5E,
+    0x1D,0x3B,0xA8,0xB3,0xB9,0x78,0x74,0xEE,
+    0xA2,0xCE,0xE5,0xE1,0xD3,0xBA,0x8B,0x3B,
+    0x97,0x87,0x4E,0xEA,0x2C,0xEE,0x5E,0x1D,
+    0x3B,0xA8,0xB3,0xB9,0x78,0x74,0xEE,0xA2,
+    0xCE,0xE5,0xE1,0xD3,0xBA,0x8B,0x3B,0x97,
+    0x87,0x4E,0xEA,0x2C,0xEE,0x5E,0x1D,0x3B,
+    0xA8,0xB3,0xB9,0x78,0x74,0xEE,0xA2,0xCE,
+    0xE5,0xE1,0xD3,0xBA,0x8B,0x3B,0x97,0x87,
+    0x4E,0xEA,0x2C,0xEE,0x5E,0x1D,0x3B,0xA8,
+    0xB3,0xB9,0x78,0x47,0xA1,0x45,0xCA,0x18,
+    0xB7,0xC6,0x2D,0xA8,0x20,0xA5,0xC7,0x8F,
+    0x4B,0x5D,0x2D,0xC6,0x5C,0x64,0xBA,0x5D,
+    0xFD,0x5B,0x08,0x29,0xF3,0x27,0x46,0xD3,
+    0x6E,0xC2,0x61,0x30,0x98,0x51,0x8B,0xEC,
+    0x62,0xEB,0x18,0xBE,0xC6,0x2E,0xA6,0xE7,
+    0xB9,0x95,0x1C,0x7C,0xD0,0x73,0x46,0x2A,
+    0x63,0x4F,0x2C,0x6E,0x72,0xBF,0xE5,0xC6,
+    0xF3,0x9B,0xFD,0xC7,0xF4,0x0A,0x8A,0xE4,
+    0x86,0x88,0x69,0xAA,0x9A,0x68,0xFA,0xFD,
+    0x84,0x16,0xBA,0x49,0x7C,0x20,0xB5,0xDA,
+    0x6B,0xE1,0x05,0xAE,0x92,0x5F,0x08,0x2D,
+    0x76,0x9A,0xF7,0xCA,0x63,0x07,0x59,0xD7,
+    0xC5,0xCA,0x07,0x28,0x30,0x39,0x3F,0x0E,
+    0x1E,0x8A,0xC0,0x9E,0xFE,0x4D,0x02,0x3A,
+    0x3E,0x2E,0x9E,0xFF,0x1F,0x20,0x36,0x5A,
+    0x9F,0x18,0x0D,0xEC,0xB0,0x00,0xB2,0x1D,
+    0x2E,0xF5,0x6A,0x17,0x0D,0x74,0xD7,0xF7,
+    0xF0,0x04,0x06,0x3F,0x9D,0xB8,0xA8,0x29,
+    0x7A,0xBA,0x2C,0x83,0x38,0x01,0xF1,0x92,
+    0xA9,0x29,0xE1,0xEB,0xDA,0x13,0x51,0x4F,
+    0xF6,0x92,0x09,0x4D,0x19,0x6C,0xDA,0x4F,
+    0xDC,0x12,0x3A,0x04,0xB0,0x9F,0x10,0x1E,
+    0x0F,0x41,0xFF,0x68,0x7F,0x53,0x0B,0x07,
+    0xD5,0xFF,0xE2,0x3B,0x81,0xC1,0x07,0xA7,
+    0xDD,0xF6,0x02,0x27,0xD9,0xFA,0xE0,0x40,
+    0x7A,0x24,0xED,0x1B,0xF7,0x69,0xAD,0xFD,
+    0x4C,0x30,0x73,0xE0,0x54,0x3C,0x3F,0x9F,
+    0xCF,0xE6,0xE3,0xE1,0xFE,0x1E,0x04,0xD8,
+    0x0E,0x00,0x02,0x01,0x20,0x00,0x20,0x0E,
+    0x00,0x68,0x00,0x71,0x32,0xE2,0x3C,0x47,
+    0xC0,0x27,0x38,0x22,0x3C,0x13,0xE7,0xF3,
+    0xF9,0xE0,0x88,0x7E,0x93,0xC1,0x1C,0x12,
+    0x1F,0xCF,0xE7,0xF3,0xF0,0x4A,0x7F,0x3F,
+    0x9F,0x87,0x60,
+
+    /* Access unit 7 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0xC0,0x1A,
+    0xF0,0xBF,0x38,0x79,0xFE,0xE2,0xC9,0xC5,
+    0x90,0xCC,0x20,0xA4,0x91,0xFF,0xFF,0xFF,
+    0xC2,0xE3,0xDF,0x2D,0x15,0x17,0x8C,0xF0,
+    0x51,0xE0,0xA3,0xC1,0x47,0x82,0x8F,0x05,
+    0x1E,0x0A,0x3C,0x14,0x78,0x28,0xF0,0x51,
+    0xE0,0xA3,0xC1,0x47,0x82,0x8F,0x05,0x1E,
+    0x0A,0x3C,0x14,0x78,0x28,0xF0,0x51,0xE0,
+    0xA3,0xC1,0x40,0xB7,0x92,0x82,0x9F,0x15,
+    0xC1,0x11,0xAB,0x57,0x50,0x85,0xA8,0x08,
+    0x1D,0x17,0xF0,0x20,0x49,0xC3,0x35,0xAE,
+    0x08,0x7F,0x54,0xDA,0x3D,0xF5,0xD6,0xAB,
+    0xAD,0x57,0x39,0x4A,0xD1,0xE9,0xF4,0x24,
+    0x9B,0xF3,0xCE,0x7C,0x20,0xB7,0xFE,0x6D,
+    0x36,0xC6,0x2D,0x3A,0x8C,0x5A,0x45,0x18,
+    0xB4,0xE8,0xFC,0xF5,0x41,0x17,0x6D,0xF9,
+    0x8B,0xFF,0xC4,0x1F,0x04,0xC1,0xF8,0xEB,
+    0x91,0x26,0x58,0x67,0x3D,0xEC,0x24,0xD0,
+    0x8E,0x2F,0x28,0x54,0xC1,0x65,0x22,0xE8,
+    0x26,0xE3,0xB9,0x52,0xB9,0x7E,0xC1,0x4F,
+    0x17,0x45,0x15,0x2B,0xC4,0x9A,0x07,0x70,
+    0x3C,0x95,0x67,0x08,0xA0,0x9F,0x17,0x87,
+    0x5D,0xC9,0xC0,0x0F,0x87,0xE0,0xB9,0x66,
+    0x6F,0xFA,0x33,0x61,0x40,0x82,0x00,0x38,
+    0x83,0x76,0xB8,0x60,0xFE,0xD4,0xCF,0x7D,
+    0xEC,0x7E,0xDE,0xBF,0x43,0x01,0xBC,0xA0,
+    0xF2,0xA4,0xEE,0xBC,0x66,0x6E,0x21,0x02,
+    0x4F,0x1E,0x00,0x02,0x00,0x83,0x9E,0x8B,
+    0x44,0x59,0x4A,0xB9,0x5C,0x7A,0x92,0x22,
+    0x42,0x49,0x32,0x4B,0xC1,0x3F,0x10,0x73,
+    0x83,0xCC,0x57,0x82,0x4F,0x0E,0x1F,0xC1,
+    0x83,0x2F,0x80,0x08,0x1C,0x20,0xC1,0x5C,
+    0xAD,0xF3,0xE4,0x0A,0xAA,0x50,0xF7,0xCA,
+    0x06,0x1C,0x0A,0xE7,0x85,0xF3,0xFB,0x00,
+    0xA4,0xFC,0x47,0x88,0xF1,0x1E,0x6C,0x43,
+    0xFF,0xE4,0x04,0x47,0xE9,0xFE,0x7F,0x3F,
+    0x9F,0xCF,0xC1,0x11,0xFA,0x7F,0x9F,0xCF,
+    0xE7,0xF3,0xF0,0x44,0x7E,0x9F,0xE7,0xF3,
+    0xF9,0xFC,0xFC,0x2D,
+
+    /* Access unit 8 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0xE0,0x1A,
+    0xF0,0x97,0x0B,0x06,0x16,0xB5,0xAD,0x48,
+    0xC6,0x46,0x3E,0x2F,0x85,0xE5,0x62,0xCA,
+    0xC5,0x95,0x8B,0x2B,0x11,0xAF,0x95,0xF4,
+    0x65,0x7E,0x11,0x62,0x79,0xEB,0xF3,0x42,
+    0x68,0x0C,0xE2,0x6B,0x5A,0xD6,0x2C,0xDE,
+    0x01,0xFF,0xB0,0x59,0x23,0x3E,0xBF,0x5A,
+    0x9B,0xA2,0x12,0x8B,0x1E,0xCB,0x5B,0xDF,
+    0xC6,0x04,0xDC,0x3E,0xA6,0x3D,0xFE,0xF7,
+    0xF8,0xB1,0xEF,0x5F,0xBD,0xCD,0xD1,0x09,
+    0x45,0x8F,0x65,0xAD,0x6B,0xE3,0x0E,0xF2,
+    0x86,0xD9,0x3F,0x2B,0xE5,0x7F,0xCA,0xF9,
+    0x5F,0x26,0xD1,0x51,0x56,0xA3,0x3A,0x92,
+    0x8B,0x1E,0xCB,0x5B,0xDF,0xC6,0x1D,0xE5,
+    0x3B,0xCC,0x6F,0x00,0xFF,0xD8,0x2C,0x97,
+    0xF5,0xFA,0xD4,0xDD,0x10,0x94,0x58,0xF6,
+    0x5A,0xD6,0xBE,0x30,0xEF,0x29,0xDE,0x61,
+    0xEF,0x5F,0xBD,0xCD,0xD1,0x09,0x45,0x8F,
+    0x65,0xAD,0xEF,0xE3,0x0E,0xF2,0x9D,0xE6,
+    0x1E,0xF5,0xFA,0xD4,0xDD,0x10,0x94,0x58,
+    0xF6,0x5A,0xD6,0xBE,0x30,0xEF,0x29,0xDE,
+    0x61,0xEF,0x5F,0xBD,0xCD,0xD1,0x09,0x45,
+    0x8F,0x65,0xAD,0xEF,0xE3,0x0E,0xF2,0x9D,
+    0xE6,0x1E,0xF5,0xFA,0xD4,0xDD,0x10,0x94,
+    0x58,0xF6,0x5A,0xD6,0xBE,0x30,0xEF,0x29,
+    0xDE,0x61,0xEF,0x5F,0xBD,0xCD,0xD1,0x09,
+    0x45,0x8F,0x65,0xAD,0xEF,0xE3,0x0E,0xF2,
+    0x9D,0xE6,0x1E,0xF5,0xFA,0xD4,0xDD,0x10,
+    0x94,0x58,0xF6,0x5A,0xD6,0xBE,0x30,0xEF,
+    0x29,0xDE,0x61,0xEF,0x5F,0xBD,0xCD,0xD1,
+    0x09,0x45,0x8F,0x65,0xAD,0xEF,0xE3,0x0E,
+    0xF2,0x9D,0xE6,0x1E,0xF5,0xFA,0xD4,0xDD,
+    0x10,0x94,0x58,0xF6,0x5A,0xD6,0xBE,0x30,
+    0xEF,0x29,0xDE,0x61,0xEF,0x5F,0xBD,0xCD,
+    0xD1,0x09,0x45,0x8F,0x65,0xAD,0xEF,0xE3,
+    0x0E,0xF2,0x9D,0xE6,0x1E,0xF5,0xFA,0xD4,
+    0xDD,0x10,0x94,0x58,0xF6,0x5A,0xD6,0xBE,
+    0x30,0xEF,0x29,0xDE,0x61,0xEF,0x5F,0xBD,
+    0xCD,0xD1,0x09,0x45,0x8F,0x65,0xAD,0xEF,
+    0xE3,0x0E,0xF2,0x9D,0xE6,0x1E,0xF5,0xFA,
+    0xD4,0xDD,0x10,0x94,0x58,0xF6,0x5A,0xD6,
+    0xBE,0x30,0xEF,0x29,0xDE,0x61,0xEF,0x5F,
+    0xBD,0xCD,0xD1,0x09,0x45,0x8F,0x65,0xAD,
+    0xEF,0xE3,0x0E,0xF2,0x9D,0xE6,0x1E,0xF5,
+    0xFA,0xD4,0xDD,0x10,0x94,0x58,0xF6,0x5A,
+    0xD6,0xBE,0x30,0xEF,0x29,0xDE,0x61,0xEF,
+    0x5F,0xBD,0xCD,0xD1,0x09,0x45,0x8F,0x65,
+    0xAD,0xEF,0xE3,0x0E,0xF2,0x9D,0xE6,0x1E,
+    0xF5,0xFA,0xD4,0xDD,0x10,0xF4,0x58,0xF6,
+    0x5A,0xD6,0xBE,0x30,0xEF,0x16,0x3D,0xEB,
+    0xF7,0xB8,0x47,0x86,0x84,0x1B,0xCD,0xEF,
+    0x87,0x3B,0x4B,0x8F,0xCF,0x0A,0x9B,0x9E,
+    0xEF,0x87,0xF6,0xAE,0xB6,0x10,0x5F,0x9C,
+    0xEA,0x76,0x90,0xD0,0xC0,0xB9,0xC9,0x38,
+    0xF8,0x77,0xC5,0x9B,0xFC,0x4C,0x3F,0x04,
+    0x10,0x00,0x70,0x00,0x37,0x00,0x06,0x40,
+    0x04,0x5C,0xB0,0xC3,0x32,0xD6,0x68,0xAC,
+    0xB5,0x9E,0xE0,0x00,0x60,0x02,0x80,0x8B,
+    0x19,0x5D,0x12,0xC3,0x7D,0xC7,0xEC,0xAC,
+    0x1A,0x6F,0x60,0x08,0x00,0x30,0x0C,0x59,
+    0x7F,0x04,0x7A,0x49,0xA1,0x8A,0x25,0xCE,
+    0x51,0x73,0x00,0x01,0x00,0x40,0x00,0x20,
+    0x32,0x52,0x68,0x20,0xD1,0xA7,0x96,0x51,
+    0x44,0xB0,0x25,0xEF,0x1F,0x98,0xFE,0x22,
+    0x6E,0xF9,0xAB,0xD1,0x8C,0xBF,0xFF,0x87,
+    0xBC,0x22,0x40,0x08,0x02,0x84,0x0C,0xC9,
+    0x45,0x3A,0xB4,0xD2,0x48,0xF7,0x82,0x19,
+    0x58,0x41,0x0C,0x2B,0xA2,0x90,0xEE,0xA8,
+    0x0C,0x30,0x2C,0x9E,0x1B,0xCF,0xE6,0xFF,
+    0xF8,0x70,0xF8,0x7B,0x81,0xC0,0x00,0x40,
+    0x80,0x00,0x04,0x22,0xC0,0x00,0x41,0x71,
+    0x02,0x11,0xE2,0x3C,0xD8,0xF1,0x0F,0x0F,
+    0x0A,0x13,0x07,0x00,0x01,0x01,0x30,0x00,
+    0x10,0x5E,0x53,0x4F,0x82,0x23,0xC1,0x1E,
+    0x7F,0x80,0x4C,0x74,0x7F,0x3F,0x9F,0x82,
+    0x23,0xF2,0x1F,0xCF,0xE7,0xE0,0x88,0xFC,
+    0x87,0xF3,0xF9,0xF8,0x52,
+
+    /* Access unit 9 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x00,0x1A,
+    0xF0,0x97,0x0B,0x05,0x0F,0xF3,0xF9,0xFC,
+    0xFE,0xFF,0x10,0xBF,0x3C,0x22,0xF9,0x09,
+    0x5A,0x85,0xC2,0x6E,0x1E,0xA6,0x56,0xBF,
+    0x5A,0xF9,0xB8,0x92,0x9F,0xCF,0xE7,0xF3,
+    0xF8,0x47,0xA3,0x1E,0x87,0x0E,0xF1,0x9D,
+    0x4F,0x41,0x47,0x53,0xD0,0x51,0xD4,0xF4,
+    0x14,0x75,0x3D,0x05,0x1D,0x4F,0x41,0x47,
+    0x53,0xD0,0x51,0xD4,0xF4,0x14,0x75,0x3D,
+    0x05,0x1D,0x4F,0x41,0x47,0x53,0xD0,0x51,
+    0xD4,0xF4,0x14,0x75,0x3D,0x05,0x1D,0x4F,
+    0x41,0x47,0x53,0xD0,0x51,0xD4,0xF4,0x14,
+    0x75,0x3D,0x05,0x1D,0x4F,0x41,0x47,0x53,
+    0xD0,0x51,0xD4,0x94,0x38,0x77,0x8C,0x1E,
+    0xF3,0xD6,0x3B,0x1F,0xC6,0x74,0x44,0xE8,
+    0xBC,0xF9,0x89,0xC5,0xA0,0x4F,0xBF,0xAE,
+    0x3C,0xA3,0xB2,0xDC,0xDD,0x52,0x12,0xAC,
+    0xB3,0xE0,0xB0,0x83,0xAC,0x2A,0xC2,0x79,
+    0x2F,0x37,0x21,0x4F,0xD3,0x3F,0x8C,0x72,
+    0x84,0x71,0x70,0xDD,0xDA,0x31,0x71,0x2C,
+    0x84,0xE1,0xD7,0x1E,0x3A,0xEF,0x5D,0xE0,
+    0x2A,0x84,0x71,0x7A,0xB2,0x0E,0xDC,0x47,
+    0x93,0x3C,0x5C,0x7C,0x1E,0x57,0x11,0xA5,
+    0x4D,0x5F,0x88,0x80,0xF3,0x01,0x52,0x41,
+    0x5F,0x5D,0x96,0x00,0x04,0x0D,0xD9,0x01,
+    0x8D,0xF7,0xA1,0xD3,0x0F,0xFF,0xE0,0x1F,
+    0xF9,0xB4,0x13,0x0C,0xED,0x4B,0xF6,0xF7,
+    0x80,0x30,0x28,0x2C,0x55,0xFB,0xE5,0x26,
+    0x99,0xE5,0xC3,0xAB,0xF5,0x97,0xFF,0x66,
+    0x40,0x00,0x10,0x1F,0xA6,0xAD,0x20,0x03,
+    0xD3,0xFA,0x7B,0xC4,0xAC,0x09,0x79,0x27,
+    0x05,0x2A,0x07,0x6F,0xEC,0xAF,0x3A,0xF0,
+    0x3C,0xAB,0xF8,0x8A,0xF2,0xA5,0x24,0x1F,
+    0xFF,0xCD,0x5C,0x1F,0x2B,0xFB,0xC6,0x5A,
+    0x9F,0x7D,0xFE,0xDA,0x88,0x6E,0x2E,0x12,
+    0xD2,0xDA,0xD3,0x76,0xBF,0xC0,0xB6,0x78,
+    0x5F,0x3F,0x9F,0xE0,0x13,0x9E,0x23,0xC4,
+    0x78,0x8F,0x37,0xF8,0x7F,0x84,0xC3,0x58,
+    0x0E,0x00,0x02,0x06,0x80,0x00,0x20,0x94,
+    0x00,0x02,0x06,0x40,0x17,0x4C,0xEE,0xB0,
+    0x42,0x78,0x6F,0x3F,0x33,0xF8,0x21,0x3F,
+    0x05,0x07,0xE1,0x88,
+
+    /* Access unit 10 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x20,0x1A,
+    0xF3,0x31,0x31,0x13,0x85,0x17,0xE6,0x84,
+    0xD0,0x37,0x12,0x4A,0xD6,0xB5,0x08,0xF2,
+    0x6F,0x70,0x5D,0xD4,0x94,0x22,0x77,0x85,
+    0xFA,0x92,0x84,0x4E,0xF0,0x88,0xF7,0xAF,
+    0xD6,0xA6,0xEA,0x4A,0x11,0x3B,0xC2,0xFD,
+    0x49,0x42,0x27,0x78,0x5F,0xA9,0x28,0x44,
+    0xEF,0x0B,0xF5,0x25,0x08,0x9D,0xE1,0x7E,
+    0xA4,0xA1,0x13,0xBC,0x2F,0xD4,0x94,0x22,
+    0x77,0x85,0xFA,0x92,0x84,0x4E,0xF0,0xBF,
+    0x52,0x50,0x89,0xDE,0x17,0xEA,0x4A,0x11,
+    0x3B,0xC2,0xFD,0x49,0x42,0x27,0x78,0x5F,
+    0xA9,0x28,0x44,0xEF,0x0B,0xF5,0x25,0x08,
+    0x9D,0xE1,0x7E,0xA4,0xA1,0x13,0xBC,0x2F,
+    0xD4,0x94,0x22,0x77,0x85,0xFA,0x92,0x84,
+    0x4E,0xF0,0xBF,0x52,0x50,0x89,0xDE,0x17,
+    0xEA,0x4A,0x11,0x3B,0xC1,0x41,0xDE,0x09,
+    0x04,0x2E,0x21,0x71,0x0B,0x88,0x5A,0xE7,
+    0xA4,0x5E,0x9A,0x63,0x92,0xD6,0x4B,0x84,
+    0x17,0xDD,0xB6,0xF7,0x19,0x31,0x98,0x85,
+    0xC4,0x2E,0x21,0x7E,0x19,0xBD,0xF0,0xC8,
+    0x69,0x17,0xE7,0x43,0x79,0x9A,0x63,0x18,
+    0x1D,0x91,0xD1,0x41,0x05,0xE4,0xEB,0x69,
+    0xA4,0xD3,0xD0,0x41,0x79,0x3A,0xDA,0x69,
+    0x34,0xFF,0x3D,0xBE,0x3D,0x36,0x89,0x7C,
+    0x4E,0x32,0xD1,0x93,0xF3,0xD4,0x54,0x21,
+    0x50,0x98,0x4C,0x2F,0x2F,0x3D,0xDF,0x28,
+    0x68,0xD8,0x53,0xBC,0x20,0x8B,0x32,0x32,
+    0x2E,0x97,0x53,0x8F,0x6D,0xB1,0x46,0xFF,
+    0xA8,0x61,0xC2,0xA6,0x00,0x04,0x00,0x01,
+    0x00,0x60,0x0F,0xE2,0x73,0x54,0x86,0xB6,
+    0xC2,0x29,0x1D,0xDA,0xFF,0x5F,0x00,0x62,
+    0x9F,0xCB,0x0D,0x66,0x60,0x57,0x60,0xD2,
+    0x3C,0xB8,0x39,0x2E,0x76,0x35,0x40,0x31,
+    0xAA,0x21,0x0B,0x7B,0x88,0x19,0x57,0x18,
+    0x24,0x59,0xA9,0x22,0xAF,0xC0,0x20,0x0C,
+    0x1B,0x62,0x0F,0x8B,0xAF,0x7B,0x76,0x84,
+    0x46,0xFD,0xE2,0xE8,0x3F,0x03,0xC0,0x60,
+    0x27,0x37,0xAA,0x48,0x62,0x64,0xF8,0xBD,
+    0xA8,0x18,0x28,0x30,0x86,0xBF,0xFE,0x12,
+    0x38,0x7E,0x01,0x00,0x82,0x08,0x1C,0x20,
+    0xE0,0xA3,0xAE,0x16,0x11,0x2C,0x74,0xD1,
+    0x64,0x3D,0x04,0x0F,0xCE,0x24,0x02,0x95,
+    0x51,0x91,0x43,0xC4,0x44,0xD4,0xFD,0x7F,
+    0xC0,0xBC,0x78,0x57,0x3F,0xC0,0x27,0x3A,
+    0x11,0xE2,0x3D,0x80,0x52,0x7C,0x11,0x1F,
+    0x90,0xFD,0x1F,0x82,0x23,0xF2,0x1F,0xA3,
+    0xF0,0x44,0x7E,0x43,0xF4,0x7E,0x3E,
+
+    /* Access unit 11 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x40,0x1A,
+    0xF1,0x9C,0x48,0x5A,0x5F,0x2F,0x97,0xCB,
+    0xC2,0x3C,0x51,0x64,0x62,0x46,0x24,0x62,
+    0xE6,0xE7,0x22,0x2F,0xF8,0xCD,0x3B,0x80,
+    0x35,0x36,0x7F,0x37,0x39,0x1C,0x7D,0x30,
+    0xD2,0xEF,0xD0,0x8E,0x10,0x5E,0x5D,0xA6,
+    0xB6,0x9A,0x42,0x16,0x23,0x9C,0xB8,0x63,
+    0xF1,0x82,0xC2,0xFC,0xDC,0x17,0xF2,0x53,
+    0x3D,0xF9,0x53,0x32,0x32,0x9A,0xFD,0x73,
+    0x94,0x89,0x2E,0x97,0x4A,0x69,0xA6,0xBE,
+    0x21,0x71,0x0B,0x88,0x5B,0xE5,0x33,0x16,
+    0x69,0x78,0xBB,0x47,0x4F,0x98,0x0C,0x44,
+    0x6B,0x5C,0x91,0x7F,0xF1,0x07,0x17,0x80,
+    0x03,0x32,0x00,0x03,0x2E,0xA4,0x00,0x08,
+    0x10,0x26,0xFE,0x76,0x04,0x0D,0x7E,0xB3,
+    0x02,0x22,0x71,0x4B,0x00,0x40,0x0B,0xED,
+    0x46,0x61,0xA3,0xBF,0x80,0x20,0x00,0xC1,
+    0xA1,0x13,0x0A,0x3B,0x40,0x8C,0x4C,0x83,
+    0x33,0xEC,0xAD,0x29,0x81,0xD8,0xF0,0x04,
+    0x2D,0x6D,0x8A,0x84,0x77,0x03,0xFE,0xEB,
+    0xC1,0x2F,0x09,0x14,0xEE,0x38,0xF5,0x31,
+    0x7E,0xF8,0x82,0xFF,0x47,0xB4,0xEC,0xB6,
+    0xB8,0x7E,0x00,0x01,0x38,0x00,0x60,0x0C,
+    0xE8,0xAA,0xD3,0x5C,0x5A,0x5A,0x2D,0x49,
+    0x5F,0x53,0x47,0x0C,0x38,0x18,0x0F,0x08,
+    0xE7,0xF3,0xFC,0x02,0x63,0xC4,0x78,0x8F,
+    0x36,0x3E,0x3F,0x0E,0x1F,0x0E,0x70,0x70,
+    0x00,0x10,0x2B,0x00,0x01,0x0A,0x45,0x20,
+    0x88,0xF0,0xEE,0x7E,0x58,0x04,0xC7,0x04,
+    0x47,0xE0,0xA0,0xFC,0x27,
+
+    /* Access unit 12 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x60,0x1A,
+    0xF0,0x97,0x38,0xEE,0x91,0xF9,0x1F,0xC7,
+    0xF4,0xCB,0xCE,0x69,0x5C,0xB0,0x76,0xC3,
+    0xC1,0x1F,0x39,0xCF,0x48,0xF9,0x1F,0xF9,
+    0x79,0xCD,0x57,0xB7,0x7F,0x04,0x67,0x67,
+    0x94,0x36,0xCD,0xF9,0x58,0x95,0x8F,0x95,
+    0x89,0x58,0x77,0xCC,0xF3,0xBC,0xCF,0x7B,
+    0xC1,0x19,0xD9,0xE5,0x3B,0xC2,0xE1,0xB7,
+    0x0D,0xD3,0x3C,0xAF,0x95,0xFF,0x2B,0xE5,
+    0x7C,0xB6,0x78,0x4F,0x0F,0x18,0x77,0x94,
+    0xEF,0x0B,0x9D,0xE3,0x0E,0xF2,0x9D,0xE1,
+    0x73,0xBC,0x61,0xDE,0x53,0xBC,0x2E,0x77,
+    0x8C,0x3B,0xCA,0x77,0x85,0xCE,0xF1,0x87,
+    0x79,0x4E,0xF0,0xB9,0xDE,0x30,0xEF,0x29,
+    0xDE,0x17,0x3B,0xC6,0x1D,0xE5,0x3B,0xC2,
+    0xE7,0x78,0xC3,0xBC,0xA7,0x78,0x5C,0xEF,
+    0x18,0x77,0x94,0xEF,0x0B,0x9D,0xE3,0x0E,
+    0xF2,0x9D,0xE1,0x73,0xBC,0x61,0xDE,0x53,
+    0xBC,0x2E,0x77,0x8C,0x3B,0xCA,0x77,0x85,
+    0xCE,0xF1,0x87,0x79,0x4E,0xF0,0xB9,0xDE,
+    0x30,0xEF,0x29,0xDE,0x17,0x3B,0xC6,0x1D,
+    0xE5,0x3B,0xC2,0xE7,0x78,0xC3,0xBC,0xA7,
+    0x78,0x5C,0xEF,0x18,0x77,0x94,0xEF,0x0B,
+    0x9D,0xE3,0x0E,0xF2,0x9D,0xE1,0x7E,0x71,
+    0x4B,0x0F,0xCF,0x66,0xA1,0xDB,0xCD,0xDE,
+    0xF7,0x37,0x75,0xAC,0xDC,0xE5,0xF1,0x16,
+    0x10,0xB0,0x85,0x84,0x2C,0x21,0x61,0x0B,
+    0x0B,0x88,0x5C,0x42,0xE2,0x17,0x10,0xB6,
+    0x10,0x59,0x95,0xDB,0x6F,0x4D,0x3F,0x3E,
+    0xB8,0xA8,0x42,0xA1,0x7C,0x20,0xB6,0xFE,
+    0x9A,0x71,0x0B,0xBC,0x90,0xCF,0x92,0x8D,
+    0xF1,0xD5,0xDD,0x48,0x8E,0x2E,0x36,0x16,
+    0x3A,0xB1,0x3F,0x78,0xD8,0x41,0xD6,0x7F,
+    0xC5,0xC8,0x0D,0x3D,0x1E,0x15,0x70,0x06,
+    0x45,0x05,0x01,0xB4,0x3D,0xE2,0xEA,0x34,
+    0x03,0x69,0xA0,0xDA,0xDB,0x81,0x60,0xE0,
+    0xD0,0x7A,0xE6,0x19,0x5F,0xC5,0xE8,0x80,
+    0x04,0xB2,0x60,0xDC,0x82,0x52,0xDA,0xAF,
+    0x17,0x49,0x80,0xA8,0x00,0x23,0x80,0x00,
+    0x81,0xB0,0xB1,0x77,0xF7,0x02,0x72,0x48,
+    0xB5,0xC2,0x66,0x9A,0x9F,0xFE,0x0F,0xC0,
+    0x00,0x10,0x39,0x7A,0x00,0x18,0x00,0x08,
+    0xAC,0x6D,0x10,0x00,0x64,0x64,0x5B,0x83,
+    0x05,0xB2,0x70,0x60,0x97,0x90,0xB1,0xBC,
+    0x0F,0xF8,0xEB,0xC2,0xC9,0xEA,0x2A,0x29,
+    0x32,0x70,0x5D,0x3E,0x35,0xE2,0x7F,0xD3,
+    0xC7,0x21,0x18,0x00,0x21,0x88,0xD7,0x98,
+    0x4B,0x05,0xB5,0xD5,0x09,0xA8,0xD3,0x6A,
+    0x43,0xF0,0x8A,0x31,0xCB,0x16,0x09,0x23,
+    0xA7,0x09,0x53,0x85,0x07,0x4B,0xA4,0xA0,
+    0xC3,0x81,0x8C,0xF0,0x8E,0x7F,0x80,0x4E,
+    0x78,0x8F,0x11,0xE2,0x3E,0x01,0x39,0xC1,
+    0x11,0xF8,0x28,0x3F,0x05,0x07,0xE1,0x08,
+
+    /* Access unit 13 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x80,0x1A,
+    0xF3,0x71,0x43,0x96,0xB5,0xAC,0x3B,0xCE,
+    0x46,0x1E,0x7C,0x76,0x95,0xCD,0xD1,0x61,
+    0xB6,0x50,0xDD,0x33,0xCA,0xF9,0x5F,0xF2,
+    0xBE,0x57,0xCB,0x67,0x84,0xF0,0xF0,0x50,
+    0x77,0x82,0x83,0xBC,0x01,0x7F,0x70,0xC8,
+    0x89,0x3C,0x9F,0xA3,0x07,0x7B,0x81,0xFF,
+    0x37,0x0C,0xCF,0xE7,0xFC,0xA3,0xF7,0x3F,
+    0xE2,0xF8,0x68,0xA4,0x7B,0xA1,0xF8,0x8E,
+    0x0D,0x5A,0x39,0xAF,0x37,0x3F,0x77,0x28,
+    0x3C,0x9B,0x91,0x09,0x74,0x4F,0x17,0x90,
+    0x0E,0x53,0x6C,0x0A,0x90,0x53,0x34,0x5F,
+    0xFE,0x85,0xDB,0x00,0x04,0x06,0x0C,0xEA,
+    0x12,0xFA,0xC4,0x2B,0x94,0x2C,0xDD,0x55,
+    0xF3,0xF8,0x18,0xD6,0x19,0x24,0xFD,0x11,
+    0xD4,0xEF,0x8A,0xA0,0x7A,0x62,0xFB,0xC0,
+    0x06,0x36,0x48,0xC7,0x4D,0xB6,0x2D,0x17,
+    0xA9,0x91,0xEB,0x7F,0xA1,0xF8,0x00,0x04,
+    0x00,0x2E,0x1A,0x00,0x02,0x09,0xB9,0x18,
+    0x22,0x1C,0xE1,0x72,0x36,0x5A,0x4C,0x11,
+    0x69,0x06,0x09,0xBB,0x2C,0xE1,0x45,0xFC,
+    0x44,0xF4,0x34,0xAB,0x40,0xCF,0xFB,0xA3,
+    0x44,0x7E,0x13,0x84,0x32,0x48,0xF0,0x8B,
+    0x25,0x43,0x91,0xC1,0x4A,0x43,0xE1,0xB1,
+    0x95,0x7F,0x77,0x7A,0xEF,0xDF,0xEF,0xC1,
+    0x54,0x94,0x95,0x28,0x30,0xC0,0xCA,0x78,
+    0xFC,0xFE,0x7E,0x84,0x78,0x8F,0x36,0x3E,
+    0x1F,0xF2,0x02,0x23,0xF9,0xFC,0xFD,0x1F,
+    0xCF,0xE7,0xE0,0x88,0xFE,0x7F,0x3F,0x47,
+    0xF3,0xF9,0xF8,0x22,0x3F,0x9F,0xCF,0xD1,
+    0xFC,0xFE,0x7E,0x22,
+
+    /* Access unit 14 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0xA0,0x1A,
+    0xF3,0x70,0xB8,0xC2,0xAF,0x95,0x79,0x57,
+    0x95,0x79,0x6C,0xF0,0x9E,0x1E,0x11,0xE1,
+    0x72,0x45,0x8A,0x2C,0x51,0x62,0x8B,0x11,
+    0x7B,0x33,0xE6,0x79,0x9E,0xF7,0x99,0xEF,
+    0x79,0xB8,0x5C,0xA4,0x5F,0x22,0xF2,0x2F,
+    0x2B,0x07,0x50,0x98,0xFC,0xB0,0x9A,0x00,
+    0x8B,0x85,0xC9,0x2A,0x99,0x54,0xCA,0xA6,
+    0x55,0x2E,0xF9,0x9E,0xF7,0x99,0xEF,0x79,
+    0xB9,0xCA,0x97,0xF3,0xC2,0x78,0x02,0x83,
+    0xBC,0x14,0x1D,0xE0,0xA0,0xEF,0x05,0x07,
+    0x78,0x28,0x3B,0xC1,0x41,0xDE,0x0A,0x0E,
+    0xF0,0x50,0x77,0x82,0x83,0xBC,0x14,0x1D,
+    0xE0,0xA0,0xEF,0x05,0x07,0x78,0x28,0x3B,
+    0xC1,0x41,0xDE,0x0A,0x0E,0xF0,0x50,0x77,
+    0x82,0x83,0xBC,0x14,0x1D,0xE0,0xA0,0xEF,
+    0x05,0x07,0x78,0x47,0x9C,0x43,0x1F,0x8E,
+    0xE8,0xB8,0x47,0x9E,0xA3,0xCB,0x16,0x19,
+    0xBF,0x7F,0x37,0x0D,0x16,0xE2,0x2B,0xE8,
+    0xC8,0x79,0x5E,0x3D,0x42,0x9C,0xC7,0x71,
+    0x79,0x02,0xE1,0x03,0xCE,0xDA,0x95,0x1F,
+    0xA3,0xCB,0xEF,0xE5,0x98,0xE7,0x0D,0xC8,
+    0xF7,0x96,0x3F,0xD3,0x9C,0xCD,0xF6,0x11,
+    0xE3,0xBE,0xC6,0xA7,0x80,0x0E,0x02,0x03,
+    0xBD,0x67,0x05,0x36,0x45,0x45,0x1F,0x6D,
+    0x65,0x0D,0x3E,0xDC,0xF3,0x20,0x10,0x02,
+    0x9F,0xB8,0x38,0x63,0xE5,0xA4,0xFB,0xB8,
+    0x78,0xB7,0xC0,0x00,0x10,0x34,0x00,0x01,
+    0x02,0xD1,0x29,0x03,0xFC,0x64,0x04,0xC4,
+    0x8D,0xB5,0xEA,0xB1,0x21,0x9C,0x63,0x07,
+    0xE0,0x08,0x00,0x04,0x0F,0xC0,0x01,0xE0,
+    0x6E,0x65,0x01,0xB3,0x18,0x98,0xD6,0x5C,
+    0xB4,0x75,0xD6,0xC0,0x68,0xF0,0x00,0x10,
+    0x00,0xC7,0xBC,0x2C,0x69,0x72,0xFD,0xF6,
+    0x45,0xEA,0x3D,0xD7,0x22,0x04,0xBC,0x97,
+    0x6B,0xF1,0x05,0xAF,0x1C,0xD7,0x74,0x86,
+    0x0A,0x2F,0xE2,0x29,0xEF,0x51,0x79,0xBC,
+    0xA4,0x13,0xAF,0xDF,0x04,0x02,0x3F,0x93,
+    0x22,0x0D,0x94,0x85,0x47,0x1B,0xD6,0x8F,
+    0x87,0xE0,0x00,0x60,0x06,0x05,0x8B,0x92,
+    0x37,0x54,0x6E,0x6C,0xAC,0x90,0x62,0x88,
+    0xAC,0xAE,0x88,0x18,0x70,0x34,0x1E,0x37,
+    0x3F,0xC0,0x26,0x3C,0x47,0x88,0xF1,0x1E,
+    0x6F,0xF0,0xFF,0x0F,0x04,0xB0,0x70,0x00,
+    0x10,0x65,0x00,0x01,0x15,0x45,0x30,0x44,
+    0x78,0x4E,0x63,0xF0,0x44,0x7E,0x63,0xF0,
+    0x44,0x7E,0x63,0xF2,0xC0,
+
+    /* Access unit 15 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0xC0,0x1A,
+    0xF3,0x71,0x42,0x86,0xA9,0xAA,0xA6,0xAA,
+    0x9A,0xAA,0x66,0xE7,0x22,0xFE,0x0F,0xD8,
+    0x84,0x78,0xA9,0xFE,0x7F,0x3F,0xAC,0x2F,
+    0xCF,0x4F,0xF2,0x3E,0x47,0xC2,0xE3,0xDE,
+    0x22,0xEB,0x1D,0x8F,0xE1,0x13,0xBC,0x2E,
+    0x77,0x84,0x4E,0xF0,0xB9,0xDE,0x11,0x3B,
+    0xC2,0xE7,0x78,0x44,0xEF,0x0B,0x9D,0xE1,
+    0x13,0xBC,0x2E,0x77,0x84,0x4E,0xF0,0xB9,
+    0xDE,0x11,0x3B,0xC2,0xE7,0x78,0x44,0xEF,
+    0x0B,0x9D,0xE1,0x13,0xBC,0x2E,0x77,0x84,
+    0x4E,0xF0,0xB9,0xDE,0x11,0x3B,0xC2,0xE7,
+    0x78,0x44,0xEF,0x0B,0x9D,0xE1,0x13,0xBC,
+    0x2E,0x77,0x84,0x4E,0xF0,0xB9,0xDE,0x11,
+    0x3B,0xC2,0xE7,0x78,0x44,0xEF,0x0B,0x9D,
+    0xE1,0x13,0xBC,0x2E,0x77,0x84,0x4E,0xF0,
+    0xB9,0xDE,0x11,0x3B,0xC2,0xE7,0x78,0x44,
+    0xEF,0x0B,0x9D,0xE2,0xF9,0xC8,0xB2,0x05,
+    0x21,0x94,0xE8,0xF8,0x41,0x63,0x14,0x9F,
+    0x4F,0xB0,0x28,0x11,0x8D,0x18,0xD6,0x5E,
+    0x7A,0x2F,0xFA,0x38,0x79,0x15,0xEF,0xF3,
+    0xC6,0x29,0xFC,0x54,0x23,0x19,0x15,0xCF,
+    0x48,0x27,0x92,0x56,0x8C,0xA4,0xC1,0xD6,
+    0x98,0x26,0x6E,0x1A,0x2C,0xEA,0x2E,0x8A,
+    0x97,0x84,0x2F,0x9E,0xD4,0x3A,0x5E,0x7D,
+    0xBB,0x65,0xD2,0x9A,0x29,0xA6,0x6B,0x35,
+    0x73,0xDB,0xE5,0x34,0x53,0x44,0xD6,0x6B,
+    0xE7,0xA9,0x46,0x4B,0xA5,0xFF,0x88,0xE6,
+    0x91,0x32,0x07,0xE7,0x63,0xC5,0xCA,0x1B,
+    0x30,0x51,0xC8,0x6E,0x36,0x1C,0x4D,0x95,
+    0xF8,0xBA,0x74,0xDA,0x60,0x5F,0x67,0x39,
+    0xC1,0xF0,0xED,0x07,0x78,0x20,0x04,0xC2,
+    0xE7,0xC0,0x00,0x42,0x2A,0x01,0x16,0xC4,
+    0xB8,0x16,0x74,0x30,0xD2,0x95,0x67,0xA5,
+    0x0D,0x03,0x78,0x00,0x02,0x01,0x40,0x00,
+    0x20,0x12,0x1B,0xD1,0xC3,0x42,0x52,0xDD,
+    0x9F,0x89,0x2F,0xFC,0xAC,0x41,0x64,0xE0,
+    0x20,0x00,0x23,0x84,0x8B,0x68,0x04,0xF7,
+    0x3E,0xD2,0xEA,0x53,0x40,0xC8,0x25,0x7F,
+    0xE0,0xFC,0x00,0x01,0x01,0x70,0x00,0x38,
+    0x71,0xE0,0x11,0xA2,0x71,0x81,0x26,0x4B,
+    0xE1,0x11,0x19,0x91,0xF4,0x0A,0x41,0x82,
+    0x5E,0x22,0x43,0x73,0xAF,0x1B,0x74,0x5B,
+    0x57,0xFC,0x41,0x5A,0x57,0x59,0xC0,0xC9,
+    0xD0,0x6C,0x04,0x88,0x3F,0x11,0xDE,0x65,
+    0x59,0xB0,0x62,0x9D,0xE1,0x24,0x23,0xF9,
+    0x90,0xDC,0x44,0xE3,0x59,0xEA,0x2D,0x4E,
+    0x6A,0xA1,0xF8,0x00,0x02,0x03,0x02,0x80,
+    0x38,0x1A,0xFE,0x12,0x88,0x97,0x93,0x25,
+    0xA0,0x7C,0x68,0x8C,0x46,0x0C,0x38,0x1A,
+    0x8F,0x17,0x9F,0xE0,0x13,0x9D,0x08,0xF1,
+    0x1E,0x6C,0x78,0x7F,0xE1,0xF0,0xA6,0x03,
+    0x80,0x00,0x82,0xB0,0x00,0x08,0x3F,0x00,
+    0x00,0x83,0xB0,0x00,0xD2,0x66,0x08,0x8F,
+    0x0A,0xC8,0x7F,0x3F,0x9F,0x82,0x23,0xF2,
+    0x1F,0xCF,0xE7,0xE0,0x88,0xFC,0x87,0xF3,
+    0xF9,0xFB,0x80,
+
+    /* Access unit 16 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0xE0,0x1A,
+    0xF0,0xEF,0x14,0x28,0xEB,0xE7,0x5E,0x75,
+    0xEB,0x37,0x3C,0x45,0xD7,0x8A,0x8F,0xE0,
+    0x0D,0x4F,0x86,0x8C,0x25,0x5E,0x25,0x5E,
+    0xFF,0x84,0x7E,0xD3,0xE6,0xE7,0x97,0x03,
+    0x03,0xD0,0x44,0x24,0x87,0x52,0x1C,0x07,
+    0x6D,0x04,0x38,0x84,0xEE,0x71,0x9C,0xE5,
+    0x4A,0xBF,0x19,0x96,0xC3,0x45,0xE7,0xCA,
+    0x4D,0x2A,0xEE,0xCD,0x98,0x1E,0x45,0x2E,
+    0xD3,0x73,0xD2,0xBF,0x1F,0x0A,0xAD,0x7F,
+    0x84,0x11,0x67,0x48,0x57,0x2C,0x97,0x2F,
+    0xFC,0x57,0x16,0x68,0x00,0x23,0x02,0x05,
+    0x10,0x4B,0xFA,0x36,0x5E,0xB4,0x10,0x44,
+    0x9E,0x79,0x8E,0x0B,0xF0,0x00,0x18,0x00,
+    0xC1,0x5D,0x17,0x76,0xB8,0x93,0x47,0xA2,
+    0x0B,0x3D,0xEA,0x3C,0xB0,0x68,0x04,0x00,
+    0x02,0x04,0x03,0xDC,0x24,0x26,0x14,0x24,
+    0xD5,0x6E,0x96,0xCA,0xDB,0xD3,0xFB,0x7F,
+    0x0B,0x0D,0xD2,0x3B,0xB8,0x2B,0x52,0x49,
+    0xE7,0x83,0x04,0xBC,0x41,0x43,0x68,0x91,
+    0x30,0x9B,0x3B,0x83,0x67,0x02,0x3F,0xF7,
+    0x28,0x3E,0xB5,0xC4,0x7F,0x32,0x35,0x91,
+    0xA6,0x2E,0xA9,0xE1,0xF3,0xF3,0x78,0xDE,
+    0xB9,0x7A,0xBF,0xC1,0x87,0x03,0x61,0xE2,
+    0xF3,0xF9,0xFE,0x01,0x39,0xE2,0x3C,0x47,
+    0x88,0xE0,0x88,0xFE,0x7E,0x09,0xCF,0xC1,
+    0x41,0xF9,0xE0
+};
+
+/* 640 x 480 H.264 test stream: colour bars with the frame number burned in (tools/fx3_uvc_h26x_frames.py).
+ * One GOP of 16 Annex B access units, IDR first; profile_idc 66, constraint flags 0xC0, level_idc 31.
+ * Constant QP 28.
+ * Access units of 56 to 1822 bytes, 3262 bytes in all. */
+const uint32_t glVidFrameLenH264_640x480_QP28[16] = {
+    1822, 118, 98, 114, 110, 82, 87, 111,
+    108, 111, 81, 85, 87, 103, 89, 56
+};
+
+const uint8_t glUVCVidFramesH264_640x480_QP28[] __attribute__ ((aligned (32))) =
+{
+    /* Access unit 1 (IDR) */
+    0x00,0x00,0x00,0x01,0x67,0x42,0xC0,0x1F,
+    0xDA,0x02,0x80,0xF6,0x84,0x00,0x00,0x03,
+    0x00,0x04,0x00,0x00,0x03,0x00,0x7A,0x3C,
+    0x60,0xCA,0x80,0x00,0x00,0x00,0x01,0x68,
+    0xCE,0x09,0x2C,0x80,0x00,0x00,0x01,0x65,
+    0x88,0x84,0x3F,0x26,0x28,0x00,0x08,0x3C,
+    0x49,0xC9,0xC9,0xC9,0xFF,0x87,0xFE,0x0B,
+    0x20,0x62,0x9A,0x67,0xF1,0x00,0x00,0x40,
+    0x30,0x00,0x58,0x80,0xB6,0x0E,0x04,0x04,
+    0x84,0x1C,0x08,0x09,0x08,0x96,0x11,0x2C,
+    0x09,0xA9,0x39,0x39,0x39,0x3F,0x87,0xFF,
+    0xC3,0x58,0x1D,0x08,0xA8,0x3D,0xF1,0x00,
+    0x00,0x40,0xA4,0x00,0x04,0x0F,0xA2,0x00,
+    0x00,0x80,0xF0,0x00,0x08,0x17,0xC0,0xE0,
+    0x00,0x83,0x0F,0xB9,0x87,0x00,0x04,0x18,
+    0x7D,0xCC,0x0E,0x00,0x41,0x45,0x5C,0xC3,
+    0x80,0x10,0x51,0x17,0x31,0x1A,0xD4,0x9C,
+    0x9C,0x9C,0x9F,0x87,0xFF,0xE0,0xAE,0x0D,
+    0x26,0x82,0xF8,0x80,0x00,0x40,0x00,0x04,
+    0x11,0x63,0x40,0x00,0x94,0x0E,0x01,0x08,
+    0x75,0xCC,0x38,0x04,0x21,0xD7,0x30,0xBB,
+    0x73,0x27,0x6E,0x62,0x35,0xF4,0x9C,0x9C,
+    0x9F,0xFC,0x3F,0xE0,0xB3,0x01,0xE4,0x40,
+    0x34,0xCE,0x20,0x00,0x08,0x02,0x80,0x24,
+    0x40,0x00,0x10,0x0F,0x00,0x1B,0x07,0x00,
+    0x80,0x2C,0x20,0xE0,0x10,0x05,0x84,0x1C,
+    0x00,0x20,0x01,0x61,0x07,0x00,0x08,0x00,
+    0x58,0x08,0xFB,0xA3,0xB2,0x72,0x72,0x72,
+    0x7F,0xE1,0xFF,0x82,0xC8,0x19,0x41,0xA6,
+    0x77,0xC4,0x00,0x01,0x02,0x00,0x00,0x10,
+    0x05,0x88,0x02,0x4C,0x0E,0x42,0x35,0xC8,
+    0x72,0x11,0xAE,0x5E,0x78,0x08,0xD5,0xC9,
+    0x39,0x39,0x39,0x3F,0x87,0xFF,0xC1,0x5E,
+    0x28,0x00,0x15,0xE2,0x00,0x00,0x80,0x88,
+    0x00,0x08,0x2C,0x44,0x00,0x01,0x00,0xA0,
+    0x00,0x10,0x45,0x83,0x80,0x04,0x00,0x76,
+    0x30,0x70,0x00,0x80,0x0E,0xC4,0x1C,0x00,
+    0x40,0x19,0x8C,0x1C,0x00,0x40,0x19,0x89,
+    0x39,0x39,0x39,0x39,0x3A,0xEB,0xAE,0xBA,
+    0xE9,0xD5,0x75,0xD7,0x5D,0x74,0xED,0xA7,
+    0xAE,0xBA,0xEB,0xA7,0x0F,0xD3,0x13,0xD7,
+    0x5D,0x74,0xF4,0xF5,0xD7,0x5D,0x74,0xF4,
+    0xF5,0xD7,0x5D,0x74,0xF5,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x4E,0xEB,0xAE,0xBA,
+    0xEB,0xA7,0xA7,0xAE,0xBA,0xEB,0xA7,0xA7,
+    0xAE,0xBA,0xE9,0xE9,0xEB,0xAE,0xBA,0xE9,
+    0xE9,0xEB,0xAE,0xBA,0xE9,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0x9D,0x57,0x5D,
+    0x75,0xD7,0x4F,0x4F,0x5D,0x75,0xD7,0x4F,
+    0x4F,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,
+    0xD3,0xD3,0xD7,0x5D,0x75,0xD3,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x3B,0xAE,
+    0xBA,0xEB,0xAE,0x9E,0x9E,0xBA,0xEB,0xAE,
+    0x9E,0x9E,0xBA,0xEB,0xA7,0xA7,0xAE,0xBA,
+    0xEB,0xA7,0xA7,0xAE,0xBA,0xEB,0xA7,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0x75,
+    0x5D,0x75,0xD7,0x5D,0x3D,0x3D,0x75,0xD7,
+    0x5D,0x3D,0x3D,0x75,0xD7,0x4F,0x4F,0x5D,
+    0x75,0xD7,0x4F,0x4F,0x5D,0x75,0xD7,0x4F,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,
+    0xEE,0xBA,0xEB,0xAE,0xBA,0x7A,0x7A,0xEB,
+    0xAE,0xBA,0x7A,0x7A,0xEB,0xAE,0x9E,0x9E,
+    0xBA,0xEB,0xAE,0x9E,0x9E,0xBA,0xEB,0xAE,
+    0x9E,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xE9,0xD5,0x75,0xD7,0x5D,0x74,0xF4,0xF5,
+    0xD7,0x5D,0x74,0xF4,0xF5,0xD7,0x5D,0x3D,
+    0x3D,0x75,0xD7,0x5D,0x3D,0x3D,0x75,0xD7,
+    0x5D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD3,0xBA,0xEB,0xAE,0xBA,0xE9,0xE9,
+    0xEB,0xAE,0xBA,0xE9,0xE9,0xEB,0xAE,0xBA,
+    0x7A,0x7A,0xEB,0xAE,0xBA,0x7A,0x7A,0xEB,
+    0xAE,0xBA,0x7A,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xA7,0x55,0xD7,0x5D,0x75,0xD3,
+    0xD3,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,
+    0x74,0xF4,0xF5,0xD7,0x5D,0x74,0xF4,0xF5,
+    0xD7,0x5D,0x74,0xF5,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x4E,0xEB,0xAE,0xBA,0xEB,
+    0xA7,0xA7,0xAE,0xBA,0xEB,0xA7,0xA7,0xAE,
+    0xBA,0xE9,0xE9,0xEB,0xAE,0xBA,0xE9,0xE9,
+    0xEB,0xAE,0xBA,0xE9,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0x9D,0x57,0x5D,0x75,
+    0xD7,0x4F,0x4F,0x5D,0x75,0xD7,0x4F,0x4F,
+    0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD3,
+    0xD3,0xD7,0x5D,0x75,0xD3,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x3B,0xAE,0xBA,
+    0xEB,0xAE,0x9E,0x9E,0xBA,0xEB,0xAE,0x9E,
+    0x9E,0xBA,0xEB,0xA7,0xA7,0xAE,0xBA,0xEB,
+    0xA7,0xA7,0xAE,0xBA,0xEB,0xA7,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0x75,0x5D,
+    0x75,0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,
+    0x3D,0x3D,0x75,0xD7,0x4F,0x4F,0x5D,0x75,
+    0xD7,0x4F,0x4F,0x5D,0x75,0xD7,0x4F,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xEE,
+    0xBA,0xEB,0xAE,0xBA,0x7A,0x7A,0xEB,0xAE,
+    0xBA,0x7A,0x7A,0xEB,0xAE,0x9E,0x9E,0xBA,
+    0xEB,0xAE,0x9E,0x9E,0xBA,0xEB,0xAE,0x9E,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xE9,
+    0xD5,0x75,0xD7,0x5D,0x74,0xF4,0xF5,0xD7,
+    0x5D,0x74,0xF4,0xF5,0xD7,0x5D,0x3D,0x3D,
+    0x75,0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,
+    0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD3,0xBA,0xEB,0xAE,0xBA,0xE9,0xE9,0xEB,
+    0xAE,0xBA,0xE9,0xE9,0xEB,0xAE,0xBA,0x7A,
+    0x7A,0xEB,0xAE,0xBA,0x7A,0x7A,0xEB,0xAE,
+    0xBA,0x7A,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xA7,0x55,0xD7,0x5D,0x75,0xD3,0xD3,
+    0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x74,
+    0xF4,0xF5,0xD7,0x5D,0x74,0xF4,0xF5,0xD7,
+    0x5D,0x74,0xF5,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x4E,0xEB,0xAE,0xBA,0xEB,0xA7,
+    0xA7,0xAE,0xBA,0xEB,0xA7,0xA7,0xAE,0xBA,
+    0xE9,0xE9,0xEB,0xAE,0xBA,0xE9,0xE9,0xEB,
+    0xAE,0xBA,0xE9,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0x9D,0x57,0x5D,0x75,0xD7,
+    0x4F,0x4F,0x5D,0x75,0xD7,0x4F,0x4F,0x5D,
+    0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD3,0xD3,
+    0xD7,0x5D,0x75,0xD3,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x3B,0xAE,0xBA,0xEB,
+    0xAE,0x9E,0x9E,0xBA,0xEB,0xAE,0x9E,0x9E,
+    0xBA,0xEB,0xA7,0xA7,0xAE,0xBA,0xEB,0xA7,
+    0xA7,0xAE,0xBA,0xEB,0xA7,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0x75,0x5D,0x75,
+    0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,0x3D,
+    0x3D,0x75,0xD7,0x4F,0x4F,0x5D,0x75,0xD7,
+    0x4F,0x4F,0x5D,0x75,0xD7,0x4F,0x5D,0x75,
+    0xD7,0x5F,0xFF,0x1F,0xE0,0x82,0x28,0x00,
+    0x08,0x26,0xFB,0xEF,0xBE,0xFF,0xC3,0x8F,
+    0x00,0xE0,0xAA,0x10,0x12,0x9C,0xC0,0x23,
+    0x01,0xC3,0x28,0x1B,0xAF,0xD8,0x96,0x19,
+    0xD7,0xD6,0xB6,0xB6,0xB6,0xBC,0x3F,0x10,
+    0xC0,0x38,0x2A,0x81,0x80,0x26,0x81,0x00,
+    0x43,0x9E,0xA0,0x0E,0x00,0x20,0xD1,0x23,
+    0x52,0xDF,0xB0,0x38,0x04,0x38,0x8B,0x8D,
+    0xDC,0xFA,0xD6,0xD6,0xD6,0xD6,0xD7,0x0F,
+    0xE0,0x18,0x07,0x05,0x50,0x38,0x00,0x17,
+    0x02,0xC8,0x40,0x01,0x38,0xA5,0x01,0xC0,
+    0x21,0x0C,0xB8,0xDD,0xCF,0xA0,0x9F,0xBC,
+    0xCD,0xD7,0xEB,0xF4,0xEB,0xEB,0x5B,0x5B,
+    0x5F,0xE1,0x8F,0x87,0x05,0x50,0xBE,0x82,
+    0xB6,0x8B,0xA0,0x70,0x0D,0x00,0x5D,0x0F,
+    0xB4,0xCB,0xA0,0x60,0x00,0x68,0x00,0xF9,
+    0x87,0xD7,0xD0,0x5A,0x9F,0x33,0xEA,0x69,
+    0x24,0xBA,0x49,0x35,0xB5,0xB5,0xB5,0xFC,
+    0x38,0xF0,0x0E,0x0A,0xA1,0x5B,0x41,0x00,
+    0x02,0x31,0x04,0x9B,0x40,0xE4,0x46,0xB8,
+    0x4D,0xCD,0xA1,0xE7,0x89,0xAC,0xD3,0xA9,
+    0x30,0x4C,0xA2,0xD6,0xD6,0xD6,0xD7,0x87,
+    0xE2,0x18,0x07,0x05,0x50,0x84,0x00,0x10,
+    0x09,0xA1,0x02,0x71,0x52,0x06,0x00,0x06,
+    0x80,0x0B,0xA8,0x76,0xBE,0x8A,0x25,0x81,
+    0xC0,0x06,0x00,0x35,0x8D,0x47,0x67,0x59,
+    0xD2,0xD6,0xD6,0xD6,0xD6,0xBA,0xFF,0xF9,
+    0x82,0xBB,0x86,0x15,0x80,0x02,0x34,0x15,
+    0x62,0x0A,0xC5,0xDC,0x16,0x5E,0xD0,0x55,
+    0xA6,0xA5,0x86,0x84,0xFB,0x97,0xFB,0x70,
+    0x57,0x2D,0x87,0xBE,0x29,0x81,0x1A,0x66,
+    0xB4,0x30,0xB5,0x93,0xC1,0x4A,0xEF,0x34,
+    0x2D,0xFF,0x03,0x43,0x70,0x91,0x78,0x82,
+    0x86,0xD7,0x29,0x94,0x5F,0xFC,0x00,0xE2,
+    0x25,0x66,0x15,0x4F,0xBC,0x79,0xBF,0x41,
+    0xDA,0x1B,0x10,0x84,0x02,0x45,0x56,0x36,
+    0xCB,0xDF,0x7B,0x11,0x9A,0xCB,0xF5,0xAD,
+    0x95,0xBF,0xFF,0xFD,0x04,0x99,0xE1,0x85,
+    0x7E,0xE2,0x0F,0xA7,0x7A,0x4D,0x18,0x78,
+    0x77,0x25,0xA1,0xC8,0x4A,0xF6,0xE9,0x7E,
+    0xDE,0x91,0x41,0xE3,0x01,0xD2,0xB4,0x2D,
+    0xFB,0xF7,0xD0,0x1A,0x02,0xEC,0x4F,0x7E,
+    0x45,0xFF,0x2B,0xC1,0x2B,0xA2,0xCE,0x12,
+    0x3F,0x94,0x93,0xC2,0x4C,0x70,0x74,0x48,
+    0x73,0x50,0xC6,0x96,0xD7,0xED,0xBF,0x7B,
+    0x03,0x17,0xEE,0x8A,0x5C,0x28,0x45,0x93,
+    0x87,0xA5,0xC4,0x09,0x84,0x84,0x1F,0x0C,
+    0x40,0x99,0x5B,0x3C,0xF7,0xFD,0x78,0x6D,
+    0x0A,0xF4,0x35,0xA0,0xDF,0xF1,0x27,0xE4,
+    0x7D,0x2B,0xDF,0x80,0x18,0x45,0x8C,0xE2,
+    0xAD,0xF5,0x8E,0x37,0x6D,0xD6,0x08,0xCD,
+    0x08,0x08,0xC5,0x44,0x76,0x3B,0xFF,0xAC,
+    0x8F,0x6D,0xDB,0x57,0xCB,0x2F,0xFF,0x06,
+    0x00,0x1C,0x12,0x5C,0xB9,0x83,0xFA,0x57,
+    0xE3,0x2F,0xF8,0x0A,0xAD,0x7D,0x7F,0x67,
+    0x8D,0x21,0xB5,0x01,0x22,0x54,0xDD,0x9E,
+    0x81,0x5F,0xF1,0x30,0x87,0x40,0x82,0x00,
+    0x89,0xEA,0xDB,0x86,0xCA,0x88,0x7D,0xBF,
+    0x7C,0xC7,0x5E,0xBF,0x73,0x88,0x65,0xA6,
+    0x08,0x41,0xBD,0xA6,0x0D,0xB2,0x96,0x96,
+    0x96,0x96,0x96,0x96,0x96,0x96,0x96,0x96,
+    0x96,0x96,0x96,0x96,0x96,0x96,0xBA,0x5A,
+    0x5A,0x5A,0x5A,0x5A,0x5A,0x5A,0x5A,0x5A,
+    0x5A,0x5A,0x5A,0x5A,0x5A,0x5A,0x5A,0x5A,
+    0xEB,0xD5,0xF3,0x5F,0xFE,0x12,0xF1,0xB7,
+    0xB0,0xBF,0xBF,0x88,0xE9,0x54,0xFF,0x16,
+    0x3F,0x5F,0x81,0xFF,0x13,0x10,0x9F,0x35,
+    0x2D,0x52,0xE2,0xA2,0xBF,0xFF,0xF5,0xED,
+    0xB1,0x75,0xAB,0x4C,0x62,0x7F,0xFE,0x0C,
+    0x3B,0x8E,0x83,0xFF,0xC2,0x5F,0x26,0x42,
+    0x55,0x85,0x56,0x53,0xEC,0x54,0xA1,0xF8,
+    0xE1,0x6B,0xC9,0x3F,0xD7,0x41,0xFF,0x9A,
+    0x79,0x1A,0x1E,0xB3,0xA6,0xB3,0xB0,0x98,
+    0x8F,0x65,0x15,0x84,0x2C,0xB8,0x30,0xEE,
+    0xB8,0x97,0xFF,0x09,0x7F,0x15,0x52,0x92,
+    0x49,0x56,0xB9,0x82,0xFB,0x90,0x6C,0x51,
+    0xEE,0x7F,0x0F,0xC1,0xED,0x4A,0x44,0x56,
+    0x2D,0x4D,0xFF,0xD7,0xFC,0x5B,0xFF,0xF8,
+    0x7A,0x18,0x00,0x24,0x94,0x44,0x85,0xA4,
+    0xC9,0xA4,0x86,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBB,0xEF,
+    0xBE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xFE,0x3F,0xFF,0x0F,0x71,0x40,
+    0x00,0x41,0x9B,0x7A,0xBF,0xC7,0xC3,0xFE,
+    0x45,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xAA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAF,
+
+    /* Access unit 2 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0x23,0xC0,
+    0x1C,0xF5,0xCB,0x00,0x17,0xE8,0x27,0x48,
+    0x5F,0x3E,0xF6,0xF8,0x2D,0xC1,0x0C,0xD2,
+    0x73,0xE4,0x3F,0x2E,0x01,0xAD,0x13,0x33,
+    0xB4,0x11,0x47,0x53,0xFF,0xCE,0xB3,0x67,
+    0x9F,0x8C,0x84,0x15,0x67,0xFF,0x98,0x14,
+    0x27,0xDC,0x13,0xB1,0x3D,0x94,0xE6,0x1B,
+    0xD5,0x17,0x1A,0xA3,0xF0,0x25,0x9F,0xCF,
+    0xE6,0xFC,0x70,0xFE,0x1E,0xF0,0x38,0x01,
+    0x00,0x14,0x18,0x83,0x04,0x3C,0x47,0x88,
+    0xF3,0x7F,0x87,0xF8,0x7B,0x83,0x80,0x08,
+    0x00,0x8A,0x60,0x88,0xFE,0x7F,0x3E,0x5E,
+    0x8F,0xE7,0xF3,0xEE,0x08,0x8F,0xE7,0xF3,
+    0xF4,0x7F,0x3F,0x9F,0x82,0x23,0xF9,0xFC,
+    0xFD,0x1F,0xCF,0xE7,0xE0,0x8A,
+
+    /* Access unit 3 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0x43,0xC0,
+    0x1C,0xF2,0xD2,0x2C,0x00,0x8D,0x9F,0x47,
+    0x67,0xA7,0xE0,0x33,0xF6,0xFE,0xDF,0xFF,
+    0xFD,0xC0,0x93,0xAC,0x44,0x2A,0x15,0x47,
+    0xCC,0x75,0xDD,0xD0,0x26,0x6D,0x10,0x76,
+    0xDD,0xDF,0x33,0xF8,0x14,0x25,0xDC,0x06,
+    0x1B,0xDD,0x4F,0xDF,0xFF,0xF1,0x80,0xB8,
+    0x70,0x26,0x9F,0xCF,0xE6,0xFF,0xF8,0x70,
+    0xFF,0x80,0xE0,0x02,0x0E,0x34,0x28,0x98,
+    0x84,0x6F,0x11,0xF0,0x09,0xCE,0x08,0x8F,
+    0xE7,0xF3,0xF4,0x7E,0x09,0x0F,0xE7,0xF3,
+    0xF4,0x7E,0x09,0x0F,0xE7,0xF3,0xF4,0x7E,
+    0x08,0xA0,
+
+    /* Access unit 4 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0x63,0xC0,
+    0x1C,0xF1,0xBF,0xC1,0xD8,0x3D,0x02,0x08,
+    0x00,0x43,0xAB,0x6F,0x44,0x9B,0x56,0x22,
+    0x42,0x15,0xFF,0xFF,0xC2,0xAA,0x7F,0x2D,
+    0x1A,0x19,0x1C,0xD9,0x2F,0x29,0xA2,0xF7,
+    0xAC,0x13,0xFC,0x4F,0x8B,0x5D,0x54,0xDD,
+    0xBF,0x05,0x06,0x97,0xFF,0xF0,0xF7,0xC0,
+    0x9F,0x30,0xD6,0x42,0xBB,0xD9,0x6F,0xF7,
+    0xDF,0x02,0x79,0xFC,0xFE,0x7F,0x80,0x4E,
+    0x62,0x7C,0x07,0x90,0x91,0x32,0x0F,0x21,
+    0x22,0x64,0x1E,0x42,0x44,0xC8,0x8F,0x11,
+    0xE2,0x38,0x22,0x3F,0x9F,0xA3,0xF9,0xFC,
+    0xFE,0x7E,0x08,0x8F,0xD9,0xFC,0xFE,0x7F,
+    0x3F,0x04,0x47,0xEC,0xFE,0x7F,0x3F,0x9F,
+    0x87,0xA0,
+
+    /* Access unit 5 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0x83,0xC0,
+    0x1C,0xF1,0xBF,0xC5,0xC0,0xFD,0x02,0x08,
+    0x00,0x8D,0x0A,0xB3,0x1D,0x53,0x39,0x6F,
+    0xE0,0x75,0x86,0xB2,0xC3,0xBC,0xE5,0xF8,
+    0x0D,0x2F,0xEA,0xCE,0x8E,0x42,0x7D,0x9D,
+    0x08,0x26,0xAD,0x87,0xD9,0x8A,0x62,0x3F,
+    0x02,0x83,0x19,0xFF,0xFF,0x0F,0x42,0x46,
+    0x41,0xCB,0xDB,0x43,0xEF,0xAB,0x14,0xA5,
+    0x53,0xFF,0xFF,0x7F,0xF8,0x14,0x8F,0xE7,
+    0xF8,0x04,0xC7,0x42,0x3C,0x47,0x9B,0x11,
+    0xF8,0x7F,0x0F,0x78,0x38,0x00,0x80,0x08,
+    0xA4,0x11,0x1F,0x90,0xFE,0x7F,0x3E,0xE0,
+    0x88,0xFC,0x87,0xF3,0xF9,0xF8,0x22,0x3F,
+    0x21,0xFC,0xFE,0x7E,0x1B,0x80,
+
+    /* Access unit 6 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0xA3,0xC0,
+    0x1C,0xF6,0xCB,0x00,0x2E,0xDA,0xD5,0xB4,
+    0x3F,0xF9,0xEC,0x05,0x6F,0x15,0x99,0x3D,
+    0xF1,0x51,0x3F,0x81,0x6C,0xB4,0x4C,0x1B,
+    0xC4,0x67,0x7D,0xD8,0xB9,0x36,0x7F,0xF7,
+    0x81,0xF0,0xFE,0x7F,0x3F,0x9B,0x8F,0x87,
+    0xF8,0x7B,0x80,0xE0,0x02,0x0E,0x34,0x28,
+    0x99,0x31,0x1B,0xC4,0x7C,0x02,0x73,0x82,
+    0x23,0xF9,0xFC,0xFE,0x7D,0xE7,0xE0,0x90,
+    0xFE,0x7F,0x3F,0x9F,0x82,0x53,0xF9,0xFC,
+    0xFC,0x3B,
+
+    /* Access unit 7 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0xC3,0xC0,
+    0x1C,0xF1,0xBF,0xE8,0xCD,0xE8,0x10,0x40,
+    0x01,0x95,0xA1,0x0F,0x93,0x37,0x6B,0xED,
+    0x9B,0x65,0x71,0x4A,0xF5,0x4E,0x31,0x1F,
+    0xFF,0xF4,0xE0,0x7A,0xC8,0x9B,0xAF,0xC3,
+    0xD3,0xC5,0xDD,0x82,0x83,0x19,0x7F,0xFF,
+    0x0F,0x40,0xB6,0x23,0x83,0x47,0x92,0x49,
+    0xF4,0x1F,0xC0,0xAE,0x7F,0x3F,0xC0,0x27,
+    0x3C,0x46,0xF1,0x1E,0x23,0xCD,0x88,0x7F,
+    0xFC,0x80,0x88,0xFC,0xC7,0xE0,0x88,0xFC,
+    0xC7,0xE0,0x88,0xFC,0xC7,0xE1,0x68,
+
+    /* Access unit 8 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0xE3,0xC0,
+    0x1C,0xF1,0xBF,0xC4,0xC3,0xE8,0x10,0x40,
+    0x02,0xDE,0x14,0x32,0x10,0xA2,0xA7,0x22,
+    0x7F,0x70,0x0B,0x8C,0x91,0xFD,0x42,0xFB,
+    0xEB,0x13,0x00,0xB0,0x8D,0xBC,0x3E,0x6C,
+    0x2E,0x72,0x79,0x42,0x09,0xB1,0x99,0x92,
+    0x4E,0xBD,0xFC,0x0A,0x0C,0x65,0xFF,0xFC,
+    0x3D,0x82,0x64,0x1C,0xBD,0xB7,0xFD,0xF5,
+    0x8A,0x95,0x53,0xFB,0xFD,0xFF,0xC0,0xB2,
+    0x7F,0x3F,0xC0,0x26,0x3A,0x11,0xE2,0x3C,
+    0xD8,0xF1,0xF8,0x78,0x7F,0x83,0x80,0x08,
+    0x00,0x8A,0x60,0x88,0xFC,0x87,0xF3,0xF9,
+    0xF8,0x22,0x3F,0x21,0xFC,0xFE,0x7E,0x08,
+    0x8F,0xC8,0x7F,0x3F,0x9F,0x85,0x20,
+
+    /* Access unit 9 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x03,0xC0,
+    0x1C,0xF6,0xCB,0x00,0xDB,0xE8,0xCD,0x6A,
+    0x72,0x00,0x1F,0x66,0x19,0xCC,0xA3,0x4D,
+    0x52,0x26,0xE7,0x6A,0x80,0xED,0x0B,0x37,
+    0x73,0x1F,0xBB,0xE0,0xA3,0xB8,0x6D,0x6F,
+    0xFD,0x47,0xC0,0xB6,0x7F,0x3F,0x9F,0xCD,
+    0xF8,0xE1,0xFC,0x25,0xE0,0x38,0x00,0x83,
+    0x8D,0x0A,0x26,0x73,0x88,0xDE,0x23,0xC4,
+    0x79,0xBF,0xC3,0xFC,0x3D,0xC0,0x70,0x02,
+    0x0C,0x31,0x74,0xCC,0x10,0x9F,0xCF,0xE7,
+    0xF3,0xF9,0xFC,0xFE,0x7F,0x3E,0xE0,0x84,
+    0xFE,0x7F,0x3F,0x9F,0xCF,0xE7,0xF3,0xF9,
+    0xF8,0x21,0x3F,0x9F,0xCF,0xF0,0x09,0xCE,
+    0xCF,0xE7,0xE1,0x18,
+
+    /* Access unit 10 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x23,0xC0,
+    0x1C,0xF1,0xBF,0xEA,0x18,0x68,0x2B,0x00,
+    0x07,0x47,0xBF,0x41,0x69,0x0B,0x4F,0xFF,
+    0xF6,0xDF,0x66,0xF0,0x0F,0x01,0x27,0x33,
+    0xFF,0xA1,0x29,0x99,0xF1,0x9E,0x97,0xEE,
+    0x01,0x08,0xE2,0x30,0xDC,0xB3,0x18,0x7B,
+    0xB4,0x07,0x8E,0x0E,0xDD,0xA2,0xCF,0x23,
+    0x77,0x78,0x28,0x30,0x86,0xBF,0xFE,0x12,
+    0xC0,0x44,0x91,0x24,0x42,0xC8,0xC8,0xC9,
+    0xA1,0xDF,0x40,0xD9,0xD0,0xD9,0xAE,0xAF,
+    0xF8,0x17,0x8F,0xE7,0xF8,0x04,0xE7,0x42,
+    0x3C,0x47,0xB0,0x0A,0x0F,0x82,0x23,0xF2,
+    0x1F,0xA3,0xF0,0x44,0x7E,0x43,0xF4,0x7E,
+    0x08,0x8F,0xC8,0x7E,0x8F,0xC7,0xC0,
+
+    /* Access unit 11 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x43,0xC0,
+    0x1C,0xF3,0xC4,0x14,0x5E,0x00,0x3D,0xF0,
+    0x91,0xCF,0x58,0xCE,0x64,0x30,0x88,0x20,
+    0xF5,0x16,0x71,0x26,0x01,0x81,0x3B,0x99,
+    0x2B,0x28,0x9F,0xBA,0x8F,0xFE,0xBC,0xC9,
+    0xE4,0x2E,0xFC,0x14,0x3E,0x02,0x60,0x90,
+    0x01,0xE6,0x26,0x5B,0xBB,0xB2,0xF4,0x6E,
+    0x81,0x87,0x03,0x01,0xFC,0xFE,0x7F,0x80,
+    0x4C,0x78,0x8F,0x11,0xF0,0x09,0x8E,0x08,
+    0x8F,0xE7,0xE0,0x9C,0xFC,0x14,0x1F,0x84,
+    0xE0,
+
+    /* Access unit 12 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x63,0xC0,
+    0x1C,0xF7,0x17,0x96,0x38,0x00,0x7C,0x05,
+    0xD5,0xE0,0x2B,0xC5,0x52,0x15,0x95,0xFF,
+    0x78,0x78,0x02,0x83,0x0B,0xE2,0x3A,0x90,
+    0x17,0x59,0xE0,0xA3,0x42,0x30,0x0A,0x54,
+    0x97,0x53,0x7F,0xCD,0x1B,0x24,0x2C,0x9F,
+    0x20,0x84,0x63,0x03,0x0E,0x06,0x33,0xF9,
+    0xFE,0x01,0x39,0xE2,0x3C,0x47,0x88,0xF3,
+    0x62,0x1F,0xFF,0x0F,0x78,0x0E,0x00,0x41,
+    0x86,0x2C,0x98,0x08,0x8F,0xCC,0xFE,0x08,
+    0x8F,0xC1,0x41,0xF8,0x42,
+
+    /* Access unit 13 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x83,0xC0,
+    0x1C,0xF7,0x17,0x80,0x04,0x4E,0xE5,0xF5,
+    0xEE,0xD2,0xB8,0xD8,0x99,0xDD,0x35,0x7A,
+    0xEF,0x6F,0x26,0x4B,0xCE,0xFB,0x7F,0x05,
+    0xD2,0x83,0xC5,0x13,0x2A,0x2B,0xA8,0xBC,
+    0xF8,0x30,0x50,0xF3,0x5F,0x1F,0xDC,0x9B,
+    0xE0,0x65,0x3F,0x9F,0xCF,0xD0,0x8F,0x11,
+    0xE6,0xC7,0xC3,0xFE,0x40,0x44,0x7F,0x3F,
+    0x9F,0xA3,0xF9,0xFC,0xFC,0x11,0x1F,0xCF,
+    0xE7,0xE8,0xFE,0x7F,0x3F,0x04,0x47,0xF3,
+    0xF9,0xFA,0x3F,0x9F,0xCF,0xC4,0x40,
+
+    /* Access unit 14 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0xA3,0xC0,
+    0x1C,0xF7,0x17,0x80,0x04,0x36,0x5B,0xAD,
+    0xD2,0xF7,0xFA,0x8C,0xF2,0x26,0x59,0xE0,
+    0x87,0xB8,0xBA,0x41,0x0C,0xD9,0xB4,0x2D,
+    0xF2,0x1F,0xA3,0x15,0x39,0x0A,0x59,0x4B,
+    0x75,0x1B,0x3C,0xEF,0x57,0xB2,0x4F,0x96,
+    0xF4,0x81,0x41,0xAD,0xA1,0x7F,0xF0,0x96,
+    0x06,0x2A,0x49,0x15,0x25,0x5F,0xF7,0xFF,
+    0xAE,0xF4,0xD3,0xA6,0xAF,0xFE,0xF8,0x7F,
+    0x03,0x41,0xFC,0xFF,0x00,0x98,0xF1,0x1E,
+    0x23,0xC4,0x79,0xBF,0xC3,0xFC,0x3D,0xC1,
+    0xC0,0x04,0x00,0x45,0x30,0x44,0x7E,0x67,
+    0xF0,0x44,0x7E,0x0A,0x0F,0xC5,0xC0,
+
+    /* Access unit 15 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0xC3,0xC0,
+    0x1C,0xF3,0xC1,0x00,0x22,0x17,0x80,0x19,
+    0x6D,0x91,0x31,0xA6,0x7E,0x80,0x31,0xFA,
+    0x23,0x38,0xC2,0xBA,0x1D,0x81,0x59,0x80,
+    0x1C,0xF2,0x9D,0xB0,0x42,0x7E,0xFC,0x33,
+    0x48,0x32,0x1C,0xC6,0x46,0x28,0x04,0x7F,
+    0xDB,0xC1,0x41,0x7F,0x0B,0x7C,0x90,0x11,
+    0xD1,0xE5,0x8E,0x2D,0x62,0x56,0x0C,0x38,
+    0x1A,0x8F,0xE7,0xF8,0x04,0xE7,0x42,0x3C,
+    0x47,0xC0,0x27,0x38,0x22,0x3F,0x20,0x8E,
+    0x09,0x0F,0xC8,0x7E,0x09,0x0F,0xC8,0x7E,
+    0x58,
+
+    /* Access unit 16 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0xE3,0xC0,
+    0x1C,0xF7,0x17,0x80,0x51,0xD4,0xD6,0x77,
+    0x80,0x9A,0xDB,0x45,0x31,0x7F,0x0A,0xC0,
+    0x60,0xAC,0xDC,0xCB,0x49,0x4A,0xFB,0xFB,
+    0x79,0x7E,0x98,0x09,0x43,0xF9,0xFC,0xFF,
+    0x00,0x9C,0xF1,0x1E,0x23,0xC4,0x70,0x44,
+    0x7F,0x3F,0x04,0xE7,0xE0,0xA0,0xFC,0xF0
+};
+
+/* 640 x 480 H.264 test stream: colour bars with the frame number burned in (tools/fx3_uvc_h26x_frames.py).
+ * One GOP of 16 Annex B access units, IDR first; profile_idc 66, constraint flags 0xC0, level_idc 31.
+ * Constant QP 40.
+ * Access units of 43 to 1468 bytes, 2400 bytes in all. */
+const uint32_t glVidFrameLenH264_640x480_QP40[16] = {
+    1468, 81, 61, 75, 74, 68, 63, 68,
+    54, 71, 65, 51, 50, 52, 56, 43
+};
+
+const uint8_t glUVCVidFramesH264_640x480_QP40[] __attribute__ ((aligned (32))) =
+{
+    /* Access unit 1 (IDR) */
+    0x00,0x00,0x00,0x01,0x67,0x42,0xC0,0x1F,
+    0xDA,0x02,0x80,0xF6,0x84,0x00,0x00,0x03,
+    0x00,0x04,0x00,0x00,0x03,0x00,0x7A,0x3C,
+    0x60,0xCA,0x80,0x00,0x00,0x00,0x01,0x68,
+    0xCE,0x03,0x92,0xC8,0x00,0x00,0x01,0x65,
+    0x88,0x84,0x3F,0x26,0x28,0x00,0x08,0x02,
+    0x49,0xC9,0xC9,0xC9,0xC6,0x60,0xAD,0xA6,
+    0x08,0x00,0x45,0x9B,0x10,0x06,0x11,0x00,
+    0x61,0x7B,0x88,0xDE,0xF2,0x72,0x72,0x72,
+    0x7F,0x0F,0xFF,0x82,0xBC,0xBF,0x10,0x00,
+    0x0B,0x80,0x34,0x40,0x00,0x24,0x01,0x60,
+    0x74,0x45,0xB9,0x87,0x44,0x5B,0x98,0x1E,
+    0x62,0xB9,0x87,0x98,0xAE,0x62,0x37,0x79,
+    0x39,0x39,0x39,0x3F,0x0F,0xFF,0xC1,0x5C,
+    0xBF,0xC4,0x20,0x00,0x20,0x17,0x1C,0xC0,
+    0xF2,0x15,0xCC,0x3C,0x85,0x73,0xF1,0x18,
+    0xBB,0x44,0x77,0x93,0x93,0xFF,0x87,0xFC,
+    0x16,0x62,0x1F,0x88,0x00,0x9A,0x20,0x00,
+    0x23,0x60,0xF0,0x70,0x83,0xC1,0xC2,0x0F,
+    0x01,0xC2,0x0F,0x01,0xC0,0x99,0x79,0x39,
+    0x39,0x39,0x3F,0xF6,0xF8,0x78,0x2C,0xBB,
+    0xE2,0x00,0x01,0x40,0xF1,0x15,0x85,0x37,
+    0x24,0x9B,0x9E,0x23,0x5A,0x93,0x93,0x93,
+    0x93,0xF8,0x7F,0xFC,0x15,0xE2,0x8F,0x10,
+    0x00,0x10,0x01,0xA2,0x00,0x10,0x02,0xC1,
+    0xE0,0x6C,0x60,0xF0,0x36,0x20,0xE8,0x26,
+    0x30,0x74,0x13,0x11,0x1A,0xD4,0x47,0xE9,
+    0x39,0x39,0x3A,0xEB,0xAE,0xBA,0xE6,0x7F,
+    0x53,0xD7,0x5D,0x75,0xD3,0xBA,0x7A,0xEB,
+    0xAE,0xBA,0x75,0x27,0x7D,0xF7,0xD3,0xD7,
+    0x5D,0x75,0xD7,0x4F,0x23,0xDF,0x7D,0xF7,
+    0xD3,0xC9,0xDF,0x7D,0xF7,0xD7,0x5D,0x75,
+    0xD7,0x4F,0x4F,0x5D,0x75,0xD7,0x4F,0x4F,
+    0x5D,0x75,0xD7,0x4F,0x5D,0x75,0xD7,0x4F,
+    0x5D,0x75,0xD7,0x5D,0x3D,0x3D,0x75,0xD7,
+    0x5D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD3,0xD3,
+    0xD7,0x5D,0x75,0xD3,0xD7,0x5D,0x75,0xD3,
+    0xD7,0x5D,0x75,0xD7,0x4F,0x4F,0x5D,0x75,
+    0xD7,0x4F,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x74,0xF4,0xF5,0xD7,0x5D,0x74,0xF4,
+    0xF5,0xD7,0x5D,0x74,0xF5,0xD7,0x5D,0x74,
+    0xF5,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,
+    0x75,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,0x3D,
+    0x3D,0x75,0xD7,0x5D,0x3D,0x75,0xD7,0x5D,
+    0x3D,0x75,0xD7,0x5D,0x74,0xF4,0xF5,0xD7,
+    0x5D,0x74,0xF5,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x4F,0x4F,0x5D,0x75,0xD7,0x4F,
+    0x4F,0x5D,0x75,0xD7,0x4F,0x5D,0x75,0xD7,
+    0x4F,0x5D,0x75,0xD7,0x5D,0x3D,0x3D,0x75,
+    0xD7,0x5D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD3,
+    0xD3,0xD7,0x5D,0x75,0xD3,0xD7,0x5D,0x75,
+    0xD3,0xD7,0x5D,0x75,0xD7,0x4F,0x4F,0x5D,
+    0x75,0xD7,0x4F,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x74,0xF4,0xF5,0xD7,0x5D,0x74,
+    0xF4,0xF5,0xD7,0x5D,0x74,0xF5,0xD7,0x5D,
+    0x74,0xF5,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,
+    0x5D,0x75,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,
+    0x3D,0x3D,0x75,0xD7,0x5D,0x3D,0x75,0xD7,
+    0x5D,0x3D,0x75,0xD7,0x5D,0x74,0xF4,0xF5,
+    0xD7,0x5D,0x74,0xF5,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x4F,0x4F,0x5D,0x75,0xD7,
+    0x4F,0x4F,0x5D,0x75,0xD7,0x4F,0x5D,0x75,
+    0xD7,0x4F,0x5D,0x75,0xD7,0x5D,0x3D,0x3D,
+    0x75,0xD7,0x5D,0x3D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,
+    0xD3,0xD3,0xD7,0x5D,0x75,0xD3,0xD7,0x5D,
+    0x75,0xD3,0xD7,0x5D,0x75,0xD7,0x4F,0x4F,
+    0x5D,0x75,0xD7,0x4F,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x74,0xF4,0xF5,0xD7,0x5D,
+    0x74,0xF4,0xF5,0xD7,0x5D,0x74,0xF5,0xD7,
+    0x5D,0x74,0xF5,0xD7,0x5D,0x75,0xD3,0xD3,
+    0xD7,0x5D,0x75,0xD3,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x3D,0x3D,0x75,0xD7,
+    0x5D,0x3D,0x3D,0x75,0xD7,0x5D,0x3D,0x75,
+    0xD7,0x5D,0x3D,0x75,0xD7,0x5D,0x74,0xF4,
+    0xF5,0xD7,0x5D,0x74,0xF5,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x4F,0x4F,0x5D,0x75,
+    0xD7,0x4F,0x4F,0x5D,0x75,0xD7,0x4F,0x5D,
+    0x75,0xD7,0x4F,0x5D,0x75,0xD7,0x5D,0x3D,
+    0x3D,0x75,0xD7,0x5D,0x3D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,
+    0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD3,0xD7,
+    0x5D,0x75,0xD3,0xD7,0x5D,0x75,0xD7,0x4F,
+    0x4F,0x5D,0x75,0xD7,0x4F,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x74,0xF4,0xF5,0xD7,
+    0x5D,0x74,0xF4,0xF5,0xD7,0x5D,0x74,0xF5,
+    0xD7,0x5D,0x74,0xF5,0xD7,0x5D,0x75,0xD3,
+    0xD3,0xD7,0x5D,0x75,0xD3,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x3D,0x3D,0x75,
+    0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,0x3D,
+    0x75,0xD7,0x5D,0x3D,0x75,0xD7,0x5D,0x74,
+    0xF4,0xF5,0xD7,0x5D,0x74,0xF5,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x4F,0x4F,0x5D,
+    0x75,0xD7,0x4F,0x4F,0x5D,0x75,0xD7,0x4F,
+    0x5D,0x75,0xD7,0x4F,0x5D,0x75,0xD7,0x5D,
+    0x3D,0x3D,0x75,0xD7,0x5D,0x3D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,
+    0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD3,
+    0xD7,0x5D,0x75,0xD3,0xD7,0x5D,0x75,0xD7,
+    0x4F,0x4F,0x5D,0x75,0xD7,0x4F,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xF4,0xF5,
+    0xD7,0x5D,0x74,0xF4,0xF5,0xD7,0x5D,0x74,
+    0xF5,0xD7,0x5D,0x74,0xF5,0xD7,0x5D,0x75,
+    0xD3,0xD3,0xD7,0x5D,0x75,0xD3,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x3D,0x3D,
+    0x75,0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,
+    0x3D,0x75,0xD7,0x5D,0x3D,0x75,0xD7,0x5D,
+    0x74,0xF4,0xF5,0xD7,0x5D,0x74,0xF5,0xD7,
+    0x5D,0x75,0xD6,0x0E,0x00,0x02,0x02,0x80,
+    0x00,0xB8,0xFB,0xEF,0xBE,0x2F,0x19,0xC0,
+    0x56,0xD3,0x10,0x18,0x77,0xCE,0xA0,0xEB,
+    0xCF,0xCE,0xB8,0xAD,0x6D,0x6D,0x78,0x7E,
+    0x21,0x80,0x70,0x55,0x19,0x61,0x4C,0x78,
+    0x0E,0x88,0xB7,0x3E,0x07,0x98,0xAE,0x7C,
+    0xEB,0x7B,0x5B,0x5B,0x5B,0x5C,0x3F,0x80,
+    0x60,0x1C,0x15,0x43,0x05,0xEC,0x2B,0x64,
+    0x07,0x90,0xAE,0x7F,0xCE,0xB8,0xD3,0xAD,
+    0xED,0x6D,0x61,0x7C,0x08,0x9B,0x92,0xEF,
+    0xEB,0x5F,0xF3,0x23,0x28,0x3C,0x1C,0x38,
+    0x3C,0x07,0x0C,0xEA,0x4C,0x4C,0x9A,0xDA,
+    0xDA,0xDA,0xC5,0xE1,0xA1,0xE1,0x74,0x21,
+    0x22,0x38,0x53,0x73,0xFB,0x53,0xE3,0x5B,
+    0x5B,0x5B,0x58,0xAC,0x01,0xA2,0xE4,0xDC,
+    0x78,0x0E,0x04,0x94,0x0E,0xBC,0x1E,0x06,
+    0xC7,0x07,0x41,0x31,0xDA,0xDA,0xDA,0xDA,
+    0xDA,0xD6,0xE5,0xFF,0xF9,0x82,0x3C,0x30,
+    0xAC,0x00,0x81,0x6B,0xD9,0xE2,0xF7,0xDD,
+    0x7A,0x4F,0xC6,0x3D,0xC5,0x90,0xB4,0x21,
+    0xE8,0x2E,0xBF,0x5F,0x80,0x4F,0x52,0x1D,
+    0xAA,0x46,0xF7,0xF0,0x14,0x2E,0x7C,0xCF,
+    0x82,0x6C,0xE6,0x2A,0xA6,0x7B,0xFD,0x7C,
+    0x9C,0xE1,0xEA,0xBF,0xE8,0x2C,0xCF,0x0C,
+    0x2B,0x8B,0x9A,0x42,0x9A,0xEA,0xE5,0x56,
+    0x82,0x0B,0xFC,0x2D,0x3E,0xEF,0x46,0xDD,
+    0xC0,0x10,0xFE,0xBA,0xD8,0xDB,0xEC,0x0A,
+    0xC9,0xC9,0xB6,0xF6,0x57,0xFD,0x22,0xF2,
+    0xD1,0x4E,0x7D,0xF7,0x6A,0x28,0xD2,0x39,
+    0xDF,0x6E,0xFF,0xAF,0x0D,0xA1,0x58,0x6E,
+    0x7C,0xEE,0x87,0x16,0xC0,0x29,0x2F,0x74,
+    0x8F,0xD3,0x4E,0x24,0xAA,0xAF,0x78,0x9B,
+    0x70,0xF5,0x5E,0x00,0xC3,0x7E,0xF1,0x5A,
+    0xEC,0x6C,0x19,0xEC,0xD7,0x3A,0xFF,0x89,
+    0x87,0xD0,0x20,0xB5,0x99,0xBC,0x0F,0xA6,
+    0x43,0x3A,0xD1,0x6A,0x6A,0xE8,0x3D,0x99,
+    0x27,0x6B,0x6B,0x6B,0x6B,0x7C,0xEB,0xEB,
+    0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,
+    0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,
+    0xEF,0x9F,0xBD,0xF7,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xEA,0xF9,0xAF,0xFF,0x09,0x52,
+    0xD5,0x63,0x77,0xCE,0x77,0x31,0xFE,0x7D,
+    0x23,0x58,0xDC,0x8F,0xD7,0xAE,0x59,0xA7,
+    0xEF,0xB4,0x93,0xEB,0x8E,0x7F,0xDE,0x9E,
+    0xE7,0xBD,0x72,0x5B,0xF6,0x2F,0xFF,0xEE,
+    0xBC,0xA1,0xFF,0x09,0x41,0x42,0x9A,0xA7,
+    0xFF,0x03,0xEF,0xC5,0xBF,0xFF,0x87,0xB8,
+    0x62,0xFE,0x7D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5C,
+    0xDD,0xEB,0xAE,0x6E,0xF5,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x6E,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xFE,0x3F,0xFF,0x0F,
+    0x71,0x40,0x00,0x40,0x03,0x7A,0xBF,0xC7,
+    0xC3,0xFE,0x45,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5C,0xDD,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0x55,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xCD,0xDE,0xBA,0xE6,0xEF,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5C,0xDD,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xF0,
+
+    /* Access unit 2 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0x23,0xC0,
+    0x1C,0xF5,0xCB,0x28,0xD8,0x19,0x6C,0x9F,
+    0x84,0xA3,0x32,0x9D,0x6D,0xD8,0x14,0x5D,
+    0xC4,0x75,0xD3,0x3F,0xE0,0x4B,0x3F,0x89,
+    0xF3,0x7E,0x38,0x7F,0x0F,0x78,0x1E,0x0C,
+    0xC8,0x30,0x43,0xC4,0x78,0x8F,0x37,0xF8,
+    0x7F,0x87,0xB8,0x3A,0x09,0x4C,0x11,0x1F,
+    0xCF,0xE7,0xCB,0xD1,0xFC,0xFE,0x7E,0x08,
+    0x8F,0xE7,0xF3,0xF4,0x7F,0x3F,0x9F,0x82,
+    0x23,0xF9,0xFC,0xFD,0x1F,0xCF,0xE7,0xE0,
+    0x8A,
+
+    /* Access unit 3 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0x43,0xC0,
+    0x1C,0xF5,0x22,0xE7,0x64,0x08,0x7B,0x5D,
+    0xFC,0xB4,0x5F,0x25,0xEF,0xC0,0x3A,0x88,
+    0xF1,0x1E,0x6F,0xFF,0x87,0x0F,0xF8,0x0E,
+    0x98,0xC2,0x26,0x21,0x1B,0xC4,0x7C,0x02,
+    0x73,0x82,0x23,0xF9,0xFC,0xFD,0x0A,0xE0,
+    0x90,0xFE,0x7F,0x3F,0x47,0xE0,0x90,0xFE,
+    0x7F,0x3F,0x47,0xE0,0x8A,
+
+    /* Access unit 4 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0x63,0xC0,
+    0x1C,0xF2,0xE4,0x2C,0x09,0x3D,0x85,0x2D,
+    0xF2,0xAB,0x26,0xDA,0x6F,0xE7,0x03,0xBF,
+    0xAF,0xDB,0xE6,0xFF,0x60,0x51,0x83,0x07,
+    0xFA,0xF8,0x9E,0xF8,0x13,0xC4,0x78,0x8F,
+    0x11,0xF0,0x09,0xCC,0xBA,0x74,0xE2,0x3C,
+    0x47,0x88,0xE0,0x88,0xFE,0x7E,0x8F,0xE7,
+    0xF3,0xF9,0xF8,0x22,0x3F,0x67,0xF3,0xF9,
+    0xFC,0xFC,0x11,0x1F,0xB3,0xF9,0xFC,0xFE,
+    0x7E,0x1E,0x80,
+
+    /* Access unit 5 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0x83,0xC0,
+    0x1C,0xF2,0xD8,0x7C,0xB0,0x11,0x7F,0x4F,
+    0xF9,0x57,0xD3,0xA3,0x12,0x7C,0x92,0xDF,
+    0xA8,0x62,0x6E,0x0A,0x0C,0xA5,0xFF,0xFC,
+    0x3D,0xB9,0xFB,0xF8,0x14,0x8F,0xE2,0x3E,
+    0x01,0x31,0xD0,0x8F,0x11,0xE6,0xC4,0x7E,
+    0x1F,0xC3,0xDE,0x0E,0x82,0x52,0x08,0x8F,
+    0xC8,0x7F,0x3F,0x9F,0x82,0x23,0xF2,0x1F,
+    0xCF,0xE7,0xE0,0x88,0xFC,0x87,0xF3,0xF9,
+    0xF8,0x6E,
+
+    /* Access unit 6 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0xA3,0xC0,
+    0x1C,0xF1,0x7F,0xFC,0xB8,0x6B,0x3E,0x9D,
+    0x5E,0x0A,0x1D,0x70,0x2A,0x08,0xF1,0x1E,
+    0x7F,0x37,0x1F,0x0F,0xF0,0xF7,0x01,0xD3,
+    0x18,0x44,0xCF,0x03,0x6F,0x11,0xF0,0x09,
+    0xCE,0x08,0x8F,0xE7,0xF3,0xF9,0xF1,0x5A,
+    0x3F,0xAF,0x82,0x23,0xF9,0xFC,0xFE,0x7E,
+    0x8F,0xEB,0xE0,0x88,0xFE,0x7F,0x3F,0x9F,
+    0xA3,0xFA,0xF8,0x66,
+
+    /* Access unit 7 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0xC3,0xC0,
+    0x1C,0xF3,0x08,0x2C,0xB0,0xD8,0x9C,0x00,
+    0x42,0xFE,0x44,0x6F,0xE4,0x6A,0xB2,0x66,
+    0xF0,0x50,0x14,0xF4,0x76,0xEB,0xFF,0xFE,
+    0x05,0x73,0xF9,0xFE,0x01,0x39,0xF0,0x15,
+    0x3C,0x47,0x88,0xF8,0x04,0xE7,0x04,0x47,
+    0xE5,0x3F,0xBF,0x82,0x23,0xF2,0x9F,0xCF,
+    0xC1,0x11,0xF9,0x4F,0xE7,0xE1,0x68,
+
+    /* Access unit 8 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0xE3,0xC0,
+    0x1C,0xF1,0xBF,0xC5,0x43,0xE8,0x10,0x40,
+    0x20,0xEF,0xBA,0xBD,0x35,0xFD,0x55,0xDC,
+    0x06,0x1D,0x3A,0x72,0xC7,0xC6,0xAD,0x79,
+    0xEC,0x05,0x05,0xF2,0xFF,0x7B,0x9A,0x69,
+    0x1A,0xE7,0x81,0x64,0xFE,0x7F,0x80,0x4C,
+    0x74,0x23,0xC4,0x7C,0x02,0x63,0x82,0x23,
+    0xF2,0x1F,0x82,0x43,0xF2,0x1F,0x82,0x43,
+    0xF2,0x1F,0x85,0xA0,
+
+    /* Access unit 9 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x03,0xC0,
+    0x1C,0xF6,0xE0,0xA0,0xCA,0x5F,0xFF,0xC3,
+    0xD1,0xCD,0xFC,0x0B,0x67,0xF3,0xF9,0xFE,
+    0x01,0x39,0xE2,0x3C,0x47,0x88,0xF3,0x7F,
+    0x87,0xF8,0x7B,0x80,0xF2,0x12,0xA6,0x60,
+    0x84,0xFE,0x7E,0x63,0xF0,0x42,0x7E,0x73,
+    0xF0,0x42,0x7E,0x73,0xF0,0x8C,
+
+    /* Access unit 10 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x23,0xC0,
+    0x1C,0xF1,0xBF,0xEB,0x08,0x68,0x2B,0x08,
+    0x9C,0x1D,0x24,0x35,0x2A,0x86,0x0B,0x78,
+    0x11,0x3F,0x39,0xC5,0xEC,0xFB,0xB2,0x39,
+    0x82,0x83,0x43,0x5F,0xFF,0x09,0x60,0x10,
+    0x6A,0xAD,0xBE,0xA6,0xE5,0x7C,0x0B,0xC7,
+    0xF3,0xFC,0x02,0x73,0xA1,0x1E,0x23,0xE0,
+    0x13,0x9C,0x11,0x1F,0x90,0xFC,0x12,0x1F,
+    0x90,0xFC,0x12,0x1F,0x90,0xFC,0x23,
+
+    /* Access unit 11 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x43,0xC0,
+    0x1C,0xF3,0x78,0x10,0x45,0xE0,0x6F,0xC9,
+    0x44,0x39,0x4D,0x00,0x11,0x53,0x79,0x23,
+    0xD5,0xBC,0x79,0x36,0x49,0x98,0x28,0x0B,
+    0x78,0x41,0xAA,0x6D,0xF8,0x3E,0x96,0xB7,
+    0xFF,0xFF,0x03,0x01,0xFC,0xFE,0x7F,0x80,
+    0x4C,0x78,0x8F,0x11,0xF0,0x09,0x8E,0x08,
+    0x8F,0xE7,0xE0,0x9C,0xFC,0x14,0x1F,0x84,
+    0xE0,
+
+    /* Access unit 12 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x63,0xC0,
+    0x1C,0xF3,0xC9,0x34,0x03,0x44,0x53,0xCB,
+    0x53,0x0B,0x49,0x82,0xF5,0xE0,0xA1,0xEA,
+    0x49,0x02,0x95,0xA6,0xF8,0x18,0xCF,0xE7,
+    0xF8,0x04,0xE7,0x88,0xF1,0x1E,0x23,0xE0,
+    0x13,0x9C,0x11,0x1F,0x82,0x83,0xF0,0x50,
+    0x7E,0x10,0x80,
+
+    /* Access unit 13 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x83,0xC0,
+    0x1C,0xF7,0x17,0xE1,0xD7,0x2F,0x01,0xE2,
+    0xD2,0x9D,0xA7,0x78,0x08,0xD3,0xF9,0xFC,
+    0xFD,0x08,0xF1,0x1F,0x00,0x9C,0xE0,0x88,
+    0xFE,0x7F,0x3F,0x47,0xE0,0x90,0xFE,0x7F,
+    0x3F,0x47,0xE0,0x90,0xFE,0x7F,0x3F,0x47,
+    0xE2,0xA0,
+
+    /* Access unit 14 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0xA3,0xC0,
+    0x1C,0xF3,0xD8,0xF3,0x41,0x00,0x9A,0xCE,
+    0xC2,0x57,0xB5,0xDF,0xF1,0xA0,0x30,0x14,
+    0x3E,0x10,0x26,0x2E,0xEB,0x3F,0xE0,0x68,
+    0x3F,0x9F,0xE0,0x13,0x1E,0x23,0xC4,0x78,
+    0x8F,0x80,0x4C,0x70,0x44,0x7E,0x0A,0x0F,
+    0xC1,0x41,0xF8,0xB8,
+
+    /* Access unit 15 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0xC3,0xC0,
+    0x1C,0xF3,0xE0,0x94,0x5F,0x86,0xB9,0x40,
+    0x1D,0x74,0x54,0x70,0xA2,0x92,0xD7,0x82,
+    0x87,0x84,0x24,0xC8,0xD0,0xFB,0x6F,0x81,
+    0xA8,0xFE,0x7F,0x80,0x4E,0x74,0x23,0xC4,
+    0x7C,0x02,0x73,0x82,0x23,0xF2,0x1F,0x82,
+    0x43,0xF2,0x1F,0x82,0x43,0xF2,0x1F,0x96,
+
+    /* Access unit 16 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0xE3,0xC0,
+    0x1C,0xF7,0x17,0x91,0xF0,0x36,0xE4,0xC0,
+    0x43,0xF2,0xE5,0xFB,0x8A,0x40,0x4A,0x1F,
+    0xCF,0xE7,0xF8,0x04,0xE7,0x88,0xF1,0x1E,
+    0x23,0x82,0x23,0xF9,0xF8,0x27,0x3F,0x05,
+    0x07,0xE7,0x80
+};
+
+/* 1280 x 720 H.264 test stream: colour bars with the frame number burned in (tools/fx3_uvc_h26x_frames.py).
+ * One GOP of 16 Annex B access units, IDR first; profile_idc 66, constraint flags 0xC0, level_idc 31.
+ * Encoded at 600000 bits/s, average slice QP of the P pictures 1.
+ * Access units of 231 to 3529 bytes, 10757 bytes in all. */
+const uint32_t glVidFrameLenH264_1280x720[16] = {
+    3529, 348, 437, 971, 536, 505, 560, 382,
+    231, 693, 654, 338, 325, 454, 347, 447
+};
+
+const uint8_t glUVCVidFramesH264_1280x720[] __attribute__ ((aligned (32))) =
+{
+    /* Access unit 1 (IDR) */
+    0x00,0x00,0x00,0x01,0x67,0x42,0xC0,0x1F,
+    0xDA,0x01,0x40,0x16,0xE8,0x40,0x00,0x00,
+    0x03,0x00,0x40,0x00,0x00,0x07,0xA3,0xC6,
+    0x0C,0xA8,0x00,0x00,0x00,0x01,0x68,0xCE,
+    0x32,0xC8,0x00,0x00,0x01,0x65,0x88,0x84,
+    0x0E,0xF2,0x62,0x80,0x00,0x94,0x24,0x9C,
+    0x9C,0x9C,0x9C,0x9C,0x9C,0x9C,0x9C,0x9C,
+    0x9F,0xC3,0xFF,0xE1,0xA0,0x49,0x07,0xBF,
+    0xCF,0x10,0x00,0x0F,0x00,0x07,0x88,0x8A,
+    0x07,0x21,0x89,0x73,0x0E,0x43,0x12,0xE6,
+    0x58,0x65,0x84,0x44,0x3E,0x28,0x0D,0x1F,
+    0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,
+    0x27,0xFF,0x0F,0xF8,0x2C,0x0F,0x41,0x48,
+    0xD3,0x38,0x80,0x00,0x54,0x34,0x40,0x00,
+    0x20,0x17,0x07,0x08,0x2C,0x20,0xE4,0x00,
+    0xE1,0x07,0x10,0x05,0x08,0x38,0x80,0x28,
+    0x08,0x87,0xCF,0x03,0x10,0x05,0x10,0xF9,
+    0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,
+    0x39,0x38,0xC8,0x70,0x07,0x0B,0x30,0x15,
+    0x30,0x40,0x00,0x2C,0x00,0x02,0x01,0x71,
+    0x10,0x50,0x70,0x41,0x18,0xC1,0xC1,0x04,
+    0x62,0x2B,0x8A,0xE2,0x20,0x8E,0x8E,0x32,
+    0x72,0x72,0x72,0x72,0x72,0x72,0x72,0x72,
+    0x7F,0xE1,0xFF,0x82,0xC0,0x50,0x3B,0x4B,
+    0xE2,0x00,0x01,0xF0,0x1A,0x20,0x00,0x08,
+    0x03,0x80,0x36,0x0E,0x20,0x0E,0x10,0x71,
+    0x00,0x70,0x83,0x82,0x0F,0x08,0x38,0x20,
+    0xF0,0x11,0x05,0x22,0x80,0x01,0x98,0xE0,
+    0x00,0x76,0x3E,0x4E,0x4E,0x4E,0x4E,0x4E,
+    0x4E,0x4E,0x4E,0x4E,0x4F,0xC3,0xFF,0xF0,
+    0x56,0x08,0x81,0xEF,0xF8,0x80,0x10,0x00,
+    0x10,0x17,0x8D,0x00,0xC0,0xE1,0x30,0xD7,
+    0x30,0xE1,0x30,0xD7,0x33,0xC3,0x3C,0x22,
+    0x21,0xD1,0x40,0xC7,0x63,0xE4,0xE4,0xE4,
+    0xE4,0xE4,0xE4,0xE4,0xE4,0xE4,0xFF,0xC3,
+    0xFF,0x05,0x80,0x80,0x14,0x8D,0x33,0x9E,
+    0x20,0x00,0x08,0x05,0x80,0x1A,0x20,0x00,
+    0x08,0x02,0x00,0x2E,0x07,0x4C,0x77,0x21,
+    0xD3,0x1D,0xC8,0x1E,0x45,0x72,0x1E,0x45,
+    0x70,0x44,0x13,0x8A,0x00,0x06,0x63,0x8C,
+    0x70,0x00,0x2B,0x27,0x27,0x27,0x27,0x27,
+    0x27,0x27,0x27,0x27,0x27,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x4F,0x4F,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,
+    0xF4,0xF5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD3,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x74,0xF4,0xF5,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x4F,0x4F,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xF4,
+    0xF5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,
+    0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x3D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x74,0xF4,0xF5,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x4F,0x4F,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xF4,0xF5,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x3D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x74,0xF4,0xF5,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x4F,0x4F,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x74,0xF4,0xF5,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x3D,
+    0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,
+    0xF4,0xF5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x4F,0x4F,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x74,0xF4,0xF5,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x3D,0x3D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xF4,
+    0xF5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD3,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x4F,0x4F,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x74,0xF4,0xF5,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x3D,0x3D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xF4,0xF5,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,
+    0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x4F,0x4F,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x74,0xF4,0xF5,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x3D,0x3D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x74,0xF4,0xF5,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x4F,
+    0x4F,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x74,0xF4,0xF5,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x74,0xF4,0xF5,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x4F,0x4F,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,
+    0xF4,0xF5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD3,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x74,0xF4,0xF5,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x4F,0x4F,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xF4,
+    0xF5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,
+    0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x3D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x74,0xF4,0xF5,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x4F,0x4F,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xF4,0xF5,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x3D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x74,0xF4,0xF5,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x4F,0x4F,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x74,0xF4,0xF5,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x3D,
+    0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,
+    0xF4,0xF5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x4F,0x4F,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x74,0xF4,0xF5,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x3D,0x3D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xF4,
+    0xF5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD3,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x4F,0x4F,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x74,0xF4,0xF5,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x3D,0x3D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xF4,0xF5,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,
+    0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x4F,0x4F,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x74,0xF4,0xF5,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x3D,0x3D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x74,0xF4,0xF5,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x4F,
+    0x4F,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x74,0xF4,0xF5,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x74,0xF4,0xF5,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x4F,0x4F,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,
+    0xF4,0xF5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD3,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x74,0xF4,0xF5,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x4F,0x4F,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xF4,
+    0xF5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,
+    0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x3D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x74,0xF4,0xF5,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x4F,0x4F,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xF4,0xF5,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x3D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x74,0xF4,0xF5,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x4F,0x4F,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x74,0xF4,0xF5,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x3D,
+    0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,
+    0xF4,0xF5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x4F,0x4F,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x74,0xF4,0xF5,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x3D,0x3D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xF4,
+    0xF5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD3,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x4F,0x4F,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x74,0xF4,0xF5,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x3D,0x3D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xF4,0xF5,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,
+    0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x4F,0x4F,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x74,0xF4,0xF5,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x3D,0x3D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x74,0xF4,0xF5,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x4F,
+    0x4F,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x74,0xF4,0xF5,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x74,0xF4,0xF5,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x4F,0x4F,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,
+    0xF4,0xF5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD3,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x74,0xF4,0xF5,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x4F,0x4F,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xF4,
+    0xF5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,
+    0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x3D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x74,0xF4,0xF5,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x4F,0x4F,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xF4,0xF5,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x3D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x74,0xF4,0xF5,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x4F,0x4F,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x74,0xF4,0xF5,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x3D,
+    0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,
+    0xF4,0xF5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x4F,0x4F,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x74,0xF4,0xF5,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x3D,0x3D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xF4,
+    0xF5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD3,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x4F,0x4F,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x74,0xF4,0xF5,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x3D,0x3D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xF4,0xF5,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,
+    0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x4F,0x4F,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x74,0xF4,0xF5,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x3D,0x3D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x74,0xF4,0xF5,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x4F,
+    0x4F,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x74,0xF4,0xF5,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x74,0xF4,0xF5,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0xFF,0xF1,0xF8,
+    0x20,0x05,0x58,0xA0,0x00,0x20,0x17,0xBE,
+    0xFB,0xEF,0xBE,0xFB,0xEF,0xBE,0xFE,0x1F,
+    0xE2,0x18,0x03,0x05,0x50,0x88,0x6A,0x42,
+    0xAC,0x01,0xC7,0x49,0x9E,0x79,0xE0,0x01,
+    0x33,0xD3,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,
+    0x6B,0x6B,0x6B,0x6B,0xFC,0x3C,0x7C,0x18,
+    0x2A,0x84,0x83,0x41,0x03,0xED,0xE2,0x00,
+    0x04,0xC8,0x10,0x23,0x76,0x9C,0xDA,0x60,
+    0x98,0x2C,0x75,0x63,0xAA,0xD8,0x9D,0x7D,
+    0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,
+    0x6B,0xC3,0xFC,0x43,0x00,0x60,0xAA,0x14,
+    0xD9,0x08,0x00,0x22,0x2C,0x0B,0x1C,0x6D,
+    0x23,0x80,0x4C,0xE0,0xC0,0x06,0x48,0x70,
+    0x02,0x64,0xEB,0xA9,0xD7,0xD3,0xAF,0x2B,
+    0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5F,0xC3,
+    0xE3,0xC0,0x18,0x2A,0x84,0x2C,0x58,0x20,
+    0x54,0x9B,0x10,0x02,0x64,0x11,0x00,0xC6,
+    0xAB,0x62,0x00,0x13,0x20,0x2B,0x0E,0x12,
+    0xAC,0x74,0x57,0xE2,0x64,0xD6,0xD6,0xD6,
+    0xD6,0xD6,0xD6,0xD6,0xD6,0xD6,0xD7,0x0F,
+    0xF8,0x06,0x00,0xC1,0x54,0x0C,0xE8,0x40,
+    0x00,0x20,0x15,0x60,0x0E,0x5B,0x2C,0xF3,
+    0xC7,0x8B,0xC4,0x80,0x04,0xC8,0x90,0x00,
+    0x99,0x6A,0xAD,0x6D,0x6D,0x6D,0x6D,0x6D,
+    0x6D,0x6D,0x6D,0x7F,0x0F,0x8F,0x00,0x60,
+    0xAA,0x10,0x0E,0x37,0x08,0x09,0x0A,0x5C,
+    0x51,0x60,0x27,0xCC,0x0B,0x6B,0xD8,0x90,
+    0x00,0x99,0x08,0xF9,0xF0,0x52,0x28,0x69,
+    0x96,0xA7,0x5F,0x5B,0x7D,0x6D,0xB5,0xB5,
+    0xB5,0xB5,0xB5,0xB5,0xB5,0xB5,0xB5,0xB5,
+    0xA8,0x23,0x14,0x00,0x04,0x01,0x2F,0xBE,
+    0xFB,0xEF,0xBE,0xFB,0xEF,0xBE,0xD6,0xD6,
+    0xD6,0xD6,0xD6,0xD6,0xD6,0xD6,0xD6,0xD6,
+    0xD6,0xD6,0xD6,0xD6,0xD6,0xD6,0xD6,0xD6,
+    0xD6,0xD6,0xD6,0xD6,0xD6,0xD6,0xD6,0xD6,
+    0xD6,0xD6,0xD6,0xD6,0xD6,0xD6,0xD6,0xD6,
+    0xD6,0xD6,0xD6,0xD6,0xD6,0xD6,0xD6,0xD6,
+    0xD6,0xD6,0xD6,0xD6,0xD6,0xD6,0xD6,0xD6,
+    0xD6,0xD6,0xD6,0xD6,0xD6,0xD6,0xD6,0xD6,
+    0xD6,0xD6,0xD6,0xD6,0xD6,0xD6,0xD6,0xD6,
+    0xD6,0xD6,0xD6,0xBA,0xEB,0xAF,0xE1,0x8A,
+    0x83,0x05,0x4B,0xB0,0x51,0x80,0x03,0x25,
+    0x5B,0xCC,0x69,0x6A,0x05,0x2B,0x3F,0x56,
+    0x9B,0x86,0x97,0x60,0x61,0xF5,0x0B,0x31,
+    0xDB,0x64,0x7F,0xFC,0x0B,0x70,0x67,0xB2,
+    0x1A,0xC0,0x32,0xF4,0x0D,0x98,0xE5,0x19,
+    0x93,0x6F,0xDD,0xEC,0x3B,0xFB,0x66,0x43,
+    0xFF,0xE6,0xCA,0xE3,0x86,0x88,0xC8,0xAC,
+    0xFF,0xF5,0xFF,0xFF,0x5D,0x28,0x5A,0x37,
+    0x7C,0x1E,0x8E,0xAB,0x09,0x53,0xB9,0x7B,
+    0xF0,0x14,0x1C,0xD1,0x32,0x17,0x36,0xDF,
+    0xFE,0x06,0xD9,0x39,0x79,0xD0,0x33,0x7F,
+    0xF4,0x1B,0x93,0x36,0x26,0xF2,0xAC,0xD9,
+    0x3D,0x29,0xC6,0xAA,0xB8,0x98,0xF2,0xD9,
+    0x6B,0x77,0x42,0x96,0x5D,0xFF,0xFF,0xE8,
+    0xC8,0x5A,0xC2,0xDF,0xEF,0x46,0xBC,0xE0,
+    0x0C,0x4D,0x3F,0xD2,0xF3,0xFF,0xBF,0x9D,
+    0xB4,0x08,0x5F,0x07,0x1F,0x1E,0xA1,0x0D,
+    0x1B,0x9E,0x07,0x7A,0x07,0xD9,0x11,0x41,
+    0x1F,0xFA,0x6C,0x14,0x2D,0x7E,0x72,0x96,
+    0x4F,0xB7,0xF0,0x48,0x53,0x67,0xB1,0x91,
+    0xF6,0xF1,0x3E,0xFB,0xCF,0x44,0x94,0xCC,
+    0xED,0x89,0x49,0x39,0xFE,0x50,0xD2,0x2D,
+    0x75,0xDA,0xFF,0xBF,0x9D,0x03,0x1C,0x8D,
+    0x72,0xF7,0xFB,0xFF,0xDC,0xF7,0x8B,0x61,
+    0x0C,0x4F,0x01,0xAB,0x7D,0x92,0x4C,0x1B,
+    0x51,0x65,0x9B,0x95,0x57,0x7C,0x07,0xF6,
+    0xDF,0x81,0x0B,0x93,0x52,0x60,0x3D,0x7C,
+    0x8E,0x4B,0xDC,0x0E,0x17,0x81,0x7D,0x67,
+    0x47,0xDF,0x6F,0xF5,0x05,0x35,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5F,0xC7,
+    0xFF,0xE1,0xE0,0x59,0x81,0xC2,0x0A,0x73,
+    0x2D,0xED,0x3E,0xFB,0xFC,0x78,0xFC,0x3C,
+    0x3F,0xC0,0x17,0x49,0x86,0x73,0x21,0xB9,
+    0xFA,0x82,0xDA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0x14,0x00,0x0C,0x57,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x78,
+
+    /* Access unit 2 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0x20,0x3F,
+    0xC1,0x7C,0x21,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFC,0x74,0x21,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xE0,0xBF,0xC2,0xFE,0x0E,0x7C,0x2F,
+    0xE0,0xE7,0xC2,0xFE,0x0E,0x7C,0x2F,0xE0,
+    0xE7,0xC2,0xFE,0x0E,0x7C,0x2F,0xE0,0xE7,
+    0xC2,0xFE,0x0E,0x7C,0x2F,0xE0,0xE7,0xC2,
+    0xFE,0x0E,0x7C,0x2F,0xE0,0xE7,0xC2,0xFE,
+    0x0E,0x7C,0x2F,0xE0,0xE7,0xC2,0xFE,0x0E,
+    0x7C,0x2F,0xE0,0xE7,0xC2,0xFE,0x0E,0x7C,
+    0x2F,0xE0,0xE7,0xC2,0xFE,0x0E,0x7C,0x2F,
+    0xE0,0xE7,0xC2,0xFE,0x0E,0x7C,0x2F,0xE0,
+    0xE7,0xC2,0xFE,0x0E,0x7C,0x2F,0xE0,0xE7,
+    0xC2,0xFE,0x0E,0x7C,0x2F,0xE0,0xE7,0xC2,
+    0xFE,0x0E,0x7C,0x2F,0xE0,0xE7,0xC2,0xFE,
+    0x0E,0x7C,0x2F,0xE0,0xE7,0xC2,0xFE,0x0E,
+    0x7C,0x2F,0xE0,0xE7,0xC2,0xFE,0x0E,0x7C,
+    0x2F,0xE0,0xE7,0xA0,0x49,0xD0,0xBF,0x8B,
+    0xC3,0x18,0x88,0x25,0xC4,0x78,0x8F,0x11,
+    0xE2,0x3C,0x47,0x88,0xF1,0x1E,0x23,0xC4,
+    0x7E,0x10,0xF0,0x87,0x84,0x3C,0x21,0xE1,
+    0x0F,0x08,0x78,0x43,0xC2,0x1E,0x10,0xF0,
+    0x87,0x84,0x3C,0x21,0x0C,0x08,0xFC,0x44,
+    0x4E,0x18,0xF1,0x11,0x9E,0x2F,0xC9,0x86,
+    0x6F,0x8C,0x05,0x1C,0xCB,0xE0,0x01,0xBC,
+    0x41,0xE4,0xD4,0x73,0xAB,0x63,0xFF,0xAF,
+    0x82,0x6D,0xEE,0xFF,0x84,0x8A,0x8C,0x6E,
+    0x15,0x5B,0xCB,0x72,0xBC,0x18,0x72,0x78,
+    0x24,0xF0,0xB7,0x8B,0xF1,0x7E,0x09,0x3C,
+    0x2D,0xE2,0xFC,0x5F,0x82,0x4F,0x0B,0x78,
+    0xC3,0xC1,0x4E,0x7F,0x3F,0x9F,0x9F,0xC1,
+    0x27,0x85,0xBC,0x59,0xFC,0xFE,0x7F,0x3F,
+    0x9B,0xFF,0xE1,0xC3,0xE0,0x9B,0x80,0x0D,
+    0x93,0x86,0xA4,0x33,0x9C,0x87,0xAB,0xD8,
+    0x13,0xF8,0x8F,0x11,0xE2,0x3C,0x47,0xC0,
+    0x13,0xCE,0x09,0x7C,0x2D,0xE2,0xCF,0x04,
+    0xF9,0xFC,0xFE,0x7F,0x3F,0x47,0xF3,0xF9,
+    0xF8,0x27,0xF0,0xB7,0x8B,0x3F,0x9F,0xCF,
+    0xE7,0xF3,0xF4,0x7F,0x3F,0x05,0x1E,0x16,
+    0xF1,0x67,0xF3,0xF9,0xFC,0xFE,0x7E,0x8F,
+    0xC1,0x4F,0x85,0xBC,0x59,0xFC,0xFE,0x7F,
+    0x3F,0x9F,0xA3,0xF0,0x53,0xE1,0x6F,0x16,
+    0x7F,0x3F,0x9F,0xCF,0xE7,0xE8,0xFC,0x14,
+    0xF8,0x5B,0xC5,0xC0,
+
+    /* Access unit 3 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0x40,0x13,
+    0xF1,0x62,0x7F,0xA0,0x48,0xE8,0xBE,0x09,
+    0xF7,0xBD,0xEF,0x51,0x9C,0x13,0x56,0xB5,
+    0xAD,0xE2,0xF8,0x27,0x91,0x4E,0x45,0x32,
+    0x29,0x91,0x4F,0xF0,0x5C,0x3D,0xFD,0xF6,
+    0x3B,0x1C,0x58,0xF7,0xCB,0x45,0x45,0xE1,
+    0x71,0x6E,0x5F,0x32,0x0B,0x8E,0xF1,0x67,
+    0x78,0x5C,0xEF,0x05,0xC7,0x78,0xB3,0xBC,
+    0x2E,0x77,0x82,0xE3,0xBC,0x59,0xDE,0x17,
+    0x3B,0xC1,0x71,0xDE,0x2C,0xEF,0x0B,0x9D,
+    0xE0,0xB8,0xEF,0x16,0x77,0x85,0xCE,0xF0,
+    0x5C,0x77,0x8B,0x3B,0xC2,0xE7,0x78,0x2E,
+    0x3B,0xC5,0x9D,0xE1,0x73,0xBC,0x17,0x1D,
+    0xE2,0xCE,0xF0,0xB9,0xDE,0x0B,0x8E,0xF1,
+    0x67,0x78,0x5C,0xEF,0x05,0xC7,0x78,0xB3,
+    0xBC,0x2E,0x77,0x82,0xE3,0xBC,0x59,0xDE,
+    0x17,0x3B,0xC1,0x71,0xDE,0x2C,0xEF,0x0B,
+    0x9D,0xE0,0xB8,0xEF,0x16,0x77,0x85,0xCE,
+    0xF0,0x5C,0x77,0x8B,0x3B,0xC2,0xE7,0x78,
+    0x2E,0x3B,0xC5,0x9D,0xE1,0x73,0xBC,0x17,
+    0x1D,0xE2,0xCE,0xF0,0xB9,0xDE,0x0B,0x8E,
+    0xF1,0x67,0x78,0x5C,0xEF,0x05,0xC7,0x78,
+    0xB3,0xBC,0x2E,0x77,0x82,0xE3,0xBC,0x59,
+    0xDE,0x17,0x3B,0xC1,0x71,0xDE,0x2C,0xEF,
+    0x0B,0x9D,0xE0,0xB8,0xEF,0x16,0x77,0x85,
+    0xCE,0xF0,0x5C,0x77,0x8B,0x3B,0xC2,0xE7,
+    0x78,0x2E,0x3B,0xC5,0x9D,0xE1,0x73,0xBC,
+    0x17,0x1D,0xE2,0xCE,0xF0,0xB9,0xDE,0x0B,
+    0x8E,0xF1,0x67,0x78,0x5C,0xEF,0x05,0xC7,
+    0x78,0xB3,0xBC,0x2E,0x77,0x82,0xE3,0xBC,
+    0x59,0xDE,0x17,0x3B,0xC1,0x71,0xDE,0x2C,
+    0xEF,0x0B,0x9D,0xE0,0xB8,0xEF,0x16,0x77,
+    0x85,0xCE,0xF0,0x5C,0x77,0x8B,0x3B,0xC2,
+    0xE7,0x78,0x2E,0x3B,0xC5,0x9D,0xE3,0x4E,
+    0xC1,0x2C,0x51,0xDE,0x33,0xA0,0x45,0xE8,
+    0x2D,0xE4,0x11,0x7B,0x8D,0xE8,0xA7,0x48,
+    0xAE,0x08,0xA4,0x53,0x22,0x9F,0xC0,0x63,
+    0xA2,0xF7,0xD7,0xBE,0xBD,0xF5,0xEF,0xAF,
+    0x7D,0x7B,0xEB,0xDF,0x5E,0xFA,0xF7,0xD7,
+    0xBE,0xBD,0xE2,0x20,0xC0,0x42,0x04,0x7E,
+    0x23,0xD7,0xAF,0x5E,0xBD,0x7A,0x87,0x79,
+    0x01,0x46,0x70,0xBA,0xF8,0xAE,0x40,0x39,
+    0xC3,0x50,0x9F,0x0B,0x57,0xF8,0xEE,0x5D,
+    0x2E,0xE3,0x2E,0x9B,0xB3,0x7D,0xDF,0xF1,
+    0x9C,0x26,0xE4,0xBF,0x00,0x3D,0xFA,0x77,
+    0x3E,0x6B,0x7D,0x81,0xD2,0xFC,0x21,0x97,
+    0x08,0xBA,0x7F,0xED,0xEF,0xC1,0x68,0x64,
+    0x8A,0xD4,0xB0,0xAC,0xA3,0xFE,0x3D,0x8C,
+    0x5D,0xC3,0x8A,0xB2,0x37,0x68,0xDD,0x0C,
+    0x38,0x04,0xF4,0xF0,0x53,0x9F,0xCF,0xE7,
+    0xF3,0xFC,0x01,0x3C,0xF1,0x1E,0x23,0xC4,
+    0x78,0x8F,0x11,0xEC,0x01,0x4D,0xF8,0x11,
+    0x4F,0xE7,0xF3,0xF9,0xF8,0x13,0x4F,0xE7,
+    0xF3,0xF0,0x27,0x1F,0xCF,0xC0,0x9E,0x7E,
+    0x05,0x03,0xF0,0x26,0x40,
+
+    /* Access unit 4 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0x60,0x17,
+    0xF1,0x8F,0x02,0x05,0x02,0x43,0xDF,0x38,
+    0x7D,0x22,0xF2,0x6B,0x37,0x89,0x5C,0x4A,
+    0xE2,0x57,0x12,0xB8,0x95,0xC4,0xAE,0x25,
+    0x71,0x2B,0x89,0x5F,0xA0,0xF4,0xBE,0x70,
+    0xF9,0x12,0x4D,0x66,0xFF,0x12,0xB8,0x95,
+    0xC4,0xAE,0x25,0x71,0x2B,0x89,0x5C,0x4A,
+    0xE2,0x57,0x12,0xB8,0x95,0xF8,0x90,0xE4,
+    0xFE,0x7F,0x3F,0x9F,0x8B,0xE0,0x9C,0x97,
+    0xBD,0xEF,0x32,0x33,0x82,0x62,0xB1,0x2B,
+    0x12,0xB1,0x2B,0x12,0xFB,0xE7,0x0E,0x91,
+    0x24,0xD6,0x6F,0xF1,0x2B,0x89,0x5C,0x4A,
+    0xE2,0x57,0x12,0xB8,0x95,0xC4,0xAE,0x25,
+    0x71,0x2B,0x0B,0x9E,0x7D,0xFC,0x2F,0xCE,
+    0x08,0x9F,0xE4,0x62,0x46,0x21,0x71,0xEE,
+    0x2A,0xD5,0xEF,0x63,0xB1,0xC5,0x8F,0x64,
+    0x2F,0x5F,0x99,0x89,0x98,0x0B,0x1E,0x09,
+    0xF7,0xF0,0xB8,0xF6,0x08,0x95,0x50,0xE8,
+    0x7F,0x0B,0x9D,0xE2,0xCE,0xF0,0xB1,0xE0,
+    0x8F,0x7F,0x0B,0x9D,0x82,0x25,0x0B,0x9D,
+    0xE2,0xCE,0xF0,0xB1,0xE0,0x8F,0x7F,0x0B,
+    0x9D,0x82,0x25,0x0B,0x9D,0xE2,0xCE,0xF0,
+    0xB1,0xE0,0x8F,0x7F,0x0B,0x9D,0x82,0x25,
+    0x0B,0x9D,0xE2,0xCE,0xF0,0xB1,0xE0,0x8F,
+    0x7F,0x0B,0x9D,0x82,0x25,0x0B,0x9D,0xE2,
+    0xCE,0xF0,0xB1,0xE0,0x8F,0x7F,0x0B,0x9D,
+    0x82,0x25,0x0B,0x9D,0xE2,0xCE,0xF0,0xB1,
+    0xE0,0x8F,0x7F,0x0B,0x9D,0x82,0x25,0x0B,
+    0x9D,0xE2,0xCE,0xF0,0xB1,0xE0,0x8F,0x7F,
+    0x0B,0x9D,0x82,0x25,0x0B,0x9D,0xE2,0xCE,
+    0xF0,0xB1,0xE0,0x8F,0x7F,0x0B,0x9D,0x82,
+    0x25,0x0B,0x9D,0xE2,0xCE,0xF0,0xB1,0xE0,
+    0x8F,0x7F,0x0B,0x9D,0x82,0x25,0x0B,0x9D,
+    0xE2,0xCE,0xF0,0xB1,0xE0,0x8F,0x7F,0x0B,
+    0x9D,0x82,0x25,0x0B,0x9D,0xE2,0xCE,0xF0,
+    0xB1,0xE0,0x8F,0x7F,0x0B,0x9D,0x82,0x25,
+    0x0B,0x9D,0xE2,0xCE,0xF0,0xB1,0xE0,0x8F,
+    0x7F,0x0B,0x9D,0x82,0x25,0x0B,0x9D,0xE2,
+    0xCE,0xF0,0xB1,0xE0,0x8F,0x7F,0x0B,0x9D,
+    0x82,0x25,0x0B,0x9D,0xE2,0xCE,0xF0,0xB1,
+    0xE0,0x8F,0x7F,0x0B,0x9D,0x82,0x25,0x0B,
+    0x9D,0xE2,0xCE,0xF0,0xB1,0xE0,0x8F,0x7F,
+    0x0B,0x9D,0x82,0x25,0x0B,0x9D,0xE2,0xCE,
+    0xF0,0xB1,0xE0,0x8F,0x7F,0x0B,0x9D,0x82,
+    0x25,0x0B,0x9D,0xE2,0xCE,0xF0,0xB1,0xE0,
+    0x8F,0x7F,0x0B,0x9D,0x82,0x25,0x0B,0x9D,
+    0xE2,0xCE,0xF0,0xB1,0xE0,0x8F,0x7F,0x0B,
+    0x9D,0x82,0x25,0x0B,0x9D,0xE2,0xCE,0xF0,
+    0xB1,0xE0,0x8F,0x7F,0x0B,0x9D,0x82,0x25,
+    0x0B,0x9D,0xE2,0xCE,0xF0,0xB1,0xE0,0x8F,
+    0x7F,0x0B,0x9D,0x82,0x25,0x0B,0x9D,0xE2,
+    0xCE,0xF0,0xB1,0xE0,0x8F,0x7F,0x0B,0x9D,
+    0x82,0x25,0x0B,0x9D,0xE2,0xCE,0xF0,0xB1,
+    0xE0,0x8F,0x7F,0x0B,0x9D,0x82,0x25,0x0B,
+    0x9D,0xE2,0xCE,0xF0,0xB1,0xE0,0x8F,0x7F,
+    0x0B,0x9D,0x82,0x25,0x0B,0x9D,0xE2,0xCE,
+    0xF0,0xB1,0xE0,0x8F,0x7F,0x0B,0x9D,0x82,
+    0x25,0x0B,0x9D,0xE2,0xCE,0xF0,0xB1,0xE0,
+    0x8F,0x7F,0x0B,0x9D,0x82,0x25,0x0B,0x9D,
+    0xE2,0xCE,0xF0,0xB1,0xE0,0x8F,0x7F,0x0B,
+    0x9D,0x82,0x25,0x0B,0x9D,0xE2,0xCE,0xF0,
+    0xB1,0xE0,0x8F,0x7F,0x0B,0x9D,0x82,0x25,
+    0x0B,0x9D,0xE2,0xCE,0xF0,0xB1,0xE0,0x8F,
+    0x7F,0x0B,0x9D,0x82,0x25,0x0B,0x9D,0xE2,
+    0xCE,0xF0,0xB1,0xE0,0x8F,0x7F,0x0B,0x9D,
+    0x82,0x25,0x0B,0x9D,0xE2,0xCE,0xF0,0xB1,
+    0xE0,0x8F,0x7F,0x0B,0x9D,0x82,0x25,0x04,
+    0x47,0x78,0xCE,0x2C,0x46,0xAB,0xAA,0xC4,
+    0x78,0x8F,0x11,0xE2,0x3C,0x47,0x88,0xF1,
+    0x1E,0x23,0xC4,0x78,0x8F,0xE0,0xA3,0xAA,
+    0xEA,0xBB,0x61,0x05,0x7C,0xFD,0x04,0x82,
+    0xF8,0x85,0xC4,0x2E,0x21,0x71,0x0B,0x88,
+    0x5C,0x42,0xE2,0x17,0x10,0xB8,0x85,0xF8,
+    0x2C,0xC8,0xBC,0x8B,0xEA,0xB1,0x94,0xC2,
+    0xCF,0x22,0xF5,0x2A,0x32,0x84,0x14,0x3A,
+    0xCB,0x2E,0x9A,0x7B,0x6D,0xC4,0x2E,0x21,
+    0x71,0x0B,0x88,0x5C,0x42,0xE2,0x17,0x10,
+    0xB8,0x85,0xC4,0x2F,0xC1,0x0E,0xF7,0x32,
+    0xCF,0xA2,0xBF,0xD7,0x3F,0xD6,0x3F,0xD6,
+    0x3F,0xD6,0x3F,0xD6,0x3F,0xD6,0x3F,0xD6,
+    0x3F,0xD6,0x3F,0xD6,0x3F,0xC2,0xFB,0xDC,
+    0x1F,0x29,0xBF,0x04,0x5F,0xC2,0xF8,0x0C,
+    0x20,0xAA,0x55,0xFF,0x61,0xA2,0x1A,0x8C,
+    0x57,0x7C,0x62,0xBB,0x63,0x15,0xDF,0x18,
+    0xAE,0xD8,0xC5,0x77,0xC6,0x2B,0xB6,0x31,
+    0x5D,0xF1,0x8A,0xED,0x8C,0x57,0x7C,0x62,
+    0xBB,0x7C,0x31,0x62,0xAA,0xEA,0xBE,0xE0,
+    0x25,0xFD,0xA1,0x1D,0xA1,0x96,0x38,0x13,
+    0xFE,0xAF,0x74,0x21,0x7C,0xF0,0x15,0x01,
+    0xBA,0x08,0x35,0x86,0xF6,0x10,0x28,0xCD,
+    0xDF,0x8B,0x2E,0xEF,0xBB,0xC2,0x0A,0xAB,
+    0x9C,0xC9,0xCC,0xE5,0x32,0x53,0x31,0x0A,
+    0xB1,0x0A,0xB1,0x0A,0xB1,0x0A,0xB1,0x0A,
+    0xB1,0x0A,0xB1,0x0A,0xB1,0x0A,0xB1,0x0A,
+    0xA0,0x54,0x3C,0x11,0xFC,0x60,0x28,0xC3,
+    0x10,0x51,0x04,0x7A,0x80,0x7C,0xFC,0xB6,
+    0xA3,0x65,0xB3,0x6E,0x5C,0x0D,0xEB,0xEB,
+    0xEE,0xDB,0xFD,0xBE,0x7B,0x8B,0xD5,0x73,
+    0x3C,0x7F,0x8C,0xE0,0x19,0x5E,0xF9,0xF1,
+    0xFD,0xA9,0x7E,0x2E,0xEB,0x09,0xF7,0x69,
+    0xFD,0xCC,0xFE,0xED,0xC7,0x64,0xF8,0x7A,
+    0xCF,0xC2,0x63,0x56,0xEE,0xBE,0x3F,0xD3,
+    0x3E,0x6A,0xEC,0x3D,0xFC,0x67,0x84,0xF4,
+    0x04,0xC7,0x8A,0x7A,0xD7,0xE8,0xE5,0xB2,
+    0x42,0x89,0x5D,0xD7,0x63,0x3B,0x8F,0x99,
+    0x86,0xFB,0xBF,0x23,0x3F,0xEB,0x0F,0xC6,
+    0x3F,0xE5,0xFE,0x2F,0x28,0x40,0x67,0x60,
+    0x34,0x00,0x1B,0x71,0x1A,0x7A,0x34,0x58,
+    0x97,0xD0,0xCF,0xC6,0x8C,0x30,0xE2,0xC2,
+    0x58,0xB1,0x55,0x3D,0xF7,0xE5,0x77,0xF2,
+    0x67,0x85,0xBB,0xE4,0x2B,0xB6,0x11,0x38,
+    0x78,0x6C,0x25,0x55,0x14,0x29,0x29,0xDD,
+    0xB7,0x9E,0xC0,0x41,0x9D,0xF9,0xC5,0x4B,
+    0x6D,0x35,0x07,0xFF,0xFC,0xBF,0xC0,0x28,
+    0x47,0x82,0x9C,0xFE,0x7F,0x3F,0x9F,0xE0,
+    0x0A,0x06,0x60,0x51,0x32,0xF3,0x2F,0x80,
+    0x28,0x1E,0x23,0xC4,0x78,0x8F,0x11,0xF0,
+    0x05,0x03,0x81,0x14,0xF0,0x53,0x9F,0xCF,
+    0xE7,0xE2,0x0F,0xC0,0x8A,0x7F,0x3F,0x9F,
+    0x89,0x3F,0x02,0x29,0xFC,0xFC,0x51,0xF8,
+    0x11,0x4F,0xC5,0x9F,0x81,0x14,0xFC,0x59,
+    0xF8,0x3C,0x80,
+
+    /* Access unit 5 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0x80,0x19,
+    0xF1,0x9C,0xE0,0x91,0x4A,0xFC,0xAF,0xF8,
+    0xBE,0x2B,0x16,0x38,0xB1,0xC5,0x8E,0x2C,
+    0x61,0x88,0x8F,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xE3,0x79,0xEB,0xF1,0xEB,0x95,0xD7,0x02,
+    0xE6,0x87,0xFF,0xEC,0x15,0xE2,0xA2,0xD5,
+    0xEF,0x63,0xB1,0xC5,0x8F,0x7A,0xCB,0x09,
+    0x61,0x7B,0x86,0x3C,0x16,0x9D,0xE2,0xCE,
+    0xF0,0xC7,0x82,0xD3,0xBC,0x59,0xDE,0x18,
+    0xF0,0x5A,0x77,0x8B,0x3B,0xC3,0x1E,0x0B,
+    0x4E,0xF1,0x67,0x78,0x63,0xC1,0x69,0xDE,
+    0x2C,0xEF,0x0C,0x78,0x2D,0x3B,0xC5,0x9D,
+    0xE1,0x8F,0x05,0xA7,0x78,0xB3,0xBC,0x31,
+    0xE0,0xB4,0xEF,0x16,0x77,0x86,0x3C,0x16,
+    0x9D,0xE2,0xCE,0xF0,0xC7,0x82,0xD3,0xBC,
+    0x59,0xDE,0x18,0xF0,0x5A,0x77,0x8B,0x3B,
+    0xC3,0x1E,0x0B,0x4E,0xF1,0x67,0x78,0x63,
+    0xC1,0x69,0xDE,0x2C,0xEF,0x0C,0x78,0x2D,
+    0x3B,0xC5,0x9D,0xE1,0x8F,0x05,0xA7,0x78,
+    0xB3,0xBC,0x31,0xE0,0xB4,0xEF,0x16,0x77,
+    0x86,0x3C,0x16,0x9D,0xE2,0xCE,0xF0,0xC7,
+    0x82,0xD3,0xBC,0x59,0xDE,0x18,0xF0,0x5A,
+    0x77,0x8B,0x3B,0xC3,0x1E,0x0B,0x4E,0xF1,
+    0x67,0x78,0x63,0xC1,0x69,0xDE,0x2C,0xEF,
+    0x0C,0x78,0x2D,0x3B,0xC5,0x9D,0xE1,0x8F,
+    0x05,0xA7,0x78,0xB3,0xBC,0x31,0xE0,0xB4,
+    0xEF,0x16,0x77,0x86,0x3C,0x16,0x9D,0xE2,
+    0xCE,0xF0,0xC7,0x82,0xD3,0xBC,0x59,0xDE,
+    0x18,0xF0,0x5A,0x77,0x8B,0x3B,0xC3,0x1E,
+    0x0B,0x4E,0xF1,0x67,0x78,0x63,0xC1,0x69,
+    0xDE,0x2C,0xEF,0x0C,0x78,0x2D,0x3B,0xC5,
+    0x9D,0xE1,0x8F,0x05,0xA7,0x78,0xB3,0xBC,
+    0x31,0xE2,0xCC,0x03,0xFF,0xFB,0x05,0x76,
+    0x2E,0xEB,0x1D,0x8F,0xE0,0x8B,0x9C,0xCE,
+    0x3F,0x08,0xF1,0xB6,0x2F,0xA9,0xDE,0x06,
+    0x70,0xB4,0xDF,0xCF,0xF7,0x1F,0x8F,0xF6,
+    0x33,0xA2,0xBC,0x60,0x41,0x45,0xCC,0x8A,
+    0xB4,0x12,0x0B,0xE2,0x15,0xE2,0x15,0xE2,
+    0x15,0xE2,0x15,0xE2,0x15,0xE2,0x15,0xE2,
+    0x15,0xE2,0x15,0xE2,0x15,0xD0,0x41,0x14,
+    0x4B,0x82,0x0E,0x84,0x19,0x7E,0x37,0x2D,
+    0x5C,0xB8,0x85,0xC4,0x2E,0x21,0x71,0x0B,
+    0x88,0x5C,0x42,0xE2,0x17,0x10,0xB8,0x85,
+    0xC4,0x2F,0x86,0x31,0x10,0x47,0x88,0xF1,
+    0x1E,0x23,0xC4,0x78,0x8F,0x11,0xE2,0x3C,
+    0x47,0x88,0xE0,0x93,0xC1,0x17,0x93,0x0C,
+    0x8F,0x05,0x18,0x72,0x1F,0x22,0x08,0x78,
+    0x9F,0x1F,0x62,0x70,0x1A,0x1A,0x1D,0x71,
+    0xDC,0xE1,0x73,0x85,0xF2,0x03,0xC2,0x7D,
+    0x3D,0x21,0x1F,0x07,0xEE,0x6C,0x39,0xEF,
+    0x02,0x84,0x67,0xB0,0x04,0x4C,0x18,0x26,
+    0x68,0xB5,0x23,0xD8,0x1B,0x00,0x3F,0xA1,
+    0x8D,0x68,0x00,0x11,0x42,0x03,0x93,0xE0,
+    0x48,0x61,0x26,0x0D,0x23,0x7D,0x91,0x52,
+    0x5B,0x3B,0xDF,0xE0,0x88,0x27,0x97,0x72,
+    0x29,0x66,0x9B,0x51,0x15,0x41,0x0F,0xF8,
+    0x30,0xE0,0x9F,0xC1,0x17,0x88,0xF0,0x4D,
+    0xE0,0x8B,0xC4,0x78,0x26,0xF0,0x45,0xE2,
+    0x3C,0x13,0x78,0x22,0xF1,0x1E,0x63,0xC1,
+    0x4E,0x7F,0x3F,0x9F,0xCF,0xF0,0x04,0xF3,
+    0xD0,0x02,0x71,0xC3,0x18,0x8F,0x11,0xE2,
+    0x3C,0x47,0xC0,0x13,0xCE,0x15,0xF0,0x45,
+    0xE2,0x3C,0xC7,0xF3,0xF9,0xFC,0xFC,0x3B,
+    0xE0,0x8B,0xC4,0x79,0x8F,0xE7,0xF3,0xF0,
+    0xF7,0x82,0x2F,0x11,0xE6,0x3F,0x9F,0x87,
+    0xFC,0x11,0x78,0x8F,0x31,0xF8,0x20,0xF0,
+    0x45,0xE2,0x3C,0xC7,0xE0,0x83,0xC1,0x14,
+
+    /* Access unit 6 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0xA0,0x1A,
+    0xF1,0x9C,0x2C,0x08,0xA2,0xA2,0x8A,0x8A,
+    0x2A,0x2B,0x12,0xF8,0xA8,0xE2,0xA3,0x8B,
+    0xE7,0xAF,0x16,0x5E,0x33,0x86,0x6D,0xDB,
+    0xB3,0xE2,0xC7,0x16,0x38,0x5F,0x8D,0xBD,
+    0xF5,0xAB,0xDF,0x5A,0xBB,0xE2,0xA3,0x8A,
+    0x8E,0x0B,0x47,0xBD,0xFF,0x7B,0x8C,0xE2,
+    0x6B,0x5A,0xD6,0x2C,0x36,0xC9,0xF2,0xBE,
+    0x57,0xFC,0xAF,0x95,0xF5,0xFB,0xDC,0x1C,
+    0x9D,0xE3,0x38,0x92,0xAD,0x6B,0x58,0xB3,
+    0xBC,0x1C,0x9D,0xE3,0x07,0xBD,0x56,0xB4,
+    0x3A,0x1C,0x59,0xDE,0x0E,0x4E,0xF1,0x83,
+    0xDE,0xBE,0xF7,0x8B,0x3B,0xC1,0xC9,0xDE,
+    0x30,0xEF,0x16,0x77,0x83,0x93,0xBC,0x61,
+    0xDE,0x2C,0xEF,0x07,0x27,0x78,0xC3,0xBC,
+    0x59,0xDE,0x0E,0x4E,0xF1,0x87,0x78,0xB3,
+    0xBC,0x1C,0x9D,0xE3,0x0E,0xF1,0x67,0x78,
+    0x39,0x3B,0xC6,0x1D,0xE2,0xCE,0xF0,0x72,
+    0x77,0x8C,0x3B,0xC5,0x9D,0xE0,0xE4,0xEF,
+    0x18,0x77,0x8B,0x3B,0xC1,0xC9,0xDE,0x30,
+    0xEF,0x16,0x77,0x83,0x93,0xBC,0x61,0xDE,
+    0x2C,0xEF,0x07,0x27,0x78,0xC3,0xBC,0x59,
+    0xDE,0x0E,0x4E,0xF1,0x87,0x78,0xB3,0xBC,
+    0x1C,0x9D,0xE3,0x0E,0xF1,0x67,0x78,0x39,
+    0x3B,0xC6,0x1D,0xE2,0xCE,0xF0,0x72,0x77,
+    0x8C,0x3B,0xC5,0x9D,0xE0,0xE4,0xEF,0x18,
+    0x77,0x8B,0x3B,0xC1,0xC9,0xDE,0x30,0xEF,
+    0x16,0x77,0x83,0x93,0xBC,0x61,0xDE,0x2C,
+    0xEF,0x07,0x27,0x78,0xC3,0xBC,0x59,0xDE,
+    0x0E,0x4E,0xF1,0x87,0x78,0xB3,0xBC,0x1C,
+    0x9D,0xE3,0x0E,0xF1,0x67,0x78,0x39,0x3B,
+    0xC6,0x1D,0xE2,0xCE,0xF0,0x72,0x77,0x8C,
+    0x3B,0xC5,0x9D,0xE0,0xE4,0xEF,0x18,0x77,
+    0x8B,0x3B,0xC1,0xC9,0xDE,0x30,0xEF,0x16,
+    0x77,0x83,0x93,0xBC,0x61,0xDE,0x2C,0xEF,
+    0x07,0x27,0x78,0xC3,0xBC,0x59,0xDE,0x0E,
+    0x4E,0xF1,0x87,0x78,0xC3,0xB0,0x47,0x05,
+    0xBD,0x02,0x8C,0xC8,0xC0,0x82,0xB8,0x85,
+    0x27,0x16,0xC5,0xBD,0xB6,0xC5,0xF0,0xDC,
+    0xDF,0xF9,0xC0,0x55,0xB4,0x6E,0x7F,0xF8,
+    0xBE,0x7B,0xF8,0x70,0xD4,0x7C,0x20,0x8A,
+    0x1D,0xCB,0x24,0x5C,0x09,0x05,0x81,0xF7,
+    0x2C,0x3E,0xE5,0x8B,0x78,0x3C,0x84,0xEC,
+    0x4A,0xC4,0xBB,0xB8,0xBE,0x1A,0x8D,0xD3,
+    0xBE,0x5F,0x8F,0x5C,0xBC,0xA7,0x8B,0x2B,
+    0x4D,0x3B,0xB4,0xD3,0xBC,0xDF,0xFC,0x7D,
+    0x02,0xDE,0x2B,0xAE,0xDB,0x7F,0x10,0xB8,
+    0x85,0xC4,0x2E,0x21,0x71,0x0B,0x88,0x5C,
+    0x42,0xE2,0x17,0x10,0xB0,0x2B,0xF2,0x1B,
+    0x53,0x01,0x7C,0x67,0x1D,0x66,0x00,0x54,
+    0x25,0xD7,0x0F,0xBC,0x65,0xBF,0xF9,0xE8,
+    0x67,0xCC,0x07,0xC3,0x45,0x6E,0xB4,0x2A,
+    0xEE,0x3F,0xF6,0xF6,0x82,0x7C,0x23,0xE3,
+    0xA8,0x8B,0xE2,0x16,0x41,0xBA,0x41,0x6E,
+    0x86,0xD6,0x9E,0xD9,0x92,0xBF,0xE0,0x14,
+    0xC3,0xC1,0x3E,0x7F,0x3F,0x9F,0xCF,0xF0,
+    0x04,0xF3,0x20,0x28,0xC3,0xC8,0x3B,0x35,
+    0xE0,0x09,0xE7,0x88,0xF1,0x1E,0x23,0xC4,
+    0x7C,0x01,0x3C,0xE0,0x45,0x3C,0x14,0xE7,
+    0xF3,0xF9,0xFA,0x37,0xC3,0xFF,0x87,0xC1,
+    0x55,0xF0,0x25,0x9E,0x0A,0xF3,0xF9,0xFB,
+    0x3F,0x02,0x59,0xFC,0xFC,0x87,0xE0,0x4B,
+    0x3F,0x29,0xF8,0x12,0xCF,0xCA,0x7E,0x0E,
+    0x20,
+
+    /* Access unit 7 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0xC0,0x1A,
+    0xF0,0x5D,0xC5,0x02,0x22,0xAF,0x95,0x79,
+    0x57,0x95,0x78,0xC7,0x82,0x0F,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xF1,0x28,0x10,0xFC,0x50,
+    0x20,0x1B,0xA6,0xAE,0x9A,0xBA,0x6A,0xE9,
+    0x82,0x21,0xEF,0x7F,0xDE,0xE3,0x39,0xCA,
+    0xA4,0x62,0x46,0x3E,0x18,0xF1,0x5C,0x51,
+    0x1A,0xCC,0xAC,0xCA,0xCC,0xAC,0xC1,0x11,
+    0xDE,0x09,0x3C,0x50,0xF7,0xAF,0xD9,0x59,
+    0x02,0x23,0xBC,0x12,0x78,0xA3,0xBC,0x11,
+    0x1D,0xE0,0x93,0xC5,0x1D,0xE0,0x88,0xEF,
+    0x04,0x9E,0x28,0xEF,0x04,0x47,0x78,0x24,
+    0xF1,0x47,0x78,0x22,0x3B,0xC1,0x27,0x8A,
+    0x3B,0xC1,0x11,0xDE,0x09,0x3C,0x51,0xDE,
+    0x08,0x8E,0xF0,0x49,0xE2,0x8E,0xF0,0x44,
+    0x77,0x82,0x4F,0x14,0x77,0x82,0x23,0xBC,
+    0x12,0x78,0xA3,0xBC,0x11,0x1D,0xE0,0x93,
+    0xC5,0x1D,0xE0,0x88,0xEF,0x04,0x9E,0x28,
+    0xEF,0x04,0x47,0x78,0x24,0xF1,0x47,0x78,
+    0x22,0x3B,0xC1,0x27,0x8A,0x3B,0xC1,0x11,
+    0xDE,0x09,0x3C,0x51,0xDE,0x08,0x8E,0xF0,
+    0x49,0xE2,0x8E,0xF0,0x44,0x77,0x82,0x4F,
+    0x14,0x77,0x82,0x23,0xBC,0x12,0x78,0xA3,
+    0xBC,0x11,0x1D,0xE0,0x93,0xC5,0x1D,0xE0,
+    0x88,0xEF,0x04,0x9E,0x28,0xEF,0x04,0x47,
+    0x78,0x24,0xF1,0x47,0x78,0x22,0x3B,0xC1,
+    0x27,0x8A,0x3B,0xC1,0x11,0xDE,0x09,0x3C,
+    0x51,0xDE,0x08,0x8E,0xF0,0x49,0xE2,0x8E,
+    0xF0,0x44,0x77,0x82,0x4F,0x14,0x77,0x82,
+    0x23,0xBC,0x12,0x78,0xA3,0xBC,0x11,0x1D,
+    0xE0,0x93,0xC5,0x1D,0xE0,0x88,0xEF,0x04,
+    0x9E,0x28,0xEF,0x04,0x47,0x78,0x24,0xF1,
+    0x47,0x78,0x22,0x3B,0xC1,0x27,0x8A,0x3B,
+    0xC1,0x11,0xDE,0x08,0xF4,0x8E,0x96,0x2C,
+    0xEF,0x0B,0xBC,0xD3,0x8A,0x8E,0xA1,0xC1,
+    0x66,0x0F,0x9E,0x05,0xFE,0xAC,0x7D,0x58,
+    0xFA,0xB1,0xF5,0x63,0xEA,0xC7,0xD5,0x8F,
+    0xAB,0x1F,0x56,0x3E,0xAC,0x7D,0x58,0xD8,
+    0x10,0x78,0x27,0xC3,0x2A,0x65,0x08,0xA6,
+    0x50,0x8A,0x67,0x48,0x23,0x39,0xF7,0x7D,
+    0x0E,0x19,0x5D,0x4F,0xE2,0xCB,0xAA,0xEA,
+    0xB0,0x82,0xFA,0x92,0x46,0x32,0xE3,0x3F,
+    0x10,0xB8,0x85,0xC4,0x2E,0x21,0x71,0x0B,
+    0x88,0x5C,0x42,0xE2,0x17,0x52,0x4A,0x0B,
+    0x25,0x5E,0x55,0xFA,0xAE,0xAA,0x9A,0x84,
+    0x2E,0x21,0x71,0x0B,0x88,0x5C,0x42,0xE2,
+    0x17,0x10,0xB8,0x85,0xC4,0x2E,0x21,0x68,
+    0x20,0xB5,0xFD,0x84,0xC2,0x88,0x5C,0x42,
+    0xE2,0x17,0x10,0xB8,0x85,0xC4,0x2E,0x21,
+    0x71,0x0B,0x88,0x5A,0x58,0x09,0x0C,0x0B,
+    0xFC,0x21,0xC3,0x28,0x1E,0xCC,0x02,0x33,
+    0xC7,0x94,0xF8,0xC8,0x69,0xFE,0x33,0x87,
+    0x2F,0xD4,0x14,0xF0,0xFF,0x0E,0x44,0xF3,
+    0x43,0x40,0xBD,0x18,0x5D,0xB0,0x7F,0x1F,
+    0xB7,0x0F,0x5A,0x14,0x18,0x47,0xF8,0x43,
+    0xA6,0x1A,0x68,0xA9,0x35,0xD6,0x75,0xC1,
+    0xEC,0xCD,0xE0,0xB7,0xFC,0x67,0x80,0x02,
+    0x19,0x8E,0x02,0x94,0xF5,0x1E,0x0C,0x41,
+    0xD1,0x9C,0x96,0x22,0xF7,0xE0,0x00,0x81,
+    0x47,0x8E,0x48,0xC2,0xD4,0x18,0x73,0x4C,
+    0x49,0x95,0xD3,0x06,0x85,0x16,0x0B,0xC8,
+    0x6E,0x19,0x5D,0xAD,0x1A,0xF0,0x8A,0x2A,
+    0xBB,0x78,0xBF,0x0F,0xC6,0x0C,0x51,0xEE,
+    0x5A,0x87,0x41,0xDC,0x53,0xEC,0x87,0xC1,
+    0x37,0x10,0xC3,0x80,0x54,0x4F,0x04,0x79,
+    0xFC,0xFE,0x7F,0x3F,0xC0,0x14,0x0F,0x80,
+    0x28,0x1E,0x23,0xC4,0x78,0x8F,0x11,0xF0,
+    0x05,0x03,0x81,0x14,0xFE,0x7F,0x3F,0x9F,
+    0x81,0x34,0xFE,0x7F,0x3F,0x02,0x71,0xFC,
+    0xFC,0x09,0xE7,0xE0,0x50,0x3F,0x07,0x10,
+
+    /* Access unit 8 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0xE0,0x1A,
+    0xF1,0x9C,0x13,0x07,0x0B,0xF2,0xF9,0x7C,
+    0xBD,0x88,0xF4,0x0A,0x1D,0x4F,0x45,0x86,
+    0xDD,0x7E,0xF7,0xFB,0xDD,0xFF,0x7B,0x81,
+    0x17,0xA9,0xE8,0xB3,0xBC,0x08,0xBD,0x4F,
+    0x45,0x9D,0xE0,0x45,0xEA,0x7A,0x2C,0xEF,
+    0x02,0x2F,0x53,0xD1,0x67,0x78,0x11,0x7A,
+    0x9E,0x8B,0x3B,0xC0,0x8B,0xD4,0xF4,0x59,
+    0xDE,0x04,0x5E,0xA7,0xA2,0xCE,0xF0,0x22,
+    0xF5,0x3D,0x16,0x77,0x81,0x17,0xA9,0xE8,
+    0xB3,0xBC,0x08,0xBD,0x4F,0x45,0x9D,0xE0,
+    0x45,0xEA,0x7A,0x2C,0xEF,0x02,0x2F,0x53,
+    0xD1,0x67,0x78,0x11,0x7A,0x9E,0x8B,0x3B,
+    0xC0,0x8B,0xD4,0xF4,0x59,0xDE,0x04,0x5E,
+    0xA7,0xA2,0xCE,0xF0,0x22,0xF5,0x3D,0x16,
+    0x77,0x81,0x17,0xA9,0xE8,0xB3,0xBC,0x08,
+    0xBD,0x4F,0x45,0x9D,0xE0,0x45,0xEA,0x7A,
+    0x2C,0xEF,0x02,0x2F,0x53,0xD1,0x67,0x78,
+    0x11,0x7A,0x9E,0x8B,0x3B,0xC0,0x8B,0xD4,
+    0xF4,0x59,0xDE,0x04,0x5E,0xA7,0xA2,0xCE,
+    0xF0,0x22,0xF5,0x3D,0x16,0x77,0x81,0x17,
+    0xA9,0xE8,0xB3,0xBC,0x08,0xBD,0x4F,0x45,
+    0x9D,0xE0,0x45,0xEA,0x7A,0x2C,0xEF,0x02,
+    0x2F,0x53,0xD1,0x67,0x78,0x11,0x7A,0x9E,
+    0x8B,0x3B,0xC0,0x8B,0xD4,0xF4,0x59,0xDE,
+    0x04,0x51,0xEF,0x5F,0x3B,0xE7,0x7C,0x59,
+    0xDE,0x04,0x5E,0x1D,0x35,0x8A,0x2A,0x2B,
+    0xDE,0x2A,0x2D,0x9F,0x33,0x10,0xFD,0xA4,
+    0xE3,0x22,0xF8,0x5E,0xF7,0xBB,0xEB,0x2C,
+    0x1B,0x5C,0xF9,0xF1,0x7D,0x4A,0x8A,0xAF,
+    0x07,0x91,0x3B,0x66,0xF5,0xEA,0xA1,0x7E,
+    0x72,0xAB,0xC7,0x82,0xFF,0xE2,0xD8,0x31,
+    0xE1,0xC9,0xF4,0xDB,0xF6,0xB0,0x19,0xA6,
+    0x3F,0x17,0xC0,0xC7,0xC6,0x72,0x80,0x10,
+    0x00,0x42,0x38,0x08,0xA0,0x27,0xDD,0x1C,
+    0xC7,0x74,0xDA,0x31,0xC5,0x8A,0x8F,0xC0,
+    0x19,0x80,0x00,0x84,0x00,0x6E,0x4B,0x8D,
+    0x2F,0xDD,0xB4,0x5B,0x08,0x72,0x74,0x0F,
+    0xE6,0x21,0x89,0x3F,0xF0,0x63,0x06,0xC2,
+    0x5F,0xEF,0xC1,0x99,0x14,0x3F,0x10,0x10,
+    0x20,0x28,0xDE,0x76,0x10,0x18,0x54,0xE5,
+    0x57,0x56,0xF2,0x1A,0x00,0x61,0xC0,0x2A,
+    0xC7,0x87,0xF3,0xF9,0xFC,0xFE,0x7F,0x60,
+    0x0A,0x26,0x00,0x9E,0x78,0x8F,0x11,0xE2,
+    0x3C,0x47,0x88,0xF8,0x02,0x79,0xC0,0x8A,
+    0x7F,0x3F,0x9F,0xCF,0xD4,0x21,0x81,0x2C,
+    0xFE,0x7F,0x3F,0x02,0x71,0xFC,0xFC,0x09,
+    0xE7,0xE0,0x50,0x3F,0x06,0x70,
+
+    /* Access unit 9 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x00,0x1A,
+    0xF1,0x9D,0x06,0x89,0x45,0xF0,0x4F,0x9B,
+    0xCD,0xE6,0xF3,0x73,0xD0,0x01,0x42,0xE3,
+    0xD9,0x26,0xB5,0xAF,0x82,0xEE,0x16,0xE5,
+    0xF2,0xFF,0x01,0x6C,0xF0,0x9A,0x05,0x33,
+    0xE2,0xF9,0xEF,0xFB,0x98,0xC9,0x8D,0x5E,
+    0xB5,0xD4,0xA8,0xAA,0x10,0x5A,0xE6,0x32,
+    0x63,0x39,0x4C,0x94,0xCC,0x42,0xE2,0x17,
+    0x10,0xB8,0x85,0xC4,0x2E,0x21,0x71,0x0B,
+    0x5C,0xF3,0xDA,0x45,0x32,0xBA,0x5B,0xCA,
+    0xFC,0x62,0xD3,0x21,0x5C,0x2F,0x7B,0xCB,
+    0xFB,0x9F,0xBC,0x37,0x11,0x80,0x3B,0xF1,
+    0x5C,0x6C,0x73,0x2B,0xC3,0xEA,0x0B,0x46,
+    0xA1,0xDE,0xB8,0x4B,0x87,0x90,0x48,0x56,
+    0x87,0x90,0xCC,0xBE,0x89,0xD0,0x57,0xFF,
+    0x8C,0xF8,0x00,0x2A,0x61,0x15,0x52,0xD1,
+    0x75,0xC1,0x0C,0x37,0xBB,0x7E,0x01,0x85,
+    0x78,0xE3,0x5C,0xA0,0x8B,0x9B,0x7A,0x26,
+    0x46,0xB9,0x0B,0x70,0xFD,0x40,0x5E,0xCC,
+    0x0E,0x60,0xF7,0xA6,0xC9,0x62,0x34,0x3D,
+    0x40,0xC0,0x07,0x12,0x86,0x1C,0xC4,0x5D,
+    0x78,0x71,0x17,0xDF,0xF5,0xFF,0x00,0xAD,
+    0x9E,0x1F,0xCF,0xE7,0xF3,0xF9,0xFD,0x80,
+    0x28,0x98,0x02,0x79,0xE2,0x20,0x88,0xF9,
+    0x36,0x3F,0xFF,0x92,0x23,0xC4,0x78,0x8F,
+    0x36,0x21,0xFF,0xF2,0x01,0x14,0xF0,0x47,
+    0x9F,0xCF,0xE7,0xEA,0x10,0xCC,0xFE,0x04,
+    0x53,0xF9,0xFC,0xFC,0x09,0xC7,0xF3,0xF0,
+    0x27,0x9F,0x81,0x40,0xFC,0x17,0x40,
+
+    /* Access unit 10 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x20,0x1A,
+    0xF1,0x9C,0xE1,0x83,0xD1,0x0C,0x31,0x0C,
+    0x3E,0x2F,0x9E,0x4A,0xC8,0xEB,0x5F,0xC6,
+    0x73,0xD7,0xC9,0x0C,0x90,0x8B,0xE1,0x7B,
+    0xDE,0xF7,0x9A,0xFC,0x57,0x15,0x8C,0xE1,
+    0x62,0x83,0xBA,0xF6,0x0E,0xEB,0xD8,0x3B,
+    0xAF,0x60,0xEE,0xBD,0xA8,0x5D,0xB9,0x9E,
+    0xB1,0xF0,0x44,0x3D,0x90,0x8B,0xAF,0x9E,
+    0x13,0xC2,0x17,0xE7,0xAF,0x83,0xF6,0x20,
+    0xFD,0x88,0xB1,0xEF,0x2D,0xAD,0x7C,0x60,
+    0xF6,0x50,0xCA,0x99,0xFB,0xDE,0x47,0xC8,
+    0xF8,0x22,0x34,0x3F,0xFF,0x64,0x0B,0x8F,
+    0x79,0xFD,0x0E,0x87,0x33,0xE6,0x7C,0x59,
+    0xDE,0x30,0xEE,0x19,0x53,0x01,0x11,0xDE,
+    0x17,0x3B,0xC5,0x9D,0xE3,0x0E,0xE1,0x95,
+    0x30,0x11,0x1D,0xE0,0x88,0xEF,0x18,0x77,
+    0x0C,0xA9,0x80,0x88,0xEF,0x04,0x47,0x78,
+    0xC3,0xB8,0x65,0x4C,0x04,0x47,0x78,0x22,
+    0x3B,0xC6,0x1D,0xC3,0x2A,0x60,0x22,0x3B,
+    0xC1,0x11,0xDE,0x30,0xEE,0x19,0x53,0x01,
+    0x11,0xDE,0x08,0x8E,0xF1,0x87,0x70,0xCA,
+    0x98,0x08,0x8E,0xF0,0x44,0x77,0x8C,0x3B,
+    0x86,0x54,0xC0,0x44,0x77,0x82,0x23,0xBC,
+    0x61,0xDC,0x32,0xA6,0x02,0x23,0xBC,0x11,
+    0x1D,0xE3,0x0E,0xE1,0x95,0x30,0x11,0x1D,
+    0xE0,0x88,0xEF,0x18,0x77,0x0C,0xA9,0x80,
+    0x88,0xEF,0x04,0x47,0x78,0xC3,0xB8,0x65,
+    0x4C,0x04,0x47,0x78,0x22,0x3B,0xC6,0x1D,
+    0xC3,0x2A,0x60,0x22,0x3B,0xC1,0x11,0xDE,
+    0x30,0xEE,0x19,0x53,0x01,0x11,0xDE,0x08,
+    0x8E,0xF1,0x87,0x70,0xCA,0x98,0x08,0x8E,
+    0xF0,0x44,0x77,0x8C,0x3B,0x86,0x54,0xC0,
+    0x44,0x77,0x82,0x23,0xBC,0x61,0xDC,0x32,
+    0xA6,0x02,0x23,0xBC,0x11,0x1D,0xE3,0x0E,
+    0xE1,0x95,0x30,0x11,0x1D,0xE0,0x88,0xEF,
+    0x18,0x77,0x0C,0xA9,0x80,0x88,0xEF,0x04,
+    0x47,0x78,0xC3,0xB8,0x65,0x4C,0x04,0x47,
+    0x78,0x22,0x3B,0xC6,0x1D,0xC3,0x2A,0x60,
+    0x22,0x3B,0xC1,0x11,0xDE,0x30,0xEE,0x19,
+    0x53,0x01,0x11,0xDE,0x08,0x8E,0xF1,0x87,
+    0x70,0xCA,0x98,0x08,0x8E,0xF0,0x44,0x77,
+    0x8C,0x3B,0x86,0x54,0xC0,0x44,0x77,0x82,
+    0x23,0xBC,0x61,0xDC,0x32,0xA6,0x02,0x23,
+    0xBC,0x11,0x1D,0xE3,0x0E,0xE1,0x95,0x30,
+    0x11,0x1D,0xE0,0x88,0xEF,0x18,0x77,0x0C,
+    0xA9,0x80,0x88,0xEF,0x04,0x47,0x78,0xC3,
+    0xB8,0x65,0x4C,0x04,0x47,0x78,0x22,0x3B,
+    0xC6,0x1D,0xC3,0x2A,0x60,0x22,0x3B,0xC1,
+    0x11,0xDE,0x30,0xEE,0x19,0x53,0x00,0xA0,
+    0x77,0x0C,0xA9,0x80,0x8B,0xA1,0x47,0x48,
+    0x63,0xA2,0xA5,0x5E,0xA9,0x97,0xAA,0x65,
+    0xEA,0x99,0x7A,0xA6,0x5E,0xA9,0x97,0xAA,
+    0x65,0xEA,0x99,0x7A,0xA6,0x5E,0xA9,0x97,
+    0x9E,0xA5,0xD9,0xCD,0x1C,0xAF,0x85,0xF9,
+    0xEB,0xFC,0x26,0x71,0xF8,0x20,0x30,0x71,
+    0x3C,0xA8,0xC3,0x6E,0xEE,0x96,0x1B,0xCF,
+    0xF0,0x8F,0x1E,0x0F,0xAB,0x62,0x4A,0xA0,
+    0x9F,0x12,0x7B,0x1D,0x53,0x1F,0x2D,0xF7,
+    0xFF,0x1F,0xD0,0xA0,0xE4,0xBC,0xB6,0x6A,
+    0x32,0x19,0x81,0x57,0xE6,0xE9,0x88,0x58,
+    0x5C,0x10,0x37,0xC0,0x01,0x03,0x40,0x63,
+    0xDE,0x41,0xA5,0xA8,0x48,0xF2,0x2E,0x14,
+    0x8D,0xDA,0x31,0x63,0x38,0xE2,0x26,0x19,
+    0x73,0x07,0x8C,0x0A,0x1A,0xFF,0x60,0x08,
+    0xC1,0x44,0x91,0x22,0x4D,0xD7,0x53,0x00,
+    0xB0,0x4B,0xAA,0x9F,0x4A,0x22,0x17,0xB0,
+    0x04,0x80,0x00,0x20,0x20,0x10,0xBE,0x0D,
+    0x96,0x1F,0x3F,0x39,0xC3,0x8A,0x43,0x2E,
+    0x10,0x18,0x07,0x30,0x10,0x33,0x87,0x8B,
+    0x37,0xC5,0x2D,0x82,0xDC,0x4E,0x00,0x21,
+    0x8E,0xD0,0xF2,0x6E,0xE3,0x98,0x5C,0x4E,
+    0x3F,0xA2,0xF0,0x38,0x28,0x3F,0xB0,0x18,
+    0x60,0x05,0x98,0x6B,0xE3,0xF9,0x17,0xB9,
+    0x65,0xC2,0x37,0x9E,0x43,0x9B,0x3F,0x84,
+    0x3F,0x09,0xFF,0x02,0x09,0xC0,0x08,0x42,
+    0xB1,0x20,0x60,0x3B,0xBD,0x71,0x68,0x50,
+    0xA8,0x3F,0x0D,0x43,0x00,0x2D,0x09,0x52,
+    0x21,0xF3,0x23,0x4C,0x67,0x93,0x88,0xC3,
+    0x0E,0x01,0x5F,0x3C,0x37,0x9F,0xCF,0xE7,
+    0xF3,0xFA,0x00,0x50,0x38,0xA1,0x41,0xEC,
+    0x37,0x07,0x8F,0x6F,0x3F,0xE6,0xC7,0xFF,
+    0xF0,0xF7,0x60,0xF1,0x1E,0x23,0xC4,0x78,
+    0x8F,0x36,0x21,0xFF,0xF2,0x01,0x14,0xF0,
+    0xFE,0x7F,0x3F,0x9F,0x88,0x3F,0x02,0x29,
+    0xFC,0xFE,0x7E,0x24,0xFC,0x08,0xA7,0xF3,
+    0xF1,0x47,0xE0,0x45,0x3F,0x16,0x7E,0x04,
+    0x53,0xF1,0x67,0xE1,0xE8,
+
+    /* Access unit 11 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x40,0x1A,
+    0xF1,0x9C,0xE1,0x45,0xF3,0xBF,0x3B,0xE2,
+    0xF9,0xEF,0xF2,0x7B,0x51,0x58,0xCE,0x16,
+    0x99,0x7C,0xCB,0xC4,0x2C,0xC4,0x2C,0xFA,
+    0x2C,0x6E,0x2C,0x6F,0xE1,0x7E,0x27,0x7B,
+    0xDE,0xE2,0xF8,0xA2,0x2B,0xAB,0xAB,0xDC,
+    0x17,0x1A,0x50,0xFF,0xF6,0x0A,0x8A,0xFF,
+    0xBD,0xC2,0xFC,0x4E,0xF7,0xBD,0xC1,0x6F,
+    0x3F,0xAE,0xEE,0xFE,0x08,0xF8,0x9D,0xEF,
+    0x7B,0x82,0xDE,0x7F,0x5D,0xDD,0xFC,0x11,
+    0xF1,0x3B,0xDE,0xF7,0x05,0xBC,0xFE,0xBB,
+    0xBB,0xF8,0x23,0xE2,0x77,0xBD,0xEE,0x0B,
+    0x79,0xFD,0x77,0x77,0xF0,0x47,0xC4,0xEF,
+    0x7B,0xDC,0x16,0xF3,0xFA,0xEE,0xEF,0xE0,
+    0x8F,0x89,0xDE,0xF7,0xB8,0x2D,0xE7,0xF5,
+    0xDD,0xDF,0xC1,0x1F,0x13,0xBD,0xEF,0x70,
+    0x5B,0xCF,0xEB,0xBB,0xBF,0x82,0x3E,0x27,
+    0x7B,0xDE,0xE0,0xB7,0x9F,0xD7,0x77,0x7F,
+    0x04,0x7C,0x4E,0xF7,0xBD,0xC1,0x6F,0x3F,
+    0xAE,0xEE,0xFE,0x08,0xF8,0x9D,0xEF,0x7B,
+    0x82,0xDE,0x7F,0x5D,0xDD,0xFC,0x11,0xF1,
+    0x3B,0xDE,0xF7,0x05,0xBC,0xFE,0xBB,0xBB,
+    0xF8,0x23,0xE2,0x77,0xBD,0xEE,0x0B,0x79,
+    0xFD,0x77,0x77,0xF0,0x47,0xC4,0xEF,0x7B,
+    0xDC,0x16,0xF3,0xFA,0xEE,0xEF,0xE0,0x8F,
+    0x89,0xDE,0xF7,0xB8,0x2D,0xE7,0xF5,0xDD,
+    0xDF,0xC1,0x1F,0x13,0xBD,0xEF,0x70,0x5B,
+    0xCF,0xEB,0xBB,0xBF,0x82,0x3E,0x27,0x7B,
+    0xDE,0xE0,0xB7,0x9F,0xD7,0x77,0x7F,0x04,
+    0x7C,0x4E,0xF7,0xBD,0xC1,0x6F,0x3F,0xAE,
+    0xEE,0xFE,0x08,0xF8,0x9D,0xEF,0x7B,0x82,
+    0xDE,0x7F,0x5D,0xDD,0xFC,0x11,0xF1,0x3B,
+    0xDE,0xF7,0x05,0xBC,0xFE,0xBB,0xBB,0xF8,
+    0x23,0xE2,0x77,0xBD,0xEE,0x0B,0x79,0xFD,
+    0x77,0x77,0xF0,0x47,0xC4,0xEF,0x7B,0xDC,
+    0x16,0xF3,0xFA,0xEE,0xEF,0xE0,0x8F,0x89,
+    0xDE,0xF7,0xB8,0x2D,0xE7,0xF5,0xDD,0xDF,
+    0xC1,0x1F,0x13,0xBD,0xEF,0x70,0x5B,0xCF,
+    0xEB,0xBB,0xBF,0x82,0x3E,0x27,0x7B,0xDE,
+    0xE0,0xB7,0x9F,0xD7,0x77,0x7F,0x04,0x7C,
+    0x4E,0xF7,0xBD,0xC1,0x6F,0x3F,0xAE,0xEE,
+    0xFE,0x08,0xF8,0x9D,0xEF,0x7B,0x82,0xDE,
+    0x7F,0x5D,0xDD,0xFC,0x11,0xF1,0x3B,0xDE,
+    0xF7,0x05,0xBC,0xFE,0xBB,0xBB,0xF8,0x23,
+    0xE2,0x77,0xBD,0xEE,0x0B,0x79,0xFD,0x77,
+    0x77,0xF0,0x47,0xC4,0xEF,0x7B,0xDC,0x16,
+    0xF3,0xFA,0xEE,0xEF,0xE0,0x8F,0x89,0xDE,
+    0xF7,0xB8,0x2D,0xE7,0xF5,0xDD,0xDF,0xC1,
+    0x1F,0x13,0xBD,0xEF,0x70,0x5B,0xCF,0xEB,
+    0xBB,0xBF,0x85,0xCE,0xF1,0x9C,0x4E,0xF7,
+    0xBD,0xC1,0x18,0x41,0x18,0x16,0xB9,0x65,
+    0xD8,0x4C,0x2F,0x88,0x5C,0x42,0xE2,0x17,
+    0x10,0xB8,0x85,0xC4,0x2E,0x21,0x71,0x0B,
+    0x88,0x5A,0xEA,0x44,0x8B,0xE1,0x6C,0xEB,
+    0xDC,0xAC,0x7C,0x52,0xBE,0x57,0x7F,0xD5,
+    0x32,0xF5,0x4A,0xBD,0x52,0xAF,0x54,0xAB,
+    0xD5,0x2A,0xF5,0x4A,0xBD,0x52,0xAF,0x54,
+    0xAB,0xD5,0x2A,0xF5,0x4A,0x86,0xF3,0x94,
+    0xE3,0xD9,0x41,0x2B,0xE4,0x66,0xC7,0x0D,
+    0xC5,0xAD,0x2D,0x08,0x5F,0x0E,0x6A,0x56,
+    0xFD,0xB2,0x8F,0xC5,0xF0,0x31,0xF1,0x44,
+    0xE0,0x01,0x60,0x01,0x80,0x1C,0x01,0xE7,
+    0x8C,0x89,0x6A,0x60,0x22,0xC1,0x96,0xC7,
+    0x54,0xFB,0x40,0x1C,0x00,0x94,0x00,0x04,
+    0x04,0x02,0x57,0xC1,0xA2,0xC1,0x03,0xE3,
+    0xBC,0x78,0x98,0x33,0x87,0x37,0x0F,0x08,
+    0x7E,0x1E,0x2E,0x3C,0x00,0x04,0x10,0x00,
+    0x00,0x41,0x80,0x00,0x04,0x13,0x02,0x49,
+    0x98,0x05,0x90,0xF0,0xBE,0x7F,0x3F,0x9F,
+    0xCF,0xEC,0x01,0x44,0xC0,0x13,0xCF,0x11,
+    0xE2,0x3C,0x47,0x88,0xF1,0x1E,0x6C,0x43,
+    0xC3,0xFC,0x26,0x1A,0xC0,0x03,0xC1,0x02,
+    0x87,0xB0,0xA8,0xF2,0x82,0x32,0xF8,0x1F,
+    0x1A,0x12,0xBC,0xDF,0xAA,0xF7,0x81,0x14,
+    0xF0,0xDE,0x7F,0x3F,0x9F,0xA3,0xF9,0xFC,
+    0xFE,0x7F,0x3F,0x9F,0xCF,0xC0,0x8A,0x7F,
+    0x3F,0x9F,0xB3,0xF9,0xFC,0xFE,0x7F,0x3F,
+    0x9F,0xCF,0xC0,0x8A,0x7F,0x3F,0x21,0xFC,
+    0xFE,0x7F,0x3F,0x9F,0xCF,0xE7,0xE0,0x45,
+    0x3F,0x29,0xFC,0xFE,0x7F,0x3F,0x9F,0xCF,
+    0xE7,0xE0,0x45,0x3F,0x29,0xFC,0xFE,0x7F,
+    0x3F,0x9F,0xCF,0xE7,0xE1,0x98,
+
+    /* Access unit 12 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x60,0x1A,
+    0xF0,0x75,0xC4,0x84,0x25,0x62,0x56,0x25,
+    0x62,0x56,0x05,0xF1,0x46,0x3F,0x67,0x3F,
+    0x67,0x3F,0x67,0xC0,0x8B,0xC4,0x9E,0x56,
+    0x25,0x62,0x56,0x25,0x60,0x0A,0x07,0x78,
+    0x14,0x0E,0xF0,0x28,0x1D,0xE0,0x50,0x3B,
+    0xC0,0xA0,0x77,0x81,0x40,0xEF,0x02,0x81,
+    0xDE,0x05,0x03,0xBC,0x0A,0x07,0x78,0x14,
+    0x0E,0xF0,0x28,0x1D,0xE0,0x50,0x3B,0xC0,
+    0xA0,0x77,0x81,0x40,0xEF,0x02,0x81,0xDE,
+    0x05,0x03,0xBC,0x0A,0x07,0x78,0x14,0x0E,
+    0xF0,0x28,0x1D,0xE0,0x50,0x3B,0xC0,0xA0,
+    0x77,0x81,0x40,0xEF,0x02,0x81,0xDE,0x05,
+    0x03,0xBC,0x0A,0x07,0x78,0x14,0x0E,0xF0,
+    0x28,0x1D,0xE0,0x50,0x3B,0xC0,0xA0,0x77,
+    0x81,0x40,0xEF,0x02,0x81,0xDE,0x08,0xB8,
+    0x21,0x14,0x5F,0xC8,0xD1,0x9D,0x4E,0x90,
+    0xBF,0x39,0xEB,0x8A,0xB6,0xFC,0x5F,0x0B,
+    0x47,0x50,0x74,0x51,0xD4,0x05,0xFE,0x2D,
+    0x67,0xDF,0x17,0xC2,0xFB,0x40,0xF6,0xCE,
+    0x86,0xF7,0x77,0xE5,0x0F,0xC3,0xE8,0x79,
+    0x20,0x60,0xE1,0x12,0x61,0xC8,0x71,0x73,
+    0xAE,0x65,0xB4,0xE8,0x76,0x50,0x7F,0xDF,
+    0x38,0x5D,0x57,0x15,0xE0,0x00,0xF4,0x01,
+    0x01,0x03,0xCD,0x3F,0x94,0x8B,0xC7,0x94,
+    0x92,0x12,0xE8,0x00,0x02,0x01,0x40,0x14,
+    0x12,0xF9,0x02,0x3E,0x18,0xA9,0x85,0x47,
+    0xA3,0xB2,0xC6,0xFE,0xFC,0xBE,0x7E,0x82,
+    0xD8,0x92,0xFE,0x02,0x18,0x01,0x08,0x06,
+    0xA6,0x83,0x2A,0x34,0xE7,0x78,0xFD,0x67,
+    0xF8,0x7C,0x08,0x07,0x56,0x8F,0x22,0x12,
+    0xAF,0xD8,0xCB,0xCA,0x0B,0xC9,0x8A,0xA0,
+    0xC3,0x80,0x5A,0x4F,0x0A,0xE7,0xF3,0xF9,
+    0xFC,0xFE,0xC0,0x39,0x20,0x71,0xF1,0x10,
+    0xE3,0xC4,0x6F,0x11,0xBC,0x46,0xF1,0x1B,
+    0xE0,0x09,0xE7,0x02,0x29,0xE1,0xDC,0xFE,
+    0x7F,0x3F,0x9F,0xCF,0xE7,0xF3,0xF9,0xFC,
+    0xFC,0x08,0xE7,0xF3,0xF9,0xFC,0xFE,0x7F,
+    0x3F,0x9F,0xCF,0xE7,0xE0,0x48,0x3F,0x9F,
+    0xCF,0xE7,0xF3,0xF9,0xFC,0xFE,0x7E,0x04,
+    0x93,0xF9,0xFC,0xFE,0x7F,0x3F,0x9F,0xCF,
+    0xC0,0x94,0x7F,0x3F,0x9F,0xCF,0xE7,0xF3,
+    0xF0,0xD4,
+
+    /* Access unit 13 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x80,0x1A,
+    0xF0,0x22,0xF0,0xE0,0x53,0x37,0x27,0x5F,
+    0x99,0x89,0x98,0x04,0x5C,0xFE,0xBB,0xBB,
+    0xF8,0x2E,0x3B,0x97,0x80,0x09,0xBD,0x11,
+    0xE2,0x3C,0x47,0x88,0xF1,0x1E,0x23,0xC4,
+    0x78,0x8F,0x11,0xE2,0x3F,0x85,0xE5,0xF2,
+    0xF9,0x78,0xAF,0x17,0x73,0xE1,0x37,0xF5,
+    0xED,0x21,0x8B,0x52,0x60,0xBF,0x2A,0x8A,
+    0x16,0x4C,0x26,0x7C,0xA8,0x3F,0x84,0x00,
+    0xDD,0x77,0x75,0x7A,0xEE,0x12,0xB8,0xAD,
+    0x7C,0x31,0x2E,0x17,0x32,0xE1,0x73,0x22,
+    0xAD,0x34,0x7A,0x10,0xA8,0x58,0xFC,0xC8,
+    0x3F,0x33,0x08,0x2C,0xA9,0xDA,0x6B,0xC4,
+    0x88,0x5F,0x85,0xB3,0xFB,0x11,0x97,0xBC,
+    0xA9,0x73,0xEB,0xD0,0xBC,0x5A,0x97,0x3E,
+    0x39,0xA9,0x8C,0xA3,0x8B,0x73,0x2B,0xD0,
+    0x44,0x16,0xC6,0xE3,0x21,0x7E,0x6B,0xBD,
+    0xFC,0xE7,0x7E,0x22,0x68,0x44,0xD3,0xC8,
+    0x68,0x86,0xA1,0x45,0x0D,0x32,0xDF,0xFB,
+    0x6D,0xED,0xB7,0x10,0xB8,0x85,0xC4,0x2E,
+    0x21,0x71,0x0B,0x88,0x5C,0x42,0xE2,0x17,
+    0x10,0xB0,0x2B,0x71,0x02,0x32,0xA9,0x7C,
+    0x80,0x51,0xA0,0x36,0xF0,0x9F,0xB4,0xA6,
+    0x03,0xDF,0xC5,0x78,0x00,0x58,0x00,0x08,
+    0x07,0x00,0x10,0xC8,0x1E,0x3E,0xFD,0x8F,
+    0x0A,0x1A,0x4B,0x6F,0x16,0x7F,0x00,0x00,
+    0x40,0x1C,0x10,0x05,0x24,0x0F,0x57,0x81,
+    0xFB,0x15,0xA4,0x79,0x53,0x40,0xA3,0x3C,
+    0x39,0xBF,0xF1,0xFC,0x26,0x5C,0x01,0x88,
+    0x00,0x04,0x17,0x85,0x00,0x01,0x01,0x0B,
+    0x50,0x53,0x13,0x1A,0x71,0xAA,0xD0,0x38,
+    0x54,0x0F,0xC6,0xC0,0x00,0x40,0xE0,0x00,
+    0x04,0x01,0xC0,0x05,0x4A,0x8A,0x06,0x47,
+    0x7F,0xEA,0xC5,0x80,0x68,0x96,0x18,0x70,
+    0x0B,0x71,0xE1,0x3C,0xFE,0x7F,0x3F,0x9F,
+    0xE0,0x0A,0x06,0x40,0xC6,0xEF,0x0A,0x61,
+    0xEC,0xB6,0x92,0x5A,0x49,0x7F,0xC4,0x78,
+    0x8F,0x11,0xE2,0x3E,0x00,0xA0,0x70,0x22,
+    0x9E,0x19,0xCF,0xE7,0xF3,0xF0,0x26,0x9F,
+    0xCF,0xE7,0xE0,0x4E,0x3F,0x9F,0x81,0x3C,
+    0xFC,0x0A,0x07,0xE1,0xA8,
+
+    /* Access unit 14 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0xA0,0x1A,
+    0xF0,0xBF,0x0B,0x84,0x22,0x55,0xE2,0x55,
+    0xE2,0x55,0xE2,0x55,0xC5,0x75,0x43,0x88,
+    0xAB,0xCF,0x05,0xC5,0x32,0xBD,0x4E,0x38,
+    0x23,0xE7,0x2C,0x52,0x6E,0x78,0x7C,0x11,
+    0x1A,0x1F,0xFF,0xB0,0x57,0x8E,0xD3,0xAF,
+    0x83,0x9D,0x88,0x39,0xD8,0x81,0x40,0xEF,
+    0x02,0x81,0xDE,0x05,0x03,0xBC,0x2E,0x77,
+    0x83,0x93,0xBC,0x2E,0x77,0x83,0x93,0xBC,
+    0x2E,0x77,0x83,0x93,0xBC,0x2E,0x77,0x83,
+    0x93,0xBC,0x2E,0x77,0x83,0x93,0xBC,0x2E,
+    0x77,0x83,0x93,0xBC,0x2E,0x77,0x83,0x93,
+    0xBC,0x2E,0x77,0x83,0x93,0xBC,0x2E,0x77,
+    0x83,0x93,0xBC,0x2E,0x77,0x83,0x93,0xBC,
+    0x2E,0x77,0x83,0x93,0xBC,0x2E,0x77,0x83,
+    0x93,0xBC,0x2E,0x77,0x83,0x93,0xBC,0x2E,
+    0x77,0x83,0x93,0xBC,0x2E,0x77,0x83,0x93,
+    0xBC,0x2E,0x77,0x83,0x93,0xBC,0x2E,0x77,
+    0x83,0x93,0xBC,0x2E,0x77,0x83,0x93,0xBC,
+    0x2E,0x77,0x83,0x93,0xBC,0x2E,0x77,0x83,
+    0x93,0xBC,0x2E,0x77,0x83,0x93,0xBC,0x2E,
+    0x77,0x83,0x93,0xBC,0x2E,0x77,0x83,0x93,
+    0xBC,0x2E,0x77,0x83,0x93,0xBC,0x2E,0x77,
+    0x83,0x93,0xBC,0x2E,0x77,0x83,0x93,0xBC,
+    0x2E,0x77,0x83,0x93,0xBC,0x2E,0x77,0x83,
+    0x93,0xBC,0x2E,0x77,0x81,0x41,0x56,0x19,
+    0x35,0x2B,0x69,0x47,0xCA,0xF8,0x63,0x0A,
+    0x40,0x85,0xF3,0xCA,0x2F,0x1D,0x5F,0x1A,
+    0x21,0x17,0x10,0xB8,0x85,0xC4,0x2E,0x21,
+    0x71,0x0B,0x88,0x5C,0x42,0xE2,0x17,0x10,
+    0xBF,0x31,0x1D,0xD3,0x3E,0x01,0x83,0x84,
+    0x78,0x65,0x7F,0xA4,0xF4,0x68,0x7E,0x54,
+    0xBD,0xD4,0x06,0xBF,0xF8,0xCF,0x86,0x20,
+    0x28,0xDF,0x21,0x80,0xE2,0x10,0x70,0xFD,
+    0x96,0xE2,0x9D,0xA1,0xC4,0x48,0x1D,0xBF,
+    0xC6,0x74,0x53,0x17,0x96,0xC2,0x17,0x0F,
+    0x83,0x70,0x07,0x24,0xEC,0x5E,0x36,0x04,
+    0x66,0xCF,0x19,0xE3,0xA5,0x2D,0xC3,0x80,
+    0x00,0x80,0x00,0x20,0x0A,0x2B,0x85,0x81,
+    0x39,0x3E,0x13,0x52,0xAA,0x94,0xFD,0xA4,
+    0xC3,0x39,0x4C,0xE3,0xEC,0x07,0xBB,0x39,
+    0xF0,0x40,0x40,0xB0,0x78,0xEF,0xC2,0x50,
+    0x91,0x45,0x72,0xD1,0xBF,0xD8,0xED,0xD6,
+    0x8C,0x39,0xBF,0xC2,0x1F,0x84,0xFF,0x81,
+    0x87,0x16,0x81,0xD5,0xD3,0x15,0xF8,0x0B,
+    0x5F,0xF5,0x69,0xC4,0x2D,0x12,0x03,0xF0,
+    0x00,0x04,0x0B,0xF8,0x00,0x08,0x01,0x87,
+    0x4C,0xA8,0x3F,0xEC,0x0F,0x22,0xC0,0xAD,
+    0x77,0x85,0x01,0x87,0x00,0xB9,0x9E,0x13,
+    0xCF,0xE7,0xF3,0xF9,0xFD,0x80,0x27,0x9F,
+    0x88,0xF1,0x1E,0x23,0xC4,0x78,0x8F,0x36,
+    0x7F,0x0F,0xF0,0xF0,0x4B,0x00,0x07,0x02,
+    0x00,0x80,0xFE,0x8C,0x30,0x52,0xE5,0x81,
+    0x12,0x94,0xFC,0xB8,0x4D,0x83,0x02,0x29,
+    0xE1,0x3C,0xFE,0x7F,0x3F,0x10,0xFE,0x04,
+    0x53,0xF9,0xFC,0xFC,0x09,0xC7,0xF3,0xF0,
+    0x27,0x9F,0x81,0x40,0xFC,0x2B,
+
+    /* Access unit 15 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0xC0,0x1A,
+    0xF0,0x47,0xC2,0xC3,0x27,0x5E,0x75,0xE7,
+    0x5E,0x75,0xD2,0xFE,0x78,0x4F,0x00,0x22,
+    0x0F,0x7A,0xC1,0xAA,0xB9,0x2A,0xAB,0x9E,
+    0x05,0x03,0xBC,0x0A,0x07,0x78,0x14,0x0E,
+    0xF0,0x28,0x1D,0xE0,0x50,0x3B,0xC0,0xA0,
+    0x77,0x81,0x40,0xEF,0x02,0x81,0xDE,0x05,
+    0x03,0xBC,0x0A,0x07,0x78,0x14,0x0E,0xF0,
+    0x28,0x1D,0xE0,0x50,0x3B,0xC0,0xA0,0x77,
+    0x81,0x40,0xEF,0x02,0x81,0xDE,0x05,0x03,
+    0xBC,0x0A,0x07,0x78,0x14,0x0E,0xF0,0x28,
+    0x1D,0xE0,0x50,0x3B,0xC0,0xA0,0x77,0x81,
+    0x40,0xEF,0x02,0x81,0xDE,0x05,0x03,0xBC,
+    0x0A,0x07,0x78,0x14,0x0E,0xF0,0x28,0x1D,
+    0xE0,0x50,0x3B,0xC0,0xA0,0x77,0x81,0x40,
+    0xEF,0x05,0xC1,0xB6,0x45,0xFA,0xD7,0xEB,
+    0x54,0xDF,0x96,0x12,0xC0,0x31,0xCF,0x2A,
+    0xCE,0x7D,0x3E,0x9B,0x4D,0xA7,0x34,0xF3,
+    0x50,0xA2,0xBF,0xFE,0x9A,0x7A,0x69,0xC4,
+    0x2E,0x21,0x71,0x0B,0x88,0x5C,0x42,0xE2,
+    0x17,0x10,0xB8,0x85,0x8D,0xE1,0x9C,0xC4,
+    0xDF,0xCB,0x61,0x02,0x1F,0x3F,0x3B,0xFE,
+    0x17,0xE5,0x99,0x7E,0x2F,0x87,0x2E,0xFC,
+    0x63,0x2B,0xCF,0x6B,0xA7,0xDC,0x69,0x9E,
+    0x06,0x0E,0x69,0x42,0x81,0xF4,0x4A,0x7F,
+    0x88,0xE7,0x03,0x95,0x3C,0x8C,0x94,0x97,
+    0x93,0xA9,0x07,0x7C,0x7F,0x0E,0xD1,0x55,
+    0xB6,0x00,0x08,0x00,0x08,0x1D,0xE1,0xC2,
+    0x93,0x4A,0x10,0xF4,0x9C,0x21,0x91,0x5C,
+    0x95,0x2C,0x8B,0x44,0x51,0xE0,0x00,0x08,
+    0x0F,0x80,0x00,0x81,0x2C,0x80,0x05,0xF2,
+    0xA0,0x08,0x04,0x79,0x15,0x7E,0x88,0x85,
+    0x41,0x7F,0x97,0x28,0x78,0x72,0x27,0xF0,
+    0x06,0x74,0x00,0xA0,0xCD,0x78,0x02,0x9B,
+    0xA4,0xD0,0x71,0x79,0xE9,0xC3,0xFE,0x0F,
+    0x80,0x18,0x50,0x02,0x81,0x73,0x28,0xB6,
+    0x35,0x0B,0x52,0x65,0xC3,0x9C,0x7C,0x16,
+    0x3E,0x0C,0x38,0x05,0xE0,0xF0,0x8E,0x7F,
+    0x3F,0x9F,0xCF,0xF0,0x04,0xF3,0xC4,0x78,
+    0x8F,0x11,0xE2,0x3C,0x47,0x02,0x31,0xFC,
+    0xFE,0x7F,0x3F,0x39,0xF8,0x11,0x8F,0xE7,
+    0xF3,0xF1,0x07,0xE0,0x46,0x3F,0x9F,0x89,
+    0x3F,0x02,0x31,0xF8,0xA3,0xF0,0x23,0x1F,
+    0x8A,0x3F,0x34,
+
+    /* Access unit 16 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0xE0,0x1A,
+    0xF1,0x9C,0xA2,0xB8,0x2B,0xC4,0x20,0xBE,
+    0x7B,0x65,0xF0,0xD7,0x2C,0x22,0xF9,0xAD,
+    0x1B,0xC6,0x71,0x38,0xC5,0x2A,0x29,0x51,
+    0x4A,0x8A,0x0B,0xE0,0x9C,0x84,0xF9,0x3C,
+    0x9E,0x4F,0x12,0xE8,0x14,0x38,0xA9,0x3C,
+    0x9E,0x4F,0x27,0x81,0x40,0x26,0xE1,0xC5,
+    0x33,0xC8,0xF9,0x1F,0xF2,0x3E,0x47,0xC2,
+    0xFC,0x56,0x4F,0x27,0x93,0xC9,0xC1,0xC9,
+    0xDE,0x17,0x0D,0xB8,0x69,0x4C,0xF9,0x1F,
+    0x23,0xFE,0x47,0xC8,0xF4,0xDF,0x96,0x12,
+    0xC0,0x1C,0x9D,0xE1,0x73,0xBC,0x1C,0x9D,
+    0xE1,0x73,0xBC,0x1C,0x9D,0xE1,0x73,0xBC,
+    0x1C,0x9D,0xE1,0x73,0xBC,0x1C,0x9D,0xE1,
+    0x73,0xBC,0x1C,0x9D,0xE1,0x73,0xBC,0x1C,
+    0x9D,0xE1,0x73,0xBC,0x1C,0x9D,0xE1,0x73,
+    0xBC,0x1C,0x9D,0xE1,0x73,0xBC,0x1C,0x9D,
+    0xE1,0x73,0xBC,0x1C,0x9D,0xE1,0x73,0xBC,
+    0x1C,0x9D,0xE1,0x73,0xBC,0x1C,0x9D,0xE1,
+    0x73,0xBC,0x1C,0x9D,0xE1,0x73,0xBC,0x1C,
+    0x9D,0xE1,0x73,0xBC,0x1C,0x9D,0xE1,0x73,
+    0xBC,0x1C,0x9D,0xE1,0x73,0xBC,0x1C,0x9D,
+    0xE1,0x73,0xBC,0x1C,0x9D,0xE1,0x73,0xBC,
+    0x1C,0x9D,0xE1,0x73,0xBC,0x1C,0x9D,0xE1,
+    0x73,0xBC,0x1C,0x9D,0xE1,0x73,0xBC,0x1C,
+    0x9D,0xE1,0x73,0xBC,0x1C,0x9D,0xE1,0x73,
+    0xBC,0x1C,0x9D,0xE1,0x73,0xBC,0x1C,0x9D,
+    0xE1,0x73,0xBC,0x1C,0x9D,0xE1,0x73,0xBC,
+    0x1C,0x9D,0xE1,0x73,0xBC,0x1C,0x9D,0xE0,
+    0xBB,0x9C,0x9E,0x08,0x70,0xCA,0xEF,0xF3,
+    0x69,0x0A,0x61,0x7E,0x16,0x2D,0xDC,0xAB,
+    0xCE,0xC7,0xAD,0x49,0x1F,0xE2,0x17,0x10,
+    0xB8,0x85,0xC4,0x2E,0x21,0x71,0x0B,0x88,
+    0x5C,0x42,0xE2,0x17,0x10,0xB4,0x10,0x5A,
+    0x55,0x89,0x9A,0x13,0x35,0x90,0xD1,0x0D,
+    0x0B,0xE1,0xBE,0x5C,0x2E,0x27,0x7E,0xF1,
+    0xD2,0xE7,0x17,0xC2,0xF2,0x29,0x79,0x38,
+    0x64,0x76,0x2F,0xAE,0x61,0x31,0xD6,0x3E,
+    0x06,0x0E,0x3B,0x86,0x17,0xCD,0xE7,0xB5,
+    0x38,0x13,0x43,0x5F,0x8B,0x99,0xE7,0xBC,
+    0xC1,0x27,0xFC,0x57,0x0E,0x5F,0x13,0xB1,
+    0xE2,0x6F,0x36,0x18,0xF7,0xE3,0x3A,0x64,
+    0x2F,0xB8,0x00,0x20,0x00,0x08,0x01,0x80,
+    0x22,0xC0,0x14,0x7B,0xC4,0x68,0x12,0x33,
+    0x89,0x6A,0xD7,0x69,0xA1,0x64,0xBB,0xFC,
+    0x00,0x01,0x01,0x20,0x00,0x42,0x80,0x04,
+    0xB8,0xD8,0x9D,0x24,0xA2,0x9E,0xBA,0xAF,
+    0xA3,0x72,0xE9,0x0F,0xC4,0xFF,0x00,0x02,
+    0x20,0x00,0x08,0x1C,0x05,0x02,0x0C,0xDD,
+    0x9F,0xA2,0x5F,0xCC,0x83,0xF8,0xFE,0x92,
+    0x03,0xAC,0xF9,0x7C,0x9F,0x2F,0x7F,0xC0,
+    0x2F,0xA7,0x8F,0xCF,0xE7,0xF3,0xF9,0xFE,
+    0x00,0xA0,0x78,0x8F,0x11,0xE2,0x3C,0x47,
+    0x88,0xE0,0x46,0x3F,0x9F,0xCF,0xE7,0xE0,
+    0x4D,0x3F,0x9F,0xCF,0xC0,0x9C,0x7F,0x3F,
+    0x02,0x79,0xF8,0x14,0x0F,0xC5,0xC0
+};
+
+/* 1280 x 720 H.264 test stream: colour bars with the frame number burned in (tools/fx3_uvc_h26x_frames.py).
+ * One GOP of 16 Annex B access units, IDR first; profile_idc 66, constraint flags 0xC0, level_idc 31.
+ * Constant QP 28.
+ * Access units of 78 to 3692 bytes, 5191 bytes in all. */
+const uint32_t glVidFrameLenH264_1280x720_QP28[16] = {
+    3692, 124, 90, 101, 90, 87, 95, 93,
+    87, 137, 86, 127, 93, 110, 101, 78
+};
+
+const uint8_t glUVCVidFramesH264_1280x720_QP28[] __attribute__ ((aligned (32))) =
+{
+    /* Access unit 1 (IDR) */
+    0x00,0x00,0x00,0x01,0x67,0x42,0xC0,0x1F,
+    0xDA,0x01,0x40,0x16,0xE8,0x40,0x00,0x00,
+    0x03,0x00,0x40,0x00,0x00,0x07,0xA3,0xC6,
+    0x0C,0xA8,0x00,0x00,0x00,0x01,0x68,0xCE,
+    0x09,0x2C,0x80,0x00,0x00,0x01,0x65,0x88,
+    0x84,0x3F,0x26,0x28,0x00,0x08,0x3C,0x49,
+    0xC9,0xC9,0xC9,0xC9,0xC9,0xC9,0xC9,0xC9,
+    0xC9,0xFC,0x3F,0xFE,0x1A,0xC1,0xA4,0xD0,
+    0x7B,0xE2,0x00,0x00,0x80,0xB0,0x00,0x08,
+    0x10,0xC4,0x04,0x48,0x1C,0x02,0x14,0xEB,
+    0x98,0x70,0x08,0x53,0xAE,0x61,0x66,0xE6,
+    0x4C,0xDC,0xC4,0x6A,0xD2,0x72,0x72,0x72,
+    0x72,0x72,0x72,0x72,0x72,0x7F,0xF0,0xFF,
+    0x82,0xCC,0x07,0x91,0x00,0xD3,0x38,0x80,
+    0x00,0x20,0x0A,0x00,0x91,0x00,0x00,0xF0,
+    0x0F,0x83,0x80,0x40,0x1E,0x10,0x70,0x08,
+    0x02,0xC2,0x0E,0x02,0x01,0x21,0x07,0x01,
+    0x00,0x90,0x11,0x9E,0x3C,0xF2,0x72,0x72,
+    0x72,0x72,0x72,0x72,0x72,0x72,0x72,0x7F,
+    0x0F,0xFF,0x82,0xBC,0x50,0x01,0xE2,0x00,
+    0x00,0x80,0x20,0x00,0x08,0x19,0xC4,0x10,
+    0x0A,0x0E,0x00,0x80,0x66,0x30,0x70,0x04,
+    0x03,0x31,0x10,0x2C,0x62,0x05,0x88,0x8E,
+    0xF2,0x72,0x72,0x72,0x72,0x72,0x72,0x72,
+    0x72,0x7F,0xE1,0xFF,0x82,0xC8,0x0F,0x32,
+    0x34,0xCF,0xE2,0x00,0x00,0x80,0xE8,0x00,
+    0x1A,0x20,0x00,0x08,0x16,0x80,0x00,0x80,
+    0x86,0x0E,0x00,0x80,0x2C,0x20,0xE0,0x08,
+    0x02,0xC2,0x0E,0x00,0x08,0x00,0x58,0x41,
+    0xC0,0x01,0x00,0x0B,0x01,0x1A,0xD4,0x9C,
+    0x9C,0x9C,0x9C,0x9C,0x9C,0x9C,0x9C,0x9C,
+    0x9F,0x87,0xFF,0xE0,0xAE,0x0D,0x26,0x82,
+    0xF8,0x80,0x00,0x40,0x00,0x04,0x11,0xE3,
+    0x40,0x00,0x94,0x0E,0x01,0x08,0x75,0xCC,
+    0x38,0x04,0x21,0xD7,0x30,0xBB,0x73,0x27,
+    0x6E,0x62,0x35,0x69,0x39,0x39,0x39,0x39,
+    0x39,0x39,0x39,0x39,0x3F,0xF0,0xFF,0xC1,
+    0x64,0x07,0x91,0x00,0xD3,0x3B,0xE2,0x00,
+    0x00,0x81,0xB8,0x00,0x08,0x0D,0x44,0x00,
+    0x01,0x02,0xA0,0x00,0x10,0x0F,0xC0,0xE0,
+    0x9C,0x7B,0x90,0xE0,0x9C,0x7B,0x90,0x39,
+    0x08,0x4B,0x90,0xE4,0x21,0x2E,0x08,0xD7,
+    0xD2,0x72,0x72,0x72,0x72,0x72,0x72,0x72,
+    0x72,0x72,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x3B,0x69,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xA7,0xA7,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xB9,0x9E,0xF5,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x33,
+    0xAD,0x4D,0xEA,0x96,0x96,0x96,0x96,0x96,
+    0x96,0x96,0x96,0x96,0x96,0x67,0x0F,0xD3,
+    0x2A,0x9E,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0x7A,0x7A,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xE9,0xE9,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xA7,0xA7,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0x7A,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xA7,0x74,0xF5,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x4F,
+    0x4F,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x3D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x74,0xF4,0xF5,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x3D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD3,0xAA,0x7A,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xA7,0xA7,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0x9E,
+    0x9E,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0x7A,0x7A,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xE9,0xE9,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0x9E,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xE9,0xDD,0x3D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x4F,0x4F,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x3D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x74,0xF4,0xF5,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x4F,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x74,0xEA,0x9E,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xE9,0xE9,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xA7,0xA7,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0x9E,
+    0x9E,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0x7A,0x7A,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xA7,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0x77,0x4F,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x74,0xF4,0xF5,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x4F,0x4F,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x3D,
+    0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x3A,0xA7,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0x7A,0x7A,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xE9,0xE9,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xA7,0xA7,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0x9E,0x9E,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xE9,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0x9D,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x74,0xF4,0xF5,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x4F,0x4F,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xF5,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x4E,
+    0xA9,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0x9E,0x9E,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0x7A,0x7A,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xE9,0xE9,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xA7,0xA7,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0x7A,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xA7,0x74,
+    0xF5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x4F,0x4F,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x3D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x74,0xF4,0xF5,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x3D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xAA,0x7A,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xA7,
+    0xA7,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0x9E,0x9E,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0x7A,0x7A,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xE9,0xE9,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0x9E,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xE9,0xDD,0x3D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x4F,
+    0x4F,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x3D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x74,0xF4,0xF5,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x4F,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x74,0xEA,0x9E,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xE9,0xE9,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xA7,0xA7,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0x9E,0x9E,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0x7A,0x7A,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xA7,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0x77,0x4F,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x74,0xF4,0xF5,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x4F,
+    0x4F,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x3D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x3A,0xA7,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0x7A,0x7A,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xE9,0xE9,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xA7,0xA7,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0x9E,
+    0x9E,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xE9,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0x9D,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x74,0xF4,0xF5,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x4F,0x4F,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,
+    0xF5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x4E,0xA9,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0x9E,0x9E,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0x7A,0x7A,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xE9,0xE9,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xA7,0xA7,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0x7A,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xA7,
+    0x74,0xF5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x4F,0x4F,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x74,0xF4,0xF5,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x3D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xAA,
+    0x7A,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xA7,0xA7,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0x9E,0x9E,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0x7A,0x7A,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xE9,0xE9,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0x9E,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xE9,0xDD,0x3D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,
+    0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x4F,0x4F,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x74,0xF4,0xF5,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x4F,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x74,0xEA,0x9E,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xE9,0xE9,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xA7,
+    0xA7,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0x9E,0x9E,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0x7A,0x7A,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xA7,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0x77,0x4F,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xF4,0xF5,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x4F,0x4F,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x3D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x3A,0xA7,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0x7A,0x7A,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xE9,0xE9,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xA7,
+    0xA7,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0x9E,0x9E,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xE9,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0x9D,0xD3,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x3D,0x3D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x74,0xF4,0xF5,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x4F,
+    0x4F,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x74,0xF5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x4E,0xA9,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0x9E,0x9E,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0x7A,0x7A,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xE9,0xE9,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xA7,0xA7,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0x7A,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xA7,0x74,0xF5,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x4F,0x4F,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x74,0xF4,0xF5,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x3D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,
+    0xAA,0x7A,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xA7,0xA7,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0x9E,0x9E,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0x7A,0x7A,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xE9,0xE9,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0x9E,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xE9,0xDD,
+    0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD3,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x4F,0x4F,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x74,0xF4,0xF5,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x4F,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xEA,0x9E,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xE9,
+    0xE9,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xA7,0xA7,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0x9E,0x9E,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0x7A,0x7A,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xA7,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0x77,0x4F,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xF4,
+    0xF5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,
+    0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x4F,0x4F,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD3,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x3A,0xA7,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0x7A,0x7A,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xE9,0xE9,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xA7,0xA7,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0x9E,0x9E,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xE9,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0x9D,0xD3,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x3D,0x3D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xF4,0xF5,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0xFF,
+    0xF1,0xF8,0x20,0xE2,0x80,0x00,0x82,0x6E,
+    0xFB,0xEF,0xBE,0xFB,0xEF,0xBE,0xFB,0xF8,
+    0x7F,0x88,0x60,0x0C,0x15,0x42,0x00,0x20,
+    0xED,0x38,0x0F,0xBC,0x00,0xA7,0x86,0xAC,
+    0x47,0x3D,0x57,0x8B,0x20,0x00,0x20,0x02,
+    0x67,0x1C,0xE2,0xED,0xAD,0xAD,0xAD,0xAD,
+    0xAD,0xAD,0xAD,0xAD,0xAD,0xAF,0xF0,0xF1,
+    0xF0,0x60,0xAA,0x10,0x08,0x1D,0x02,0x82,
+    0x0D,0x79,0x83,0x90,0x00,0x10,0x01,0x32,
+    0x01,0x42,0x60,0x31,0xC8,0x9C,0xD8,0xB6,
+    0x01,0x65,0x01,0x38,0x59,0xCC,0x2D,0x43,
+    0xA3,0x2D,0x1F,0xFF,0xD4,0xC9,0x4C,0xB5,
+    0xB5,0xB5,0xB5,0xB5,0xB5,0xB5,0xB5,0xB5,
+    0xB5,0xE1,0xFE,0x21,0x80,0x30,0x55,0x08,
+    0x08,0xE9,0x70,0x1C,0x00,0x0F,0xC0,0x09,
+    0x80,0x3D,0xC8,0x04,0xA1,0x58,0x48,0x78,
+    0x01,0x99,0xC0,0x73,0x80,0x01,0xEA,0x43,
+    0xC0,0x01,0x99,0x3A,0xCA,0xB2,0xD6,0xD6,
+    0xD6,0xD6,0xD6,0xD6,0xD6,0xD6,0xD7,0xF0,
+    0xF8,0xF0,0x06,0x0A,0xA1,0x00,0x02,0x51,
+    0x90,0x10,0x00,0x13,0x38,0x65,0x60,0xF0,
+    0x03,0x32,0x01,0x82,0x40,0x34,0x09,0x56,
+    0xC1,0xE0,0x00,0xCC,0x80,0x3E,0x62,0x05,
+    0xC1,0x15,0x63,0xA8,0x6B,0x2D,0x13,0x26,
+    0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,0xB6,
+    0xB6,0xB8,0x7F,0xC0,0x30,0x06,0x0A,0xA1,
+    0x47,0xD8,0x40,0x00,0x10,0x02,0x00,0xEB,
+    0x00,0x3B,0xC4,0xAE,0x4A,0x73,0x4F,0x3C,
+    0x02,0x67,0x01,0xC7,0x00,0x02,0x94,0x87,
+    0x10,0x00,0x10,0x00,0x32,0xD6,0xD6,0xD6,
+    0xD6,0xD6,0xD6,0xD6,0xD6,0xD6,0xD7,0xF0,
+    0xF8,0xF0,0x06,0x0A,0xA1,0x00,0x01,0x56,
+    0x04,0x48,0x40,0x00,0x40,0x21,0x24,0xE2,
+    0x00,0x4C,0x80,0x21,0x66,0x88,0xC0,0x02,
+    0x6D,0x7B,0x07,0x10,0x00,0x10,0x00,0x32,
+    0x01,0x9D,0x90,0xDA,0xE0,0xB5,0x56,0x3E,
+    0xC6,0x4C,0x67,0xED,0x6D,0x6D,0x6D,0x6D,
+    0x6D,0x6D,0x6D,0x6D,0x6D,0x6B,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0x5A,0x5A,
+    0x5A,0x5A,0x5A,0x5A,0x5A,0x5A,0x5A,0x5A,
+    0x5A,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,
+    0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,
+    0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,
+    0x5A,0x5A,0x5A,0x5A,0x5A,0x5A,0x5A,0x5A,
+    0x5A,0x5A,0x5A,0x5A,0x5A,0x5A,0x5A,0x5A,
+    0x5A,0x5A,0x5A,0x5A,0x5A,0x5A,0x5A,0x5B,
+    0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,
+    0x5B,0x5B,0x5A,0xEB,0xAE,0xBF,0x86,0x30,
+    0x60,0xAF,0xBE,0x00,0x08,0x84,0x44,0x4E,
+    0xEA,0x29,0x2E,0x9D,0x60,0x24,0xF7,0xAE,
+    0x6E,0xC4,0x8A,0x47,0x74,0x1D,0x9F,0x10,
+    0x0D,0x51,0x30,0x4C,0x20,0x5F,0xAD,0x88,
+    0x79,0x80,0x78,0x1E,0x45,0xC2,0xB2,0x93,
+    0x53,0x90,0x48,0xE2,0xE5,0x34,0xD5,0x6C,
+    0x75,0x04,0xA5,0xAD,0x5E,0xBF,0xB1,0x98,
+    0xCE,0x0B,0xA9,0xF2,0x10,0x43,0x8F,0xFF,
+    0x9B,0x4C,0x83,0xC7,0xD4,0x77,0x38,0x86,
+    0x2C,0x8F,0xFB,0xFF,0xFE,0xB8,0x8F,0xA3,
+    0x77,0xC0,0x38,0x30,0xFB,0x12,0xB2,0x06,
+    0x62,0xBB,0x8C,0x79,0x82,0x00,0x78,0x90,
+    0x4E,0x61,0xF8,0x52,0xA6,0xFF,0xEC,0x08,
+    0x04,0xA2,0x27,0x3B,0x6D,0x79,0x14,0x35,
+    0xAF,0xFF,0xDD,0x2F,0x38,0x08,0x75,0xCF,
+    0x90,0x47,0xD7,0xFE,0xD4,0x30,0x4B,0x84,
+    0xB4,0x76,0xB5,0x9A,0x43,0x17,0x68,0xF0,
+    0x04,0xCB,0x4C,0x51,0x8F,0x36,0xB6,0x1F,
+    0xFF,0xFF,0xF8,0x0E,0x18,0x22,0x26,0x28,
+    0xDB,0xF5,0xCA,0xDC,0xCB,0x60,0x0E,0xD4,
+    0x11,0x14,0x98,0xDE,0xCF,0xF0,0x7F,0xDD,
+    0xF9,0xFB,0x04,0x2F,0xFA,0x58,0x1A,0xCD,
+    0xC7,0x94,0x54,0x98,0x11,0x4D,0x30,0xF4,
+    0x03,0xC5,0x24,0x87,0x42,0x9E,0x0C,0xFB,
+    0xB0,0x15,0x40,0x09,0x96,0x1C,0x83,0x9E,
+    0x6D,0x64,0xFB,0x55,0x00,0x5A,0xB1,0x03,
+    0xEC,0xE1,0x0A,0xFD,0xF4,0xF1,0x37,0x46,
+    0x75,0xDB,0xFC,0x08,0x84,0xB6,0x14,0x56,
+    0xE6,0xF9,0x0D,0x31,0x1E,0x1F,0xA3,0x82,
+    0xBA,0xA5,0x32,0xD0,0xDB,0x4A,0xF9,0xA6,
+    0xDC,0x01,0xE9,0x03,0x94,0x55,0xCC,0x77,
+    0xF7,0xF0,0xFF,0xAA,0x62,0x02,0xD8,0x43,
+    0x7C,0x03,0x91,0xB4,0x6E,0x30,0x11,0x10,
+    0xA0,0x28,0x88,0xB4,0x80,0x31,0x79,0x44,
+    0x57,0xD5,0x80,0x96,0x63,0x72,0xAB,0xF0,
+    0x08,0x13,0x8A,0xEA,0x67,0x83,0xE5,0x8D,
+    0x08,0x2D,0x72,0xB6,0xD3,0x42,0xEC,0xD1,
+    0x22,0xC3,0x77,0x9A,0x29,0xDA,0x7B,0xFC,
+    0x1F,0x8D,0x7E,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAF,0xE3,0xFF,0xF0,
+    0x9F,0x03,0x80,0x01,0x40,0x00,0x10,0x03,
+    0x00,0xA6,0x5C,0xF7,0xA4,0xFB,0xEF,0xF1,
+    0xE3,0xF0,0xF0,0xFF,0x00,0x42,0x11,0x08,
+    0x50,0x14,0x7B,0xC0,0x51,0xB9,0xFA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAD,0xD7,
+    0x5D,0x75,0xD6,0x5E,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xF0,
+
+    /* Access unit 2 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0x23,0xC0,
+    0x05,0x7C,0x71,0x9E,0x1B,0xD2,0xC0,0x05,
+    0xD0,0x85,0xEC,0xCB,0x3C,0x22,0x52,0x85,
+    0xE4,0x1C,0x00,0x3B,0x7F,0xCA,0x7C,0x87,
+    0xC1,0x21,0x24,0x72,0x9C,0x0A,0xCF,0x53,
+    0xCC,0x67,0x83,0x0E,0x01,0x39,0x3F,0x9F,
+    0xCF,0xE7,0xF3,0x7F,0xFC,0x38,0x7F,0xC0,
+    0x05,0x61,0x7C,0x77,0x30,0x8B,0x7A,0x8F,
+    0x57,0xB0,0x26,0xF1,0x1E,0x23,0xC4,0x78,
+    0x8F,0x80,0x27,0x9C,0x08,0xC7,0xF3,0xF9,
+    0xFC,0xFE,0x7E,0x8F,0xE7,0xF3,0xF0,0x24,
+    0x1F,0xCF,0xE7,0xF3,0xF9,0xFA,0x3F,0x9F,
+    0x81,0x24,0xFE,0x7F,0x3F,0x9F,0xCF,0xD1,
+    0xF8,0x12,0x8F,0xE7,0xF3,0xF9,0xFC,0xFD,
+    0x1F,0x81,0x28,0xFE,0x7F,0x3F,0x9F,0xCF,
+    0xD1,0xF8,0x12,0xA0,
+
+    /* Access unit 3 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0x43,0xC0,
+    0x05,0x7C,0x71,0x9E,0x00,0x21,0xFA,0xEF,
+    0xBB,0x30,0x31,0x2F,0xC2,0x12,0x17,0x28,
+    0xDA,0xFD,0xFD,0xF0,0x20,0xB1,0xD8,0x49,
+    0xD2,0xBC,0x74,0x43,0xF3,0xD9,0x83,0x54,
+    0x0C,0x55,0x91,0xFB,0x45,0xD8,0x61,0xC0,
+    0x27,0xA7,0xF3,0xF9,0xFC,0xFE,0x7F,0x80,
+    0x27,0x9E,0x23,0xC4,0x78,0x8F,0x11,0xE2,
+    0x3D,0x80,0x29,0x5F,0x02,0x29,0xFC,0xFE,
+    0x7F,0x3F,0x02,0x69,0xFC,0xFE,0x7E,0x04,
+    0xE3,0xF9,0xF8,0x13,0xCF,0xC0,0xA0,0x7E,
+    0x04,0xC8,
+
+    /* Access unit 4 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0x63,0xC0,
+    0x05,0x7C,0x17,0xF8,0xBC,0xA1,0x01,0x9E,
+    0x00,0x22,0x33,0xEE,0x5A,0x79,0x80,0xB9,
+    0xE1,0x4C,0x61,0x17,0x05,0xB2,0x8B,0x57,
+    0x83,0x81,0x7D,0x6E,0x46,0xD4,0x46,0xDF,
+    0xCB,0x4F,0xC6,0x19,0x53,0x6F,0x29,0xEC,
+    0x05,0xE6,0x78,0xDD,0x5D,0x64,0x7F,0xFF,
+    0x97,0xF8,0x05,0x08,0xFE,0x7F,0x3F,0x9F,
+    0xCF,0xF0,0x05,0x03,0xE0,0x0A,0x07,0x88,
+    0xF1,0x1E,0x23,0xC4,0x7C,0x01,0x40,0xE0,
+    0x45,0x3F,0x9F,0xCF,0xE7,0xE0,0x4D,0x3F,
+    0x9F,0xCF,0xC0,0x9C,0x7F,0x3F,0x02,0x79,
+    0xF8,0x14,0x0F,0xC0,0x8F,
+
+    /* Access unit 5 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0x83,0xC0,
+    0x05,0x7C,0x3C,0x3C,0x86,0x78,0x03,0x51,
+    0x0B,0x53,0x92,0x3D,0x87,0x80,0xDC,0xE0,
+    0x4C,0xC1,0x5E,0xAF,0x83,0xD1,0x52,0xA5,
+    0xEC,0xE8,0x3E,0x7E,0xCF,0xFA,0x44,0xC7,
+    0x20,0x9D,0xF0,0x4A,0x96,0x68,0x80,0xC3,
+    0x80,0x51,0xCF,0xE7,0xF3,0xF9,0xFC,0xFF,
+    0x00,0x4F,0x3C,0x47,0x88,0xF1,0x1E,0x23,
+    0xC4,0x7C,0x01,0x3C,0xE0,0x45,0x3F,0x9F,
+    0xCF,0xE7,0xE0,0x4D,0x3F,0x9F,0xCF,0xC0,
+    0x9C,0x7F,0x3F,0x02,0x79,0xF8,0x14,0x0F,
+    0xC0,0x85,
+
+    /* Access unit 6 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0xA3,0xC0,
+    0x05,0x7C,0x71,0x9E,0x00,0x68,0x3C,0x59,
+    0xB5,0x98,0x33,0x47,0x14,0x97,0x8A,0xBA,
+    0x7F,0xFF,0xF5,0xF0,0x21,0xCC,0x9C,0x4C,
+    0x8F,0x23,0x2F,0x43,0x1B,0xFC,0x02,0x98,
+    0x7F,0x3F,0x9F,0xCF,0xE7,0xF8,0x02,0x79,
+    0x93,0xC0,0x8B,0xF1,0xBF,0xA7,0x00,0x4F,
+    0x3C,0x47,0x88,0xF1,0x1E,0x23,0xE0,0x09,
+    0xE7,0x02,0x29,0xFC,0xFE,0x7F,0x3F,0x02,
+    0x69,0xFC,0xFE,0x7E,0x04,0xE3,0xF9,0xF8,
+    0x13,0xCF,0xC0,0xA0,0x7E,0x0F,0x60,
+
+    /* Access unit 7 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0xC3,0xC0,
+    0x05,0x7C,0x71,0x9E,0x00,0x12,0x9E,0xF1,
+    0x4C,0x8E,0x3E,0x29,0x49,0x7C,0x21,0xB8,
+    0xD0,0xCB,0x46,0x7C,0xC2,0x97,0x30,0x7F,
+    0xD9,0xAD,0x8C,0x82,0xA2,0xBD,0xCD,0x87,
+    0xC6,0x61,0xB4,0x82,0x8B,0x9E,0xE9,0xBB,
+    0x39,0xD0,0x61,0xC0,0x2A,0x27,0xF3,0xF9,
+    0xFC,0xFE,0x7F,0x80,0x28,0x1F,0x00,0x50,
+    0x3C,0x47,0x88,0xF1,0x1E,0x23,0xE0,0x0A,
+    0x07,0x02,0x29,0xFC,0xFE,0x7F,0x3F,0x02,
+    0x69,0xFC,0xFE,0x7E,0x04,0xE3,0xF9,0xF8,
+    0x13,0xCF,0xC0,0xA0,0x7E,0x0E,0x20,
+
+    /* Access unit 8 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0xE3,0xC0,
+    0x05,0x7C,0x71,0x9E,0x00,0x15,0x48,0x1E,
+    0xA6,0xEA,0xC8,0x7E,0x72,0x3F,0x38,0x0B,
+    0x0B,0x3E,0xC5,0xEA,0xA2,0x8D,0xE5,0x07,
+    0xD9,0xF8,0x88,0x31,0x3F,0x70,0x96,0x1F,
+    0xE4,0x82,0x2D,0xA2,0x08,0x96,0x27,0x8C,
+    0xBB,0xC0,0x61,0xC0,0x2A,0xC7,0xF3,0xF9,
+    0xFC,0xFE,0x7F,0x80,0x27,0x9E,0x23,0xC4,
+    0x78,0x8F,0x11,0xE2,0x3E,0x00,0x9E,0x70,
+    0x22,0x9F,0xCF,0xE7,0xF3,0xF0,0x26,0x9F,
+    0xCF,0xE7,0xE0,0x4E,0x3F,0x9F,0x81,0x3C,
+    0xFC,0x0A,0x07,0xE0,0xCE,
+
+    /* Access unit 9 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x03,0xC0,
+    0x05,0x7C,0x71,0x9E,0x00,0x44,0x4F,0x89,
+    0x1F,0x39,0x80,0xBB,0x64,0x28,0x73,0xD4,
+    0x1B,0x51,0xEB,0xFC,0x1C,0x50,0x28,0xC4,
+    0xA4,0x58,0xFB,0xF4,0xC6,0xB9,0x22,0xB0,
+    0x9D,0xDF,0xED,0x7F,0xC0,0x2B,0x62,0x3C,
+    0xFE,0x7F,0x3F,0x9F,0xE0,0x09,0xE7,0x88,
+    0xF1,0x1E,0x23,0xC4,0x78,0x8F,0x80,0x27,
+    0x9C,0x08,0xA7,0xF3,0xF9,0xFC,0xFC,0x09,
+    0xA7,0xF3,0xF9,0xF8,0x13,0x8F,0xE7,0xE0,
+    0x4F,0x3F,0x02,0x81,0xF8,0x2E,0x80,
+
+    /* Access unit 10 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x23,0xC0,
+    0x05,0x7C,0x25,0xC6,0x70,0x15,0x12,0xB1,
+    0xEB,0x40,0x38,0x80,0xD7,0x60,0xCF,0xD3,
+    0x03,0xD9,0x86,0xA3,0xD1,0x47,0xA5,0xB5,
+    0xDD,0xFF,0x81,0xB0,0x12,0x78,0xE8,0x51,
+    0xDF,0x14,0x22,0xFF,0xEC,0x2B,0x1A,0x16,
+    0xA4,0x23,0xD2,0xFF,0x50,0x92,0x71,0x52,
+    0x29,0x9C,0x7E,0x79,0x4E,0xE3,0x80,0xD3,
+    0x57,0x53,0x8E,0xE8,0xB9,0x10,0x0C,0x39,
+    0xB3,0xFE,0x3F,0x84,0xF8,0x34,0x05,0x11,
+    0x85,0xB9,0xA6,0x71,0xED,0xF7,0xC1,0x03,
+    0xC2,0xAF,0x6E,0x48,0x3E,0xBD,0xFF,0x80,
+    0x57,0xCF,0xE7,0xF3,0xF9,0xFC,0xFF,0x00,
+    0x50,0x3C,0x47,0x88,0xF1,0x1E,0x23,0xC4,
+    0x7C,0x01,0x40,0xE0,0x45,0x3F,0x9F,0xCF,
+    0xE7,0xE0,0x4D,0x3F,0x9F,0xCF,0xC0,0x9C,
+    0x7F,0x3F,0x02,0x79,0xF8,0x14,0x0F,0xC1,
+    0x4C,
+
+    /* Access unit 11 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x43,0xC0,
+    0x05,0x7C,0x71,0x5E,0x00,0x16,0xCC,0x0D,
+    0x9C,0x9C,0x42,0x33,0x69,0x2D,0xB4,0x05,
+    0xB0,0x25,0xF1,0x90,0xC3,0x3E,0x6A,0x04,
+    0xA1,0xCD,0xFE,0x10,0xFC,0x3D,0xC7,0x80,
+    0x10,0x41,0x58,0x4C,0xC0,0x2C,0x87,0xF3,
+    0xF9,0xFC,0xFE,0x7F,0x80,0x27,0x9E,0x23,
+    0xC4,0x78,0x8F,0x11,0xE2,0x3E,0x00,0x9E,
+    0x70,0x22,0x9F,0xCF,0xE7,0xF3,0xF0,0x26,
+    0x9F,0xCF,0xE7,0xE0,0x4E,0x3F,0x9F,0x81,
+    0x3C,0xFC,0x0A,0x07,0xE0,0x92,
+
+    /* Access unit 12 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x63,0xC0,
+    0x05,0x7C,0x71,0x5E,0x00,0x52,0x62,0x5C,
+    0xB2,0x6F,0xFE,0xB4,0x09,0x46,0x6C,0x8E,
+    0x0A,0x34,0x1C,0xB3,0xB7,0xF7,0xE6,0xFF,
+    0x68,0xFE,0x13,0xE0,0xD0,0x48,0x4C,0x82,
+    0xFC,0x14,0xC3,0xFE,0xF9,0xF6,0x8B,0x7E,
+    0x64,0x73,0x17,0x62,0xFC,0xFF,0x80,0x5A,
+    0x4F,0xE7,0xF3,0xF9,0xFC,0xFE,0xC0,0x15,
+    0x4F,0xC4,0x78,0x8F,0x11,0xE2,0x3C,0x47,
+    0xC0,0x13,0xDC,0x4F,0x06,0xD8,0x15,0x63,
+    0x80,0xE5,0x30,0x70,0x1C,0xA6,0x04,0x53,
+    0xF9,0xFC,0xFE,0x7E,0x8F,0xE7,0xF3,0xF9,
+    0xFC,0xFD,0x56,0x04,0x53,0xF9,0xFC,0xFD,
+    0x9F,0xCF,0xE7,0xF3,0xF0,0x24,0x1F,0xCF,
+    0xC8,0x7F,0x3F,0x9F,0x81,0x24,0xFC,0xA7,
+    0xF3,0xF0,0x25,0x1F,0x94,0xFC,0x35,
+
+    /* Access unit 13 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x83,0xC0,
+    0x05,0x7C,0x71,0x5E,0x00,0x1E,0x49,0xB9,
+    0x4A,0xFB,0x35,0xB1,0xA4,0x01,0xD0,0xA1,
+    0xAC,0x3B,0xA9,0x75,0x83,0x6C,0x3A,0x51,
+    0x91,0x3C,0x2C,0x98,0x91,0x6E,0x90,0xFB,
+    0xDB,0xEC,0x2E,0xD2,0x71,0xD3,0x30,0xE3,
+    0x1F,0x77,0xFC,0x02,0xDC,0x7F,0x3F,0x9F,
+    0xCF,0xE7,0xF8,0x02,0x81,0xE2,0x3C,0x47,
+    0x88,0xF1,0x1E,0x23,0xE0,0x0A,0x07,0x02,
+    0x29,0xFC,0xFE,0x7F,0x3F,0x02,0x69,0xFC,
+    0xFE,0x7E,0x04,0xE3,0xF9,0xF8,0x13,0xCF,
+    0xC0,0xA0,0x7E,0x1A,0x80,
+
+    /* Access unit 14 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0xA3,0xC0,
+    0x05,0x7C,0x71,0x5E,0x00,0x0F,0xF3,0x07,
+    0x0D,0x2B,0x0D,0x64,0xC7,0xFD,0xE5,0x82,
+    0x2E,0x71,0x3D,0x14,0x6E,0x8A,0xAC,0x50,
+    0xEA,0x2F,0x13,0xEA,0x07,0xC5,0x4A,0x21,
+    0x48,0x63,0xE1,0xFA,0x18,0x55,0x26,0xD7,
+    0xBD,0xAD,0xCF,0xCE,0xBF,0xFD,0xFF,0x00,
+    0xB9,0x9F,0xCF,0xE7,0xF3,0xF9,0xFE,0x00,
+    0x9E,0x78,0x8F,0x11,0xE2,0x3C,0x47,0x88,
+    0xF3,0x67,0xF0,0xFF,0x0F,0x70,0x00,0xA4,
+    0x79,0x13,0x32,0x17,0xF5,0x36,0x0C,0x08,
+    0xA7,0xF3,0xF9,0xFC,0xFC,0x43,0xF8,0x11,
+    0x4F,0xE7,0xF3,0xF0,0x27,0x1F,0xCF,0xC0,
+    0x9E,0x7E,0x05,0x03,0xF0,0xAC,
+
+    /* Access unit 15 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0xC3,0xC0,
+    0x05,0x7C,0x71,0x5E,0x00,0x18,0xC9,0x40,
+    0xD2,0x07,0x6A,0x11,0x26,0x7E,0xF0,0xC3,
+    0x2C,0xA3,0x2E,0xBF,0xCA,0x71,0xB5,0x9A,
+    0x1E,0x1C,0x89,0xFB,0x7A,0xA0,0x2B,0xA1,
+    0xA1,0x8D,0xBF,0x7D,0x32,0x76,0x8E,0x2F,
+    0xC1,0x46,0x7F,0x79,0xFF,0x00,0xBC,0x08,
+    0xF3,0xF9,0xFC,0xFE,0x7F,0x80,0x27,0x9E,
+    0x23,0xC4,0x78,0x8F,0x11,0xE2,0x38,0x11,
+    0x8F,0xE7,0xF3,0xF9,0xF9,0xCF,0xC0,0x8C,
+    0x7F,0x3F,0x9F,0x88,0x3F,0x02,0x31,0xFC,
+    0xFC,0x49,0xF8,0x11,0x8F,0xC5,0x1F,0x81,
+    0x18,0xFC,0x51,0xF9,0xA0,
+
+    /* Access unit 16 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0xE3,0xC0,
+    0x05,0x7C,0x71,0x5E,0x00,0x4C,0x96,0x43,
+    0xF5,0x73,0xEE,0xAF,0x80,0x31,0x43,0x97,
+    0xD7,0x2F,0xDD,0x36,0x87,0x49,0xEF,0x81,
+    0xC2,0x8D,0x6F,0xB7,0xD6,0x23,0x6D,0xE0,
+    0x17,0xD1,0x1E,0x7F,0x3F,0x9F,0xCF,0xF0,
+    0x05,0x03,0xC4,0x78,0x8F,0x11,0xE2,0x3C,
+    0x47,0x02,0x31,0xFC,0xFE,0x7F,0x3F,0x02,
+    0x69,0xFC,0xFE,0x7E,0x04,0xE3,0xF9,0xF8,
+    0x13,0xCF,0xC0,0xA0,0x7E,0x2E
+};
+
+/* 1280 x 720 H.264 test stream: colour bars with the frame number burned in (tools/fx3_uvc_h26x_frames.py).
+ * One GOP of 16 Annex B access units, IDR first; profile_idc 66, constraint flags 0xC0, level_idc 31.
+ * Constant QP 40.
+ * Access units of 60 to 3377 bytes, 4599 bytes in all. */
+const uint32_t glVidFrameLenH264_1280x720_QP40[16] = {
+    3377, 99, 71, 70, 70, 103, 80, 75,
+    78, 100, 84, 83, 79, 90, 80, 60
+};
+
+const uint8_t glUVCVidFramesH264_1280x720_QP40[] __attribute__ ((aligned (32))) =
+{
+    /* Access unit 1 (IDR) */
+    0x00,0x00,0x00,0x01,0x67,0x42,0xC0,0x1F,
+    0xDA,0x01,0x40,0x16,0xE8,0x40,0x00,0x00,
+    0x03,0x00,0x40,0x00,0x00,0x07,0xA3,0xC6,
+    0x0C,0xA8,0x00,0x00,0x00,0x01,0x68,0xCE,
+    0x03,0x92,0xC8,0x00,0x00,0x01,0x65,0x88,
+    0x84,0x3F,0x26,0x28,0x00,0x08,0x02,0x49,
+    0xC9,0xC9,0xC9,0xC9,0xC9,0xC9,0xC9,0xC9,
+    0xC9,0xFF,0xF0,0xFE,0x1A,0xCB,0xE9,0xCF,
+    0x10,0x00,0x08,0x00,0xB1,0xB8,0x1E,0x62,
+    0xB9,0x87,0x98,0xAE,0x7E,0x23,0x76,0x88,
+    0xEF,0x27,0x27,0x27,0x27,0x27,0x27,0x27,
+    0x27,0xFF,0x0F,0xF8,0x2C,0xC2,0x8D,0x38,
+    0x80,0x09,0xA2,0x01,0x2E,0x0F,0x07,0x08,
+    0x3C,0x1C,0x20,0xE8,0x50,0x83,0xA1,0x40,
+    0x46,0x5B,0xBC,0x47,0xE9,0x39,0x39,0x39,
+    0x39,0x39,0x39,0x39,0x39,0x38,0xCC,0x07,
+    0xA4,0x1A,0x60,0x80,0x10,0x0F,0x1A,0x60,
+    0xE8,0x26,0x30,0x74,0x13,0x17,0xBC,0x9C,
+    0x9C,0x9C,0x9C,0x9C,0x9C,0x9C,0x9C,0x9C,
+    0x9F,0xF8,0x7F,0xE0,0xB2,0x5F,0xE2,0x00,
+    0x01,0x30,0xD1,0x00,0x00,0xC8,0x13,0x07,
+    0x41,0xC2,0x0E,0x83,0x84,0x1D,0x01,0xC2,
+    0x0E,0x80,0xE0,0x23,0x7A,0x3B,0x27,0x27,
+    0x27,0x27,0x27,0x27,0x27,0x27,0x27,0x27,
+    0xE1,0xFF,0xF8,0x2B,0x97,0xF8,0x84,0x00,
+    0x04,0x02,0xE3,0x98,0x1E,0x42,0xB9,0x87,
+    0x90,0xAE,0x7E,0x23,0x17,0xF4,0x47,0x79,
+    0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x3F,
+    0xF0,0xFF,0xC1,0x64,0x28,0xD3,0xE2,0x00,
+    0x01,0xB0,0x34,0x40,0x00,0x2C,0x0F,0x83,
+    0x57,0x72,0x55,0x77,0x20,0xCA,0xB9,0x29,
+    0x57,0x04,0x62,0xB1,0xFE,0x23,0xBC,0x9C,
+    0x9C,0x9C,0x9C,0x9C,0x9C,0x9C,0x9C,0x9D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x4E,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0x9E,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xA7,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0x7A,0x7A,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0x99,0xD7,0xA4,0xEF,
+    0xBE,0xFB,0xEF,0xBE,0xFB,0xEF,0xA7,0x73,
+    0x3D,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xA7,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,
+    0xAE,0xBA,0x7A,0xEB,0xAE,0xBA,0xEB,0xAE,
+    0xBA,0xEB,0xAE,0x9E,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xE9,0xE9,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0x9E,0xBA,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xE9,0xE9,0xEB,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xA7,
+    0xAE,0xBA,0xEB,0xAE,0xBA,0xEB,0xAE,0xBA,
+    0x79,0xBB,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x3D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x4F,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xF5,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD3,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x4F,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x74,0xF5,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x3D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD3,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x4F,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x74,0xF3,0x77,0xAE,0xB9,0xBB,
+    0xD7,0x5C,0xDD,0xEB,0xAE,0x6E,0xF5,0xD3,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x3D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x74,0xF5,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x4F,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x3D,0x3D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x3D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x74,0xF5,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x4F,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD3,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x3D,0x3D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x3D,0x3D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,
+    0xF5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x4F,0x37,0x7A,0xEB,0x9B,0xBD,0x75,0xCD,
+    0xDE,0xBA,0xE6,0xEF,0x5D,0x3D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x3D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,
+    0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x4F,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x74,0xF5,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x3D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x3D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x4F,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,
+    0xF5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x3D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x4F,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xF3,0x77,
+    0xAE,0xB9,0xBB,0xD7,0x5C,0xDD,0xEB,0xAE,
+    0x6E,0xF5,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD3,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x3D,0x3D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xF5,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x4F,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x3D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x74,0xF5,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x4F,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x3D,
+    0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x3D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x74,0xF5,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x4F,0x37,0x7A,0xEB,0x9B,
+    0xBD,0x75,0xCD,0xDE,0xBA,0xE6,0xEF,0x5D,
+    0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD3,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x4F,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x74,0xF5,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x3D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD3,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x4F,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x74,0xF5,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x3D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x3D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x4F,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x74,0xF3,0x77,0xAE,0xB9,0xBB,0xD7,0x5C,
+    0xDD,0xEB,0xAE,0x6E,0xF5,0xD3,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x3D,0x3D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x3D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x74,0xF5,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x4F,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD3,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x3D,0x3D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x3D,0x3D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,
+    0xF5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x4F,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD3,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x3D,0x3D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xF5,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x4F,0x37,
+    0x7A,0xEB,0x9B,0xBD,0x75,0xCD,0xDE,0xBA,
+    0xE6,0xEF,0x5D,0x3D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x3D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x4F,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,
+    0xF5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x3D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x4F,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xF5,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x3D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,
+    0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x4F,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x74,0xF3,0x77,0xAE,0xB9,
+    0xBB,0xD7,0x5C,0xDD,0xEB,0xAE,0x6E,0xF5,
+    0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x3D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x74,0xF5,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x4F,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x3D,
+    0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x3D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x74,0xF5,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x4F,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD3,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x3D,0x3D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x3D,
+    0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x74,0xF5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x4F,0x37,0x7A,0xEB,0x9B,0xBD,0x75,
+    0xCD,0xDE,0xBA,0xE6,0xEF,0x5D,0x3D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD3,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x4F,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x74,0xF5,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x3D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x3D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD3,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x4F,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x74,0xF5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD3,0xD3,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x3D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD3,0xD3,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x4F,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xF3,
+    0x77,0xAE,0xB9,0xBB,0xD7,0x5C,0xDD,0xEB,
+    0xAE,0x6E,0xF5,0xD3,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x3D,0x3D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD3,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x3D,0x3D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x74,
+    0xF5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x4F,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD3,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x3D,0x3D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x74,0xF5,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x4F,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD3,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x3D,0x3D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD3,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x3D,0x3D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD6,0x03,0x80,0x01,0xA0,
+    0x38,0xA6,0x65,0x9F,0x7D,0xF7,0xDF,0x7D,
+    0xF7,0xDF,0x7F,0x0F,0xF1,0x0C,0x01,0x82,
+    0xA8,0x51,0xF6,0x70,0x23,0xAD,0xE7,0x9E,
+    0x01,0x33,0xD3,0x3A,0xD8,0xB5,0xB5,0xB5,
+    0xB5,0xB5,0xB5,0xB5,0xB5,0xB5,0xFE,0x1E,
+    0x3E,0x0C,0x15,0x40,0xE0,0xC6,0x28,0xE2,
+    0x00,0x4C,0x81,0x51,0x32,0x36,0xD3,0x02,
+    0xDD,0x9B,0x0B,0x57,0x4C,0xBF,0xC0,0x90,
+    0x4D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,
+    0x6D,0x6D,0x78,0x7F,0x88,0x60,0x10,0x55,
+    0x11,0x38,0x19,0xD0,0x3A,0x09,0x88,0x17,
+    0xE4,0xD2,0x2C,0x5B,0xC4,0x00,0x99,0x10,
+    0x09,0x93,0xAE,0x2B,0x5B,0x5B,0x5B,0x5B,
+    0x5B,0x5B,0x5B,0x5B,0x5F,0xF0,0xE3,0xC0,
+    0x18,0x2C,0xA6,0xF8,0x4E,0x90,0x42,0xC9,
+    0x62,0x8B,0x02,0xC3,0x11,0xB6,0x20,0x13,
+    0x20,0x58,0x61,0x1B,0x1D,0x55,0x1D,0xB5,
+    0xB5,0xB5,0xB5,0xB5,0xB5,0xB5,0xB5,0xB5,
+    0xB5,0xC3,0xFE,0x01,0x80,0x30,0x55,0x00,
+    0xC8,0x80,0x13,0xAC,0x10,0xA9,0xB5,0xC2,
+    0xD7,0x89,0x02,0x64,0x48,0x13,0x27,0x55,
+    0xF4,0xEB,0x7B,0x5B,0x5B,0x5B,0x5B,0x5B,
+    0x5B,0x5B,0x5F,0xC3,0xE3,0xC2,0xC1,0x77,
+    0xB8,0x43,0x16,0x11,0x23,0x3C,0x55,0x82,
+    0x64,0x53,0x4D,0x89,0x02,0x64,0x77,0x41,
+    0x4A,0xE3,0xC9,0xD7,0x1A,0x7F,0x22,0xDA,
+    0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x74,0xB5,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x4B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,
+    0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,
+    0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,
+    0x6B,0x4B,0x4B,0x4B,0x4B,0x4B,0x4B,0x4B,
+    0x4B,0x4B,0x4B,0x4B,0x4B,0x6B,0x2F,0x3F,
+    0xEB,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,
+    0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,0x5B,
+    0x5B,0x5B,0x5B,0x5A,0xEB,0xAE,0xB8,0xEC,
+    0x00,0xA8,0xE5,0x10,0x03,0x8A,0x19,0x76,
+    0xB0,0x01,0x83,0x7B,0x6B,0x41,0xFD,0xF3,
+    0x4F,0xE6,0x0E,0x0B,0xFA,0x52,0x35,0x47,
+    0xBF,0xAA,0x23,0x42,0xD5,0x10,0x88,0xB7,
+    0x23,0x19,0xB0,0x7F,0x8B,0x4F,0x6B,0x24,
+    0x7F,0x80,0xD5,0x69,0x24,0xD5,0xCD,0xFF,
+    0xFD,0xF8,0xD0,0xBB,0xE0,0x1D,0x7D,0x0A,
+    0x5F,0xAF,0x7E,0x02,0x9D,0x52,0x32,0xA5,
+    0xB7,0xF6,0x1A,0xFB,0xE3,0x27,0xFB,0xB4,
+    0x2B,0xBF,0x4B,0x35,0xEF,0x96,0x76,0x2D,
+    0x2C,0x96,0x7F,0x53,0xAE,0xD1,0x9D,0xEF,
+    0xBF,0xFF,0xA3,0x4A,0x8F,0x7D,0x3B,0xDB,
+    0x30,0x32,0xB7,0x27,0xF1,0xFF,0xDF,0xCE,
+    0xDA,0x17,0x7C,0x43,0xB9,0x0B,0x2D,0xC0,
+    0xE8,0x37,0x6D,0xCC,0x6A,0x6C,0x14,0xAF,
+    0x99,0x9D,0x7B,0x7F,0x07,0xE9,0xF2,0xA5,
+    0xCA,0x5D,0x90,0x30,0x2D,0xDE,0x99,0x4F,
+    0x9F,0xDB,0x74,0xF7,0xD7,0xED,0xFC,0x82,
+    0xDE,0x44,0xFC,0xFF,0xE9,0xF6,0xC2,0x1B,
+    0xE3,0x1A,0xAB,0x1B,0x5A,0x1C,0x5D,0x2D,
+    0x56,0x00,0x1E,0xFF,0x89,0xE5,0xD4,0xC0,
+    0xE2,0x9A,0xF3,0xAB,0xB4,0xBF,0x1A,0x9E,
+    0x5F,0x96,0x93,0x1F,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD2,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x72,
+    0x77,0xDF,0x7D,0xF7,0xDF,0x7D,0xF7,0xDF,
+    0x7D,0xF7,0xDF,0x7D,0xF7,0xDF,0x7D,0xF7,
+    0xDF,0x7D,0xF7,0xDF,0x7D,0xF7,0xDF,0x7D,
+    0xF7,0xDF,0x7D,0xF7,0xDF,0x7D,0xF7,0xDF,
+    0x7D,0xF7,0xDF,0x7D,0xF7,0xDF,0x7D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x7F,0x1F,
+    0xFF,0x87,0xB8,0x1C,0x80,0xC2,0x32,0xDF,
+    0x7D,0xF7,0xF8,0xF1,0xF8,0x78,0x7F,0x81,
+    0x02,0x37,0x64,0x37,0x3F,0x7D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,
+    0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,0x75,
+    0xD7,0x5D,0x75,0xD7,0x5D,0x75,0xD7,0x5D,
+    0x78,
+
+    /* Access unit 2 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0x23,0xC0,
+    0x05,0x7C,0x71,0x5C,0x04,0x38,0xC5,0x17,
+    0xF9,0xEF,0x08,0x2B,0x35,0xA6,0x48,0xC7,
+    0xFC,0x02,0x72,0x7F,0x3F,0x9F,0xCF,0xE6,
+    0xFF,0xF8,0x70,0xFF,0x80,0x8E,0xB7,0x47,
+    0xB0,0x20,0xF1,0x1E,0x23,0xC4,0x78,0x8F,
+    0x80,0x27,0x9C,0x08,0xC7,0xF3,0xF9,0xFC,
+    0xFE,0x7D,0x51,0xFC,0xFE,0x7E,0x04,0x83,
+    0xF9,0xFC,0xFE,0x7F,0x3F,0x47,0xF3,0xF0,
+    0x24,0x9F,0xCF,0xE7,0xF3,0xF9,0xFA,0x3F,
+    0x02,0x51,0xFC,0xFE,0x7F,0x3F,0x9F,0xA3,
+    0xF0,0x25,0x1F,0xCF,0xE7,0xF3,0xF9,0xFA,
+    0x3F,0x02,0x54,
+
+    /* Access unit 3 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0x43,0xC0,
+    0x05,0x7C,0x3D,0x42,0x3C,0x09,0x3F,0x6F,
+    0x3E,0x08,0xBC,0x3A,0xB3,0x8A,0xAB,0x5E,
+    0x7D,0xFB,0xFF,0x00,0x9E,0x9F,0xCF,0xE7,
+    0xF3,0xF9,0xFE,0x00,0x9E,0x78,0x8F,0x11,
+    0xE2,0x3C,0x47,0x88,0xF6,0x00,0xA2,0x7C,
+    0x08,0xA2,0x7C,0x47,0x88,0xF3,0xF0,0x26,
+    0x9F,0xCF,0xE7,0xE0,0x4E,0x3F,0x9F,0x81,
+    0x3C,0xFC,0x0A,0x07,0xE0,0x4C,0x80,
+
+    /* Access unit 4 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0x63,0xC0,
+    0x05,0x7C,0x17,0xFB,0xCA,0x10,0x15,0xC0,
+    0x1B,0x16,0xFD,0xAF,0x4F,0xF2,0x5D,0xB4,
+    0xAE,0xDC,0x7B,0xE0,0x14,0x23,0xF9,0xFC,
+    0xFE,0x7F,0x3F,0xC0,0x14,0x0F,0x11,0xE2,
+    0x3C,0x47,0x88,0xF1,0x1F,0x00,0x50,0x38,
+    0x11,0x4F,0xE7,0xF3,0xF9,0xF8,0x13,0x4F,
+    0xE7,0xF3,0xF0,0x27,0x1F,0xCF,0xC0,0x9E,
+    0x7E,0x05,0x03,0xF0,0x23,0xC0,
+
+    /* Access unit 5 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0x83,0xC0,
+    0x05,0x7C,0x3C,0x3D,0x19,0xE1,0xDA,0x66,
+    0x0B,0x9A,0x27,0x5D,0x48,0x6F,0xE1,0xDD,
+    0xBB,0x65,0xBB,0xFE,0x01,0x47,0x3F,0x9F,
+    0xCF,0xE7,0xF3,0xFC,0x01,0x3C,0xF1,0x1E,
+    0x23,0xC4,0x78,0x8F,0x11,0xF0,0x04,0xF3,
+    0x81,0x14,0xFE,0x7F,0x3F,0x9F,0x81,0x34,
+    0xFE,0x7F,0x3F,0x02,0x71,0xFC,0xFC,0x09,
+    0xE7,0xE0,0x50,0x3F,0x02,0x14,
+
+    /* Access unit 6 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0xA3,0xC0,
+    0x05,0x7C,0x71,0xDE,0x12,0xB7,0x59,0xA8,
+    0xCE,0x97,0x21,0x37,0xFB,0xE0,0x14,0xC3,
+    0xF9,0xFC,0xFE,0x7F,0x3F,0x9B,0xFF,0xE1,
+    0xC3,0xFE,0x07,0x83,0x33,0x28,0x8C,0xB9,
+    0x11,0xE2,0x3C,0x47,0x88,0xF8,0x02,0x79,
+    0xC0,0x8A,0x7F,0x3F,0x9F,0xCF,0xE7,0xF3,
+    0xF9,0xFC,0xFE,0x7F,0x3F,0x02,0x39,0xFC,
+    0xFE,0x7F,0x3F,0x9F,0xCF,0xE7,0xF3,0xF9,
+    0xF8,0x12,0x0F,0xE7,0xF3,0xF9,0xFC,0xFE,
+    0x7F,0x3F,0x9F,0x81,0x24,0xFE,0x7F,0x3F,
+    0x9F,0xCF,0xE7,0xF3,0xF0,0x25,0x1F,0xCF,
+    0xE7,0xF3,0xF9,0xFC,0xFC,0x1C,0x40,
+
+    /* Access unit 7 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0xC3,0xC0,
+    0x05,0x7C,0x17,0xDF,0x70,0x94,0x67,0x82,
+    0x5D,0xA6,0xB2,0x03,0x6C,0x53,0xE6,0xBF,
+    0x47,0xCA,0x7D,0xF0,0x0A,0x89,0xFC,0xFE,
+    0x7F,0x3F,0x9F,0xE0,0x0A,0x07,0x88,0xDE,
+    0x23,0xC4,0x78,0x8F,0x11,0xE6,0xC4,0x7E,
+    0x1F,0xC3,0xDE,0x04,0x09,0x99,0x21,0xB9,
+    0x81,0x14,0xFE,0x7F,0x3F,0x9F,0x88,0x7F,
+    0x02,0x29,0xFC,0xFE,0x7E,0x04,0xE3,0xF9,
+    0xF8,0x13,0xCF,0xC0,0xA0,0x7E,0x0E,0x20,
+
+    /* Access unit 8 */
+    0x00,0x00,0x00,0x01,0x41,0x9A,0xE3,0xC0,
+    0x05,0x7C,0x17,0xFF,0x1B,0x19,0xE0,0x89,
+    0xED,0x56,0x04,0x7D,0x3A,0x35,0xF1,0xF3,
+    0x21,0x5A,0xCE,0xD7,0x53,0x90,0xB5,0xBF,
+    0xE0,0x15,0x63,0xF8,0x8F,0x11,0xE2,0x3C,
+    0x47,0xC0,0x13,0xCF,0x11,0xE2,0x3C,0x47,
+    0x88,0xF1,0x1F,0x00,0x4F,0x38,0x11,0x4F,
+    0xE7,0xF3,0xF9,0xF8,0x13,0x4F,0xE7,0xF3,
+    0xF0,0x27,0x1F,0xCF,0xC0,0x9E,0x7E,0x05,
+    0x03,0xF0,0x67,
+
+    /* Access unit 9 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x03,0xC0,
+    0x05,0x7C,0x3D,0x46,0x79,0x63,0x80,0x4F,
+    0x5D,0xE0,0xFC,0xBF,0x98,0x69,0x51,0xF0,
+    0x0A,0xD8,0x8F,0x11,0xE2,0x3C,0x47,0x88,
+    0xF8,0x02,0x79,0xE2,0x3C,0x47,0x88,0xF1,
+    0x1E,0x23,0xCD,0x88,0x7F,0xFC,0x80,0x45,
+    0x3F,0x9F,0xCF,0xE7,0xE2,0x0F,0xC0,0x8A,
+    0x7F,0x3F,0x9F,0x89,0x3F,0x02,0x29,0xFC,
+    0xFC,0x51,0xF8,0x11,0x4F,0xC5,0x9F,0x81,
+    0x14,0xFC,0x59,0xF8,0x23,0x80,
+
+    /* Access unit 10 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x23,0xC0,
+    0x05,0x7C,0x54,0x67,0x84,0xC1,0x79,0x58,
+    0x35,0x47,0xF2,0xBF,0x08,0x96,0xE2,0x97,
+    0xA9,0x5F,0x4E,0x15,0x72,0x73,0xDB,0x0B,
+    0xFD,0x6B,0x29,0x7A,0xFF,0x84,0xF0,0x13,
+    0xEE,0x48,0x3A,0xB1,0x74,0xF4,0xDF,0x9F,
+    0x8B,0x5B,0xD3,0x7E,0x7F,0xC0,0x2B,0xE2,
+    0x3C,0x47,0x88,0xF1,0x1E,0x23,0xE0,0x0A,
+    0x07,0x88,0xF1,0x1E,0x23,0xC4,0x78,0x8F,
+    0x36,0x21,0xFF,0xF2,0x01,0x14,0xFE,0x7F,
+    0x3F,0x9F,0x88,0x7F,0x02,0x29,0xFC,0xFE,
+    0x7E,0x04,0xE3,0xF9,0xF8,0x13,0xCF,0xC0,
+    0xA0,0x7E,0x0A,0x60,
+
+    /* Access unit 11 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x43,0xC0,
+    0x05,0x7C,0x71,0x5E,0x02,0x6A,0xBD,0x6E,
+    0xCB,0x45,0x38,0xE5,0xEB,0xF3,0x7F,0x84,
+    0x3F,0x0F,0x71,0xF2,0x29,0x33,0x00,0xB2,
+    0x08,0xF1,0x1E,0x23,0xC4,0x78,0x8F,0x80,
+    0x27,0x9E,0x23,0xC4,0x78,0x8F,0x11,0xE2,
+    0x3C,0xD8,0x87,0x87,0xF8,0x4F,0x80,0x91,
+    0x69,0x71,0xEF,0xEB,0xE0,0x45,0x3F,0x9F,
+    0xCF,0xE7,0xE2,0x1F,0xC0,0x8A,0x7F,0x3F,
+    0x9F,0x81,0x38,0xFE,0x7E,0x04,0xF3,0xF0,
+    0x28,0x1F,0x82,0x48,
+
+    /* Access unit 12 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x63,0xC0,
+    0x05,0x7C,0x73,0x60,0x4D,0x6C,0x96,0xD7,
+    0xE6,0xFF,0x6B,0xFE,0x13,0xE0,0x20,0xBD,
+    0x4B,0xDF,0x9E,0xCB,0x77,0x27,0xBF,0xFE,
+    0x01,0x69,0x11,0xE7,0xF3,0xF9,0xFC,0xFF,
+    0x00,0x4F,0x3C,0x47,0x88,0xF1,0x1E,0x23,
+    0xC4,0x79,0xBF,0xC3,0xFC,0x3D,0xC0,0x81,
+    0x33,0x24,0x37,0x3F,0x02,0x29,0xFC,0xFE,
+    0x7F,0x3F,0x10,0xFE,0x04,0x53,0xF9,0xFC,
+    0xFC,0x09,0xC7,0xF3,0xF0,0x27,0x9F,0x81,
+    0x40,0xFC,0x3F,
+
+    /* Access unit 13 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0x83,0xC0,
+    0x05,0x7C,0x71,0x5E,0x0A,0x2C,0x5A,0xF8,
+    0x3D,0xE9,0xD2,0x7E,0x91,0x61,0x13,0xB7,
+    0x2F,0x3F,0x8F,0xF8,0x05,0xB8,0xFE,0x7F,
+    0x3F,0x9F,0xCF,0xF0,0x05,0x03,0xC4,0x78,
+    0x8F,0x11,0xE2,0x3C,0x47,0x9B,0xFC,0x3F,
+    0xC3,0xDC,0x08,0x13,0x32,0x43,0x73,0xF0,
+    0x22,0x9F,0xCF,0xE7,0xF3,0xF1,0x0F,0xE0,
+    0x45,0x3F,0x9F,0xCF,0xC0,0x9C,0x7F,0x3F,
+    0x02,0x79,0xF8,0x14,0x0F,0xC3,0x50,
+
+    /* Access unit 14 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0xA3,0xC0,
+    0x05,0x7C,0x71,0x5E,0x09,0x0B,0xD9,0x6A,
+    0x00,0xFB,0xB4,0xE7,0x8A,0xD1,0xFD,0xF9,
+    0xBF,0xC2,0xFF,0x84,0xF8,0x34,0x5C,0x4B,
+    0x59,0xB7,0xDE,0x80,0xD1,0x3F,0xFC,0x02,
+    0xE6,0x7F,0x3F,0x9F,0xCF,0xE7,0xF8,0x02,
+    0x79,0xE2,0x3C,0x47,0x88,0xF1,0x1E,0x23,
+    0xCD,0x9F,0xC3,0xFC,0x27,0xC1,0x0E,0xA7,
+    0x46,0xD5,0xF8,0x11,0x4F,0xE7,0xF3,0xF9,
+    0xF8,0x87,0xF0,0x22,0x9F,0xCF,0xE7,0xE0,
+    0x4E,0x3F,0x9F,0x81,0x3C,0xFC,0x0A,0x07,
+    0xE1,0x58,
+
+    /* Access unit 15 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0xC3,0xC0,
+    0x05,0x7C,0x71,0x5E,0x01,0x10,0xF5,0x94,
+    0x68,0x46,0x6F,0x48,0xEB,0x1F,0x97,0xC7,
+    0x78,0xAC,0x4F,0xA1,0xB0,0xCE,0x59,0x6F,
+    0xE0,0x17,0x83,0xF9,0xFC,0xFE,0x7F,0x3F,
+    0xC0,0x13,0xCF,0x11,0xE2,0x3C,0x47,0x88,
+    0xF1,0x1C,0x08,0xC7,0xF3,0xF9,0xFC,0xFC,
+    0xE2,0x38,0x11,0x8F,0xE7,0xF3,0xF1,0x07,
+    0xE0,0x46,0x3F,0x9F,0x89,0x3F,0x02,0x31,
+    0xF8,0xA3,0xF0,0x23,0x1F,0x8A,0x3F,0x34,
+
+    /* Access unit 16 */
+    0x00,0x00,0x00,0x01,0x41,0x9B,0xE3,0xC0,
+    0x05,0x7C,0x71,0x5E,0x1B,0xB7,0x34,0xF2,
+    0x7D,0xFD,0xF4,0x28,0xB3,0x78,0x05,0xF4,
+    0xFE,0x7F,0x3F,0x9F,0xCF,0xF0,0x05,0x03,
+    0xC4,0x78,0x8F,0x11,0xE2,0x3C,0x47,0x02,
+    0x31,0xFC,0xFE,0x7F,0x3F,0x02,0x69,0xFC,
+    0xFE,0x7E,0x04,0xE3,0xF9,0xF8,0x13,0xCF,
+    0xC0,0xA0,0x7E,0x2E
+};
+
+/* 640 x 480 H.265 test stream: colour bars with the frame number burned in (tools/fx3_uvc_h26x_frames.py).
+ * One GOP of 16 Annex B access units, IDR first; general_profile_idc 1, general_level_idc 93 (level 3.1).
+ * Access units of 222 to 887 bytes, 6263 bytes in all. */
+const uint32_t glVidFrameLenH265_640x480[16] = {
+    887, 222, 298, 603, 438, 338, 337, 377,
+    420, 325, 314, 274, 320, 282, 391, 437
+};
+
+const uint8_t glUVCVidFramesH265_640x480[] __attribute__ ((aligned (32))) =
+{
+    /* Access unit 1 (IDR) */
+    0x00,0x00,0x00,0x01,0x40,0x01,0x0C,0x01,
+    0xFF,0xFF,0x01,0x60,0x00,0x00,0x03,0x00,
+    0x90,0x00,0x00,0x03,0x00,0x00,0x03,0x00,
+    0x5D,0xBA,0x02,0x40,0x00,0x00,0x00,0x01,
+    0x42,0x01,0x01,0x01,0x60,0x00,0x00,0x03,
+    0x00,0x90,0x00,0x00,0x03,0x00,0x00,0x03,
+    0x00,0x5D,0xA0,0x05,0x02,0x01,0xE1,0x65,
+    0xBA,0x92,0x4C,0xAE,0x68,0x08,0x00,0x00,
+    0x03,0x00,0x08,0x00,0x00,0x03,0x00,0x78,
+    0x40,0x00,0x00,0x00,0x01,0x44,0x01,0xC1,
+    0x72,0xB4,0x62,0x40,0x00,0x00,0x01,0x28,
+    0x01,0xAF,0x34,0x40,0x95,0x90,0x78,0x34,
+    0x18,0x0C,0x5A,0x90,0x10,0xF4,0x91,0xB7,
+    0xA5,0xEC,0xAA,0xBD,0xA4,0x92,0xED,0x19,
+    0xC9,0xE1,0x67,0xFD,0x5B,0x89,0xD8,0x93,
+    0x19,0xE2,0x98,0xB0,0xB4,0x49,0xF0,0x5B,
+    0x58,0xB6,0x54,0x48,0xAC,0x4A,0xD7,0xDF,
+    0x20,0x37,0x95,0x6B,0x12,0x0A,0xED,0x3B,
+    0xE1,0x0C,0x37,0xB9,0x22,0x15,0x23,0xD7,
+    0x3A,0xB0,0x75,0xF2,0x53,0x9D,0x32,0x89,
+    0x54,0xB3,0xC9,0x9A,0x5D,0xC0,0x0D,0x0A,
+    0xEA,0x7C,0x4D,0xD4,0xDB,0xBE,0xA3,0xC5,
+    0x1E,0xD0,0xB0,0x78,0x86,0x93,0xDB,0x9D,
+    0x14,0x49,0x5A,0x11,0xE4,0x13,0x60,0x04,
+    0x12,0x6A,0x16,0xE4,0x00,0x00,0x03,0x02,
+    0xA1,0xA1,0x5A,0x76,0x2A,0xB5,0xF6,0x0C,
+    0xE5,0x69,0x02,0x4C,0x03,0x85,0xFE,0x01,
+    0xDC,0x03,0xC8,0x96,0xC5,0xDB,0x9F,0x0C,
+    0x11,0x20,0x55,0xA2,0x3C,0x0B,0xDA,0x80,
+    0x9B,0xF9,0x08,0x15,0x37,0xCF,0x02,0x69,
+    0xC6,0x3C,0x56,0x11,0x20,0xF2,0x95,0xAF,
+    0x23,0x82,0xC4,0x39,0x9E,0x08,0x02,0x91,
+    0xA1,0x57,0x7C,0xFE,0x68,0x9B,0xF8,0xE9,
+    0x31,0xDA,0x81,0xD5,0xC7,0x57,0xC3,0x93,
+    0xE7,0x39,0x38,0x03,0x85,0x71,0x6A,0x48,
+    0xB0,0x00,0x1D,0x67,0xBB,0xA7,0x18,0xF1,
+    0x80,0x00,0x4C,0x03,0x64,0x00,0x1F,0x20,
+    0x02,0xBC,0xD0,0x5A,0x01,0xC1,0x74,0x28,
+    0xF3,0x9B,0x68,0x00,0x62,0xAB,0x40,0xA2,
+    0x8C,0x35,0xBC,0x32,0x29,0x00,0x47,0xCC,
+    0x90,0x00,0x95,0x00,0x19,0x64,0xAC,0x75,
+    0x13,0xF0,0xC3,0xA5,0x91,0xD3,0x80,0x4F,
+    0x40,0x40,0x9D,0xC7,0x3C,0x55,0x8C,0xC0,
+    0x81,0x6C,0x00,0x02,0x60,0x00,0x7E,0x03,
+    0xC2,0x42,0x67,0xD5,0x4C,0x16,0xBF,0xE6,
+    0x02,0xC7,0xB6,0x93,0x97,0x46,0x2D,0x04,
+    0x04,0x3D,0x41,0x00,0x18,0x80,0x03,0x9F,
+    0xDE,0x32,0xE3,0x66,0xA4,0x66,0xF0,0x04,
+    0xA0,0x33,0x4D,0xB0,0x18,0x05,0x41,0xAD,
+    0x9D,0x06,0x0C,0x7F,0xEB,0x38,0x9E,0x04,
+    0x6C,0x80,0x07,0xB1,0x05,0x8F,0x62,0x81,
+    0x52,0x49,0x55,0xC4,0x4F,0x3A,0x19,0x25,
+    0xBE,0x73,0x79,0x51,0x01,0xD0,0xFB,0x5D,
+    0x42,0x56,0x1D,0xD7,0xF0,0x14,0xCA,0x2E,
+    0x24,0xA6,0x73,0x7B,0xB4,0x83,0xDE,0xE1,
+    0xA2,0x8C,0xDC,0x57,0xD1,0x27,0x6D,0xA1,
+    0xAE,0xB4,0x27,0x33,0x1A,0x5B,0xF0,0x76,
+    0x82,0xFF,0xB0,0x00,0x5A,0x85,0x40,0xFB,
+    0x22,0x27,0x6A,0xB2,0x81,0xD0,0xE7,0x79,
+    0x8A,0xDE,0x27,0x37,0x30,0x58,0x52,0x50,
+    0x99,0x81,0x4E,0x08,0x94,0x51,0x28,0x00,
+    0x95,0xCF,0x38,0x50,0xE7,0xA2,0x3B,0x1E,
+    0x96,0x0F,0xC8,0x29,0xA6,0x63,0x24,0xA6,
+    0x48,0xCB,0xDD,0x70,0x48,0xFD,0x03,0x2D,
+    0x6A,0xF1,0x9A,0x41,0x6E,0x5A,0x1D,0x95,
+    0x61,0x8A,0x9E,0x75,0x68,0xD2,0xC5,0x0E,
+    0xC9,0xEA,0xC4,0x4C,0xD1,0x8E,0x00,0x2F,
+    0x33,0x73,0x17,0x4E,0x19,0x83,0xC5,0x50,
+    0x8A,0x3D,0xD1,0x66,0x14,0x0C,0x0C,0xA0,
+    0x13,0xA7,0xD8,0x48,0xCD,0xD2,0xF0,0xE5,
+    0x04,0x34,0x0C,0x93,0x47,0xC9,0xE1,0xC9,
+    0x58,0x8B,0x4A,0x28,0x3B,0xF3,0xFB,0x41,
+    0x70,0x9A,0x8D,0x52,0x01,0x44,0x31,0xAB,
+    0x97,0xEE,0x32,0x4F,0x6D,0x92,0xB7,0xBD,
+    0x21,0xEE,0xA2,0x91,0x5F,0xBC,0xBA,0x49,
+    0xD9,0x46,0x59,0x3C,0xA1,0x33,0x22,0x4D,
+    0x46,0xB1,0x54,0x45,0x52,0xBF,0x5F,0xA0,
+    0x5E,0x25,0x76,0x69,0x23,0xC7,0x42,0xBD,
+    0xBE,0x0C,0x56,0x7F,0xD0,0x3B,0x6D,0xBD,
+    0xA2,0xD4,0x60,0xE1,0x56,0xE3,0x73,0x65,
+    0x92,0x0D,0xEC,0x55,0xB0,0xD9,0xB3,0xDE,
+    0xA5,0x3C,0x76,0x42,0xE5,0x74,0x79,0x36,
+    0xD3,0x05,0x1A,0x3B,0xBD,0xF3,0x74,0x08,
+    0xE0,0x01,0x00,0x34,0x00,0xEA,0x9D,0xEF,
+    0x89,0x0E,0xFC,0xA7,0xD0,0x78,0xDC,0x23,
+    0x85,0x77,0xB5,0x7A,0x62,0x10,0x57,0x40,
+    0x20,0x63,0x10,0x9B,0x48,0x00,0x95,0xC8,
+    0xD5,0x08,0xEB,0x82,0xC6,0xE4,0x7B,0x01,
+    0x83,0x25,0xF1,0x89,0x0F,0x03,0xFB,0x20,
+    0xA6,0x16,0x3C,0xE0,0x23,0x42,0x6E,0xE6,
+    0xE6,0xC7,0x86,0xA7,0x5B,0x2E,0xCD,0xFD,
+    0x50,0xE9,0xCA,0xD9,0x11,0x84,0x8E,0xAF,
+    0x03,0x2C,0x04,0xED,0x25,0x49,0xFF,0xA7,
+    0x6F,0xB4,0x97,0xDD,0x2C,0x09,0x68,0xC4,
+    0xB5,0x24,0x19,0x7D,0xE0,0x50,0xF1,0xBA,
+    0x2E,0x14,0x53,0xBF,0x3A,0x43,0x1B,0x95,
+    0x20,0xA4,0x90,0x9F,0x74,0x98,0xF9,0x5F,
+    0x0E,0x81,0x9D,0xA5,0xEA,0x8C,0x36,0x91,
+    0xFB,0x26,0xD5,0xB4,0x1D,0xF3,0xF1,0xE7,
+    0x6D,0xF9,0xF4,0x94,0xFB,0xED,0xF6,0x8A,
+    0xEF,0x08,0x44,0x87,0xCE,0x0B,0x3D,0xCB,
+    0x54,0xCF,0x97,0x7F,0xD5,0x50,0x48,0x0D,
+    0xD6,0x1F,0x1B,0x96,0x0B,0xF1,0xBA,0xEF,
+    0x2C,0x72,0xF3,0x8A,0x52,0x8F,0xE8,0x53,
+    0xDE,0x57,0x8C,0x08,0x53,0x7E,0x6F,0xFC,
+    0xB2,0xAF,0x9C,0xED,0xA2,0x6D,0xF4,0xB6,
+    0xAE,0x16,0xE8,0x45,0x02,0x52,0x45,0x0E,
+    0x14,0xE1,0xD6,0xD5,0xD8,0x95,0x50,0x01,
+    0xE0,0xD5,0xC1,0x9A,0x8E,0xDE,0xB0,0x00,
+    0x00,0x03,0x00,0x00,0x03,0x00,0x01,0x9F,
+    0x91,0x4A,0x00,0x00,0x03,0x01,0xB9,
+
+    /* Access unit 2 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x09,
+    0x7E,0x10,0xC6,0x48,0x83,0x89,0x20,0x24,
+    0x40,0x85,0xD5,0x20,0xFC,0xDA,0xA5,0x42,
+    0xE6,0x31,0xC0,0xFE,0x53,0x40,0xD8,0xB7,
+    0xC7,0xC5,0x5A,0x29,0xA4,0x7A,0xD5,0x78,
+    0x4A,0x76,0xEC,0x3A,0x9D,0x5F,0x7E,0xD1,
+    0x4E,0x0D,0xCD,0x56,0x7D,0xA5,0xA9,0xCC,
+    0x80,0x88,0xE4,0xD1,0xD0,0x97,0x71,0x36,
+    0xE3,0x88,0x05,0x1B,0x2B,0xD0,0x09,0xB2,
+    0xF7,0x90,0x20,0x41,0x29,0xAB,0xDE,0x48,
+    0xF1,0xBA,0xD4,0xFC,0x18,0x57,0x06,0x52,
+    0x39,0x2F,0xF3,0x90,0x3E,0x7C,0xF3,0x96,
+    0x43,0x7E,0x86,0xEC,0xBB,0x17,0x62,0x07,
+    0x0A,0x44,0x28,0x67,0x61,0x16,0x47,0xA0,
+    0x9B,0x5B,0x8A,0xB8,0x9A,0x2D,0x76,0x70,
+    0x2C,0xE0,0xD6,0x85,0x98,0xDE,0x23,0x97,
+    0xC0,0xFD,0x1B,0xC7,0xD9,0xFD,0x02,0xB3,
+    0x9A,0x94,0x22,0x87,0x8F,0xD9,0x60,0xDD,
+    0x03,0xE6,0xE0,0x09,0x5F,0xF6,0x48,0x62,
+    0x54,0xBB,0x46,0x8C,0xF9,0x65,0x08,0x12,
+    0x9B,0x3B,0xD5,0x1E,0xCA,0xE9,0x08,0x3D,
+    0xBF,0xE9,0xE0,0x93,0xAE,0xEC,0x10,0x3E,
+    0x4B,0x9F,0x85,0x38,0xDD,0x44,0x63,0x7B,
+    0x15,0x3E,0x9B,0x59,0x25,0xE4,0x35,0x8F,
+    0xB8,0x85,0x39,0x33,0xF3,0x81,0x3D,0x09,
+    0x66,0x10,0x8C,0xD2,0x00,0x02,0xE2,0x11,
+    0x74,0x88,0x99,0x02,0xA3,0x7C,0x2B,0x27,
+    0x70,0x63,0x32,0x20,0x09,0xF8,
+
+    /* Access unit 3 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x11,
+    0xFF,0x84,0x31,0x94,0x20,0xF2,0x06,0x89,
+    0x10,0x22,0xE3,0xB8,0xFB,0x2D,0xB0,0x7A,
+    0x45,0xAB,0x12,0x91,0x80,0x2A,0x4F,0xBE,
+    0xD0,0xC9,0x4C,0x80,0x0D,0xEE,0x06,0x11,
+    0x9A,0x14,0x2C,0xF1,0xF1,0xA4,0xD8,0xD7,
+    0x34,0x01,0xFF,0x57,0x28,0x58,0x75,0x22,
+    0xD7,0xFB,0x34,0x3F,0x4C,0x40,0x4E,0xD1,
+    0x69,0x56,0xE2,0x2F,0xAB,0xBE,0x9B,0xA8,
+    0xBE,0x1B,0x56,0x97,0x6F,0x90,0xDC,0xE3,
+    0xC9,0xC4,0xC6,0x34,0xDB,0x83,0x9E,0x7E,
+    0xA6,0x94,0x35,0xD9,0x80,0xD5,0x04,0x9B,
+    0x94,0x90,0xB2,0xFC,0xAA,0xB6,0xA8,0xE1,
+    0xED,0x2E,0x1C,0xCF,0x9E,0x97,0xC9,0x4E,
+    0x4A,0x3F,0x78,0xD7,0x08,0x88,0xFA,0x36,
+    0x1E,0x26,0xFD,0x57,0xA4,0x89,0x03,0xCF,
+    0x82,0x1C,0xA3,0x72,0x81,0xC5,0x48,0xCD,
+    0x6D,0x66,0x8E,0x74,0x79,0x90,0x8B,0x85,
+    0x7C,0x87,0xEE,0xC2,0x97,0x4B,0x23,0x81,
+    0x14,0xC1,0x0A,0x66,0xEC,0x1A,0xB8,0xC6,
+    0x78,0x67,0x32,0xFF,0xCB,0xA0,0xDF,0x78,
+    0xFD,0x28,0xAF,0x73,0xDB,0xFE,0x6A,0x78,
+    0x13,0x3A,0x45,0xBD,0x40,0x8D,0x05,0x2C,
+    0x89,0x3A,0x4E,0xDA,0x4C,0xB1,0x2C,0x76,
+    0xC9,0x67,0x37,0xB2,0x9B,0xAF,0x35,0xF2,
+    0xDF,0x1F,0x18,0x09,0xCA,0xD4,0x5E,0xD4,
+    0xB0,0x98,0x6D,0x75,0x66,0xFD,0xE2,0xA5,
+    0x89,0x54,0x6F,0x3B,0xB0,0xB4,0xC1,0x30,
+    0x84,0xE5,0xB7,0x50,0xC8,0x15,0x6F,0x0C,
+    0xE0,0xD2,0x44,0x39,0x5F,0x2C,0xD0,0x32,
+    0x36,0xE0,0x01,0x37,0x80,0x95,0x94,0x39,
+    0xEF,0xE5,0xF4,0xB4,0x21,0x27,0x3C,0xD1,
+    0xB1,0x3B,0x7D,0x39,0x0B,0xD6,0xC7,0xA5,
+    0x1B,0x37,0xF5,0xCF,0x10,0x64,0x37,0xB5,
+    0x70,0xE1,0x0F,0x75,0x38,0x5C,0xB3,0x9C,
+    0xC7,0x7F,0xA7,0xB5,0xD0,0x00,0x03,0x92,
+    0x3A,0xD8,0x68,0x9E,0xA0,0x31,0x15,0x80,
+    0x01,0x33,
+
+    /* Access unit 4 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x19,
+    0xFF,0x84,0x31,0x8D,0x08,0x10,0xA4,0x7E,
+    0x54,0x3A,0x39,0xF0,0x99,0xF9,0x3A,0xF5,
+    0x46,0x38,0xB9,0x4C,0xA9,0xD3,0xA1,0x51,
+    0xCA,0xAD,0x1E,0x92,0xB7,0x27,0xF4,0x2E,
+    0x75,0xF7,0x1F,0x20,0x0E,0x0C,0x1C,0xF4,
+    0x74,0xD0,0x99,0x10,0xF9,0xAE,0x9E,0x2B,
+    0xD4,0xAF,0xA3,0xA6,0x75,0x9C,0xB4,0xBA,
+    0x68,0xFF,0x4A,0x51,0xD5,0xCC,0xEE,0x43,
+    0x69,0x49,0x0E,0x61,0x32,0xA9,0xB7,0x51,
+    0x2D,0x95,0x45,0xF6,0x4B,0x9A,0x5E,0x4C,
+    0x76,0xC0,0x25,0xBD,0x5F,0xE4,0x42,0x3D,
+    0x9D,0xD8,0x7B,0x0E,0x7E,0x27,0x41,0xBA,
+    0xB1,0x0F,0xF7,0x9F,0xE4,0x8D,0xBE,0x2C,
+    0x60,0x2F,0x62,0x6A,0x8D,0x55,0x72,0xEC,
+    0x0A,0x52,0x16,0x09,0x17,0x83,0xBA,0x36,
+    0x31,0x5B,0x45,0x3D,0x61,0xEE,0x36,0xBA,
+    0x94,0xD7,0xCC,0x63,0x33,0xBB,0x8F,0xFA,
+    0xA6,0x94,0xBE,0xF3,0xED,0xC7,0x2A,0x88,
+    0xF7,0x37,0x3A,0x0B,0xD0,0xCA,0xBF,0x36,
+    0x16,0xB7,0x88,0xF6,0x14,0x89,0x0F,0xE0,
+    0xA4,0x69,0x31,0x80,0xF8,0xAE,0xF1,0xD6,
+    0x2B,0xF3,0x2E,0x84,0x18,0xC4,0x00,0x63,
+    0xC7,0xFF,0xCB,0x7D,0x9B,0xEA,0x62,0x4E,
+    0xBC,0x6A,0xD0,0x50,0xE3,0x1A,0x2B,0x4C,
+    0xD9,0x44,0xE2,0x10,0x78,0x02,0x56,0x73,
+    0x5C,0x02,0xF0,0x9F,0xF8,0x21,0xF5,0xF4,
+    0x0B,0x95,0x8E,0x13,0xA8,0x8E,0x3F,0xCD,
+    0x1A,0x55,0x9F,0x44,0x06,0x5F,0x04,0x76,
+    0x91,0x3B,0x56,0x88,0x00,0xCF,0x7F,0x0D,
+    0x2D,0x96,0xDA,0xBF,0x35,0x5C,0x9A,0x7F,
+    0x3A,0xCA,0x5F,0xF6,0xDE,0x59,0x73,0x3B,
+    0xA4,0x20,0x62,0xFF,0x90,0x56,0x5D,0xDC,
+    0x4A,0x51,0x95,0x3C,0x49,0xC0,0x3D,0x5A,
+    0xDE,0x4E,0xE6,0xF5,0xEB,0x2A,0xB4,0x85,
+    0xAD,0x04,0x2F,0x87,0xF1,0x08,0x07,0x2E,
+    0x8A,0x82,0xAA,0x73,0xB3,0xAB,0x84,0xD2,
+    0x17,0xF7,0x3F,0x89,0x3E,0x8E,0x7D,0xFB,
+    0xE0,0x39,0x7F,0x7C,0xC7,0x41,0x1F,0x3F,
+    0xCB,0x39,0x84,0xBD,0x0A,0xD3,0x9C,0x38,
+    0x8C,0xE9,0x04,0x28,0x43,0xAA,0xB6,0x9E,
+    0xC0,0x73,0x2F,0x5D,0x80,0xFC,0x37,0x59,
+    0xA2,0x3E,0xD0,0xEC,0x88,0xC9,0x66,0xA7,
+    0xD9,0xDF,0x4E,0x42,0x92,0xCE,0x15,0xA5,
+    0xE9,0x7F,0xFF,0xFF,0xFB,0xEC,0xED,0x29,
+    0xD0,0xEE,0xAC,0x8C,0x5F,0x93,0xA5,0x98,
+    0x10,0x5F,0x5B,0x48,0xCE,0xB3,0x6E,0xCE,
+    0xCE,0x49,0x78,0x3D,0xBC,0x93,0x8A,0xA3,
+    0xFF,0x3D,0xDA,0x28,0x99,0xB8,0x9D,0x3E,
+    0x04,0x77,0xD8,0x05,0x51,0xC1,0xA2,0x7D,
+    0x7F,0x8F,0xCF,0xFE,0xFB,0x90,0x79,0xB0,
+    0x39,0x43,0xEE,0x74,0xB6,0xD4,0xE4,0x07,
+    0xBE,0xEA,0xFA,0x65,0xE3,0x49,0xDC,0xE2,
+    0x2B,0xAE,0xA3,0x55,0xD9,0xF9,0x2B,0x4D,
+    0xE6,0xB1,0xEE,0xEE,0xA1,0x13,0xC7,0x6E,
+    0xBB,0xB1,0xE4,0xE9,0x9F,0x96,0xAE,0xAB,
+    0x92,0x93,0x2B,0xC3,0x06,0x0E,0x80,0x73,
+    0xCF,0x48,0x4B,0x9A,0x4C,0xB3,0xD8,0xC0,
+    0x23,0x23,0x35,0x08,0xEE,0xC0,0xC6,0x9E,
+    0xF0,0xBC,0x29,0x97,0x4B,0x6D,0x5C,0xC7,
+    0x50,0x81,0xE2,0x96,0x13,0xD6,0xBC,0x05,
+    0x7B,0x76,0x6B,0xA7,0x3C,0x93,0x3E,0x1C,
+    0x74,0x09,0xBA,0x10,0x49,0x60,0x7C,0xFD,
+    0xDB,0x1D,0xEE,0xBF,0x97,0xA9,0x0D,0xDF,
+    0xE4,0xD0,0x44,0x0A,0xE5,0x16,0xAA,0x28,
+    0x38,0x87,0xAA,0x22,0xD9,0x9A,0x7F,0x43,
+    0x94,0xE8,0x05,0x70,0x89,0x96,0x91,0xA1,
+    0xA8,0xEC,0x34,0x71,0x6B,0x1F,0xB5,0xF8,
+    0x96,0xC3,0x75,0x08,0x11,0x6E,0x4B,0x6F,
+    0xFE,0x30,0x02,0x97,0xFB,0x8A,0x0F,0xCC,
+    0x0E,0xEE,0x01,0x30,0xCA,0xB5,0xE4,0xC8,
+    0x38,0x66,0x2E,0x9F,0x5F,0x40,0x8C,0x06,
+    0xA6,0xE4,0x38,0x72,0xEC,0xB7,0x3F,0x93,
+    0xEF,0x89,0xB6,0x99,0x31,0x5B,0xF8,0x42,
+    0xFA,0x1B,0x54,0x80,0xBA,0xFB,0x4E,0x30,
+    0x40,0xE2,0x80,
+
+    /* Access unit 5 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x21,
+    0xFF,0x84,0x31,0x84,0x62,0x04,0x18,0x11,
+    0x0B,0x07,0x06,0xC6,0xC0,0xC0,0xF8,0x35,
+    0xCC,0xFB,0x4D,0x70,0xAE,0xF4,0xD7,0x66,
+    0xBA,0x90,0x0A,0x45,0xC1,0x93,0xED,0xFC,
+    0x34,0x62,0x51,0xD2,0x13,0x69,0x36,0xF0,
+    0xBA,0x45,0x61,0x2E,0x0A,0x15,0x88,0xBC,
+    0x37,0x9A,0xD5,0xED,0xD7,0x42,0x6B,0x34,
+    0x8C,0x24,0xDB,0x91,0x56,0xC6,0xD0,0xA3,
+    0xC0,0x25,0xD5,0xC4,0xB7,0xFA,0x44,0xC6,
+    0x3C,0xFC,0xD7,0xA9,0x98,0x3E,0x40,0x00,
+    0xF6,0xBC,0x8D,0xC6,0xD7,0x30,0xA3,0x92,
+    0x4C,0x8D,0x81,0xAA,0x24,0xDD,0x06,0x33,
+    0xCF,0x90,0x97,0x07,0x4F,0xDB,0x08,0x10,
+    0x0C,0x8C,0x72,0xF1,0x92,0xFA,0x2C,0xB7,
+    0x50,0xB0,0x6A,0x93,0x13,0x09,0x03,0xDC,
+    0x90,0x88,0x48,0x16,0x87,0x11,0x79,0x25,
+    0xBF,0x62,0x26,0x52,0xD0,0xDF,0x27,0x09,
+    0x04,0x06,0x8F,0xCE,0xDB,0xEE,0x48,0x19,
+    0xF2,0x37,0xA0,0x2B,0x4F,0xE1,0xA4,0xEC,
+    0x4A,0xD6,0x11,0x16,0x52,0x0F,0x3E,0xD8,
+    0x9E,0xE2,0xFA,0x24,0xD4,0x4E,0xCB,0xFE,
+    0xAD,0xFF,0xFF,0xF9,0x6B,0xD2,0x1C,0x4E,
+    0x5B,0xA2,0x84,0xA0,0xBB,0xDA,0x34,0x45,
+    0x26,0xFE,0xE6,0x60,0xDB,0x45,0x5C,0x1D,
+    0x8B,0xEF,0xC9,0xE2,0x15,0x26,0x83,0xE2,
+    0xDB,0x5E,0x3F,0xDA,0x89,0x06,0xCE,0xAC,
+    0xB7,0x86,0xC4,0xDA,0x95,0x46,0xEC,0x23,
+    0xFA,0x79,0x07,0x73,0x7B,0x6C,0x95,0x69,
+    0xBF,0x91,0xF8,0x92,0xAB,0xDA,0x99,0xF5,
+    0xDD,0xE2,0x22,0x00,0xF2,0x34,0x50,0x96,
+    0x1D,0xD6,0x65,0xCE,0x68,0xD8,0x5D,0x85,
+    0x06,0x53,0xA8,0x14,0x35,0xA8,0x7D,0x0E,
+    0x02,0x7C,0x3C,0xD4,0x58,0xE4,0x76,0xD0,
+    0xDB,0xBE,0x52,0xF3,0x26,0xB1,0x0C,0xA4,
+    0x5E,0x23,0x74,0xA5,0x3D,0xDB,0x80,0x6A,
+    0x39,0x7D,0x8E,0xA0,0x19,0x09,0xE5,0xA4,
+    0x48,0xBF,0x00,0xB5,0xBD,0x36,0x39,0x7A,
+    0x2A,0x23,0x81,0x56,0xC1,0x2F,0x8F,0x3B,
+    0xC5,0x7E,0xDE,0x79,0x53,0x9E,0x8F,0x88,
+    0xDA,0xDC,0x8F,0xF2,0x55,0x23,0x7F,0x85,
+    0x40,0x33,0x7F,0x60,0x30,0x25,0x99,0xB8,
+    0x15,0x35,0x13,0x3A,0x89,0xC7,0xE9,0xC6,
+    0xA7,0x72,0x3A,0xD2,0x4B,0x46,0xDD,0xC9,
+    0xD1,0xFA,0x9A,0xF8,0x91,0xD7,0x7F,0xAA,
+    0x09,0x90,0xCD,0x4A,0x1B,0xA4,0xF6,0x70,
+    0x77,0x3B,0x81,0xBD,0xAA,0xE4,0x5E,0x5A,
+    0x35,0x84,0x53,0xE1,0xFB,0x5B,0x7C,0x76,
+    0xDB,0xB0,0x90,0xCF,0x3A,0x51,0x56,0x5F,
+    0x63,0x8C,0x55,0x9B,0x08,0xAF,0xCF,0xDB,
+    0x5B,0x8C,0xAA,0xBF,0x58,0x5C,0xAA,0x44,
+    0x67,0x53,0xE8,0x8C,0x9F,0x2A,0xEC,0xBD,
+    0x82,0xDC,0xCA,0x8D,0xAD,0x3A,0xE5,0xFF,
+    0x8D,0x77,0x58,0xE0,0xC7,0x80,0xC0,0x80,
+    0x81,0x7F,0x8A,0x67,0x76,0xE0,
+
+    /* Access unit 6 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x29,
+    0xFF,0x84,0x31,0x84,0xC2,0x04,0x10,0x8F,
+    0x08,0x86,0x04,0x55,0x11,0x40,0xF6,0x84,
+    0xC1,0x03,0x4B,0x24,0xF7,0x76,0xD7,0xDA,
+    0xC2,0x62,0xE2,0xD0,0xAE,0x2D,0xD3,0xA8,
+    0xD6,0xD8,0x7E,0xBE,0xA2,0x26,0x00,0x09,
+    0x30,0x4D,0x0E,0xA1,0x32,0xDA,0x54,0x40,
+    0xA3,0xA3,0x3A,0xB5,0xB4,0xA2,0x02,0xF3,
+    0x3E,0xA0,0xDA,0xA3,0x43,0x62,0x46,0x1B,
+    0xF8,0x1F,0xCC,0x7A,0x1B,0x87,0x19,0x2D,
+    0xCD,0xAC,0xE6,0x3E,0x03,0x98,0xC0,0x96,
+    0x56,0x83,0x68,0x9D,0xAC,0x96,0x67,0xA4,
+    0xD3,0x09,0x44,0x8D,0x73,0xFB,0x39,0x3D,
+    0x35,0x87,0xFF,0x81,0x82,0xBD,0xE5,0xC9,
+    0x31,0xC2,0x58,0xF1,0x36,0x99,0x03,0xEA,
+    0x74,0x73,0xFE,0xF2,0x58,0xED,0x54,0xBE,
+    0xE7,0xDB,0xA2,0x40,0x4D,0xBB,0xE6,0x2C,
+    0x44,0xD4,0x60,0xE3,0x5F,0xC4,0x9E,0xB9,
+    0x79,0x69,0x30,0xB0,0x30,0x35,0x67,0x20,
+    0x04,0x81,0xE7,0xBE,0x9A,0x8B,0x66,0x50,
+    0xBA,0x16,0xD5,0x9E,0x8E,0x0B,0x85,0x71,
+    0x25,0xF7,0xFF,0xED,0xFF,0xD1,0x45,0x75,
+    0xCD,0x04,0x87,0xD4,0x3B,0xA4,0x72,0x35,
+    0xDD,0xD7,0xC8,0x9C,0xDA,0x99,0x80,0x92,
+    0xCF,0x1B,0x0E,0xF0,0x95,0x25,0x8E,0x7D,
+    0xFB,0x8A,0x76,0x92,0x62,0xBC,0x2B,0xF2,
+    0x84,0xAB,0x68,0xF2,0x56,0xAE,0x18,0xA0,
+    0xAD,0x6A,0xD8,0xFC,0xA7,0x75,0xB6,0x7E,
+    0x22,0x9A,0x2D,0x1D,0xE2,0x44,0x1D,0x60,
+    0x00,0x9D,0xF6,0x62,0x75,0x77,0x99,0xB8,
+    0x08,0xDF,0x18,0x24,0xA8,0x03,0xEF,0x85,
+    0x16,0xAE,0x18,0xEE,0xD4,0xFA,0x68,0xBA,
+    0x40,0xF5,0x76,0x2D,0x8E,0xEE,0xCC,0x2D,
+    0xEB,0xCC,0x64,0xD3,0x29,0x43,0xA1,0x97,
+    0xBA,0x6E,0x01,0x0E,0x71,0x0F,0xFB,0x8E,
+    0x0C,0xA5,0x37,0xCD,0x2A,0x39,0x9C,0x1C,
+    0x2E,0x24,0x48,0x2E,0x34,0xB2,0xCE,0xEC,
+    0xAF,0x40,0x2A,0x4B,0xFA,0xDD,0xC1,0x4B,
+    0x57,0xF9,0x8F,0xE9,0xFD,0x8F,0xFD,0x85,
+    0xA5,0xD7,0x1F,0x25,0x0E,0xD1,0xCC,0x9C,
+    0xA4,0xBC,0xD1,0x62,0x33,0x6C,0x3C,0x08,
+    0x07,0xF2,0x00,0x59,0xC0,0xB6,0xF5,0xE0,
+    0x03,0xFC,
+
+    /* Access unit 7 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x31,
+    0xFF,0x84,0x31,0x85,0x62,0x0E,0x60,0xBA,
+    0x53,0xA4,0xB8,0xBC,0x80,0xF6,0x33,0xF1,
+    0x48,0x0E,0x17,0x7D,0xD1,0x2A,0x4D,0x23,
+    0x3B,0x2B,0xFF,0x09,0x91,0x8D,0x3B,0x63,
+    0xB1,0x1A,0x7C,0x7E,0xB5,0xB0,0xA3,0xAC,
+    0x7E,0xDA,0xC4,0xE1,0x89,0x02,0x90,0x6C,
+    0x93,0x24,0xE5,0x19,0xA7,0x9A,0xED,0x23,
+    0x84,0xF0,0xA6,0x6B,0x12,0xB0,0x96,0xD5,
+    0xEF,0xB5,0x14,0x03,0x72,0xBB,0x91,0x5B,
+    0xEF,0xB5,0xA4,0x68,0x8D,0x7B,0xEB,0x59,
+    0x61,0xE4,0xC6,0x1D,0xB8,0xE9,0xF7,0x27,
+    0x1D,0xF6,0x6A,0x8E,0xF4,0xFB,0x4B,0x14,
+    0x47,0x4A,0x4D,0x84,0x88,0x2D,0xA8,0x80,
+    0xBB,0x1E,0x58,0xCF,0xA2,0x01,0x6F,0x14,
+    0xC6,0xFD,0xC3,0x5D,0x1D,0x63,0xCE,0x53,
+    0x44,0x20,0x29,0x6C,0x5C,0xBA,0x56,0x87,
+    0x0F,0x68,0x04,0x44,0x5E,0x5E,0x56,0x09,
+    0x85,0x5F,0x7F,0x3B,0x26,0xF8,0xEE,0x03,
+    0x6B,0xF5,0x57,0xC5,0x90,0xAC,0x1B,0x5C,
+    0xBB,0x97,0xE0,0x2C,0xB5,0x78,0xE4,0x95,
+    0xC5,0x4C,0x73,0xEE,0x5F,0x31,0x4C,0x18,
+    0xAA,0x9E,0xD7,0xCA,0x9F,0x30,0x4C,0xB9,
+    0x2E,0x6F,0xBA,0x12,0x01,0xAE,0xCF,0xF5,
+    0xA3,0x47,0x0F,0xDF,0x90,0xFE,0x77,0xF1,
+    0xAB,0x44,0x65,0x66,0x9E,0x05,0x34,0x9F,
+    0xE3,0xFF,0xF1,0x7A,0xC5,0x3D,0x5A,0x82,
+    0x8E,0xE7,0xE0,0x06,0x11,0xB9,0xDD,0x2C,
+    0xED,0x90,0x04,0xDF,0xDD,0x5E,0x8A,0x18,
+    0x9E,0x18,0xBF,0x00,0x5B,0x2F,0xFF,0xC0,
+    0xAD,0x6A,0xE1,0xEB,0x0A,0x37,0x4D,0xB8,
+    0xAB,0xB3,0xED,0xF1,0x8F,0x68,0x94,0xA4,
+    0x21,0x32,0x00,0x1C,0x7C,0xE2,0x37,0xC7,
+    0x3D,0x2F,0x6E,0xBB,0x2A,0x89,0x80,0x9B,
+    0xA2,0xA4,0x02,0x32,0x94,0xAC,0x32,0x3B,
+    0x60,0x12,0xFF,0x90,0x79,0xB6,0x32,0xC9,
+    0x6A,0x9C,0xFC,0x04,0xDE,0xB3,0x79,0xE7,
+    0x3E,0xF5,0x0B,0x77,0xF1,0xA1,0x22,0xA1,
+    0xFB,0xC2,0x69,0x68,0x7E,0x19,0xAE,0x26,
+    0xB9,0xD2,0x70,0xD8,0x2A,0xFD,0xE5,0xB8,
+    0x1F,0x4D,0xA7,0xFF,0x28,0x3E,0x48,0xAA,
+    0xB9,0x72,0x39,0x80,0x36,0x1E,0x54,0x62,
+    0x42,
+
+    /* Access unit 8 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x39,
+    0xFF,0x84,0x31,0x85,0xC2,0x04,0x14,0x14,
+    0x0D,0x85,0x04,0x42,0x23,0xC0,0xF4,0x61,
+    0x06,0x42,0x49,0x03,0x59,0x58,0x0B,0x37,
+    0xE5,0x6B,0x20,0x78,0x0A,0x3A,0x73,0x00,
+    0x81,0xC9,0x56,0x30,0xA3,0x1A,0xA8,0x99,
+    0x9C,0x00,0x25,0xA2,0xD6,0x6B,0x1F,0x52,
+    0xEB,0x8C,0xE2,0x57,0x5F,0x1C,0xC8,0xB0,
+    0x8F,0x67,0x9E,0x9E,0x8F,0x43,0xFF,0x03,
+    0x53,0xFE,0x2C,0xA6,0xA4,0x28,0x05,0xA0,
+    0x01,0x35,0xA4,0x12,0x19,0x97,0xDA,0xC2,
+    0xA1,0xAD,0xF0,0xEA,0xF9,0xA7,0x39,0xF0,
+    0x9A,0x37,0xEF,0x85,0x0C,0x92,0x6D,0xE4,
+    0xA4,0x2E,0xBD,0xB4,0xD3,0x2D,0x7B,0xD3,
+    0x6E,0x81,0xB4,0xCD,0xB0,0xA1,0x7C,0x87,
+    0xA8,0xFF,0x22,0x70,0x18,0x73,0x77,0xA8,
+    0xA3,0x78,0x05,0x60,0xA1,0x39,0xB0,0x47,
+    0x24,0xFB,0x2E,0xAB,0xA7,0x5B,0xC0,0x9A,
+    0x40,0x96,0x12,0xE7,0x74,0x7A,0x8A,0x50,
+    0x7D,0xEA,0x4A,0x97,0xB1,0x15,0x7B,0x95,
+    0xFF,0xFF,0xBF,0xD0,0xD7,0xB6,0xD8,0x49,
+    0x64,0xA6,0x85,0x7F,0x21,0x2E,0xD1,0x4F,
+    0x5B,0x97,0xE5,0xEA,0xA0,0xD1,0xB5,0x14,
+    0x30,0x80,0xE6,0x1D,0x0A,0xA9,0x4A,0xFE,
+    0xEC,0xBC,0x94,0x72,0x9E,0xC4,0xAC,0x92,
+    0x7E,0x8B,0x7E,0x66,0x75,0x03,0xC7,0x32,
+    0xCC,0x3E,0xE4,0x53,0x34,0x87,0x68,0x2F,
+    0x43,0xC4,0x9F,0xC5,0xA7,0x75,0xE6,0x20,
+    0x23,0x61,0x8D,0x2E,0x51,0x67,0xDD,0xAA,
+    0xEE,0xDA,0x25,0xEF,0x17,0x09,0x99,0x8F,
+    0x8F,0x3F,0x3A,0xB9,0xE9,0xF2,0xF4,0xC9,
+    0x5E,0x6C,0x68,0x95,0x8D,0xB9,0x1D,0x69,
+    0x88,0xED,0x7A,0x87,0x22,0x68,0x02,0xA7,
+    0x34,0x6B,0xD7,0x13,0xC6,0x56,0xD6,0x1E,
+    0x3C,0xA9,0x9F,0xA9,0x4F,0xAD,0xA9,0x7B,
+    0x7F,0xBD,0x46,0xE3,0xFE,0xAF,0x3C,0x65,
+    0xF6,0xBE,0x50,0x81,0x20,0xC5,0xC9,0x80,
+    0x8B,0x2E,0xD8,0x3C,0xF2,0x0A,0xAA,0xB1,
+    0x81,0xE2,0x64,0xEB,0x11,0xD2,0x46,0xF2,
+    0x9B,0x1A,0xAD,0xB7,0x2F,0x58,0x31,0x75,
+    0x37,0x91,0xC1,0x63,0x09,0xDC,0xB1,0x28,
+    0x51,0x19,0xBC,0x50,0xD2,0x74,0xC3,0x23,
+    0x94,0xB3,0xCB,0x23,0x23,0xDC,0x78,0xC2,
+    0x0B,0xC4,0xF6,0xF1,0xE1,0x3D,0x96,0x6F,
+    0xD7,0xDC,0x00,0x96,0x80,0x38,0x94,0xBE,
+    0xEE,0xF2,0xCF,0xA6,0x03,0x76,0x88,0x6B,
+    0x92,0xA2,0xC1,0xC9,0xFD,0x24,0xB8,0x41,
+    0xC0,
+
+    /* Access unit 9 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x41,
+    0xFF,0x84,0x31,0x86,0x42,0x0E,0xA5,0x53,
+    0x17,0x0D,0x6F,0xB2,0x80,0xB8,0x33,0x11,
+    0x1F,0x17,0x79,0xE0,0xD8,0x9F,0x51,0x5A,
+    0x3D,0x89,0x46,0xD6,0x23,0xD5,0x05,0xDF,
+    0xBB,0x36,0x06,0xB2,0x64,0xDF,0x20,0x92,
+    0xAE,0xBD,0x2F,0x74,0x6A,0x61,0x13,0x37,
+    0x03,0xBC,0xE6,0xBF,0x62,0x23,0xFC,0xA3,
+    0x77,0xB1,0x39,0x12,0xB0,0x9F,0x51,0x5A,
+    0x3D,0x8A,0x10,0x24,0xE3,0xDE,0x0B,0xBF,
+    0x2F,0xF3,0xC0,0x99,0xCD,0x6C,0x02,0x2C,
+    0x94,0x57,0x3D,0x87,0x94,0x9F,0xDA,0xFA,
+    0x8B,0x78,0xC2,0x42,0xEF,0x8A,0x86,0xB5,
+    0x18,0x70,0x96,0x35,0x98,0xC5,0xB8,0xA2,
+    0x7B,0x71,0x2C,0x81,0x4E,0x54,0x5D,0xB2,
+    0xB5,0x9B,0x49,0x62,0xDD,0x12,0x2D,0xB6,
+    0x4F,0x02,0xCA,0xD8,0x19,0xF7,0x34,0x3F,
+    0xC5,0x6A,0x55,0x1A,0x27,0xE0,0xD6,0x12,
+    0xFA,0xA5,0xF5,0x63,0x22,0xB0,0x18,0x62,
+    0x6C,0x21,0x34,0xC0,0x88,0x44,0xBC,0x02,
+    0x28,0x34,0x2B,0xC6,0x19,0x4E,0x54,0x5E,
+    0x8F,0x6B,0x36,0x92,0xD2,0xEA,0x24,0x5B,
+    0x8A,0x2D,0xAE,0x55,0xB0,0xF3,0xEE,0x72,
+    0xAD,0x54,0x78,0xAA,0x1E,0x49,0x6B,0x44,
+    0xDB,0x5A,0x37,0x29,0xF4,0xB1,0x68,0x33,
+    0x9D,0x6C,0xA6,0xE6,0x3E,0x21,0xEE,0xC2,
+    0xFE,0x2D,0x45,0x2F,0xA0,0x03,0xB7,0x04,
+    0x62,0x89,0xED,0xC5,0x07,0xBB,0xB6,0x66,
+    0xF9,0x46,0xE1,0x91,0x76,0xB2,0x62,0x21,
+    0xBA,0x92,0x7A,0xE7,0xDB,0x27,0x3E,0xE7,
+    0x42,0xD5,0x48,0x0A,0xA2,0x0C,0xD6,0xB4,
+    0x4D,0xB5,0xC3,0x72,0x9F,0x4B,0x45,0x03,
+    0x65,0x3B,0xAC,0x85,0x1B,0xE0,0xDF,0xBC,
+    0x87,0x63,0xDA,0xE0,0xD2,0xB5,0xFB,0xA4,
+    0xA1,0xF1,0xC3,0xF5,0xFD,0x7E,0xE9,0xFF,
+    0xE9,0x59,0xC5,0x63,0xCF,0x22,0xAB,0xEE,
+    0x1E,0x84,0xF9,0x03,0x55,0x80,0x25,0x78,
+    0xA7,0x0F,0x92,0x9D,0xED,0x39,0x39,0x46,
+    0x60,0x14,0xDB,0x77,0x99,0xAA,0xF4,0x84,
+    0xC1,0x76,0xB2,0xCE,0xE0,0x27,0xED,0xED,
+    0x68,0x5E,0xAE,0x13,0x73,0xCA,0x32,0xE8,
+    0xFC,0x0C,0x70,0xCD,0x30,0xC8,0x30,0xC9,
+    0x56,0x74,0xD4,0xD4,0x37,0x19,0xD6,0xE2,
+    0xA6,0x08,0xFF,0x2F,0x05,0x81,0xF5,0x73,
+    0x90,0xEA,0x53,0x7D,0x4B,0x68,0xA9,0x7A,
+    0xF9,0x43,0xBA,0xEA,0x3C,0x7D,0x2A,0x83,
+    0x2E,0x30,0xB5,0x8C,0x6B,0x6B,0xFE,0x6C,
+    0xA9,0xD1,0x35,0x5B,0x3D,0xA0,0xCE,0x9E,
+    0xC8,0xFB,0x95,0xC3,0x15,0xA3,0xC1,0x85,
+    0x1C,0x39,0xA4,0xBD,0xBE,0x3B,0xCA,0x6D,
+    0x9E,0xDB,0x74,0xCA,0x66,0x4B,0x73,0x43,
+    0x77,0x84,0xA4,0x4E,0xE9,0x80,0xBB,0xD3,
+    0x73,0xE7,0x01,0xD9,
+
+    /* Access unit 10 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x49,
+    0xFF,0x84,0x31,0x86,0x62,0x04,0x06,0x04,
+    0x03,0x87,0x89,0x42,0xB1,0x40,0xB8,0x33,
+    0x11,0x1F,0x16,0xE1,0x7D,0xD3,0x33,0xA4,
+    0x19,0x6C,0xCE,0xA3,0x78,0x08,0x64,0x2B,
+    0xDB,0x6B,0x89,0x58,0xCE,0xFC,0x39,0xDA,
+    0x95,0x57,0x7D,0x40,0xCA,0x80,0x29,0x1C,
+    0xCD,0x0F,0xEB,0xFC,0xAA,0xBD,0xB5,0xEC,
+    0x55,0x86,0x4E,0x04,0x54,0x80,0xC7,0xA2,
+    0xC3,0x9A,0x5E,0xB2,0x3F,0x76,0xD7,0x32,
+    0x3B,0x08,0x95,0xDE,0x14,0x5E,0xDC,0x6F,
+    0xB3,0x9B,0x30,0x8A,0xB5,0x60,0x21,0x6F,
+    0xFF,0xFB,0xFF,0x5F,0x4D,0xAA,0xBF,0xA8,
+    0x2C,0xFB,0x13,0x85,0x3D,0x41,0x45,0xC1,
+    0x6B,0x97,0xB5,0xAF,0x43,0x14,0x13,0xD4,
+    0x8B,0x6C,0xF2,0xB1,0xEB,0x7C,0xC7,0xF6,
+    0x02,0x46,0xF9,0x79,0xD4,0xE8,0x93,0xA0,
+    0x81,0xC9,0x7B,0xFF,0x3D,0x22,0x57,0x0F,
+    0xA8,0x22,0xD8,0x18,0x28,0x25,0xB5,0x30,
+    0x99,0x83,0x18,0xAE,0x09,0x12,0x82,0x03,
+    0x8E,0x7B,0xCB,0x09,0x19,0x05,0xAC,0x7A,
+    0x5E,0x54,0x60,0x47,0xAD,0x71,0x21,0x85,
+    0xD6,0x24,0x4C,0xFF,0xAA,0x49,0xDA,0x75,
+    0x6D,0xA4,0x21,0xF6,0x5E,0x50,0xF0,0x78,
+    0x94,0xE9,0x28,0x2F,0xA3,0xDB,0x9A,0x2F,
+    0xA5,0xCC,0x09,0xF9,0xFF,0x0E,0x72,0xA6,
+    0x59,0x86,0x9B,0xA5,0xEF,0x9E,0x23,0x40,
+    0x5B,0x92,0xFA,0xDC,0x80,0xE1,0x3C,0x74,
+    0xAC,0xDD,0x98,0x3E,0x04,0xBF,0xFE,0x15,
+    0x5A,0xD6,0x56,0xB1,0x79,0xA9,0x6E,0x45,
+    0xD8,0xAD,0xF8,0x8B,0x1C,0x3E,0x58,0xE3,
+    0xE2,0x9B,0x23,0x34,0xE5,0x6C,0x4A,0x98,
+    0xE8,0xF0,0xC8,0x00,0x43,0x9C,0x64,0xE9,
+    0x21,0x41,0x0E,0xAF,0x25,0x91,0x11,0x1B,
+    0x2C,0x73,0x9D,0x90,0xBD,0x83,0xD8,0xBD,
+    0x81,0x09,0x12,0x79,0x47,0xA3,0xEB,0xCD,
+    0x58,0x52,0xC1,0xE0,0x50,0xBE,0xCF,0x5A,
+    0xD9,0x86,0xF4,0x2D,0x32,0x96,0x77,0x78,
+    0x9A,0x4E,0x7F,0xE2,0x2F,0xBC,0x70,0x46,
+    0xD2,0xAC,0x1A,0x7F,0xB9,0x70,0x09,0x28,
+    0x01,0x59,0x28,0x7C,0xC0,
+
+    /* Access unit 11 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x51,
+    0xFF,0x84,0x31,0x86,0xC2,0x04,0x0A,0x85,
+    0x03,0x83,0x03,0x4F,0xA3,0xC0,0xB5,0xB9,
+    0x83,0xC3,0xB1,0x93,0x75,0x76,0x12,0x80,
+    0x1B,0x57,0x6F,0xC8,0xD2,0xE2,0x2A,0x16,
+    0xE7,0xB3,0xDD,0xC0,0xB0,0xD7,0x34,0xCE,
+    0x55,0xE1,0x21,0x91,0xF9,0x09,0x89,0xCE,
+    0x9F,0x3B,0x91,0x89,0xA2,0x7E,0xC0,0xCD,
+    0x38,0x18,0x23,0x53,0x87,0xF4,0x4D,0x14,
+    0x86,0x9E,0x13,0x48,0xC0,0x69,0x5B,0xFA,
+    0x6E,0xBD,0xF9,0xFC,0x91,0xD0,0xBC,0x0D,
+    0xDB,0x40,0x7E,0x79,0x01,0x8B,0x26,0x9B,
+    0x00,0x41,0xA5,0xD4,0x51,0x00,0x99,0xE7,
+    0x61,0x56,0x7B,0x17,0xDA,0x93,0x9B,0x1C,
+    0x74,0x79,0x8A,0xF8,0x49,0x99,0xFD,0x75,
+    0x59,0x3A,0x6B,0xAA,0xE5,0x10,0xFC,0x85,
+    0x5F,0xE0,0x7F,0x5C,0x30,0x16,0x5D,0x84,
+    0xE2,0xE4,0x71,0x48,0x84,0xD5,0xBD,0xD9,
+    0x4E,0xCC,0x79,0x96,0x9F,0x91,0x8B,0x88,
+    0x39,0x9B,0xCD,0x47,0x88,0x0F,0xC2,0x80,
+    0x52,0xAA,0x25,0x6B,0xA3,0x78,0x8C,0x87,
+    0x25,0xA5,0x7E,0xB0,0xF8,0x86,0xB3,0x49,
+    0xAB,0x51,0x01,0xEB,0xB3,0xE2,0x4E,0xD9,
+    0x2D,0xA2,0xD3,0x0F,0xB8,0x51,0x46,0xD8,
+    0x71,0xFD,0xA7,0x3D,0xBC,0x57,0x61,0x53,
+    0x3B,0xF1,0x43,0xC2,0x10,0xC5,0x24,0x09,
+    0x05,0x7F,0x30,0x58,0x57,0xD3,0xFB,0xCA,
+    0xF6,0xA7,0x53,0x7D,0x76,0x37,0xFA,0x3D,
+    0x27,0x21,0x0F,0x24,0xFD,0x1B,0x7A,0x79,
+    0x6B,0xA7,0x08,0x13,0xB0,0xC9,0xB4,0x91,
+    0xFE,0x09,0xF1,0x07,0xE9,0x7E,0xDB,0xF4,
+    0x72,0x71,0xDB,0xA0,0x94,0x97,0xDF,0xD2,
+    0x67,0x7F,0x96,0x27,0xF0,0x00,0x96,0xBF,
+    0x38,0x56,0x0B,0xE9,0x92,0x03,0x6A,0x61,
+    0x4F,0xF3,0xAF,0x4B,0x26,0x24,0x7B,0x88,
+    0xDE,0x12,0xF3,0x65,0x85,0x59,0x65,0x01,
+    0x1B,0x80,0x25,0x85,0xA4,0x9E,0x7B,0x9C,
+    0x43,0x34,0x8C,0xD9,0xAF,0xE0,0x0B,0x5A,
+    0x90,0x2E,0x9F,0xB3,0x60,0x01,0x55,0xEC,
+    0xFA,0xDA,
+
+    /* Access unit 12 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x59,
+    0xFF,0x84,0x31,0x86,0xE2,0x0E,0x74,0x40,
+    0x70,0xC1,0xB0,0xD8,0x80,0xB5,0xBA,0x4F,
+    0x1C,0xB0,0x7B,0x96,0x3D,0xDA,0xCB,0x33,
+    0xFB,0x97,0x54,0x12,0x70,0x3A,0x90,0x64,
+    0xB5,0xB7,0x23,0xA5,0x89,0x99,0x02,0x9D,
+    0x3D,0xC0,0x40,0xA3,0x4A,0x29,0xF1,0xED,
+    0x64,0xAD,0xF1,0xBB,0xCE,0x05,0x9E,0x39,
+    0x2D,0x9C,0x8A,0x80,0xC8,0xC8,0x17,0x60,
+    0xD8,0xE9,0xA8,0x53,0x8C,0x8C,0x1D,0x2C,
+    0x4B,0xC0,0x6B,0x6D,0xB7,0x9D,0xE3,0x5A,
+    0xA7,0x1F,0x95,0x07,0xB3,0x9A,0x60,0x88,
+    0xE2,0xCB,0x88,0xAF,0x32,0x57,0xE3,0xCC,
+    0x00,0x54,0x6D,0x6D,0xC0,0x61,0xD9,0xB1,
+    0x0D,0xF6,0xCC,0xD0,0x86,0x19,0x37,0x9C,
+    0x30,0x42,0x22,0x52,0x30,0xFB,0xA1,0xB8,
+    0xAD,0xE0,0xB4,0xBA,0xE5,0x4F,0xB5,0x74,
+    0x6C,0x06,0xE6,0xA7,0x56,0x9B,0x10,0x27,
+    0x63,0x04,0x0B,0xE6,0x90,0xE8,0x96,0xA1,
+    0x53,0x09,0xE4,0x1E,0xEE,0xD4,0x95,0x53,
+    0x51,0xA5,0x19,0xCF,0xFE,0xA8,0xEE,0x42,
+    0x72,0xAA,0xAD,0x20,0xCA,0x59,0x97,0x11,
+    0x65,0xBD,0xD5,0x30,0xF1,0xF4,0x90,0xF4,
+    0xA2,0x92,0x4A,0x81,0x6D,0x2D,0x29,0xD4,
+    0x75,0x04,0xAC,0xF9,0x61,0x0B,0x57,0x1C,
+    0xA9,0x00,0x17,0xDC,0xCB,0x19,0xBE,0x4B,
+    0x31,0x16,0x24,0xE7,0x5C,0xA1,0x4C,0x0F,
+    0xE9,0x69,0x8B,0xAF,0x2D,0x77,0x14,0x40,
+    0x75,0xA2,0x96,0x97,0x9D,0xC3,0x06,0x19,
+    0x8A,0x55,0x23,0xE6,0xA8,0xC5,0xC2,0x74,
+    0xC6,0xCB,0x49,0xB3,0x36,0xBD,0x3A,0x4B,
+    0x80,0x00,0xC2,0x28,0x61,0xC7,0x03,0x63,
+    0xD6,0x55,0x4C,0xD2,0x56,0x7D,0x83,0x29,
+    0x03,0xDA,0x5A,0xB3,0x8C,0xAA,0x06,0x0C,
+    0x88,0x80,
+
+    /* Access unit 13 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x61,
+    0xFF,0x84,0x31,0x87,0x42,0x04,0x05,0x04,
+    0x83,0x85,0x83,0x5B,0x9E,0x40,0x37,0xCC,
+    0x41,0x28,0xD9,0x3D,0xCF,0xDC,0x00,0xD8,
+    0xE0,0xA3,0x2A,0x61,0x89,0xE8,0xC8,0x5D,
+    0x19,0x64,0xF0,0x96,0x17,0xA3,0x9B,0xFB,
+    0xFB,0x47,0xC0,0xC5,0xD1,0xD9,0x8F,0xD0,
+    0x7B,0x26,0x95,0x56,0xF1,0xCC,0xC0,0x53,
+    0x88,0x8D,0x19,0x13,0x45,0xC0,0xD9,0x91,
+    0xF6,0x18,0xDA,0x60,0x33,0x89,0x84,0x59,
+    0xAF,0x57,0x1F,0xBB,0x1D,0xA2,0xDD,0x9C,
+    0xCC,0x29,0xCE,0x4B,0x86,0x79,0x6E,0xB8,
+    0x05,0xE7,0x36,0x97,0x09,0xBA,0xF3,0x5E,
+    0xFB,0x7A,0x98,0xF0,0xE0,0x2D,0x3A,0x97,
+    0x12,0xFD,0x85,0xF3,0x0E,0x74,0xC0,0x87,
+    0xBA,0xB6,0x7F,0x1A,0x0C,0x03,0xE1,0xEE,
+    0x72,0x4F,0xC1,0x0A,0x8D,0xDB,0xCA,0x87,
+    0xF5,0x01,0x23,0x2A,0x6E,0x0B,0x0B,0x9F,
+    0x08,0xC5,0xEF,0x10,0x24,0x47,0xF8,0x80,
+    0x43,0x8A,0xBF,0xB6,0x0C,0x68,0xB3,0xCF,
+    0xC1,0x78,0x73,0x4F,0x80,0x28,0xE9,0x1F,
+    0x3E,0x93,0xD9,0xEC,0x32,0xA5,0x34,0x40,
+    0x3A,0x06,0x08,0x88,0x2A,0x74,0x16,0x8E,
+    0x91,0x59,0x17,0xF5,0x48,0x02,0xEB,0x52,
+    0xB2,0x5D,0xA4,0xA0,0xFE,0xDF,0x88,0x0E,
+    0x09,0x61,0xF6,0xCA,0xD8,0xF9,0xE9,0xE6,
+    0xA7,0xDA,0xE5,0xD0,0x15,0x9D,0x29,0x42,
+    0x1A,0x11,0x5A,0xCD,0x90,0x2E,0xBC,0xB7,
+    0xD3,0xAC,0xC2,0x7F,0xF4,0x86,0x84,0x16,
+    0xEB,0xAA,0xA6,0xEC,0x09,0x9A,0x2D,0x7C,
+    0xE9,0xF6,0x44,0x0D,0x9B,0x2C,0x9E,0x96,
+    0xD3,0x8C,0x12,0x8C,0x0F,0x08,0xF0,0xE3,
+    0x0F,0x5B,0x70,0x1F,0xA7,0x12,0x8D,0x09,
+    0x31,0x38,0xA5,0x2B,0x21,0xBE,0x65,0x10,
+    0xAC,0x24,0x34,0xCA,0x78,0x3C,0x16,0xFD,
+    0x01,0x1D,0xF3,0xFE,0xE7,0x7F,0xBF,0x2B,
+    0x0D,0x1F,0x6C,0x9F,0xCD,0xB9,0xC6,0x4A,
+    0xDE,0xFC,0x74,0xE0,0xE0,0xB9,0x68,0x26,
+    0x3B,0x9D,0x15,0x2B,0xBA,0x60,0x23,0xDF,
+    0xAD,0x32,0x80,0xB9,0x3F,0x05,0x3A,0x60,
+
+    /* Access unit 14 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x69,
+    0xFF,0x84,0x31,0x87,0x42,0x0E,0x28,0x48,
+    0x70,0xC1,0xBC,0xDA,0x80,0x37,0xCC,0x41,
+    0x28,0xD9,0x3D,0xCF,0xDC,0x00,0xD8,0xE0,
+    0xA3,0x2A,0x61,0x89,0xE8,0xC8,0x5D,0x19,
+    0x64,0xF0,0x96,0x17,0xA3,0x9B,0xFB,0xFB,
+    0x47,0xC0,0xC5,0xD1,0xD9,0x8F,0xBA,0xF9,
+    0xE8,0x53,0x88,0x8D,0x19,0x13,0x45,0xC0,
+    0x69,0x2F,0xB2,0xF9,0x95,0xD6,0x74,0x0D,
+    0x64,0xED,0xD9,0xDB,0x66,0xB0,0x38,0x48,
+    0x5C,0xC8,0x32,0x00,0x95,0xF6,0xE7,0x17,
+    0x2D,0x8C,0xDB,0x9B,0x8A,0x12,0x0C,0x4C,
+    0xC7,0x9E,0x87,0xB9,0x86,0xB0,0x54,0x40,
+    0x1D,0xB9,0x47,0x87,0xE1,0x7D,0xB3,0xE7,
+    0xCC,0xD4,0x0F,0xAA,0x6B,0xF4,0x22,0x7E,
+    0x7C,0x78,0x5C,0xB6,0x6A,0x1E,0xD8,0x7E,
+    0x31,0x87,0x4D,0x00,0xAD,0x83,0xD7,0xB7,
+    0xD5,0x43,0x3D,0x5D,0xC3,0x98,0xBA,0x05,
+    0x9B,0x4F,0x9B,0xFC,0x21,0x81,0x72,0x9A,
+    0x7C,0x84,0x8C,0xF9,0xE3,0x7A,0x0D,0x4F,
+    0xF8,0x18,0x9B,0xD3,0x2E,0x6D,0x1E,0xA2,
+    0xC2,0xE8,0x0A,0x96,0xAD,0xC1,0x32,0xED,
+    0x54,0x17,0x5A,0x20,0xE3,0x9B,0xC4,0xC7,
+    0xCB,0x40,0x59,0xA4,0x1E,0xB6,0xCD,0xD0,
+    0x4F,0xF5,0xC1,0xCB,0xFF,0x70,0x2F,0x10,
+    0x69,0xCD,0x0F,0x80,0x64,0xED,0x88,0xA4,
+    0xF8,0xEC,0xA1,0xD8,0x73,0xF4,0xF6,0x61,
+    0x54,0xE6,0x24,0x2C,0x6F,0x69,0x9F,0xFF,
+    0xC7,0xAE,0xA9,0x76,0x17,0xD5,0x16,0x85,
+    0x4B,0xDE,0x19,0xEA,0x31,0x30,0x9C,0xD9,
+    0x92,0x75,0xFF,0x92,0xBF,0x15,0x65,0x1E,
+    0x15,0xCD,0xE1,0xEF,0x2F,0xFF,0x7A,0x49,
+    0xCE,0xE5,0xF2,0xAF,0x96,0x59,0xE7,0x2C,
+    0x93,0x4A,0xBE,0x4E,0xAA,0x00,0x1F,0x17,
+    0x11,0xC2,0xF0,0xFA,0x0A,0x01,0x57,0xF5,
+    0xC0,0x3E,
+
+    /* Access unit 15 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x71,
+    0xFF,0x84,0x31,0x87,0xE2,0x04,0x1A,0x0C,
+    0x8A,0x8B,0x09,0xC6,0x27,0x40,0x3B,0xEA,
+    0x6B,0xA2,0x44,0xD3,0x7C,0xD7,0xD4,0x00,
+    0x15,0x5E,0xA7,0xC2,0xDB,0x8F,0xF3,0xAC,
+    0x31,0xD9,0xC6,0x7D,0xBD,0x37,0xAE,0xC0,
+    0xEA,0x5C,0xB7,0xC3,0x86,0x5D,0xF6,0x97,
+    0xCD,0x03,0xC7,0x04,0x42,0x73,0x1E,0x03,
+    0x46,0xAB,0x9A,0x19,0x98,0xB3,0x02,0xCA,
+    0x5E,0xE8,0xE0,0xB0,0x9E,0xBD,0x21,0xD4,
+    0xFE,0xE7,0xDD,0x6A,0x66,0xB7,0x97,0x7A,
+    0x79,0x6D,0xE5,0x23,0x71,0xDC,0xDB,0x0D,
+    0xD3,0x32,0xE6,0x36,0x90,0x9F,0xD0,0x9C,
+    0xEF,0xA2,0x0F,0x10,0xEE,0xDA,0xD5,0xFD,
+    0x10,0x01,0x3C,0xCB,0xD8,0x6E,0x99,0x97,
+    0x31,0xE9,0x80,0xC8,0xF2,0x1C,0x28,0xCE,
+    0x7D,0x8B,0x31,0xAA,0x6D,0xAD,0x5F,0xD1,
+    0x00,0x13,0xD8,0x3D,0x86,0xE9,0x99,0x73,
+    0x21,0x70,0x4B,0xCC,0x4D,0x41,0x86,0x18,
+    0xFC,0x43,0xCB,0x6F,0x29,0x1B,0x93,0x99,
+    0xD8,0x6E,0x99,0x97,0x32,0x7D,0x5A,0x18,
+    0xBB,0x3A,0x7F,0xFF,0xBF,0xFF,0xEE,0x99,
+    0x77,0xEC,0x82,0x5B,0xF5,0x96,0x48,0x58,
+    0xF2,0x23,0xE0,0xDB,0x5F,0xFE,0x56,0x44,
+    0xA4,0x72,0x87,0x3B,0x02,0x66,0x3A,0xB1,
+    0xCD,0xD0,0xF7,0xEF,0x77,0xFA,0x48,0x40,
+    0x57,0x33,0x6E,0x26,0x75,0x86,0x13,0xB9,
+    0xAF,0xBB,0xC9,0x70,0x28,0xC0,0xBF,0x01,
+    0x78,0x6F,0x91,0x00,0x2B,0x36,0x52,0x52,
+    0xCC,0xA4,0x1A,0x7D,0xC0,0xC0,0xD5,0x23,
+    0x57,0xE5,0x94,0xBF,0x63,0xF3,0xCF,0xBB,
+    0xE0,0xE5,0xD1,0xFA,0x66,0x96,0xD2,0xDB,
+    0x7E,0xFF,0xC7,0x7C,0x84,0xEB,0xDC,0x2A,
+    0xF0,0x2F,0x67,0x54,0x03,0xDF,0xFA,0x76,
+    0xC9,0x7A,0x2A,0x6B,0x60,0x80,0x60,0x68,
+    0x75,0xE4,0x61,0x36,0x1A,0x03,0xB8,0x02,
+    0x3B,0x44,0xE0,0x58,0x9B,0x65,0xDC,0x34,
+    0x26,0x88,0xEF,0xFB,0xC7,0x60,0x61,0x6B,
+    0xDE,0xC4,0x80,0x6B,0x21,0x47,0x04,0xAE,
+    0x25,0x1F,0x1E,0xFB,0xB6,0xD0,0xFF,0x50,
+    0xBC,0x73,0xCD,0x0F,0xF6,0xD8,0xF0,0x2F,
+    0x9F,0x7C,0xD1,0x70,0xFA,0x35,0xE6,0xA1,
+    0x2F,0x70,0x68,0xBC,0x54,0x39,0x86,0xFD,
+    0x6E,0x61,0x31,0xF2,0xB1,0xAD,0xF9,0xE8,
+    0x1B,0x6E,0x01,0x37,0x71,0x17,0xE4,0xF3,
+    0xE3,0x06,0x19,0xAD,0xDB,0xDD,0xA2,0x37,
+    0xAB,0x48,0x28,0xF7,0xCC,0xEA,0x07,0x44,
+    0x34,0xBF,0x0F,0x00,0x34,0xB7,0x70,0x1B,
+    0x05,0xE1,0x02,0xC4,0xEB,0x4F,0x78,
+
+    /* Access unit 16 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x79,
+    0xFF,0x84,0x31,0x87,0xC2,0x04,0x22,0x15,
+    0x0D,0x8C,0x86,0x57,0x9A,0x40,0x3B,0xEA,
+    0xEC,0xE1,0xFC,0x16,0x6D,0x92,0x6F,0xB7,
+    0x03,0xFE,0xA7,0x85,0xD3,0x13,0xC3,0x89,
+    0x80,0x96,0x2D,0xD1,0x75,0xC9,0x7F,0xCD,
+    0xB4,0xBA,0xC3,0x7D,0x4E,0xF2,0x64,0x3D,
+    0x12,0x72,0xFF,0x25,0x9F,0x63,0x26,0x92,
+    0x09,0xF7,0xEB,0xE4,0x4E,0x2A,0x37,0x1D,
+    0x7B,0x8B,0x1F,0xE2,0xA5,0x57,0x0D,0x6F,
+    0xE6,0xD8,0x9B,0xCF,0xD4,0xE7,0x40,0x7C,
+    0xC9,0xD7,0xE7,0xB6,0xB2,0xB4,0x72,0x3E,
+    0x64,0x8D,0x36,0x8A,0x45,0xF2,0x28,0x94,
+    0x08,0xE3,0xA7,0xB8,0x26,0xEA,0x5D,0xC7,
+    0x93,0xA2,0x98,0x31,0xC0,0xB3,0xA1,0xF5,
+    0x3D,0x06,0x44,0xF5,0x83,0x75,0xA7,0xF6,
+    0x3A,0xA1,0xB0,0xF7,0xC8,0xB0,0x9E,0x51,
+    0x4B,0x86,0xA3,0xF0,0x9D,0xAC,0x66,0x5A,
+    0xF4,0x76,0xD1,0xDF,0x60,0x34,0xB9,0x86,
+    0x98,0x17,0x72,0xCD,0x92,0x34,0x06,0x3C,
+    0x05,0xA0,0xC5,0x89,0x96,0x3B,0x68,0xA1,
+    0x05,0x2A,0xE0,0x87,0x57,0x54,0xEF,0x7C,
+    0x7F,0xD5,0xA9,0x7E,0x49,0x0C,0x12,0xB0,
+    0x81,0x0E,0x4F,0xE7,0x49,0x0E,0x30,0x95,
+    0xB5,0x12,0x87,0x22,0xFB,0x84,0xDB,0xCF,
+    0x1C,0x5C,0x70,0x21,0xCD,0x3D,0xE4,0x5E,
+    0xE6,0xC9,0x6E,0x92,0x9B,0x2C,0xAA,0x4F,
+    0xC8,0xDE,0x8E,0x38,0x92,0x23,0x23,0x8A,
+    0x6B,0xC3,0x2E,0xD7,0xE1,0xBF,0xFE,0xDF,
+    0xFB,0xBF,0x16,0x4A,0x6C,0x05,0x78,0xB3,
+    0x49,0x2C,0xCF,0x2A,0x31,0x0E,0xF2,0x98,
+    0xC1,0xE8,0x84,0xBF,0x1E,0x4B,0xCB,0x97,
+    0xA8,0x34,0xC8,0x6F,0x0B,0xFC,0x4A,0xBD,
+    0x81,0x9C,0x55,0x7F,0xF0,0x48,0x4B,0x69,
+    0x77,0x63,0xFF,0xD0,0xBE,0x61,0x64,0xCA,
+    0x85,0x71,0x2F,0x44,0xD3,0x44,0x7C,0xFE,
+    0xBA,0xC4,0x2D,0xAA,0xAA,0x12,0xC0,0xCD,
+    0x99,0xCA,0xA6,0xDA,0x40,0x65,0x5A,0x84,
+    0x11,0x25,0xB4,0x39,0x78,0x6F,0x67,0x9E,
+    0x29,0x70,0xCC,0x30,0x17,0x92,0x69,0x17,
+    0xE9,0x52,0x8F,0x69,0xC7,0x60,0x4D,0x35,
+    0x3C,0x58,0x76,0xD5,0xEE,0x7F,0xF7,0x95,
+    0x7C,0xBF,0x49,0x0D,0x2F,0x41,0x2C,0x8D,
+    0x72,0x87,0x4B,0xAC,0xDD,0xD5,0xC4,0x1E,
+    0x61,0x9A,0x96,0x1F,0xE6,0xE7,0xFD,0xF2,
+    0x9C,0x60,0xFC,0xCD,0x6D,0xF5,0xB0,0x9F,
+    0xEC,0x3D,0x58,0xD2,0x21,0xA8,0xD3,0xF2,
+    0xDD,0x66,0x62,0xCF,0xDB,0x9C,0x22,0xA8,
+    0x86,0xEE,0xB6,0xFF,0xE6,0x69,0x65,0x40,
+    0xE3,0xC7,0x01,0x71,0x11,0x1E,0x8A,0x32,
+    0x5F,0x7F,0x12,0x0B,0xFD,0xF0,0x53,0x51,
+    0xAE,0xEA,0xFA,0x60,0x00,0x07,0x9D,0xDC,
+    0x5F,0xA9,0x86,0x54,0xF5,0x24,0x0B,0xB3,
+    0x40,0x70,0xB7,0xE5,0xCE,0xD0,0x00,0x67,
+    0xD2,0x3C,0x95,0xB1,0x0F
+};
+
+/* 1280 x 720 H.265 test stream: colour bars with the frame number burned in (tools/fx3_uvc_h26x_frames.py).
+ * One GOP of 16 Annex B access units, IDR first; general_profile_idc 1, general_level_idc 93 (level 3.1).
+ * Access units of 302 to 1089 bytes, 9364 bytes in all. */
+const uint32_t glVidFrameLenH265_1280x720[16] = {
+    1089, 302, 371, 942, 717, 490, 850, 613,
+    492, 521, 382, 452, 453, 465, 502, 723
+};
+
+const uint8_t glUVCVidFramesH265_1280x720[] __attribute__ ((aligned (32))) =
+{
+    /* Access unit 1 (IDR) */
+    0x00,0x00,0x00,0x01,0x40,0x01,0x0C,0x01,
+    0xFF,0xFF,0x01,0x60,0x00,0x00,0x03,0x00,
+    0x90,0x00,0x00,0x03,0x00,0x00,0x03,0x00,
+    0x5D,0xBA,0x02,0x40,0x00,0x00,0x00,0x01,
+    0x42,0x01,0x01,0x01,0x60,0x00,0x00,0x03,
+    0x00,0x90,0x00,0x00,0x03,0x00,0x00,0x03,
+    0x00,0x5D,0xA0,0x02,0x80,0x80,0x2D,0x16,
+    0x5B,0xA9,0x24,0xCA,0xE6,0x80,0x80,0x00,
+    0x00,0x03,0x00,0x80,0x00,0x00,0x07,0x84,
+    0x00,0x00,0x00,0x01,0x44,0x01,0xC1,0x72,
+    0xB4,0x62,0x40,0x00,0x00,0x01,0x28,0x01,
+    0xAF,0x11,0x18,0x25,0x60,0x24,0x11,0x08,
+    0x04,0x01,0xF0,0xF8,0x7F,0xA8,0x35,0x0F,
+    0x40,0xF4,0x96,0x9F,0x23,0xC9,0x02,0x80,
+    0xB1,0x13,0xBA,0xB4,0x8C,0xC4,0x27,0x45,
+    0xB8,0xB8,0x82,0x30,0x62,0x49,0xF2,0x64,
+    0xF6,0xD6,0x07,0x94,0x83,0x6E,0x89,0xB5,
+    0x11,0x28,0x71,0xD5,0x61,0xC9,0x87,0x9C,
+    0xE0,0x1F,0x1B,0x33,0x1B,0x28,0xD4,0x6E,
+    0x6A,0x65,0xA0,0x71,0x29,0x12,0x98,0x41,
+    0x9E,0xB5,0xC6,0x5E,0xC2,0x0B,0x03,0xEC,
+    0x0A,0x36,0xDF,0x21,0x18,0x02,0xC4,0x38,
+    0xBE,0x07,0xC3,0x6F,0xDF,0xA4,0x03,0xFA,
+    0x58,0x24,0x12,0x6D,0x22,0x52,0x61,0x05,
+    0x09,0xA6,0x3C,0x31,0xD3,0xD8,0x52,0x20,
+    0x07,0x1B,0xA6,0x08,0xCD,0xCB,0xF2,0xF3,
+    0x8E,0x88,0x1A,0x6E,0x73,0x72,0xA2,0x76,
+    0xD2,0xF6,0x83,0xF9,0x8A,0x04,0x05,0x2B,
+    0xBB,0xE4,0x09,0x41,0x81,0x52,0xC0,0x00,
+    0x61,0xC9,0xB9,0xC9,0x59,0x8B,0x2C,0x2C,
+    0x2A,0x95,0xE2,0x8F,0x8A,0x07,0xB9,0xE8,
+    0x34,0x90,0x27,0x80,0x05,0x8B,0xA7,0x52,
+    0xEB,0x45,0xBF,0x00,0xDA,0x90,0x4F,0x23,
+    0x24,0x4F,0xDD,0x70,0x83,0x57,0xA8,0x9E,
+    0x56,0xBE,0x08,0x27,0x9D,0x7B,0x59,0x80,
+    0x48,0x40,0xA8,0xB0,0x46,0x40,0xF8,0x0B,
+    0x64,0x16,0xE0,0x71,0x62,0xCF,0xCD,0x50,
+    0x7E,0x08,0x68,0x41,0x4F,0xF9,0x80,0x00,
+    0x00,0xC4,0x00,0x00,0x78,0xF1,0x82,0xB4,
+    0xF2,0xA4,0x29,0x38,0xEE,0x14,0xF0,0x93,
+    0x0A,0xF1,0x28,0x11,0xCC,0xFE,0xAF,0xCC,
+    0xAC,0x08,0xB0,0x52,0x46,0xD0,0x46,0x95,
+    0x5A,0xF0,0x00,0x02,0x3E,0x00,0x01,0xD4,
+    0x12,0x0F,0xC4,0x72,0x90,0xA4,0xE3,0xB8,
+    0x5C,0xC0,0x87,0x00,0x35,0x72,0x95,0x8B,
+    0x28,0x51,0xD9,0x86,0xE8,0x4A,0x06,0xC0,
+    0x5B,0xA0,0x9D,0xA0,0x00,0x07,0x98,0x00,
+    0x07,0x56,0x38,0x38,0xD1,0xEC,0x86,0xBC,
+    0xA5,0x81,0xB5,0x00,0x01,0x91,0xCB,0x22,
+    0x3F,0xD7,0x10,0x60,0xD0,0x0A,0x09,0x25,
+    0x0F,0x75,0x87,0x6C,0x00,0x01,0x64,0x00,
+    0x01,0x8D,0x8E,0x11,0x13,0xD6,0x2C,0xD9,
+    0x14,0xB0,0x3D,0x20,0x00,0x04,0xF9,0x63,
+    0xA0,0x8A,0x62,0x74,0x64,0xB0,0x46,0x47,
+    0xD8,0x89,0xAC,0x06,0x40,0x00,0x15,0x10,
+    0x00,0x16,0x57,0x00,0xEF,0x32,0xDE,0x4D,
+    0x91,0x4B,0x04,0x04,0x00,0x0A,0x60,0xCE,
+    0xDE,0xB0,0xBE,0x72,0x0D,0x00,0xA4,0x13,
+    0x21,0x37,0x65,0x64,0x80,0x00,0x2F,0x00,
+    0x00,0x2B,0x6E,0x01,0xE2,0x68,0xBC,0x9B,
+    0x22,0x96,0x08,0x18,0x00,0x14,0x07,0xC3,
+    0x26,0xBB,0x35,0xA7,0x93,0x70,0xF0,0x19,
+    0x21,0xD6,0x7B,0x5F,0x00,0x00,0x4E,0xC0,
+    0x00,0x50,0xCB,0xC3,0x68,0xA5,0x79,0x36,
+    0x45,0x2C,0x11,0x10,0x95,0x7B,0xA8,0x48,
+    0x86,0xB3,0xFE,0x1F,0x24,0x39,0xF7,0x8E,
+    0xE4,0x6E,0x46,0xBB,0x37,0x9E,0xBC,0x22,
+    0x0C,0xD0,0xE1,0xFC,0xA0,0x18,0x18,0x00,
+    0xFA,0x8A,0x43,0xAD,0x24,0x95,0x4C,0x94,
+    0x25,0xE6,0x6D,0x5F,0x03,0x9D,0xF1,0x06,
+    0xB6,0x31,0x6F,0x05,0x38,0x49,0x0F,0x1E,
+    0x0A,0x75,0x86,0x60,0x53,0x81,0x93,0x56,
+    0xC4,0x60,0x64,0xD7,0xE4,0x5B,0xD1,0x53,
+    0xFE,0xBF,0x35,0xE8,0xE7,0x05,0xA2,0x9B,
+    0x11,0x77,0x38,0xD2,0x42,0x3A,0x69,0x11,
+    0x66,0xC4,0xF1,0xB7,0x0F,0x6B,0x96,0x2F,
+    0xB1,0x8B,0x6F,0x41,0xF4,0x50,0x70,0xDA,
+    0x3F,0xF0,0x3F,0xF3,0x66,0x47,0x0A,0xCE,
+    0x58,0x29,0x32,0xDE,0x86,0xE7,0x63,0x10,
+    0x14,0x43,0xAD,0x6E,0x62,0x45,0x66,0x0D,
+    0x2E,0x27,0x41,0xFF,0x0B,0xDF,0x1E,0x05,
+    0x7A,0x33,0x0F,0x11,0xF2,0x9C,0xB4,0x3B,
+    0xEE,0x4A,0xD4,0xF2,0x6B,0xCB,0xD1,0x23,
+    0x6F,0x38,0x44,0x0B,0x28,0xC1,0x5C,0xCB,
+    0x3F,0x48,0xF7,0xF3,0xCE,0xC0,0x5A,0x91,
+    0x98,0x54,0xF0,0x5D,0xAF,0x40,0x68,0xA3,
+    0x24,0xE9,0xA6,0x09,0x9C,0xA9,0x6D,0xB9,
+    0x49,0x02,0x7A,0x1A,0x1C,0x1E,0x7C,0xA0,
+    0x4D,0x05,0x96,0x80,0x45,0x30,0x9A,0xF9,
+    0x02,0x3F,0x4C,0xD3,0x1D,0x17,0xF7,0xD5,
+    0xDC,0x1F,0xF6,0x26,0xCB,0x06,0x40,0x9F,
+    0x34,0xC0,0x90,0x30,0x41,0xA3,0xB4,0x47,
+    0x86,0x8E,0x62,0x51,0x1B,0xC7,0xCE,0xF2,
+    0xC0,0x9A,0xCF,0x5E,0xE4,0x27,0x12,0xA9,
+    0x83,0x34,0xFF,0x5A,0x03,0xE4,0x18,0x6D,
+    0xDF,0x1A,0x2E,0xC2,0x94,0x7D,0x61,0x16,
+    0x0C,0x95,0xBE,0xC9,0xDD,0x7F,0xF0,0x64,
+    0xD9,0xD6,0x9D,0xF2,0x68,0xF0,0x49,0x06,
+    0x1F,0xA8,0x79,0x5A,0x23,0xA0,0x2C,0x23,
+    0x2C,0xFF,0xD2,0xCD,0x38,0x5E,0x3D,0xAF,
+    0xFE,0x3C,0xAA,0xAB,0x2D,0x9C,0x28,0x3C,
+    0xEA,0x9D,0x37,0x04,0x39,0xAD,0xE3,0x70,
+    0x5F,0xFD,0x10,0xC9,0x9D,0x6E,0xEB,0x05,
+    0x12,0x93,0x65,0x66,0x57,0x14,0xA9,0x39,
+    0x64,0x13,0xCE,0x2F,0x9E,0x19,0x00,0x36,
+    0xF1,0xAF,0xCC,0xD0,0x07,0xD1,0x81,0xE9,
+    0x7E,0xC4,0xCF,0x2D,0xA6,0x80,0x6A,0xBC,
+    0x97,0xCA,0xA9,0xAA,0xD1,0x5C,0x2E,0x10,
+    0x13,0x48,0x89,0x28,0xB0,0x73,0xCD,0x92,
+    0x04,0xD3,0x12,0x5A,0x12,0xA9,0x04,0xF7,
+    0x5B,0xE9,0xB8,0x85,0xA9,0xAB,0x79,0xE8,
+    0x89,0x9A,0xF4,0xA0,0x52,0x04,0x20,0xF2,
+    0xF4,0x8D,0x18,0xE0,0xDB,0x34,0x72,0x21,
+    0xD7,0xF4,0xE6,0x60,0x06,0x90,0x64,0xFF,
+    0x40,0x0A,0xD6,0x13,0x91,0xC5,0x08,0x81,
+    0x64,0xF2,0xDC,0x96,0x34,0x72,0xEF,0x07,
+    0xCC,0xF2,0x70,0x7A,0x19,0x81,0x29,0xF3,
+    0x3D,0x10,0x54,0xCE,0x61,0x69,0x70,0x39,
+    0x17,0x3D,0xEA,0xCF,0x47,0x2E,0x06,0x66,
+    0xD4,0x9E,0xDE,0x13,0x25,0x17,0x7D,0xEF,
+    0xA7,0xF0,0xDB,0x3E,0xC8,0x01,0xF0,0xDD,
+    0x37,0xA2,0xE2,0xCC,0x40,0x4E,0x66,0xCE,
+    0x3C,0xD7,0x5C,0x1A,0xC0,0x3D,0xF2,0x85,
+    0x1C,0xC8,0x48,0x52,0x1A,0x0B,0xB7,0xF8,
+    0x7D,0xE6,0x85,0xB9,0x79,0x34,0xE6,0x50,
+    0x62,0xE6,0x7A,0x3C,0x3C,0x38,0xC0,0xFE,
+    0x1B,0x97,0x19,0x90,0x9B,0xC4,0xE4,0xBB,
+    0x0A,0x03,0xE4,0x31,0x1C,0x00,0x00,0x03,
+    0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,
+    0x03,0x00,0x00,0x03,0x00,0x03,0x96,0x55,
+    0x64,0x29,0x67,0xBE,0xFB,0x09,0xEC,0xA4,
+    0x6C,0x54,0xBC,0x3E,0x00,0x00,0x03,0x00,
+    0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,
+    0x00,0x00,0x03,0x00,0x07,0xB4,0x00,0x53,
+    0xD0,0x00,0x00,0x03,0x00,0x00,0x03,0x00,
+    0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x09,
+    0x88,
+
+    /* Access unit 2 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x09,
+    0x7E,0x10,0xC6,0x68,0xC3,0x8E,0x1A,0x24,
+    0x40,0x81,0x02,0x03,0xEA,0x6C,0x5E,0xFD,
+    0x2B,0xC5,0xBD,0x22,0x40,0x25,0x01,0x33,
+    0xA5,0xBB,0x28,0xA3,0xF3,0x80,0xD7,0x0C,
+    0x33,0xCE,0x66,0xB7,0xB0,0x08,0x1E,0xE3,
+    0x87,0xB3,0xF2,0x80,0x9A,0xAF,0x5F,0x27,
+    0xB1,0xC3,0x00,0x1B,0xDA,0x20,0x87,0x0D,
+    0x2D,0x8C,0x7D,0x26,0x29,0xBD,0xCA,0x00,
+    0x40,0xAD,0x9E,0x41,0x11,0x59,0x6D,0xC8,
+    0x00,0xA4,0x35,0x0E,0xC6,0x2A,0x43,0x74,
+    0xC0,0x01,0x10,0xA5,0x9B,0x67,0xB0,0x69,
+    0x17,0x40,0x01,0xA3,0x77,0x33,0x9A,0xDB,
+    0xE4,0x69,0x73,0x51,0xF0,0xF8,0xAD,0x80,
+    0xA2,0x58,0xD0,0xEC,0x7F,0xBE,0x63,0xCE,
+    0xBE,0xFF,0xAF,0x9E,0x2C,0x3B,0xA3,0x42,
+    0x22,0xB0,0xBE,0x00,0xD6,0x30,0x29,0xC8,
+    0x91,0xD6,0x9B,0x25,0x6F,0xB7,0xA6,0xEE,
+    0xB2,0x04,0xDA,0x80,0x75,0x74,0x71,0x8C,
+    0x25,0xE2,0x07,0x08,0x4E,0xD8,0x1F,0x57,
+    0xA0,0x14,0x51,0x7C,0xCC,0x24,0xA2,0x6A,
+    0xE6,0x4D,0x4D,0xE7,0x1E,0x80,0x64,0xB7,
+    0x41,0x14,0x5C,0x32,0x87,0xA3,0xE3,0x1E,
+    0x2E,0x7D,0x48,0xC6,0xC0,0x76,0x94,0xCF,
+    0xE8,0x0B,0x24,0xF6,0xE1,0xD6,0x38,0xDF,
+    0xCF,0x29,0x65,0x4A,0xFC,0xC1,0xEB,0x4F,
+    0x76,0xB1,0x69,0x77,0x35,0x2B,0xFF,0x98,
+    0x0D,0xA9,0xA9,0x35,0x2B,0x5D,0x91,0x5F,
+    0xB8,0xB8,0x34,0xC7,0x52,0xAA,0xAD,0xFF,
+    0xB3,0x58,0xA7,0x9B,0x82,0x48,0x12,0x14,
+    0x12,0xA2,0xE6,0x84,0x3E,0xF2,0xB2,0xB8,
+    0xC3,0x77,0xE1,0x72,0x57,0x23,0x8C,0x86,
+    0x01,0x47,0xD1,0xEB,0x93,0x4C,0x4D,0xDA,
+    0x00,0x00,0x45,0xC0,0x40,0x78,0xCE,0xAB,
+    0xB6,0xC5,0xAC,0x74,0x07,0x76,0x0A,0xB9,
+    0x72,0xE2,0x23,0x3C,0xA7,0xF2,0x42,0x20,
+    0x00,0x00,0x08,0x58,0x10,0xEF,0xE0,0x57,
+    0xFD,0xB4,0x60,0x00,0x03,0x8A,
+
+    /* Access unit 3 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x11,
+    0xFF,0x84,0x31,0xB0,0xC1,0x03,0x02,0x41,
+    0x41,0x21,0x21,0x21,0x21,0x37,0x04,0x21,
+    0xD0,0xFB,0x73,0x29,0x39,0xE2,0x4C,0x41,
+    0x83,0xA3,0xA9,0xE3,0xB2,0xF7,0x7E,0x33,
+    0x15,0x88,0x05,0xB0,0xE5,0x30,0xB9,0x90,
+    0x7E,0x40,0xA5,0x11,0xB5,0xBF,0xE2,0xF7,
+    0x71,0xFA,0x33,0x8D,0x5D,0x2E,0xB0,0xD9,
+    0x36,0x49,0x0A,0x6B,0x9B,0x99,0x10,0xFD,
+    0x8E,0x26,0xBC,0xB9,0x07,0xD5,0xA8,0x08,
+    0x89,0x1F,0x9E,0x98,0xC0,0x6E,0xDC,0x53,
+    0xFD,0x65,0x04,0x19,0x11,0x0B,0xE0,0x5A,
+    0x73,0xD0,0x9A,0x38,0x0A,0x05,0xFB,0x3A,
+    0xD5,0x78,0x5C,0xC2,0x69,0x60,0x0D,0x39,
+    0x72,0xC2,0x5A,0x63,0xF0,0xED,0x06,0x20,
+    0x11,0xEB,0xBD,0xF8,0x27,0x88,0x59,0xD1,
+    0x08,0xE0,0x79,0x44,0xAF,0xEE,0xAF,0x2F,
+    0xA3,0x73,0xD0,0x5B,0x45,0x12,0xC0,0xA9,
+    0xD4,0xA5,0x58,0xA2,0x55,0x9B,0x4A,0xFB,
+    0x42,0xF1,0xD1,0xEF,0xE9,0x3C,0x9C,0x49,
+    0xB2,0x74,0x8D,0xC8,0x93,0x5D,0x9E,0xF4,
+    0xC8,0x97,0x6D,0x83,0x55,0xB3,0x08,0xA7,
+    0xFD,0x23,0xFA,0xEE,0x77,0xB9,0x45,0x89,
+    0xFF,0x85,0xA5,0xE9,0x86,0x98,0xF4,0x7C,
+    0x7E,0x95,0x57,0xB7,0x4C,0x56,0x03,0x02,
+    0x95,0x04,0xB4,0x73,0x06,0x26,0xB9,0xC9,
+    0x4C,0xF9,0x85,0x0F,0x36,0xEC,0x13,0x15,
+    0x2C,0x5B,0xAC,0x73,0xE5,0xF8,0x0C,0xD8,
+    0x16,0xDB,0xF0,0xA8,0x6B,0xDF,0x07,0xD0,
+    0xE5,0xB8,0x50,0xFB,0xAB,0x65,0x6D,0x97,
+    0xA5,0x3A,0x5E,0x5D,0x10,0x92,0x5C,0xBD,
+    0x2B,0x21,0xFD,0x9F,0x6B,0xA9,0x60,0xD2,
+    0x98,0xEC,0xA9,0x77,0xB0,0x81,0xAD,0x55,
+    0x5E,0xCB,0xF3,0xF0,0xBB,0xC5,0x1E,0x23,
+    0xEE,0xB8,0x98,0xB6,0xBB,0x6D,0xB6,0x1F,
+    0x96,0x3B,0xF2,0x15,0x04,0x8F,0xA0,0x3F,
+    0xC4,0x18,0x19,0x8F,0x33,0x62,0xA9,0xAD,
+    0x3E,0x72,0xAB,0x2C,0x53,0xA3,0xFB,0x9D,
+    0x3E,0x8C,0x47,0xDC,0x65,0xDF,0x6E,0x37,
+    0x05,0x6F,0x50,0x2B,0xD8,0x0F,0x0B,0xBB,
+    0xD0,0xA2,0x19,0x81,0xCD,0x6E,0x5B,0xD9,
+    0xBA,0x0E,0x09,0xBA,0x6B,0xB5,0x72,0xA4,
+    0xB4,0xFF,0xC4,0x12,0xFF,0x97,0x2E,0xB3,
+    0x84,0x00,0x00,0x1D,0xD0,0x4F,0xB3,0x27,
+    0xEF,0x03,0x9A,0xC7,0x8C,0xE1,0x0A,0x00,
+    0x00,0x03,0x02,0x22,0x38,0xDC,0x1F,0x9C,
+    0x00,0x0F,0x68,
+
+    /* Access unit 4 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x19,
+    0xFF,0x84,0x31,0x8B,0x0C,0x12,0x6E,0x24,
+    0x8E,0xC7,0x43,0xA1,0xD0,0xE8,0x75,0x34,
+    0x0C,0x87,0x60,0xFA,0x73,0x80,0x48,0x43,
+    0x8F,0xE1,0x49,0x03,0x32,0x35,0x18,0x74,
+    0x78,0x3C,0x5B,0xEC,0x45,0xDF,0xB1,0xBB,
+    0x58,0x68,0x72,0xD4,0x0B,0x5D,0xF3,0xEF,
+    0xD9,0xB0,0x3A,0xCF,0x42,0x3C,0x59,0x50,
+    0x7C,0xD4,0x81,0x53,0xB1,0xEB,0xF8,0xFB,
+    0x73,0x4A,0x95,0x2B,0x50,0x4F,0xFC,0x5C,
+    0xB3,0x34,0x8A,0x99,0x91,0x84,0xBD,0x5C,
+    0x3C,0xDB,0x4E,0x39,0x07,0x71,0xDE,0x61,
+    0x27,0x93,0x11,0x4F,0x84,0xCA,0xA4,0xD4,
+    0x27,0xE1,0xFB,0x4D,0xFB,0x8B,0x1D,0x7F,
+    0xFE,0xCA,0xB1,0x42,0x9C,0xBB,0x03,0x3E,
+    0xF6,0x6F,0xEF,0x3D,0x60,0x1F,0xB3,0xE7,
+    0xC4,0x3C,0xF6,0xE4,0xB1,0x86,0x13,0xE4,
+    0x8E,0xA8,0xA4,0x80,0x20,0x20,0x03,0x4A,
+    0xD3,0x33,0xB8,0x83,0x55,0x39,0x2C,0x50,
+    0x10,0x81,0xB7,0x7C,0xCF,0x70,0x85,0xD8,
+    0x90,0x51,0x08,0xFE,0xEA,0x5C,0x16,0xB4,
+    0xBB,0x63,0x56,0xED,0x2B,0xD2,0x45,0xD3,
+    0xA0,0xAF,0xEB,0x4E,0x8F,0xAA,0x0B,0xD0,
+    0xC7,0xCE,0x8A,0x8B,0x4C,0x18,0xC4,0x1F,
+    0xD9,0xCF,0x6A,0x26,0x8A,0xFE,0xF8,0x67,
+    0x19,0xD9,0x3E,0xA9,0xBE,0x38,0xC4,0xDF,
+    0xB6,0xC5,0x10,0xD4,0x98,0x2D,0x2E,0x38,
+    0x83,0x55,0x39,0x2C,0x50,0x64,0x5F,0x6E,
+    0xF9,0x9E,0xE2,0x62,0x62,0x41,0x44,0x24,
+    0x02,0xA3,0x10,0x5A,0xD2,0xE3,0x05,0xAA,
+    0x5D,0xD2,0x0D,0xE6,0xC5,0xE8,0xFE,0xB0,
+    0xBE,0x1D,0x02,0xE4,0x11,0xB6,0x59,0xD7,
+    0xA3,0x40,0xAB,0xDB,0x8E,0x4C,0x6D,0xB2,
+    0x25,0xF5,0xCF,0xFB,0x9C,0x98,0xAC,0x48,
+    0x88,0x6A,0x98,0xA4,0x0D,0x54,0xE4,0xB1,
+    0x42,0x41,0x7D,0xBB,0xE6,0x7B,0x8B,0x4D,
+    0xD5,0x31,0x12,0x4A,0xEC,0x9C,0x41,0x6B,
+    0x4C,0x33,0x1F,0x18,0x9C,0x8E,0x49,0xEC,
+    0xCE,0xC8,0xAB,0x5C,0x99,0x8E,0xE6,0x13,
+    0x61,0xFA,0xDD,0x5C,0xC1,0x65,0x98,0xDD,
+    0x85,0x89,0x9E,0x93,0xDE,0xF3,0x20,0x70,
+    0x9E,0xD2,0x91,0x04,0x9A,0x2E,0x77,0x2E,
+    0x2D,0x2B,0x49,0x0A,0x65,0xF6,0xEF,0x99,
+    0xEE,0x39,0x8F,0x54,0xC4,0x49,0x2B,0xF0,
+    0x71,0x05,0xAD,0x31,0x95,0x20,0xC4,0x8E,
+    0x84,0xD5,0xB3,0xFB,0x34,0xAE,0x72,0x76,
+    0x47,0xA0,0x00,0x0F,0x39,0xD7,0xA3,0x40,
+    0xAC,0x01,0xD5,0x85,0xA6,0x7A,0x7D,0xFB,
+    0xCC,0x81,0xC2,0x7B,0x4A,0x9C,0x08,0xB4,
+    0x42,0x90,0x35,0x53,0x92,0xC5,0x0C,0xC3,
+    0xF6,0xEF,0x99,0xEE,0x43,0x5F,0x54,0xC4,
+    0x49,0x2B,0xEE,0x5A,0xAF,0xF5,0xB3,0x6E,
+    0xA1,0xC4,0xF8,0x73,0x14,0x00,0x17,0x77,
+    0x5E,0x64,0xFC,0x97,0x63,0x63,0xFE,0x73,
+    0xAF,0x46,0x81,0x58,0x25,0xD8,0x58,0x99,
+    0xEB,0x04,0xEF,0x32,0x07,0x09,0xED,0x2B,
+    0xF0,0x0E,0xCB,0xBF,0xD3,0x06,0xDF,0x96,
+    0x92,0x1A,0x73,0x59,0x51,0x2E,0x21,0xEF,
+    0x4F,0x54,0xC4,0x49,0x2C,0x06,0x5A,0xAF,
+    0xF5,0xB3,0xBA,0xA0,0x89,0x32,0x74,0x04,
+    0x01,0x78,0xD7,0x16,0xC2,0xFE,0x29,0x15,
+    0x89,0xE3,0x2C,0xEB,0xE2,0xA0,0x56,0x0D,
+    0x66,0x06,0x33,0x47,0xD1,0x5B,0xC8,0xD7,
+    0xBA,0x50,0x0B,0xD4,0x15,0xA0,0x85,0x20,
+    0x6A,0xA7,0x25,0x8A,0x1C,0x23,0x59,0x51,
+    0x2E,0x21,0xF3,0xEE,0xD4,0xC4,0x49,0x2C,
+    0x16,0x71,0x05,0xAD,0x32,0x7E,0x66,0xED,
+    0x99,0x3A,0x72,0x00,0xBC,0xA2,0x8B,0x62,
+    0x75,0x69,0xF0,0x0E,0x97,0x9C,0xEB,0xE2,
+    0xA0,0x56,0x18,0xC6,0x07,0x97,0x48,0x92,
+    0x32,0x9E,0x08,0x5F,0xC9,0x30,0x78,0x7C,
+    0x42,0xFA,0x54,0x56,0x6D,0xB0,0x72,0x95,
+    0x2C,0x23,0xDF,0x4E,0x74,0xB3,0x0E,0x11,
+    0xF8,0xEC,0x72,0xBC,0x9A,0xEE,0x8F,0xB1,
+    0x09,0x3E,0xDD,0xB8,0xD0,0xCD,0xE8,0x36,
+    0x9E,0x13,0xDC,0x8C,0xED,0x0F,0x0F,0xF6,
+    0x13,0x96,0x1E,0x1D,0x1C,0xCD,0xF7,0xC7,
+    0x21,0x0C,0x2E,0xDD,0xC7,0x9B,0xE0,0xEF,
+    0x9A,0x86,0xA4,0xF4,0x8A,0xFD,0x1E,0x80,
+    0x2D,0xFF,0xEB,0x36,0x07,0x70,0x48,0x50,
+    0x09,0x68,0x88,0x91,0x44,0x36,0xFF,0x2D,
+    0x5E,0xF6,0x95,0x4E,0x2E,0x56,0xB1,0x0B,
+    0x66,0x6A,0x24,0xE2,0x3F,0xA5,0xF6,0xBE,
+    0xE2,0xC2,0x2A,0xA4,0x6C,0x3D,0x3B,0xFD,
+    0x57,0xDC,0xCA,0xE3,0x92,0x46,0x0E,0x83,
+    0x64,0x38,0xA2,0x9F,0x1E,0x0D,0xAE,0xE8,
+    0xD2,0x8F,0xBE,0x5F,0x99,0xB1,0xF0,0x4E,
+    0x1A,0xFA,0x24,0xEB,0x72,0x2B,0x8F,0x71,
+    0x22,0x2F,0x2E,0xD2,0xBC,0x09,0xC2,0x24,
+    0x82,0xBF,0x19,0x0F,0x87,0xEB,0xD6,0x60,
+    0x41,0x66,0xDD,0xDE,0xDE,0x61,0x26,0x82,
+    0x49,0x4C,0xA2,0x8C,0x24,0xDB,0x64,0xFA,
+    0xA6,0xB3,0xF5,0x38,0xA4,0x27,0xDB,0x83,
+    0xC1,0xED,0x9C,0x6B,0x7A,0x5C,0xBA,0x58,
+    0xB5,0x41,0x56,0x01,0x82,0x6F,0x8E,0x5F,
+    0x37,0xCE,0xC3,0x5E,0x23,0x98,0xD6,0x96,
+    0x4F,0x68,0xAF,0x73,0x83,0xC2,0x4C,0x76,
+    0xFF,0x40,0x0C,0x32,0xA1,0x38,0x9D,0xCA,
+    0x68,0x5C,0x13,0x48,0xFB,0xFD,0x5B,0xAB,
+    0x55,0x5C,0x14,0xA1,0xC0,0x50,0x3B,0x24,
+    0x99,0x63,0x23,0x2F,0x16,0x0A,0x19,0x24,
+    0x57,0x85,0x38,0x78,0xC8,0xB3,0x98,0xC6,
+    0xAE,0x52,0x80,0xEA,0x1A,0xFA,0x24,0xC4,
+    0x0D,0x07,0x1A,0x1E,0x70,0x93,0xA6,0xF9,
+    0x6B,0xC9,0x33,0x7B,0xC0,0x43,0x47,0xBE,
+    0x2E,0x48,0xE5,0x0C,0x05,0xC1,0xB1,0x2A,
+    0x48,0xDE,0xD7,0x32,0x28,0x0E,0x42,0xF6,
+    0x87,0x6C,0x7B,0x12,0x10,0x68,0x72,0x6D,
+    0x02,0x80,0x66,0xDA,0xD4,0xCB,0x94,0x6B,
+    0x22,0xF2,0x51,0xE0,0x28,0x6A,0xBF,0xFB,
+    0x1C,0x8F,0x50,0xCD,0x82,0x32,0x86,0x1E,
+    0x09,0xD6,0x09,0x56,0x14,0x95,0x39,0xDC,
+    0x2D,0xF0,0x00,0x00,0x13,0x50,0x4E,0x88,
+    0xB7,0xB6,0x42,0x46,0x9C,0x28,0x39,0x3F,
+    0x81,0x6F,0x5D,0xBD,0x33,0x01,0xED,0x14,
+    0x6B,0xD3,0x70,0xD1,0x7E,0xDF,0xFF,0xC9,
+    0x00,0x00,0x0B,0xA8,0x16,0x73,0xCF,0xEC,
+    0x52,0x83,0x3C,0x40,0x02,0xA6,
+
+    /* Access unit 5 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x21,
+    0xFF,0x84,0x31,0x84,0x63,0x04,0x93,0x45,
+    0x22,0x01,0x00,0x80,0x3E,0x1F,0x0F,0xD2,
+    0x41,0x81,0x68,0xF8,0x34,0xC1,0xA0,0xD5,
+    0xE6,0x7D,0xA6,0xE4,0xED,0xFF,0x1B,0xC7,
+    0xBB,0x14,0x3C,0x86,0xF0,0x18,0x4A,0xAA,
+    0x7E,0x40,0x63,0xF4,0xBA,0x76,0x8A,0x4F,
+    0x3A,0x0D,0x9D,0x93,0xA8,0x4A,0x63,0x28,
+    0x57,0xB8,0x65,0x6D,0x3B,0xFA,0x56,0xFB,
+    0xF9,0xD9,0x3B,0xB3,0x64,0x96,0xF4,0x5E,
+    0xD5,0x5B,0xC5,0xEF,0xB1,0x03,0xA7,0xE4,
+    0x9D,0x65,0x44,0x42,0x68,0xF4,0x8E,0x3C,
+    0xCE,0x08,0xC1,0x29,0xD1,0x30,0x3F,0xD0,
+    0x50,0xA3,0xB7,0xEE,0x7C,0x02,0x05,0x02,
+    0x4D,0x9D,0x98,0x3F,0xDB,0xF8,0x96,0x06,
+    0x57,0x8C,0x19,0x78,0xFA,0xB8,0x16,0x78,
+    0x13,0xBA,0xE1,0xB1,0xD1,0x01,0xF0,0x69,
+    0xB9,0xB6,0xEF,0xC9,0x27,0x70,0x8B,0x4B,
+    0x37,0x60,0x98,0x96,0x7F,0xF3,0xCE,0x0A,
+    0x69,0x66,0x0F,0xF6,0xFE,0x26,0x18,0x83,
+    0x23,0xA3,0xD2,0xA5,0x83,0x77,0xB6,0x3D,
+    0x20,0x9D,0x5D,0xCD,0x1F,0x45,0x3B,0xB6,
+    0x0B,0x34,0x45,0xB1,0x87,0x04,0xFB,0x29,
+    0x7C,0xD4,0x62,0xC5,0x2F,0xE2,0x61,0xAA,
+    0xF2,0x3A,0x3D,0x2A,0x66,0x93,0x2E,0x28,
+    0xD7,0x21,0x4E,0xAE,0x81,0xF4,0x53,0xBB,
+    0x60,0xB3,0x44,0x5A,0x90,0x00,0x1D,0x7A,
+    0x92,0x1D,0xB3,0x07,0xFB,0x7F,0x13,0x0D,
+    0x7F,0x91,0xD1,0xE9,0x53,0x38,0x9A,0x59,
+    0xD8,0xC0,0x09,0x66,0x33,0x00,0x9E,0x9D,
+    0xDB,0x05,0x9A,0x22,0xE6,0x80,0x00,0x92,
+    0x83,0x39,0x1A,0x8C,0x58,0xA5,0xFC,0x4C,
+    0x36,0x6A,0xF1,0x83,0x2F,0x20,0x7B,0x7D,
+    0x6A,0x55,0x98,0x12,0xCC,0x7A,0x02,0x05,
+    0xE7,0x90,0x0B,0x34,0xE5,0x9B,0x01,0x5A,
+    0x52,0xF8,0xEB,0x30,0x7F,0xB7,0xF1,0x30,
+    0xE3,0xEB,0xC6,0x0C,0xBC,0x82,0x8E,0x03,
+    0xCE,0xC7,0x28,0x54,0xCA,0x0B,0xFF,0x88,
+    0x3F,0x20,0x1E,0x29,0xCB,0x72,0x02,0x3E,
+    0x73,0xE7,0x79,0x2E,0xFF,0x6F,0xE2,0x61,
+    0xC8,0x2A,0x1D,0x1E,0x95,0x3C,0xF5,0x6A,
+    0x06,0x70,0xC0,0xA9,0x94,0x17,0xFF,0x10,
+    0x7E,0x40,0x3C,0x53,0x97,0x0C,0xCB,0x28,
+    0x96,0x5B,0x41,0xFA,0xC0,0xE9,0x3A,0x14,
+    0x2E,0x12,0x1E,0xC3,0x4B,0x61,0x98,0x65,
+    0xB9,0x7C,0x94,0xB0,0xE1,0x40,0x13,0xE3,
+    0x8F,0x09,0xA9,0xB1,0x06,0xF5,0xEC,0x7F,
+    0x85,0x4D,0xA9,0xF6,0x8A,0x18,0x86,0x53,
+    0x9E,0x23,0x66,0xE0,0x17,0x09,0x02,0x1B,
+    0x5C,0x89,0x32,0x09,0x5B,0x9E,0xA1,0x44,
+    0x53,0xE2,0xBF,0x3A,0xAA,0x8C,0xFC,0x70,
+    0x59,0xE6,0x81,0xE7,0xDD,0xE8,0xB2,0x8E,
+    0x65,0x4B,0x19,0xBA,0x21,0xB5,0x44,0x4C,
+    0xBB,0xC9,0xDA,0x52,0x94,0xB1,0x35,0x2A,
+    0x36,0xE6,0xA1,0x33,0xEF,0xDC,0xF6,0xC2,
+    0x2A,0x6C,0xEE,0x5C,0x18,0x3E,0xBB,0xB1,
+    0x8A,0xAA,0x2D,0xE1,0xC8,0x3A,0xBF,0x5E,
+    0xAE,0xB6,0xAF,0x28,0x9C,0x39,0x91,0xD6,
+    0x85,0x20,0xFB,0x94,0x45,0x36,0x22,0x5E,
+    0x68,0xA7,0x29,0xE3,0x67,0x24,0xC2,0x1A,
+    0xB7,0xB6,0x2E,0x32,0x9E,0x48,0x27,0xC8,
+    0xE3,0x40,0x39,0x29,0x1B,0x85,0x17,0xC1,
+    0x7E,0xA6,0x8E,0x85,0x54,0x56,0x7D,0x7D,
+    0x78,0x5F,0x16,0x3D,0xAC,0xD1,0x28,0x4B,
+    0x94,0x1B,0x5B,0xF4,0x67,0xE9,0x23,0x3C,
+    0x2C,0x05,0xFD,0x1C,0xCD,0xA6,0x46,0x62,
+    0x81,0x38,0xAD,0xE3,0x56,0x5B,0xC5,0x95,
+    0x93,0x39,0xC1,0x2F,0x56,0xA3,0x9D,0xD7,
+    0x17,0x35,0x00,0x7F,0x98,0xFA,0x68,0x82,
+    0xD2,0xC0,0x4C,0xE4,0x0D,0x20,0xD8,0x21,
+    0xD0,0xF6,0xEA,0x1F,0xE2,0x9B,0x6C,0x93,
+    0xEB,0xDE,0xCD,0xCA,0x5A,0xA2,0x81,0xDF,
+    0x2A,0x6A,0x95,0x9E,0x6E,0x02,0x86,0x18,
+    0x34,0xF0,0x54,0x83,0x25,0x2D,0xB7,0x3E,
+    0xDA,0x6F,0x16,0xC0,0xCC,0xEE,0x64,0x9A,
+    0x6F,0xAF,0x9C,0x00,0xA0,0xA1,0xA2,0xAD,
+    0x7F,0x96,0x0C,0xB0,0xDB,0x6F,0xAB,0x59,
+    0x3F,0x17,0xDE,0x8E,0x01,0xFF,0x98,0x55,
+    0x7C,0x8A,0x1A,0x3F,0xED,0x8D,0xD2,0xAB,
+    0x47,0x0F,0xF2,0x63,0xB5,0x1D,0x95,0x0A,
+    0x28,0x20,0x39,0xBE,0xF3,0xF2,0xE0,0x6C,
+    0x01,0x97,0x52,0x21,0x27,0xD3,0x2A,0xCC,
+    0x04,0x58,0xC7,0x76,0x2C,0x51,0xB4,0x85,
+    0x0F,0x11,0x7C,0x16,0x88,0xE4,0x36,0x40,
+    0x2B,0x8B,0xDE,0xE2,0x64,0x5F,0x4E,0xC4,
+    0xE6,0x16,0x00,0x01,0xE3,0x4C,0x1B,0x1C,
+    0xE5,0x76,0x1F,0xA9,0xE8,0x59,0xBE,0x07,
+    0xE5,0x01,0xDA,0x3D,0x86,0x48,0x22,0xF0,
+    0x00,0x00,0x11,0xB0,0x08,0x17,0xDA,0x71,
+    0x05,0x5E,0x70,0x28,0x60,
+
+    /* Access unit 6 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x29,
+    0xFF,0x84,0x31,0x84,0xC3,0x04,0x16,0x8F,
+    0x0B,0x0A,0x8A,0x8A,0x0A,0x0A,0x70,0x06,
+    0x85,0xC0,0xF6,0x83,0xFA,0x36,0x11,0x38,
+    0x40,0x0D,0x80,0x26,0x95,0x2E,0x9E,0xF7,
+    0xDC,0x3A,0xF2,0xEA,0x97,0x28,0xF3,0x18,
+    0x31,0x80,0x09,0x92,0x9E,0x10,0x0B,0x69,
+    0xF6,0x0C,0xC2,0x01,0xB6,0x3D,0xFE,0xD9,
+    0x18,0x1D,0x98,0x2B,0xD8,0x89,0xDE,0xA0,
+    0xA3,0x93,0x7C,0x23,0xD8,0x29,0xA7,0xBD,
+    0xF7,0x0E,0xBC,0x1E,0x90,0x1D,0x6C,0x6C,
+    0x94,0x32,0xA4,0xC0,0x80,0x66,0x23,0xBC,
+    0x32,0x4E,0x74,0xAC,0x58,0x22,0x94,0x95,
+    0xF9,0x8C,0xB8,0x7B,0xA7,0xBD,0xF7,0x0E,
+    0xBC,0xEA,0xD1,0x11,0x6D,0x55,0x01,0xED,
+    0xAE,0x77,0xE5,0xF2,0x09,0x40,0x87,0x03,
+    0xCD,0x73,0x1A,0x7B,0xDF,0x70,0xEB,0xD7,
+    0x56,0xD1,0x16,0xD5,0x50,0x34,0x4B,0xC0,
+    0x01,0x67,0x41,0xC8,0x00,0x1C,0x14,0x91,
+    0x53,0xDE,0xFB,0x87,0x5F,0x01,0xB6,0x88,
+    0xB6,0xAA,0x82,0x82,0x24,0x65,0x4C,0xEF,
+    0x7C,0x80,0x00,0x7D,0x57,0x37,0x4F,0x7B,
+    0xEE,0x1D,0x7C,0x5F,0x20,0x3A,0xD8,0xD9,
+    0x34,0x36,0x01,0xA0,0x4D,0xFF,0x54,0x01,
+    0x16,0x98,0x8A,0x9E,0xF7,0xDC,0x3A,0xF9,
+    0x64,0x4E,0x75,0xB1,0xB2,0x6F,0x33,0x9B,
+    0x1E,0x52,0x79,0x38,0x02,0x02,0xA8,0x54,
+    0x67,0xD8,0x15,0x4D,0x3B,0x64,0x9C,0xEB,
+    0x63,0x64,0xEA,0xF9,0x6D,0x2A,0x70,0x49,
+    0xD0,0x7E,0xE9,0x24,0x32,0xE6,0x26,0xC2,
+    0x7F,0x62,0xC9,0xF1,0xF8,0x17,0x47,0x0A,
+    0xCE,0x05,0x48,0x3A,0xFF,0xF2,0x51,0xA3,
+    0x5A,0xA9,0xD1,0xF8,0xDB,0x8F,0x20,0x11,
+    0xDA,0xC4,0xD2,0xF3,0x69,0x1A,0xA0,0xDA,
+    0x70,0xD3,0x3F,0xE1,0x5C,0x4E,0x8C,0xE1,
+    0x34,0x0F,0xA9,0x41,0x0D,0xFF,0x3D,0x7B,
+    0x55,0xC1,0xC5,0x41,0x96,0x10,0x3B,0xAC,
+    0x85,0x8B,0x78,0xC9,0x9B,0x39,0xD2,0x39,
+    0x97,0x4F,0x24,0xBC,0x73,0xD0,0xEF,0xDD,
+    0x4D,0xE7,0x44,0xBA,0xE7,0xFF,0x05,0x32,
+    0x88,0x3D,0x19,0x54,0x47,0x76,0x52,0xD0,
+    0x74,0xC2,0x35,0xB6,0xC4,0x90,0xFA,0x22,
+    0x23,0x9D,0x7F,0x37,0x59,0xBA,0x93,0x0C,
+    0x63,0xDE,0xF1,0x1C,0x76,0x81,0xF4,0xB8,
+    0x02,0x2A,0x46,0x26,0x77,0x36,0x5B,0xB7,
+    0x65,0xA2,0x7F,0xA2,0x63,0xCF,0x92,0xEF,
+    0xFF,0x0D,0xB2,0xFB,0x71,0xFA,0xB4,0x6F,
+    0x99,0x7D,0x31,0xF6,0x55,0xB6,0x03,0x2E,
+    0xC0,0x98,0x32,0x8A,0x11,0xCB,0x68,0x4A,
+    0x88,0x99,0xCE,0x05,0x66,0x81,0x22,0xF0,
+    0xA1,0x8A,0x31,0xDE,0x4D,0x68,0xC2,0xE6,
+    0x50,0xF7,0xAE,0xC1,0x92,0x58,0xD1,0x78,
+    0x5D,0x51,0x57,0xBE,0x4B,0xE3,0xC3,0x50,
+    0x26,0xC8,0x7A,0x42,0x30,0x5B,0x03,0x19,
+    0x39,0x97,0x2C,0x03,0x28,0x03,0x2B,0xD0,
+    0xF4,0x4C,0x01,0x71,0x4F,0x8F,0xAE,0x5B,
+    0xFF,0x2C,0x17,0xA9,0x6E,0xDC,0xB0,0x03,
+    0x4E,0x70,0x29,0xC0,0xBF,0x1B,0xBA,0x25,
+    0xC7,0x36,0x31,0xEA,0x20,0x00,0x0E,0x68,
+    0x53,0x9E,0x5B,0x5A,0x40,0x8A,0x19,0x62,
+    0xB5,0x00,0x04,0x94,0x08,0x8F,0x16,0x00,
+    0x06,0xD4,
+
+    /* Access unit 7 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x31,
+    0xFF,0x84,0x31,0x85,0x63,0x04,0x84,0x48,
+    0x03,0x51,0xA0,0xD0,0x68,0x34,0x1A,0x5C,
+    0x83,0x80,0xC8,0xF6,0x33,0x4D,0xF8,0xC8,
+    0x02,0x16,0x66,0xC6,0x02,0x1F,0x8F,0xA7,
+    0x64,0x4D,0x15,0x01,0x10,0xA3,0x5E,0x34,
+    0x0E,0xB6,0xFE,0x8D,0x9B,0x18,0x56,0xA8,
+    0x59,0x87,0xF6,0xD5,0x1E,0x51,0x77,0xBB,
+    0xF4,0xED,0x79,0x22,0xFC,0xE9,0x35,0x16,
+    0xBF,0xC1,0x45,0x80,0x70,0x19,0xE7,0x83,
+    0x46,0x07,0x9F,0x27,0xFC,0xEF,0x6B,0x6F,
+    0xD0,0xF1,0xAD,0x21,0xBD,0xAB,0x08,0x24,
+    0x54,0x55,0x8E,0xC8,0x90,0x19,0x6A,0xFE,
+    0xDA,0xEB,0xD5,0x3E,0x37,0x90,0x96,0x71,
+    0x5D,0x5D,0xC9,0x2B,0x54,0x2C,0xC7,0x80,
+    0x2C,0xB6,0x07,0x85,0xF0,0xA1,0x6D,0x79,
+    0x23,0x0C,0xC4,0x53,0xEA,0xFF,0x18,0x7D,
+    0x94,0xF6,0xCB,0x9B,0x3B,0xDA,0xDB,0xF4,
+    0x3F,0xC1,0xBB,0xCF,0x6A,0xC0,0x71,0xD2,
+    0xDB,0x86,0x10,0x0C,0x0C,0xB5,0x7F,0x6D,
+    0x95,0x18,0x81,0x90,0x87,0xE8,0xA1,0x77,
+    0x24,0xAD,0x50,0xB3,0x2D,0x30,0xB2,0xD8,
+    0x1E,0x18,0xE9,0x85,0xB5,0xE4,0x8C,0x58,
+    0x51,0x4F,0xAC,0x04,0xA9,0x4F,0x7D,0x53,
+    0x0B,0x9F,0xBD,0xAD,0xBF,0x44,0x41,0xE9,
+    0xBC,0xF6,0xAC,0x0A,0xB5,0x2D,0xB8,0x61,
+    0x00,0xC0,0xCB,0x57,0xF6,0xDA,0x54,0xF6,
+    0xAE,0x03,0x54,0x4D,0xDC,0x92,0xB5,0x42,
+    0xCC,0xDB,0xA2,0xCB,0x60,0x78,0x69,0x5D,
+    0xBD,0xA9,0x64,0x65,0x1A,0x82,0xF9,0xE8,
+    0xA5,0x21,0x14,0x42,0xD4,0x8B,0x9D,0xED,
+    0x6D,0xFA,0x23,0x33,0xDD,0xE7,0xB5,0x60,
+    0x8D,0x2A,0x8A,0xB1,0xD9,0x17,0x6E,0xCF,
+    0x66,0x0B,0xC0,0x30,0xC1,0xE8,0x06,0xF3,
+    0x6B,0xB9,0x25,0x6A,0x85,0x99,0xF4,0x5E,
+    0x76,0xC0,0xF0,0xDC,0x25,0x3B,0x5E,0x48,
+    0xCA,0x68,0x4D,0x45,0xB0,0x7B,0xFE,0x00,
+    0x71,0xAE,0x19,0x40,0x7B,0x6F,0xD1,0x27,
+    0x2D,0x21,0xBD,0xAB,0x07,0xE9,0x54,0x55,
+    0x8E,0xC8,0xBB,0x76,0x7B,0x30,0x5E,0x69,
+    0x35,0x89,0x80,0x0D,0x60,0x77,0x72,0x4A,
+    0xD5,0x0B,0x34,0x2C,0x0B,0x2D,0x81,0xE1,
+    0xBA,0x56,0xF6,0xA5,0x91,0x96,0xED,0x14,
+    0xFA,0xC0,0x82,0x9D,0xC2,0xEC,0xB3,0xEC,
+    0xEF,0x6B,0x6F,0xD1,0x27,0x2D,0x21,0xBD,
+    0xAB,0x07,0xE9,0x54,0x55,0x8E,0xC8,0xBB,
+    0x76,0x7B,0x30,0x5E,0x6A,0x95,0x8A,0x80,
+    0x13,0xE6,0xF7,0x72,0x4A,0xD5,0x0B,0x34,
+    0x44,0xBC,0xED,0x81,0xE1,0xC2,0x2E,0xF6,
+    0xA5,0x91,0x98,0x25,0x14,0xFA,0xC0,0x97,
+    0x47,0xAD,0x11,0xC1,0xD9,0x40,0x7B,0x6F,
+    0xD1,0x36,0x22,0x79,0xBD,0xAB,0x09,0xB2,
+    0x54,0x55,0x8E,0xC8,0xD6,0x19,0x6A,0xFE,
+    0xDB,0x8B,0xF4,0x7E,0xC0,0x81,0x69,0x41,
+    0xB1,0xAD,0x92,0x26,0xF1,0x82,0xBB,0x8D,
+    0xC1,0x41,0x89,0x0A,0x6B,0xDF,0xC7,0x8E,
+    0x95,0xB1,0xA0,0x27,0x41,0x5F,0x13,0x2C,
+    0xC8,0x89,0xF7,0x58,0x4F,0xA6,0x36,0x3B,
+    0x8B,0x39,0x6E,0xAA,0xA4,0x30,0xF3,0x6B,
+    0xA6,0xCB,0xED,0x92,0xDF,0x88,0xFB,0x72,
+    0xE6,0xBD,0xB7,0xE5,0x17,0xA7,0xBB,0x5D,
+    0x03,0xEA,0x2D,0x86,0x47,0xF0,0x64,0x20,
+    0x98,0x70,0x33,0x77,0x86,0xCA,0x1D,0xF5,
+    0x9A,0x1D,0xFC,0xE7,0xDF,0xFF,0x78,0xEE,
+    0xDB,0x47,0x8D,0xA7,0x52,0xDB,0x9C,0xA7,
+    0xA9,0x78,0x3F,0x4C,0x1B,0x7C,0xAA,0x1B,
+    0xEA,0x36,0x03,0xB2,0x38,0x07,0x9C,0xE6,
+    0x49,0x37,0xFF,0xFF,0xFF,0xFB,0x2F,0x24,
+    0x80,0xE1,0x4E,0x45,0x79,0x94,0x4E,0xA5,
+    0xF6,0xC7,0xF8,0x7F,0x4D,0x24,0x6E,0x07,
+    0x3E,0xC5,0x64,0xAC,0xD6,0x40,0x70,0xA9,
+    0x2F,0x1B,0x50,0x84,0xCE,0xB6,0x01,0xB2,
+    0xC4,0xA3,0x7B,0x0C,0x2D,0xFA,0xEA,0x19,
+    0x1E,0x4B,0xCF,0xD8,0xA2,0x66,0x01,0x07,
+    0xE6,0xE5,0x0C,0x3D,0xCE,0xB3,0xD5,0x87,
+    0x32,0x3C,0x7E,0xAC,0x14,0x70,0xDD,0xB4,
+    0x5B,0xAE,0xEE,0xCA,0x2A,0x9C,0x53,0xB5,
+    0x77,0xB3,0x43,0x1C,0x4B,0x3A,0x0B,0x8F,
+    0x76,0xB1,0xCA,0x9E,0xD5,0xE0,0x2C,0x18,
+    0xD4,0xE7,0x86,0x38,0x7B,0xF8,0xF4,0x6B,
+    0x40,0xA6,0x6F,0x4D,0x31,0x2F,0x7D,0x20,
+    0x30,0x12,0xC3,0x2C,0x27,0xF3,0xF1,0x77,
+    0x41,0xE0,0xDD,0x48,0x54,0xB9,0x1E,0x8B,
+    0x46,0xE5,0xCE,0xAA,0x11,0xFC,0xF8,0xD9,
+    0xBC,0x1C,0x98,0x6B,0x27,0xDD,0x44,0xEE,
+    0x4A,0x7C,0xC1,0x9D,0xD9,0x93,0x9C,0xC8,
+    0x71,0x48,0xAA,0x7B,0x8F,0x2E,0x7E,0x33,
+    0x25,0xF3,0x4E,0x77,0x2E,0xE3,0x36,0x84,
+    0x0D,0x4D,0x32,0x92,0xAD,0xF5,0x29,0x2C,
+    0xBA,0xE1,0x12,0xE0,0x32,0xEE,0x14,0x34,
+    0x72,0xA1,0xE7,0x0B,0x7A,0x81,0x2A,0xDA,
+    0x6B,0x2F,0xEC,0x4C,0x91,0x8A,0xE1,0x9A,
+    0xE1,0x32,0x02,0xCB,0x87,0xB5,0xD7,0xEA,
+    0x64,0x08,0xE3,0x55,0x99,0x8F,0x56,0x32,
+    0xBF,0x11,0x5C,0xF7,0x14,0xA8,0xD7,0x7B,
+    0x5B,0xC1,0xB6,0x9A,0x87,0x3F,0x15,0x25,
+    0x07,0x00,0x46,0x69,0x38,0x21,0x27,0xB0,
+    0x02,0x22,0xB9,0x20,0xE9,0x11,0xB5,0x1A,
+    0x31,0x35,0xF7,0x00,0x56,0x6B,0x75,0x37,
+    0xBE,0xBE,0x65,0xE2,0x4A,0x19,0x0A,0x80,
+    0x32,0xB3,0x2C,0x80,0x5E,0x68,0x6B,0x61,
+    0x3A,0x44,0xFD,0x28,0x68,0xCA,0x2C,0xBB,
+    0x2E,0x0E,0x1E,0xB4,0x0E,0xA7,0xFF,0x3C,
+    0xD6,0xA4,0x00,0xCC,0x80,0x53,0x7A,0xC8,
+    0x89,0xF0,0x99,0x90,0xC4,0xA5,0x9E,0x64,
+    0x01,0x49,0x04,0xA6,0x3C,0xA5,0xB0,0x24,
+    0x03,0xF2,
+
+    /* Access unit 8 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x39,
+    0xFF,0x84,0x31,0x85,0xC3,0x04,0x8D,0xC4,
+    0x21,0xB0,0xD8,0x68,0x34,0x19,0x0C,0xC9,
+    0xC1,0xC0,0xB8,0xF4,0x63,0xC2,0xB7,0xB4,
+    0x02,0x5F,0xE9,0xE2,0x40,0x09,0xB2,0x2A,
+    0x93,0x9B,0x91,0xC8,0x70,0x74,0xD5,0xEF,
+    0xE6,0x78,0x49,0x5D,0x71,0x53,0xAB,0xEA,
+    0x5D,0xCB,0xFF,0xCB,0x1B,0xDD,0xE3,0x14,
+    0x14,0x62,0xD2,0xEA,0x49,0xED,0xF7,0x29,
+    0x71,0x38,0xAB,0xEB,0x15,0x21,0x39,0x62,
+    0x43,0xF4,0x80,0xA3,0x5B,0x45,0xAA,0xA5,
+    0x84,0x9B,0xCB,0x23,0x0C,0x6F,0x0B,0x05,
+    0x72,0xC3,0x12,0x6B,0x6B,0x98,0xC6,0xBB,
+    0xD5,0x73,0x3A,0x98,0xA8,0xB3,0x31,0x90,
+    0x52,0x50,0xDB,0x9B,0xD0,0x95,0xAD,0xB5,
+    0x70,0x69,0xEF,0xE8,0x76,0x0C,0xBE,0xAF,
+    0xF5,0xF0,0xA5,0xD2,0x2B,0xE5,0x10,0x16,
+    0x2E,0x9F,0x57,0x99,0x05,0x25,0x0D,0xB9,
+    0xE1,0x87,0x2D,0x4B,0x8F,0x38,0x09,0x0F,
+    0x15,0x6E,0x8F,0x0B,0x08,0xF7,0xCA,0x49,
+    0xD3,0x30,0x3E,0x23,0xB5,0x91,0xE6,0x41,
+    0x49,0x43,0x7F,0x19,0xC0,0x00,0xAD,0x2E,
+    0x3D,0x17,0xBD,0x88,0x35,0xCA,0xDC,0x4B,
+    0x29,0xC0,0x12,0xC2,0x0A,0xF2,0xB2,0xF9,
+    0x1A,0x47,0x86,0x6F,0xBA,0x70,0x35,0x70,
+    0x02,0x49,0x8D,0x95,0x27,0xF6,0xF3,0x49,
+    0x56,0x53,0xFB,0xAA,0xAC,0xCC,0x2C,0x39,
+    0x48,0x11,0xC9,0xC8,0xF3,0x20,0xA4,0xA1,
+    0xC4,0x58,0xC0,0x04,0x71,0xF8,0x38,0xF6,
+    0x39,0x9B,0xAE,0xB8,0xE4,0xB9,0x94,0x17,
+    0x2C,0xB6,0x25,0xE7,0xB7,0x27,0x23,0xCC,
+    0x82,0x92,0x87,0x13,0xA9,0x07,0x93,0x71,
+    0xEB,0xDD,0x27,0x04,0xAE,0xC8,0xE5,0xDF,
+    0x94,0x1B,0x2D,0x9F,0x66,0x1A,0x67,0x52,
+    0x7C,0xDC,0x60,0x5A,0x87,0x13,0xB9,0xF7,
+    0xBD,0x6D,0xAE,0x01,0xA3,0xD3,0x2E,0x99,
+    0x2D,0xC3,0xFB,0x35,0x67,0x3E,0xC1,0x4F,
+    0xB1,0x47,0xF7,0x5C,0x10,0x28,0xF6,0x3C,
+    0xCA,0x7E,0x2F,0x4E,0xBC,0xFD,0x18,0x81,
+    0x2B,0x34,0x11,0xF4,0xCF,0x31,0xC0,0x5E,
+    0x34,0x9C,0x7A,0x04,0xA7,0x02,0x70,0x6A,
+    0xD4,0xA0,0x98,0xD2,0xF5,0x4E,0x68,0x8C,
+    0x5F,0x61,0xDD,0x58,0xBA,0x0D,0x79,0xD5,
+    0x40,0x6D,0xBB,0xB8,0x80,0x30,0x28,0x72,
+    0xA1,0x94,0x24,0xE0,0xFF,0xFD,0xE7,0x6D,
+    0x9F,0xFC,0x87,0xF2,0xCA,0x41,0x35,0xC0,
+    0x7A,0x5F,0x8C,0x85,0x64,0x5E,0x5C,0xE3,
+    0x98,0x6A,0xB3,0x57,0xC8,0xDF,0x17,0x4A,
+    0xCC,0x67,0xB3,0x04,0x52,0xFC,0x46,0x54,
+    0x92,0x0E,0x11,0xFF,0x76,0xB2,0x24,0x50,
+    0x98,0x08,0x28,0xAF,0x1D,0x1D,0x30,0xAA,
+    0x29,0x82,0x16,0xA7,0x42,0xE5,0xD8,0x26,
+    0xF6,0xFE,0x14,0x84,0x5B,0x4F,0x2F,0xDC,
+    0xEE,0x1B,0x5F,0x4B,0x0A,0x67,0x52,0xFA,
+    0x5A,0xBC,0x29,0xA3,0x11,0xDE,0x8E,0x4D,
+    0x5F,0xCF,0xD4,0x24,0x4F,0x20,0x35,0x12,
+    0x41,0x2A,0x9D,0x1C,0xAB,0xB5,0x19,0x01,
+    0xB7,0xF5,0x11,0xEA,0xB6,0x45,0xAA,0x76,
+    0xA7,0x4F,0xE7,0x76,0x11,0x06,0x6B,0x16,
+    0x78,0x64,0x82,0xBB,0x7B,0x2D,0xBC,0x26,
+    0x9F,0xDE,0xAB,0xBB,0xDE,0xC1,0xD7,0xF6,
+    0x2A,0x42,0xEC,0x21,0x22,0x8C,0xC0,0xA9,
+    0xF2,0x1A,0x02,0x1E,0x32,0x18,0x00,0xAB,
+    0xFA,0xBA,0xFE,0xC0,0x3B,0xE9,0x55,0x18,
+    0x80,0xFF,0x8E,0xAA,0xB7,0x86,0x9C,0x65,
+    0x45,0xA5,0xBC,0xE8,0x3B,0x5D,0xFC,0x49,
+    0xB2,0xB2,0xFC,0x36,0x10,0xC8,0xE8,0x76,
+    0x88,0x0A,0x75,0xB3,0x10,0x56,0x51,0x59,
+    0x5F,0x8F,0x31,0x21,0x10,0x4A,0x03,0x81,
+    0x59,0x5A,0xA2,0x70,0x8F,0xC8,0xA1,0x0D,
+    0x9B,0x6B,0xE5,0xDC,0xF3,0x99,0x9F,0x98,
+    0x20,0x64,0x1C,0x7D,0x4C,0x8B,0xA8,0x36,
+    0xAD,0x52,0x1B,0xEF,0x53,0xF6,0x83,0xC6,
+    0x72,0x92,0xC7,0x00,0x01,0x27,0x4B,0xD8,
+    0x5E,0x88,0xD3,0xC9,0x5E,0x3A,0x2A,0x6C,
+    0x32,0x60,0x04,0x07,0xF1,0xB7,0x23,0x01,
+    0xA8,0x15,0x8C,0x04,0x74,
+
+    /* Access unit 9 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x41,
+    0xFF,0x84,0x31,0x85,0xC3,0x04,0x8A,0x02,
+    0x60,0xF0,0x70,0x38,0x1A,0x0D,0x06,0xC6,
+    0x82,0x40,0x78,0xF4,0x63,0xC1,0x27,0x28,
+    0x95,0xF6,0x64,0xAB,0x1F,0x5A,0x9E,0x61,
+    0xC5,0xCE,0xD2,0x54,0x8A,0x82,0xB2,0x28,
+    0xD8,0x02,0xE5,0x83,0x20,0x59,0xB3,0x02,
+    0xD8,0x4B,0x49,0x44,0x8B,0xFA,0x51,0x8B,
+    0xF3,0xB2,0x71,0xB9,0xA3,0x5A,0xE5,0x3C,
+    0x02,0x69,0xEE,0xB8,0xA2,0x1E,0x32,0xFC,
+    0x06,0x61,0xD0,0xBF,0xE5,0x5C,0x66,0xCB,
+    0x95,0xA6,0x00,0x0C,0x04,0x0B,0xA8,0x4A,
+    0xBF,0xED,0x25,0x01,0x67,0xA7,0x8C,0x40,
+    0x87,0x00,0x02,0x11,0xF0,0x88,0xBF,0x22,
+    0xA7,0x9C,0x4E,0x77,0x34,0xF2,0xB8,0x00,
+    0x00,0x24,0x58,0x38,0xF5,0x1C,0xF3,0xCA,
+    0xF4,0xEB,0xF3,0x4F,0x4A,0x80,0x00,0x01,
+    0x48,0xF8,0xFF,0xB4,0x62,0x64,0x4B,0x61,
+    0xF8,0xE8,0xBF,0xE4,0x00,0x04,0xBF,0xC0,
+    0xB2,0x1E,0x0F,0xB6,0x82,0x4F,0xF1,0xD1,
+    0x7F,0xD8,0x00,0x0C,0xF6,0x14,0x24,0x5B,
+    0xCF,0xD1,0x40,0x9F,0x86,0xEA,0xD6,0xF0,
+    0x81,0x68,0x4A,0x5E,0xFC,0xAC,0xB3,0x51,
+    0xE6,0x7D,0xDC,0x14,0x4F,0xBD,0xDE,0x4F,
+    0xE2,0x47,0x0A,0x41,0x70,0x06,0xDD,0x74,
+    0x41,0x4F,0xF2,0x41,0x6A,0x05,0x9A,0x9D,
+    0x4A,0xE4,0x23,0x72,0xE5,0x47,0x53,0x88,
+    0x17,0x76,0x84,0xF1,0x21,0x55,0xC4,0xEE,
+    0xC0,0xC6,0xE7,0x04,0xAC,0x29,0xBA,0x08,
+    0x96,0xA8,0xDE,0xCF,0xFE,0xF9,0x1C,0x9F,
+    0x7F,0xAE,0x83,0x13,0xE4,0x6B,0xF3,0x48,
+    0xF5,0x28,0xFC,0x11,0xFD,0xFD,0x2A,0xAB,
+    0x0B,0x00,0x2D,0x04,0xD4,0x2F,0x28,0xE0,
+    0xA1,0x11,0x2D,0x07,0x49,0xF2,0x98,0x68,
+    0xF4,0x21,0x50,0x6D,0x91,0x1E,0x0B,0x73,
+    0x60,0x2F,0x28,0x3F,0xF8,0xDA,0x81,0xFF,
+    0x0F,0xBD,0xB1,0x4C,0x67,0x60,0x72,0x50,
+    0xC9,0x56,0x61,0xD5,0x50,0x87,0xFB,0x0F,
+    0xC3,0xB4,0x26,0xFD,0xED,0xE6,0xB1,0xEA,
+    0x28,0x55,0xBA,0x83,0x96,0xFF,0xC9,0x3C,
+    0x4E,0xF2,0x63,0x3F,0x52,0xAF,0x4C,0x29,
+    0xD7,0x41,0x7A,0x8A,0x78,0xF9,0x55,0xCF,
+    0x04,0x9F,0x76,0x19,0x55,0x03,0xA9,0x8D,
+    0x84,0x31,0xA3,0x6A,0x01,0xA1,0x6D,0x71,
+    0xC4,0xAD,0x4B,0x8B,0x19,0x1D,0xD3,0xE1,
+    0xBF,0x69,0x71,0x22,0x98,0x9E,0x64,0xA1,
+    0x7C,0x3E,0xB7,0x8D,0xCC,0x35,0x95,0x2A,
+    0x6C,0x6A,0x1D,0x88,0xA6,0x84,0x01,0x18,
+    0x53,0x15,0x0B,0x62,0x4A,0xD8,0xF8,0x2C,
+    0xF0,0xCC,0x08,0x1F,0x48,0xB8,0x6F,0x10,
+    0xD0,0x08,0x58,0x43,0xCD,0xF7,0xDA,0x0C,
+    0x6C,0x8E,0x8C,0x68,0x4D,0xE1,0x44,0xF3,
+    0xDD,0x52,0x3C,0x25,0x9A,0xF1,0x45,0xB6,
+    0x06,0xFA,0x18,0x23,0xB8,0x65,0x66,0x03,
+    0x95,0x9B,0x3F,0xA4,0xE0,0x9F,0xB3,0x25,
+    0xB6,0x52,0xB2,0xA8,0x9A,0x8F,0xFE,0xEE,
+    0xC4,0x9B,0x78,0xD7,0xE6,0xE1,0xD3,0x7D,
+    0x11,0x9F,0x10,0x06,0xC2,0x2B,0x30,0xF4,
+    0x83,0xCE,0x19,0xA4,0x74,0x01,0x18,0x7F,
+    0xEF,0x8E,0x54,0xF0,0x26,0x20,0x15,0x33,
+    0xD9,0xBA,0xAB,0x14,0x08,0x08,0x00,0x8D,
+    0xBC,0xA0,0x1D,0x90,
+
+    /* Access unit 10 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x49,
+    0xFF,0x84,0x31,0x86,0x63,0x04,0x84,0x41,
+    0x20,0x80,0x38,0x1C,0x0C,0x06,0x03,0x60,
+    0x02,0x40,0x98,0xB8,0x32,0x8D,0x1B,0x30,
+    0xD5,0x77,0x87,0x00,0x41,0xDD,0xBD,0xB7,
+    0x15,0x24,0x67,0x09,0xA6,0xA3,0x3B,0xD0,
+    0xE8,0x00,0x38,0xDC,0xBF,0x38,0x5E,0x95,
+    0xD0,0xC0,0x00,0xC2,0x3A,0x1C,0xE2,0x48,
+    0x87,0x00,0x00,0x45,0x5D,0xCB,0x32,0xFA,
+    0x00,0x00,0x06,0x2E,0x7B,0x2E,0x66,0x40,
+    0x00,0x00,0x38,0x88,0x61,0x75,0x12,0x00,
+    0x01,0x05,0x8A,0x9D,0x1C,0xA8,0x00,0x03,
+    0x17,0x97,0x37,0x9B,0xE0,0xF1,0xC2,0xB6,
+    0xB9,0xD7,0x04,0xEB,0xAA,0xA6,0xFF,0x61,
+    0xD2,0x0F,0x75,0x02,0xF2,0x08,0x72,0x1D,
+    0xBD,0xAF,0xA6,0xCD,0xFC,0x5D,0x2E,0x5E,
+    0x99,0x60,0xB4,0x31,0x3C,0x44,0xB3,0x51,
+    0xD9,0x2F,0x93,0x46,0x02,0xC4,0xCF,0x51,
+    0x30,0xBF,0x7B,0xE5,0x28,0x73,0x0C,0x40,
+    0x80,0x03,0x9A,0x9E,0xD3,0x27,0x20,0x4C,
+    0x09,0xE9,0xD6,0xAF,0x69,0x04,0x7E,0x2D,
+    0x2E,0x4F,0x5D,0x00,0xF0,0x7C,0xCA,0x3D,
+    0x97,0xFA,0x88,0x9E,0xDA,0x02,0xF5,0x07,
+    0x9C,0x16,0x6F,0x1E,0x42,0x72,0x91,0xEB,
+    0xFA,0x45,0xD2,0x52,0x44,0x88,0xC4,0x67,
+    0x5E,0x5F,0x96,0xFC,0x9F,0x5A,0x29,0xF5,
+    0xF2,0x39,0x03,0x54,0x84,0x61,0xDC,0x67,
+    0xAF,0xFB,0x79,0x9A,0xF4,0x7E,0x45,0x4E,
+    0x84,0xD4,0x47,0x3C,0x17,0x7B,0xD9,0xD5,
+    0x27,0x85,0x3E,0x8D,0x7B,0x3C,0x1D,0x19,
+    0x58,0x0B,0xD4,0x4F,0x3B,0xE5,0xE2,0xB4,
+    0x1E,0xD1,0xFB,0xF8,0x75,0x4C,0x30,0x08,
+    0xE5,0x90,0x69,0x4B,0x07,0xEE,0x19,0xE2,
+    0xA5,0x1F,0x5B,0x52,0xD6,0xE1,0x5D,0x1C,
+    0x75,0xFA,0x28,0x1E,0x21,0x19,0x1D,0xC1,
+    0x75,0x74,0x34,0xF5,0x7A,0xE0,0x79,0x0D,
+    0xA2,0x3F,0x65,0xCA,0xDF,0xFE,0xAD,0x2C,
+    0x7E,0x99,0xBE,0x7F,0x0A,0xE0,0x00,0x1B,
+    0xEE,0x65,0x10,0x2B,0xF2,0xEA,0xE4,0x89,
+    0x06,0x61,0x16,0xC9,0x34,0x42,0xF5,0x4B,
+    0x9A,0x61,0xFE,0xB5,0xFA,0xCA,0x92,0x83,
+    0x5B,0xFB,0x43,0x6C,0x6F,0xD8,0x48,0x7C,
+    0x27,0x8E,0xB0,0x03,0x81,0x31,0xC1,0x91,
+    0x80,0x19,0x84,0x36,0xB3,0x7F,0x2A,0x7C,
+    0x10,0x26,0xA8,0x14,0xD5,0xAE,0xF5,0x1C,
+    0x25,0x7C,0x69,0xF4,0xD4,0x8E,0x44,0xFA,
+    0x85,0x57,0x84,0x24,0xB9,0x5C,0xA9,0xF7,
+    0x62,0x21,0x47,0x84,0xF1,0xA6,0x9B,0x75,
+    0xCD,0x0E,0x61,0x01,0xFB,0x25,0x5A,0x58,
+    0xF0,0x9F,0xF0,0x23,0xD7,0xDD,0xC1,0x1C,
+    0x03,0xD9,0xB9,0xDD,0x4D,0x31,0xAE,0x01,
+    0xF5,0xAD,0x49,0xF0,0x16,0x50,0xC6,0xFE,
+    0x7E,0xC9,0xB6,0x50,0xCB,0x2A,0x0C,0xD4,
+    0x25,0x67,0x6D,0xA0,0xC5,0xAD,0x33,0x87,
+    0xE0,0x02,0x58,0x14,0x0F,0x5C,0x1D,0x56,
+    0xD5,0xD0,0x53,0x52,0xE6,0xD6,0x61,0xE0,
+    0x44,0xFB,0xE1,0xF1,0x2D,0x82,0x33,0xCF,
+    0x78,0x24,0x7F,0x47,0xA6,0x7A,0x80,0x38,
+    0xE8,0xD1,0x4B,0x5D,0x4F,0x0C,0x1E,0x6E,
+    0x67,0x02,0x9E,0xE3,0x18,0x31,0xFA,0x2F,
+    0x7B,0xA5,0xD1,0x7C,0xCE,0xB8,0x05,0x95,
+    0x33,0xE9,0xEA,0x66,0x7D,0x61,0x11,0xCF,
+    0x04,0x77,0x8D,0x1A,0x76,0x66,0x20,0x0C,
+    0x98,0x12,0x49,0xF0,0x48,0x91,0x1F,0xC4,
+    0x54,0x08,0x38,0x00,0x2D,0xFB,0xC2,0x38,
+    0xE0,
+
+    /* Access unit 11 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x51,
+    0xFF,0x84,0x31,0x86,0xC3,0x04,0x84,0x41,
+    0x20,0x80,0x38,0x1C,0x0C,0x06,0x03,0x40,
+    0x40,0xE0,0x78,0xB5,0xB9,0xEE,0xBE,0x19,
+    0x70,0xCE,0xB0,0x00,0x0F,0xCB,0x27,0xBA,
+    0x09,0x18,0x05,0x85,0xA7,0xA3,0x1C,0x76,
+    0xD6,0x00,0x14,0x3D,0xBC,0xB8,0x21,0x95,
+    0x2D,0x20,0x00,0x78,0x83,0x0E,0x71,0x24,
+    0x87,0x00,0x00,0x2E,0x7D,0x81,0x73,0x22,
+    0x00,0x00,0x06,0x2E,0x7B,0x2E,0x66,0x40,
+    0x00,0x00,0x35,0xD5,0x61,0x75,0x12,0x00,
+    0x00,0xE0,0x25,0x9D,0x8F,0x58,0x00,0x02,
+    0xEE,0x63,0x19,0x02,0xB0,0x81,0x5D,0xF5,
+    0xC1,0xA6,0xCE,0x88,0xDE,0x92,0x90,0xFA,
+    0xE0,0x49,0x15,0xB1,0x25,0x21,0x3A,0x89,
+    0x54,0x4A,0x21,0xA8,0xF6,0xE9,0xED,0x3D,
+    0xAC,0x99,0xA3,0x11,0xAB,0xE7,0xFF,0xFF,
+    0x4E,0x9F,0xFF,0x87,0x1E,0xF3,0x04,0xDD,
+    0xF9,0x14,0x2F,0xD1,0xE7,0xE1,0x9A,0x99,
+    0xFE,0x2A,0x98,0xE4,0x1A,0x0F,0xB6,0x12,
+    0x7B,0xDE,0x2A,0x40,0xEC,0xBD,0x47,0xF6,
+    0x0E,0x58,0x83,0x55,0xCE,0x47,0x2D,0x78,
+    0x7F,0x52,0x46,0x47,0x71,0xC0,0x16,0x22,
+    0xE7,0x51,0xB2,0x36,0x39,0x22,0xCE,0x83,
+    0x26,0xD8,0xF3,0x87,0x9B,0x4F,0x56,0xAA,
+    0xA3,0x3A,0xB0,0xD8,0xCA,0x70,0xBA,0x2C,
+    0x2D,0x76,0x3B,0x78,0xC8,0x9B,0xA6,0x5E,
+    0x02,0x9F,0xAC,0x0B,0x64,0x33,0xD5,0x6F,
+    0xF7,0xFB,0x0E,0xA9,0xCA,0x56,0xAD,0x78,
+    0x48,0x8B,0x92,0x69,0x6B,0x74,0xFA,0xFD,
+    0xC7,0x36,0xB2,0x65,0x70,0xB5,0x1E,0xBB,
+    0x6E,0xCD,0x38,0x0B,0x85,0x12,0x91,0x89,
+    0x9F,0x07,0xA8,0x16,0x33,0x2D,0x0C,0x05,
+    0xB3,0x81,0x30,0x1A,0x9C,0xDC,0xA9,0xC9,
+    0x5D,0x24,0xC2,0x8D,0x20,0x23,0x90,0xB1,
+    0x08,0x70,0xAE,0x36,0x6F,0x8E,0xA3,0x4D,
+    0x39,0x96,0xA5,0xB4,0x10,0x4A,0xDC,0x72,
+    0x70,0x94,0x33,0x39,0xBC,0x3E,0x83,0xB4,
+    0x98,0x45,0xD6,0xCF,0xB1,0xB3,0xB5,0xC9,
+    0xE3,0x68,0x67,0xDD,0xF7,0x4E,0xF3,0xC1,
+    0x13,0xC4,0x7D,0x20,0xA3,0x87,0xDF,0xE1,
+    0x3A,0x6B,0x4A,0x35,0xAD,0x63,0x42,0xC7,
+    0x6D,0xFE,0x35,0x76,0xA7,0x88,0x78,0x1D,
+    0x6B,0x5C,0x65,0xDA,0x07,0xB7,0xA0,0x31,
+    0xDD,0xE8,0xA2,0xF4,0x28,0x1F,0x6C,0x05,
+    0x16,0x1A,0x83,0x85,0x65,0xCF,0x31,0x11,
+    0xA9,0x72,0x80,0x15,0x6A,0xE2,0x72,0x00,
+    0x1B,0x8F,0x6D,0x3D,0x4E,0xC0,
+
+    /* Access unit 12 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x59,
+    0xFF,0x84,0x31,0x86,0xE3,0x04,0x90,0x81,
+    0xA0,0xA0,0x50,0x24,0x12,0x08,0x04,0x42,
+    0x40,0xA0,0x78,0xB5,0xB9,0xEE,0xAD,0xFD,
+    0x65,0x7F,0x96,0xC7,0x42,0xB3,0xC1,0x40,
+    0xA0,0x51,0x94,0xCC,0x78,0x75,0x8D,0x7E,
+    0xD4,0x45,0x0D,0x59,0x4F,0x85,0x09,0xE6,
+    0xAE,0x60,0x85,0xCE,0x9C,0x68,0x18,0xD8,
+    0x17,0x3D,0x78,0xFC,0xA3,0xB3,0x8D,0xB0,
+    0xCE,0xCB,0x46,0x88,0x34,0xE3,0x25,0x66,
+    0x96,0x39,0x7D,0xC6,0xD0,0xCC,0x60,0x3D,
+    0x7B,0x1B,0xFF,0x74,0x1C,0x10,0xA3,0x1C,
+    0x76,0xD6,0x00,0x14,0x3D,0xBC,0xDD,0x48,
+    0x31,0x54,0xD8,0x80,0x95,0x2D,0x20,0x00,
+    0x78,0x83,0x0F,0x52,0x84,0x88,0x73,0x87,
+    0x00,0x00,0x2E,0x7D,0x81,0xB3,0x57,0xA1,
+    0x57,0x80,0x00,0x00,0x06,0x2E,0x7B,0x36,
+    0x6A,0xF4,0x2D,0x30,0x00,0x00,0x35,0xD5,
+    0x61,0xB3,0x57,0xA5,0x3F,0x80,0x00,0x00,
+    0xE0,0x25,0x9E,0xA5,0x09,0x5D,0x66,0x00,
+    0x02,0xEE,0x63,0x1B,0xA9,0x05,0xCF,0x38,
+    0x81,0x5D,0xD4,0x34,0x14,0x14,0xC3,0xDF,
+    0x70,0xFF,0xFF,0xEA,0xDB,0xE6,0x29,0xDA,
+    0x9E,0x29,0x78,0x04,0xA1,0x65,0x74,0xAB,
+    0x05,0x19,0x55,0x4A,0x92,0x95,0xD4,0xE6,
+    0xEC,0xBC,0x6A,0x00,0x8F,0x25,0xB9,0x2E,
+    0xB5,0x6B,0x2A,0x2E,0xC5,0x49,0xC2,0x31,
+    0xD3,0x67,0x04,0x9B,0x40,0xB4,0x84,0xEF,
+    0x2A,0x67,0xF2,0x9C,0xE1,0xAF,0x25,0x9C,
+    0xD4,0xBB,0x0C,0xD3,0xC2,0xE2,0xA3,0x1B,
+    0xEF,0x86,0xAD,0xCC,0x16,0xA3,0x33,0xCD,
+    0x84,0xCF,0x72,0xB1,0xA8,0xBC,0xE0,0x57,
+    0x6E,0x6E,0x74,0xAE,0x7E,0x63,0xD3,0x19,
+    0x3E,0xF3,0xCF,0x94,0xA5,0xE1,0x48,0xDD,
+    0x69,0x26,0x50,0xA5,0x18,0x02,0x72,0x7C,
+    0x61,0x91,0x94,0x1D,0x2A,0xDF,0x43,0x82,
+    0x20,0x83,0xCD,0x0E,0x08,0x77,0xF6,0x95,
+    0x8F,0xB9,0x43,0x04,0xF8,0x66,0x5C,0x14,
+    0x1C,0x94,0xA6,0xFD,0xF5,0x11,0x91,0x43,
+    0x21,0x3E,0x70,0x4A,0x16,0xC3,0x8C,0xE8,
+    0x31,0x65,0x14,0xF6,0x94,0x11,0xCC,0x6A,
+    0xC0,0xA2,0x68,0x2F,0x5D,0xA4,0x9D,0xE9,
+    0xFC,0xDB,0xDA,0x4C,0x6D,0x7B,0xB4,0x51,
+    0xF1,0x9F,0x9F,0x4F,0x2C,0xCE,0xB0,0xBC,
+    0x9B,0x83,0xFE,0x95,0x45,0xBF,0x87,0x8A,
+    0x15,0x5A,0x3B,0xC6,0x46,0x1C,0xD5,0x47,
+    0x57,0x5C,0xA0,0xA7,0x02,0xB0,0xE1,0xA2,
+    0x4A,0x74,0xB1,0xFB,0x47,0x56,0xC4,0x6C,
+    0x2C,0x3D,0xAB,0x07,0x59,0xE6,0xC8,0xBE,
+    0xAC,0xAC,0xB6,0x84,0x54,0xA4,0x4B,0x71,
+    0x9E,0x4B,0x7D,0x75,0x76,0x7C,0x56,0xCD,
+    0x0D,0xA1,0x49,0xFD,0xC3,0x04,0x33,0x68,
+    0x44,0x05,0xA2,0x2A,0x7C,0x0C,0x64,0x7A,
+    0x5C,0x34,0x93,0x4D,0xE5,0x97,0xCA,0x36,
+    0x29,0xC0,0x09,0x20,0x16,0x6D,0x4A,0x60,
+    0x16,0x4D,0xE4,0x66,0x2A,0xD8,0x4B,0xE8,
+    0x00,0x0E,0x49,0x8D,
+
+    /* Access unit 13 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x61,
+    0xFF,0x84,0x31,0x87,0x43,0x04,0x07,0x89,
+    0x88,0x88,0x08,0x07,0x87,0x87,0xFB,0x0D,
+    0x05,0xC0,0x37,0xCB,0xDC,0x90,0xF6,0x4E,
+    0x19,0x79,0x86,0xD2,0x64,0x9F,0x37,0x67,
+    0x8C,0xD6,0xA2,0xF8,0x0E,0xA7,0x00,0x02,
+    0x21,0xB8,0xE6,0x55,0x4D,0x67,0x4D,0x49,
+    0xFF,0xEC,0x70,0x99,0xEC,0xC8,0x94,0xD3,
+    0x40,0x00,0x4A,0x78,0x1C,0xCA,0xA9,0xAC,
+    0xEE,0x87,0x6F,0xFD,0x69,0x95,0xF4,0xEC,
+    0x87,0x00,0x00,0x25,0x5C,0x0E,0x65,0x54,
+    0xD6,0x78,0xCE,0x9F,0xFE,0xC8,0x6E,0xFA,
+    0x96,0x00,0x00,0x04,0x4F,0x81,0xCC,0xAA,
+    0x9A,0xCF,0x4E,0x7D,0x34,0x36,0x93,0x66,
+    0x97,0xC0,0x00,0x00,0x2E,0x76,0x94,0x28,
+    0xCB,0x1B,0x29,0x37,0xE9,0xA1,0xC1,0x97,
+    0x0B,0x16,0x00,0x01,0x09,0xE0,0x73,0x2A,
+    0xA6,0xB3,0xE8,0xC7,0xC4,0xE5,0x77,0xEC,
+    0xF8,0x34,0x00,0x02,0xE1,0x69,0x42,0x8C,
+    0xB1,0xB2,0xC5,0x5E,0x9A,0x1C,0xAF,0x70,
+    0xFB,0x60,0x83,0xD5,0x5F,0x1B,0x48,0xDF,
+    0xF4,0x43,0x4C,0xDF,0xFD,0xC7,0xF7,0xB8,
+    0xAA,0xB5,0x75,0x36,0x5B,0x73,0xF9,0x7A,
+    0x25,0x2F,0x2A,0x4C,0xBF,0xBA,0x7D,0x0B,
+    0xAA,0x00,0x47,0xC0,0x10,0xB9,0x74,0xB2,
+    0xC4,0x68,0xCE,0x66,0xAC,0xCD,0x01,0x41,
+    0x3C,0x92,0x33,0xC0,0x49,0x24,0x97,0x04,
+    0x2C,0xD5,0x67,0xF4,0x46,0x43,0xC0,0xFA,
+    0x61,0x69,0xB3,0x14,0xD9,0x94,0xEE,0x5B,
+    0x37,0x36,0x16,0x21,0x86,0xDD,0x52,0xB5,
+    0xB3,0x94,0x6D,0x93,0x05,0x95,0x52,0x30,
+    0x22,0xA3,0x73,0x05,0x35,0xFC,0xD7,0x78,
+    0x74,0x78,0x0E,0x7A,0x0F,0xD2,0x23,0xEE,
+    0x0A,0xC7,0x40,0xB9,0xCC,0x87,0x26,0x62,
+    0x6B,0xAF,0x2E,0x9A,0x5A,0x4D,0xA5,0x21,
+    0xD7,0x03,0x80,0xA8,0x6E,0xC0,0x96,0xBD,
+    0x79,0xC5,0x75,0x72,0xDD,0x8F,0x82,0x1C,
+    0x4D,0x57,0x58,0x45,0xC9,0xC6,0xAF,0x9E,
+    0x7A,0x9D,0xF5,0x84,0xF0,0xDD,0x92,0xC0,
+    0x62,0x3E,0x66,0xF3,0xB6,0x6B,0xC5,0x4D,
+    0x6C,0xA5,0x23,0x65,0x1F,0x52,0xF0,0xCA,
+    0x68,0xD0,0x9D,0x04,0x80,0x63,0xD4,0xD9,
+    0x23,0x14,0x90,0xBC,0xE7,0x71,0xA1,0x77,
+    0x48,0xF8,0x3C,0xA8,0xD4,0xC6,0x32,0xD0,
+    0x06,0x8C,0x23,0x47,0x38,0x52,0x00,0x2C,
+    0xA5,0xF5,0x1A,0xFC,0x4C,0xEC,0x5F,0x1D,
+    0x74,0x2C,0xB2,0x2D,0x13,0x01,0x8C,0x7F,
+    0x1B,0x16,0xF6,0x4E,0xD0,0xDE,0xD1,0x61,
+    0x09,0x67,0x04,0xCB,0x3B,0x3F,0x62,0xFF,
+    0x03,0x06,0xB1,0x02,0x6F,0x86,0xEF,0x4A,
+    0x28,0xCF,0xC0,0x8C,0x7D,0xDE,0x06,0x2B,
+    0xF2,0x07,0xDE,0x07,0x6D,0x20,0xDF,0xA4,
+    0xCB,0xDD,0x51,0x20,0xDD,0x91,0x4B,0xF7,
+    0xB9,0xEF,0xE9,0x19,0x45,0x46,0x8A,0x3C,
+    0xB9,0x71,0x7C,0xB8,0x15,0x17,0x1C,0xA9,
+    0xD3,0x26,0x9E,0xF6,0x1E,0x3A,0x07,0x2C,
+    0x00,0x05,0x76,0xF7,0x1A,
+
+    /* Access unit 14 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x69,
+    0xFF,0x84,0x31,0x87,0xC3,0x04,0x8F,0xC1,
+    0x80,0x90,0x40,0x20,0x0C,0x06,0x03,0x46,
+    0x81,0xC0,0x98,0x3B,0xEA,0x40,0x00,0x00,
+    0x03,0x00,0x3F,0xA6,0xFC,0xFB,0xF5,0x55,
+    0x0A,0x09,0x9C,0x67,0x02,0xA9,0x71,0x9A,
+    0xB3,0x10,0x5F,0x4C,0xF4,0x74,0x2F,0x43,
+    0x62,0xE7,0x92,0x97,0x1D,0x8F,0x16,0x3B,
+    0x54,0x16,0xDF,0x0F,0xD2,0xDC,0x6A,0xD2,
+    0x54,0xE3,0xA0,0x3B,0x08,0xE7,0xC1,0x5B,
+    0x94,0xB8,0xE2,0x96,0x49,0x45,0xEB,0x61,
+    0xF4,0x65,0x40,0xB0,0x5C,0x61,0x98,0xC5,
+    0x20,0x05,0x64,0xBF,0xA6,0xD1,0x59,0x38,
+    0x9F,0x26,0xCE,0x00,0x16,0xBE,0xA7,0xC2,
+    0xEF,0x80,0x91,0x78,0x00,0x11,0x97,0xE5,
+    0xCC,0xB7,0x80,0x00,0x00,0x03,0x02,0x23,
+    0x07,0x5A,0x2E,0xD0,0x00,0x00,0x19,0xBB,
+    0x03,0xBA,0x85,0x00,0x00,0x9E,0x47,0x96,
+    0x90,0x4C,0x00,0x01,0xBC,0x65,0x2B,0xCD,
+    0xB0,0x7F,0xCF,0xC3,0x5B,0x0B,0x53,0x72,
+    0x43,0xFE,0xFF,0xFD,0x1A,0x83,0x68,0xB6,
+    0x0D,0x10,0x85,0xD2,0x07,0xF7,0xBA,0x83,
+    0x08,0x3A,0xFB,0x48,0x7F,0x56,0x77,0xCB,
+    0x3E,0x7B,0x04,0x25,0x70,0xEC,0x7D,0x64,
+    0x27,0x4D,0xB7,0x16,0x8A,0xAD,0xD8,0xDD,
+    0x87,0x48,0x45,0x7D,0x8C,0x3C,0xA1,0x18,
+    0x5D,0x05,0x0A,0x0A,0xCB,0x08,0xFF,0x0F,
+    0x23,0xDF,0xC0,0x76,0xE2,0x93,0xD7,0x46,
+    0x32,0x99,0xAF,0x61,0xCE,0xAB,0x8D,0xE7,
+    0x74,0x2D,0x7F,0x4C,0x83,0xB0,0x76,0xFA,
+    0xC9,0x02,0xAF,0xA1,0xF3,0x5A,0x6B,0xCF,
+    0x01,0xC7,0x23,0x88,0xED,0xFE,0x11,0x85,
+    0x5B,0xD2,0x0D,0xEE,0x6A,0xCF,0xBF,0xC7,
+    0xCE,0x2F,0xAB,0xB8,0x58,0x70,0x04,0xCA,
+    0x35,0x1E,0xD0,0xFE,0x08,0x57,0xC8,0xE3,
+    0xE6,0xEB,0x14,0x13,0x51,0xD4,0xE8,0xC8,
+    0xC8,0x0C,0xE9,0x22,0x7A,0xCF,0x1A,0x06,
+    0x68,0x9E,0xA3,0x86,0x8F,0x34,0xEE,0x87,
+    0x66,0x8F,0x3A,0x8C,0xF3,0x3B,0x77,0x1A,
+    0xC1,0x43,0x12,0xD7,0x9E,0x5A,0x18,0x75,
+    0xC8,0x57,0x07,0xF5,0x0C,0x3E,0x9E,0xF1,
+    0x75,0x3F,0xB1,0x68,0xDE,0x2A,0x4D,0x34,
+    0x50,0x50,0x7F,0x29,0x64,0x41,0xA0,0x20,
+    0x7C,0x19,0x12,0x93,0x98,0xB0,0x77,0x97,
+    0xA0,0x63,0x0B,0x1F,0x72,0x58,0x0C,0xBC,
+    0x71,0x66,0x6A,0xD8,0xD5,0x15,0x2D,0x4E,
+    0x47,0xA4,0x74,0x82,0x00,0x55,0x91,0x00,
+    0xCB,0x14,0xD4,0x29,0x87,0xFF,0x66,0x2A,
+    0x29,0xAA,0x4B,0xC2,0x08,0x93,0xDF,0x5B,
+    0xF9,0x72,0x29,0xCE,0xB1,0xA4,0x3C,0x51,
+    0xC7,0x94,0xF5,0x76,0xE8,0x2E,0x2F,0x6E,
+    0x29,0x7E,0x37,0xD4,0x39,0x57,0xE4,0xC8,
+    0x4A,0x79,0xFD,0xB2,0x5B,0x5A,0xC5,0xA6,
+    0x16,0x0F,0xE5,0x2E,0x66,0x42,0xA8,0xE4,
+    0xF3,0x90,0x8E,0x50,0x09,0x5C,0x0C,0xF7,
+    0xB1,0xC6,0xFB,0x6B,0xD1,0xA3,0x4D,0x94,
+    0x38,0x2C,0x2D,0x1A,0xD1,0xFF,0xC5,0xCB,
+    0x36,0x68,0x79,0xA7,0x80,0x00,0x06,0xD5,
+    0xB3,
+
+    /* Access unit 15 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x71,
+    0xFF,0x84,0x31,0x87,0xE3,0x04,0x87,0xC2,
+    0x00,0xE0,0x68,0x30,0x18,0x0B,0x05,0xD0,
+    0x00,0x80,0xE8,0x3B,0xEA,0x40,0x02,0x4A,
+    0x18,0xB0,0x17,0xD3,0xB2,0x70,0xCC,0xBA,
+    0x1E,0xBA,0x0E,0x9D,0xC6,0x7E,0x01,0x1C,
+    0xEB,0xED,0x20,0x81,0x30,0xCF,0xC7,0x1F,
+    0xB9,0xCF,0x20,0xB0,0x5C,0x8A,0xAF,0xCE,
+    0x3F,0xEF,0xC0,0x00,0x4D,0x6F,0x34,0xC5,
+    0xDF,0x2A,0xCD,0x80,0x9F,0x2C,0x2E,0x08,
+    0xA9,0x30,0x00,0x18,0x8F,0x4E,0x99,0x25,
+    0x49,0x0E,0x40,0x91,0xAD,0x70,0x9F,0x1A,
+    0x00,0x0F,0x7B,0x96,0xE3,0xE4,0x57,0x86,
+    0x40,0x00,0xED,0x43,0xAA,0x98,0x02,0x4B,
+    0xCB,0xD3,0x32,0x56,0x32,0xD0,0x02,0xFA,
+    0xE3,0x01,0xF0,0x16,0x72,0x6E,0x99,0xAF,
+    0xB2,0x1D,0x80,0x06,0x3D,0xC9,0x03,0xE0,
+    0x77,0x86,0xB7,0x22,0x05,0xF6,0x72,0x0A,
+    0x56,0x2C,0x3D,0x41,0x84,0xE6,0xE9,0xA2,
+    0x49,0x85,0x88,0x7F,0xCF,0xC3,0x5B,0xE9,
+    0x0C,0x33,0x25,0x8B,0x1F,0x7F,0xF1,0x63,
+    0x36,0x1B,0x61,0x2F,0x39,0xE6,0x0D,0x9A,
+    0x8E,0xFE,0x00,0x0B,0xE1,0x19,0x28,0x19,
+    0x2E,0x4D,0xC6,0xBC,0x76,0x1C,0x92,0x18,
+    0x55,0xAA,0xCD,0x8E,0xEF,0x71,0xE1,0xBA,
+    0x0A,0xFF,0xE4,0x43,0x7D,0xF1,0x6D,0x62,
+    0x66,0x14,0x3E,0x9D,0x68,0x06,0x31,0x0B,
+    0x2E,0x2E,0xF4,0xB9,0x4E,0xC0,0xF7,0x55,
+    0x39,0xCD,0xA5,0xCF,0x63,0x8E,0xCD,0x26,
+    0x76,0x25,0x59,0x88,0x8D,0x83,0x67,0xD4,
+    0x04,0x31,0x02,0x46,0x96,0x0B,0x7F,0x03,
+    0x3A,0xB1,0x13,0x97,0xCB,0x5A,0x6B,0x2E,
+    0x54,0xAF,0xE5,0xFC,0x3E,0x06,0x15,0xF3,
+    0xE6,0x15,0xFE,0x86,0x7D,0xBE,0x2E,0x51,
+    0xEF,0x00,0x8E,0x16,0x49,0xB0,0xB9,0xD5,
+    0xB2,0x46,0xF2,0x4D,0xF3,0x6F,0x46,0x30,
+    0xCE,0x7C,0x4B,0x26,0xCD,0xAA,0x4E,0x18,
+    0x98,0x51,0xB9,0xAA,0x58,0xD2,0x62,0x1A,
+    0x4E,0x84,0x4F,0x4C,0x7A,0x2D,0x04,0xF4,
+    0xF7,0x54,0x2E,0xC2,0xD6,0xCE,0xD4,0xD0,
+    0xEA,0xE6,0x88,0x51,0xC1,0x3F,0x50,0x2F,
+    0x6B,0xF6,0x9B,0x67,0x31,0xCD,0xA2,0x5D,
+    0xC8,0xCF,0x41,0x07,0xEE,0xA5,0xBB,0xB4,
+    0xDB,0x6D,0x30,0xCC,0x16,0x93,0x08,0x29,
+    0x40,0x5F,0xD3,0x1E,0xD1,0x9B,0x84,0xC1,
+    0x74,0xF9,0xF5,0xE0,0x78,0xE2,0x47,0x8E,
+    0x11,0x8D,0xE5,0x99,0x92,0x24,0x71,0xEC,
+    0x83,0x75,0x76,0xC4,0x64,0x75,0x8D,0x66,
+    0x0C,0xDA,0xE5,0xF8,0x6E,0x7F,0xE2,0xA9,
+    0x6C,0x9D,0x4E,0x46,0xB6,0x5A,0x38,0x13,
+    0xC8,0xCB,0xAE,0x98,0x2A,0x18,0x16,0x27,
+    0x19,0xC6,0x9D,0x3C,0x03,0xB0,0x76,0x69,
+    0xA9,0x8F,0x24,0xF8,0xDF,0xE9,0x52,0xE2,
+    0xC2,0x46,0xFF,0x2F,0xBA,0x29,0x23,0xEC,
+    0x09,0x69,0x79,0x53,0x3A,0x2D,0xA4,0x32,
+    0xA4,0xCD,0xCA,0x7C,0x0E,0x4A,0xB6,0x57,
+    0x20,0x4A,0x70,0x61,0xC3,0x60,0xD1,0x03,
+    0x8F,0x7E,0xF6,0x4E,0xA2,0xD8,0xA0,0x22,
+    0x67,0xB5,0xE4,0xE5,0x33,0x85,0x27,0xC5,
+    0xB3,0x8B,0x0A,0xD6,0x08,0x18,0x04,0xD5,
+    0x73,0x18,0x6F,0x57,0xC5,0xC8,0x5B,0x79,
+    0x49,0x02,0x5A,0x0C,0x19,0x78,0xF9,0xCE,
+    0x00,0x04,0x03,0xB4,0xA1,0x40,
+
+    /* Access unit 16 */
+    0x00,0x00,0x00,0x01,0x02,0x01,0xD0,0x79,
+    0xFF,0x84,0x31,0x82,0x10,0xC1,0x21,0xB1,
+    0x68,0xC8,0x62,0x31,0x18,0x0C,0x06,0x12,
+    0x90,0x40,0x2E,0x3C,0x0C,0x20,0x01,0xC4,
+    0x95,0xB0,0x15,0x1A,0x18,0x52,0x80,0x0C,
+    0xAD,0x36,0x83,0xC9,0x58,0xCD,0xD9,0xDF,
+    0x24,0xE0,0x4F,0x9A,0x2A,0x9F,0x80,0xB0,
+    0x50,0x42,0x16,0xB4,0x8A,0x91,0x30,0xFD,
+    0xBE,0x5C,0xAD,0xFD,0x04,0x17,0x6F,0x71,
+    0xE6,0xBF,0x19,0xD5,0x5C,0xA4,0x5C,0x00,
+    0x0E,0x1E,0x70,0x72,0xD3,0xE5,0xA5,0xB0,
+    0x57,0x7C,0xD2,0xC9,0x28,0xBD,0x6C,0x28,
+    0x54,0x96,0x0D,0x26,0x8A,0x9E,0xFE,0x5F,
+    0x52,0x36,0x33,0xDD,0xAE,0x92,0x20,0xCA,
+    0xAF,0x31,0x21,0xA3,0x1A,0xB5,0x41,0xF6,
+    0xDE,0x3B,0x33,0xD0,0x57,0xDB,0xAA,0x40,
+    0x28,0xBC,0xCF,0x0A,0xA8,0x80,0x11,0x80,
+    0x79,0xE5,0xB0,0x57,0x7C,0xD2,0xC9,0x28,
+    0xBD,0x6C,0x36,0x2B,0xD6,0xA8,0x17,0x44,
+    0x91,0x38,0x3F,0xCE,0x52,0x26,0x71,0x75,
+    0xD5,0x19,0x55,0xE6,0x24,0x34,0x63,0x5E,
+    0x78,0x3E,0xDB,0xC7,0x66,0x7A,0x0A,0xFB,
+    0x75,0x48,0x16,0x10,0xAB,0x90,0xC0,0x28,
+    0x87,0x60,0x1E,0x79,0x6C,0x15,0xDF,0x34,
+    0xB2,0x4A,0x2F,0x5B,0x0D,0x8A,0xF5,0xAA,
+    0x06,0x1E,0x00,0x03,0xD4,0xE5,0x22,0x67,
+    0x17,0x5D,0x51,0x95,0x5E,0x62,0x43,0x46,
+    0x36,0x58,0x83,0xED,0xBC,0x76,0x67,0xA0,
+    0xAF,0xB7,0x54,0x85,0x04,0x45,0xE6,0xC7,
+    0x02,0x21,0xD9,0xA7,0x9E,0x5B,0x05,0x77,
+    0xCD,0x2C,0x92,0x8B,0xD6,0xC3,0x62,0xBD,
+    0x6A,0x81,0x97,0x80,0x00,0x1A,0x3F,0x7B,
+    0x3D,0xDA,0xE9,0x22,0x0C,0xAA,0xF3,0x12,
+    0x1A,0x31,0xB3,0x4C,0x1F,0x6D,0xE3,0xB3,
+    0x3D,0x05,0x7D,0xBA,0xA4,0x44,0x22,0x46,
+    0xBC,0x70,0x38,0x11,0x9A,0x79,0xE5,0xB0,
+    0x57,0x7C,0xD2,0xC9,0x28,0xBD,0x6C,0x36,
+    0x2B,0xD6,0xA8,0x1A,0x38,0x00,0x68,0x76,
+    0x52,0x26,0x71,0x75,0xD5,0x19,0x55,0xE6,
+    0x24,0x34,0x63,0x69,0x78,0x3E,0xDB,0xC7,
+    0x66,0x7A,0x0A,0xFB,0x75,0x48,0xED,0xB0,
+    0xA5,0x44,0xE0,0x70,0x24,0x67,0x8F,0x58,
+    0xA0,0xD6,0xF9,0xA5,0x92,0x51,0x7A,0xD8,
+    0x6C,0x57,0xAD,0x50,0x36,0xD0,0x01,0x0B,
+    0xEC,0xA4,0x4C,0xE2,0xEB,0xAA,0x32,0xAB,
+    0xCC,0x48,0x68,0xC6,0xD5,0xA3,0x3D,0xD0,
+    0x08,0xDE,0x5E,0xCC,0x98,0x96,0x9A,0x63,
+    0x39,0x77,0xAF,0x7A,0x40,0x91,0x9E,0x3D,
+    0x62,0x83,0x5B,0xE6,0x96,0x49,0x45,0xEB,
+    0x61,0xB1,0x5E,0xB5,0x40,0xE1,0x40,0xF8,
+    0x93,0x03,0x28,0x40,0x20,0xA5,0xCB,0xFA,
+    0xDE,0xA3,0xCB,0xD7,0x9D,0xF4,0xF0,0x32,
+    0x94,0x09,0x9C,0x3C,0x28,0x9C,0x34,0x20,
+    0x8E,0x78,0x4D,0xA6,0x7A,0x28,0x84,0x63,
+    0x42,0x46,0x17,0xCB,0xD5,0xB9,0x3D,0x01,
+    0x2F,0xD9,0xCC,0x39,0xCC,0xBF,0xFF,0xFF,
+    0xFF,0xEF,0x83,0xEF,0x66,0x2E,0x77,0x61,
+    0xBC,0xC1,0x6B,0xA8,0xE5,0x57,0xFA,0xFF,
+    0x54,0xE0,0xF7,0x48,0xAC,0xCA,0x02,0xF0,
+    0x1E,0x36,0x8B,0x45,0xFC,0x8E,0x3A,0x92,
+    0x43,0x45,0xAF,0xB1,0xC1,0xDC,0x1B,0x9B,
+    0x79,0xE3,0x7E,0x07,0x32,0x60,0x0E,0x66,
+    0x48,0xDE,0xA3,0xF2,0xBC,0xED,0xE7,0x8D,
+    0x97,0x2A,0xA0,0xA6,0x94,0x91,0xEF,0xBB,
+    0xDD,0x0E,0x82,0xC8,0x15,0xBB,0x80,0x78,
+    0x6A,0x78,0xD8,0x24,0x05,0x7F,0x20,0x2A,
+    0xC3,0x4F,0x7E,0x66,0x25,0x55,0x4E,0x79,
+    0x2F,0xCF,0xD1,0x79,0x22,0x32,0x49,0x86,
+    0x75,0x4B,0x30,0x0C,0x33,0x64,0x80,0xCD,
+    0xCD,0x10,0x44,0xD6,0x84,0x05,0xC4,0xA6,
+    0x7D,0x7B,0x9D,0x52,0xC5,0xE8,0x70,0x9A,
+    0x32,0xB2,0x7E,0x67,0xBC,0xBC,0x78,0xD8,
+    0x8B,0x9B,0xC3,0x63,0x23,0x0F,0xC6,0x7C,
+    0x2E,0x76,0x16,0x9E,0xB1,0xE3,0xBE,0xC5,
+    0x1E,0x4D,0x61,0xC8,0x4A,0xA2,0xFA,0x34,
+    0xDA,0x55,0x43,0x04,0xF4,0x68,0xE1,0xDC,
+    0x79,0x48,0xBF,0x86,0xC6,0x5C,0xE9,0x95,
+    0x42,0xD0,0x62,0x59,0xCA,0xC8,0x5D,0xFF,
+    0xFE,0xCA,0x56,0xF7,0xC1,0x1D,0x95,0x8F,
+    0xF3,0x2B,0x4A,0x97,0xEC,0xDA,0x73,0x6E,
+    0x3E,0x1D,0xD7,0x48,0x61,0xB7,0x85,0x67,
+    0xFC,0x97,0xCB,0xC3,0x0A,0x63,0x90,0x32,
+    0x1A,0x0A,0xD4,0x6C,0x85,0x51,0x45,0xBE,
+    0xBE,0xAF,0x2F,0xE5,0xB4,0x24,0x20,0x6F,
+    0x72,0x99,0x7A,0x24,0xD9,0x90,0x6D,0xC4,
+    0xC8,0x17,0xBA,0x1A,0xC0,0x07,0xCC,0xC2,
+    0x9F,0x17,0x21,0xC1,0xC7,0x82,0x97,0x69,
+    0x80,0x04,0x01,0x00,0x22,0x1C,0x51,0x6D,
+    0xF9,0x30,0x0E,0x04,0x00,0xF1,0x40,0x97,
+    0xBA,0xE0,0x36,0x37,0x50,0xE0,0x00,0x00,
+    0x51,0xF2,0x33
+};
+
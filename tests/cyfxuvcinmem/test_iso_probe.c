@@ -0,0 +1,1013 @@
+/*
+ * UVC Isochronous Probe/Commit Negotiation Unit Tests
+ * ===================================================
+ *
+ * Tests the probe/commit negotiation of the cyfxuvcinmem (isochronous) implementation at high speed
+ * and SuperSpeed. The frame size and payload size reported to the host are checked against values
+ * computed from the stored video frames and the endpoint geometry.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <cyu3error.h>
+
+// Include UVC headers for isochronous implementation
+#include "../../cyfxuvcinmem/cyfxuvcinmem.h"
+
+// Test framework macros
+#define TEST_ASSERT(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("FAIL: %s - %s\n", __func__, message); \
+            return 0; \
+        } \
+    } while(0)
+
+#define TEST_PASS() \
+    do { \
+        printf("PASS: %s\n", __func__); \
+        return 1; \
+    } while(0)
+
+// Test counters
+static int tests_passed = 0;
+static int tests_total = 0;
+
+#define RUN_TEST(test_func) \
+    do { \
+        tests_total++; \
+        if (test_func()) tests_passed++; \
+    } while(0)
+
+// Frame interval of the single frame: 15 fps in 100 ns units
+#define ISO_FRAME_INTERVAL      666666
+
+// Service intervals (125 us) in one frame interval
+#define ISO_SERVICES_PER_FRAME  ((ISO_FRAME_INTERVAL * 8000ULL) / 10000000ULL)
+
+// Target compressed size per slice of the slice mode control
+#define ISO_SLICE_SIZE          1200
+
+/**
+ * Largest stored video frame
+ */
+static uint32_t iso_max_frame_size(void)
+{
+    uint32_t size = 0;
+    for (int i = 0; i < CY_FX_UVC_MAX_VID_FRAMES; i++) {
+        if (glVidFrameLen[i] > size) size = glVidFrameLen[i];
+    }
+    return size;
+}
+
+/**
+ * Negotiate a probe structure sent by the host at the given speed
+ */
+static int iso_negotiate(CyU3PUSBSpeed_t speed, const uint8_t *probe, uint16_t len, CyFxUvcProbeCtrl_t *ctrl)
+{
+    CyFxUvcEpGeometry_t ep;
+
+    if (CyFxUvcProbeGetEpGeometry(speed, &ep) != CY_U3P_SUCCESS) return 0;
+    memset(ctrl, 0, sizeof(*ctrl));
+    CyFxUvcProbeUnpack(ctrl, probe, len);
+    CyFxUvcProbeNegotiate(ctrl, &ep, 0);
+    return 1;
+}
+
+/**
+ * Test the endpoint geometry at high speed and SuperSpeed
+ */
+int test_iso_ep_geometry()
+{
+    CyFxUvcEpGeometry_t ep;
+
+    TEST_ASSERT(CyFxUvcProbeGetEpGeometry(CY_U3P_HIGH_SPEED, &ep) == CY_U3P_SUCCESS, "High speed should be supported");
+    TEST_ASSERT(ep.isIso == CyTrue, "Streaming endpoint should be isochronous");
+    TEST_ASSERT(ep.maxPayload == 3 * 1024, "High speed payload should be 3 transactions of 1024 bytes");
+    TEST_ASSERT(ep.bytesPerSec == 3 * 1024 * 8000, "High speed bandwidth should be one payload per microframe");
+
+    TEST_ASSERT(CyFxUvcProbeGetEpGeometry(CY_U3P_SUPER_SPEED, &ep) == CY_U3P_SUCCESS, "SuperSpeed should be supported");
+    TEST_ASSERT(ep.maxPayload == CY_FX_EP_ISO_VIDEO_SS_BURST * CY_FX_EP_ISO_VIDEO_SS_MULT * 1024,
+                "SuperSpeed payload should be one burst of 1024 byte packets");
+
+    TEST_ASSERT(CyFxUvcProbeGetEpGeometry(CY_U3P_FULL_SPEED, &ep) != CY_U3P_SUCCESS,
+                "Full speed streaming should not be supported");
+
+    TEST_PASS();
+}
+
+/**
+ * Test the negotiated frame and payload sizes at the given speed
+ */
+static int iso_check_sizes(CyU3PUSBSpeed_t speed)
+{
+    uint8_t probe[CY_FX_UVC_PROBE_LEN_UVC11] = {0};
+    CyFxUvcProbeCtrl_t ctrl;
+    uint32_t maxFrame = iso_max_frame_size();
+    uint32_t data;
+
+    probe[2] = 1;
+    probe[3] = 1;
+    probe[4] = ISO_FRAME_INTERVAL & 0xFF;
+    probe[5] = (ISO_FRAME_INTERVAL >> 8) & 0xFF;
+    probe[6] = (ISO_FRAME_INTERVAL >> 16) & 0xFF;
+    if (!iso_negotiate(speed, probe, sizeof(probe), &ctrl)) return 0;
+
+    if (ctrl.dwFrameInterval != ISO_FRAME_INTERVAL) return 0;
+    if (ctrl.dwMaxVideoFrameSize != maxFrame) return 0;
+
+    // The payload must carry the largest frame within one frame interval, and be no larger than needed.
+    data = ctrl.dwMaxPayloadTransferSize - CY_FX_UVC_MAX_HEADER;
+    if ((uint64_t)data * ISO_SERVICES_PER_FRAME < maxFrame) return 0;
+    if ((uint64_t)(data - 1) * ISO_SERVICES_PER_FRAME >= maxFrame) return 0;
+    if (ctrl.dwMaxPayloadTransferSize > CY_FX_UVC_STREAM_BUF_SIZE) return 0;
+
+    return 1;
+}
+
+int test_iso_probe_sizes_hs()
+{
+    TEST_ASSERT(iso_check_sizes(CY_U3P_HIGH_SPEED), "High speed frame/payload sizes should match the stored frames");
+    TEST_PASS();
+}
+
+int test_iso_probe_sizes_ss()
+{
+    TEST_ASSERT(iso_check_sizes(CY_U3P_SUPER_SPEED), "SuperSpeed frame/payload sizes should match the stored frames");
+    TEST_PASS();
+}
+
+/**
+ * Test that unsupported values are replaced by supported ones
+ */
+int test_iso_probe_clamping()
+{
+    uint8_t probe[CY_FX_UVC_PROBE_LEN_UVC15] = {0};
+    CyFxUvcProbeCtrl_t ctrl;
+
+    // Unknown format and frame, frame interval too short
+    probe[2] = 7;
+    probe[3] = 9;
+    probe[4] = 0x01;
+    TEST_ASSERT(iso_negotiate(CY_U3P_HIGH_SPEED, probe, sizeof(probe), &ctrl), "Negotiation should succeed");
+    TEST_ASSERT(ctrl.bFormatIndex == 1, "Unknown format should be replaced by the default format");
+    TEST_ASSERT(ctrl.bFrameIndex == 1, "Unknown frame should be replaced by the default frame");
+    TEST_ASSERT(ctrl.dwFrameInterval == glUvcFormats[0].frame_p[0].interval_p[0],
+                "Too short an interval should be replaced by the shortest supported one");
+    TEST_ASSERT(ctrl.dwClockFrequency == CY_FX_UVC_DEVICE_CLOCK_FREQ, "Device clock should be reported");
+
+    // Zero interval selects the default
+    memset(probe, 0, sizeof(probe));
+    TEST_ASSERT(iso_negotiate(CY_U3P_SUPER_SPEED, probe, CY_FX_UVC_PROBE_LEN_UVC10, &ctrl), "Negotiation should succeed");
+    TEST_ASSERT(ctrl.dwFrameInterval == ISO_FRAME_INTERVAL, "Zero interval should select the default interval");
+
+    TEST_PASS();
+}
+
+/**
+ * Test the GET_DEF, GET_MIN and GET_MAX values
+ */
+int test_iso_probe_limits()
+{
+    CyFxUvcEpGeometry_t ep;
+    CyFxUvcProbeCtrl_t cur, def, min, max;
+
+    TEST_ASSERT(CyFxUvcProbeGetEpGeometry(CY_U3P_HIGH_SPEED, &ep) == CY_U3P_SUCCESS, "High speed should be supported");
+    memset(&cur, 0, sizeof(cur));
+    CyFxUvcProbeGetLimit(CY_FX_USB_UVC_GET_DEF_REQ, &cur, &def, &ep, 0);
+    CyFxUvcProbeGetLimit(CY_FX_USB_UVC_GET_MIN_REQ, &def, &min, &ep, 0);
+    CyFxUvcProbeGetLimit(CY_FX_USB_UVC_GET_MAX_REQ, &def, &max, &ep, 0);
+
+    TEST_ASSERT(def.bFormatIndex == 1 && def.bFrameIndex == 1, "Default should be the first format and frame");
+    TEST_ASSERT(min.dwFrameInterval <= def.dwFrameInterval, "Minimum interval should not exceed the default");
+    TEST_ASSERT(max.dwFrameInterval >= def.dwFrameInterval, "Maximum interval should not be below the default");
+    TEST_ASSERT(def.dwMaxVideoFrameSize == iso_max_frame_size(), "Default frame size should match the stored frames");
+
+    TEST_PASS();
+}
+
+/**
+ * Test packing and unpacking of the 26, 34 and 48 byte structures
+ */
+int test_iso_probe_lengths()
+{
+    uint8_t buf[64];
+    CyFxUvcProbeCtrl_t ctrl;
+
+    memset(&ctrl, 0, sizeof(ctrl));
+    ctrl.dwFrameInterval = ISO_FRAME_INTERVAL;
+    ctrl.dwClockFrequency = 0x12345678;
+    ctrl.bUsage = 1;
+
+    memset(buf, 0xAA, sizeof(buf));
+    TEST_ASSERT(CyFxUvcProbePack(&ctrl, buf, sizeof(buf)) == CY_FX_UVC_PROBE_LEN_UVC15, "Pack should be limited to 48 bytes");
+    TEST_ASSERT(buf[4] == 0x2A && buf[5] == 0x2C && buf[6] == 0x0A && buf[7] == 0x00, "Interval should be little endian");
+    TEST_ASSERT(buf[26] == 0x78 && buf[29] == 0x12, "Clock frequency should be at offset 26");
+    TEST_ASSERT(buf[34] == 1, "bUsage should be at offset 34");
+    TEST_ASSERT(buf[48] == 0xAA, "No byte beyond 48 should be written");
+    TEST_ASSERT(CyFxUvcProbePack(&ctrl, buf, CY_FX_UVC_PROBE_LEN_UVC10) == CY_FX_UVC_PROBE_LEN_UVC10,
+                "Pack should honour a 26 byte request");
+
+    // A UVC 1.0 structure leaves the UVC 1.1 and 1.5 fields untouched
+    memset(buf, 0, sizeof(buf));
+    CyFxUvcProbeUnpack(&ctrl, buf, CY_FX_UVC_PROBE_LEN_UVC10);
+    TEST_ASSERT(ctrl.dwFrameInterval == 0, "UVC 1.0 fields should be updated");
+    TEST_ASSERT(ctrl.dwClockFrequency == 0x12345678, "UVC 1.1 fields should be kept");
+    TEST_ASSERT(ctrl.bUsage == 1, "UVC 1.5 fields should be kept");
+
+    TEST_PASS();
+}
+
+/**
+ * Test the prepared responses of the negotiation state
+ */
+int test_iso_probe_state()
+{
+    static CyFxUvcProbeState_t st;
+    const uint8_t *buf;
+    uint16_t len;
+    uint8_t probe[CY_FX_UVC_PROBE_LEN_UVC15];
+    uint32_t count;
+
+    CyFxUvcProbeInit(&st, CY_U3P_SUPER_SPEED);
+    TEST_ASSERT(((uintptr_t)st.curBuf & 31) == 0, "Responses should be cache line aligned");
+    TEST_ASSERT(st.state == CY_FX_UVC_PROBE_IDLE, "Negotiation should start idle");
+    TEST_ASSERT(st.computeCount == 3, "DEF, MIN and MAX should be computed once on init");
+
+    TEST_ASSERT(CyFxUvcProbeGet(&st, CY_FX_USB_UVC_VS_PROBE_CONTROL, CY_FX_USB_UVC_GET_LEN_REQ, &buf, &len) == CY_U3P_SUCCESS,
+                "GET_LEN should be supported");
+    TEST_ASSERT(len == 2 && buf[0] == CY_FX_UVC_PROBE_LEN_UVC15 && buf[1] == 0, "GET_LEN should report 48 bytes");
+    TEST_ASSERT(CyFxUvcProbeGet(&st, CY_FX_USB_UVC_VS_COMMIT_CONTROL, CY_FX_USB_UVC_GET_INFO_REQ, &buf, &len) == CY_U3P_SUCCESS,
+                "GET_INFO should be supported on commit");
+    TEST_ASSERT(len == 1 && buf[0] == 0x03, "GET_INFO should report GET and SET support");
+    TEST_ASSERT(CyFxUvcProbeGet(&st, CY_FX_USB_UVC_VS_COMMIT_CONTROL, CY_FX_USB_UVC_GET_MAX_REQ, &buf, &len) != CY_U3P_SUCCESS,
+                "GET_MAX should be stalled on commit");
+    TEST_ASSERT(CyFxUvcProbeGet(&st, 0x0300, CY_FX_USB_UVC_GET_CUR_REQ, &buf, &len) != CY_U3P_SUCCESS,
+                "Other controls should be stalled");
+
+    // Repeated GETs and a SET_CUR of the values read back do not compute anything
+    TEST_ASSERT(CyFxUvcProbeGet(&st, CY_FX_USB_UVC_VS_PROBE_CONTROL, CY_FX_USB_UVC_GET_CUR_REQ, &buf, &len) == CY_U3P_SUCCESS,
+                "GET_CUR should be supported");
+    memcpy(probe, buf, sizeof(probe));
+    TEST_ASSERT(CyFxUvcProbeSet(&st, CY_FX_USB_UVC_VS_PROBE_CONTROL, probe, sizeof(probe)) == CY_U3P_SUCCESS,
+                "SET_CUR of the current values should succeed");
+    TEST_ASSERT(CyFxUvcProbeGet(&st, CY_FX_USB_UVC_VS_PROBE_CONTROL, CY_FX_USB_UVC_GET_MIN_REQ, &buf, &len) == CY_U3P_SUCCESS,
+                "GET_MIN should be supported");
+    TEST_ASSERT(st.computeCount == 3, "Nothing should be recomputed for repeated requests");
+    TEST_ASSERT(st.state == CY_FX_UVC_PROBE_PROBING, "SET_CUR on probe should start probing");
+
+    // A new proposal is negotiated once, and the response reflects it
+    probe[3] = 9;
+    count = st.computeCount;
+    TEST_ASSERT(CyFxUvcProbeSet(&st, CY_FX_USB_UVC_VS_PROBE_CONTROL, probe, CY_FX_UVC_PROBE_LEN_UVC11) == CY_U3P_SUCCESS,
+                "SET_CUR should succeed");
+    TEST_ASSERT(st.computeCount == count + 1, "A new proposal should be negotiated once");
+    TEST_ASSERT(st.curBuf[3] == 1, "GET_CUR should return the negotiated frame index");
+
+    // Short structures are rejected; commit changes state
+    TEST_ASSERT(CyFxUvcProbeSet(&st, CY_FX_USB_UVC_VS_COMMIT_CONTROL, probe, CY_FX_UVC_PROBE_LEN_UVC10 - 1) != CY_U3P_SUCCESS,
+                "Short SET_CUR should be rejected");
+    TEST_ASSERT(CyFxUvcProbeSet(&st, CY_FX_USB_UVC_VS_COMMIT_CONTROL, st.curBuf, CY_FX_UVC_PROBE_LEN_UVC15) == CY_U3P_SUCCESS,
+                "SET_CUR on commit should succeed");
+    TEST_ASSERT(st.state == CY_FX_UVC_PROBE_COMMITTED, "SET_CUR on commit should commit");
+    TEST_ASSERT(memcmp(st.commitBuf, st.curBuf, CY_FX_UVC_PROBE_LEN_UVC15) == 0, "Commit should hold the probed values");
+
+    TEST_PASS();
+}
+
+/**
+ * Test that every frame of the format table negotiates at each of its frame intervals, with the frame
+ * size taken from the video frames stored for that frame
+ */
+int test_iso_probe_frames()
+{
+    const CyFxUvcFormatInfo_t *fmt = &glUvcFormats[0];
+    uint8_t probe[CY_FX_UVC_PROBE_LEN_UVC11];
+    CyFxUvcProbeCtrl_t ctrl;
+
+    TEST_ASSERT(fmt->frameCount > 1, "The format should offer more than one frame");
+
+    for (int f = 0; f < fmt->frameCount; f++) {
+        const CyFxUvcFrameInfo_t *frame = &fmt->frame_p[f];
+        uint32_t size = 0;
+
+        TEST_ASSERT(CyFxUvcProbeFindFrame(fmt->formatIndex, frame->frameIndex) == frame, "Frame should be found by index");
+        TEST_ASSERT(frame->vidFrameCount > 0, "Every frame should have stored video frames");
+
+        for (int v = 0, offset = 0; v < frame->vidFrameCount; offset += frame->vidFrameLen_p[v++]) {
+            const uint8_t *jpeg = frame->vidFrames_p + offset;
+            TEST_ASSERT(jpeg[0] == 0xFF && jpeg[1] == 0xD8, "Stored frames should start with a JPEG SOI marker");
+            if (frame->vidFrameLen_p[v] > size) size = frame->vidFrameLen_p[v];
+        }
+        TEST_ASSERT(size == frame->maxFrameBufSize, "Frame buffer size should be the largest stored frame");
+
+        for (int i = 0; i < frame->intervalCount; i++) {
+            uint32_t interval = frame->interval_p[i];
+
+            memset(probe, 0, sizeof(probe));
+            probe[2] = fmt->formatIndex;
+            probe[3] = frame->frameIndex;
+            probe[4] = interval & 0xFF;
+            probe[5] = (interval >> 8) & 0xFF;
+            probe[6] = (interval >> 16) & 0xFF;
+            probe[7] = (interval >> 24) & 0xFF;
+            TEST_ASSERT(iso_negotiate(CY_U3P_SUPER_SPEED, probe, sizeof(probe), &ctrl), "Negotiation should succeed");
+            TEST_ASSERT(ctrl.bFrameIndex == frame->frameIndex, "Requested frame should be kept");
+            TEST_ASSERT(ctrl.dwFrameInterval == interval, "Supported interval should be kept");
+            TEST_ASSERT(ctrl.dwMaxVideoFrameSize == size, "Frame size should match the frames stored for the frame");
+        }
+    }
+
+    TEST_PASS();
+}
+
+/**
+ * Test the uncompressed formats: the frame size follows from the pixel format, and frame intervals that
+ * need more bandwidth than the endpoint has are replaced by a longer interval that fits
+ */
+int test_iso_probe_uncompressed()
+{
+    static const CyU3PUSBSpeed_t speeds[] = { CY_U3P_HIGH_SPEED, CY_U3P_SUPER_SPEED };
+    uint8_t probe[CY_FX_UVC_PROBE_LEN_UVC11];
+    CyFxUvcProbeCtrl_t ctrl;
+    CyFxUvcEpGeometry_t ep;
+    int generated = 0, longer = 0;
+
+    for (int s = 0; s < 2; s++) {
+        TEST_ASSERT(CyFxUvcProbeGetEpGeometry(speeds[s], &ep) == CY_U3P_SUCCESS, "Speed should be supported");
+
+        for (int f = 0; f < glUvcFormatCount; f++) {
+            const CyFxUvcFormatInfo_t *fmt = &glUvcFormats[f];
+
+            for (int r = 0; r < fmt->frameCount; r++) {
+                const CyFxUvcFrameInfo_t *frame = &fmt->frame_p[r];
+                uint32_t bpp = (frame->pattern == CY_FX_UVC_PATTERN_YUY2) ? 16 : 12;
+
+                if (frame->vidFrameCount != 0 || frame->layerCount != 0) continue;
+                generated++;
+                TEST_ASSERT(frame->pattern != CY_FX_UVC_PATTERN_NONE, "Generated frames should name a pattern");
+                TEST_ASSERT(frame->maxFrameBufSize == (uint32_t)frame->width * frame->height * bpp / 8,
+                            "Frame size should follow from the pixel format");
+
+                for (int i = 0; i < frame->intervalCount; i++) {
+                    uint32_t interval = frame->interval_p[i];
+
+                    memset(probe, 0, sizeof(probe));
+                    probe[2] = fmt->formatIndex;
+                    probe[3] = frame->frameIndex;
+                    probe[4] = interval & 0xFF;
+                    probe[5] = (interval >> 8) & 0xFF;
+                    probe[6] = (interval >> 16) & 0xFF;
+                    TEST_ASSERT(iso_negotiate(speeds[s], probe, sizeof(probe), &ctrl), "Negotiation should succeed");
+                    TEST_ASSERT(ctrl.bFormatIndex == fmt->formatIndex && ctrl.bFrameIndex == frame->frameIndex,
+                                "Requested format and frame should be kept");
+                    TEST_ASSERT(ctrl.dwMaxVideoFrameSize == frame->maxFrameBufSize, "Frame size should be the full frame");
+                    TEST_ASSERT(ctrl.dwFrameInterval >= interval, "Interval should not get shorter");
+                    TEST_ASSERT(ctrl.dwMaxPayloadTransferSize <= ep.maxPayload, "Payload should fit the endpoint");
+                    if (ctrl.dwFrameInterval != interval) longer++;
+                }
+            }
+        }
+    }
+
+    TEST_ASSERT(generated > 0, "There should be generated frames");
+    TEST_ASSERT(longer > 0, "Some uncompressed frame rates should exceed the link and be slowed down");
+    TEST_PASS();
+}
+
+/**
+ * Test the negotiation of the H.264 format and the stored access units
+ */
+int test_iso_probe_h264()
+{
+    static const CyU3PUSBSpeed_t speeds[] = { CY_U3P_HIGH_SPEED, CY_U3P_SUPER_SPEED };
+    static const uint8_t idr_start[] = { 0x00, 0x00, 0x00, 0x01, 0x67, 0x42 };
+    uint8_t probe[CY_FX_UVC_PROBE_LEN_UVC15];
+    CyFxUvcProbeCtrl_t ctrl;
+    int streams = 0;
+
+    for (int s = 0; s < 2; s++) {
+        for (int f = 0; f < glUvcFormatCount; f++) {
+            const CyFxUvcFormatInfo_t *fmt = &glUvcFormats[f];
+
+            for (int r = 0; r < fmt->frameCount; r++) {
+                const CyFxUvcFrameInfo_t *frame = &fmt->frame_p[r];
+                uint32_t start = 0, largest = 0;
+
+                memset(probe, 0, sizeof(probe));
+                probe[2] = fmt->formatIndex;
+                probe[3] = frame->frameIndex;
+                TEST_ASSERT(iso_negotiate(speeds[s], probe, sizeof(probe), &ctrl), "Negotiation should succeed");
+                if (fmt->subtype == CY_FX_UVC_VS_FORMAT_H264_SIMULCAST) continue;  // test_iso_simulcast
+                if (fmt->subtype != CY_FX_UVC_VS_FORMAT_H264) {
+                    TEST_ASSERT(ctrl.bUsage == 0 && ctrl.bmRateControlModes == 0, "UVC 1.5 fields should be unused");
+                    continue;
+                }
+                streams++;
+
+                // One Annex B access unit per video frame, the first an IDR with the SPS in front
+                TEST_ASSERT(frame->vidFrameCount > 1, "H.264 frames should be stored");
+                TEST_ASSERT(memcmp(frame->vidFrames_p, idr_start, sizeof(idr_start)) == 0,
+                            "The stream should start with a constrained baseline SPS");
+                for (int i = 0; i < frame->vidFrameCount; i++) {
+                    const uint8_t *au = frame->vidFrames_p + start;
+                    TEST_ASSERT(au[0] == 0 && au[1] == 0 && (au[2] == 1 || (au[2] == 0 && au[3] == 1)),
+                                "Each access unit should start with a start code");
+                    if (frame->vidFrameLen_p[i] > largest) largest = frame->vidFrameLen_p[i];
+                    start += frame->vidFrameLen_p[i];
+                }
+                // The first quality tier is the stream itself; the frame buffer holds the largest of any tier
+                TEST_ASSERT(frame->tierCount > 1 && frame->tier_p[0].vidFrames_p == frame->vidFrames_p,
+                            "The stream should be the first quality tier");
+                for (int t = 1; t < frame->tierCount; t++) {
+                    if (frame->tier_p[t].maxFrameLen > largest) largest = frame->tier_p[t].maxFrameLen;
+                }
+                TEST_ASSERT(largest == frame->maxFrameBufSize, "Frame buffer size should be the largest access unit");
+
+                TEST_ASSERT(ctrl.bFormatIndex == fmt->formatIndex && ctrl.bFrameIndex == frame->frameIndex,
+                            "Requested format and frame should be kept");
+                TEST_ASSERT(ctrl.dwMaxVideoFrameSize == largest, "Frame size should be the largest access unit");
+                TEST_ASSERT(ctrl.bmFramingInfo == (CY_FX_UVC_PROBE_FRAMING_FID | CY_FX_UVC_PROBE_FRAMING_EOF),
+                            "Frame ID and end of frame should be signalled");
+                TEST_ASSERT(ctrl.bUsage == CY_FX_UVC_PROBE_USAGE_REALTIME && ctrl.bBitDepthLuma == 0,
+                            "Stream should be a real time 8 bit stream");
+                TEST_ASSERT(ctrl.bMaxNumberOfRefFramesPlus1 == 2, "Stream should use one reference frame");
+                TEST_ASSERT(ctrl.bmRateControlModes == CY_FX_UVC_PROBE_RATE_CONTROL_CBR, "Rate control should be CBR");
+
+                // The compressed stream fits the link at every frame rate
+                for (int i = 0; i < frame->intervalCount; i++) {
+                    uint32_t interval = frame->interval_p[i];
+                    probe[4] = interval & 0xFF;
+                    probe[5] = (interval >> 8) & 0xFF;
+                    probe[6] = (interval >> 16) & 0xFF;
+                    TEST_ASSERT(iso_negotiate(speeds[s], probe, sizeof(probe), &ctrl), "Negotiation should succeed");
+                    TEST_ASSERT(ctrl.dwFrameInterval == interval, "Every H.264 frame rate should be kept");
+                }
+            }
+        }
+    }
+
+    TEST_ASSERT(streams > 0, "There should be an H.264 format");
+    TEST_PASS();
+}
+
+/**
+ * Test the negotiation of the H.265 (frame based) format and the stored access units
+ */
+int test_iso_probe_h265()
+{
+    static const CyU3PUSBSpeed_t speeds[] = { CY_U3P_HIGH_SPEED, CY_U3P_SUPER_SPEED };
+    static const uint8_t idr_start[] = { 0x00, 0x00, 0x00, 0x01, 0x40, 0x01 };
+    uint8_t probe[CY_FX_UVC_PROBE_LEN_UVC15];
+    CyFxUvcProbeCtrl_t ctrl;
+    int streams = 0;
+
+    for (int s = 0; s < 2; s++) {
+        for (int f = 0; f < glUvcFormatCount; f++) {
+            const CyFxUvcFormatInfo_t *fmt = &glUvcFormats[f];
+
+            for (int r = 0; r < fmt->frameCount; r++) {
+                const CyFxUvcFrameInfo_t *frame = &fmt->frame_p[r];
+                uint32_t largest = 0;
+
+                memset(probe, 0, sizeof(probe));
+                probe[2] = fmt->formatIndex;
+                probe[3] = frame->frameIndex;
+                TEST_ASSERT(iso_negotiate(speeds[s], probe, sizeof(probe), &ctrl), "Negotiation should succeed");
+                if (fmt->subtype == CY_FX_UVC_VS_FORMAT_MJPEG || fmt->subtype == CY_FX_UVC_VS_FORMAT_UNCOMPRESSED) {
+                    TEST_ASSERT(ctrl.bmFramingInfo == 0, "Framing information should be unused");
+                    continue;
+                }
+                if (fmt->subtype != CY_FX_UVC_VS_FORMAT_FRAME_BASED) continue;
+                streams++;
+
+                // One Annex B access unit per video frame, the first with the VPS in front
+                TEST_ASSERT(frame->vidFrameCount > 1, "H.265 frames should be stored");
+                TEST_ASSERT(memcmp(frame->vidFrames_p, idr_start, sizeof(idr_start)) == 0,
+                            "The stream should start with a video parameter set");
+                for (int i = 0; i < frame->vidFrameCount; i++) {
+                    if (frame->vidFrameLen_p[i] > largest) largest = frame->vidFrameLen_p[i];
+                }
+                TEST_ASSERT(largest == frame->maxFrameBufSize, "Frame buffer size should be the largest access unit");
+
+                TEST_ASSERT(ctrl.bFormatIndex == fmt->formatIndex && ctrl.bFrameIndex == frame->frameIndex,
+                            "Requested format and frame should be kept");
+                TEST_ASSERT(ctrl.dwMaxVideoFrameSize == largest, "Frame size should be the largest access unit");
+                TEST_ASSERT(ctrl.bmFramingInfo == (CY_FX_UVC_PROBE_FRAMING_FID | CY_FX_UVC_PROBE_FRAMING_EOF),
+                            "Frame ID and end of frame should be signalled");
+                TEST_ASSERT(ctrl.bUsage == 0 && ctrl.bmRateControlModes == 0, "UVC 1.5 fields should be unused");
+
+                for (int i = 0; i < frame->intervalCount; i++) {
+                    uint32_t interval = frame->interval_p[i];
+                    probe[4] = interval & 0xFF;
+                    probe[5] = (interval >> 8) & 0xFF;
+                    probe[6] = (interval >> 16) & 0xFF;
+                    TEST_ASSERT(iso_negotiate(speeds[s], probe, sizeof(probe), &ctrl), "Negotiation should succeed");
+                    TEST_ASSERT(ctrl.dwFrameInterval == interval, "Every H.265 frame rate should be kept");
+                }
+            }
+        }
+    }
+
+    TEST_ASSERT(streams > 0, "There should be an H.265 format");
+    TEST_PASS();
+}
+
+/**
+ * Test the quality tiers of the stored H.264 streams and the choice of tier for each rate control mode
+ */
+int test_iso_rate_tiers()
+{
+    CyFxUvcRateTarget_t target;
+    int streams = 0;
+
+    for (int f = 0; f < glUvcFormatCount; f++) {
+        const CyFxUvcFormatInfo_t *fmt = &glUvcFormats[f];
+
+        for (int r = 0; r < fmt->frameCount; r++) {
+            const CyFxUvcFrameInfo_t *frame = &fmt->frame_p[r];
+            uint32_t interval = frame->interval_p[0];
+            uint32_t payload  = CY_FX_UVC_MAX_HEADER + 1024;
+
+            memset(&target, 0, sizeof(target));
+            target.mode = CY_FX_UVC_RATE_CONTROL_CQP;
+            if (frame->tierCount == 0) {
+                TEST_ASSERT(CyFxUvcRateSelectTier(frame, interval, payload, &target) == 0, "Frames without tiers should use 0");
+                continue;
+            }
+            streams++;
+
+            // Every tier holds the same pictures, at rising QP and falling size
+            for (int t = 0; t < frame->tierCount; t++) {
+                const CyFxUvcTierInfo_t *tier = &frame->tier_p[t];
+                uint32_t total = 0, largest = 0, start = 0;
+
+                for (int i = 0; i < frame->vidFrameCount; i++) {
+                    const uint8_t *au = tier->vidFrames_p + start;
+                    TEST_ASSERT(au[0] == 0 && au[1] == 0 && (au[2] == 1 || (au[2] == 0 && au[3] == 1)),
+                                "Each access unit should start with a start code");
+                    total += tier->vidFrameLen_p[i];
+                    start += tier->vidFrameLen_p[i];
+                    if (tier->vidFrameLen_p[i] > largest) largest = tier->vidFrameLen_p[i];
+                }
+                TEST_ASSERT(tier->avgFrameLen == total / frame->vidFrameCount, "Average length should match the stream");
+                TEST_ASSERT(tier->maxFrameLen == largest, "Largest length should match the stream");
+                TEST_ASSERT(largest <= frame->maxFrameBufSize, "Every tier should fit the frame buffer");
+                if (t > 0) {
+                    TEST_ASSERT(tier->qp > frame->tier_p[t - 1].qp, "QP should rise from tier to tier");
+                    TEST_ASSERT(tier->avgFrameLen < frame->tier_p[t - 1].avgFrameLen, "Tiers should get smaller");
+                }
+            }
+
+            const CyFxUvcTierInfo_t *first = &frame->tier_p[0];
+            const CyFxUvcTierInfo_t *last  = &frame->tier_p[frame->tierCount - 1];
+
+            // Constant QP: the closest QP wins
+            target.qp = 0;
+            TEST_ASSERT(CyFxUvcRateSelectTier(frame, interval, payload, &target) == 0, "Lowest QP should pick the first tier");
+            target.qp = 51;
+            TEST_ASSERT(CyFxUvcRateSelectTier(frame, interval, payload, &target) == frame->tierCount - 1,
+                        "Highest QP should pick the last tier");
+            target.qp = frame->tier_p[1].qp;
+            TEST_ASSERT(CyFxUvcRateSelectTier(frame, interval, payload, &target) == 1, "Exact QP should pick its tier");
+
+            // CBR: the best tier within the average bit rate whose largest frame fits the CPB
+            target.mode       = CY_FX_UVC_RATE_CONTROL_CBR;
+            target.avgBitRate = CyFxUvcRateBitRate(CyFxUvcRateWireLength(first->avgFrameLen, payload), interval);
+            target.cpbSize    = frame->maxFrameBufSize;
+            TEST_ASSERT(CyFxUvcRateSelectTier(frame, interval, payload, &target) == 0, "A generous target should pick the first tier");
+            target.avgBitRate--;
+            TEST_ASSERT(CyFxUvcRateSelectTier(frame, interval, payload, &target) == 1, "A lower bit rate should drop a tier");
+            target.avgBitRate = CyFxUvcRateBitRate(first->avgFrameLen, interval);
+            TEST_ASSERT(CyFxUvcRateSelectTier(frame, interval, CY_FX_UVC_MAX_HEADER + 16, &target) != 0,
+                        "The payload headers should count against the bit rate");
+            target.avgBitRate = 0xFFFFFFFF;
+            target.cpbSize    = (CyFxUvcRateWireLength(frame->tier_p[1].maxFrameLen, payload) + 1) / CY_FX_UVC_SHAPER_CPB_UNIT;
+            if (first->maxFrameLen > frame->tier_p[1].maxFrameLen)
+                TEST_ASSERT(CyFxUvcRateSelectTier(frame, interval, payload, &target) == 1, "A smaller CPB should drop a tier");
+            target.avgBitRate = CyFxUvcRateBitRate(CyFxUvcRateWireLength(last->avgFrameLen, payload), interval) - 1;
+            TEST_ASSERT(CyFxUvcRateSelectTier(frame, interval, payload, &target) == frame->tierCount - 1,
+                        "An unreachable target should fall back to the last tier");
+
+            // VBR: the largest frame is checked against the peak bit rate instead of the CPB
+            target.mode        = CY_FX_UVC_RATE_CONTROL_VBR;
+            target.avgBitRate  = 0xFFFFFFFF;
+            target.cpbSize     = 0;
+            target.peakBitRate = CyFxUvcRateBitRate(CyFxUvcRateWireLength(first->maxFrameLen, payload), interval);
+            TEST_ASSERT(CyFxUvcRateSelectTier(frame, interval, payload, &target) == 0, "The peak should allow the first tier");
+            target.peakBitRate--;
+            TEST_ASSERT(CyFxUvcRateSelectTier(frame, interval, payload, &target) != 0, "The peak should count every header");
+            target.peakBitRate = 0;
+            TEST_ASSERT(CyFxUvcRateSelectTier(frame, interval, payload, &target) == frame->tierCount - 1,
+                        "An unreachable peak should fall back to the last tier");
+        }
+    }
+
+    TEST_ASSERT(streams > 0, "There should be a stream with quality tiers");
+    TEST_PASS();
+}
+
+/**
+ * Test the simulcast format: stored H.264 streams sent as layers that share the frame slots by weight,
+ * each access unit with a prefix NAL unit that carries the stream_id of its layer
+ */
+int test_iso_simulcast()
+{
+    static const uint8_t start_code[] = { 0x00, 0x00, 0x00, 0x01 };
+    uint8_t probe[CY_FX_UVC_PROBE_LEN_UVC15], prefix[CY_FX_UVC_LAYER_PREFIX_LEN];
+    uint32_t slots[CY_FX_UVC_LAYER_MAX];
+    CyFxUvcProbeCtrl_t ctrl;
+    CyFxUvcSimulcast_t sc;
+    int streams = 0;
+
+    for (int f = 0; f < glUvcFormatCount; f++) {
+        const CyFxUvcFormatInfo_t *fmt = &glUvcFormats[f];
+
+        for (int r = 0; r < fmt->frameCount; r++) {
+            const CyFxUvcFrameInfo_t *frame = &fmt->frame_p[r];
+            uint32_t largest = 0, idle = 0, rounds = 4;
+            uint8_t l;
+
+            if (frame->layerCount == 0) continue;
+            streams++;
+
+            // Every layer is a stored H.264 stream; the frame buffer holds the largest access unit and its prefix
+            TEST_ASSERT(fmt->subtype == CY_FX_UVC_VS_FORMAT_H264_SIMULCAST, "Layered frames should be simulcast frames");
+            TEST_ASSERT(frame->vidFrameCount == 0 && frame->pattern == CY_FX_UVC_PATTERN_NONE,
+                        "Simulcast frames should send the frames of their layers");
+            TEST_ASSERT(frame->layerCount >= 2 && frame->layerCount <= CY_FX_UVC_LAYER_MAX, "Layer count should fit");
+            for (l = 0; l < frame->layerCount; l++) {
+                const CyFxUvcFrameInfo_t *src = frame->layer_p[l].frame_p;
+                TEST_ASSERT(src->vidFrameCount > 1 && src->layerCount == 0, "Layers should be stored H.264 streams");
+                TEST_ASSERT(frame->layer_p[l].weight != 0, "Every layer should get frame slots");
+                if (src->maxFrameBufSize > largest) largest = src->maxFrameBufSize;
+            }
+            TEST_ASSERT(frame->maxFrameBufSize == largest + CY_FX_UVC_LAYER_PREFIX_LEN,
+                        "Frame buffer size should be the largest access unit with its prefix");
+
+            // Whole access units with the frame boundaries marked, every layer a CBR stream
+            memset(probe, 0, sizeof(probe));
+            probe[2] = fmt->formatIndex;
+            probe[3] = frame->frameIndex;
+            TEST_ASSERT(iso_negotiate(CY_U3P_SUPER_SPEED, probe, sizeof(probe), &ctrl), "Negotiation should succeed");
+            TEST_ASSERT(ctrl.dwMaxVideoFrameSize == frame->maxFrameBufSize, "Frame size should cover every layer");
+            TEST_ASSERT(ctrl.bmFramingInfo == (CY_FX_UVC_PROBE_FRAMING_FID | CY_FX_UVC_PROBE_FRAMING_EOF),
+                        "Access units should be framed");
+            TEST_ASSERT(ctrl.bUsage == CY_FX_UVC_PROBE_USAGE_REALTIME, "Usage should be real time");
+            for (l = 0; l < CY_FX_UVC_LAYER_MAX; l++) {
+                uint8_t mode = (ctrl.bmRateControlModes >> (l * CY_FX_UVC_PROBE_RATE_CONTROL_BITS)) & 0x0F;
+                TEST_ASSERT(mode == ((l < frame->layerCount) ? CY_FX_UVC_PROBE_RATE_CONTROL_CBR : 0),
+                            "Every layer, and only those, should have a rate control mode");
+            }
+
+            // Every layer gets its weight in slots of each totalWeight slots, and goes through its stream
+            CyFxUvcLayerStart(&sc, frame);
+            TEST_ASSERT(sc.count == frame->layerCount, "Every layer should be scheduled");
+            memset(slots, 0, sizeof(slots));
+            for (uint32_t n = 0; n < rounds * sc.totalWeight; n++) {
+                l = CyFxUvcLayerNext(&sc);
+                TEST_ASSERT(l < sc.count, "Every slot should go to a running layer");
+                slots[l]++;
+                CyFxUvcLayerAdvance(&sc.layer[l], sc.layer[l].frame_p->vidFrameLen_p[sc.layer[l].frameIndex]);
+            }
+            for (l = 0; l < sc.count; l++) {
+                const CyFxUvcLayer_t *layer = &sc.layer[l];
+                uint32_t start = 0;
+                TEST_ASSERT(slots[l] == rounds * layer->weight && layer->frames == slots[l],
+                            "Layers should get the slots of their weights");
+                TEST_ASSERT(layer->frameIndex == layer->frames % layer->frame_p->vidFrameCount,
+                            "Layers should go round their streams");
+                for (uint32_t i = 0; i < layer->frameIndex; i++) start += layer->frame_p->vidFrameLen_p[i];
+                TEST_ASSERT(layer->frameStart == start, "Layers should keep their place in the stored frames");
+            }
+
+            // A stopped layer leaves its slots empty, and starts over from its IDR picture
+            TEST_ASSERT(CyFxUvcLayerSetStarted(&sc, sc.count, CyFalse) == CY_U3P_ERROR_BAD_ARGUMENT,
+                        "Unknown stream_id should be rejected");
+            TEST_ASSERT(CyFxUvcLayerSetStarted(&sc, 1, CyFalse) == CY_U3P_SUCCESS, "Layer should stop");
+            for (uint32_t n = 0; n < sc.totalWeight; n++) {
+                l = CyFxUvcLayerNext(&sc);
+                TEST_ASSERT(l != 1, "A stopped layer should not be sent");
+                if (l == CY_FX_UVC_LAYER_NONE) idle++;
+                else CyFxUvcLayerAdvance(&sc.layer[l], sc.layer[l].frame_p->vidFrameLen_p[sc.layer[l].frameIndex]);
+            }
+            TEST_ASSERT(idle == sc.layer[1].weight, "The slots of a stopped layer should stay empty");
+            TEST_ASSERT(CyFxUvcLayerSetStarted(&sc, 1, CyTrue) == CY_U3P_SUCCESS, "Layer should start");
+            while ((l = CyFxUvcLayerNext(&sc)) != 1) {
+                CyFxUvcLayerAdvance(&sc.layer[l], sc.layer[l].frame_p->vidFrameLen_p[sc.layer[l].frameIndex]);
+            }
+            TEST_ASSERT(sc.layer[1].frameIndex == 0 && sc.layer[1].frameStart == 0,
+                        "A restarted layer should start from its IDR picture");
+
+            // A sync frame starts every layer over
+            CyFxUvcLayerAdvance(&sc.layer[0], sc.layer[0].frame_p->vidFrameLen_p[sc.layer[0].frameIndex]);
+            CyFxUvcLayerSync(&sc);
+            for (l = 0; l < sc.count; l++) {
+                TEST_ASSERT(sc.layer[l].frameIndex == 0 && sc.layer[l].frameStart == 0,
+                            "A sync frame should send every layer from its IDR picture");
+            }
+
+            // The prefix NAL unit carries the stream_id in priority_id, and the IDR flag
+            TEST_ASSERT(CyFxUvcLayerPrefix(1, CyTrue, prefix) == CY_FX_UVC_LAYER_PREFIX_LEN, "Prefix length");
+            TEST_ASSERT(memcmp(prefix, start_code, sizeof(start_code)) == 0 && (prefix[4] & 0x1F) == 14,
+                        "Prefix should be a prefix NAL unit");
+            TEST_ASSERT((prefix[5] & 0x3F) == 1 && (prefix[5] & 0x40) != 0, "Prefix should carry the stream_id and IDR flag");
+            CyFxUvcLayerPrefix(0, CyFalse, prefix);
+            TEST_ASSERT((prefix[5] & 0x7F) == 0, "Prefix of a non-IDR picture of layer 0");
+        }
+    }
+
+    TEST_ASSERT(streams > 0, "There should be a simulcast stream");
+    TEST_PASS();
+}
+
+/**
+ * Whether a NAL unit starts at i: a three byte start code there, or a four byte one
+ */
+static int iso_nal_start(const uint8_t *au, uint32_t len, uint32_t i)
+{
+    if (i + 3 <= len && au[i] == 0 && au[i + 1] == 0 && au[i + 2] == 1) return 1;
+    return i + 4 <= len && au[i] == 0 && au[i + 1] == 0 && au[i + 2] == 0 && au[i + 3] == 1;
+}
+
+/**
+ * Cut an access unit into payloads of room bytes aligned to its NAL units, as the streamer does, and
+ * check that every NAL unit is sent whole in one payload or starts one
+ */
+static int iso_check_slices(const uint8_t *au, uint32_t len, uint32_t room)
+{
+    uint32_t offset = 0, cut;
+    int split = 0;
+
+    while (offset < len) {
+        cut = CyFxUvcSliceCut(au, len, offset, room);
+        if (cut == 0) cut = room;
+        if (cut > room || offset + cut > len) return 0;
+
+        // A payload starts with a NAL unit, or goes on with one that was too large for the one before
+        if (!split && !iso_nal_start(au, len, offset)) return 0;
+
+        // A NAL unit that starts after the first byte ends in the payload
+        split = 1;
+        for (uint32_t i = offset + 1; i < offset + cut; i++) {
+            if (iso_nal_start(au, len, i) && au[i - 1] != 0) split = 0;
+        }
+        if (!split && offset + cut < len && !iso_nal_start(au, len, offset + cut)) return 0;
+        if (offset + cut == len || iso_nal_start(au, len, offset + cut)) split = 0;
+        offset += cut;
+    }
+    return 1;
+}
+
+/**
+ * Test the payload alignment to the NAL units of the stored H.264 and H.265 streams
+ */
+int test_iso_slice_alignment()
+{
+    // Parameter sets of 7 and 6 bytes behind four byte start codes, then a slice behind a three byte one
+    static const uint8_t au[] = {
+        0x00, 0x00, 0x00, 0x01, 0x67, 0x42, 0xC0,
+        0x00, 0x00, 0x00, 0x01, 0x68, 0xCE,
+        0x00, 0x00, 0x01, 0x65, 0x88, 0x84, 0x00, 0x03, 0x01, 0x00, 0x00, 0x03, 0x00, 0x01, 0x21, 0x7F, 0x10
+    };
+    static const uint32_t rooms[] = { 16, 100, 1012, 3060 };
+    int streams = 0;
+
+    TEST_ASSERT(CyFxUvcSliceCut(au, sizeof(au), 0, sizeof(au)) == sizeof(au), "A whole access unit should fit");
+    TEST_ASSERT(CyFxUvcSliceCut(au, sizeof(au), 0, 9) == 7, "Payload should end where the next NAL unit starts");
+    TEST_ASSERT(CyFxUvcSliceCut(au, sizeof(au), 0, 7) == 7, "A NAL unit that fills the payload should be sent whole");
+    TEST_ASSERT(CyFxUvcSliceCut(au, sizeof(au), 0, 6) == 0, "A NAL unit larger than the payload should be split");
+    TEST_ASSERT(CyFxUvcSliceCut(au, sizeof(au), 7, 9) == 6, "Three byte start codes should be found");
+    TEST_ASSERT(CyFxUvcSliceCut(au, sizeof(au), 7, 6) == 6, "A start code right after the payload should end it");
+    TEST_ASSERT(CyFxUvcSliceCut(au, sizeof(au), 13, 12) == 0, "Emulation prevented data should not end a slice");
+    TEST_ASSERT(CyFxUvcSliceCut(au, sizeof(au), 25, 5) == 5, "The end of a split NAL unit should fit");
+
+    for (int f = 0; f < glUvcFormatCount; f++) {
+        const CyFxUvcFormatInfo_t *fmt = &glUvcFormats[f];
+
+        TEST_ASSERT(fmt->isAnnexB == (fmt->subtype == CY_FX_UVC_VS_FORMAT_H264 ||
+                                      fmt->subtype == CY_FX_UVC_VS_FORMAT_H264_SIMULCAST ||
+                                      fmt->subtype == CY_FX_UVC_VS_FORMAT_FRAME_BASED),
+                    "Isochronous H.264 and H.265 formats, and only those, should be Annex B streams");
+        if (!fmt->isAnnexB) continue;
+
+        for (int r = 0; r < fmt->frameCount; r++) {
+            const CyFxUvcFrameInfo_t *frame = &fmt->frame_p[r];
+            uint32_t start = 0;
+
+            if (frame->layerCount != 0) continue;
+            streams++;
+            for (uint32_t i = 0; i < frame->vidFrameCount; i++) {
+                TEST_ASSERT(iso_nal_start(frame->vidFrames_p, start + 4, start),
+                            "Isochronous access units should start with a start code");
+                for (uint32_t k = 0; k < sizeof(rooms) / sizeof(rooms[0]); k++) {
+                    TEST_ASSERT(iso_check_slices(frame->vidFrames_p + start, frame->vidFrameLen_p[i], rooms[k]),
+                                "Isochronous payloads should hold whole NAL units or start with one");
+                }
+                start += frame->vidFrameLen_p[i];
+            }
+        }
+    }
+    TEST_ASSERT(streams != 0, "Isochronous stored Annex B streams should be checked");
+    TEST_PASS();
+}
+
+/**
+ * Test the payload size negotiated in the target compressed size per slice mode: the Annex B payloads
+ * are made large enough to hold a slice of the target size whole, so that the first payload of an
+ * access unit ends where a NAL unit starts instead of splitting the parameter sets
+ */
+int test_iso_slice_payload()
+{
+    static CyFxUvcProbeState_t st;
+    CyFxUvcEpGeometry_t ep;
+    CyFxUvcProbeCtrl_t ctrl, sized, cur;
+    uint8_t probe[CY_FX_UVC_PROBE_LEN_UVC11] = {0};
+    uint32_t wanted;
+    int streams = 0;
+
+    TEST_ASSERT(CyFxUvcProbeGetEpGeometry(CY_U3P_SUPER_SPEED, &ep) == CY_U3P_SUCCESS, "SuperSpeed should be supported");
+    wanted = (ISO_SLICE_SIZE + CY_FX_UVC_MAX_HEADER < ep.maxPayload) ? ISO_SLICE_SIZE + CY_FX_UVC_MAX_HEADER : ep.maxPayload;
+
+    for (int f = 0; f < glUvcFormatCount; f++) {
+        const CyFxUvcFormatInfo_t *fmt = &glUvcFormats[f];
+
+        for (int r = 0; r < fmt->frameCount; r++) {
+            const CyFxUvcFrameInfo_t *frame = &fmt->frame_p[r];
+
+            memset(&ctrl, 0, sizeof(ctrl));
+            ctrl.bFormatIndex    = fmt->formatIndex;
+            ctrl.bFrameIndex     = frame->frameIndex;
+            ctrl.dwFrameInterval = frame->defInterval;
+            sized = ctrl;
+            CyFxUvcProbeNegotiate(&ctrl, &ep, 0);
+            CyFxUvcProbeNegotiate(&sized, &ep, ISO_SLICE_SIZE);
+            TEST_ASSERT(sized.dwFrameInterval == ctrl.dwFrameInterval, "The slice size should not change the interval");
+            if (!fmt->isAnnexB) {
+                TEST_ASSERT(sized.dwMaxPayloadTransferSize == ctrl.dwMaxPayloadTransferSize,
+                            "Only the Annex B payloads should be sized for a slice");
+                continue;
+            }
+            TEST_ASSERT(sized.dwMaxPayloadTransferSize >= ctrl.dwMaxPayloadTransferSize &&
+                        sized.dwMaxPayloadTransferSize >= wanted && sized.dwMaxPayloadTransferSize <= ep.maxPayload,
+                        "Isochronous payloads should hold a slice of the target size");
+            if (frame->vidFrameCount == 0) continue;
+            streams++;
+
+            // The first payload of the IDR access unit ends where a NAL unit starts, as the streamer cuts it
+            const uint8_t *au = frame->vidFrames_p;
+            uint32_t len  = frame->vidFrameLen_p[0];
+            uint32_t room = sized.dwMaxPayloadTransferSize - CY_FX_UVC_MAX_HEADER;
+            uint32_t cut  = CyFxUvcSliceCut(au, len, 0, room);
+            TEST_ASSERT(cut != 0 && (cut == len || iso_nal_start(au, len, cut)),
+                        "Isochronous payload boundary should land on a NAL unit start");
+            TEST_ASSERT(iso_check_slices(au, len, room), "Isochronous payloads should hold whole NAL units or start with one");
+        }
+    }
+    TEST_ASSERT(streams != 0, "Isochronous stored Annex B streams should be checked");
+
+    // The negotiation state offers the new size in the probe responses and keeps the committed values
+    CyFxUvcProbeInit(&st, CY_U3P_SUPER_SPEED);
+    for (int f = 0; f < glUvcFormatCount && probe[2] == 0; f++) {
+        if (glUvcFormats[f].isAnnexB && glUvcFormats[f].frame_p[0].vidFrameCount != 0) {
+            probe[2] = glUvcFormats[f].formatIndex;
+            probe[3] = glUvcFormats[f].frame_p[0].frameIndex;
+        }
+    }
+    TEST_ASSERT(CyFxUvcProbeSet(&st, CY_FX_USB_UVC_VS_PROBE_CONTROL, probe, sizeof(probe)) == CY_U3P_SUCCESS &&
+                CyFxUvcProbeSet(&st, CY_FX_USB_UVC_VS_COMMIT_CONTROL, st.curBuf, CY_FX_UVC_PROBE_LEN_UVC15) == CY_U3P_SUCCESS,
+                "An Annex B frame should be committed");
+    CyFxUvcProbeSetSliceSize(&st, ISO_SLICE_SIZE);
+    CyFxUvcProbeUnpack(&cur, st.curBuf, CY_FX_UVC_PROBE_LEN_UVC15);
+    TEST_ASSERT(cur.dwMaxPayloadTransferSize >= wanted, "GET_CUR on probe should offer the slice sized payload");
+    TEST_ASSERT(cur.dwMaxPayloadTransferSize != st.commit.dwMaxPayloadTransferSize ||
+                st.commit.dwMaxPayloadTransferSize >= wanted, "The committed payload size should be kept");
+    CyFxUvcProbeUnpack(&cur, st.maxBuf, CY_FX_UVC_PROBE_LEN_UVC15);
+    TEST_ASSERT(cur.dwMaxPayloadTransferSize >= wanted, "GET_MAX should offer the slice sized payload");
+    CyFxUvcProbeSetSliceSize(&st, 0);
+    TEST_ASSERT(memcmp(st.curBuf, st.commitBuf, CY_FX_UVC_PROBE_LEN_UVC15) == 0,
+                "Leaving the slice mode should offer the committed values again");
+    TEST_PASS();
+}
+
+/**
+ * Test the parameter sets repeated and the sync frames sent for the error resiliency control
+ */
+int test_iso_error_resiliency()
+{
+    // Parameter sets of 7 and 6 bytes, then the IDR slice
+    static const uint8_t idr[] = {
+        0x00, 0x00, 0x00, 0x01, 0x67, 0x42, 0xC0,
+        0x00, 0x00, 0x00, 0x01, 0x68, 0xCE,
+        0x00, 0x00, 0x01, 0x65, 0x88, 0x84, 0x00, 0x03, 0x01, 0x21, 0x7F
+    };
+    const uint16_t every4 = CY_FX_UVC_RESIL_PARAM_SETS | (4 << CY_FX_UVC_RESIL_PERIOD_POS);
+    CyFxUvcResil_t rs;
+    int streams = 0;
+
+    TEST_ASSERT(CyFxUvcResilParamSets(idr, sizeof(idr)) == 13, "Parameter sets should end at the IDR slice");
+    TEST_ASSERT(CyFxUvcResilParamSets(idr + 13, sizeof(idr) - 13) == 0, "A single NAL unit has no parameter sets");
+
+    // Every fourth access unit after the IDR picture, which carries them itself
+    CyFxUvcResilStart(&rs);
+    TEST_ASSERT(CyFxUvcResilFrame(&rs, every4, 0, CyTrue, 13, 100, 1000) == 0, "No repeat in front of the IDR picture");
+    for (int i = 1; i <= 8; i++) {
+        TEST_ASSERT(CyFxUvcResilFrame(&rs, every4, 0, CyFalse, 13, 50, 1000) == ((i % 4) ? 0 : 13),
+                    "Parameter sets should be repeated every fourth access unit");
+    }
+    TEST_ASSERT(rs.stats.accessUnits == 9 && rs.stats.paramSets == 2 && rs.stats.paramSetBytes == 26 &&
+                rs.stats.bytes == 100 + 8 * 50 + 26, "Isochronous resiliency overhead should be counted");
+
+    // The layers count their own access units; a frame without room tries again at the next one
+    CyFxUvcResilStart(&rs);
+    TEST_ASSERT(CyFxUvcResilFrame(&rs, CY_FX_UVC_RESIL_PARAM_SETS, 1, CyFalse, 13, 50, 1000) == 13,
+                "A period of 0 should repeat the parameter sets in front of every access unit");
+    for (int i = 1; i < 4; i++)
+        TEST_ASSERT(CyFxUvcResilFrame(&rs, every4, 0, CyFalse, 13, 50, 1000) == 0, "Layer 0 is not due yet");
+    TEST_ASSERT(CyFxUvcResilFrame(&rs, every4, 0, CyFalse, 13, 50, 12) == 0, "Parameter sets should fit in the frame");
+    TEST_ASSERT(CyFxUvcResilFrame(&rs, every4, 0, CyFalse, 13, 50, 13) == 13, "The next access unit should take them");
+    TEST_ASSERT(CyFxUvcResilFrame(&rs, CY_FX_UVC_RESIL_PARAM_SETS, 0, CyFalse, CY_FX_UVC_RESIL_PARAM_MAX + 1, 50,
+                                  1000) == 0 && rs.stats.paramSets == 2, "Long parameter sets are not repeated");
+    TEST_ASSERT(CyFxUvcResilFrame(&rs, 0, 0, CyFalse, 13, 50, 1000) == 0, "Nothing is repeated without the feature");
+
+    // Sync frames at least every CY_FX_UVC_RESIL_SYNC_MS, counted only when the limit brings them forward
+    CyFxUvcResilStart(&rs);
+    TEST_ASSERT(!CyFxUvcResilSyncDue(&rs, 0, 0, 5000), "No periodic sync frame without a period");
+    TEST_ASSERT(!CyFxUvcResilSyncDue(&rs, CY_FX_UVC_RESIL_SYNC, 0, CY_FX_UVC_RESIL_SYNC_MS - 1), "Sync frame not due yet");
+    TEST_ASSERT(CyFxUvcResilSyncDue(&rs, CY_FX_UVC_RESIL_SYNC, 0, CY_FX_UVC_RESIL_SYNC_MS), "Resiliency sync frame due");
+    CyFxUvcResilFrame(&rs, CY_FX_UVC_RESIL_SYNC, 0, CyTrue, 13, 100, 1000);
+    TEST_ASSERT(rs.stats.syncFrames == 1 && rs.stats.syncBytes == 100, "The sync frame should be counted");
+    TEST_ASSERT(CyFxUvcResilSyncDue(&rs, CY_FX_UVC_RESIL_SYNC, 500, 500) && !rs.isSync,
+                "A shorter sync frame interval is kept and not counted as overhead");
+    TEST_ASSERT(CyFxUvcResilSyncDue(&rs, CY_FX_UVC_RESIL_SYNC, 5000, CY_FX_UVC_RESIL_SYNC_MS) && rs.isSync,
+                "A longer sync frame interval is limited");
+
+    // The IDR access unit of every stored Annex B stream, and of each of its tiers, starts with parameter
+    // sets short enough to be repeated, and is followed by access units of one NAL unit
+    for (int f = 0; f < glUvcFormatCount; f++) {
+        const CyFxUvcFormatInfo_t *fmt = &glUvcFormats[f];
+
+        if (!fmt->isAnnexB) continue;
+        for (int r = 0; r < fmt->frameCount; r++) {
+            const CyFxUvcFrameInfo_t *frame = &fmt->frame_p[r];
+
+            for (int t = -1; t < (int)frame->tierCount; t++) {
+                const uint8_t *data = (t < 0) ? frame->vidFrames_p : frame->tier_p[t].vidFrames_p;
+                const uint32_t *lens = (t < 0) ? frame->vidFrameLen_p : frame->tier_p[t].vidFrameLen_p;
+                uint32_t len;
+
+                if (frame->layerCount != 0 || frame->vidFrameCount < 2) continue;
+                streams++;
+                len = CyFxUvcResilParamSets(data, lens[0]);
+                TEST_ASSERT(len != 0 && len <= CY_FX_UVC_RESIL_PARAM_MAX && iso_nal_start(data, lens[0], len),
+                            "Isochronous IDR access units should start with parameter sets");
+                TEST_ASSERT(CyFxUvcResilParamSets(data + lens[0], lens[1]) == 0,
+                            "Isochronous access units after the IDR picture should hold one NAL unit");
+            }
+        }
+    }
+    TEST_ASSERT(streams != 0, "Isochronous stored Annex B streams should be checked");
+    TEST_PASS();
+}
+
+/**
+ * Main test runner for isochronous probe tests
+ */
+int main(void)
+{
+    printf("UVC Isochronous Probe/Commit Negotiation Unit Tests\n");
+    printf("===================================================\n\n");
+
+    // Run all tests
+    RUN_TEST(test_iso_ep_geometry);
+    RUN_TEST(test_iso_probe_sizes_hs);
+    RUN_TEST(test_iso_probe_sizes_ss);
+    RUN_TEST(test_iso_probe_clamping);
+    RUN_TEST(test_iso_probe_limits);
+    RUN_TEST(test_iso_probe_lengths);
+    RUN_TEST(test_iso_probe_state);
+    RUN_TEST(test_iso_probe_frames);
+    RUN_TEST(test_iso_probe_uncompressed);
+    RUN_TEST(test_iso_probe_h264);
+    RUN_TEST(test_iso_probe_h265);
+    RUN_TEST(test_iso_rate_tiers);
+    RUN_TEST(test_iso_simulcast);
+    RUN_TEST(test_iso_slice_alignment);
+    RUN_TEST(test_iso_slice_payload);
+    RUN_TEST(test_iso_error_resiliency);
+
+    // Print results
+    printf("\n===================================================\n");
+    printf("Isochronous Probe Test Results: %d/%d passed\n", tests_passed, tests_total);
+
+    if (tests_passed == tests_total) {
+        printf("All isochronous probe tests PASSED! ✓\n");
+        return 0;
+    } else {
+        printf("Some isochronous probe tests FAILED! ✗\n");
+        return 1;
+    }
+}
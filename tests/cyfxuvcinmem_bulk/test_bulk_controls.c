@@ -11,10 +11,15 @@
 #include <stdint.h>
 #include <string.h>
 #include <assert.h>
+#include <cyu3error.h>
 
 // Include UVC headers for bulk implementation
 #include "../../cyfxuvcinmem_bulk/cyfxuvcinmem.h"
 
+// Descriptors generated into cyfxuvcdscr.c
+extern const uint8_t CyFxUSBSSConfigDscr[];
+extern const uint8_t CyFxUSBHSConfigDscr[];
+
 // Test framework macros
 #define TEST_ASSERT(condition, message) \
     do { \
@@ -265,6 +270,8 @@ int test_bulk_streaming_controls()
     // Test that streaming controls are properly defined for bulk
     TEST_ASSERT(CY_FX_USB_UVC_VS_PROBE_CONTROL != 0, "Bulk probe control should be defined");
     TEST_ASSERT(CY_FX_USB_UVC_VS_COMMIT_CONTROL != 0, "Bulk commit control should be defined");
+    TEST_ASSERT(CY_FX_USB_UVC_VS_STREAM_ERROR_CODE_CONTROL == 0x0600,
+                "Bulk VS_STREAM_ERROR_CODE_CONTROL should use selector 6");
 
     // Test probe setting structure size for bulk
     TEST_ASSERT(CY_FX_UVC_MAX_PROBE_SETTING > 0, "Bulk probe setting size should be positive");
@@ -317,6 +324,504 @@ int test_bulk_transfer_optimization()
     TEST_PASS();
 }
 
+/**
+ * Unit or terminal descriptor of the given subtype in the VC interface of a configuration descriptor
+ */
+static const uint8_t *find_bulk_vc_unit(const uint8_t *config, uint8_t subtype)
+{
+    uint16_t total = config[2] | (config[3] << 8);
+    int in_vc = 0;
+
+    for (uint16_t offset = 0; offset + 2 < total; offset += config[offset]) {
+        const uint8_t *d = config + offset;
+        if (d[1] == 0x04)
+            in_vc = (d[5] == 0x0E && d[6] == 0x01);
+        else if (in_vc && d[1] == 0x24 && d[2] == subtype)
+            return d;
+        if (d[0] == 0)
+            break;
+    }
+    return NULL;
+}
+
+/**
+ * Test that every control in the table is found by unit and selector, and nothing else is
+ */
+int test_bulk_control_lookup()
+{
+    TEST_ASSERT(glUvcCtrlCount > 0, "Bulk control table should not be empty");
+
+    for (int i = 0; i < glUvcCtrlCount; i++) {
+        const CyFxUvcCtrlInfo_t *ctrl = &glUvcCtrls[i];
+        TEST_ASSERT(CyFxUvcCtrlFind(ctrl->unitId, ctrl->selector) == ctrl,
+                    "Bulk control should be found by its unit and selector");
+        TEST_ASSERT(ctrl->unitId == CY_FX_UVC_CT_ID || ctrl->unitId == CY_FX_UVC_PU_ID || ctrl->unitId == CY_FX_UVC_EU_ID,
+                    "Bulk controls should belong to the camera terminal, processing unit or encoding unit");
+    }
+
+    TEST_ASSERT(CyFxUvcCtrlFind(CY_FX_UVC_EU_ID, 0) == NULL, "Bulk selector 0 should not be found");
+    TEST_ASSERT(CyFxUvcCtrlFind(CY_FX_UVC_EU_ID, CY_FX_UVC_EU_PROFILE_TOOLSET_CONTROL) == NULL,
+                "Bulk unimplemented encoding control should not be found");
+    TEST_ASSERT(CyFxUvcCtrlFind(CY_FX_UVC_EU_ID, 0xFF) == NULL, "Bulk selector beyond the unit should not be found");
+    TEST_ASSERT(CyFxUvcCtrlFind(1, CY_FX_UVC_EU_AVERAGE_BITRATE_CONTROL) == NULL,
+                "Bulk encoding selector on another unit should not be found");
+    TEST_ASSERT(CyFxUvcCtrlFind(0xFF, 1) == NULL, "Bulk unknown unit should not be found");
+
+    TEST_PASS();
+}
+
+/**
+ * Test the GET responses of every control
+ */
+int test_bulk_control_get_requests()
+{
+    static const uint8_t requests[] = {
+        CY_FX_USB_UVC_GET_MIN_REQ, CY_FX_USB_UVC_GET_MAX_REQ, CY_FX_USB_UVC_GET_RES_REQ, CY_FX_USB_UVC_GET_DEF_REQ
+    };
+    const uint8_t *buf, *def = NULL;
+    uint16_t len;
+
+    CyFxUvcCtrlInit();
+    for (int i = 0; i < glUvcCtrlCount; i++) {
+        const CyFxUvcCtrlInfo_t *ctrl = &glUvcCtrls[i];
+
+        TEST_ASSERT(CyFxUvcCtrlGet(ctrl, CY_FX_USB_UVC_GET_INFO_REQ, &buf, &len) == CY_U3P_SUCCESS && len == 1,
+                    "Bulk GET_INFO should return one byte");
+        TEST_ASSERT((buf[0] & CY_FX_UVC_CTRL_INFO_GET) != 0, "Bulk GET_INFO should report GET support");
+        TEST_ASSERT(CyFxUvcCtrlGet(ctrl, CY_FX_USB_UVC_GET_LEN_REQ, &buf, &len) == CY_U3P_SUCCESS && len == 2,
+                    "Bulk GET_LEN should return two bytes");
+        TEST_ASSERT((buf[0] | (buf[1] << 8)) == ctrl->length, "Bulk GET_LEN should give the control length");
+
+        for (int r = 0; r < 4; r++) {
+            TEST_ASSERT(CyFxUvcCtrlGet(ctrl, requests[r], &buf, &len) == CY_U3P_SUCCESS && len == ctrl->length,
+                        "Bulk GET_MIN/MAX/RES/DEF should return the control length");
+            def = buf;
+        }
+        TEST_ASSERT(CyFxUvcCtrlGet(ctrl, CY_FX_USB_UVC_GET_CUR_REQ, &buf, &len) == CY_U3P_SUCCESS && len == ctrl->length,
+                    "Bulk GET_CUR should return the control length");
+        TEST_ASSERT(memcmp(buf, def, len) == 0, "Bulk GET_CUR should return the default after init");
+        TEST_ASSERT(CyFxUvcCtrlGet(ctrl, CY_FX_USB_UVC_SET_CUR_REQ, &buf, &len) == CY_U3P_ERROR_NOT_SUPPORTED,
+                    "Bulk SET_CUR is not a GET request");
+    }
+
+    TEST_PASS();
+}
+
+/**
+ * Test SET_CUR range, resolution and length checks on the average bit rate control
+ */
+int test_bulk_control_set_cur()
+{
+    const CyFxUvcCtrlInfo_t *ctrl = CyFxUvcCtrlFind(CY_FX_UVC_EU_ID, CY_FX_UVC_EU_AVERAGE_BITRATE_CONTROL);
+    const uint8_t *min_buf, *res_buf;
+    uint8_t data[4];
+    uint32_t min, res, value;
+    uint16_t len;
+
+    TEST_ASSERT(ctrl != NULL, "Bulk average bit rate control should be implemented");
+    CyFxUvcCtrlInit();
+    CyFxUvcCtrlGet(ctrl, CY_FX_USB_UVC_GET_MIN_REQ, &min_buf, &len);
+    CyFxUvcCtrlGet(ctrl, CY_FX_USB_UVC_GET_RES_REQ, &res_buf, &len);
+    min = min_buf[0] | (min_buf[1] << 8) | (min_buf[2] << 16) | ((uint32_t)min_buf[3] << 24);
+    res = res_buf[0] | (res_buf[1] << 8) | (res_buf[2] << 16) | ((uint32_t)res_buf[3] << 24);
+
+    value = min + 10 * res;
+    memcpy(data, &value, 4);
+    TEST_ASSERT(CyFxUvcCtrlSet(ctrl, data, 4) == CY_U3P_SUCCESS, "Bulk value on a step should be accepted");
+    TEST_ASSERT(CyFxUvcCtrlField(ctrl, 0) == value, "Bulk GET_CUR should return the value set");
+
+    value = min - 1;
+    memcpy(data, &value, 4);
+    TEST_ASSERT(CyFxUvcCtrlSet(ctrl, data, 4) == CY_U3P_ERROR_BAD_ARGUMENT, "Bulk value below the minimum should be rejected");
+    value = 0xFFFFFFFF;
+    memcpy(data, &value, 4);
+    TEST_ASSERT(CyFxUvcCtrlSet(ctrl, data, 4) == CY_U3P_ERROR_BAD_ARGUMENT, "Bulk value above the maximum should be rejected");
+    if (res > 1) {
+        value = min + res + 1;
+        memcpy(data, &value, 4);
+        TEST_ASSERT(CyFxUvcCtrlSet(ctrl, data, 4) == CY_U3P_ERROR_BAD_ARGUMENT, "Bulk value off a step should be rejected");
+    }
+    TEST_ASSERT(CyFxUvcCtrlSet(ctrl, data, 3) == CY_U3P_ERROR_BAD_ARGUMENT, "Bulk short SET_CUR should be rejected");
+    TEST_ASSERT(CyFxUvcCtrlField(ctrl, 0) == min + 10 * res, "Bulk rejected values should leave the current value");
+
+    CyFxUvcCtrlInit();
+    TEST_PASS();
+}
+
+/**
+ * Test that the encoding unit descriptor reports exactly the controls of the table
+ */
+int test_bulk_control_bitmaps()
+{
+    const uint8_t *configs[2] = { CyFxUSBSSConfigDscr, CyFxUSBHSConfigDscr };
+    uint32_t controls = 0, runtime = 0;
+
+    for (int i = 0; i < glUvcCtrlCount; i++) {
+        if (glUvcCtrls[i].unitId != CY_FX_UVC_EU_ID)
+            continue;
+        controls |= 1u << (glUvcCtrls[i].selector - 1);
+    }
+
+    for (int c = 0; c < 2; c++) {
+        const uint8_t *eu = find_bulk_vc_unit(configs[c], CY_FX_UVC_VC_ENCODING_UNIT);
+        TEST_ASSERT(eu != NULL, "Bulk configuration should have an encoding unit");
+        TEST_ASSERT(eu[3] == CY_FX_UVC_EU_ID, "Bulk encoding unit ID should match CY_FX_UVC_EU_ID");
+        TEST_ASSERT(eu[6] == 3, "Bulk encoding unit bControlSize should be 3");
+        TEST_ASSERT((uint32_t)(eu[7] | (eu[8] << 8) | (eu[9] << 16)) == controls,
+                    "Bulk bmControls should list the controls of the table");
+        runtime = eu[10] | (eu[11] << 8) | (eu[12] << 16);
+        TEST_ASSERT((runtime & ~controls) == 0, "Bulk bmControlsRuntime should only list implemented controls");
+    }
+
+    TEST_PASS();
+}
+
+/**
+ * Test the sync and reference frame control, which the streamer answers with an IDR picture
+ */
+int test_bulk_sync_control()
+{
+    const CyFxUvcCtrlInfo_t *ctrl = CyFxUvcCtrlFind(CY_FX_UVC_EU_ID, CY_FX_UVC_EU_SYNC_REF_FRAME_CONTROL);
+    const uint8_t *buf;
+    uint16_t len;
+
+    TEST_ASSERT(ctrl != NULL, "Bulk sync and reference frame control should be implemented");
+    TEST_ASSERT(ctrl->length == 4 && ctrl->fieldSize[0] == 1 && ctrl->fieldSize[1] == 2 && ctrl->fieldSize[2] == 1,
+                "Bulk sync control should hold the frame type, interval and gradual refresh fields");
+    CyFxUvcCtrlGet(ctrl, CY_FX_USB_UVC_GET_INFO_REQ, &buf, &len);
+    TEST_ASSERT((buf[0] & CY_FX_UVC_CTRL_INFO_SET) != 0, "Bulk sync control should be settable");
+
+    // IDR (1) and random access (3) sync frames, with any interval; no long term reference types and no
+    // gradual decoder refresh
+    static const uint8_t idr[4]      = { 1, 0x00, 0x00, 0 };
+    static const uint8_t periodic[4] = { 3, 0xE8, 0x03, 0 };
+    static const uint8_t reserved[4] = { 0, 0x00, 0x00, 0 };
+    static const uint8_t unknown[4]  = { 2, 0x00, 0x00, 0 };
+    static const uint8_t gdr[4]      = { 1, 0x00, 0x00, 4 };
+
+    CyFxUvcCtrlInit();
+    TEST_ASSERT(CyFxUvcCtrlSet(ctrl, idr, 4) == CY_U3P_SUCCESS, "Bulk IDR sync frame should be accepted");
+    TEST_ASSERT(CyFxUvcCtrlSet(ctrl, periodic, 4) == CY_U3P_SUCCESS, "Bulk periodic random access frames should be accepted");
+    TEST_ASSERT(CyFxUvcCtrlField(ctrl, 0) == 3 && CyFxUvcCtrlField(ctrl, 1) == 1000,
+                "Bulk sync frame type and interval should be kept");
+    TEST_ASSERT(CyFxUvcCtrlSet(ctrl, reserved, 4) == CY_U3P_ERROR_BAD_ARGUMENT, "Bulk reset should be rejected");
+    TEST_ASSERT(CyFxUvcCtrlSet(ctrl, unknown, 4) == CY_U3P_ERROR_BAD_ARGUMENT, "Bulk long term reference type should be rejected");
+    TEST_ASSERT(CyFxUvcCtrlSet(ctrl, gdr, 4) == CY_U3P_ERROR_BAD_ARGUMENT, "Bulk gradual refresh should be rejected");
+    TEST_ASSERT(CyFxUvcCtrlField(ctrl, 1) == 1000, "Bulk rejected values should leave the interval");
+
+    CyFxUvcCtrlInit();
+    TEST_PASS();
+}
+
+/**
+ * Test the layer controls of the simulcast format: the select layer control takes the stream_id of
+ * wLayerOrViewID alone, and the start or stop layer control a flag
+ */
+int test_bulk_layer_controls()
+{
+    const CyFxUvcCtrlInfo_t *sel   = CyFxUvcCtrlFind(CY_FX_UVC_EU_ID, CY_FX_UVC_EU_SELECT_LAYER_CONTROL);
+    const CyFxUvcCtrlInfo_t *start = CyFxUvcCtrlFind(CY_FX_UVC_EU_ID, CY_FX_UVC_EU_START_OR_STOP_LAYER_CONTROL);
+    static const uint8_t layer1[2]     = { 0x00, 0x04 };    // stream_id 1
+    static const uint8_t dependency[2] = { 0x01, 0x04 };    // stream_id 1, dependency_id 1
+    static const uint8_t layer2[2]     = { 0x00, 0x08 };    // stream_id 2
+    static const uint8_t stop[1] = { 0 }, run[1] = { 1 }, other[1] = { 2 };
+
+    TEST_ASSERT(sel != NULL && start != NULL, "Bulk layer controls should be implemented");
+    TEST_ASSERT(sel->length == 2 && start->length == 1, "Bulk layer controls should be 2 and 1 bytes");
+
+    CyFxUvcCtrlInit();
+    TEST_ASSERT(CyFxUvcCtrlField(sel, 0) == 0 && CyFxUvcCtrlField(start, 0) == 1,
+                "Bulk layer 0 should be selected, and started");
+    TEST_ASSERT(CyFxUvcCtrlSet(sel, layer1, 2) == CY_U3P_SUCCESS, "Bulk second layer should be selectable");
+    TEST_ASSERT(((CyFxUvcCtrlField(sel, 0) & CY_FX_UVC_LAYER_STREAM_ID_MASK) >> CY_FX_UVC_LAYER_STREAM_ID_POS) == 1,
+                "Bulk stream_id should be kept");
+    TEST_ASSERT(CyFxUvcCtrlSet(sel, dependency, 2) == CY_U3P_ERROR_BAD_ARGUMENT,
+                "Bulk layers within a stream should be rejected");
+    TEST_ASSERT(CyFxUvcCtrlSet(sel, layer2, 2) == CY_U3P_ERROR_BAD_ARGUMENT, "Bulk unknown stream_id should be rejected");
+    TEST_ASSERT(CyFxUvcCtrlSet(start, stop, 1) == CY_U3P_SUCCESS && CyFxUvcCtrlField(start, 0) == 0,
+                "Bulk layer should be stopped");
+    TEST_ASSERT(CyFxUvcCtrlSet(start, run, 1) == CY_U3P_SUCCESS && CyFxUvcCtrlField(start, 0) == 1,
+                "Bulk layer should be started");
+    TEST_ASSERT(CyFxUvcCtrlSet(start, other, 1) == CY_U3P_ERROR_BAD_ARGUMENT, "Bulk start or stop should be a flag");
+
+    CyFxUvcCtrlInit();
+    TEST_PASS();
+}
+
+/**
+ * Test the slice mode control: the stored streams are sent as they are in the number of slices per frame
+ * mode, and with the payloads aligned to the NAL units in the target compressed size per slice mode
+ */
+int test_bulk_slice_control()
+{
+    const CyFxUvcCtrlInfo_t *ctrl = CyFxUvcCtrlFind(CY_FX_UVC_EU_ID, CY_FX_UVC_EU_SLICE_MODE_CONTROL);
+    static const uint8_t size[4]    = { CY_FX_UVC_SLICE_MODE_SIZE, 0x00, 0xB0, 0x04 };    // 1200 byte slices
+    static const uint8_t slices[4]  = { CY_FX_UVC_SLICE_MODE_SLICES, 0x00, 0x01, 0x00 };
+    static const uint8_t max_mbs[4] = { CY_FX_UVC_SLICE_MODE_MAX_MBS, 0x00, 0x63, 0x00 };
+    static const uint8_t rows[4]    = { CY_FX_UVC_SLICE_MODE_MB_ROWS, 0x00, 0x01, 0x00 };
+    static const uint8_t none[4]    = { CY_FX_UVC_SLICE_MODE_SIZE, 0x00, 0x00, 0x00 };
+
+    TEST_ASSERT(ctrl != NULL && ctrl->length == 4, "Bulk slice mode control should be implemented, 4 bytes");
+
+    CyFxUvcCtrlInit();
+    TEST_ASSERT(CyFxUvcCtrlField(ctrl, 0) == CY_FX_UVC_SLICE_MODE_SLICES && CyFxUvcCtrlField(ctrl, 1) == 1,
+                "Bulk streams should default to one slice per frame");
+    TEST_ASSERT(CyFxUvcCtrlSet(ctrl, size, 4) == CY_U3P_SUCCESS && CyFxUvcCtrlField(ctrl, 1) == 1200,
+                "Bulk target compressed size per slice should be settable");
+    TEST_ASSERT(CyFxUvcCtrlSet(ctrl, slices, 4) == CY_U3P_SUCCESS, "Bulk slices per frame should be settable");
+    TEST_ASSERT(CyFxUvcCtrlSet(ctrl, max_mbs, 4) == CY_U3P_ERROR_BAD_ARGUMENT &&
+                CyFxUvcCtrlSet(ctrl, rows, 4) == CY_U3P_ERROR_BAD_ARGUMENT,
+                "Bulk macroblock based slice modes should be rejected");
+    TEST_ASSERT(CyFxUvcCtrlSet(ctrl, none, 4) == CY_U3P_ERROR_BAD_ARGUMENT, "Bulk empty slices should be rejected");
+    TEST_ASSERT(CyFxUvcCtrlField(ctrl, 0) == CY_FX_UVC_SLICE_MODE_SLICES, "Bulk rejected values should not be kept");
+
+    CyFxUvcCtrlInit();
+    TEST_PASS();
+}
+
+/**
+ * Test the error resiliency control: off by default, and the features and period settable
+ */
+int test_bulk_resiliency_control()
+{
+    const CyFxUvcCtrlInfo_t *ctrl = CyFxUvcCtrlFind(CY_FX_UVC_EU_ID, CY_FX_UVC_EU_ERROR_RESILIENCY_CONTROL);
+    static const uint8_t both[2] = { CY_FX_UVC_RESIL_FEATURES, 30 };    // Every 30th access unit
+    static const uint8_t max[2]  = { CY_FX_UVC_RESIL_FEATURES, 0xFF };
+    static const uint8_t over[2] = { 0x04, 0xFF };
+
+    TEST_ASSERT(ctrl != NULL && ctrl->length == 2, "Bulk error resiliency control should be implemented, 2 bytes");
+
+    CyFxUvcCtrlInit();
+    TEST_ASSERT(CyFxUvcCtrlField(ctrl, 0) == 0, "Bulk error resiliency should be off by default");
+    TEST_ASSERT(CyFxUvcCtrlSet(ctrl, both, 2) == CY_U3P_SUCCESS &&
+                CyFxUvcCtrlField(ctrl, 0) == (CY_FX_UVC_RESIL_FEATURES | (30 << CY_FX_UVC_RESIL_PERIOD_POS)),
+                "Bulk error resiliency features and period should be settable");
+    TEST_ASSERT(CyFxUvcCtrlSet(ctrl, max, 2) == CY_U3P_SUCCESS, "Bulk longest period should be settable");
+    TEST_ASSERT(CyFxUvcCtrlSet(ctrl, over, 2) == CY_U3P_ERROR_BAD_ARGUMENT, "Bulk values above the maximum should be rejected");
+
+    CyFxUvcCtrlInit();
+    TEST_PASS();
+}
+
+/**
+ * Test the camera terminal and processing unit controls: bmControls from the table, and the limits
+ * and actions of the picture controls
+ */
+int test_bulk_picture_controls()
+{
+    static const struct { uint8_t unit, selector, bit; } picture[] = {
+        { CY_FX_UVC_CT_ID, CY_FX_UVC_CT_EXPOSURE_TIME_ABSOLUTE_CONTROL, 3 },
+        { CY_FX_UVC_PU_ID, CY_FX_UVC_PU_BRIGHTNESS_CONTROL, 0 },
+        { CY_FX_UVC_PU_ID, CY_FX_UVC_PU_CONTRAST_CONTROL, 1 },
+        { CY_FX_UVC_PU_ID, CY_FX_UVC_PU_GAIN_CONTROL, 9 },
+        { CY_FX_UVC_PU_ID, CY_FX_UVC_PU_SATURATION_CONTROL, 3 }
+    };
+    const uint8_t *configs[2] = { CyFxUSBSSConfigDscr, CyFxUSBHSConfigDscr };
+    const CyFxUvcCtrlInfo_t *ae    = CyFxUvcCtrlFind(CY_FX_UVC_CT_ID, CY_FX_UVC_CT_AE_MODE_CONTROL);
+    const CyFxUvcCtrlInfo_t *plf   = CyFxUvcCtrlFind(CY_FX_UVC_PU_ID, CY_FX_UVC_PU_POWER_LINE_FREQUENCY_CONTROL);
+    const CyFxUvcCtrlInfo_t *gain  = CyFxUvcCtrlFind(CY_FX_UVC_PU_ID, CY_FX_UVC_PU_GAIN_CONTROL);
+    uint32_t ct = 0x02, pu = 0x0400;    // AE mode, power line frequency
+    const uint8_t *buf;
+    uint8_t data[2];
+    uint16_t len;
+
+    for (unsigned i = 0; i < sizeof(picture) / sizeof(picture[0]); i++) {
+        const CyFxUvcCtrlInfo_t *ctrl = CyFxUvcCtrlFind(picture[i].unit, picture[i].selector);
+        TEST_ASSERT(ctrl != NULL && ctrl->apply == CY_FX_UVC_CTRL_APPLY_PICTURE,
+                    "Bulk picture controls should be implemented and adjust the generated frames");
+        if (picture[i].unit == CY_FX_UVC_CT_ID)
+            ct |= 1u << picture[i].bit;
+        else
+            pu |= 1u << picture[i].bit;
+    }
+    TEST_ASSERT(ae != NULL && plf != NULL && ae->apply == CY_FX_UVC_CTRL_APPLY_NONE && plf->apply == CY_FX_UVC_CTRL_APPLY_NONE,
+                "Bulk AE mode and power line frequency controls should only be stored");
+    TEST_ASSERT(CyFxUvcCtrlFind(CY_FX_UVC_PU_ID, CY_FX_UVC_PU_HUE_CONTROL) == NULL,
+                "Bulk unimplemented processing unit control should not be found");
+
+    for (int c = 0; c < 2; c++) {
+        const uint8_t *it = find_bulk_vc_unit(configs[c], 0x02);
+        const uint8_t *pr = find_bulk_vc_unit(configs[c], 0x05);
+        TEST_ASSERT(it != NULL && it[3] == CY_FX_UVC_CT_ID && pr != NULL && pr[3] == CY_FX_UVC_PU_ID,
+                    "Bulk camera terminal and processing unit IDs should match CY_FX_UVC_CT_ID and CY_FX_UVC_PU_ID");
+        TEST_ASSERT((uint32_t)(it[15] | (it[16] << 8) | (it[17] << 16)) == ct,
+                    "Bulk camera terminal bmControls should list the controls of the table");
+        TEST_ASSERT((uint32_t)(pr[8] | (pr[9] << 8) | (pr[10] << 16)) == pu,
+                    "Bulk processing unit bmControls should list the controls of the table");
+    }
+
+    // Manual exposure is the only mode: GET_RES reports it as the only supported mode
+    CyFxUvcCtrlInit();
+    CyFxUvcCtrlGet(ae, CY_FX_USB_UVC_GET_RES_REQ, &buf, &len);
+    TEST_ASSERT(len == 1 && buf[0] == 1 && CyFxUvcCtrlField(ae, 0) == 1, "Bulk AE mode should be manual only");
+    data[0] = 8;
+    TEST_ASSERT(CyFxUvcCtrlSet(ae, data, 1) == CY_U3P_ERROR_BAD_ARGUMENT, "Bulk aperture priority mode should be rejected");
+
+    // Gain is in percent, from unity up
+    TEST_ASSERT(CyFxUvcCtrlField(gain, 0) == CY_FX_UVC_PICTURE_PERCENT, "Bulk gain should default to unity");
+    data[0] = 50;
+    data[1] = 0;
+    TEST_ASSERT(CyFxUvcCtrlSet(gain, data, 2) == CY_U3P_ERROR_BAD_ARGUMENT, "Bulk gain below unity should be rejected");
+    data[0] = 0x90;
+    data[1] = 0x01;
+    TEST_ASSERT(CyFxUvcCtrlSet(gain, data, 2) == CY_U3P_SUCCESS && CyFxUvcCtrlField(gain, 0) == 400,
+                "Bulk gain of 400% should be settable");
+
+    CyFxUvcCtrlInit();
+    TEST_PASS();
+}
+
+int test_bulk_request_error_codes()
+{
+    const CyFxUvcCtrlInfo_t *gain    = CyFxUvcCtrlFind(CY_FX_UVC_PU_ID, CY_FX_UVC_PU_GAIN_CONTROL);
+    const CyFxUvcCtrlInfo_t *bitrate = CyFxUvcCtrlFind(CY_FX_UVC_EU_ID, CY_FX_UVC_EU_AVERAGE_BITRATE_CONTROL);
+    const uint8_t *buf;
+    uint8_t data[4] = { 0x41, 0x1F, 0, 0 };     // 8001: within the bitrate limits, off the 1000 step
+    uint16_t len;
+
+    // The table knows the subtype of every unit and terminal, so a missing unit and a missing control differ
+    TEST_ASSERT(glUvcCtrlUnits[CY_FX_UVC_CT_ID].subtype == 0x02 && glUvcCtrlUnits[CY_FX_UVC_PU_ID].subtype == 0x05 &&
+                glUvcCtrlUnits[CY_FX_UVC_EU_ID].subtype == 0x07 && glUvcCtrlUnits[0].subtype == 0,
+                "Bulk control table should hold the descriptor subtype of each unit");
+    CyFxUvcCtrlInit();
+    TEST_ASSERT(CyFxUvcCtrlErrorGet(CY_FX_UVC_CTRL_ERROR_REQUEST, CY_FX_USB_UVC_GET_CUR_REQ, &buf, &len) == CY_U3P_SUCCESS &&
+                len == 1 && buf[0] == CY_FX_UVC_CTRL_ERR_NONE, "Bulk request error code should start out clear");
+    TEST_ASSERT(CyFxUvcCtrlLookup(glUvcCtrlUnitCount, 1) == NULL && buf[0] == CY_FX_UVC_CTRL_ERR_INVALID_UNIT,
+                "Bulk request on an unknown unit should report an invalid unit");
+    TEST_ASSERT(CyFxUvcCtrlLookup(0, 1) == NULL && buf[0] == CY_FX_UVC_CTRL_ERR_INVALID_UNIT,
+                "Bulk request on unit ID 0 should report an invalid unit");
+    TEST_ASSERT(CyFxUvcCtrlLookup(CY_FX_UVC_PU_ID, CY_FX_UVC_PU_HUE_CONTROL) == NULL &&
+                buf[0] == CY_FX_UVC_CTRL_ERR_INVALID_CONTROL,
+                "Bulk request on an unimplemented control should report an invalid control");
+    TEST_ASSERT(CyFxUvcCtrlLookup(CY_FX_UVC_PU_ID, CY_FX_UVC_PU_GAIN_CONTROL) == gain && gain != NULL,
+                "Bulk lookup of an implemented control should find it");
+
+    // Each request records its own outcome, and reading the error code leaves it in place
+    TEST_ASSERT(CyFxUvcCtrlGet(gain, 0x99, &buf, &len) == CY_U3P_ERROR_NOT_SUPPORTED, "Bulk unknown request should be stalled");
+    CyFxUvcCtrlErrorGet(CY_FX_UVC_CTRL_ERROR_REQUEST, CY_FX_USB_UVC_GET_CUR_REQ, &buf, &len);
+    TEST_ASSERT(buf[0] == CY_FX_UVC_CTRL_ERR_INVALID_REQUEST, "Bulk unknown request should report an invalid request");
+    TEST_ASSERT(CyFxUvcCtrlSet(gain, data, 1) == CY_U3P_ERROR_BAD_ARGUMENT && buf[0] == CY_FX_UVC_CTRL_ERR_INVALID_REQUEST,
+                "Bulk SET_CUR of the wrong length should report an invalid request");
+    TEST_ASSERT(CyFxUvcCtrlSet(bitrate, data, 4) == CY_U3P_ERROR_BAD_ARGUMENT && buf[0] == CY_FX_UVC_CTRL_ERR_INVALID_VALUE,
+                "Bulk SET_CUR off the resolution step should report an invalid value");
+    data[0] = 50;
+    data[1] = 0;
+    TEST_ASSERT(CyFxUvcCtrlSet(gain, data, 2) == CY_U3P_ERROR_BAD_ARGUMENT && buf[0] == CY_FX_UVC_CTRL_ERR_OUT_OF_RANGE,
+                "Bulk SET_CUR below the minimum should report out of range");
+    TEST_ASSERT(CyFxUvcCtrlErrorGet(CY_FX_UVC_CTRL_ERROR_REQUEST, CY_FX_USB_UVC_GET_MIN_REQ, &buf, &len) == CY_U3P_ERROR_NOT_SUPPORTED,
+                "Bulk error code control should only support GET_CUR and GET_INFO");
+    CyFxUvcCtrlErrorGet(CY_FX_UVC_CTRL_ERROR_REQUEST, CY_FX_USB_UVC_GET_CUR_REQ, &buf, &len);
+    TEST_ASSERT(buf[0] == CY_FX_UVC_CTRL_ERR_OUT_OF_RANGE, "Bulk reading the error code control should not change it");
+    TEST_ASSERT(CyFxUvcCtrlGet(gain, CY_FX_USB_UVC_GET_CUR_REQ, &buf, &len) == CY_U3P_SUCCESS, "Bulk GET_CUR should succeed");
+    CyFxUvcCtrlErrorGet(CY_FX_UVC_CTRL_ERROR_REQUEST, CY_FX_USB_UVC_GET_CUR_REQ, &buf, &len);
+    TEST_ASSERT(buf[0] == CY_FX_UVC_CTRL_ERR_NONE, "Bulk successful request should clear the request error code");
+    CyFxUvcCtrlRequestDone(CY_FX_UVC_CTRL_ERR_WRONG_STATE);
+    TEST_ASSERT(buf[0] == CY_FX_UVC_CTRL_ERR_WRONG_STATE, "Bulk request turned down by the firmware should record its code");
+    TEST_ASSERT(CyFxUvcCtrlErrorGet(CY_FX_UVC_CTRL_ERROR_REQUEST, CY_FX_USB_UVC_GET_INFO_REQ, &buf, &len) == CY_U3P_SUCCESS &&
+                len == 1 && buf[0] == CY_FX_UVC_CTRL_INFO_GET, "Bulk error code control should be read only");
+
+    // The stream error code is kept until the next stream start
+    CyFxUvcCtrlStreamError(CY_FX_UVC_STREAM_ERR_UNDERRUN);
+    TEST_ASSERT(CyFxUvcCtrlErrorGet(CY_FX_UVC_CTRL_ERROR_STREAM, CY_FX_USB_UVC_GET_CUR_REQ, &buf, &len) == CY_U3P_SUCCESS &&
+                len == 1 && buf[0] == CY_FX_UVC_STREAM_ERR_UNDERRUN, "Bulk stream error code should report the last stream error");
+    CyFxUvcCtrlGet(gain, CY_FX_USB_UVC_GET_CUR_REQ, &buf, &len);
+    CyFxUvcCtrlErrorGet(CY_FX_UVC_CTRL_ERROR_STREAM, CY_FX_USB_UVC_GET_CUR_REQ, &buf, &len);
+    TEST_ASSERT(buf[0] == CY_FX_UVC_STREAM_ERR_UNDERRUN, "Bulk control requests should not clear the stream error code");
+    CyFxUvcCtrlStreamError(CY_FX_UVC_STREAM_ERR_NONE);
+    TEST_ASSERT(buf[0] == CY_FX_UVC_STREAM_ERR_NONE, "Bulk stream start should clear the stream error code");
+
+    // The encoding unit controls that may be set while streaming are those of bmControlsRuntime
+    for (unsigned i = 0; i < glUvcCtrlCount; i++)
+        TEST_ASSERT(glUvcCtrls[i].isRuntime, "Bulk every implemented control should be settable while streaming");
+
+    CyFxUvcCtrlInit();
+    TEST_PASS();
+}
+
+/**
+ * Test the status packets of the status interrupt endpoint
+ */
+int test_bulk_status_events()
+{
+    const CyFxUvcCtrlInfo_t *gain     = CyFxUvcCtrlFind(CY_FX_UVC_PU_ID, CY_FX_UVC_PU_GAIN_CONTROL);
+    const CyFxUvcCtrlInfo_t *exposure = CyFxUvcCtrlFind(CY_FX_UVC_CT_ID, CY_FX_UVC_CT_EXPOSURE_TIME_ABSOLUTE_CONTROL);
+    const CyFxUvcCtrlInfo_t *start    = CyFxUvcCtrlFind(CY_FX_UVC_EU_ID, CY_FX_UVC_EU_START_OR_STOP_LAYER_CONTROL);
+    const CyFxUvcCtrlInfo_t *power    = CyFxUvcCtrlFind(CY_FX_UVC_PU_ID, CY_FX_UVC_PU_POWER_LINE_FREQUENCY_CONTROL);
+    CyFxUvcStatus_t st;
+    uint8_t pkt[CY_FX_UVC_STATUS_MAX_LEN];
+    uint8_t data[2] = { 0x2C, 0x01 };           // Gain 300
+
+    // The picture controls complete their SET_CUR asynchronously, the layer start or stop changes by itself
+    TEST_ASSERT(gain != NULL && exposure != NULL && start != NULL && power != NULL, "Bulk status controls should be implemented");
+    TEST_ASSERT((gain->attr_p[CY_FX_UVC_CTRL_ATTR_INFO] & CY_FX_UVC_CTRL_INFO_ASYNC) &&
+                (exposure->attr_p[CY_FX_UVC_CTRL_ATTR_INFO] & CY_FX_UVC_CTRL_INFO_ASYNC),
+                "Bulk picture controls should be asynchronous");
+    TEST_ASSERT(!(power->attr_p[CY_FX_UVC_CTRL_ATTR_INFO] & CY_FX_UVC_CTRL_INFO_ASYNC),
+                "Bulk power line frequency control should complete at once");
+    TEST_ASSERT((start->attr_p[CY_FX_UVC_CTRL_ATTR_INFO] & CY_FX_UVC_CTRL_INFO_AUTOUPDATE) &&
+                !(start->attr_p[CY_FX_UVC_CTRL_ATTR_INFO] & CY_FX_UVC_CTRL_INFO_ASYNC),
+                "Bulk start or stop layer control should be auto-update");
+
+    // A control change carries the value the control has when the packet is built
+    CyFxUvcCtrlInit();
+    CyFxUvcStatusInit(&st);
+    TEST_ASSERT(CyFxUvcStatusNext(&st, pkt) == 0, "Bulk empty status queue should have nothing to send");
+    TEST_ASSERT(CyFxUvcStatusControl(&st, gain, CyFalse), "Bulk control change should be queued");
+    TEST_ASSERT(CyFxUvcCtrlSet(gain, data, 2) == CY_U3P_SUCCESS, "Bulk gain SET_CUR should succeed");
+    TEST_ASSERT(CyFxUvcStatusNext(&st, pkt) == 7, "Bulk control change packet should carry the 2 byte value");
+    TEST_ASSERT(pkt[0] == CY_FX_UVC_STATUS_TYPE_VC && pkt[1] == CY_FX_UVC_PU_ID && pkt[2] == CY_FX_UVC_STATUS_EVENT_CONTROL &&
+                pkt[3] == CY_FX_UVC_PU_GAIN_CONTROL && pkt[4] == CY_FX_UVC_STATUS_ATTR_VALUE && pkt[5] == 0x2C && pkt[6] == 0x01,
+                "Bulk control change packet should name the unit and control and hold the current value");
+    TEST_ASSERT(CyFxUvcStatusNext(&st, pkt) == 0 && st.sent == 1, "Bulk sent event should leave the queue");
+
+    // A change queued again before it is sent costs no second packet
+    CyFxUvcStatusControl(&st, start, CyFalse);
+    CyFxUvcStatusControl(&st, gain, CyFalse);
+    CyFxUvcStatusControl(&st, start, CyFalse);
+    TEST_ASSERT(st.count == 2 && st.merged == 1, "Bulk repeated control change should be merged");
+    TEST_ASSERT(CyFxUvcStatusNext(&st, pkt) == 6 && pkt[3] == CY_FX_UVC_EU_START_OR_STOP_LAYER_CONTROL,
+                "Bulk status packets should go out oldest first");
+    TEST_ASSERT(CyFxUvcStatusNext(&st, pkt) == 7 && pkt[3] == CY_FX_UVC_PU_GAIN_CONTROL, "Bulk merged change should be sent once");
+    TEST_ASSERT(CyFxUvcStatusNext(&st, pkt) == 0, "Bulk status queue should be empty");
+
+    // A held completion waits for its action, while the events behind it go on
+    CyFxUvcStatusControl(&st, gain, CyTrue);
+    CyFxUvcStatusControl(&st, start, CyFalse);
+    TEST_ASSERT(CyFxUvcStatusIsHeld(&st, gain) && !CyFxUvcStatusIsHeld(&st, start) && !CyFxUvcStatusIsHeld(&st, exposure),
+                "Bulk only the held completion should be reported as held");
+    TEST_ASSERT(CyFxUvcStatusNext(&st, pkt) == 6 && pkt[3] == CY_FX_UVC_EU_START_OR_STOP_LAYER_CONTROL,
+                "Bulk event behind a held one should be sent");
+    TEST_ASSERT(CyFxUvcStatusNext(&st, pkt) == 0, "Bulk held completion should not be sent");
+    CyFxUvcStatusRelease(&st, CY_FX_UVC_CTRL_APPLY_LAYER);
+    TEST_ASSERT(CyFxUvcStatusIsHeld(&st, gain), "Bulk release of another action should leave the completion held");
+    CyFxUvcStatusRelease(&st, CY_FX_UVC_CTRL_APPLY_PICTURE);
+    TEST_ASSERT(!CyFxUvcStatusIsHeld(&st, gain) && CyFxUvcStatusNext(&st, pkt) == 7 && pkt[3] == CY_FX_UVC_PU_GAIN_CONTROL,
+                "Bulk released completion should be sent");
+
+    // A stream error is sent with the stream error code as bEvent, unless a stream start has cleared it
+    CyFxUvcCtrlStreamError(CY_FX_UVC_STREAM_ERR_UNDERRUN);
+    TEST_ASSERT(CyFxUvcStatusStream(&st, CY_FX_UVC_INTERFACE_VS), "Bulk stream error should be queued");
+    TEST_ASSERT(CyFxUvcStatusNext(&st, pkt) == 3 && pkt[0] == CY_FX_UVC_STATUS_TYPE_VS && pkt[1] == CY_FX_UVC_INTERFACE_VS &&
+                pkt[2] == CY_FX_UVC_STREAM_ERR_UNDERRUN, "Bulk stream error packet should carry the stream error code");
+    CyFxUvcStatusStream(&st, CY_FX_UVC_INTERFACE_VS);
+    CyFxUvcCtrlStreamError(CY_FX_UVC_STREAM_ERR_NONE);
+    TEST_ASSERT(CyFxUvcStatusNext(&st, pkt) == 0 && st.count == 0, "Bulk cleared stream error should not be sent");
+
+    // A full queue turns new events away and counts them
+    for (unsigned i = 0; i < glUvcCtrlCount && i < CY_FX_UVC_STATUS_QUEUE_LEN; i++)
+        CyFxUvcStatusControl(&st, &glUvcCtrls[i], CyFalse);
+    TEST_ASSERT(glUvcCtrlCount > CY_FX_UVC_STATUS_QUEUE_LEN, "Bulk test needs more controls than queue entries");
+    TEST_ASSERT(!CyFxUvcStatusControl(&st, &glUvcCtrls[CY_FX_UVC_STATUS_QUEUE_LEN], CyFalse) && st.dropped == 1,
+                "Bulk event should be dropped when the queue is full");
+    TEST_ASSERT(CyFxUvcStatusControl(&st, &glUvcCtrls[0], CyFalse) && st.dropped == 1,
+                "Bulk event already queued should still be merged when the queue is full");
+    CyFxUvcStatusInit(&st);
+    TEST_ASSERT(st.count == 0 && st.sent == 0 && st.merged == 0 && st.dropped == 0, "Bulk status queue should reset");
+
+    CyFxUvcCtrlInit();
+    TEST_PASS();
+}
+
 /**
  * Main test runner for bulk control tests
  */
@@ -333,6 +838,17 @@ int main(void)
     RUN_TEST(test_bulk_backward_compatibility);
     RUN_TEST(test_bulk_encoding_unit_id);
     RUN_TEST(test_bulk_streaming_controls);
+    RUN_TEST(test_bulk_control_lookup);
+    RUN_TEST(test_bulk_control_get_requests);
+    RUN_TEST(test_bulk_control_set_cur);
+    RUN_TEST(test_bulk_control_bitmaps);
+    RUN_TEST(test_bulk_sync_control);
+    RUN_TEST(test_bulk_layer_controls);
+    RUN_TEST(test_bulk_slice_control);
+    RUN_TEST(test_bulk_resiliency_control);
+    RUN_TEST(test_bulk_picture_controls);
+    RUN_TEST(test_bulk_request_error_codes);
+    RUN_TEST(test_bulk_status_events);
     RUN_TEST(test_bulk_bitrate_controls);
     RUN_TEST(test_bulk_transfer_optimization);
 
@@ -45,6 +45,38 @@ static int tests_total = 0;
         if (test_func()) tests_passed++; \
     } while(0)
 
+// wTotalLength of a configuration descriptor
+static uint16_t config_total_len(const uint8_t *desc)
+{
+    return desc[2] | (desc[3] << 8);
+}
+
+// Length covered by walking the bLength fields of a configuration descriptor
+static uint16_t config_walk_len(const uint8_t *desc)
+{
+    uint16_t total = config_total_len(desc);
+    uint16_t offset = 0;
+
+    while (offset < total && desc[offset] != 0)
+        offset += desc[offset];
+
+    return offset;
+}
+
+// Sum of the VC header and unit descriptor lengths (the span covered by the VC header wTotalLength)
+static uint16_t vc_walk_len(const uint8_t *desc)
+{
+    uint16_t offset = 9 + 8 + 9;
+    uint16_t len = 0;
+
+    while (offset < config_total_len(desc) && desc[offset] != 0 && desc[offset + 1] == 0x24) {
+        len += desc[offset];
+        offset += desc[offset];
+    }
+
+    return len;
+}
+
 /**
  * Test UVC 1.5 version in bulk descriptors
  */
@@ -79,7 +111,7 @@ int test_bulk_endpoint_descriptor()
     int desc_offset = 9;
     int found_bulk_endpoint = 0;
 
-    while (desc_offset < 0xCB) { // Total descriptor length for SS bulk (smaller than isochronous)
+    while (desc_offset < config_total_len(ss_desc)) {
         uint8_t desc_len = ss_desc[desc_offset];
         if (desc_len == 0) break;
 
@@ -118,18 +150,22 @@ int test_bulk_ss_endpoint_companion()
 {
     const uint8_t *ss_desc = CyFxUSBSSConfigDscr;
 
-    // Search for SuperSpeed endpoint companion descriptor
+    // Search for the SuperSpeed endpoint companion of the video endpoint
     int desc_offset = 9;
     int found_companion = 0;
+    uint8_t last_ep = 0;
 
-    while (desc_offset < 0xCB) {
+    while (desc_offset < config_total_len(ss_desc)) {
         uint8_t desc_len = ss_desc[desc_offset];
         if (desc_len == 0) break;
 
         uint8_t desc_type = ss_desc[desc_offset + 1];
 
-        // Look for SS endpoint companion descriptor (type 0x30)
-        if (desc_type == 0x30 && desc_len == 0x06) {
+        if (desc_type == 0x05)
+            last_ep = ss_desc[desc_offset + 2];
+
+        // Look for SS endpoint companion descriptor (type 0x30) following the video endpoint
+        if (desc_type == 0x30 && desc_len == 0x06 && last_ep == CY_FX_EP_BULK_VIDEO) {
             found_companion = 1;
 
             uint8_t max_burst = ss_desc[desc_offset + 2];
@@ -138,7 +174,7 @@ int test_bulk_ss_endpoint_companion()
                                         (ss_desc[desc_offset + 5] << 8);
 
             // Verify SS companion descriptor for bulk
-            TEST_ASSERT(max_burst == 0x0F, "SS companion max burst should be 15 for bulk");
+            TEST_ASSERT(max_burst == CY_FX_BULK_BURST - 1, "SS companion max burst should match CY_FX_BULK_BURST");
             TEST_ASSERT(attributes == 0x00, "SS companion attributes should be 0 for bulk");
             TEST_ASSERT(bytes_per_interval == 0x0000, "Bytes per interval should be 0 for bulk");
 
@@ -160,17 +196,19 @@ int test_bulk_descriptor_sizes()
     const uint8_t *ss_desc = CyFxUSBSSConfigDscr;
     const uint8_t *hs_desc = CyFxUSBHSConfigDscr;
 
-    // Check total configuration descriptor length (bulk should be smaller than isochronous)
-    uint16_t ss_total_len = ss_desc[2] | (ss_desc[3] << 8);
-    uint16_t hs_total_len = hs_desc[2] | (hs_desc[3] << 8);
+    // The declared total lengths must cover exactly the descriptors that follow
+    uint16_t ss_total_len = config_total_len(ss_desc);
+    uint16_t hs_total_len = config_total_len(hs_desc);
 
-    TEST_ASSERT(ss_total_len == 0x00CB, "SS bulk config total length should be 0xCB (203 bytes)");
-    TEST_ASSERT(hs_total_len == 0x00BF, "HS bulk config total length should be 0xBF (191 bytes)");
+    TEST_ASSERT(config_walk_len(ss_desc) == ss_total_len, "SS bulk config total length should match its descriptors");
+    TEST_ASSERT(config_walk_len(hs_desc) == hs_total_len, "HS bulk config total length should match its descriptors");
+    TEST_ASSERT(ss_total_len > hs_total_len, "SS bulk config should be larger than HS (endpoint companions)");
 
     // Check VC interface total class descriptor size
     const uint8_t *vc_header_ss = &ss_desc[9 + 8 + 9];
     uint16_t vc_class_total_ss = vc_header_ss[5] | (vc_header_ss[6] << 8);
 
+    TEST_ASSERT(vc_class_total_ss == vc_walk_len(ss_desc), "SS VC class descriptors total should match the VC header and units");
     TEST_ASSERT(vc_class_total_ss == 0x005E, "SS VC class descriptors total should be 0x5E (94 bytes) for bulk");
 
     TEST_PASS();
@@ -187,7 +225,7 @@ int test_bulk_encoding_unit()
     int desc_offset = 9;
     int found_encoding_unit = 0;
 
-    while (desc_offset < 0xCB) {
+    while (desc_offset < config_total_len(ss_desc)) {
         uint8_t desc_len = ss_desc[desc_offset];
         if (desc_len == 0) break;
 
@@ -223,13 +261,13 @@ int test_bulk_encoding_unit()
 int test_bulk_uvc15_constants()
 {
     // Test H.264 format constants
-    TEST_ASSERT(CY_FX_UVC_VS_FORMAT_H264 == 0x10, "H.264 format subtype should be 0x10");
-    TEST_ASSERT(CY_FX_UVC_VS_FORMAT_H264_SIMULCAST == 0x11, "H.264 simulcast format subtype should be 0x11");
-    TEST_ASSERT(CY_FX_UVC_VS_FORMAT_H265 == 0x12, "H.265 format subtype should be 0x12");
+    TEST_ASSERT(CY_FX_UVC_VS_FORMAT_H264 == 0x13, "H.264 format subtype should be 0x13");
+    TEST_ASSERT(CY_FX_UVC_VS_FORMAT_H264_SIMULCAST == 0x15, "H.264 simulcast format subtype should be 0x15");
+    TEST_ASSERT(CY_FX_UVC_VS_FORMAT_H265 == 0x10, "H.265 format subtype should be 0x10 (frame based)");
 
     // Test frame descriptor constants
-    TEST_ASSERT(CY_FX_UVC_VS_FRAME_H264 == 0x11, "H.264 frame subtype should be 0x11");
-    TEST_ASSERT(CY_FX_UVC_VS_FRAME_H265 == 0x13, "H.265 frame subtype should be 0x13");
+    TEST_ASSERT(CY_FX_UVC_VS_FRAME_H264 == 0x14, "H.264 frame subtype should be 0x14");
+    TEST_ASSERT(CY_FX_UVC_VS_FRAME_H265 == 0x11, "H.265 frame subtype should be 0x11 (frame based)");
 
     // Test encoding unit constant
     TEST_ASSERT(CY_FX_UVC_VC_ENCODING_UNIT == 0x07, "Encoding unit subtype should be 0x07");
@@ -252,16 +290,21 @@ int test_bulk_mjpeg_compatibility()
     // Search for MJPEG format descriptor (subtype 0x06)
     int desc_offset = 9;
     int found_mjpeg_format = 0;
+    int intf = -1;
 
-    while (desc_offset < 0xCB) {
+    while (desc_offset < config_total_len(ss_desc)) {
         uint8_t desc_len = ss_desc[desc_offset];
         if (desc_len == 0) break;
 
         uint8_t desc_type = ss_desc[desc_offset + 1];
         uint8_t desc_subtype = ss_desc[desc_offset + 2];
 
+        if (desc_type == 0x04)
+            intf = ss_desc[desc_offset + 2];
+
         // Look for class-specific VS interface descriptor with MJPEG format subtype
-        if (desc_type == 0x24 && desc_subtype == 0x06) {
+        // (subtype 0x06 is the extension unit on the VC interface)
+        if (desc_type == 0x24 && desc_subtype == 0x06 && intf == CY_FX_UVC_INTERFACE_VS) {
             found_mjpeg_format = 1;
 
             // Verify MJPEG format descriptor structure
@@ -272,6 +315,7 @@ int test_bulk_mjpeg_compatibility()
 
             TEST_ASSERT(format_index == 0x01, "MJPEG format index should be 1");
             TEST_ASSERT(num_frame_desc >= 0x01, "Should have at least 1 MJPEG frame descriptor");
+            TEST_ASSERT(ss_desc[desc_offset + 5] == 0x00, "JPEG frames vary in size: fixed size samples should be clear");
 
             break;
         }
@@ -313,7 +357,7 @@ int test_bulk_output_terminal_connection()
     int desc_offset = 9;
     int found_output_terminal = 0;
 
-    while (desc_offset < 0xCB) {
+    while (desc_offset < config_total_len(ss_desc)) {
         uint8_t desc_len = ss_desc[desc_offset];
         if (desc_len == 0) break;
 
@@ -343,6 +387,113 @@ int test_bulk_output_terminal_connection()
     TEST_PASS();
 }
 
+/**
+ * Test the UVC 1.5 H.264 format and frame descriptors
+ */
+int test_bulk_h264_format()
+{
+    const uint8_t *ss_desc = CyFxUSBSSConfigDscr;
+    int desc_offset = 9;
+    int intf = -1, frames = -1, found = 0;
+
+    while (desc_offset < config_total_len(ss_desc)) {
+        const uint8_t *d = ss_desc + desc_offset;
+        if (d[0] == 0) break;
+
+        if (d[1] == 0x04)
+            intf = d[2];
+
+        if (d[1] == 0x24 && intf == CY_FX_UVC_INTERFACE_VS) {
+            /* The simulcast format shares the H.264 format and frame descriptor layouts. */
+            if (d[2] == CY_FX_UVC_VS_FORMAT_H264 || d[2] == CY_FX_UVC_VS_FORMAT_H264_SIMULCAST) {
+                found |= (d[2] == CY_FX_UVC_VS_FORMAT_H264);
+                TEST_ASSERT(frames <= 0, "Frame descriptor count should match");
+                frames = d[4];
+                TEST_ASSERT(d[0] == 52, "H.264 format descriptor should be 52 bytes");
+                TEST_ASSERT(d[5] >= 1 && d[5] <= frames, "Default frame index should be valid");
+                /* One slice per picture: sent as stored, or with the payloads aligned to the NAL units. */
+                TEST_ASSERT((d[7] & ~0x06) == 0, "Only the slice modes of the stored streams should be supported");
+                TEST_ASSERT(d[11] != 0, "A rate control mode should be supported");
+                /* One wMaxMBperSec field per number of resolutions sent at once, without scalability. */
+                int mbps = 0;
+                for (int i = 0; i < 20; i += 5)
+                    mbps |= d[12 + 2 * i] | (d[13 + 2 * i] << 8);
+                TEST_ASSERT(mbps != 0, "Macroblock rate should be given");
+            } else if (d[2] == CY_FX_UVC_VS_FRAME_H264) {
+                uint8_t count = d[43];
+                TEST_ASSERT(frames-- > 0, "H.264 frame descriptors should follow the format descriptor");
+                TEST_ASSERT(count >= 1 && d[0] == 44 + 4 * count, "H.264 frame descriptor should list its intervals");
+                TEST_ASSERT(d[13] == 0x42 && d[14] != 0, "Stream should be baseline with a level");
+                TEST_ASSERT((d[17] & 0x01) != 0, "Frame should be usable in real time");
+                for (int i = 1; i < count; i++) {
+                    const uint8_t *a = d + 44 + 4 * (i - 1), *b = a + 4;
+                    uint32_t ia = a[0] | (a[1] << 8) | (a[2] << 16), ib = b[0] | (b[1] << 8) | (b[2] << 16);
+                    TEST_ASSERT(ia < ib, "Frame intervals should be shortest first");
+                }
+            }
+        }
+
+        desc_offset += d[0];
+    }
+
+    TEST_ASSERT(found, "H.264 format descriptor should be present");
+    TEST_ASSERT(frames == 0, "Frame descriptor count should match");
+    TEST_PASS();
+}
+
+/**
+ * Test the H.265 format: a frame based format with the H265 GUID and variable size frames
+ */
+int test_bulk_h265_format()
+{
+    static const uint8_t h265_guid[16] = {
+        'H', '2', '6', '5', 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71
+    };
+    const uint8_t *ss_desc = CyFxUSBSSConfigDscr;
+    int desc_offset = 9;
+    int intf = -1, frames = -1, found = 0;
+
+    while (desc_offset < config_total_len(ss_desc)) {
+        const uint8_t *d = ss_desc + desc_offset;
+        if (d[0] == 0) break;
+
+        if (d[1] == 0x04)
+            intf = d[2];
+
+        if (d[1] == 0x24 && intf == CY_FX_UVC_INTERFACE_VS) {
+            if (d[2] == CY_FX_UVC_VS_FORMAT_FRAME_BASED) {
+                frames = -1;
+                if (memcmp(d + 5, h265_guid, sizeof(h265_guid)) != 0) {
+                    desc_offset += d[0];
+                    continue;
+                }
+                found = 1;
+                frames = d[4];
+                TEST_ASSERT(d[0] == 28, "Frame based format descriptor should be 28 bytes");
+                TEST_ASSERT(d[21] == 0, "Compressed format should not give bits per pixel");
+                TEST_ASSERT(d[22] >= 1 && d[22] <= frames, "Default frame index should be valid");
+                TEST_ASSERT(d[27] == 1, "Frames should be of variable size");
+            } else if (d[2] == CY_FX_UVC_VS_FRAME_FRAME_BASED && frames >= 0) {
+                uint8_t count = d[21];
+                TEST_ASSERT(frames-- > 0, "H.265 frame descriptors should follow the format descriptor");
+                TEST_ASSERT(count >= 1 && d[0] == 26 + 4 * count, "Frame based frame descriptor should list its intervals");
+                TEST_ASSERT((d[22] | d[23] | d[24] | d[25]) == 0, "Compressed frames should have no bytes per line");
+                for (int i = 1; i < count; i++) {
+                    const uint8_t *a = d + 26 + 4 * (i - 1), *b = a + 4;
+                    uint32_t ia = a[0] | (a[1] << 8) | (a[2] << 16), ib = b[0] | (b[1] << 8) | (b[2] << 16);
+                    TEST_ASSERT(ia < ib, "Frame intervals should be shortest first");
+                }
+            }
+        }
+
+        desc_offset += d[0];
+    }
+
+    TEST_ASSERT(found, "H.265 format descriptor should be present");
+    TEST_ASSERT(frames == 0, "Frame descriptor count should match");
+    TEST_PASS();
+}
+
 /**
  * Main test runner for bulk implementation
  */
@@ -359,6 +510,8 @@ int main(void)
     RUN_TEST(test_bulk_encoding_unit);
     RUN_TEST(test_bulk_uvc15_constants);
     RUN_TEST(test_bulk_mjpeg_compatibility);
+    RUN_TEST(test_bulk_h264_format);
+    RUN_TEST(test_bulk_h265_format);
     RUN_TEST(test_bulk_video_frames);
     RUN_TEST(test_bulk_output_terminal_connection);
 
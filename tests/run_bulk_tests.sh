@@ -67,18 +67,11 @@ echo ""
 echo "Test 3: Bulk Descriptor Sizes"
 echo "----------------------------"
 
-# Test 3.1: Check SuperSpeed bulk descriptor size (should be smaller than isochronous)
-if grep -q "0xCB,0x00.*Length of this descriptor" ../cyfxuvcinmem_bulk/cyfxuvcdscr.c; then
-    test_result "SuperSpeed bulk descriptor size (0xCB)" "PASS"
+# Test 3.1: Descriptor lengths are computed by the generator from the stream table
+if python3 ../tools/fx3_uvc_dscr_gen.py --check ../cyfxuvcinmem_bulk/cyfxuvcstreams.json; then
+    test_result "Bulk descriptors up to date with stream table" "PASS"
 else
-    test_result "SuperSpeed bulk descriptor size (0xCB)" "FAIL"
-fi
-
-# Test 3.2: Check HighSpeed bulk descriptor size (the correct value is 0xCB for HS)
-if grep -q "0xCB,0x00.*Length of this descriptor" ../cyfxuvcinmem_bulk/cyfxuvcdscr.c; then
-    test_result "HighSpeed bulk descriptor size (0xCB)" "PASS"
-else
-    test_result "HighSpeed bulk descriptor size (0xCB)" "FAIL"
+    test_result "Bulk descriptors up to date with stream table" "FAIL"
 fi
 
 echo ""
@@ -97,7 +90,7 @@ echo "Test 5: Bulk Constants"
 echo "---------------------"
 
 # Test 5.1: Check H.264 constants in bulk headers
-if grep -q "#define CY_FX_UVC_VS_FORMAT_H264.*0x10" ../cyfxuvcinmem_bulk/cyfxuvcinmem.h; then
+if grep -q "#define CY_FX_UVC_VS_FORMAT_H264.*0x13" ../cyfxuvcinmem_bulk/cyfxuvcinmem.h; then
     test_result "H.264 format constants in bulk headers" "PASS"
 else
     test_result "H.264 format constants in bulk headers" "FAIL"
@@ -107,8 +100,9 @@ echo ""
 echo "Test 6: Bulk-Specific Features"
 echo "-----------------------------"
 
-# Test 6.1: Check bulk max burst for SuperSpeed (actual value is 0x07 = 7, meaning 8 packets)
-if grep -q "0x07.*Max no. of packets in a Burst : 8" ../cyfxuvcinmem_bulk/cyfxuvcdscr.c; then
+# Test 6.1: Check bulk max burst for SuperSpeed (CY_FX_BULK_BURST - 1 = 7, meaning 8 packets)
+if grep -q "CY_FX_BULK_BURST - 1.*Max no. of packets in a Burst" ../cyfxuvcinmem_bulk/cyfxuvcdscr.c &&
+   grep -q "#define CY_FX_BULK_BURST.*(8)" ../cyfxuvcinmem_bulk/cyfxuvcinmem.h; then
     test_result "Bulk SuperSpeed max burst (8 packets)" "PASS"
 else
     test_result "Bulk SuperSpeed max burst (8 packets)" "FAIL"
@@ -67,11 +67,11 @@ echo ""
 echo "Test 3: Isochronous Descriptor Sizes"
 echo "-----------------------------------"
 
-# Test 3.1: Check SuperSpeed descriptor size (should be larger due to SS companion)
-if grep -q "0xE0,0x00.*Length of this descriptor" ../cyfxuvcinmem/cyfxuvcdscr.c; then
-    test_result "SuperSpeed isochronous descriptor size (0xE0)" "PASS"
+# Test 3.1: Descriptor lengths are computed by the generator from the stream table
+if python3 ../tools/fx3_uvc_dscr_gen.py --check ../cyfxuvcinmem/cyfxuvcstreams.json; then
+    test_result "Isochronous descriptors up to date with stream table" "PASS"
 else
-    test_result "SuperSpeed isochronous descriptor size (0xE0)" "FAIL"
+    test_result "Isochronous descriptors up to date with stream table" "FAIL"
 fi
 
 echo ""
@@ -90,7 +90,7 @@ echo "Test 5: Isochronous Constants"
 echo "----------------------------"
 
 # Test 5.1: Check H.264 constants in isochronous headers
-if grep -q "#define CY_FX_UVC_VS_FORMAT_H264.*0x10" ../cyfxuvcinmem/cyfxuvcinmem.h; then
+if grep -q "#define CY_FX_UVC_VS_FORMAT_H264.*0x13" ../cyfxuvcinmem/cyfxuvcinmem.h; then
     test_result "H.264 format constants in isochronous headers" "PASS"
 else
     test_result "H.264 format constants in isochronous headers" "FAIL"
@@ -0,0 +1,298 @@
+/*
+ * UVC Stream Open Latency Simulator
+ * =================================
+ *
+ * Replays the probe/commit requests that the Linux uvcvideo driver sends when a stream is opened
+ * against the probe/commit handling of one of the examples, and estimates the latency seen by the
+ * host. Built once per example with the example directory on the include path:
+ *
+ *     gcc -std=c99 -I../../cyfxuvcinmem -I<sdk>/inc ../uvc_open_sim.c \
+ *         ../../cyfxuvcinmem/cyfxuvcprobe.c ../../cyfxuvcinmem/cyfxuvcvidframes.c -o sim_iso_open
+ *
+ * The request sequence follows uvcvideo:
+ *   - uvc_video_init:       GET_DEF(PROBE), SET_CUR(PROBE)
+ *   - VIDIOC_TRY_FMT:       SET_CUR(PROBE), GET_MIN(PROBE), GET_MAX(PROBE), SET_CUR(PROBE), GET_CUR(PROBE)
+ *   - VIDIOC_S_FMT:         the same five requests again
+ *   - VIDIOC_STREAMON:      SET_CUR(COMMIT)
+ * with 34 byte transfers, as uvcvideo uses for devices of UVC 1.1 and later.
+ *
+ * Each request is handled twice: by the negotiation state (CyFxUvcProbeGet / CyFxUvcProbeSet, as in
+ * the firmware), and by the previous handler that negotiated and packed the structure for every
+ * request and logged each class request. The responses of both must match. The device time of each
+ * request is measured on the host and scaled by --cpu-scale; the host visible latency adds the
+ * control transfer stages (--stage-us each) and, for the previous handler, the debug print
+ * (--print-us). These are model parameters: the defaults assume a high speed link that completes
+ * one control stage per microframe, a 200 MHz ARM926 that is 20 times slower than the host and a
+ * CyU3PDebugPrint that takes 50 us to format and queue the message.
+ *
+ * Usage: sim_<example>_open [--speed hs|ss] [--stage-us N] [--cpu-scale N] [--print-us N] [--iterations N]
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include <cyu3error.h>
+
+// Include the headers of the example given on the include path
+#include "cyfxuvcinmem.h"
+
+// Length of the probe structure sent by uvcvideo
+#define SIM_PROBE_LEN           CY_FX_UVC_PROBE_LEN_UVC11
+
+// Stages of a control transfer with a data stage
+#define SIM_CTRL_STAGES         3
+
+// Frame interval requested by the application (15 fps)
+#define SIM_FRAME_INTERVAL      666666
+
+typedef struct {
+    const char *name;
+    uint8_t     bRequest;
+    uint16_t    control;
+} sim_request_t;
+
+static const sim_request_t sim_sequence[] = {
+    { "GET_DEF(PROBE)",  CY_FX_USB_UVC_GET_DEF_REQ, CY_FX_USB_UVC_VS_PROBE_CONTROL  },
+    { "SET_CUR(PROBE)",  CY_FX_USB_UVC_SET_CUR_REQ, CY_FX_USB_UVC_VS_PROBE_CONTROL  },
+    { "SET_CUR(PROBE)",  CY_FX_USB_UVC_SET_CUR_REQ, CY_FX_USB_UVC_VS_PROBE_CONTROL  },
+    { "GET_MIN(PROBE)",  CY_FX_USB_UVC_GET_MIN_REQ, CY_FX_USB_UVC_VS_PROBE_CONTROL  },
+    { "GET_MAX(PROBE)",  CY_FX_USB_UVC_GET_MAX_REQ, CY_FX_USB_UVC_VS_PROBE_CONTROL  },
+    { "SET_CUR(PROBE)",  CY_FX_USB_UVC_SET_CUR_REQ, CY_FX_USB_UVC_VS_PROBE_CONTROL  },
+    { "GET_CUR(PROBE)",  CY_FX_USB_UVC_GET_CUR_REQ, CY_FX_USB_UVC_VS_PROBE_CONTROL  },
+    { "SET_CUR(PROBE)",  CY_FX_USB_UVC_SET_CUR_REQ, CY_FX_USB_UVC_VS_PROBE_CONTROL  },
+    { "GET_MIN(PROBE)",  CY_FX_USB_UVC_GET_MIN_REQ, CY_FX_USB_UVC_VS_PROBE_CONTROL  },
+    { "GET_MAX(PROBE)",  CY_FX_USB_UVC_GET_MAX_REQ, CY_FX_USB_UVC_VS_PROBE_CONTROL  },
+    { "SET_CUR(PROBE)",  CY_FX_USB_UVC_SET_CUR_REQ, CY_FX_USB_UVC_VS_PROBE_CONTROL  },
+    { "GET_CUR(PROBE)",  CY_FX_USB_UVC_GET_CUR_REQ, CY_FX_USB_UVC_VS_PROBE_CONTROL  },
+    { "SET_CUR(COMMIT)", CY_FX_USB_UVC_SET_CUR_REQ, CY_FX_USB_UVC_VS_COMMIT_CONTROL },
+};
+
+#define SIM_REQUESTS    (sizeof(sim_sequence) / sizeof(sim_sequence[0]))
+
+// Handler under test: returns the number of response bytes in resp, or -1 for a stall
+typedef int (*sim_handler_t)(const sim_request_t *rqt, const uint8_t *data, uint8_t *resp);
+
+static CyU3PUSBSpeed_t sim_speed = CY_U3P_HIGH_SPEED;
+
+/**
+ * Handler using the negotiation state, as in the firmware setup callback
+ */
+static CyFxUvcProbeState_t sim_state;
+
+static void cached_reset(void)
+{
+    CyFxUvcProbeInit(&sim_state, sim_speed);
+}
+
+static int cached_handler(const sim_request_t *rqt, const uint8_t *data, uint8_t *resp)
+{
+    const uint8_t *buf;
+    uint16_t len;
+
+    if (rqt->bRequest == CY_FX_USB_UVC_SET_CUR_REQ)
+        return (CyFxUvcProbeSet(&sim_state, rqt->control, data, SIM_PROBE_LEN) == CY_U3P_SUCCESS) ? 0 : -1;
+
+    if (CyFxUvcProbeGet(&sim_state, rqt->control, rqt->bRequest, &buf, &len) != CY_U3P_SUCCESS)
+        return -1;
+    if (len > SIM_PROBE_LEN)
+        len = SIM_PROBE_LEN;
+    memcpy(resp, buf, len);     // Stands in for the EP0 DMA reading the prepared buffer
+    return len;
+}
+
+/**
+ * Previous handler: every request negotiates or packs the structure again
+ */
+static CyFxUvcProbeCtrl_t baseline_probe, baseline_commit;
+
+static void baseline_reset(void)
+{
+    CyFxUvcEpGeometry_t ep;
+
+    if (CyFxUvcProbeGetEpGeometry(sim_speed, &ep) != CY_U3P_SUCCESS)
+        CyFxUvcProbeGetEpGeometry(CY_U3P_HIGH_SPEED, &ep);
+    memset(&baseline_probe, 0, sizeof(baseline_probe));
+    CyFxUvcProbeGetLimit(CY_FX_USB_UVC_GET_DEF_REQ, &baseline_probe, &baseline_probe, &ep, 0);
+    baseline_commit = baseline_probe;
+}
+
+static int baseline_handler(const sim_request_t *rqt, const uint8_t *data, uint8_t *resp)
+{
+    CyFxUvcProbeCtrl_t *ctrl = (rqt->control == CY_FX_USB_UVC_VS_PROBE_CONTROL) ? &baseline_probe : &baseline_commit;
+    CyFxUvcProbeCtrl_t limit;
+    CyFxUvcEpGeometry_t ep;
+
+    switch (rqt->bRequest) {
+        case CY_FX_USB_UVC_GET_DEF_REQ:
+        case CY_FX_USB_UVC_GET_MIN_REQ:
+        case CY_FX_USB_UVC_GET_MAX_REQ:
+            if (rqt->control == CY_FX_USB_UVC_VS_COMMIT_CONTROL) return -1;
+            if (CyFxUvcProbeGetEpGeometry(sim_speed, &ep) != CY_U3P_SUCCESS)
+                CyFxUvcProbeGetEpGeometry(CY_U3P_HIGH_SPEED, &ep);
+            CyFxUvcProbeGetLimit(rqt->bRequest, &baseline_probe, &limit, &ep, 0);
+            return CyFxUvcProbePack(&limit, resp, SIM_PROBE_LEN);
+        case CY_FX_USB_UVC_GET_CUR_REQ:
+            return CyFxUvcProbePack(ctrl, resp, SIM_PROBE_LEN);
+        case CY_FX_USB_UVC_SET_CUR_REQ:
+            if (CyFxUvcProbeGetEpGeometry(sim_speed, &ep) != CY_U3P_SUCCESS)
+                CyFxUvcProbeGetEpGeometry(CY_U3P_HIGH_SPEED, &ep);
+            CyFxUvcProbeUnpack(ctrl, data, SIM_PROBE_LEN);
+            CyFxUvcProbeNegotiate(ctrl, &ep, 0);
+            return 0;
+        default:
+            return -1;
+    }
+}
+
+/**
+ * Host side of uvcvideo: builds the data of each SET_CUR from the earlier responses
+ */
+typedef struct {
+    uint8_t cur[SIM_PROBE_LEN];         // Probe as kept by the driver (stream->ctrl)
+    uint8_t probe[SIM_PROBE_LEN];       // Probe being negotiated for TRY_FMT / S_FMT
+} sim_host_t;
+
+static void host_put32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); p[2] = (uint8_t)(v >> 16); p[3] = (uint8_t)(v >> 24);
+}
+
+// Run the sequence once. Records per request device time (ns) and response bytes if given.
+static int run_sequence(sim_handler_t handler, void (*reset)(void), double *ns,
+                        uint8_t resp_log[][SIM_PROBE_LEN], int *len_log)
+{
+    sim_host_t host;
+    uint8_t resp[SIM_PROBE_LEN];
+    const uint8_t *data;
+    struct timespec t0, t1;
+    int len;
+
+    memset(&host, 0, sizeof(host));
+    reset();
+
+    for (size_t i = 0; i < SIM_REQUESTS; i++) {
+        const sim_request_t *rqt = &sim_sequence[i];
+
+        // uvc_video_init sets the default values; uvc_v4l2_try_format starts from a cleared
+        // structure with bmHint = 1, the format, frame and interval, and dwMaxVideoFrameSize.
+        if (i == 2 || i == 7) {
+            memset(host.probe, 0, sizeof(host.probe));
+            host.probe[0] = 0x01;
+            host.probe[2] = 1;
+            host.probe[3] = 1;
+            host_put32(host.probe + 4, SIM_FRAME_INTERVAL);
+            memcpy(host.probe + 18, host.cur + 18, 4);
+        }
+        data = (i == 1) ? host.cur : host.probe;
+
+        memset(resp, 0, sizeof(resp));
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        len = handler(rqt, data, resp);
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        if (ns) ns[i] += (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+
+        if (len < 0) {
+            printf("Request %zu %s stalled\n", i, rqt->name);
+            return 0;
+        }
+        if (resp_log) {
+            memcpy(resp_log[i], resp, sizeof(resp));
+            len_log[i] = len;
+        }
+
+        // Responses the driver keeps
+        if (rqt->bRequest == CY_FX_USB_UVC_GET_DEF_REQ)
+            memcpy(host.cur, resp, sizeof(resp));
+        if (rqt->bRequest == CY_FX_USB_UVC_GET_MAX_REQ)
+            memcpy(host.probe + 12, resp + 12, 2);     // wCompQuality = probe_max.wCompQuality
+        if (rqt->bRequest == CY_FX_USB_UVC_GET_CUR_REQ) {
+            memcpy(host.probe, resp, sizeof(resp));
+            memcpy(host.cur, resp, sizeof(resp));
+        }
+    }
+
+    return 1;
+}
+
+// Time of each request averaged over the given number of runs of the sequence
+static int time_sequence(sim_handler_t handler, void (*reset)(void), double *ns, long iterations)
+{
+    memset(ns, 0, SIM_REQUESTS * sizeof(double));
+    for (long n = 0; n < iterations; n++) {
+        if (!run_sequence(handler, reset, ns, NULL, NULL)) return 0;
+    }
+    for (size_t i = 0; i < SIM_REQUESTS; i++)
+        ns[i] /= iterations;
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    double stage_us = 125.0, cpu_scale = 20.0, print_us = 50.0;
+    long iterations = 20000;
+    double cached_ns[SIM_REQUESTS], baseline_ns[SIM_REQUESTS];
+    uint8_t cached_resp[SIM_REQUESTS][SIM_PROBE_LEN], baseline_resp[SIM_REQUESTS][SIM_PROBE_LEN];
+    int cached_len[SIM_REQUESTS], baseline_len[SIM_REQUESTS];
+    double cached_total = 0, baseline_total = 0, bus_us;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--speed") && i + 1 < argc) {
+            i++;
+            sim_speed = !strcmp(argv[i], "ss") ? CY_U3P_SUPER_SPEED : CY_U3P_HIGH_SPEED;
+        } else if (!strcmp(argv[i], "--stage-us") && i + 1 < argc) {
+            stage_us = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--cpu-scale") && i + 1 < argc) {
+            cpu_scale = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--print-us") && i + 1 < argc) {
+            print_us = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--iterations") && i + 1 < argc) {
+            iterations = atol(argv[++i]);
+            if (iterations < 1) iterations = 1;
+        } else {
+            printf("Usage: %s [--speed hs|ss] [--stage-us N] [--cpu-scale N] [--print-us N] [--iterations N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    printf("UVC Stream Open Latency Simulator\n");
+    printf("=================================\n");
+    printf("Speed %s, %.0f us per control stage, CPU scale %.1f, debug print %.0f us, %ld runs\n\n",
+           (sim_speed == CY_U3P_SUPER_SPEED) ? "SS" : "HS", stage_us, cpu_scale, print_us, iterations);
+
+    // Both handlers must give the host the same answers
+    if (!run_sequence(cached_handler, cached_reset, NULL, cached_resp, cached_len) ||
+        !run_sequence(baseline_handler, baseline_reset, NULL, baseline_resp, baseline_len))
+        return 1;
+    for (size_t i = 0; i < SIM_REQUESTS; i++) {
+        if (cached_len[i] != baseline_len[i] || memcmp(cached_resp[i], baseline_resp[i], SIM_PROBE_LEN)) {
+            printf("FAIL: response to request %zu %s differs from the previous handler\n", i, sim_sequence[i].name);
+            return 1;
+        }
+    }
+
+    if (!time_sequence(cached_handler, cached_reset, cached_ns, iterations) ||
+        !time_sequence(baseline_handler, baseline_reset, baseline_ns, iterations))
+        return 1;
+
+    printf("%-4s %-16s %14s %14s\n", "#", "Request", "Cached (us)", "Previous (us)");
+    bus_us = SIM_CTRL_STAGES * stage_us;
+    for (size_t i = 0; i < SIM_REQUESTS; i++) {
+        double c = cached_ns[i] * cpu_scale / 1000.0;
+        double b = baseline_ns[i] * cpu_scale / 1000.0 + print_us;
+        printf("%-4zu %-16s %14.2f %14.2f\n", i, sim_sequence[i].name, c, b);
+        cached_total += bus_us + c;
+        baseline_total += bus_us + b;
+    }
+
+    printf("\nDevice time per open:  cached %.1f us, previous %.1f us\n",
+           cached_total - SIM_REQUESTS * bus_us, baseline_total - SIM_REQUESTS * bus_us);
+    printf("Structures computed:   %u after the sequence (Init counts 3)\n", (unsigned)sim_state.computeCount);
+    printf("Host visible open:     cached %.1f us, previous %.1f us (%zu requests)\n",
+           cached_total, baseline_total, SIM_REQUESTS);
+    return 0;
+}
@@ -0,0 +1,308 @@
+/*
+ * UVC Test Pattern Generator Check and Benchmark
+ * ==============================================
+ *
+ * Checks the test pattern generator of one of the examples (cyfxuvcpattern.c) against a reference
+ * that computes every pixel on its own, and measures how fast it fills payload buffers on the host.
+ * Built once per example with the example directory on the include path:
+ *
+ *     gcc -std=c99 -O2 -I../../cyfxuvcinmem -I<sdk>/inc ../uvc_pattern_bench.c \
+ *         ../../cyfxuvcinmem/cyfxuvcpattern.c -o bench_iso_pattern
+ *
+ * The check fills whole frames in one call, and again in payloads of awkward sizes written to
+ * unaligned buffers, and compares both with the reference for a few frame numbers. It also checks
+ * the picture adjustment of the bar colours.
+ *
+ * The benchmark fills frames payload by payload, the way the streamer does, into a buffer with the
+ * payload header in front of the data, and reports the throughput in MB/s and, on x86, in bytes per
+ * time stamp counter cycle. The copy of a stored frame of the same size is measured alongside as the
+ * baseline that the generator replaces.
+ *
+ * Usage: bench_<example>_pattern [--size WxH] [--payload N] [--iterations N]
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAVE_TSC 1
+#endif
+
+// Include the headers of the example given on the include path
+#include "cyfxuvcinmem.h"
+
+// Payload header length used by the streamer
+#define BENCH_HEADER            CY_FX_UVC_MAX_HEADER
+
+static const uint8_t bench_bars[CY_FX_UVC_PATTERN_BARS][3] = {
+    { 180, 128, 128 }, { 162,  44, 142 }, { 131, 156,  44 }, { 112,  72,  58 },
+    {  84, 184, 198 }, {  65, 100, 212 }, {  35, 212, 114 }
+};
+
+/**
+ * Reference colour of a pixel
+ */
+static void ref_pixel(const CyFxUvcPattern_t *pat, uint32_t x, uint32_t y, uint8_t yuv[3])
+{
+    uint32_t i;
+
+    yuv[1] = yuv[2] = 128;
+    if (y < pat->barsEnd) {
+        for (i = 0; x >= pat->barEdge[i + 1]; i++)
+            ;
+        memcpy(yuv, bench_bars[i], 3);
+    } else if (y < pat->counterEnd) {
+        i = x / pat->cellWidth;
+        yuv[0] = (i < CY_FX_UVC_PATTERN_CELLS && ((pat->frameCount >> (31 - i)) & 1)) ? 235 : 16;
+    } else {
+        yuv[0] = (uint8_t)(x + pat->frameCount * 4);
+    }
+}
+
+/**
+ * Reference frame, pixel by pixel
+ */
+static void ref_frame(const CyFxUvcPattern_t *pat, uint8_t *out)
+{
+    uint8_t a[3], b[3];
+    uint32_t x, y, w = pat->width, h = pat->height;
+
+    if (pat->type == CY_FX_UVC_PATTERN_YUY2) {
+        for (y = 0; y < h; y++) {
+            for (x = 0; x < w; x += 2) {
+                ref_pixel(pat, x, y, a);
+                ref_pixel(pat, x + 1, y, b);
+                *out++ = a[0];
+                *out++ = a[1];
+                *out++ = b[0];
+                *out++ = a[2];
+            }
+        }
+        return;
+    }
+
+    for (y = 0; y < h; y++) {
+        for (x = 0; x < w; x++) {
+            ref_pixel(pat, x, y, a);
+            *out++ = a[0];
+        }
+    }
+    for (y = 0; y < h; y += 2) {
+        for (x = 0; x < w; x += 2) {
+            ref_pixel(pat, x, y, a);
+            *out++ = a[1];
+            *out++ = a[2];
+        }
+    }
+}
+
+/**
+ * Check one pixel format and frame size against the reference
+ */
+static int check_pattern(uint8_t type, uint16_t width, uint16_t height)
+{
+    static const uint32_t chunks[] = { 1, 3, 1013, 3060, 16372 };
+    CyFxUvcPattern_t pat;
+    uint32_t size = CyFxUvcPatternFrameSize(type, width, height);
+    uint8_t *ref = malloc(size), *whole = malloc(size), *pieces = malloc(size + 8);
+    int ok = 1;
+
+    CyFxUvcPatternStart(&pat, type, width, height);
+    if (pat.frameSize != size) ok = 0;
+
+    for (uint32_t frame = 0; ok && frame < 3; frame++) {
+        // Frame numbers that light up counter cells at both ends
+        pat.frameCount = (frame == 0) ? 0 : (frame == 1) ? 0x80000001u : 0x12345678u;
+        ref_frame(&pat, ref);
+
+        memset(whole, 0xEE, size);
+        CyFxUvcPatternFill(&pat, 0, whole, size);
+        if (memcmp(ref, whole, size) != 0) {
+            printf("FAIL: %s %ux%u frame %u differs from the reference\n",
+                   type == CY_FX_UVC_PATTERN_YUY2 ? "YUY2" : "NV12", width, height, frame);
+            ok = 0;
+            break;
+        }
+
+        for (uint32_t c = 0; ok && c < sizeof(chunks) / sizeof(chunks[0]); c++) {
+            uint8_t *dst = pieces + 1 + (c % 3);
+            for (uint32_t off = 0; off < size; off += chunks[c]) {
+                uint32_t n = (size - off < chunks[c]) ? size - off : chunks[c];
+                CyFxUvcPatternFill(&pat, off, dst + off, n);
+            }
+            if (memcmp(ref, dst, size) != 0) {
+                printf("FAIL: %ux%u frame %u differs when filled in %u byte pieces\n", width, height, frame, chunks[c]);
+                ok = 0;
+            }
+        }
+    }
+
+    free(ref);
+    free(whole);
+    free(pieces);
+    return ok;
+}
+
+/**
+ * Check the picture adjustment of the bars, and that it leaves the counter band and gradient alone
+ */
+static int check_picture(void)
+{
+    static const CyFxUvcPatternPicture_t unity = { 256, 256, 0, 256 };
+    static const CyFxUvcPatternPicture_t grey  = { 256, 256, 0, 0 };
+    static const CyFxUvcPatternPicture_t hot   = { 512, 256, 40, 512 };
+    CyFxUvcPattern_t pat;
+    uint32_t size = CyFxUvcPatternFrameSize(CY_FX_UVC_PATTERN_YUY2, 176, 144);
+    uint8_t *ref = malloc(size), *out = malloc(size);
+    uint32_t below;
+    int ok = 1;
+
+    CyFxUvcPatternStart(&pat, CY_FX_UVC_PATTERN_YUY2, 176, 144);
+    below = pat.barsEnd * pat.rowBytes;
+    pat.frameCount = 0x12345678u;
+    ref_frame(&pat, ref);
+
+    CyFxUvcPatternPicture(&pat, &unity);
+    if (memcmp(pat.barYuv, bench_bars, sizeof(bench_bars)) != 0) {
+        printf("FAIL: picture adjustment at unity changes the bars\n");
+        ok = 0;
+    }
+
+    CyFxUvcPatternPicture(&pat, &grey);
+    for (int i = 0; i < CY_FX_UVC_PATTERN_BARS; i++) {
+        if (pat.barYuv[i][0] != bench_bars[i][0] || pat.barYuv[i][1] != 128 || pat.barYuv[i][2] != 128) {
+            printf("FAIL: bar %d should lose its colour and keep its luma at saturation 0\n", i);
+            ok = 0;
+        }
+    }
+
+    // Twice the gain, more brightness and saturation: white is clipped, the blue bar brightened,
+    // and the chroma kept within 16 to 240
+    CyFxUvcPatternPicture(&pat, &hot);
+    if (pat.barYuv[0][0] != 235 || pat.barYuv[6][0] != 16 + 19 * 2 + 40 ||
+            pat.barYuv[6][1] != 240 || pat.barYuv[4][2] != 240 || pat.barYuv[1][1] != 16) {
+        printf("FAIL: gain, brightness or saturation is not applied as expected\n");
+        ok = 0;
+    }
+
+    CyFxUvcPatternFill(&pat, 0, out, size);
+    if (out[0] != pat.barYuv[0][0] || out[1] != pat.barYuv[0][1] || memcmp(ref + below, out + below, size - below) != 0) {
+        printf("FAIL: adjusted frame should change the bars only\n");
+        ok = 0;
+    }
+
+    free(ref);
+    free(out);
+    return ok;
+}
+
+static double now_sec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static uint64_t now_cycles(void)
+{
+#ifdef BENCH_HAVE_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/**
+ * Fill frames payload by payload, from the generator or by copying a stored frame
+ */
+static void bench_fill(const char *name, uint8_t type, uint16_t width, uint16_t height, uint32_t payload,
+                       uint32_t iterations, int copy)
+{
+    CyFxUvcPattern_t pat;
+    uint32_t size = CyFxUvcPatternFrameSize(type, width, height);
+    uint32_t data = payload - BENCH_HEADER;
+    uint8_t *buf = malloc(payload + 32);
+    uint8_t *store = malloc(size);
+    uint8_t *dst = buf + BENCH_HEADER;
+    uint64_t bytes = 0, cycles;
+    double start;
+    volatile uint8_t sink = 0;
+
+    CyFxUvcPatternStart(&pat, type, width, height);
+    CyFxUvcPatternFill(&pat, 0, store, size);
+
+    start  = now_sec();
+    cycles = now_cycles();
+    for (uint32_t it = 0; it < iterations; it++) {
+        for (uint32_t off = 0; off < size; off += data) {
+            uint32_t n = (size - off < data) ? size - off : data;
+            if (copy)
+                memcpy(dst, store + off, n);
+            else
+                CyFxUvcPatternFill(&pat, off, dst, n);
+            sink ^= dst[n - 1];
+            bytes += n;
+        }
+        CyFxUvcPatternNextFrame(&pat);
+    }
+    cycles = now_cycles() - cycles;
+    double elapsed = now_sec() - start;
+
+    printf("  %-24s %8.1f MB/s", name, bytes / elapsed / 1e6);
+    if (cycles != 0)
+        printf("  %6.2f bytes/cycle", (double)bytes / cycles);
+    printf("\n");
+
+    (void)sink;
+    free(buf);
+    free(store);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned width = 1280, height = 720, payload = CY_FX_UVC_STREAM_BUF_SIZE, iterations = 50;
+    int failed = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--size") && i + 1 < argc) {
+            if (sscanf(argv[++i], "%ux%u", &width, &height) != 2) width = 0;
+        } else if (!strcmp(argv[i], "--payload") && i + 1 < argc) {
+            payload = strtoul(argv[++i], NULL, 0);
+        } else if (!strcmp(argv[i], "--iterations") && i + 1 < argc) {
+            iterations = strtoul(argv[++i], NULL, 0);
+        } else {
+            fprintf(stderr, "usage: %s [--size WxH] [--payload N] [--iterations N]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (width == 0 || width % 4 || height % 2 || width > 0xFFFF || height > 0xFFFF || payload <= BENCH_HEADER) {
+        fprintf(stderr, "width must be a multiple of 4, height of 2, and the payload longer than the header\n");
+        return 2;
+    }
+
+    printf("UVC Test Pattern Generator\n");
+    printf("==========================\n\n");
+
+    failed |= !check_pattern(CY_FX_UVC_PATTERN_YUY2, 176, 144);
+    failed |= !check_pattern(CY_FX_UVC_PATTERN_YUY2, 640, 480);
+    failed |= !check_pattern(CY_FX_UVC_PATTERN_NV12, 176, 144);
+    failed |= !check_pattern(CY_FX_UVC_PATTERN_NV12, 640, 480);
+    failed |= !check_pattern(CY_FX_UVC_PATTERN_YUY2, 100, 10);
+    failed |= !check_picture();
+    printf("%s: generated frames match the reference\n\n", failed ? "FAIL" : "PASS");
+
+    printf("Fill throughput, %ux%u frames in %u byte payloads (%u byte header):\n",
+           width, height, payload, BENCH_HEADER);
+    bench_fill("YUY2 generated", CY_FX_UVC_PATTERN_YUY2, width, height, payload, iterations, 0);
+    bench_fill("YUY2 copied (baseline)", CY_FX_UVC_PATTERN_YUY2, width, height, payload, iterations, 1);
+    bench_fill("NV12 generated", CY_FX_UVC_PATTERN_NV12, width, height, payload, iterations, 0);
+    bench_fill("NV12 copied (baseline)", CY_FX_UVC_PATTERN_NV12, width, height, payload, iterations, 1);
+    printf("\n");
+
+    return failed;
+}
@@ -0,0 +1,403 @@
+/*
+ * UVC Bit Rate Shaper Simulator
+ * =============================
+ *
+ * Streams one of the frames of an example through its rate control (cyfxuvcrate.c) and bit rate shaper
+ * (cyfxuvcshaper.c) on a simulated clock, the way the streamer does, and reports the bit rates achieved. Built once per
+ * example with the example directory on the include path:
+ *
+ *     gcc -std=c99 -I../../cyfxuvcinmem -I<sdk>/inc ../uvc_shaper_sim.c ../../cyfxuvcinmem/cyfxuvcshaper.c \
+ *         ../../cyfxuvcinmem/cyfxuvcrate.c ../../cyfxuvcinmem/cyfxuvclayer.c ../../cyfxuvcinmem/cyfxuvcslice.c ../../cyfxuvcinmem/cyfxuvcresil.c \
+ *         ../../cyfxuvcinmem/cyfxuvcprobe.c ../../cyfxuvcinmem/cyfxuvcctrl.c ../../cyfxuvcinmem/cyfxuvccontrols.c \
+ *         ../../cyfxuvcinmem/cyfxuvcvidframes.c ../../cyfxuvcinmem/cyfxuvcformats.c -o sim_iso_shaper
+ *
+ * The payload size and frame interval are negotiated with the example's probe handling for the
+ * selected frame. The limits default to the default values of the encoding unit controls; --mode (rate
+ * control mode), --avg, --peak (bit/s), --cpb (16 bit units) and --qp (all three QPs) set them as SET_CUR
+ * would, checked against the control limits, and --resil sets bmErrorResiliencyFeatures. The model:
+ *   - for frames stored in several quality tiers, the tier is picked at the start of every group of
+ *     pictures
+ *   - the layers of a simulcast frame take the frame slots by weight (cyfxuvclayer.c), each access unit
+ *     sent with its prefix NAL unit and the tier of each layer picked for its share of the bit rates;
+ *     --stop N stops layer N, whose slots stay empty
+ *   - the streamer holds each payload until the shaper allows it, sleeping 1 ms at a time
+ *   - an isochronous endpoint sends one payload per 125 us service interval; a bulk endpoint sends
+ *     at the bandwidth the probe handling assumes for it
+ *   - frames are paced at the committed interval as CyFxUVCAppFramePace does
+ *   - with error resiliency on an Annex B stream, the parameter sets are repeated in front of the access
+ *     units and the IDR picture sent again as cyfxuvcresil.c decides, and the overhead is reported
+ *
+ * The bytes committed in each millisecond are recorded and checked against both token buckets: over
+ * any stretch of time, no more than the average rate plus the CPB, and no more than the peak rate plus
+ * one payload (or one ms at the peak rate), may have been sent. The statistics the shaper keeps itself (the shaper statistics
+ * vendor request) are printed alongside.
+ *
+ * Usage: sim_<example>_shaper [--speed hs|ss] [--format N] [--frame N] [--mode N] [--avg N] [--peak N] [--cpb N]
+ *                             [--qp N] [--stop N] [--resil N] [--seconds N]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <cyu3error.h>
+
+// Include the headers of the example given on the include path
+#include "cyfxuvcinmem.h"
+
+// Service interval of an isochronous endpoint in us
+#define SIM_ISO_SERVICE_US      125
+
+// Frame intervals are in 100 ns units
+#define SIM_INTERVAL_PER_MS     10000
+
+// Share of the committed frame rate a stream in a tier that meets the targets must keep
+#define SIM_MIN_FRAME_RATE      0.97
+
+/**
+ * Set every field of an encoding unit control to value as SET_CUR does. Returns 0 if the control rejects
+ * the value.
+ */
+static int set_control(uint8_t selector, uint32_t value)
+{
+    const CyFxUvcCtrlInfo_t *ctrl = CyFxUvcCtrlFind(CY_FX_UVC_EU_ID, selector);
+    uint8_t data[CY_FX_UVC_CTRL_MAX_LEN];
+    int offset = 0;
+
+    if (ctrl == NULL)
+        return 0;
+    for (int f = 0; f < CY_FX_UVC_CTRL_MAX_FIELDS && ctrl->fieldSize[f] != 0; f++)
+        for (int i = 0; i < ctrl->fieldSize[f]; i++)
+            data[offset++] = (value >> (8 * i)) & 0xFF;
+    return CyFxUvcCtrlSet(ctrl, data, ctrl->length) == CY_U3P_SUCCESS;
+}
+
+static uint32_t get_control(uint8_t selector, uint8_t field)
+{
+    const CyFxUvcCtrlInfo_t *ctrl = CyFxUvcCtrlFind(CY_FX_UVC_EU_ID, selector);
+    return ctrl ? CyFxUvcCtrlField(ctrl, field) : 0;
+}
+
+/**
+ * Bytes of parameter sets sent in front of access unit index of a stored stream for the error resiliency
+ * control, as CyFxUVCAppFramePrefix decides, with room bytes left in the frame buffer
+ */
+static uint32_t resil_prefix(CyFxUvcResil_t *rs, uint16_t features, uint8_t stream, const uint8_t *data,
+                             const uint32_t *lens, uint32_t index, uint32_t room)
+{
+    uint32_t param = (features & CY_FX_UVC_RESIL_PARAM_SETS) ? CyFxUvcResilParamSets(data, lens[0]) : 0;
+    return CyFxUvcResilFrame(rs, features, stream, index == 0, param, lens[index], room > lens[index] ? room - lens[index] : 0);
+}
+
+/**
+ * Pick the layer of the next frame slot of a simulcast frame as the streamer does, with the quality tier
+ * of a layer picked at its IDR picture for its share of the bit rates; *missed counts the picks where no
+ * tier met the targets. Returns the length of the access unit with the bytes in front of it, whose number
+ * is returned in *prefix, or 0 for an empty slot.
+ */
+static uint32_t layer_frame(CyFxUvcSimulcast_t *sc, uint32_t interval, uint32_t payload, const CyFxUvcRateTarget_t *target,
+                            uint8_t *layer, CyFxUvcResil_t *rs, uint16_t features, uint32_t room, uint32_t *prefix,
+                            uint32_t *missed)
+{
+    CyFxUvcRateTarget_t share = *target;
+    CyFxUvcLayer_t *l;
+    const uint32_t *lens;
+
+    if ((*layer = CyFxUvcLayerNext(sc)) == CY_FX_UVC_LAYER_NONE)
+        return 0;
+    l = &sc->layer[*layer];
+    if (l->frameIndex == 0 && l->frame_p->tierCount != 0) {
+        share.avgBitRate  = (uint32_t)((uint64_t)target->avgBitRate * l->weight / sc->totalWeight);
+        share.peakBitRate = (uint32_t)((uint64_t)target->peakBitRate * l->weight / sc->totalWeight);
+        uint32_t layer_interval = (uint32_t)((uint64_t)interval * sc->totalWeight / l->weight);
+
+        l->tier = CyFxUvcRateSelectTier(l->frame_p, layer_interval, payload, &share);
+        if (!CyFxUvcRateTierFits(&l->frame_p->tier_p[l->tier], layer_interval, payload, &share))
+            (*missed)++;
+    }
+    lens    = l->frame_p->tierCount != 0 ? l->frame_p->tier_p[l->tier].vidFrameLen_p : l->frame_p->vidFrameLen_p;
+    *prefix = CY_FX_UVC_LAYER_PREFIX_LEN + resil_prefix(rs, features, *layer, l->frame_p->tierCount != 0 ?
+            l->frame_p->tier_p[l->tier].vidFrames_p : l->frame_p->vidFrames_p, lens, l->frameIndex,
+            room - CY_FX_UVC_LAYER_PREFIX_LEN);
+    return *prefix + lens[l->frameIndex];
+}
+
+/**
+ * Wait until the next frame slot is due at the committed interval, as CyFxUVCAppFramePace does
+ */
+static void pace(uint64_t *now_us, uint32_t *start, uint32_t *count, uint32_t interval)
+{
+    uint32_t now_ms = (uint32_t)(*now_us / 1000);
+    uint32_t due    = *start + (uint32_t)(((uint64_t)++*count * interval) / SIM_INTERVAL_PER_MS);
+
+    if ((int32_t)(now_ms - due) > (int32_t)(interval / SIM_INTERVAL_PER_MS)) {
+        *start = now_ms;
+        *count = 0;
+    } else if ((int32_t)(due - now_ms) > 0) {
+        *now_us = (uint64_t)due * 1000;
+    }
+}
+
+/**
+ * Largest excess of the bytes sent over any stretch of time above rate bytes per second
+ */
+static double max_excess(const uint32_t *bytes_per_ms, uint32_t ms, uint32_t rate)
+{
+    double level = 0, low = 0, worst = 0;
+
+    // S(t) = bytes sent up to t - rate * t; the excess is the largest rise of S
+    for (uint32_t t = 0; t < ms; t++) {
+        level += bytes_per_ms[t] - rate / 1000.0;
+        if (level - low > worst) worst = level - low;
+        if (level < low) low = level;
+    }
+    return worst;
+}
+
+int main(int argc, char **argv)
+{
+    CyU3PUSBSpeed_t speed = CY_U3P_SUPER_SPEED;
+    unsigned format = 1, frame = 1, seconds = 10;
+    long mode = -1, avg = -1, peak = -1, cpb = -1, qp = -1, stop = -1, resil = -1;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--speed") && i + 1 < argc) {
+            speed = !strcmp(argv[++i], "hs") ? CY_U3P_HIGH_SPEED : CY_U3P_SUPER_SPEED;
+        } else if (!strcmp(argv[i], "--format") && i + 1 < argc) {
+            format = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--frame") && i + 1 < argc) {
+            frame = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--mode") && i + 1 < argc) {
+            mode = atol(argv[++i]);
+        } else if (!strcmp(argv[i], "--qp") && i + 1 < argc) {
+            qp = atol(argv[++i]);
+        } else if (!strcmp(argv[i], "--avg") && i + 1 < argc) {
+            avg = atol(argv[++i]);
+        } else if (!strcmp(argv[i], "--peak") && i + 1 < argc) {
+            peak = atol(argv[++i]);
+        } else if (!strcmp(argv[i], "--cpb") && i + 1 < argc) {
+            cpb = atol(argv[++i]);
+        } else if (!strcmp(argv[i], "--stop") && i + 1 < argc) {
+            stop = atol(argv[++i]);
+        } else if (!strcmp(argv[i], "--resil") && i + 1 < argc) {
+            resil = strtol(argv[++i], NULL, 0);
+        } else if (!strcmp(argv[i], "--seconds") && i + 1 < argc) {
+            seconds = atoi(argv[++i]);
+        } else {
+            printf("Usage: %s [--speed hs|ss] [--format N] [--frame N] [--mode N] [--avg N] [--peak N] [--cpb N] "
+                   "[--qp N] [--stop N] [--resil N] [--seconds N]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    const CyFxUvcFrameInfo_t *fr = CyFxUvcProbeFindFrame(format, frame);
+    CyFxUvcEpGeometry_t ep;
+    if (fr == NULL || seconds == 0 || CyFxUvcProbeGetEpGeometry(speed, &ep) != CY_U3P_SUCCESS) {
+        fprintf(stderr, "no format %u frame %u, or no streaming at this speed\n", format, frame);
+        return 2;
+    }
+
+    // Negotiate the payload size for the frame at its default interval, as the host would
+    CyFxUvcProbeCtrl_t ctrl;
+    memset(&ctrl, 0, sizeof(ctrl));
+    ctrl.bFormatIndex    = format;
+    ctrl.bFrameIndex     = frame;
+    ctrl.dwFrameInterval = fr->defInterval;
+    CyFxUvcProbeNegotiate(&ctrl, &ep, 0);
+    uint32_t payload  = ctrl.dwMaxPayloadTransferSize < CY_FX_UVC_STREAM_BUF_SIZE ?
+                        ctrl.dwMaxPayloadTransferSize : CY_FX_UVC_STREAM_BUF_SIZE;
+    uint32_t interval = ctrl.dwFrameInterval;
+
+    CyFxUvcCtrlInit();
+    if ((mode >= 0 && !set_control(CY_FX_UVC_EU_RATE_CONTROL_MODE_CONTROL, mode)) ||
+        (avg >= 0 && !set_control(CY_FX_UVC_EU_AVERAGE_BITRATE_CONTROL, avg)) ||
+        (peak >= 0 && !set_control(CY_FX_UVC_EU_PEAK_BIT_RATE_CONTROL, peak)) ||
+        (cpb >= 0 && !set_control(CY_FX_UVC_EU_CPB_SIZE_CONTROL, cpb)) ||
+        (qp >= 0 && !set_control(CY_FX_UVC_EU_QUANTIZATION_PARAMS_CONTROL, qp)) ||
+        (resil >= 0 && !set_control(CY_FX_UVC_EU_ERROR_RESILIENCY_CONTROL, resil))) {
+        fprintf(stderr, "a limit is outside the range of its control\n");
+        return 2;
+    }
+    uint32_t avg_limit  = get_control(CY_FX_UVC_EU_AVERAGE_BITRATE_CONTROL, 0);
+    uint32_t peak_limit = get_control(CY_FX_UVC_EU_PEAK_BIT_RATE_CONTROL, 0);
+    uint32_t cpb_limit  = get_control(CY_FX_UVC_EU_CPB_SIZE_CONTROL, 0);
+    CyFxUvcRateTarget_t target = {
+        (uint8_t)get_control(CY_FX_UVC_EU_RATE_CONTROL_MODE_CONTROL, 0),
+        (uint8_t)get_control(CY_FX_UVC_EU_QUANTIZATION_PARAMS_CONTROL, 1),
+        avg_limit, peak_limit, cpb_limit
+    };
+
+    // Error resiliency applies to the Annex B streams only, as in the streamer
+    const CyFxUvcFormatInfo_t *fmt = CyFxUvcProbeFindFormat(format);
+    uint16_t features = fmt->isAnnexB ? (uint16_t)(get_control(CY_FX_UVC_EU_ERROR_RESILIENCY_CONTROL, 0) &
+                                                   (CY_FX_UVC_RESIL_FEATURES | CY_FX_UVC_RESIL_PERIOD_MASK)) : 0;
+
+    printf("UVC Bit Rate Shaper Simulation (%s, format %u frame %u, %ux%u, %.2f fps, %u byte payloads)\n",
+           speed == CY_U3P_SUPER_SPEED ? "SS" : "HS", format, frame, fr->width, fr->height,
+           1e7 / interval, payload);
+    printf("Limits: average %u bit/s, peak %u bit/s, CPB %u x 16 bits\n", avg_limit, peak_limit, cpb_limit);
+    if (fr->tierCount != 0)
+        printf("Rate control mode %u, QP %u, %u quality tiers\n", target.mode, target.qp, fr->tierCount);
+
+    // Simulcast frames: the layers take the frame slots by weight
+    CyFxUvcSimulcast_t sc;
+    CyFxUvcLayerStart(&sc, fr);
+    if (stop >= 0 && CyFxUvcLayerSetStarted(&sc, (uint8_t)stop, CyFalse) != CY_U3P_SUCCESS) {
+        fprintf(stderr, "the frame has no layer %ld\n", stop);
+        return 2;
+    }
+    if (sc.count != 0)
+        printf("Rate control mode %u, QP %u, %u simulcast layers\n", target.mode, target.qp, sc.count);
+    if (features != 0)
+        printf("Error resiliency 0x%04X\n", features);
+
+    // Simulated streamer
+    uint32_t total_ms = seconds * 1000;
+    uint32_t *bytes_per_ms = calloc(total_ms + 1, sizeof(uint32_t));
+    CyFxUvcShaper_t sh;
+    uint64_t now_us = 0, sent = 0;
+    uint32_t frames = 0, frame_index = 0, frame_length, offset = 0, prefix = 0;
+    uint32_t pace_start = 0, pace_count = 0, sync_ms = 0;
+    uint32_t tier_frames[256] = { 0 };
+    uint32_t layer_frames[CY_FX_UVC_LAYER_MAX] = { 0 }, idle = 0, missed = 0;
+    const uint32_t *lens = fr->vidFrameLen_p;
+    const uint8_t *stored = fr->vidFrames_p;
+    uint8_t tier = 0, layer = CY_FX_UVC_LAYER_NONE;
+    CyFxUvcResil_t rs;
+
+    CyFxUvcShaperStart(&sh, avg_limit, peak_limit, cpb_limit, payload, 0);
+    CyFxUvcResilStart(&rs);
+    if (fr->tierCount != 0) {
+        tier = CyFxUvcRateSelectTier(fr, interval, payload, &target);
+        missed += !CyFxUvcRateTierFits(&fr->tier_p[tier], interval, payload, &target);
+        lens = fr->tier_p[tier].vidFrameLen_p;
+        stored = fr->tier_p[tier].vidFrames_p;
+    }
+    if (fr->vidFrameCount)
+        prefix = resil_prefix(&rs, features, 0, stored, lens, 0, fr->maxFrameBufSize);
+    frame_length = fr->vidFrameCount ? prefix + lens[0] : fr->maxFrameBufSize;
+    while (sc.count != 0 && now_us < (uint64_t)total_ms * 1000 &&
+           (frame_length = layer_frame(&sc, interval, payload, &target, &layer, &rs, features, fr->maxFrameBufSize, &prefix,
+                                       &missed)) == 0) {
+        idle++;
+        pace(&now_us, &pace_start, &pace_count, interval);
+    }
+    while (now_us < (uint64_t)total_ms * 1000 && frame_length != 0) {
+        uint32_t now_ms = (uint32_t)(now_us / 1000);
+        uint32_t data = payload - CY_FX_UVC_MAX_HEADER;
+        uint32_t len  = (frame_length - offset > data) ? payload : frame_length - offset + CY_FX_UVC_MAX_HEADER;
+
+        if (offset == 0)
+            CyFxUvcShaperSetLimits(&sh, avg_limit, peak_limit, cpb_limit, now_ms);
+
+        // Hold the payload back in 1 ms steps
+        if (CyFxUvcShaperDelay(&sh, len, now_ms) != 0) {
+            now_us = (uint64_t)(now_ms + 1) * 1000;
+            continue;
+        }
+        CyFxUvcShaperCommit(&sh, len, now_ms);
+        bytes_per_ms[now_ms] += len;
+        sent += len;
+
+        // Time on the bus
+        now_us += ep.isIso ? SIM_ISO_SERVICE_US : ((uint64_t)len * 1000000 + ep.bytesPerSec - 1) / ep.bytesPerSec;
+
+        offset += len - CY_FX_UVC_MAX_HEADER;
+        if (offset < frame_length)
+            continue;
+
+        // End of frame: next video frame, paced at the committed interval, or the IDR picture again when
+        // error resiliency asks for a sync frame; for a simulcast frame, the layer moves on and the next
+        // slot is picked once it is due
+        frames++;
+        offset = 0;
+        if (sc.count != 0) {
+            layer_frames[layer]++;
+            if (sc.layer[layer].frameIndex == 0)
+                sync_ms = now_ms;
+            CyFxUvcLayerAdvance(&sc.layer[layer], frame_length - prefix);
+            if (CyFxUvcResilSyncDue(&rs, features, 0, now_ms - sync_ms))
+                CyFxUvcLayerSync(&sc);
+        } else {
+            tier_frames[tier]++;
+            if (frame_index == 0)
+                sync_ms = now_ms;
+            if (fr->vidFrameCount && (++frame_index >= fr->vidFrameCount ||
+                                      CyFxUvcResilSyncDue(&rs, features, 0, now_ms - sync_ms)))
+                frame_index = 0;
+            if (frame_index == 0 && fr->tierCount != 0) {
+                tier = CyFxUvcRateSelectTier(fr, interval, payload, &target);
+                missed += !CyFxUvcRateTierFits(&fr->tier_p[tier], interval, payload, &target);
+                lens = fr->tier_p[tier].vidFrameLen_p;
+                stored = fr->tier_p[tier].vidFrames_p;
+            }
+            if (fr->vidFrameCount)
+                prefix = resil_prefix(&rs, features, 0, stored, lens, frame_index, fr->maxFrameBufSize);
+            frame_length = fr->vidFrameCount ? prefix + lens[frame_index] : fr->maxFrameBufSize;
+        }
+
+        pace(&now_us, &pace_start, &pace_count, interval);
+        while (sc.count != 0 && now_us < (uint64_t)total_ms * 1000 &&
+               (frame_length = layer_frame(&sc, interval, payload, &target, &layer, &rs, features,
+                                           fr->maxFrameBufSize, &prefix, &missed)) == 0) {
+            idle++;
+            pace(&now_us, &pace_start, &pace_count, interval);
+        }
+    }
+
+    CyFxUvcShaperStats_t stats;
+    CyFxUvcShaperGetStats(&sh, total_ms, &stats);
+
+    double avg_excess  = avg_limit ? max_excess(bytes_per_ms, total_ms, avg_limit / 8) : 0;
+    double peak_excess = peak_limit ? max_excess(bytes_per_ms, total_ms, peak_limit / 8) : 0;
+    int ok = 1;
+
+    printf("\n");
+    printf("Frames sent:            %u (%.2f fps)\n", frames, frames / (double)seconds);
+    printf("Achieved average:       %.0f bit/s (shaper: %u bit/s)\n", sent * 8.0 / seconds, stats.avgBitRate);
+    printf("Busiest %u ms window:   %u bit/s\n", CY_FX_UVC_SHAPER_WINDOW_MS, stats.peakBitRate);
+    printf("Payloads held back:     %u of %u, %u ms in all\n", stats.heldPayloads, stats.payloads, stats.heldMs);
+    for (int t = 0; t < fr->tierCount; t++)
+        printf("Tier %d (QP %2u, %7u bit/s with headers): %u frames\n", t, fr->tier_p[t].qp,
+               CyFxUvcRateBitRate(CyFxUvcRateWireLength(fr->tier_p[t].avgFrameLen, payload), interval), tier_frames[t]);
+    for (int l = 0; l < sc.count; l++)
+        printf("Layer %d (%ux%u, weight %u):  %u frames (%.2f fps), last tier %u\n", l, sc.layer[l].frame_p->width,
+               sc.layer[l].frame_p->height, sc.layer[l].weight, layer_frames[l], layer_frames[l] / (double)seconds,
+               sc.layer[l].tier);
+    if (sc.count != 0)
+        printf("Empty frame slots:      %u\n", idle);
+    if (features != 0)
+        printf("Resiliency overhead:    %u bytes of parameter sets in %u access units, %u sync frames of %u bytes "
+               "(%.2f%% and %.2f%% of %u bytes)\n", rs.stats.paramSetBytes, rs.stats.paramSets, rs.stats.syncFrames,
+               rs.stats.syncBytes, rs.stats.bytes ? 100.0 * rs.stats.paramSetBytes / rs.stats.bytes : 0.0,
+               rs.stats.bytes ? 100.0 * rs.stats.syncBytes / rs.stats.bytes : 0.0, rs.stats.bytes);
+    if (avg_limit) {
+        printf("Burst above average:    %.0f bytes (CPB %u bytes)\n", avg_excess, stats.cpbBytes);
+        if (avg_excess > stats.cpbBytes + 1) ok = 0;
+    }
+    if (peak_limit) {
+        printf("Burst above peak:       %.0f bytes (allowed %u bytes)\n", peak_excess, stats.peakBytes);
+        if (peak_excess > stats.peakBytes + 1) ok = 0;
+    }
+
+    // A tier that meets the targets must keep the committed frame rate: the shaper counts the payload
+    // headers, so a tier picked on its video data alone is held back and drops frames
+    int tiered = fr->tierCount != 0;
+    for (int l = 0; l < sc.count; l++)
+        tiered |= sc.layer[l].frame_p->tierCount != 0;
+    if (tiered && target.mode != CY_FX_UVC_RATE_CONTROL_CQP && (avg_limit || peak_limit)) {
+        double slots = (frames + idle) / (double)seconds, committed = SIM_INTERVAL_PER_MS * 1000.0 / interval;
+
+        if (missed != 0) {
+            printf("Frame rate:             not checked, no tier met the targets %u times\n", missed);
+        } else {
+            printf("Frame rate:             %.2f of %.2f fps\n", slots, committed);
+            if (slots < committed * SIM_MIN_FRAME_RATE) ok = 0;
+        }
+    }
+    printf("%s: the stream keeps to the limits\n\n", ok ? "PASS" : "FAIL");
+
+    free(bytes_per_ms);
+    return ok ? 0 : 1;
+}
@@ -103,14 +103,14 @@ echo "Test 3: UVC 1.5 Constants Validation"
 echo "-----------------------------------"
 
 # Test 3.1: Check H.264 format constants in ISO headers
-if grep -q "#define CY_FX_UVC_VS_FORMAT_H264.*0x10" ../cyfxuvcinmem/cyfxuvcinmem.h; then
+if grep -q "#define CY_FX_UVC_VS_FORMAT_H264.*0x13" ../cyfxuvcinmem/cyfxuvcinmem.h; then
     test_result "H.264 format constant definition (ISO)" "PASS"
 else
     test_result "H.264 format constant definition (ISO)" "FAIL"
 fi
 
 # Test 3.2: Check H.265 format constants
-if grep -q "#define CY_FX_UVC_VS_FORMAT_H265.*0x12" ../cyfxuvcinmem/cyfxuvcinmem.h; then
+if grep -q "#define CY_FX_UVC_VS_FORMAT_H265.*0x10" ../cyfxuvcinmem/cyfxuvcinmem.h; then
     test_result "H.265 format constant definition" "PASS"
 else
     test_result "H.265 format constant definition" "FAIL"
@@ -131,7 +131,7 @@ else
 fi
 
 # Test 3.5: Check Bulk implementation has same constants
-if grep -q "#define CY_FX_UVC_VS_FORMAT_H264.*0x10" ../cyfxuvcinmem_bulk/cyfxuvcinmem.h; then
+if grep -q "#define CY_FX_UVC_VS_FORMAT_H264.*0x13" ../cyfxuvcinmem_bulk/cyfxuvcinmem.h; then
     test_result "H.264 format constant in Bulk headers" "PASS"
 else
     test_result "H.264 format constant in Bulk headers" "FAIL"
@@ -141,18 +141,18 @@ echo ""
 echo "Test 4: Descriptor Size Validation"
 echo "---------------------------------"
 
-# Test 4.1: Check SS configuration descriptor length update
-if grep -q "0xE0,0x00.*Length of this descriptor and all sub descriptors" ../cyfxuvcinmem/cyfxuvcdscr.c; then
-    test_result "SS config descriptor length updated (0xE0)" "PASS"
+# Test 4.1/4.2: Descriptor lengths are computed by the generator; check that the generated
+# descriptors are up to date with the stream tables
+if python3 ../tools/fx3_uvc_dscr_gen.py --check ../cyfxuvcinmem/cyfxuvcstreams.json; then
+    test_result "ISO descriptors up to date with stream table" "PASS"
 else
-    test_result "SS config descriptor length updated (0xE0)" "FAIL"
+    test_result "ISO descriptors up to date with stream table" "FAIL"
 fi
 
-# Test 4.2: Check HS configuration descriptor length update
-if grep -q "0xD4,0x00.*Length of this descriptor and all sub descriptors" ../cyfxuvcinmem/cyfxuvcdscr.c; then
-    test_result "HS config descriptor length updated (0xD4)" "PASS"
+if python3 ../tools/fx3_uvc_dscr_gen.py --check ../cyfxuvcinmem_bulk/cyfxuvcstreams.json; then
+    test_result "Bulk descriptors up to date with stream table" "PASS"
 else
-    test_result "HS config descriptor length updated (0xD4)" "FAIL"
+    test_result "Bulk descriptors up to date with stream table" "FAIL"
 fi
 
 # Test 4.3: Check VC class descriptor total size update
@@ -0,0 +1,209 @@
+#!/usr/bin/env python3
+#
+# Static stack usage estimator for the FX3 UVC examples.
+#
+# Combines the per-function frame sizes reported by GCC (-fstack-usage, .su files) with the call
+# graph extracted from the object files (objdump -dr, bl/blx/b and call/jmp edges) and reports the
+# worst case stack depth for each thread entry point or callback.
+#
+# Usage (from an example directory, after building with CYFXSTACKUSAGE=1):
+#
+#     python3 ../tools/fx3_stack_usage.py *.o
+#     python3 ../tools/fx3_stack_usage.py --stack UVCAppThread_Entry=4096 --extern CyU3PDebugPrint=200 *.o
+#
+# Functions for which no frame size is known (FX3 SDK library functions) are counted as zero unless
+# a size is given with --extern, and are listed in the report so that the result can be judged.
+# Calls through function pointers cannot be followed and are listed as well.
+#
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+# Thread entry points and callbacks of the examples. The USB and DMA callbacks run on the stacks of
+# the SDK driver threads and are reported so that their contribution to those stacks is visible.
+DEFAULT_ROOTS = [
+    "UVCAppThread_Entry",
+    "UVCMemCheckThread_Entry",
+    "CyFxUVCApplnUSBSetupCB",
+    "CyFxUVCApplnUSBEventCB",
+    "CyFxApplnLPMRqtCB",
+    "CyFxUVCAppDmaCallback",
+]
+
+FUNC_RE   = re.compile(r"^[0-9a-fA-F]+ <([^>]+)>:\s*$")
+CALL_RE   = re.compile(r"^\s*[0-9a-fA-F]+:\s+(?:[0-9a-fA-F]{2,8}\s)+\s*(bl|blx|b|call|callq|jmp|jmpq)\s+(\S+)(?:\s+<([^>]+)>)?")
+RELOC_RE  = re.compile(r"^\s*[0-9a-fA-F]+:\s+(R_ARM_CALL|R_ARM_JUMP24|R_ARM_PC24|R_ARM_THM_CALL|R_ARM_THM_JUMP24|"
+                       r"R_X86_64_PLT32|R_X86_64_PC32|R_386_PC32|R_386_PLT32)\s+(\S+)")
+INDIRECT_RE = re.compile(r"^(?:r\d+|ip|lr|\*.*)$")
+
+
+def parse_su (path, frames):
+    """Read a GCC .su file into frames: name -> (bytes, qualifier)."""
+    with open (path) as su:
+        for line in su:
+            fields = line.rstrip ("\n").split ("\t")
+            if len (fields) < 3:
+                continue
+            name = fields[0].split (":")[-1]
+            frames[name] = (int (fields[1]), fields[2])
+
+
+def strip_offset (sym):
+    """Drop the +offset / -addend part of a symbol reference."""
+    return re.split (r"[+-]0x", sym)[0]
+
+
+def parse_objdump (objdump, obj, graph, indirect):
+    """Add the call edges found in obj to graph (caller -> set of callees)."""
+    out = subprocess.run ([objdump, "-dr", obj], stdout = subprocess.PIPE, universal_newlines = True,
+            check = True).stdout
+
+    func    = None
+    pending = None      # (mnemonic, local target) of the last branch instruction.
+    for line in out.splitlines ():
+        match = FUNC_RE.match (line)
+        if match:
+            func    = match.group (1)
+            pending = None
+            graph.setdefault (func, set ())
+            continue
+        if func is None:
+            continue
+
+        match = RELOC_RE.match (line)
+        if match and pending is not None:
+            target = strip_offset (match.group (2))
+            if target != func:
+                graph[func].add (target)
+            pending = None
+            continue
+
+        # A branch without a relocation is resolved from the disassembly.
+        if pending is not None:
+            mnem, target = pending
+            if (target is not None) and ("+" not in target) and (target != func):
+                graph[func].add (target)
+            pending = None
+
+        match = CALL_RE.match (line)
+        if match:
+            mnem, operand, target = match.groups ()
+            if INDIRECT_RE.match (operand):
+                if mnem in ("bl", "blx", "call", "callq"):
+                    indirect.add (func)
+                continue
+            # Plain branches and jumps are only tail calls if they go to the start of a function.
+            if (mnem in ("b", "jmp", "jmpq")) and ((target is None) or ("+" in target)):
+                continue
+            pending = (mnem, target)
+
+    if pending is not None and func is not None:
+        mnem, target = pending
+        if (target is not None) and ("+" not in target) and (target != func):
+            graph[func].add (target)
+
+
+def worst_path (root, graph, frames, externs, report):
+    """Return (bytes, path) of the deepest call chain starting at root."""
+    memo = {}
+
+    def visit (func, stack):
+        if func in stack:
+            report["recursion"].add (" > ".join (stack[stack.index (func):] + [func]))
+            return (0, [])
+        if func in memo:
+            return memo[func]
+
+        if func in frames:
+            own = frames[func][0]
+            if frames[func][1] != "static":
+                report["dynamic"].add (func)
+        else:
+            own = externs.get (func, report["default_extern"])
+            report["unknown"].add (func)
+
+        best = (0, [])
+        for callee in sorted (graph.get (func, ())):
+            depth = visit (callee, stack + [func])
+            if depth[0] > best[0]:
+                best = depth
+
+        if func in report["indirect_funcs"]:
+            report["indirect"].add (func)
+
+        memo[func] = (own + best[0], [(func, own)] + best[1])
+        return memo[func]
+
+    return visit (root, [])
+
+
+def main ():
+    parser = argparse.ArgumentParser (description = "Estimate worst case stack usage from -fstack-usage output.")
+    parser.add_argument ("objects", nargs = "+", help = "object files; the matching .su files are read as well")
+    parser.add_argument ("--objdump", default = os.environ.get ("CYFXOBJDUMP", "arm-none-eabi-objdump"),
+            help = "objdump to use (default: arm-none-eabi-objdump)")
+    parser.add_argument ("--root", action = "append", help = "entry point to analyse (default: thread entries and callbacks)")
+    parser.add_argument ("--extern", action = "append", default = [], metavar = "NAME=BYTES",
+            help = "stack usage to assume for a function without a .su entry")
+    parser.add_argument ("--default-extern", type = int, default = 0, metavar = "BYTES",
+            help = "stack usage to assume for other functions without a .su entry (default: 0)")
+    parser.add_argument ("--stack", action = "append", default = [], metavar = "ROOT=BYTES",
+            help = "allocated stack size of a root, to report the margin")
+    args = parser.parse_args ()
+
+    frames   = {}
+    graph    = {}
+    indirect = set ()
+    for obj in args.objects:
+        su = os.path.splitext (obj)[0] + ".su"
+        if os.path.exists (su):
+            parse_su (su, frames)
+        else:
+            sys.stderr.write ("warning: %s not found, build with -fstack-usage\n" % su)
+        parse_objdump (args.objdump, obj, graph, indirect)
+
+    externs = {}
+    for item in args.extern:
+        name, size = item.split ("=")
+        externs[name] = int (size, 0)
+    stacks = {}
+    for item in args.stack:
+        name, size = item.split ("=")
+        stacks[name] = int (size, 0)
+
+    roots = args.root if args.root else [r for r in DEFAULT_ROOTS if r in graph]
+    status = 0
+    for root in roots:
+        report = {"unknown": set (), "dynamic": set (), "indirect": set (), "recursion": set (),
+                  "indirect_funcs": indirect, "default_extern": args.default_extern}
+        if root not in graph:
+            print ("%s: not found" % root)
+            status = 1
+            continue
+
+        total, path = worst_path (root, graph, frames, externs, report)
+        print ("%s: %d bytes" % (root, total))
+        print ("    path: %s" % " > ".join ("%s(%d)" % step for step in path))
+        if root in stacks:
+            size = stacks[root]
+            print ("    stack: %d bytes allocated, %d bytes margin" % (size, size - total))
+            if total > size:
+                status = 1
+        unknown = sorted (f for f in report["unknown"] if f not in externs)
+        if unknown:
+            print ("    no frame size (counted as %d): %s" % (args.default_extern, ", ".join (unknown)))
+        if report["dynamic"]:
+            print ("    dynamic frames: %s" % ", ".join (sorted (report["dynamic"])))
+        if report["indirect"]:
+            print ("    indirect calls not followed in: %s" % ", ".join (sorted (report["indirect"])))
+        for cycle in sorted (report["recursion"]):
+            print ("    recursion: %s" % cycle)
+
+    return status
+
+
+if __name__ == "__main__":
+    sys.exit (main ())
@@ -0,0 +1,1506 @@
+#!/usr/bin/env python3
+#
+# Descriptor builder for the FX3 UVC examples.
+#
+# Generates cyfxuvcdscr.c (device, BOS, string and SS/HS/FS configuration descriptors),
+# cyfxuvcformats.c (the format table used by the probe/commit negotiation) and cyfxuvccontrols.c (the
+# unit control table used by the control dispatcher) from a declarative stream table,
+# cyfxuvcstreams.json, kept next to them in each example. All descriptor lengths and
+# total lengths are computed here, so that adding a format, frame, interval or unit only means
+# editing the table and running the generator again.
+#
+# Usage (from an example directory):
+#
+#     python3 ../tools/fx3_uvc_dscr_gen.py cyfxuvcstreams.json
+#     python3 ../tools/fx3_uvc_dscr_gen.py --check cyfxuvcstreams.json
+#
+# --check regenerates in memory and fails if the files on disk differ, so that a hand edit of a
+# generated file (or a table edit without regenerating) is caught by the tests.
+#
+# The sizes of stored frames are read from the frame lengths arrays in the video frames source
+# (cyfxuvcvidframes.c, or the file named by "videoFrames" in the table): the maximum frame size of a
+# stored frame is its largest video frame, and its bit rates follow from the average video frame.
+#
+# A stored frame may hold the same sequence in several quality tiers, for the encoding unit rate
+# control: its "data" entry then gives the "qp" of the sequence it names, and "tiers" lists the other
+# encodings, each with its "qp", "lengths" and "frames", in order of rising QP. The maximum frame size
+# covers all tiers, and the bit rates range from the smallest tier to the largest.
+#
+# Frames of the H.264 simulcast format store nothing: their "layers" list, by stream_id, the frames of
+# an earlier H.264 format sent in each layer ("format" and "frame" indices) and the "weight" of each, the
+# share of the frame slots it gets. The frame gives the size of its largest layer; its maximum frame size
+# is the largest access unit of any layer with the prefix NAL unit added, and its bit rates follow from
+# the average access unit of the layers, weighted by their shares.
+#
+# Values in the table are either numbers or, where the value lives in the example header (endpoint
+# addresses, burst sizes), C expressions given as strings. Numeric strings such as "0x04B4" are
+# taken as numbers. Expressions are emitted as they are; 16-bit fields take their bytes with
+# CY_U3P_GET_LSB / CY_U3P_GET_MSB.
+#
+
+import argparse
+import difflib
+from fractions import Fraction
+import json
+import os
+import re
+import sys
+
+NUM_RE = re.compile (r"^(0[xX][0-9a-fA-F]+|[0-9]+)$")
+
+# Frame lengths arrays in the video frames source: const uint32_t <name>[<count>] = { ... };
+LENGTHS_RE = re.compile (r"const\s+uint32_t\s+(\w+)\s*\[[^\]]*\]\s*=\s*\{([^}]*)\}")
+
+COPYRIGHT = """/*
+ ## Cypress USB 3.0 Platform source file (%s)
+ ## ===========================
+ ##
+ ##  Copyright Cypress Semiconductor Corporation, 2010-2023,
+ ##  All Rights Reserved
+ ##  UNPUBLISHED, LICENSED SOFTWARE.
+ ##
+ ##  CONFIDENTIAL AND PROPRIETARY INFORMATION
+ ##  WHICH IS THE PROPERTY OF CYPRESS.
+ ##
+ ##  Use of this file is governed
+ ##  by the license agreement included in the file
+ ##
+ ##     <install>/license/license.txt
+ ##
+ ##  where <install> is the Cypress software
+ ##  installation root directory path.
+ ##
+ ## ===========================
+*/
+"""
+
+DSCR_NOTE = """/* This file contains the USB enumeration descriptors for the %s.
+ * It is generated by tools/fx3_uvc_dscr_gen.py from %s: edit the stream table
+ * and run the generator again instead of editing this file.
+ *
+ * The descriptor arrays must be 32 byte aligned and multiple of 32 bytes if the D-cache is
+ * turned on. If the linker used is not capable of supporting the aligned feature for this,
+ * either the descriptors must be placed in a different section and the section should be
+ * 32 byte aligned and 32 byte multiple; or dynamically allocated buffer allocated using
+ * CyU3PDmaBufferAlloc must be used, and the descriptor must be loaded into it. The example
+ * assumes that the aligned attribute for 32 bytes is supported by the linker. Do not add
+ * any other variables to this file other than USB descriptors. This is not the only
+ * pre-requisite to enabling the D-cache. Refer to the documentation for
+ * CyU3PDeviceCacheControl for more information.
+ */
+"""
+
+CONTROLS_NOTE = """/* This file contains the table of the unit controls handled by the control dispatcher (cyfxuvcctrl.c).
+ * It is generated by tools/fx3_uvc_dscr_gen.py from %s together with the bmControls bitmaps
+ * of the unit descriptors in cyfxuvcdscr.c, so that the device answers for exactly the controls it
+ * reports: edit the stream table and run the generator again instead of editing this file.
+ */
+"""
+
+FORMATS_NOTE = """/* This file contains the table of formats, frames and frame intervals used by the probe and commit
+ * negotiation (cyfxuvcprobe.c). It is generated by tools/fx3_uvc_dscr_gen.py from %s
+ * together with the descriptors in cyfxuvcdscr.c, so that both always describe the same streams:
+ * edit the stream table and run the generator again instead of editing this file.
+ */
+"""
+
+# Payload formats known to the builder: descriptor subtypes, the name used in comments and the
+# constant for the subtype in the format table. The uncompressed formats have no stored frames; their
+# frames are generated by the pattern generator (cyfxuvcpattern.c), and their frame size follows from
+# the bits per pixel. H.264 frames are stored as Annex B access units, one per video frame, and are
+# described by the UVC 1.5 H.264 payload descriptors.
+#
+# Any other compressed stream is a frame based format: the table gives its "fourcc" (or the whole
+# "guid" as 32 hex digits) and a "name" for the comments, and its frames are stored like the others,
+# one variable size video frame each. UVC 1.5 has no H.265 payload format, so H.265 is described
+# this way with the H265 FourCC. "annexB": true marks a frame based format stored as Annex B access
+# units, like the H.264 formats, whose payloads can be aligned to the NAL units (cyfxuvcslice.h).
+FORMAT_TYPES = {
+    "mjpeg": { "name": "MJPEG", "subtype": "MJPEG", "format": 0x06, "frame": 0x07,
+               "const": "CY_FX_UVC_VS_FORMAT_MJPEG" },
+    "yuy2":  { "name": "YUY2", "subtype": "UNCOMPRESSED", "format": 0x04, "frame": 0x05, "bpp": 16,
+               "pattern": "CY_FX_UVC_PATTERN_YUY2", "const": "CY_FX_UVC_VS_FORMAT_UNCOMPRESSED" },
+    "nv12":  { "name": "NV12", "subtype": "UNCOMPRESSED", "format": 0x04, "frame": 0x05, "bpp": 12,
+               "pattern": "CY_FX_UVC_PATTERN_NV12", "const": "CY_FX_UVC_VS_FORMAT_UNCOMPRESSED" },
+    "h264":  { "name": "H.264", "subtype": "H264", "format": "CY_FX_UVC_VS_FORMAT_H264",
+               "frame": "CY_FX_UVC_VS_FRAME_H264", "const": "CY_FX_UVC_VS_FORMAT_H264", "annexB": True },
+    "h264_simulcast": { "name": "H.264 simulcast", "subtype": "H264_SIMULCAST",
+                        "format": "CY_FX_UVC_VS_FORMAT_H264_SIMULCAST", "frame": "CY_FX_UVC_VS_FRAME_H264",
+                        "const": "CY_FX_UVC_VS_FORMAT_H264_SIMULCAST", "annexB": True },
+    "frame_based": { "name": "Frame based", "subtype": "FRAME_BASED", "format": "CY_FX_UVC_VS_FORMAT_FRAME_BASED",
+                     "frame": "CY_FX_UVC_VS_FRAME_FRAME_BASED", "const": "CY_FX_UVC_VS_FORMAT_FRAME_BASED" },
+}
+
+# H.264 descriptor values for the stored streams: constrained baseline streams of one layer, with an
+# IDR picture (SPS and PPS in front) only where the stream starts, CAVLC entropy coding, no picture
+# reordering and a constant frame rate. The rate control modes are those of the rate control mode
+# control of the encoding unit, mode m in bit m - 1 (the quality tiers let the device follow any of
+# them); without the control the streams are reported as CBR, being encoded at a fixed target bit rate.
+H264_RATE_CONTROL_CBR   = 0x02
+H264_RATE_CONTROL_NAMES = { 1: "VBR", 2: "CBR", 3: "constant QP", 4: "global VBR", 5: "VBR no underflow",
+                            6: "global VBR no underflow" }
+
+# Sync frame types that can be asked for with the sync and reference frame control, type n in bit n of
+# bmSupportedSyncFrameTypes: those in the range of the control, on its resolution.
+H264_SYNC_FRAME_NAMES   = { 0: "reset", 1: "IDR", 2: "IDR LTR", 3: "random access", 4: "random access LTR",
+                            5: "P LTR", 6: "GDR" }
+H264_USAGE_REALTIME     = 0x00000001
+H264_CAPS               = 0x0025        # CAVLC, constant frame rate, no picture reordering.
+H264_MB_PER_SEC_FIELDS  = 20            # wMaxMBperSec* fields of the format descriptor.
+H264_MB_PER_SEC_LAYOUTS = 5             # Of those, per number of resolutions: no scalability first.
+H264_RESOLUTION_NAMES   = ["one resolution", "two resolutions", "three resolutions", "four resolutions"]
+
+# Simulcast layers (cyfxuvclayer.h): at most CY_FX_UVC_LAYER_MAX, each access unit sent with a prefix NAL
+# unit of CY_FX_UVC_LAYER_PREFIX_LEN bytes in front; stream_id in wLayerOrViewID of the select layer control.
+SIMULCAST_MAX_LAYERS    = 4
+SIMULCAST_PREFIX_LEN    = 9
+SIMULCAST_STREAM_ID_POS = 10
+
+# Slice modes of the slice mode control (cyfxuvcslice.h), mode m in bit m of bmSupportedSliceModes. The stored
+# streams have one slice per picture and can be sent in two of them: as they are in the number of slices per
+# frame mode, and with the payloads aligned to the NAL units in the target compressed size per slice mode.
+H264_SLICE_MODE_NAMES   = { 0: "maximum MBs per slice", 1: "target compressed size per slice",
+                            2: "number of slices per frame", 3: "MB rows per slice" }
+H264_SLICE_MODES        = (1, 2)
+
+# bmErrorResiliencyFeatures of the error resiliency control (cyfxuvcresil.h): repeated parameter sets (bit 0)
+# and sync frames at least once a second (bit 1), and the period of the repeated parameter sets in bits 15:8.
+RESIL_FEATURE_BITS      = 0xFF03
+
+# Uncompressed and frame based format GUIDs are the FourCC followed by this fixed tail.
+GUID_TAIL = [0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71]
+
+# Controls that the table can list for a unit, by unit type: control selector macro prefix, and per
+# control the selector, the bmControls bit, the size in bytes of each field and the action that the
+# firmware takes after a SET_CUR (CY_FX_UVC_CTRL_APPLY_* in cyfxuvcctrl.h). A unit with a control list
+# gets its bmControls (and bmControlsRuntime) from the list; the others give the bitmaps as numbers.
+UNIT_CONTROLS = {
+    "camera": { "prefix": "CY_FX_UVC_CT_", "controls": {
+        "SCANNING_MODE":            (0x01,  0, [1],             "NONE"),
+        "AE_MODE":                  (0x02,  1, [1],             "NONE"),
+        "AE_PRIORITY":              (0x03,  2, [1],             "NONE"),
+        "EXPOSURE_TIME_ABSOLUTE":   (0x04,  3, [4],             "PICTURE"),
+    }},
+    "processing": { "prefix": "CY_FX_UVC_PU_", "controls": {
+        "BACKLIGHT_COMPENSATION":   (0x01,  8, [2],             "NONE"),
+        "BRIGHTNESS":               (0x02,  0, [2],             "PICTURE"),
+        "CONTRAST":                 (0x03,  1, [2],             "PICTURE"),
+        "GAIN":                     (0x04,  9, [2],             "PICTURE"),
+        "POWER_LINE_FREQUENCY":     (0x05, 10, [1],             "NONE"),
+        "HUE":                      (0x06,  2, [2],             "NONE"),
+        "SATURATION":               (0x07,  3, [2],             "PICTURE"),
+        "SHARPNESS":                (0x08,  4, [2],             "NONE"),
+        "GAMMA":                    (0x09,  5, [2],             "NONE"),
+    }},
+    "encoding": { "prefix": "CY_FX_UVC_EU_", "controls": {
+        "SELECT_LAYER":             (0x01,  0, [2],             "LAYER"),
+        "PROFILE_TOOLSET":          (0x02,  1, [2, 2, 1],       "NONE"),
+        "VIDEO_RESOLUTION":         (0x03,  2, [2, 2],          "NONE"),
+        "MIN_FRAME_INTERVAL":       (0x04,  3, [4],             "NONE"),
+        "SLICE_MODE":               (0x05,  4, [2, 2],          "SLICE"),
+        "RATE_CONTROL_MODE":        (0x06,  5, [1],             "NONE"),
+        "AVERAGE_BITRATE":          (0x07,  6, [4],             "NONE"),
+        "CPB_SIZE":                 (0x08,  7, [4],             "NONE"),
+        "PEAK_BIT_RATE":            (0x09,  8, [4],             "NONE"),
+        "QUANTIZATION_PARAMS":      (0x0A,  9, [2, 2, 2],       "NONE"),
+        "SYNC_REF_FRAME":           (0x0B, 10, [1, 2, 1],       "SYNC"),
+        "LTR_BUFFER":               (0x0C, 11, [1, 1],          "NONE"),
+        "LTR_PICTURE":              (0x0D, 12, [1, 1],          "NONE"),
+        "LTR_VALIDATION":           (0x0E, 13, [2],             "NONE"),
+        "LEVEL_IDC_LIMIT":          (0x0F, 14, [1],             "NONE"),
+        "SEI_PAYLOADTYPE":          (0x10, 15, [4, 4],          "NONE"),
+        "QP_RANGE":                 (0x11, 16, [1, 1],          "NONE"),
+        "PRIORITY":                 (0x12, 17, [1],             "NONE"),
+        "START_OR_STOP_LAYER":      (0x13, 18, [1],             "LAYER"),
+        "ERROR_RESILIENCY":         (0x14, 19, [2],             "RESIL"),
+    }},
+}
+
+# Controls whose values are signed numbers in the UVC specification.
+SIGNED_CONTROLS         = ("BRIGHTNESS", "HUE")
+
+# GET_INFO bits and the size limits of the control dispatcher (cyfxuvcctrl.h).
+CTRL_INFO_GET, CTRL_INFO_SET, CTRL_INFO_AUTOUPDATE, CTRL_INFO_ASYNC = 0x01, 0x02, 0x08, 0x10
+CTRL_MAX_FIELDS, CTRL_MAX_LEN = 4, 32
+
+# Names of the units as used in the "Source ID" comments.
+UNIT_NAMES = {
+    "camera":     "input terminal",
+    "processing": "proc unit",
+    "extension":  "extn unit",
+    "encoding":   "encoding unit",
+}
+
+
+# Descriptor subtypes of the units and terminals of the video control interface.
+UNIT_SUBTYPES = {
+    "camera":     0x02,
+    "output":     0x03,
+    "processing": 0x05,
+    "extension":  0x06,
+    "encoding":   0x07,
+}
+
+
+class GenError (Exception):
+    pass
+
+
+def value (v, what):
+    """Return an int for numeric table values, or the C expression string."""
+    if isinstance (v, bool):
+        return int (v)
+    if isinstance (v, int):
+        return v
+    if isinstance (v, str):
+        v = v.strip ()
+        if NUM_RE.match (v):
+            return int (v, 0)
+        if v:
+            return v
+    raise GenError ("%s: bad value %r" % (what, v))
+
+
+def number (v, what):
+    v = value (v, what)
+    if not isinstance (v, int):
+        raise GenError ("%s must be a number, not %r" % (what, v))
+    return v
+
+
+def minus_one (v):
+    return v - 1 if isinstance (v, int) else "%s - 1" % v
+
+
+class Field:
+    """One line of a descriptor array: the byte tokens and the comment."""
+
+    def __init__ (self, tokens, comment = None):
+        self.tokens  = tokens
+        self.comment = comment
+
+    def __len__ (self):
+        return len (self.tokens)
+
+
+def b (v, comment = None, what = "byte"):
+    v = value (v, what)
+    if isinstance (v, int):
+        if not 0 <= v <= 0xFF:
+            raise GenError ("%s: %d does not fit in a byte" % (what, v))
+        return Field (["0x%02X" % v], comment)
+    return Field ([v], comment)
+
+
+def w (v, comment = None, what = "word"):
+    v = value (v, what)
+    if isinstance (v, int):
+        if not 0 <= v <= 0xFFFF:
+            raise GenError ("%s: %d does not fit in 16 bits" % (what, v))
+        return Field (["0x%02X" % (v & 0xFF), "0x%02X" % (v >> 8)], comment)
+    return Field (["CY_U3P_GET_LSB (%s)" % v, "CY_U3P_GET_MSB (%s)" % v], comment)
+
+
+def dw (v, comment = None, what = "dword"):
+    v = number (v, what)
+    if not 0 <= v <= 0xFFFFFFFF:
+        raise GenError ("%s: %d does not fit in 32 bits" % (what, v))
+    return Field (["0x%02X" % ((v >> s) & 0xFF) for s in (0, 8, 16, 24)], comment)
+
+
+def raw (token, comment = None):
+    return Field ([token], comment)
+
+
+def bitmap (v, size, comment, what):
+    """bmControls style bitmap of size bytes, given as a number or a byte list."""
+    if isinstance (v, list):
+        if len (v) != size:
+            raise GenError ("%s: expected %d bytes" % (what, size))
+        return Field (["0x%02X" % number (x, what) for x in v], comment)
+    v = number (v, what)
+    return Field (["0x%02X" % ((v >> (8 * i)) & 0xFF) for i in range (size)], comment)
+
+
+class Dscr:
+    """A descriptor: a title comment and its fields. The size field is added by the builder."""
+
+    def __init__ (self, title, fields, size_comment = "Descriptor size"):
+        self.title  = title
+        size = 1 + sum (len (f) for f in fields)
+        if size > 0xFF:
+            raise GenError ("%s: descriptor too long (%d bytes)" % (title, size))
+        self.fields = [b (size, size_comment % size if "%" in size_comment else size_comment)] + fields
+
+    def __len__ (self):
+        return sum (len (f) for f in self.fields)
+
+
+def cs_dscr (title, fields):
+    """Class specific descriptors state their size in the comment."""
+    return Dscr (title, fields, "Descriptor size: %d bytes")
+
+
+def per_count (comment, v):
+    """Comments show counts given as numbers; expressions speak for themselves."""
+    return "%s : %d" % (comment, v) if isinstance (v, int) else comment
+
+
+def fps (interval):
+    rate = 10000000.0 / interval
+    if abs (rate - round (rate)) < 0.005:
+        return "%d fps" % round (rate)
+    return "%s fps" % ("%.2f" % rate).rstrip ("0")
+
+
+def render_array (name, dscrs, out):
+    """Emit one const uint8_t array holding the given descriptors."""
+    out.append ("const uint8_t %s[] __attribute__ ((aligned (32))) =" % name)
+    out.append ("{")
+    lines = []
+    for i, d in enumerate (dscrs):
+        if d.title:
+            if i:
+                lines.append (None)
+            lines.append ("    /* %s */" % d.title)
+        for f in d.fields:
+            lines.append (f)
+    last = max (i for i, l in enumerate (lines) if isinstance (l, Field))
+    for i, l in enumerate (lines):
+        if l is None:
+            out.append ("")
+        elif isinstance (l, str):
+            out.append (l)
+        else:
+            sep  = "" if i == last else ","
+            text = ",".join (l.tokens) + sep
+            if len (text) >= 32 and len (l.tokens) > 1:
+                # Long expressions: one byte per line, the comment on the first one.
+                rows = [(t + ",", l.comment if j == 0 else None) for j, t in enumerate (l.tokens)]
+                rows[-1] = (l.tokens[-1] + sep, rows[-1][1])
+            else:
+                rows = [(text, l.comment)]
+            for text, comment in rows:
+                if not comment:
+                    out.append ("    %s" % text)
+                    continue
+                head = ("    %-32s" % text) if len (text) < 32 else ("    %s " % text)
+                comment = comment.split ("\n")
+                out.append ("%s/* %s%s" % (head, comment[0], " */" if len (comment) == 1 else ""))
+                for k, more in enumerate (comment[1:], 2):
+                    out.append ("%s%s%s" % (" " * (len (head) + 3), more, " */" if k == len (comment) else ""))
+    out.append ("};")
+    out.append ("")
+
+
+class Builder:
+
+    def __init__ (self, table, table_name, table_dir):
+        self.t          = table
+        self.table_name = table_name
+        self.units      = table.get ("units", [])
+        self.formats    = table.get ("formats", [])
+        self.ep         = table["streamEndpoint"]
+        self.status     = table["statusEndpoint"]
+        self.lengths    = self.read_lengths (os.path.join (table_dir, table.get ("videoFrames", "cyfxuvcvidframes.c")))
+        self.validate ()
+
+    @staticmethod
+    def read_lengths (path):
+        """Frame lengths arrays of the video frames source, by name."""
+        try:
+            with open (path) as f:
+                text = re.sub (r"/\*.*?\*/", "", f.read (), flags = re.S)
+        except IOError:
+            raise GenError ("cannot read the video frames source %s" % path)
+        return { m.group (1): [number (x, m.group (1)) for x in m.group (2).replace (",", " ").split ()]
+                 for m in LENGTHS_RE.finditer (text) }
+
+    # ---------------------------------------------------------------------------------------------
+    # Table checks
+    # ---------------------------------------------------------------------------------------------
+
+    def validate (self):
+        ids = {}
+        for u in self.units:
+            uid = number (u.get ("id"), "unit id")
+            if uid in ids or not 1 <= uid <= 0xFF:
+                raise GenError ("unit id %d is not unique or out of range" % uid)
+            if u["type"] not in UNIT_NAMES and u["type"] != "output":
+                raise GenError ("unknown unit type %r" % u["type"])
+            ids[uid] = u
+        for u in self.units:
+            if u["type"] != "camera" and number (u.get ("source"), "unit source") not in ids:
+                raise GenError ("unit %d: source %r does not exist" % (u["id"], u.get ("source")))
+        outputs = [u for u in self.units if u["type"] == "output"]
+        if len (outputs) != 1:
+            raise GenError ("exactly one output terminal is required")
+        self.unit_ids = ids
+        self.output   = outputs[0]
+        self.controls = [c for u in self.units for c in self.unit_controls (u)]
+        if len (self.controls) > 0xFF:
+            raise GenError ("more than 255 unit controls")
+
+        if not self.formats:
+            raise GenError ("at least one format is required")
+        for fi, fmt in enumerate (self.formats, 1):
+            if fmt["type"] not in FORMAT_TYPES:
+                raise GenError ("format %d: unknown type %r" % (fi, fmt["type"]))
+            frames = fmt.get ("frames", [])
+            if not frames:
+                raise GenError ("format %d: no frames" % fi)
+            if not 1 <= fmt.get ("defaultFrame", 1) <= len (frames):
+                raise GenError ("format %d: default frame out of range" % fi)
+            for ri, fr in enumerate (frames, 1):
+                iv = [number (x, "interval") for x in fr["intervals"]]
+                if not iv or iv != sorted (set (iv)):
+                    raise GenError ("format %d frame %d: intervals must be unique, shortest first" % (fi, ri))
+                if number (fr.get ("defaultInterval", iv[0]), "default interval") not in iv:
+                    raise GenError ("format %d frame %d: default interval is not listed" % (fi, ri))
+                if fmt["type"] == "h264_simulcast":
+                    self.check_layers (fi, ri, fr)
+                elif "bpp" in FORMAT_TYPES[fmt["type"]]:
+                    if "data" in fr:
+                        raise GenError ("format %d frame %d: uncompressed frames are generated, not stored" % (fi, ri))
+                    if fr["width"] % 4 or fr["height"] % 2:
+                        raise GenError ("format %d frame %d: width must be a multiple of 4, height of 2" % (fi, ri))
+                    size = self.frame_size (fmt, fr)
+                    if number (fr.get ("maxFrameSize", size), "maxFrameSize") != size:
+                        raise GenError ("format %d frame %d: maxFrameSize should be %d" % (fi, ri, size))
+                else:
+                    if "data" not in fr:
+                        raise GenError ("format %d frame %d: no stored video data" % (fi, ri))
+                    lens = self.lengths.get (fr["data"]["lengths"])
+                    if not lens:
+                        raise GenError ("format %d frame %d: %s is not in the video frames source"
+                                        % (fi, ri, fr["data"]["lengths"]))
+                    count = value (fr["data"]["count"], "count")
+                    if isinstance (count, int) and count != len (lens):
+                        raise GenError ("format %d frame %d: %s has %d frames, not %d"
+                                        % (fi, ri, fr["data"]["lengths"], len (lens), count))
+                    if len (lens) > 0xFFFF:
+                        raise GenError ("format %d frame %d: more than 65535 stored frames" % (fi, ri))
+                    self.check_tiers (fi, ri, fr)
+                    if "maxFrameSize" in fr and number (fr["maxFrameSize"], "maxFrameSize") != self.frame_size (fmt, fr):
+                        raise GenError ("format %d frame %d: maxFrameSize should be %d, the largest stored frame"
+                                        % (fi, ri, self.frame_size (fmt, fr)))
+                if fmt["type"] == "frame_based" and ri == 1:
+                    if ("fourcc" in fmt) == ("guid" in fmt) or "name" not in fmt:
+                        raise GenError ("format %d: a frame based format needs a name and either a fourcc or a guid" % fi)
+                    if len (self.guid (fmt)) != 16:
+                        raise GenError ("format %d: fourcc must be 4 characters, guid 32 hex digits" % fi)
+                    if not isinstance (fmt.get ("annexB", False), bool):
+                        raise GenError ("format %d: annexB must be true or false" % fi)
+                elif "annexB" in fmt and ri == 1:
+                    raise GenError ("format %d: annexB is only given for frame based formats" % fi)
+                if fmt["type"] in ("h264", "h264_simulcast"):
+                    for key in ("profile", "level"):
+                        if key not in fr:
+                            raise GenError ("format %d frame %d: H.264 frames need the %s of the stream" % (fi, ri, key))
+        if self.ep["type"] not in ("bulk", "iso"):
+            raise GenError ("stream endpoint type must be bulk or iso")
+
+        # The layer controls select and start or stop the layers of the simulcast frames, by stream_id.
+        layers = max ([len (fr.get ("layers", [])) for fmt in self.formats for fr in fmt["frames"]] + [0])
+        sel    = self.eu_control ("SELECT_LAYER")
+        if bool (sel) != bool (self.eu_control ("START_OR_STOP_LAYER")) or bool (sel) != bool (layers):
+            raise GenError ("SELECT_LAYER and START_OR_STOP_LAYER go together, with a simulcast format")
+        if sel and (sel["min"][0] != 0 or sel["res"][0] != 1 << SIMULCAST_STREAM_ID_POS or
+                    sel["max"][0] != (layers - 1) << SIMULCAST_STREAM_ID_POS):
+            raise GenError ("SELECT_LAYER should select the stream_id (bits 12:10) of up to %d layers" % layers)
+
+        # The slice mode control picks how the payloads of the Annex B streams are cut.
+        slice_mode = self.eu_control ("SLICE_MODE")
+        if slice_mode and not any (self.annex_b (fmt) for fmt in self.formats):
+            raise GenError ("SLICE_MODE needs an H.264 or other Annex B format")
+        if slice_mode and (slice_mode["min"][0] < min (H264_SLICE_MODES) or slice_mode["max"][0] > max (H264_SLICE_MODES)
+                           or slice_mode["res"][0] != 1 or slice_mode["min"][1] == 0):
+            raise GenError ("SLICE_MODE: wSliceMode should be %s, wSliceConfigSetting at least 1"
+                            % " to ".join ("%d" % m for m in H264_SLICE_MODES))
+
+        # The error resiliency control adds redundancy to the Annex B streams.
+        resil = self.eu_control ("ERROR_RESILIENCY")
+        if resil and not any (self.annex_b (fmt) for fmt in self.formats):
+            raise GenError ("ERROR_RESILIENCY needs an H.264 or other Annex B format")
+        if resil and (resil["res"][0] != 1 or (resil["max"][0] | resil["def"][0]) & ~RESIL_FEATURE_BITS):
+            raise GenError ("ERROR_RESILIENCY: bmErrorResiliencyFeatures can only have the bits 0x%04X" % RESIL_FEATURE_BITS)
+
+        # Camera terminal and processing unit controls. The device has no automatic exposure, and the
+        # dispatcher checks the limits as unsigned numbers, so that the signed controls must stay positive.
+        for c in self.controls:
+            what = "unit %d %s" % (c["unit"], c["name"])
+            if c["name"] == "AE_MODE" and (c["min"], c["max"], c["res"], c["def"]) != ([1], [1], [1], [1]):
+                raise GenError ("%s: only the manual mode (1) is supported" % what)
+            if c["name"] in SIGNED_CONTROLS and max (c["max"][0], c["def"][0]) > 0x7FFF:
+                raise GenError ("%s: the limits of a signed control must be 0 to 32767" % what)
+
+    @staticmethod
+    def has_control_list (u):
+        """Whether a unit lists its controls, rather than giving its bmControls as a number or byte list."""
+        v = u.get ("controls", 0)
+        return isinstance (v, list) and all (isinstance (x, dict) for x in v)
+
+    @staticmethod
+    def unit_controls (u):
+        """Controls listed for a unit, with their limits as lists of field values."""
+        if not Builder.has_control_list (u):
+            return []
+        uid = number (u["id"], "unit id")
+        if u["type"] not in UNIT_CONTROLS:
+            raise GenError ("unit %d: the controls of a %s unit cannot be listed" % (uid, u["type"]))
+        spec = UNIT_CONTROLS[u["type"]]
+        out  = []
+        for c in u["controls"]:
+            name = c.get ("control")
+            if name not in spec["controls"]:
+                raise GenError ("unit %d: unknown control %r" % (uid, name))
+            if name in [x["name"] for x in out]:
+                raise GenError ("unit %d: %s is listed twice" % (uid, name))
+            selector, bit, sizes, apply = spec["controls"][name]
+            what = "unit %d %s" % (uid, name)
+            if c.get ("runtime") and u["type"] != "encoding":
+                raise GenError ("%s: only the encoding unit reports the controls settable while streaming" % what)
+            if c.get ("async") and c.get ("readOnly"):
+                raise GenError ("%s: a read only control cannot complete SET_CUR asynchronously" % what)
+
+            def fields (key, default):
+                v = c.get (key, default)
+                v = v if isinstance (v, list) else [v]
+                if len (v) != len (sizes):
+                    raise GenError ("%s: %s needs %d values" % (what, key, len (sizes)))
+                v = [number (x, "%s %s" % (what, key)) for x in v]
+                for x, size in zip (v, sizes):
+                    if not 0 <= x < (1 << (8 * size)):
+                        raise GenError ("%s: %s %d does not fit in %d bytes" % (what, key, x, size))
+                return v
+
+            ctrl = { "name": name, "unit": uid, "unitType": u["type"], "selector": selector, "bit": bit,
+                     "sizes": sizes, "macro": "%s%s_CONTROL" % (spec["prefix"], name), "apply": apply,
+                     "min": fields ("min", None), "max": fields ("max", None) }
+            ctrl["res"] = fields ("res", [1] * len (sizes))
+            ctrl["def"] = fields ("def", ctrl["min"])
+            ctrl["info"] = CTRL_INFO_GET | (0 if c.get ("readOnly") else CTRL_INFO_SET) | \
+                           (CTRL_INFO_AUTOUPDATE if c.get ("autoUpdate") else 0) | \
+                           (CTRL_INFO_ASYNC if c.get ("async") else 0)
+            ctrl["runtime"] = bool (c.get ("runtime"))
+            # Only the encoding unit limits the controls that can be set while streaming (bmControlsRuntime).
+            ctrl["setWhileStreaming"] = ctrl["runtime"] or u["type"] != "encoding"
+            for i in range (len (sizes)):
+                lo, hi, res, dflt = ctrl["min"][i], ctrl["max"][i], ctrl["res"][i], ctrl["def"][i]
+                if not lo <= dflt <= hi:
+                    raise GenError ("%s: default out of range" % what)
+                if res > 1 and ((dflt - lo) % res or (hi - lo) % res):
+                    raise GenError ("%s: default and maximum must be whole steps of %d from the minimum" % (what, res))
+            if len (sizes) > CTRL_MAX_FIELDS or sum (sizes) > CTRL_MAX_LEN:
+                raise GenError ("%s: too large for the control dispatcher" % what)
+            out.append (ctrl)
+        return out
+
+    def control_bitmaps (self, u, what):
+        """bmControls and bmControlsRuntime of a unit: from its control list, or as given in the table."""
+        ctrls = self.unit_controls (u)
+        if not self.has_control_list (u):
+            return (bitmap (u.get ("controls", 0), 3, "Controls supported", what),
+                    bitmap (u.get ("runtimeControls", 0), 3, "Controls settable while streaming", what))
+        if "runtimeControls" in u:
+            raise GenError ("unit %d: runtime controls are marked in the control list" % u["id"])
+        return (bitmap (sum (1 << c["bit"] for c in ctrls), 3, "Controls supported", what),
+                bitmap (sum (1 << c["bit"] for c in ctrls if c["runtime"]), 3,
+                        "Controls settable while streaming", what))
+
+    def check_tiers (self, fi, ri, fr):
+        data = fr["data"]
+        if "tiers" not in data:
+            return
+        what = "format %d frame %d" % (fi, ri)
+        if "qp" not in data:
+            raise GenError ("%s: the qp of the stored frames is needed with tiers" % what)
+        qps = [data["qp"]] + [t.get ("qp") for t in data["tiers"]]
+        if not all (isinstance (q, int) and 0 <= q <= 51 for q in qps) or qps != sorted (set (qps)):
+            raise GenError ("%s: tier QPs must be 0 to 51 and rise from tier to tier" % what)
+        if len (qps) > 8:
+            raise GenError ("%s: more than 8 tiers" % what)
+        for t in data["tiers"]:
+            lens = self.lengths.get (t.get ("lengths"))
+            if not lens or "frames" not in t:
+                raise GenError ("%s: tier %s needs lengths and frames from the video frames source"
+                                % (what, t.get ("lengths")))
+            if len (lens) != len (self.lengths[data["lengths"]]):
+                raise GenError ("%s: tier %s has %d frames, not %d"
+                                % (what, t["lengths"], len (lens), len (self.lengths[data["lengths"]])))
+
+    def layer_frame (self, layer):
+        """Format and frame sent in a simulcast layer."""
+        fmt = self.formats[number (layer["format"], "layer format") - 1]
+        return fmt, fmt["frames"][number (layer["frame"], "layer frame") - 1]
+
+    def check_layers (self, fi, ri, fr):
+        what   = "format %d frame %d" % (fi, ri)
+        layers = fr.get ("layers", [])
+        if "data" in fr:
+            raise GenError ("%s: simulcast frames send the frames of their layers and store none" % what)
+        if not 2 <= len (layers) <= SIMULCAST_MAX_LAYERS:
+            raise GenError ("%s: a simulcast frame needs 2 to %d layers" % (what, SIMULCAST_MAX_LAYERS))
+        for li, layer in enumerate (layers):
+            lf = number (layer.get ("format", 0), "layer format")
+            if not 1 <= lf < fi or self.formats[lf - 1]["type"] != "h264" or \
+                    not 1 <= number (layer.get ("frame", 0), "layer frame") <= len (self.formats[lf - 1]["frames"]):
+                raise GenError ("%s: layer %d should name a frame of an earlier H.264 format" % (what, li))
+            if not 1 <= number (layer.get ("weight", 1), "layer weight") <= 0xFF:
+                raise GenError ("%s: layer %d weight must be 1 to 255" % (what, li))
+        big = max ((self.layer_frame (l)[1] for l in layers), key = lambda x: x["width"] * x["height"])
+        if (fr["width"], fr["height"]) != (big["width"], big["height"]):
+            raise GenError ("%s: a simulcast frame has the size of its largest layer, %d x %d"
+                            % (what, big["width"], big["height"]))
+
+    def tiers (self, fr):
+        """Quality tiers of a stored frame, the stored frames first: (qp, lengths array, frames array,
+        frame lengths). Empty for frames without tiers."""
+        data = fr.get ("data", {})
+        if "tiers" not in data:
+            return []
+        return [(t["qp"], t["lengths"], t["frames"], self.lengths[t["lengths"]]) for t in [data] + data["tiers"]]
+
+    def frame_size (self, fmt, fr):
+        """Frame buffer size: the largest stored frame of any tier, the largest access unit of any layer with its
+        prefix, or the pixel size of generated frames."""
+        ft = FORMAT_TYPES[fmt["type"]]
+        if "layers" in fr:
+            return max (self.frame_size (*self.layer_frame (l)) for l in fr["layers"]) + SIMULCAST_PREFIX_LEN
+        if "bpp" in ft:
+            return number (fr["width"], "width") * number (fr["height"], "height") * ft["bpp"] // 8
+        return max ([max (self.lengths[fr["data"]["lengths"]])] + [max (t[3]) for t in self.tiers (fr)])
+
+    @staticmethod
+    def annex_b (fmt):
+        """Whether the stored frames of a format are Annex B streams of NAL units."""
+        return FORMAT_TYPES[fmt["type"]].get ("annexB", fmt.get ("annexB", False))
+
+    def eu_control (self, name):
+        """Control of the encoding unit listed in the table, or None."""
+        return next ((c for c in self.controls if c["unitType"] == "encoding" and c["name"] == name), None)
+
+    @staticmethod
+    def name (fmt):
+        return fmt.get ("name", FORMAT_TYPES[fmt["type"]]["name"])
+
+    @staticmethod
+    def guid (fmt):
+        """GUID bytes of a frame based format: the FourCC with the fixed tail, or the whole GUID."""
+        if "fourcc" in fmt:
+            return [ord (c) for c in fmt["fourcc"]] + GUID_TAIL if len (fmt["fourcc"]) == 4 else []
+        g = fmt["guid"]
+        return [int (g[i:i + 2], 16) for i in range (0, 32, 2)] if re.match (r"^[0-9a-fA-F]{32}$", g) else []
+
+    # ---------------------------------------------------------------------------------------------
+    # Descriptors
+    # ---------------------------------------------------------------------------------------------
+
+    def device (self, ss):
+        d = self.t["device"]
+        if ss:
+            return Dscr (None, [
+                raw ("CY_U3P_USB_DEVICE_DESCR", "Device descriptor type"),
+                w (0x0320, "USB 3.2 Gen 1 (USB 5Gbps)"),
+                b (0xEF, "Device class"),
+                b (0x02, "Device Sub-class"),
+                b (0x01, "Device protocol"),
+                b (0x09, "Maxpacket size for EP0 : 2^9"),
+                w (d["vid"], "Vendor ID"),
+                w (d["pid"], "Product ID"),
+                w (d.get ("bcdDevice", 0), "Device release number"),
+                b (0x01, "Manufacture string index"),
+                b (0x02, "Product string index"),
+                b (0x00, "Serial number string index"),
+                b (0x01, "Number of configurations")])
+        return Dscr (None, [
+            raw ("CY_U3P_USB_DEVICE_DESCR", "Device descriptor type"),
+            w (0x0210, "USB 2.10"),
+            b (0xEF, "Device class"),
+            b (0x02, "Device sub-class"),
+            b (0x01, "Device protocol"),
+            b (0x40, "Maxpacket size for EP0 : 64 bytes"),
+            w (d["vid"], "Vendor ID"),
+            w (d["pid"], "Product ID"),
+            w (d.get ("bcdDevice", 0), "Device release number"),
+            b (0x01, "Manufacture string index"),
+            b (0x02, "Product string index"),
+            b (0x00, "Serial number string index"),
+            b (0x01, "Number of configurations")])
+
+    def bos (self):
+        ext = Dscr ("USB 2.0 Extension", [
+            raw ("CY_U3P_DEVICE_CAPB_DESCR", "Device capability type descriptor"),
+            raw ("CY_U3P_USB2_EXTN_CAPB_TYPE", "USB 2.0 extension capability type"),
+            dw (0x0000641E, "Supported device level features: LPM support, BESL supported,\n"
+                            "Baseline BESL=400 us, Deep BESL=1000 us.")])
+        ss = Dscr ("SuperSpeed Device Capability", [
+            raw ("CY_U3P_DEVICE_CAPB_DESCR", "Device capability type descriptor"),
+            raw ("CY_U3P_SS_USB_CAPB_TYPE", "SuperSpeed device capability type"),
+            b (0x00, "Supported device level features "),
+            w (0x000E, "Speeds supported by the device : SS, HS and FS"),
+            b (0x03, "Functionality support"),
+            b (0x00, "U1 device exit latency"),
+            w (0x0000, "U2 device exit latency")])
+        hdr = Dscr (None, [
+            raw ("CY_U3P_BOS_DESCR", "Device descriptor type"),
+            w (5 + len (ext) + len (ss), "Length of this descriptor and all sub descriptors"),
+            b (0x02, "Number of device capability descriptors")])
+        return [hdr, ext, ss]
+
+    def qualifier (self):
+        return Dscr (None, [
+            raw ("CY_U3P_USB_DEVQUAL_DESCR", "Device qualifier descriptor type"),
+            w (0x0200, "USB 2.0"),
+            b (0xEF, "Device class"),
+            b (0x02, "Device sub-class"),
+            b (0x01, "Device protocol"),
+            b (0x40, "Maxpacket size for EP0 : 64 bytes"),
+            b (0x01, "Number of configurations"),
+            b (0x00, "Reserved")])
+
+    def string (self, text):
+        if len (text) * 2 + 2 > 0xFF:
+            raise GenError ("string %r is too long" % text)
+        fields = [raw ("CY_U3P_USB_STRING_DESCR", "Device descriptor type")]
+        fields += [Field (["'%s'" % c, "0x00"]) for c in text]
+        return Dscr (None, fields)
+
+    def config_header (self, ss, total):
+        power = number (self.t["device"].get ("maxPowerMa", 100), "maxPowerMa")
+        unit  = 8 if ss else 2
+        return Dscr ("Configuration descriptor", [
+            raw ("CY_U3P_USB_CONFIG_DESCR", "Configuration descriptor type"),
+            w (total, "Length of this descriptor and all sub descriptors"),
+            b (0x02, "Number of interfaces"),
+            b (0x01, "Configuration number"),
+            b (0x00, "Configuration string index"),
+            b (0x80, "Config characteristics - Bus powered"),
+            b (power // unit, "Max power consumption of device (in %dmA unit) : %dmA" % (unit, power))])
+
+    def vc_units (self):
+        out = []
+        for u in self.units:
+            uid  = number (u["id"], "unit id")
+            kind = u["type"]
+            if kind != "camera":
+                src = number (u["source"], "unit source")
+                src_comment = "Source ID : %d : Connected to %s" % (src, UNIT_NAMES[self.unit_ids[src]["type"]])
+            if kind == "camera":
+                out.append (cs_dscr ("Input (camera) terminal descriptor", [
+                    b (0x24, "Class specific interface desc type"),
+                    b (0x02, "Input Terminal Descriptor type"),
+                    b (uid, "ID of this terminal"),
+                    w (0x0201, "Camera terminal type"),
+                    b (0x00, "No association terminal"),
+                    b (0x00, "String desc index : Not used"),
+                    w (0, "No optical zoom supported"),
+                    w (0, "No optical zoom supported"),
+                    w (0, "No optical zoom supported"),
+                    b (3, "Size of controls field for this terminal : 3 bytes"),
+                    self.control_bitmaps (u, "camera controls")[0]]))
+            elif kind == "processing":
+                out.append (cs_dscr ("Processing unit descriptor", [
+                    b (0x24, "Class specific interface desc type"),
+                    b (0x05, "Processing unit descriptor type"),
+                    b (uid, "ID of this unit"),
+                    b (src, src_comment),
+                    w (u.get ("maxMultiplier", 0x4000), "Digital multiplier"),
+                    b (3, "Size of controls field for this unit : 3 bytes"),
+                    self.control_bitmaps (u, "processing controls")[0],
+                    b (0x00, "String desc index : Not used"),
+                    b (0x00, "No analog modes supported.")]))
+            elif kind == "extension":
+                guid = u.get ("guid", "FF" * 16)
+                if not re.match (r"^[0-9a-fA-F]{32}$", guid):
+                    raise GenError ("unit %d: guid must be 32 hex digits" % uid)
+                gb = ["0x%s" % guid[i:i + 2].upper () for i in range (0, 32, 2)]
+                out.append (cs_dscr ("Extension unit descriptor", [
+                    b (0x24, "Class specific interface desc type"),
+                    b (0x06, "Extension unit descriptor type"),
+                    b (uid, "ID of this unit"),
+                    Field (gb[0:4], "16 byte GUID"),
+                    Field (gb[4:8]), Field (gb[8:12]), Field (gb[12:16]),
+                    b (u.get ("numControls", 0), "Number of controls in this unit"),
+                    b (0x01, "Number of input pins in this unit"),
+                    b (src, src_comment),
+                    b (3, "Size of controls field for this unit : 3 bytes"),
+                    bitmap (u.get ("controls", 0), 3, "Controls supported", "extension controls"),
+                    b (0x00, "String desc index : Not used")]))
+            elif kind == "encoding":
+                controls, runtime = self.control_bitmaps (u, "encoding controls")
+                out.append (cs_dscr ("Encoding unit descriptor (UVC 1.5)", [
+                    b (0x24, "Class specific interface desc type"),
+                    raw ("CY_FX_UVC_VC_ENCODING_UNIT", "Encoding unit descriptor type"),
+                    b (uid, "ID of this unit"),
+                    b (src, src_comment),
+                    b (0x00, "iEncoding: String descriptor index"),
+                    b (3, "bControlSize: Size of controls field : 3 bytes"),
+                    Field (controls.tokens, "bmControls: " + controls.comment),
+                    Field (runtime.tokens, "bmControlsRuntime: " + runtime.comment)]))
+            else:
+                out.append (cs_dscr ("Output terminal descriptor", [
+                    b (0x24, "Class specific interface desc type"),
+                    b (0x03, "Output terminal descriptor type"),
+                    b (uid, "ID of this terminal"),
+                    w (0x0101, "USB streaming terminal type"),
+                    b (0x00, "No association terminal"),
+                    b (src, src_comment),
+                    b (0x00, "String desc index : Not used")]))
+        return out
+
+    def vc_interface (self, ss):
+        units = self.vc_units ()
+        hdr_fields = [
+            b (0x24, "Class specific i/f header descriptor type"),
+            b (0x01, "Descriptor sub type : VC_HEADER"),
+            None,
+            None,
+            dw (self.t["uvc"].get ("clockHz", 48000000),
+                "Clock frequency : %gMHz" % (number (self.t["uvc"].get ("clockHz", 48000000), "clockHz") / 1e6)),
+            b (0x01, "Number of streaming interfaces"),
+            b (0x01, "Video streaming i/f 1 belongs to VC i/f")]
+        bcd = number (self.t["uvc"].get ("bcdUVC", 0x0150), "bcdUVC")
+        hdr_fields[2] = w (bcd, "Revision of class spec : %x.%x" % (bcd >> 8, (bcd >> 4) & 0xF))
+        hdr_fields[3] = w (0, None)
+        hdr   = cs_dscr ("Class specific VC interface header descriptor", hdr_fields)
+        total = len (hdr) + sum (len (u) for u in units)
+        hdr.fields[4] = w (total, "Total size of class specific descriptors (till output terminal)")
+
+        st = self.status
+        out = [
+            Dscr ("Interface association descriptor", [
+                raw ("CY_FX_INTF_ASSN_DSCR_TYPE", "Interface association descr type"),
+                b (0x00, "I/f number of first video control i/f"),
+                b (0x02, "Number of video i/f"),
+                b (0x0E, "CC_VIDEO : Video i/f class code"),
+                b (0x03, "SC_VIDEO_INTERFACE_COLLECTION : Subclass code"),
+                b (0x00, "Protocol : Not used"),
+                b (0x00, "String desc index for interface")]),
+            Dscr ("Standard video control interface descriptor", [
+                raw ("CY_U3P_USB_INTRFC_DESCR", "Interface descriptor type"),
+                b (0x00, "Interface number"),
+                b (0x00, "Alternate setting number"),
+                b (0x01, "Number of end points"),
+                b (0x0E, "CC_VIDEO : Interface class"),
+                b (0x01, "CC_VIDEOCONTROL : Interface sub class"),
+                b (0x00, "Interface protocol code"),
+                b (0x00, "Interface descriptor string index")]),
+            hdr] + units
+        mps = number (st.get ("maxPacket", 64), "status maxPacket")
+        out.append (Dscr ("Video control status interrupt endpoint descriptor", [
+            raw ("CY_U3P_USB_ENDPNT_DESCR", "Endpoint descriptor type"),
+            b (st["address"], "Endpoint address and description"),
+            raw ("CY_U3P_USB_EP_INTR", "Interrupt end point type"),
+            w (mps, "Max packet size = %d bytes" % mps),
+            b (st["ssInterval"] if ss else st["hsInterval"], "Servicing interval")]))
+        if ss:
+            out.append (Dscr ("Super speed endpoint companion descriptor", [
+                raw ("CY_U3P_SS_EP_COMPN_DESCR", "SS endpoint companion descriptor type"),
+                b (0x00, "Max no. of packets in a Burst : 1"),
+                b (0x00, "Mult.: Max number of packets : 1"),
+                w (mps, "Bytes per interval : %d" % mps)]))
+        out.append (Dscr ("Class specific interrupt endpoint descriptor", [
+            b (0x25, "Class specific endpoint descriptor type"),
+            raw ("CY_U3P_USB_EP_INTR", "End point sub type"),
+            w (mps, "Max packet size = %d" % mps)]))
+        return out
+
+    def vs_formats (self):
+        out = []
+        for fi, fmt in enumerate (self.formats, 1):
+            ft     = FORMAT_TYPES[fmt["type"]]
+            frames = fmt["frames"]
+            fields = [
+                b (0x24, "Class-specific VS i/f type"),
+                b (ft["format"], "Descriptor subtype : VS_FORMAT_%s" % ft["subtype"]),
+                b (fi, "Format desciptor index"),
+                b (len (frames), "%d Frame desciptor(s) follow" % len (frames))]
+            if fmt["type"] in ("h264", "h264_simulcast"):
+                out += self.h264_format (fi, fmt, fields)
+                continue
+            if fmt["type"] == "frame_based":
+                out += self.frame_based_format (fi, fmt, fields)
+                continue
+            if "bpp" in ft:
+                guid = [ord (c) for c in ft["name"]] + GUID_TAIL
+                fields += [Field (["0x%02X" % x for x in guid[0:4]], "GUID : %s" % ft["name"])]
+                fields += [Field (["0x%02X" % x for x in guid[i:i + 4]]) for i in (4, 8, 12)]
+                fields += [b (ft["bpp"], "Bits per pixel : %d" % ft["bpp"])]
+            else:
+                # JPEG frames vary in size: bmFlags FixedSizeSamples stays clear.
+                fields += [b (0x00, "Variable size samples")]
+            out.append (cs_dscr ("Class specific VS format descriptor : %s" % ft["name"], fields + [
+                b (fmt.get ("defaultFrame", 1), "Default frame index is %d" % fmt.get ("defaultFrame", 1)),
+                b (0x00, "Aspect ratio X : Not used"),
+                b (0x00, "Aspect ratio Y : Not used"),
+                b (0x00, "Non interlaced stream"),
+                b (0x00, "CopyProtect: duplication unrestricted")]))
+            for ri, fr in enumerate (frames, 1):
+                iv  = [number (x, "interval") for x in fr["intervals"]]
+                wd  = number (fr["width"], "width")
+                ht  = number (fr["height"], "height")
+                fields = [
+                    b (0x24, "Class-specific VS i/f type"),
+                    b (ft["frame"], "Descriptor subtype : VS_FRAME_%s" % ft["subtype"]),
+                    b (ri, "Frame desciptor index"),
+                    b (0x00, "Still image capture method not supported"),
+                    w (wd, "Width of the frame : %d" % wd),
+                    w (ht, "Height of the frame : %d" % ht),
+                    dw (self.bit_rate (fmt, fr, "minBitRate", iv[-1]), "Min bit rate bits/s"),
+                    dw (self.bit_rate (fmt, fr, "maxBitRate", iv[0]), "Max bit rate bits/s"),
+                    dw (self.frame_size (fmt, fr), "Maximum video or still frame size in bytes"),
+                    dw (fr.get ("defaultInterval", iv[0]),
+                        "Default frame interval : %s" % fps (number (fr.get ("defaultInterval", iv[0]), "interval"))),
+                    b (len (iv), "Frame interval type : %d discrete setting(s)" % len (iv))]
+                fields += [dw (x, "Frame interval : %s" % fps (x)) for x in iv]
+                out.append (cs_dscr ("Class specific VS frame descriptor : %d x %d" % (wd, ht), fields))
+        return out
+
+    @staticmethod
+    def macroblocks (fr):
+        return (-(-number (fr["width"], "width") // 16)) * (-(-number (fr["height"], "height") // 16))
+
+    def mb_rate (self, fr):
+        """Macroblocks per second of a frame at its shortest interval: of all its layers for simulcast frames,
+        each at its share of the frame slots."""
+        slots = Fraction (10000000, number (fr["intervals"][0], "interval"))
+        if "layers" not in fr:
+            return int (self.macroblocks (fr) * slots)
+        total = sum (l.get ("weight", 1) for l in fr["layers"])
+        return int (sum (self.macroblocks (self.layer_frame (l)[1]) * slots * l.get ("weight", 1) / total
+                         for l in fr["layers"]))
+
+    def h264_format (self, fi, fmt, fields):
+        """VS_FORMAT_H264 (or VS_FORMAT_H264_SIMULCAST) and VS_FRAME_H264 descriptors (UVC 1.5 H.264 payload
+        specification). The macroblock rate is given for the number of resolutions sent at once, without
+        scalability: one for a single stream, one per layer size for simulcast."""
+        frames = fmt["frames"]
+        ft     = FORMAT_TYPES[fmt["type"]]
+        mbps   = max (self.mb_rate (fr) for fr in frames)
+        sizes  = max (len (set ((self.layer_frame (l)[1]["width"], self.layer_frame (l)[1]["height"])
+                                for l in fr.get ("layers", [{}]) if l)) or 1 for fr in frames)
+        field  = H264_MB_PER_SEC_LAYOUTS * (sizes - 1)
+        rcm    = self.eu_control ("RATE_CONTROL_MODE")
+        modes  = sum (1 << (m - 1) for m in range (rcm["min"][0], rcm["max"][0] + 1)) if rcm else H264_RATE_CONTROL_CBR
+        sync   = self.eu_control ("SYNC_REF_FRAME")
+        syncs  = sum (1 << t for t in range (sync["min"][0], sync["max"][0] + 1, max (sync["res"][0], 1))) if sync else 0
+        slice_mode = self.eu_control ("SLICE_MODE")
+        slices = sum (1 << m for m in range (slice_mode["min"][0], slice_mode["max"][0] + 1)) if slice_mode else 0
+        mbs    = []
+        for i in range (H264_MB_PER_SEC_FIELDS):
+            if i == field:
+                mbs.append (w (-(-mbps // 1000), "wMaxMBperSec, %s, no scalability : %d x 1000 MB/s"
+                               % (H264_RESOLUTION_NAMES[sizes - 1], -(-mbps // 1000))))
+            elif i == field + 1:
+                mbs.append (w (0, "wMaxMBperSec for more resolutions and scalable streams : not supported"))
+            elif i == 0:
+                mbs.append (w (0, "wMaxMBperSec for fewer resolutions : not supported"))
+            else:
+                mbs.append (w (0))
+        out = [cs_dscr ("Class specific VS format descriptor : %s (UVC 1.5)" % ft["name"], fields + [
+            b (fmt.get ("defaultFrame", 1), "Default frame index is %d" % fmt.get ("defaultFrame", 1)),
+            b (0x01, "bMaxCodecConfigDelay : 1 frame"),
+            b (slices, "bmSupportedSliceModes : %s" % (", ".join (
+                H264_SLICE_MODE_NAMES[m] for m in range (4) if slices & (1 << m)) or "no slice mode control")),
+            b (syncs, "bmSupportedSyncFrameTypes : %s" % (", ".join (
+                H264_SYNC_FRAME_NAMES[t] for t in range (7) if syncs & (1 << t)) or "none on request")),
+            b (0x00, "bResolutionScaling : not supported"),
+            b (0x00, "Reserved"),
+            b (modes, "bmSupportedRateControlModes : %s" % ", ".join (
+                H264_RATE_CONTROL_NAMES[m] for m in range (1, 7) if modes & (1 << (m - 1))))] + mbs)]
+
+        for ri, fr in enumerate (frames, 1):
+            iv  = [number (x, "interval") for x in fr["intervals"]]
+            wd  = number (fr["width"], "width")
+            ht  = number (fr["height"], "height")
+            prof  = number (fr["profile"], "profile")
+            level = number (fr["level"], "level")
+            fields = [
+                b (0x24, "Class-specific VS i/f type"),
+                b (FORMAT_TYPES["h264"]["frame"], "Descriptor subtype : VS_FRAME_H264"),
+                b (ri, "Frame desciptor index"),
+                w (wd, "Width of the frame : %d" % wd),
+                w (ht, "Height of the frame : %d" % ht),
+                w (1, "wSARwidth : square pixels"),
+                w (1, "wSARheight : square pixels"),
+                w (prof, "wProfile : profile_idc %d, constraint flags 0x%02X" % (prof >> 8, prof & 0xFF)),
+                b (level, "bLevelIDC : level %d.%d" % (level // 10, level % 10)),
+                w (0, "wConstrainedToolset : reserved"),
+                dw (H264_USAGE_REALTIME, "bmSupportedUsages : real time"),
+                w (H264_CAPS, "bmCapabilities : CAVLC, constant frame rate, no reordering"),
+                dw (0, "bmSVCCapabilities : no SVC"),
+                dw (0, "bmMVCCapabilities : no MVC"),
+                dw (self.bit_rate (fmt, fr, "minBitRate", iv[-1]), "Min bit rate bits/s"),
+                dw (self.bit_rate (fmt, fr, "maxBitRate", iv[0]), "Max bit rate bits/s"),
+                dw (fr.get ("defaultInterval", iv[0]),
+                    "Default frame interval : %s" % fps (number (fr.get ("defaultInterval", iv[0]), "interval"))),
+                b (len (iv), "Frame interval type : %d discrete setting(s)" % len (iv))]
+            fields += [dw (x, "Frame interval : %s" % fps (x)) for x in iv]
+            out.append (cs_dscr ("Class specific VS frame descriptor : %s %d x %d" % (ft["name"], wd, ht), fields))
+        return out
+
+    def frame_based_format (self, fi, fmt, fields):
+        """VS_FORMAT_FRAME_BASED and VS_FRAME_FRAME_BASED descriptors for stored compressed streams."""
+        ft     = FORMAT_TYPES[fmt["type"]]
+        frames = fmt["frames"]
+        name   = self.name (fmt)
+        guid   = self.guid (fmt)
+        fields = fields + [Field (["0x%02X" % x for x in guid[0:4]], "GUID : %s" % fmt.get ("fourcc", name))]
+        fields += [Field (["0x%02X" % x for x in guid[i:i + 4]]) for i in (4, 8, 12)]
+        out = [cs_dscr ("Class specific VS format descriptor : %s (frame based)" % name, fields + [
+            b (0x00, "Bits per pixel : not applicable"),
+            b (fmt.get ("defaultFrame", 1), "Default frame index is %d" % fmt.get ("defaultFrame", 1)),
+            b (0x00, "Aspect ratio X : Not used"),
+            b (0x00, "Aspect ratio Y : Not used"),
+            b (0x00, "Non interlaced stream"),
+            b (0x00, "CopyProtect: duplication unrestricted"),
+            b (0x01, "Variable size frames")])]
+
+        for ri, fr in enumerate (frames, 1):
+            iv  = [number (x, "interval") for x in fr["intervals"]]
+            wd  = number (fr["width"], "width")
+            ht  = number (fr["height"], "height")
+            fields = [
+                b (0x24, "Class-specific VS i/f type"),
+                b (ft["frame"], "Descriptor subtype : VS_FRAME_%s" % ft["subtype"]),
+                b (ri, "Frame desciptor index"),
+                b (0x00, "Still image capture method not supported"),
+                w (wd, "Width of the frame : %d" % wd),
+                w (ht, "Height of the frame : %d" % ht),
+                dw (self.bit_rate (fmt, fr, "minBitRate", iv[-1]), "Min bit rate bits/s"),
+                dw (self.bit_rate (fmt, fr, "maxBitRate", iv[0]), "Max bit rate bits/s"),
+                dw (fr.get ("defaultInterval", iv[0]),
+                    "Default frame interval : %s" % fps (number (fr.get ("defaultInterval", iv[0]), "interval"))),
+                b (len (iv), "Frame interval type : %d discrete setting(s)" % len (iv)),
+                dw (0, "Bytes per line : not applicable to compressed frames")]
+            fields += [dw (x, "Frame interval : %s" % fps (x)) for x in iv]
+            out.append (cs_dscr ("Class specific VS frame descriptor : %s %d x %d" % (name, wd, ht), fields))
+        return out
+
+    def avg_frame (self, fr, key):
+        """Average stored video frame of a frame: of its smallest tier for the minimum bit rate and of its
+        largest for the maximum."""
+        sizes = [sum (t[3]) for t in self.tiers (fr)] or [sum (self.lengths[fr["data"]["lengths"]])]
+        size  = min (sizes) if key == "minBitRate" else max (sizes)
+        return Fraction (size, len (self.lengths[fr["data"]["lengths"]]))
+
+    def bit_rate (self, fmt, fr, key, interval):
+        """Bit rate from the table, or that of the average frame at the given interval: the full frame
+        for generated frames, the average of the video frames stored for the others (of the smallest tier
+        for the minimum and the largest for the maximum), and for simulcast frames the average access unit
+        of the layers by their share of the slots, with the prefix."""
+        if key in fr:
+            return number (fr[key], key)
+        if "layers" in fr:
+            total = sum (l.get ("weight", 1) for l in fr["layers"])
+            size  = sum (self.avg_frame (self.layer_frame (l)[1], key) * l.get ("weight", 1) for l in fr["layers"])
+            return int ((size / total + SIMULCAST_PREFIX_LEN) * 8 * 10000000 / interval)
+        if "data" not in fr:
+            return self.frame_size (fmt, fr) * 8 * 10000000 // interval
+        return int (self.avg_frame (fr, key) * 8 * 10000000 / interval)
+
+    def vs_interface (self, ss):
+        ep      = self.ep
+        iso     = ep["type"] == "iso"
+        formats = self.vs_formats ()
+        nfmt    = len (self.formats)
+        hdr_fields = [
+            b (0x24, "Class-specific VS i/f type"),
+            b (0x01, "Descriptor subtype : input header"),
+            b (nfmt, "%d format desciptor(s) follow" % nfmt),
+            w (0),
+            b (ep["address"], "EP address for %s video data" % ("ISO" if iso else "BULK")),
+            b (0x00, "No dynamic format change supported"),
+            b (self.output["id"], "Output terminal ID : %d" % self.output["id"]),
+            b (0x00, "No still image capture supported."),
+            b (0x00, "No hardware trigger support."),
+            b (0x00, "Hardware to initiate still image capture"),
+            b (0x01, "Size of controls field : 1 byte")]
+        hdr_fields += [b (f.get ("controls", 0), "bmaControls for format %d" % i)
+                       for i, f in enumerate (self.formats, 1)]
+        hdr   = cs_dscr ("Class-specific video streaming input header descriptor", hdr_fields)
+        total = len (hdr) + sum (len (f) for f in formats)
+        hdr.fields[4] = w (total, "Total size of class specific VS descr: %d bytes" % total)
+
+        out = [Dscr ("Standard video streaming interface descriptor (Alternate setting 0)", [
+            raw ("CY_U3P_USB_INTRFC_DESCR", "Interface descriptor type"),
+            b (0x01, "Interface number"),
+            b (0x00, "Alternate setting number"),
+            b (0x00 if iso else 0x01, "Number of end points : zero bandwidth" if iso else
+               "Number of end points : One bulk"),
+            b (0x0E, "Interface class : CC_VIDEO"),
+            b (0x02, "Interface sub class : CC_VIDEOSTREAMING"),
+            b (0x00, "Interface protocol code : Undefined"),
+            b (0x00, "Interface descriptor string index")]),
+            hdr] + formats
+
+        if iso:
+            out.append (Dscr ("Standard video streaming interface descriptor (Alternate setting 1)", [
+                raw ("CY_U3P_USB_INTRFC_DESCR", "Interface descriptor type"),
+                b (0x01, "Interface number"),
+                b (0x01, "Alternate setting number"),
+                b (0x01, "Number of end points : 1 ISO EP"),
+                b (0x0E, "Interface class : CC_VIDEO"),
+                b (0x02, "Interface sub class : CC_VIDEOSTREAMING"),
+                b (0x00, "Interface protocol code : Undefined"),
+                b (0x00, "Interface descriptor string index")]))
+        out += self.stream_endpoint (ss)
+        return out
+
+    def stream_endpoint (self, ss):
+        ep   = self.ep
+        prof = ep["ss"] if ss else ep["hs"]
+        mps  = value (prof["maxPacket"], "stream maxPacket")
+        if ep["type"] == "iso":
+            sync = { "none": 0x00, "async": 0x04, "adaptive": 0x08, "sync": 0x0C }[ep.get ("sync", "async")]
+            if ss:
+                mps_field = w (mps, "Max packet size : %s bytes" % mps)
+            else:
+                # High speed: bits 12:11 carry the additional transactions per microframe.
+                tr = value (prof.get ("transactions", 1), "transactions")
+                if isinstance (mps, int) and isinstance (tr, int):
+                    mps_field = w (mps | ((tr - 1) << 11), "Max packet size : %d bytes x %d per microframe" % (mps, tr))
+                else:
+                    mps_field = w ("(%s) | (((%s) - 1) << 11)" % (mps, tr),
+                                   "Max packet size and transactions per microframe")
+            epd = Dscr ("Endpoint descriptor for ISO streaming video data", [
+                raw ("CY_U3P_USB_ENDPNT_DESCR", "Endpoint descriptor type"),
+                b (ep["address"], "Endpoint address and description"),
+                raw ("CY_U3P_USB_EP_ISO | 0x%02X" % sync, "ISO end point : %s" % ep.get ("sync", "async").capitalize ()),
+                mps_field,
+                b (prof.get ("interval", 1), "Servicing interval for data transfers")])
+            out = [epd]
+            if ss:
+                burst = value (prof.get ("burst", 1), "burst")
+                mult  = value (prof.get ("mult", 1), "mult")
+                if isinstance (burst, int) and isinstance (mult, int) and isinstance (mps, int):
+                    bpi = burst * mult * mps
+                else:
+                    bpi = "%s * %s * %s" % (burst, mult, mps)
+                out.append (Dscr ("Super speed endpoint companion descriptor", [
+                    raw ("CY_U3P_SS_EP_COMPN_DESCR", "SS endpoint companion descriptor type"),
+                    b (minus_one (burst), per_count ("Max no. of packets in a burst", burst)),
+                    b (minus_one (mult), per_count ("Mult setting: Number of bursts per service interval", mult)),
+                    w (bpi, "Bytes per interval : %s" % (bpi if isinstance (bpi, int) else "burst x mult x max packet size"))]))
+            return out
+
+        out = [Dscr ("Endpoint descriptor for BULK streaming video data", [
+            raw ("CY_U3P_USB_ENDPNT_DESCR", "Endpoint descriptor type"),
+            b (ep["address"], "Endpoint address and description"),
+            raw ("CY_U3P_USB_EP_BULK", "Bulk End Point"),
+            w (mps, "Maximum packet size : %s bytes" % mps),
+            b (0x00, "Servicing interval for data transfers")])]
+        if ss:
+            burst = value (prof.get ("burst", 1), "burst")
+            out.append (Dscr ("Super speed endpoint companion descriptor", [
+                raw ("CY_U3P_SS_EP_COMPN_DESCR", "SS endpoint companion descriptor type"),
+                b (minus_one (burst), per_count ("Max no. of packets in a Burst", burst)),
+                b (0x00, "Mult.: Max number of packets : 1"),
+                w (0, "Field Valid only for Periodic Endpoints")]))
+        return out
+
+    def config (self, ss):
+        body  = self.vc_interface (ss) + self.vs_interface (ss)
+        total = 9 + sum (len (d) for d in body)
+        return [self.config_header (ss, total)] + body
+
+    def fs_config (self):
+        return [Dscr ("Configuration descriptor", [
+            raw ("CY_U3P_USB_CONFIG_DESCR", "Configuration descriptor type"),
+            w (0x0009, "Length of this descriptor and all sub descriptors"),
+            b (0x00, "Number of interfaces : full speed is not supported"),
+            b (0x01, "Configuration number"),
+            b (0x00, "Configuration string index"),
+            b (0x80, "Config characteristics - bus powered"),
+            b (0x32, "Max power consumption of device (in 2mA unit) : 100mA")])]
+
+    # ---------------------------------------------------------------------------------------------
+    # Output files
+    # ---------------------------------------------------------------------------------------------
+
+    def dscr_file (self):
+        d   = self.t["device"]
+        out = [COPYRIGHT % "cyfxuvcdscr.c",
+               DSCR_NOTE % (self.t.get ("description", "UVC application example"), self.table_name),
+               '#include "%s"' % self.t.get ("header", "cyfxuvcinmem.h"), ""]
+        arrays = [
+            ("Standard device descriptor for USB 3.0", "CyFxUSB30DeviceDscr", [self.device (True)]),
+            ("Standard device descriptor", "CyFxUSB20DeviceDscr", [self.device (False)]),
+            ("Binary device object store descriptor", "CyFxUSBBOSDscr", self.bos ()),
+            ("Standard device qualifier descriptor", "CyFxUSBDeviceQualDscr", [self.qualifier ()]),
+            ("Standard super speed configuration descriptor", "CyFxUSBSSConfigDscr", self.config (True)),
+            ("Standard high speed configuration descriptor", "CyFxUSBHSConfigDscr", self.config (False)),
+            ("Standard full speed configuration descriptor : full speed is not supported",
+             "CyFxUSBFSConfigDscr", self.fs_config ()),
+            ("Standard language ID string descriptor", "CyFxUSBStringLangIDDscr",
+             [Dscr (None, [raw ("CY_U3P_USB_STRING_DESCR", "Device descriptor type"),
+                           w (0x0409, "Language ID supported")])]),
+            ("Standard manufacturer string descriptor", "CyFxUSBManufactureDscr", [self.string (d["manufacturer"])]),
+            ("Standard product string descriptor", "CyFxUSBProductDscr", [self.string (d["product"])]),
+        ]
+        for comment, name, dscrs in arrays:
+            total = sum (len (x) for x in dscrs)
+            out.append ("/* %s (%d bytes) */" % (comment, total))
+            render_array (name, dscrs, out)
+        out += ["/* Place this buffer as the last buffer so that no other variable / code shares",
+                " * the same cache line. Do not add any other variables / arrays in this file.",
+                " * This will lead to variables sharing the same cache line. */",
+                "const uint8_t CyFxUsbDscrAlignBuffer[32] __attribute__ ((aligned (32)));",
+                "",
+                "/* [ ] */",
+                ""]
+        return "\n".join (out)
+
+    def controls_file (self):
+        out = [COPYRIGHT % "cyfxuvccontrols.c",
+               CONTROLS_NOTE % self.table_name,
+               '#include "%s"' % self.t.get ("header", "cyfxuvcinmem.h"), ""]
+
+        def le (v, size):
+            return ["0x%02X" % ((v >> (8 * i)) & 0xFF) for i in range (size)]
+
+        offsets = []
+        for c in self.controls:
+            length = sum (c["sizes"])
+            tag    = "glUnit%dCtrl%02X" % (c["unit"], c["selector"])
+            flags  = [n for bit, n in ((CTRL_INFO_GET, "GET"), (CTRL_INFO_SET, "SET"),
+                                       (CTRL_INFO_AUTOUPDATE, "AUTOUPDATE"), (CTRL_INFO_ASYNC, "ASYNC"))
+                      if c["info"] & bit]
+            out += ["/* Unit %d (%s), %s: INFO, LEN, MIN, MAX, RES and DEF responses. */"
+                    % (c["unit"], UNIT_NAMES[c["unitType"]], c["macro"]),
+                    "static const uint8_t %sAttr[] = {" % tag,
+                    "    %-40s/* GET_INFO: %s */" % ("0x%02X," % c["info"], ", ".join (flags)),
+                    "    %-40s/* GET_LEN: %d byte%s */" % ("%s," % ", ".join (le (length, 2)), length,
+                                                                  "s" if length > 1 else "")]
+            for key in ("min", "max", "res", "def"):
+                text = ", ".join (t for v, size in zip (c[key], c["sizes"]) for t in le (v, size))
+                out.append ("    %-40s/* GET_%s: %s */" % (text + ("," if key != "def" else ""), key.upper (),
+                                                          ", ".join ("%d" % v for v in c[key])))
+            out += ["};", ""]
+            offsets.append (sum (sum (x["sizes"]) for x in self.controls[:len (offsets)]))
+        cur_size = max (32, (sum (sum (c["sizes"]) for c in self.controls) + 31) // 32 * 32)
+        out += ["/* Current values of the controls, back to back. The buffer is sent to the host as it is, so it is",
+                "   cache line aligned and a whole number of cache lines long. */",
+                "static uint8_t glUvcCtrlCur[%d] __attribute__ ((aligned (32)));" % cur_size, ""]
+
+        out.append ("/* Controls implemented by the device. */")
+        if self.controls:
+            out.append ("const CyFxUvcCtrlInfo_t glUvcCtrls[] = {")
+            for i, c in enumerate (self.controls):
+                tag   = "glUnit%dCtrl%02X" % (c["unit"], c["selector"])
+                sizes = c["sizes"] + [0] * (CTRL_MAX_FIELDS - len (c["sizes"]))
+                out += ["    {",
+                        "        %-40s/* Unit ID */" % ("%d," % c["unit"]),
+                        "        %s," % c["macro"],
+                        "        %-40s/* Length in bytes */" % ("%d," % sum (c["sizes"])),
+                        "        %-40s/* Field sizes */" % ("{ %s }," % ", ".join ("%d" % x for x in sizes)),
+                        "        CY_FX_UVC_CTRL_APPLY_%s," % c["apply"],
+                        "        %-40s/* Settable while streaming */" % ("%s," % ("CyTrue" if c["setWhileStreaming"] else "CyFalse")),
+                        "        %sAttr," % tag,
+                        "        glUvcCtrlCur + %d" % offsets[i],
+                        "    }%s" % ("," if i + 1 < len (self.controls) else "")]
+            out += ["};", "",
+                    "const uint8_t glUvcCtrlCount = sizeof (glUvcCtrls) / sizeof (CyFxUvcCtrlInfo_t);", ""]
+        else:
+            out += ["const CyFxUvcCtrlInfo_t glUvcCtrls[1];", "",
+                    "const uint8_t glUvcCtrlCount = 0;", ""]
+
+        units = {}
+        for i, c in enumerate (self.controls, 1):
+            units.setdefault (c["unit"], {})[c["selector"]] = i
+        for uid in sorted (units):
+            idx = [units[uid].get (sel, 0) for sel in range (max (units[uid]) + 1)]
+            out.append ("/* Controls of unit %d, by selector: index in glUvcCtrls plus one, 0 if not implemented. */" % uid)
+            out.append ("static const uint8_t glUnit%dCtrlIndex[] = {" % uid)
+            for j in range (0, len (idx), 16):
+                out.append ("    " + ", ".join ("%d" % x for x in idx[j:j + 16]) + ("," if j + 16 < len (idx) else ""))
+            out += ["};", ""]
+        top = max (self.unit_ids) if self.unit_ids else 0
+        out.append ("/* Controls of each unit, by unit ID: descriptor subtype (0 for an ID that no unit or terminal has),")
+        out.append ("   number of selectors and their index. */")
+        out.append ("const CyFxUvcCtrlUnit_t glUvcCtrlUnits[] = {")
+        for uid in range (top + 1):
+            sep = "," if uid < top else ""
+            kind = self.unit_ids[uid]["type"] if uid in self.unit_ids else None
+            if uid in units:
+                entry = "{ 0x%02X, %d, glUnit%dCtrlIndex }" % (UNIT_SUBTYPES[kind], max (units[uid]) + 1, uid)
+            elif kind:
+                entry = "{ 0x%02X, 0, NULL }" % UNIT_SUBTYPES[kind]
+            else:
+                entry = "{ 0x00, 0, NULL }"
+            out.append ("    %-40s/* Unit %d%s */" % (entry + sep, uid, (", " + UNIT_NAMES.get (kind, "output terminal")) if kind else ""))
+        out += ["};", "",
+                "const uint8_t glUvcCtrlUnitCount = sizeof (glUvcCtrlUnits) / sizeof (CyFxUvcCtrlUnit_t);",
+                "",
+                "/* [ ] */",
+                ""]
+        return "\n".join (out)
+
+    def formats_file (self):
+        out = [COPYRIGHT % "cyfxuvcformats.c",
+               FORMATS_NOTE % self.table_name,
+               '#include "%s"' % self.t.get ("header", "cyfxuvcinmem.h"), ""]
+        # Stored video frames: glVidFrameLen and glUVCVidFrames are declared in the example header, the
+        # other frame sets only here.
+        data = []
+        for fmt in self.formats:
+            for fr in fmt["frames"]:
+                if "data" not in fr or fr["data"]["lengths"] == "glVidFrameLen":
+                    continue
+                for decl in ("extern const uint32_t %s[];" % fr["data"]["lengths"],
+                             "extern const uint8_t %s[];" % fr["data"]["frames"]):
+                    if decl not in data:
+                        data.append (decl)
+                for qp, lengths, frames, lens in self.tiers (fr)[1:]:
+                    for decl in ("extern const uint32_t %s[];" % lengths, "extern const uint8_t %s[];" % frames):
+                        if decl not in data:
+                            data.append (decl)
+        if data:
+            out += ["/* Video frames stored in cyfxuvcvidframes.c. */"] + data + [""]
+
+        for fi, fmt in enumerate (self.formats, 1):
+            name = self.name (fmt)
+            for ri, fr in enumerate (fmt["frames"], 1):
+                iv = [number (x, "interval") for x in fr["intervals"]]
+                out.append ("/* Format %d (%s), frame %d (%d x %d): frame intervals in 100 ns units, shortest first. */"
+                            % (fi, name, ri, fr["width"], fr["height"]))
+                out.append ("static const uint32_t glFmt%dFrame%dIntervals[] = {" % (fi, ri))
+                for i, x in enumerate (iv):
+                    text = "%d%s" % (x, "," if i + 1 < len (iv) else "")
+                    out.append ("    %-36s/* %s */" % (text, fps (x)))
+                out += ["};", ""]
+                tiers = self.tiers (fr)
+                if tiers:
+                    out.append ("/* Format %d (%s), frame %d (%d x %d): quality tiers, best first. */"
+                                % (fi, name, ri, fr["width"], fr["height"]))
+                    out.append ("static const CyFxUvcTierInfo_t glFmt%dFrame%dTiers[] = {" % (fi, ri))
+                    for ti, (qp, lengths, frames, lens) in enumerate (tiers):
+                        out += ["    {",
+                                "        %-36s/* QP */" % ("%d," % qp),
+                                "        %-36s/* Average video frame length */" % ("%d," % (sum (lens) // len (lens))),
+                                "        %-36s/* Largest video frame length */" % ("%d," % max (lens)),
+                                "        %s," % lengths,
+                                "        %s" % frames,
+                                "    }%s" % ("," if ti + 1 < len (tiers) else "")]
+                    out += ["};", ""]
+                if "layers" in fr:
+                    out.append ("/* Format %d (%s), frame %d (%d x %d): simulcast layers, by stream_id. */"
+                                % (fi, name, ri, fr["width"], fr["height"]))
+                    out.append ("static const CyFxUvcLayerInfo_t glFmt%dFrame%dLayers[] = {" % (fi, ri))
+                    for li, layer in enumerate (fr["layers"]):
+                        lf, lr = number (layer["format"], "layer format"), number (layer["frame"], "layer frame")
+                        lfr    = self.layer_frame (layer)[1]
+                        out += ["    {",
+                                "        %-36s/* Layer %d: format %d (%s), frame %d (%d x %d) */"
+                                % ("&glFmt%dFrames[%d]," % (lf, lr - 1), li, lf, self.name (self.formats[lf - 1]),
+                                   lr, lfr["width"], lfr["height"]),
+                                "        %-36s/* Weight */" % ("%d" % layer.get ("weight", 1)),
+                                "    }%s" % ("," if li + 1 < len (fr["layers"]) else "")]
+                    out += ["};", ""]
+            out.append ("/* Frames of format %d (%s), in the order of the frame descriptors. */" % (fi, name))
+            out.append ("static const CyFxUvcFrameInfo_t glFmt%dFrames[] = {" % fi)
+            for ri, fr in enumerate (fmt["frames"], 1):
+                iv   = [number (x, "interval") for x in fr["intervals"]]
+                dflt = number (fr.get ("defaultInterval", iv[0]), "interval")
+                data = fr.get ("data")
+                if "layers" in fr:
+                    stored = ["        %-36s/* Sent in simulcast layers */" % "0,",
+                              "        NULL,",
+                              "        NULL,",
+                              "        CY_FX_UVC_PATTERN_NONE"]
+                elif data:
+                    stored = ["        %-36s/* Stored video frames */" % ("%s," % data["count"]),
+                              "        %s," % data["lengths"],
+                              "        %s," % data["frames"],
+                              "        CY_FX_UVC_PATTERN_NONE"]
+                else:
+                    stored = ["        %-36s/* Generated, not stored */" % "0,",
+                              "        NULL,",
+                              "        NULL,",
+                              "        %s" % FORMAT_TYPES[fmt["type"]]["pattern"]]
+                stored[-1] += ","
+                if self.tiers (fr):
+                    stored += ["        sizeof (glFmt%dFrame%dTiers) / sizeof (CyFxUvcTierInfo_t)," % (fi, ri),
+                               "        glFmt%dFrame%dTiers" % (fi, ri)]
+                else:
+                    stored += ["        %-36s/* No quality tiers */" % "0,",
+                               "        NULL"]
+                stored[-1] += ","
+                if "layers" in fr:
+                    stored += ["        sizeof (glFmt%dFrame%dLayers) / sizeof (CyFxUvcLayerInfo_t)," % (fi, ri),
+                               "        glFmt%dFrame%dLayers" % (fi, ri)]
+                else:
+                    stored += ["        %-36s/* Not simulcast */" % "0,",
+                               "        NULL"]
+                out += ["    {",
+                        "        %-36s/* Frame index */" % ("%d," % ri),
+                        "        %-36s/* Width x height */" % ("%d, %d," % (fr["width"], fr["height"])),
+                        "        %-36s/* Maximum video frame buffer size */" % ("0x%X," % self.frame_size (fmt, fr)),
+                        "        %-36s/* Default frame interval: %s */" % ("%d," % dflt, fps (dflt)),
+                        "        sizeof (glFmt%dFrame%dIntervals) / sizeof (uint32_t)," % (fi, ri),
+                        "        glFmt%dFrame%dIntervals," % (fi, ri)] + stored + [
+                        "    }%s" % ("," if ri < len (fmt["frames"]) else "")]
+            out += ["};", ""]
+        out.append ("/* Formats supported by the device, in the order of the format descriptors. */")
+        out.append ("const CyFxUvcFormatInfo_t glUvcFormats[] = {")
+        for fi, fmt in enumerate (self.formats, 1):
+            name = self.name (fmt)
+            out += ["    {",
+                    "        %-36s/* Format index: %s */" % ("%d," % fi, name),
+                    "        %s," % FORMAT_TYPES[fmt["type"]]["const"],
+                    "        %-36s/* %s */" % (("CyTrue," , "Annex B NAL units") if self.annex_b (fmt) else
+                                               ("CyFalse,", "Not NAL units")),
+                    "        %-36s/* Default frame index */" % ("%d," % fmt.get ("defaultFrame", 1)),
+                    "        sizeof (glFmt%dFrames) / sizeof (CyFxUvcFrameInfo_t)," % fi,
+                    "        glFmt%dFrames" % fi,
+                    "    }%s" % ("," if fi < len (self.formats) else "")]
+        out += ["};", "",
+                "const uint8_t glUvcFormatCount = sizeof (glUvcFormats) / sizeof (CyFxUvcFormatInfo_t);",
+                "",
+                "/* [ ] */",
+                ""]
+        return "\n".join (out)
+
+
+def main ():
+    parser = argparse.ArgumentParser (description = "Generate the UVC descriptors and format table from a stream table.")
+    parser.add_argument ("table", help = "stream table (cyfxuvcstreams.json)")
+    parser.add_argument ("-o", "--outdir", help = "output directory (default: directory of the table)")
+    parser.add_argument ("--check", action = "store_true", help = "fail if the generated files are out of date")
+    args = parser.parse_args ()
+
+    outdir = args.outdir or os.path.dirname (os.path.abspath (args.table))
+    try:
+        with open (args.table) as f:
+            table = json.load (f)
+        gen   = Builder (table, os.path.basename (args.table), os.path.dirname (os.path.abspath (args.table)))
+        files = { "cyfxuvcdscr.c": gen.dscr_file (), "cyfxuvcformats.c": gen.formats_file (),
+                  "cyfxuvccontrols.c": gen.controls_file () }
+    except (GenError, KeyError, ValueError) as e:
+        print ("%s: %s" % (args.table, e), file = sys.stderr)
+        return 2
+
+    stale = 0
+    for name, text in sorted (files.items ()):
+        path = os.path.join (outdir, name)
+        if args.check:
+            try:
+                with open (path) as f:
+                    old = f.read ()
+            except IOError:
+                old = ""
+            if old != text:
+                stale += 1
+                print ("%s is out of date with %s" % (path, args.table), file = sys.stderr)
+                sys.stderr.writelines (list (difflib.unified_diff (old.splitlines (True), text.splitlines (True),
+                                                                    path, "generated", n = 1))[:40])
+        else:
+            with open (path, "w") as f:
+                f.write (text)
+            print ("wrote %s" % path)
+    return 1 if stale else 0
+
+
+if __name__ == "__main__":
+    sys.exit (main ())
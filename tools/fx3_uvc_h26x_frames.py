@@ -0,0 +1,301 @@
+#!/usr/bin/env python3
+#
+# H.264 and H.265 test stream generator for the FX3 UVC examples.
+#
+# Renders the same colour bar frames as fx3_uvc_mjpeg_frames.py, encodes them as one closed group
+# of pictures (an IDR picture followed by P pictures only) and prints the access units as the C
+# arrays used by cyfxuvcvidframes.c:
+#
+#     const uint32_t glVidFrameLen<suffix>[<frames>] = { ... };
+#     const uint8_t  glUVCVidFrames<suffix>[] = { ... };
+#
+# Each stored frame is one Annex B access unit, start codes included. The first one carries the
+# parameter sets (and for H.265 the video parameter set) in front of the IDR slice, so that a decoder
+# can join the stream whenever the streamer starts over from the first access unit, and the stream
+# can be looped without a decoder reset. The encoder's informational SEI message is dropped.
+#
+# The comment above the arrays gives the profile and level of the sequence parameter set. For H.264,
+# copy profile_idc and the constraint flags to the "profile" entry ("0x" profile_idc, constraint
+# flags) of the frame in cyfxuvcstreams.json and level_idc to its "level" entry; the H.265 frames
+# are described by the frame based format, which has no such fields. The maximum frame size and the
+# bit rates are taken from the access unit sizes by the descriptor generator.
+#
+# With --qp the sequence is encoded at a constant quantization parameter instead of a bit rate, as one
+# of the quality tiers of a frame (the "tiers" list of its "data" entry): the arrays are named after the
+# QP, and the QP goes to the "qp" entry of the tier. For H.264 the comment also gives the average slice
+# QP of the P pictures, which is the "qp" entry of the rate controlled sequence.
+#
+# Usage:
+#
+#     python3 ../tools/fx3_uvc_h26x_frames.py 320x240 --level 2.1 >> cyfxuvcvidframes.c
+#     python3 ../tools/fx3_uvc_h26x_frames.py 320x240 --codec hevc --level 2.1 >> cyfxuvcvidframes.c
+#     python3 ../tools/fx3_uvc_h26x_frames.py 320x240 --level 2.1 --qp 36 >> cyfxuvcvidframes.c
+#
+# Requires Pillow and PyAV (pip install av) with libx264 and libx265.
+#
+
+import argparse
+import fractions
+import os
+import sys
+
+sys.path.insert (0, os.path.dirname (os.path.abspath (__file__)))
+from fx3_uvc_mjpeg_frames import render, c_bytes
+
+try:
+    import av
+except ImportError:
+    sys.exit ("fx3_uvc_h26x_frames.py needs PyAV (pip install av)")
+
+# Per codec: encoder, NAL unit header length, type of a NAL unit from its first byte, the SEI and SPS
+# NAL unit types, and the encoder options for one closed GOP without reordering.
+CODECS = {
+    "h264": {
+        "name": "H.264", "encoder": "libx264", "header": 1, "type": lambda b: b & 0x1F, "sei": 6, "sps": 7,
+        "options": lambda frames, level, qp: {
+            "profile": "baseline",
+            "tune": "zerolatency",
+            "x264-params": "keyint=%d:min-keyint=%d:scenecut=0:bframes=0:ref=1:repeat-headers=1:annexb=1:"
+                           "level=%s:nal-hrd=none%s" % (frames, frames, level, ":qp=%d" % qp if qp else "")
+        }
+    },
+    "hevc": {
+        "name": "H.265", "encoder": "libx265", "header": 2, "type": lambda b: (b >> 1) & 0x3F, "sei": 39, "sps": 33,
+        "options": lambda frames, level, qp: {
+            "tune": "zerolatency",
+            "x265-params": "keyint=%d:min-keyint=%d:scenecut=0:bframes=0:ref=1:repeat-headers=1:annexb=1:"
+                           "open-gop=0:info=0:level-idc=%s:log-level=error%s"
+                           % (frames, frames, level, ":qp=%d" % qp if qp else "")
+        }
+    },
+}
+
+# SEI payload type of the encoder's version string.
+SEI_USER_DATA_UNREGISTERED = 5
+
+
+def nal_units (au):
+    """Split an Annex B access unit into NAL units, start codes included."""
+    starts = []
+    i = 0
+    while True:
+        i = au.find (b"\x00\x00\x01", i)
+        if i < 0:
+            break
+        starts.append (i - 1 if i > 0 and au[i - 1] == 0 else i)
+        i += 3
+    return [au[s:e] for s, e in zip (starts, starts[1:] + [len (au)])]
+
+
+def payload (nal):
+    return nal[nal.index (b"\x00\x00\x01") + 3:]
+
+
+def rbsp (data):
+    """Remove the emulation prevention bytes from a NAL unit payload."""
+    out = bytearray ()
+    zeros = 0
+    for c in data:
+        if zeros >= 2 and c == 3:
+            zeros = 0
+            continue
+        out.append (c)
+        zeros = zeros + 1 if c == 0 else 0
+    return bytes (out)
+
+
+class Bits:
+    """Exp-Golomb reader over an RBSP."""
+
+    def __init__ (self, data):
+        self.data = data
+        self.pos  = 0
+
+    def u (self, n):
+        v = 0
+        for _ in range (n):
+            v = (v << 1) | ((self.data[self.pos >> 3] >> (7 - (self.pos & 7))) & 1)
+            self.pos += 1
+        return v
+
+    def ue (self):
+        zeros = 0
+        while self.u (1) == 0:
+            zeros += 1
+        return (1 << zeros) - 1 + self.u (zeros)
+
+    def se (self):
+        v = self.ue ()
+        return (v + 1) // 2 if v & 1 else -(v // 2)
+
+
+def h264_slice_qps (aus):
+    """Slice QP of each picture of a baseline H.264 stream, read from the slice headers."""
+    sps = pps = None
+    qps = []
+    for au in aus:
+        for n in nal_units (au):
+            nal = payload (n)
+            kind, ref_idc, b = nal[0] & 0x1F, (nal[0] >> 5) & 3, Bits (rbsp (nal[1:]))
+            if kind == 7:
+                b.u (24)
+                b.ue ()
+                sps = { "frame_num": b.ue () + 4, "poc_type": b.ue () }
+                if sps["poc_type"] == 0:
+                    sps["poc_lsb"] = b.ue () + 4
+                elif sps["poc_type"] == 1:
+                    sys.exit ("pic_order_cnt_type 1 is not supported")
+                b.ue ()
+                b.u (1)
+                b.ue ()
+                b.ue ()
+                if not b.u (1):
+                    sys.exit ("field coding is not supported")
+            elif kind == 8:
+                b.ue ()
+                b.ue ()
+                if b.u (1):
+                    sys.exit ("CABAC is not supported")
+                pps = { "bottom_field_poc": b.u (1) }
+                if b.ue ():
+                    sys.exit ("slice groups are not supported")
+                b.ue ()
+                b.ue ()
+                if b.u (1) or b.u (2):
+                    sys.exit ("weighted prediction is not supported")
+                pps["init_qp"] = 26 + b.se ()
+                b.se ()
+                b.se ()
+                b.u (1)
+                b.u (1)
+                pps["redundant_pic_cnt"] = b.u (1)
+            elif kind in (1, 5):
+                b.ue ()
+                slice_type = b.ue () % 5
+                b.ue ()
+                b.u (sps["frame_num"])
+                if kind == 5:
+                    b.ue ()
+                if sps["poc_type"] == 0:
+                    b.u (sps["poc_lsb"])
+                    if pps["bottom_field_poc"]:
+                        b.se ()
+                if pps["redundant_pic_cnt"]:
+                    b.ue ()
+                if slice_type == 0:
+                    if b.u (1):
+                        b.ue ()
+                    if b.u (1):
+                        while b.ue () != 3:
+                            b.ue ()
+                if ref_idc:
+                    if kind == 5:
+                        b.u (2)
+                    elif b.u (1):
+                        while True:
+                            op = b.ue ()
+                            if op == 0:
+                                break
+                            if op in (1, 3):
+                                b.ue ()
+                            if op in (2, 3, 4, 6):
+                                b.ue ()
+                qps.append ((kind == 5, pps["init_qp"] + b.se ()))
+                break
+    return qps
+
+
+def profile_text (codec, sps):
+    """Profile and level of a sequence parameter set (NAL unit header included)."""
+    sps = rbsp (sps)
+    if codec == "h264":
+        return "profile_idc %d, constraint flags 0x%02X, level_idc %d" % (sps[1], sps[2], sps[3])
+    # H.265: profile_tier_level follows the parameter set IDs and sub-layer count.
+    return "general_profile_idc %d, general_level_idc %d (level %g)" % (sps[3] & 0x1F, sps[14], sps[14] / 30.0)
+
+
+def encode (codec, width, height, frames, rate, bitrate, level, qp):
+    cd  = CODECS[codec]
+    ctx = av.CodecContext.create (cd["encoder"], "w")
+    ctx.width     = width
+    ctx.height    = height
+    ctx.pix_fmt   = "yuv420p"
+    ctx.time_base = fractions.Fraction (1, rate)
+    ctx.framerate = fractions.Fraction (rate, 1)
+    ctx.bit_rate  = bitrate
+    ctx.options   = cd["options"] (frames, level, qp)
+
+    aus = []
+    for i in range (frames):
+        pic = av.VideoFrame.from_image (render (width, height, i, frames)).reformat (format = "yuv420p")
+        pic.pts = i
+        aus += [bytes (p) for p in ctx.encode (pic)]
+    aus += [bytes (p) for p in ctx.encode (None)]
+    if len (aus) != frames:
+        sys.exit ("expected %d access units, the encoder returned %d" % (frames, len (aus)))
+
+    # Drop the encoder's version string, which is sent as user data in the first access unit.
+    out = []
+    for au in aus:
+        keep = [n for n in nal_units (au)
+                if not (cd["type"] (payload (n)[0]) == cd["sei"] and
+                        payload (n)[cd["header"]] == SEI_USER_DATA_UNREGISTERED)]
+        out.append (b"".join (keep))
+    return out
+
+
+def main ():
+    parser = argparse.ArgumentParser (description = "Generate an H.264 or H.265 test stream as C arrays.")
+    parser.add_argument ("size", help = "frame size, WIDTHxHEIGHT")
+    parser.add_argument ("--codec", choices = sorted (CODECS), default = "h264", help = "codec (default h264)")
+    parser.add_argument ("--frames", type = int, default = 16, help = "access units, one GOP (default 16)")
+    parser.add_argument ("--rate", type = int, default = 15, help = "frame rate the bit rate is set for (default 15)")
+    parser.add_argument ("--bitrate", type = int, default = 150000, help = "target bit rate in bits/s (default 150000)")
+    parser.add_argument ("--level", default = "2.1", help = "level (default 2.1)")
+    parser.add_argument ("--qp", type = int, help = "encode at this constant QP instead of the bit rate")
+    parser.add_argument ("--suffix", help = "array name suffix (default: H264_ or H265_ and the frame size)")
+    args = parser.parse_args ()
+
+    cd = CODECS[args.codec]
+    width, height = (int (v) for v in args.size.lower ().split ("x"))
+    suffix = args.suffix or "%s_%dx%d%s" % (cd["name"].replace (".", ""), width, height,
+                                            "_QP%d" % args.qp if args.qp else "")
+
+    aus = encode (args.codec, width, height, args.frames, args.rate, args.bitrate, args.level, args.qp)
+    sps = [payload (n) for n in nal_units (aus[0]) if cd["type"] (payload (n)[0]) == cd["sps"]]
+    if not sps:
+        sys.exit ("the first access unit has no sequence parameter set")
+    qps = h264_slice_qps (aus) if args.codec == "h264" else []
+
+    out = ["",
+           "/* %d x %d %s test stream: colour bars with the frame number burned in (tools/fx3_uvc_h26x_frames.py)."
+           % (width, height, cd["name"]),
+           " * One GOP of %d Annex B access units, IDR first; %s."
+           % (len (aus), profile_text (args.codec, sps[0])),
+           " * %s%s."
+           % ("Constant QP %d" % args.qp if args.qp else "Encoded at %d bits/s" % args.bitrate,
+              "" if args.qp or not qps else ", average slice QP of the P pictures %d"
+              % round (sum (q for idr, q in qps[1:]) / max (1, len (qps) - 1))),
+           " * Access units of %d to %d bytes, %d bytes in all. */"
+           % (min (len (a) for a in aus), max (len (a) for a in aus), sum (len (a) for a in aus)),
+           "const uint32_t glVidFrameLen%s[%d] = {" % (suffix, len (aus))]
+    lens = ["%d" % len (a) for a in aus]
+    for i in range (0, len (lens), 8):
+        out.append ("    " + ", ".join (lens[i:i + 8]) + ("," if i + 8 < len (lens) else ""))
+    out += ["};",
+            "",
+            "const uint8_t glUVCVidFrames%s[] __attribute__ ((aligned (32))) =" % suffix,
+            "{"]
+    for i, a in enumerate (aus):
+        if i:
+            out[-1] += ","
+            out.append ("")
+        out.append ("    /* Access unit %d%s */" % (i + 1, " (IDR)" if i == 0 else ""))
+        c_bytes (a, out)
+    out.append ("};")
+    print ("\n".join (out))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit (main ())
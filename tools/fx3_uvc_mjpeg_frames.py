@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+#
+# MJPEG test frame generator for the FX3 UVC examples.
+#
+# Renders a set of colour bar frames at one resolution, each with the resolution and the frame
+# number burned in and a marker that moves from frame to frame, encodes them as baseline JPEG and
+# prints them as the C arrays used by cyfxuvcvidframes.c:
+#
+#     const uint32_t glVidFrameLen<suffix>[<frames>] = { ... };
+#     const uint8_t  glUVCVidFrames<suffix>[] = { ... };
+#
+# The arrays are then referenced from the frame's "data" entry in cyfxuvcstreams.json. The frames
+# are stored in the code area, so keep the quality low and the frame count small for large
+# resolutions.
+#
+# Usage:
+#
+#     python3 ../tools/fx3_uvc_mjpeg_frames.py 320x240 --frames 2 >> cyfxuvcvidframes.c
+#
+# Requires Pillow.
+#
+
+import argparse
+import io
+import sys
+
+# Pillow is only needed to render frames: c_bytes is used by the other tools without it.
+try:
+    from PIL import Image, ImageDraw
+except ImportError:
+    Image = ImageDraw = None
+
+# 75% colour bars: white, yellow, cyan, green, magenta, red, blue.
+BARS = [(192, 192, 192), (192, 192, 0), (0, 192, 192), (0, 192, 0), (192, 0, 192), (192, 0, 0), (0, 0, 192)]
+
+
+def render (width, height, index, count):
+    if Image is None:
+        sys.exit ("rendering test frames needs Pillow (pip install Pillow)")
+    im   = Image.new ("RGB", (width, height), (16, 16, 16))
+    draw = ImageDraw.Draw (im)
+    bars = height * 3 // 4
+    for i, colour in enumerate (BARS):
+        draw.rectangle ([i * width // len (BARS), 0, (i + 1) * width // len (BARS) - 1, bars - 1], fill = colour)
+
+    # Marker moving along the bottom strip, so that consecutive frames can be told apart.
+    size = max (4, (height - bars) // 2)
+    x    = (width - size) * index // max (1, count - 1) if count > 1 else 0
+    draw.rectangle ([x, height - size, x + size - 1, height - 1], fill = (235, 235, 235))
+    draw.text ((width // 20, bars + (height - bars) // 8), "%dx%d #%d" % (width, height, index + 1),
+               fill = (235, 235, 235))
+    return im
+
+
+def c_bytes (data, out):
+    for i in range (0, len (data), 8):
+        chunk = data[i:i + 8]
+        last  = i + 8 >= len (data)
+        out.append ("    " + ",".join ("0x%02X" % c for c in chunk) + ("" if last else ","))
+
+
+def main ():
+    parser = argparse.ArgumentParser (description = "Generate MJPEG test frames as C arrays.")
+    parser.add_argument ("size", help = "frame size, WIDTHxHEIGHT")
+    parser.add_argument ("--frames", type = int, default = 2, help = "number of frames (default 2)")
+    parser.add_argument ("--quality", type = int, default = 50, help = "JPEG quality (default 50)")
+    parser.add_argument ("--suffix", help = "array name suffix (default: the frame size)")
+    args = parser.parse_args ()
+
+    width, height = (int (v) for v in args.size.lower ().split ("x"))
+    suffix = args.suffix or "%dx%d" % (width, height)
+
+    frames = []
+    for i in range (args.frames):
+        buf = io.BytesIO ()
+        image = render (width, height, i, args.frames)
+        image.save (buf, "JPEG", quality = args.quality, subsampling = 2, optimize = True)
+        frames.append (buf.getvalue ())
+
+    out = ["",
+           "/* %d x %d test frames: colour bars with the frame number burned in (tools/fx3_uvc_mjpeg_frames.py). */"
+           % (width, height),
+           "const uint32_t glVidFrameLen%s[%d] = {" % (suffix, len (frames)),
+           "    " + ", ".join ("%d" % len (f) for f in frames),
+           "};",
+           "",
+           "const uint8_t glUVCVidFrames%s[] __attribute__ ((aligned (32))) =" % suffix,
+           "{"]
+    for i, f in enumerate (frames):
+        if i:
+            out[-1] += ","
+            out.append ("")
+        out.append ("    /* Video frame %d */" % (i + 1))
+        c_bytes (f, out)
+    out.append ("};")
+    print ("\n".join (out))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit (main ())
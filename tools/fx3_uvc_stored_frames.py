@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+#
+# Stored frame converter for the FX3 UVC examples.
+#
+# Prints captured video frames, one file per video frame in stream order, as the C arrays used by
+# cyfxuvcvidframes.c:
+#
+#     const uint32_t glVidFrameLen<suffix>[<frames>] = { ... };
+#     const uint8_t  glUVCVidFrames<suffix>[] = { ... };
+#
+# The frames are copied as they are, so any compressed stream can be stored: JPEG images for an MJPEG
+# frame, or the frames of a stream sent with the frame based format, which the stream table lists as
+# a "frame_based" format with the FourCC (or GUID) of the stream. The frames can differ in size as
+# much as the stream needs; the descriptor generator reads the lengths back and reports the largest
+# frame as the maximum frame size and the average one as the bit rate. The stream is sent in a loop,
+# so it should start where a decoder can join it, and end where the first frame can follow.
+#
+# Usage:
+#
+#     ffmpeg -i capture.mkv -c:v copy -frames:v 30 -f image2 frame%02d.bin
+#     python3 ../tools/fx3_uvc_stored_frames.py --suffix VP8_640x480 frame*.bin >> cyfxuvcvidframes.c
+#
+
+import argparse
+import os
+import sys
+
+sys.path.insert (0, os.path.dirname (os.path.abspath (__file__)))
+from fx3_uvc_mjpeg_frames import c_bytes
+
+
+def main ():
+    parser = argparse.ArgumentParser (description = "Print captured video frames as C arrays.")
+    parser.add_argument ("files", nargs = "+", help = "one file per video frame, in stream order")
+    parser.add_argument ("--suffix", required = True, help = "array name suffix")
+    args = parser.parse_args ()
+
+    frames = []
+    for name in args.files:
+        with open (name, "rb") as f:
+            frames.append (f.read ())
+        if not frames[-1]:
+            sys.exit ("%s is empty" % name)
+    if len (frames) > 0xFFFF:
+        sys.exit ("at most 65535 video frames can be stored for a frame")
+
+    out = ["",
+           "/* %s: %d stored video frames (tools/fx3_uvc_stored_frames.py)." % (args.suffix, len (frames)),
+           " * Video frames of %d to %d bytes, %d bytes in all. */"
+           % (min (len (f) for f in frames), max (len (f) for f in frames), sum (len (f) for f in frames)),
+           "const uint32_t glVidFrameLen%s[%d] = {" % (args.suffix, len (frames))]
+    lens = ["%d" % len (f) for f in frames]
+    for i in range (0, len (lens), 8):
+        out.append ("    " + ", ".join (lens[i:i + 8]) + ("," if i + 8 < len (lens) else ""))
+    out += ["};",
+            "",
+            "const uint8_t glUVCVidFrames%s[] __attribute__ ((aligned (32))) =" % args.suffix,
+            "{"]
+    for i, f in enumerate (frames):
+        if i:
+            out[-1] += ","
+            out.append ("")
+        out.append ("    /* Video frame %d (%s) */" % (i + 1, os.path.basename (args.files[i])))
+        c_bytes (f, out)
+    out.append ("};")
+    print ("\n".join (out))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit (main ())